@@ -0,0 +1,154 @@
+#!/usr/bin/perl
+#
+# bench-hash-funcs.pl
+#
+# Compare the hash functions of a cperl configured with
+# -Dhash_func=SELECT, which selects one at startup by
+# $ENV{PERL_HASH_FUNC}. For every function and key set it reports
+# the inserted and looked up keys per second, and the chain length
+# distribution of the filled hash via Hash::Util::bucket_stats.
+#
+# With a perl without SELECT only its configured function is measured.
+#
+# Example usages:
+#
+# ./perl -Ilib Porting/bench-hash-funcs.pl
+# ./perl -Ilib Porting/bench-hash-funcs.pl --funcs=FNV1A,CRC32,SIPHASH
+# ./perl -Ilib Porting/bench-hash-funcs.pl --keys=100000 --sets=words,paths
+# ./perl -Ilib Porting/bench-hash-funcs.pl --perl=/opt/cperl/bin/cperl
+#
+# For instruction counts of the t/perf/benchmarks hash entries use
+# Porting/bench.pl with one --env=PERL_HASH_FUNC=name per perl:
+#
+# ./perl -Ilib Porting/bench.pl --tests=/^expr::hash/ \
+#   ./perl=fnv1a --env=PERL_HASH_FUNC=FNV1A ./perl=crc32 --env=PERL_HASH_FUNC=CRC32
+
+use strict;
+use warnings;
+use Getopt::Long qw(GetOptions);
+
+my @all_funcs = qw(FNV1A FNV1A_YT SUPERFAST MURMUR3 DJB2 SDBM OAAT OAAT_HARD
+                   CRC32 SIPHASH MURMUR64A MURMUR64B METRO64CRC METRO64
+                   SPOOKY32);
+my @all_sets = qw(words ints idents paths hex);
+
+my %opt = (
+    perl   => $^X,
+    funcs  => join(",", @all_funcs),
+    sets   => join(",", @all_sets),
+    keys   => 50_000,
+    repeat => 5,
+);
+GetOptions(\%opt, 'perl=s', 'funcs=s', 'sets=s', 'keys=i', 'repeat=i',
+           'worker=s', 'help')
+    or usage();
+usage() if $opt{help};
+
+sub usage {
+    die <<EOF;
+usage: $0 [options]
+  --perl=PATH     the perl to benchmark, default $^X
+  --funcs=A,B,..  the hash functions, default all
+  --sets=A,B,..   the key sets: @all_sets
+  --keys=N        keys per set, default 50000
+  --repeat=N      best of N runs, default 5
+EOF
+}
+
+# The key sets, deterministic and independent of the hash function.
+sub key_set {
+    my ($set, $n) = @_;
+    my @k;
+    if ($set eq 'words') {          # natural language words from the pods
+        my %seen;
+        for my $pod (sort glob("pod/*.pod")) {
+            open my $fh, '<', $pod or next;
+            while (<$fh>) {
+                $seen{$_}++ or push @k, $_ for /([A-Za-z_]\w+)/g;
+            }
+            last if @k >= $n;
+        }
+        push @k, "word$_" for @k .. $n-1;   # no pods around
+    }
+    elsif ($set eq 'ints') {        # stringified integers
+        @k = (1 .. $n);
+    }
+    elsif ($set eq 'idents') {      # fully qualified names
+        @k = map { sprintf "Class%d::Sub%d::method_%d", $_ % 97, $_ % 13, $_ } 1 .. $n;
+    }
+    elsif ($set eq 'paths') {       # file paths with long common prefixes
+        @k = map { sprintf "/usr/local/lib/perl5/site_perl/%d/%s/%d.pm",
+                     $_ % 7, ("Foo","Bar","Baz","Moose")[$_ % 4], $_ } 1 .. $n;
+    }
+    elsif ($set eq 'hex') {         # uuid-like random strings
+        my $x = 12345;
+        @k = map { $x = ($x * 1103515245 + 12345) & 0x7fffffff;
+                   sprintf "%08x-%04x-%04x", $x, $_ & 0xffff, ($x >> 7) & 0xffff } 1 .. $n;
+    }
+    else {
+        die "Unknown key set $set\n";
+    }
+    $#k = $n - 1 if @k > $n;
+    return \@k;
+}
+
+# runs in the child perl with the selected hash function
+sub worker {
+    require Hash::Util;
+    require Time::HiRes;
+    my ($t0, $best_ins, $best_get);
+    print "func ", Hash::Util::hash_function(), "\n";
+    for my $set (split /,/, $opt{sets}) {
+        my $keys = key_set($set, $opt{keys});
+        my %h;
+        $best_ins = $best_get = 1e9;
+        for (1 .. $opt{repeat}) {
+            %h = ();
+            $t0 = Time::HiRes::time();
+            $h{$_} = 1 for @$keys;
+            my $t = Time::HiRes::time() - $t0;
+            $best_ins = $t if $t < $best_ins;
+            my $found = 0;
+            $t0 = Time::HiRes::time();
+            $found += $h{$_} for @$keys;
+            $t = Time::HiRes::time() - $t0;
+            $best_get = $t if $t < $best_get;
+        }
+        my ($k, $buckets, $used, $quality, $util, $coll, $mean, $stddev, @len)
+            = Hash::Util::bucket_stats(\%h);
+        printf "set %s %d %.0f %.0f %.3f %.1f %d\n", $set, scalar @$keys,
+            @$keys / ($best_ins || 1e-9), @$keys / ($best_get || 1e-9),
+            $quality, $coll, $#len;
+    }
+}
+
+if ($opt{worker}) {
+    worker();
+    exit 0;
+}
+
+printf "%-30s %-7s %12s %12s %8s %6s %4s\n",
+    "function", "keys", "insert/s", "lookup/s", "quality", "coll%", "max";
+my $cmd = join " ", map { my $a = $_; $a =~ s/'/'\\''/g; "'$a'" }
+    $opt{perl}, (map "-I$_", grep !ref, @INC), $0,
+    "--worker=1", "--keys=$opt{keys}", "--repeat=$opt{repeat}",
+    "--sets=$opt{sets}";
+my %done;
+for my $func (split /,/, $opt{funcs}) {
+    local $ENV{PERL_HASH_FUNC} = $func;
+    my @out = `$cmd 2>&1`;
+    die "$opt{perl} failed: @out" if $?;
+    my ($used) = map /^func (\S+)/, @out;
+    if (!$used or $done{$used}++) {
+        # not compiled in, unsupported CPU, or no SELECT
+        print "$func: not selectable, skipped\n";
+        next;
+    }
+    for (@out) {
+        next unless my ($set, @r) = /^set (\S+) (.*)/ ? ($1, split " ", $2) : ();
+        printf "%-30s %-7s %12s %12s %8s %6s %4s\n",
+            "$used $set", @r;
+    }
+}
+
+# ex: set ts=8 sts=4 sw=4 et:
@@ -0,0 +1,8 @@
+
+sub f1 {
+   my($self) = @_;
+   $self->f2;
+}
+sub f2 {}
+sub new {}
+print "@ARGV\n";
\ No newline at end of file
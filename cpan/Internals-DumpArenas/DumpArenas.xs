@@ -80,6 +80,10 @@ DumpHvARRAY( pTHX_ PerlIO *f, SV *sv) {
 
   PerlIO_printf(f,"HvARRAY(0x%" UVxf ")\n",PTR2UV(HvARRAY(sv)));
   if (!HvARRAY(sv)) goto hvend;
+#ifdef HvSHAPED
+  /* a value vector, no HEs */
+  if (HvSHAPED(sv)) goto hvend;
+#endif
 
   for ( key = 0; key <= HvMAX(sv); ++key ) {
     for ( entry = HvARRAY(sv)[key]; entry; entry = HeNEXT(entry) ) {
@@ -521,7 +521,8 @@ egrent		endgrent
 getlogin	getlogin
 syscall		syscall
 lock		SKIP
-setstate	SKIP
+enterinline	SKIP (inlined f())
+leaveinline	SKIP (inlined f())
 method_named	$x->y()
 method_super	SKIP (not yet)
 method_redir	SKIP (not yet)
@@ -737,7 +737,9 @@ Perl_do_sprintf(pTHX_ SV *sv, SSize_t len, SV **sarg)
     SvUTF8_off(sv);
     if (DO_UTF8(*sarg))
         SvUTF8_on(sv);
-    sv_vsetpvfn(sv, pat, patlen, NULL, sarg + 1, (Size_t)(len - 1), &do_taint);
+    if (!sv_sprintf_const(sv, *sarg, sarg + 1, len - 1))
+        sv_vsetpvfn(sv, pat, patlen, NULL, sarg + 1, (Size_t)(len - 1),
+                    &do_taint);
     SvSETMAGIC(sv);
     if (do_taint)
 	SvTAINTED_on(sv);
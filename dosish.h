@@ -50,6 +50,7 @@
 #ifndef PERL_SYS_TERM_BODY
 #  define PERL_SYS_TERM_BODY()                         \
     HINTS_REFCNT_TERM; KEYWORD_PLUGIN_MUTEX_TERM;      \
+    STRTAB_TERM;                                       \
     OP_CHECK_MUTEX_TERM; OP_REFCNT_TERM; PERLIO_TERM;  \
     MALLOC_TERM; LOCALE_TERM; USER_PROP_MUTEX_TERM;
 #endif
@@ -1449,12 +1449,10 @@ S_do_op_dump_bar(pTHX_ I32 level, UV bar, PerlIO *file, const OP *o, const CV *c
 #endif
 	break;
     case OP_NULL:
-	if (o->op_targ < OP_NEXTSTATE || o->op_targ > OP_DBSTATE)
+	if (o->op_targ != OP_NEXTSTATE && o->op_targ != OP_DBSTATE)
 	    break;
 	/* FALLTHROUGH */
     case OP_NEXTSTATE:
-    case OP_SETSTATE:
-    case OP_KEEPSTATE:
     case OP_DBSTATE:
 	if (CopLINE(cCOPo))
 	    S_opdump_indent(aTHX_ o, level, bar, file, "LINE = %" UVuf "\n",
@@ -1981,6 +1979,10 @@ Perl_do_magic_dump(pTHX_ I32 level, PerlIO *file, const MAGIC *mg, I32 nest,
 				     i,
 				     (UV)cache[i * 2],
 				     (UV)cache[i * 2 + 1]);
+	        if (cache[PERL_MAGIC_UTF8_SAMPLES])
+		    Perl_dump_indent(aTHX_ level, file,
+				     "      INDEX = %" UVuf " samples\n",
+				     (UV)cache[PERL_MAGIC_UTF8_SAMPLES]);
 	    }
 	}
     }
@@ -2109,7 +2111,8 @@ const struct flag_to_name hv_flags_names[] = {
     {SVphv_LAZYDEL, "LAZYDEL,"},
     {SVphv_HASKFLAGS, "HASKFLAGS,"},
     {SVf_AMAGIC, "OVERLOAD,"},
-    {SVphv_CLONEABLE, "CLONEABLE,"}
+    {SVphv_CLONEABLE, "CLONEABLE,"},
+    {SVphv_SHAPED, "SHAPED,"}
 #ifdef SVphv_CLASS
     ,{SVphv_CLASS, "CLASS,"}
 #endif
@@ -2189,6 +2192,9 @@ const struct flag_to_name hv_aux_flags_names[] = {
 #ifdef HvAUXf_ROLE
     ,{HvAUXf_ROLE, "ROLE,"}
 #endif
+#ifdef HvAUXf_OPENADDR
+    ,{HvAUXf_OPENADDR, "OPENADDR,"}
+#endif
 };
 
 
@@ -2246,7 +2252,9 @@ Perl_do_sv_dump(pTHX_ I32 level, PerlIO *file, SV *sv, I32 nest, I32 maxnest,
 	if (SvWEAKREF(sv))	sv_catpvs(d, "WEAKREF,");
     }
     if (flags & SVf_IsCOW && type != SVt_PVHV) sv_catpvs(d, "IsCOW,");
-    append_flags(d, flags, second_sv_flags_names);
+    /* SVphv_SHAPED is also SVf_NATIVE */
+    append_flags(d, type == SVt_PVHV ? flags & ~SVphv_SHAPED : flags,
+                 second_sv_flags_names);
     if (flags & SVp_SCREAM && type != SVt_PVHV && !isGV_with_GP(sv)
 			   && type != SVt_PVAV) {
 	if (SvPCS_IMPORTED(sv))
@@ -2404,8 +2412,8 @@ Perl_do_sv_dump(pTHX_ I32 level, PerlIO *file, SV *sv, I32 nest, I32 maxnest,
 				       (IV)SvLEN(sv));
 #ifdef PERL_COPY_ON_WRITE
 	    if (SvIsCOW(sv) && SvLEN(sv))
-		Perl_dump_indent(aTHX_ level, file, "  COW_REFCNT = %d\n",
-				       CowREFCNT(sv));
+		Perl_dump_indent(aTHX_ level, file, "  COW_REFCNT = %" UVuf "\n",
+				       (UV)CowREFCNT(sv));
 #endif
 	}
 	else
@@ -2474,10 +2482,28 @@ Perl_do_sv_dump(pTHX_ I32 level, PerlIO *file, SV *sv, I32 nest, I32 maxnest,
             SV_SET_STRINGIFY_FLAGS(d,aux->xhv_aux_flags,hv_aux_flags_names);
             Perl_dump_indent(aTHX_ level, file, "  AUX_FLAGS = 0x%" UVxf " (%s)\n",
                              (UV)aux->xhv_aux_flags, SvCUR(d) ? SvPVX_const(d) + 1 : "");
+            if (aux->xhv_perfect)
+                Perl_dump_indent(aTHX_ level, file, "  PERFECT = %u slots, %u displacements\n",
+                                 (unsigned)(1U << (32 - aux->xhv_perfect->xhvph_shift)),
+                                 (unsigned)aux->xhv_perfect->xhvph_dmax + 1);
+            if (aux->xhv_split_todo)
+                Perl_dump_indent(aTHX_ level, file, "  SPLIT_TODO = %u\n",
+                                 (unsigned)aux->xhv_split_todo);
+            if (aux->xhv_oindex)
+                Perl_dump_indent(aTHX_ level, file, "  OINDEX = %u slots, %u used\n",
+                                 (unsigned)aux->xhv_oindex->xhvo_max + 1,
+                                 (unsigned)aux->xhv_oindex->xhvo_used);
         }
 	Perl_dump_indent(aTHX_ level, file, "  ARRAY = 0x%" UVxf, PTR2UV(HvARRAY(sv)));
 	usedkeys = HvUSEDKEYS(MUTABLE_HV(sv));
-	if (HvARRAY(sv) && usedkeys) {
+	if (HvSHAPED(sv)) {
+	    const struct hv_shape * const shape = HvSHAPE(sv);
+	    (void)PerlIO_putc(file, '\n');
+	    Perl_dump_indent(aTHX_ level, file, "  SHAPE = 0x%" UVxf
+                             " (%u keys, REFCNT = %u)", PTR2UV(shape),
+                             (unsigned)shape->hs_keys, (unsigned)shape->hs_refcnt);
+	}
+	else if (HvARRAY(sv) && usedkeys) {
 	    /* Show distribution of HEs in the ARRAY */
 	    unsigned freq[200];
 #define FREQ_MAX ((int)(C_ARRAY_LENGTH(freq) - 1))
@@ -2537,7 +2563,7 @@ Perl_do_sv_dump(pTHX_ I32 level, PerlIO *file, SV *sv, I32 nest, I32 maxnest,
             unsigned count = 0;
             HE **ents = HvARRAY(sv);
 
-            if (ents) {
+            if (ents && !HvSHAPED(sv)) {
                 HE *const *const last = ents + HvMAX(sv);
                 count = last + 1 - ents;
                 do {
@@ -2688,7 +2714,25 @@ Perl_do_sv_dump(pTHX_ I32 level, PerlIO *file, SV *sv, I32 nest, I32 maxnest,
 	}
 	if (nest < maxnest) {
 	    HV * const hv = MUTABLE_HV(sv);
-	    if (HvARRAY(hv)) {
+	    if (HvSHAPED(hv)) {
+                const struct hv_shape * const shape = HvSHAPE(hv);
+                U32 i;
+		for (i = 0; i < shape->hs_keys; i++) {
+                    const HEK * const hek = shape->hs_heks[i];
+                    if (i > maxnest - nest) {
+                        Perl_dump_indent(aTHX_ level+1, file,
+                                         "... (skipping Elt %u-%u)\n",
+                                         (unsigned)i, (unsigned)shape->hs_keys);
+                        break;
+                    }
+                    Perl_dump_indent(aTHX_ level+1, file, "Elt %s ",
+                                     pv_display(d, HEK_KEY(hek), HEK_LEN(hek), 0, pvlim));
+                    PerlIO_printf(file, "HASH = 0x%" UVxf "\n", (UV)HEK_HASH(hek));
+                    do_sv_dump(level+1, file, HvSHAPED_VALS(hv)[i], nest+1,
+                               maxnest, dumpops, pvlim);
+                }
+	    }
+	    else if (HvARRAY(hv)) {
                 HE *he;
                 U32 i;
                 U32 count = 0;
@@ -46,6 +46,7 @@
 #define _to_utf8_lower_flags(a,b,c,d,e,f,g)	Perl__to_utf8_lower_flags(aTHX_ a,b,c,d,e,f,g)
 #define _to_utf8_title_flags(a,b,c,d,e,f,g)	Perl__to_utf8_title_flags(aTHX_ a,b,c,d,e,f,g)
 #define _to_utf8_upper_flags(a,b,c,d,e,f,g)	Perl__to_utf8_upper_flags(aTHX_ a,b,c,d,e,f,g)
+#define _utf8_valid_prefix	Perl__utf8_valid_prefix
 #define _utf8n_to_uvchr_msgs_helper	Perl__utf8n_to_uvchr_msgs_helper
 #define amagic_call(a,b,c,d)	Perl_amagic_call(aTHX_ a,b,c,d)
 #define amagic_deref_call(a,b)	Perl_amagic_deref_call(aTHX_ a,b)
@@ -647,6 +648,7 @@
 #define rninstr			Perl_rninstr
 #define rsignal(a,b)		Perl_rsignal(aTHX_ a,b)
 #define rsignal_state(a)	Perl_rsignal_state(aTHX_ a)
+#define runops_cgoto()		Perl_runops_cgoto(aTHX)
 #define runops_debug()		Perl_runops_debug(aTHX)
 #define runops_standard()	Perl_runops_standard(aTHX)
 #define rv2cv_op_cv(a,b)	Perl_rv2cv_op_cv(aTHX_ a,b)
@@ -731,6 +733,7 @@
 #define sv_2pvbyte(a,b)		Perl_sv_2pvbyte(aTHX_ a,b)
 #define sv_2pvutf8(a,b)		Perl_sv_2pvutf8(aTHX_ a,b)
 #define sv_2uv_flags(a,b)	Perl_sv_2uv_flags(aTHX_ a,b)
+#define sv_arena_stats(a)	Perl_sv_arena_stats(aTHX_ a)
 #define sv_backoff		Perl_sv_backoff
 #define sv_bless(a,b)		Perl_sv_bless(aTHX_ a,b)
 #define sv_cat_decode(a,b,c,d,e,f)	Perl_sv_cat_decode(aTHX_ a,b,c,d,e,f)
@@ -845,6 +848,7 @@
 #define sv_setuv_mg(a,b)	Perl_sv_setuv_mg(aTHX_ a,b)
 #define sv_string_from_errnum(a,b)	Perl_sv_string_from_errnum(aTHX_ a,b)
 #define sv_tainted(a)		Perl_sv_tainted(aTHX_ a)
+#define sv_trim_arenas()	Perl_sv_trim_arenas(aTHX)
 #define sv_true(a)		Perl_sv_true(aTHX_ a)
 #define sv_uni_display(a,b,c,d)	Perl_sv_uni_display(aTHX_ a,b,c,d)
 #define sv_unmagic(a,b)		Perl_sv_unmagic(aTHX_ a,b)
@@ -1006,6 +1010,9 @@
 #define free_global_struct(a)	Perl_free_global_struct(aTHX_ a)
 #define init_global_struct()	Perl_init_global_struct(aTHX)
 #endif
+#if defined(PERL_HASH_FUNC_SELECT)
+#define hash_func_select(a)	Perl_hash_func_select(aTHX_ a)
+#endif
 #if defined(PERL_IMPLICIT_CONTEXT)
 #define croak_nocontext		Perl_croak_nocontext
 #define deb_nocontext		Perl_deb_nocontext
@@ -1056,11 +1063,16 @@
 #define get_avn_flags(a,b,c)	Perl_get_avn_flags(aTHX_ a,b,c)
 #define get_hvn_flags(a,b,c)	Perl_get_hvn_flags(aTHX_ a,b,c)
 #define get_svn_flags(a,b,c)	Perl_get_svn_flags(aTHX_ a,b,c)
+#define hv_bucket_stats(a,b)	Perl_hv_bucket_stats(aTHX_ a,b)
 #define hv_common(a,b,c,d,e,f,g,h)	Perl_hv_common(aTHX_ a,b,c,d,e,f,g,h)
 #define hv_iterinit(a)		Perl_hv_iterinit(aTHX_ a)
 #define hv_ksplit(a,b)		Perl_hv_ksplit(aTHX_ a,b)
+#define hv_open_addressing(a,b)	Perl_hv_open_addressing(aTHX_ a,b)
+#define hv_shape(a)		Perl_hv_shape(aTHX_ a)
+#define hv_store_list(a,b,c)	Perl_hv_store_list(aTHX_ a,b,c)
 #define hv_study(a)		Perl_hv_study(aTHX_ a)
 #define hv_undef_flags(a,b)	Perl_hv_undef_flags(aTHX_ a,b)
+#define hv_unshape(a)		Perl_hv_unshape(aTHX_ a)
 #define method_field_type(a)	Perl_method_field_type(aTHX_ a)
 #define newPADNAMEpvn_flags	Perl_newPADNAMEpvn_flags
 #define newSVsv(a)		Perl_newSVsv(aTHX_ a)
@@ -1159,6 +1171,9 @@
 #if defined(PERL_CORE) || defined(PERL_EXT)
 #define _byte_dump_string(a,b,c)	Perl__byte_dump_string(aTHX_ a,b,c)
 #define _inverse_folds(a,b,c)	Perl__inverse_folds(aTHX_ a,b,c)
+#define _utf8_from_bytes	Perl__utf8_from_bytes
+#define _utf8_from_bytes_back	Perl__utf8_from_bytes_back
+#define _utf8_to_bytes_prefix	Perl__utf8_to_bytes_prefix
 #define append_utf8_from_native_byte	S_append_utf8_from_native_byte
 #define av_reify(a)		Perl_av_reify(aTHX_ a)
 #define current_re_engine()	Perl_current_re_engine(aTHX)
@@ -1678,6 +1693,7 @@
 #define sv_mortalcopy_flags(a,b)	Perl_sv_mortalcopy_flags(aTHX_ a,b)
 #define sv_resetpvn(a,b,c)	Perl_sv_resetpvn(aTHX_ a,b,c)
 #define sv_sethek(a,b)		Perl_sv_sethek(aTHX_ a,b)
+#define sv_sprintf_const(a,b,c,d)	Perl_sv_sprintf_const(aTHX_ a,b,c,d)
 #ifndef PERL_IMPLICIT_CONTEXT
 #define tied_method		Perl_tied_method
 #endif
@@ -1887,6 +1903,13 @@
 #      endif
 #    endif
 #  endif
+#  if defined(PERL_GLOBAL_STRTAB)
+#    if defined(USE_ITHREADS)
+#define strtab_hek_inc		Perl_strtab_hek_inc
+#define strtab_init		Perl_strtab_init
+#define strtab_term		Perl_strtab_term
+#    endif
+#  endif
 #  if defined(PERL_HASH_RANDOMIZE_KEYS)
 #    if defined(PERL_IN_HV_C)
 #define ptr_hash		S_ptr_hash
@@ -1896,8 +1919,10 @@
 #    if defined(PERL_IN_OP_C)
 #      if defined(USE_CPERL)
 #define cv_check_inline(a,b)	S_cv_check_inline(aTHX_ a,b)
-#define cv_do_inline(a,b,c,d)	S_cv_do_inline(aTHX_ a,b,c,d)
-#define op_clone_sv(a)		S_op_clone_sv(aTHX_ a)
+#define cv_do_inline(a,b)	S_cv_do_inline(aTHX_ a,b)
+#define inline_check_body(a,b,c,d,e,f)	S_inline_check_body(aTHX_ a,b,c,d,e,f)
+#define inline_clone(a,b,c,d,e,f)	S_inline_clone(aTHX_ a,b,c,d,e,f)
+#define inline_mderef(a,b,c,d,e)	S_inline_mderef(aTHX_ a,b,c,d,e)
 #      endif
 #    endif
 #  endif
@@ -1949,6 +1974,7 @@
 #    endif
 #  endif
 #  if defined(PERL_IN_HV_C)
+#define bucket_chain_stats(a,b,c)	S_bucket_chain_stats(aTHX_ a,b,c)
 #define clear_placeholders(a,b)	S_clear_placeholders(aTHX_ a,b)
 #define ctz			S_ctz
 #define hv_auxinit(a)		S_hv_auxinit(aTHX_ a)
@@ -1963,11 +1989,29 @@
 #define unshare_hek_or_pvn(a,b,c,d)	S_unshare_hek_or_pvn(aTHX_ a,b,c,d)
 #    if defined(USE_CPERL)
 #define hsplit(a,b,c)		S_hsplit(aTHX_ a,b,c)
+#define hsplit_bucket(a,b,c)	S_hsplit_bucket(aTHX_ a,b,c)
 #define hsplit_move_aux(a,b,c)	S_hsplit_move_aux(aTHX_ a,b,c)
+#define hsplit_step(a,b)	S_hsplit_step(aTHX_ a,b)
 #define hv_common_magical(a,b,c,d,e,f,g,h,i)	S_hv_common_magical(aTHX_ a,b,c,d,e,f,g,h,i)
 #define hv_delete_common(a,b,c,d,e,f,g)	S_hv_delete_common(aTHX_ a,b,c,d,e,f,g)
+#define hv_oindex_build(a,b)	S_hv_oindex_build(aTHX_ a,b)
+#define hv_oindex_delete	S_hv_oindex_delete
+#define hv_oindex_find		S_hv_oindex_find
+#define hv_oindex_free(a)	S_hv_oindex_free(aTHX_ a)
+#define hv_oindex_insert(a,b)	S_hv_oindex_insert(aTHX_ a,b)
+#define hv_oindex_prefix	S_hv_oindex_prefix
+#define hv_perfect_build(a)	S_hv_perfect_build(aTHX_ a)
+#define hv_perfect_free(a)	S_hv_perfect_free(aTHX_ a)
+#define hv_shape_dec(a)		S_hv_shape_dec(aTHX_ a)
+#define hv_shape_free(a)	S_hv_shape_free(aTHX_ a)
+#define hv_shape_index		S_hv_shape_index
 #define share_hek_flags(a,b,c,d)	S_share_hek_flags(aTHX_ a,b,c,d)
 #    endif
+#    if defined(USE_ITHREADS) && defined(PERL_GLOBAL_STRTAB)
+#define share_hek_global(a,b,c,d)	S_share_hek_global(aTHX_ a,b,c,d)
+#define strtab_stripe_split	S_strtab_stripe_split
+#define unshare_hek_global(a,b,c,d,e)	S_unshare_hek_global(aTHX_ a,b,c,d,e)
+#    endif
 #  endif
 #  if defined(PERL_IN_HV_C) && defined(DEBUGGING)
 #define action_name(a)		S_action_name(aTHX_ a)
@@ -2192,10 +2236,15 @@
 #  endif
 #  if defined(PERL_IN_PP_HOT_C)
 #define do_oddball(a,b)		S_do_oddball(aTHX_ a,b)
+#define hv_fetch_icache(a,b,c,d)	S_hv_fetch_icache(aTHX_ a,b,c,d)
 #define opmethod_stash(a)	S_opmethod_stash(aTHX_ a)
 #  endif
 #  if defined(PERL_IN_PP_PACK_C)
+#define classify_fixed		S_classify_fixed
+#define compile_num		S_compile_num
+#define compile_template	S_compile_template
 #define div128(a,b)		S_div128(aTHX_ a,b)
+#define find_group_end		S_find_group_end
 #define first_symbol		S_first_symbol
 #define get_num(a,b)		S_get_num(aTHX_ a,b)
 #define group_end(a,b,c)	S_group_end(aTHX_ a,b,c)
@@ -2206,8 +2255,13 @@
 #define need_utf8		S_need_utf8
 #define next_symbol(a)		S_next_symbol(aTHX_ a)
 #define pack_rec(a,b,c,d)	S_pack_rec(aTHX_ a,b,c,d)
+#define packlist_prog(a,b,c,d,e,f)	S_packlist_prog(aTHX_ a,b,c,d,e,f)
 #define sv_exp_grow(a,b)	S_sv_exp_grow(aTHX_ a,b)
+#define template_prog(a)	S_template_prog(aTHX_ a)
+#define unpack_assign(a,b,c,d,e)	S_unpack_assign(aTHX_ a,b,c,d,e)
+#define unpack_fixed(a,b,c,d,e)	S_unpack_fixed(aTHX_ a,b,c,d,e)
 #define unpack_rec(a,b,c,d,e)	S_unpack_rec(aTHX_ a,b,c,d,e)
+#define unpackstring_prog(a,b,c,d,e,f)	S_unpackstring_prog(aTHX_ a,b,c,d,e,f)
 #  endif
 #  if defined(PERL_IN_PP_SORT_C)
 #define amagic_cmp(a,b)		S_amagic_cmp(aTHX_ a,b)
@@ -2244,6 +2298,7 @@
 #define more_sv()		S_more_sv(aTHX)
 #define not_a_number(a)		S_not_a_number(aTHX_ a)
 #define not_incrementable(a)	S_not_incrementable(aTHX_ a)
+#define pack_arena_sets()	S_pack_arena_sets(aTHX)
 #define ptr_table_find		S_ptr_table_find
 #define sv_2iuv_common(a)	S_sv_2iuv_common(aTHX_ a)
 #define sv_add_arena(a,b,c)	S_sv_add_arena(aTHX_ a,b,c)
@@ -2253,7 +2308,10 @@
 #define sv_pos_u2b_forwards	S_sv_pos_u2b_forwards
 #define sv_pos_u2b_midway	S_sv_pos_u2b_midway
 #define sv_unglob(a,b)		S_sv_unglob(aTHX_ a,b)
+#define trim_body_arenas(a)	S_trim_body_arenas(aTHX_ a)
+#define trim_sv_arenas()	S_trim_sv_arenas(aTHX)
 #define uiv_2buf		S_uiv_2buf
+#define utf8_mg_index_build(a,b,c)	S_utf8_mg_index_build(aTHX_ a,b,c)
 #define utf8_mg_len_cache_update(a,b,c)	S_utf8_mg_len_cache_update(aTHX_ a,b,c)
 #define utf8_mg_pos_cache_update(a,b,c,d,e)	S_utf8_mg_pos_cache_update(aTHX_ a,b,c,d,e)
 #    if defined(USE_CPERL)
@@ -2355,6 +2413,10 @@
 #  if defined(PERL_IN_XSUTILS_C)
 #define prep_cif(a,b,c)		S_prep_cif(aTHX_ a,b,c)
 #  endif
+#  if defined(PERL_JIT)
+#define jit_free(a)		Perl_jit_free(aTHX_ a)
+#define jit_loop(a)		Perl_jit_loop(aTHX_ a)
+#  endif
 #  if defined(PERL_MEM_LOG)
 #define mem_log_alloc		Perl_mem_log_alloc
 #define mem_log_free		Perl_mem_log_free
@@ -91,6 +91,7 @@
 #define PL_constpadix		(vTHX->Iconstpadix)
 #define PL_cop_seqmax		(vTHX->Icop_seqmax)
 #define PL_count_null_ops	(vTHX->Icount_null_ops)
+#define PL_cowrefcnt_capped	(vTHX->Icowrefcnt_capped)
 #define PL_cryptseen		(vTHX->Icryptseen)
 #define PL_curcop		(vTHX->Icurcop)
 #define PL_curcopdb		(vTHX->Icurcopdb)
@@ -154,6 +155,9 @@
 #define PL_hash_slowdos		(vTHX->Ihash_slowdos)
 #define PL_hintgv		(vTHX->Ihintgv)
 #define PL_hv_fetch_ent_mh	(vTHX->Ihv_fetch_ent_mh)
+#define PL_hv_icache		(vTHX->Ihv_icache)
+#define PL_hv_split_entries	(vTHX->Ihv_split_entries)
+#define PL_hv_splits		(vTHX->Ihv_splits)
 #define PL_in_clean_all		(vTHX->Iin_clean_all)
 #define PL_in_clean_objs	(vTHX->Iin_clean_objs)
 #define PL_in_eval		(vTHX->Iin_eval)
@@ -166,6 +170,7 @@
 #define PL_inplace		(vTHX->Iinplace)
 #define PL_internal_random_state	(vTHX->Iinternal_random_state)
 #define PL_isarev		(vTHX->Iisarev)
+#define PL_jit_code		(vTHX->Ijit_code)
 #define PL_known_layers		(vTHX->Iknown_layers)
 #define PL_langinfo_buf		(vTHX->Ilanginfo_buf)
 #define PL_langinfo_bufsize	(vTHX->Ilanginfo_bufsize)
@@ -409,6 +414,10 @@
 #define PL_Gdollarzero_mutex	(my_vars->Gdollarzero_mutex)
 #define PL_fold_locale		(my_vars->Gfold_locale)
 #define PL_Gfold_locale		(my_vars->Gfold_locale)
+#define PL_hash_func		(my_vars->Ghash_func)
+#define PL_Ghash_func		(my_vars->Ghash_func)
+#define PL_hash_func_name	(my_vars->Ghash_func_name)
+#define PL_Ghash_func_name	(my_vars->Ghash_func_name)
 #define PL_hash_seed		(my_vars->Ghash_seed)
 #define PL_Ghash_seed		(my_vars->Ghash_seed)
 #define PL_hash_seed_set	(my_vars->Ghash_seed_set)
@@ -489,6 +498,8 @@
 #define PL_Gstrategy_socket	(my_vars->Gstrategy_socket)
 #define PL_strategy_socketpair	(my_vars->Gstrategy_socketpair)
 #define PL_Gstrategy_socketpair	(my_vars->Gstrategy_socketpair)
+#define PL_strtab_stripes	(my_vars->Gstrtab_stripes)
+#define PL_Gstrtab_stripes	(my_vars->Gstrtab_stripes)
 #define PL_sv_placeholder	(my_vars->Gsv_placeholder)
 #define PL_Gsv_placeholder	(my_vars->Gsv_placeholder)
 #define PL_thr_key		(my_vars->Gthr_key)
@@ -3,7 +3,7 @@
 
 package Devel::Peek;
 
-$VERSION = '1.28_03';
+$VERSION = '1.28_05';
 $XS_VERSION = $VERSION;
 $VERSION = eval $VERSION;
 
@@ -13,7 +13,7 @@ require XSLoader;
 @ISA = qw(Exporter);
 @EXPORT = qw(Dump mstat DeadCode DumpArray DumpWithOP DumpProg
 	     fill_mstats mstats_fillhash mstats2hash runops_debug debug_flags);
-@EXPORT_OK = qw(SvREFCNT CvGV);
+@EXPORT_OK = qw(SvREFCNT CvGV arena_stats trim_arenas cow_stats);
 %EXPORT_TAGS = ('ALL' => [@EXPORT, @EXPORT_OK]);
 
 XSLoader::load();
@@ -219,6 +219,45 @@ So, if you want to collect memory info in a cycle, you may call
     # Do something with %report
   }
 
+=head2 SV arenas
+
+SV heads and most bodies are allocated from arenas of about 4K, which
+are kept on free lists when an SV is freed, and are otherwise only
+released with the interpreter.
+
+C<arena_stats()> returns a hash reference with the number of free SV
+heads C<heads_free>, the number of head arenas C<head_arenas> and their
+size C<head_bytes>. For each SV type, like C<PV> or C<PVHV>, it holds a
+hash with the number of live C<heads>, and for the body types allocated
+from arenas the live C<bodies>, C<bodies_free>, C<body_arenas> and
+C<body_bytes>. The hash entries of all hashes are under C<HE>.
+
+  my $s = arena_stats();
+  printf "%d hashes, %d free HEs\n", $s->{PVHV}{heads},
+         $s->{HE}{bodies_free};
+
+C<trim_arenas()> frees all arenas without a live SV, body or hash
+entry, and returns the number of freed bytes. The free lists are
+rebuilt to hand out the fullest arenas first. With glibc the freed
+pages are returned to the OS. This is useful in a long running process
+after a big data structure was freed.
+
+Both walk all arenas, so don't call them in a tight loop. They are not
+exported by default.
+
+=head2 Copy-on-write strings
+
+A string buffer can be shared by several scalars, until one of them is
+changed. The number of scalars sharing a buffer is limited by the size
+of its refcount, 256 by default, and 4G with a perl built with
+C<-Accflags=-DPERL_COW_REFCNT_WIDE>. Further copies of the string copy
+the buffer.
+
+C<cow_stats()> returns a hash reference with the highest refcount seen
+C<max_refcnt>, the limit C<refcnt_limit>, and the number of buffer
+copies because the limit was reached, C<capped>. It is empty without
+copy-on-write.
+
 =head1 EXAMPLES
 
 The following examples don't attempt to show everything as that would be a
@@ -563,8 +602,8 @@ it has no prototype (C<PROTOTYPE> field is missing).
 
 C<Dump>, C<mstat>, C<DeadCode>, C<DumpArray>, C<DumpWithOP> and
 C<DumpProg>, C<fill_mstats>, C<mstats_fillhash>, C<mstats2hash> by
-default. Additionally available C<SvREFCNT>, C<SvREFCNT_inc> and
-C<SvREFCNT_dec>.
+default. Additionally available C<SvREFCNT>, C<SvREFCNT_inc>,
+C<SvREFCNT_dec>, C<arena_stats>, C<trim_arenas> and C<cow_stats>.
 
 =head1 BUGS
 
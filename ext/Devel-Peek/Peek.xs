@@ -136,6 +136,58 @@ DeadCode(pTHX)
 #endif /* !PURIFY */
 }
 
+static const char* const arena_type_names[SVt_LAST] = {
+    "NULL", "IV", "NV", "PV", "INVLIST", "PVIV", "PVNV", "PVMG",
+    "REGEXP", "PVGV", "PVLV", "PVAV", "PVHV", "PVCV", "PVFM", "PVIO"
+};
+
+/* sv_arena_stats() as hash, with a hash per SV type. The HE bodies
+   in the SVt_NULL slot are under "HE". */
+static SV *
+arena_stats(pTHX)
+{
+    struct sv_arena_stats st;
+    HV * const hv = newHV();
+    int type;
+
+    sv_arena_stats(&st);	/* before we create new SVs */
+    (void)hv_stores(hv, "heads_free", newSVuv(st.sas_heads_free));
+    (void)hv_stores(hv, "head_arenas", newSVuv(st.sas_head_arenas));
+    (void)hv_stores(hv, "head_bytes", newSVuv(st.sas_head_bytes));
+    for (type = 0; type < SVt_LAST; type++) {
+	HV * const thv = newHV();
+	HV * bhv = thv;
+	(void)hv_stores(thv, "heads", newSVuv(st.sas_heads[type]));
+	(void)hv_store(hv, arena_type_names[type],
+		       strlen(arena_type_names[type]),
+		       newRV_noinc((SV*)thv), 0);
+	if (!st.sas_body_arenas[type])
+	    continue;
+	if (type == SVt_NULL) {
+	    bhv = newHV();
+	    (void)hv_stores(hv, "HE", newRV_noinc((SV*)bhv));
+	}
+	(void)hv_stores(bhv, "bodies", newSVuv(st.sas_bodies[type]));
+	(void)hv_stores(bhv, "bodies_free", newSVuv(st.sas_bodies_free[type]));
+	(void)hv_stores(bhv, "body_arenas", newSVuv(st.sas_body_arenas[type]));
+	(void)hv_stores(bhv, "body_bytes", newSVuv(st.sas_body_bytes[type]));
+    }
+    return newRV_noinc((SV*)hv);
+}
+
+/* the COW refcount statistics of the interpreter */
+static SV *
+cow_stats(pTHX)
+{
+    HV * const hv = newHV();
+#ifdef PERL_COPY_ON_WRITE
+    (void)hv_stores(hv, "max_refcnt", newSVuv(PL_max_cowrefcnt));
+    (void)hv_stores(hv, "refcnt_limit", newSVuv(SV_COW_REFCNT_MAX));
+    (void)hv_stores(hv, "capped", newSVuv(PL_cowrefcnt_capped));
+#endif
+    return newRV_noinc((SV*)hv);
+}
+
 #if defined(MYMALLOC)
 #   define mstat(str) dump_mstats(str)
 #else
@@ -503,6 +555,27 @@ CODE:
 OUTPUT:
     RETVAL
 
+SV *
+arena_stats()
+CODE:
+    RETVAL = arena_stats(aTHX);
+OUTPUT:
+    RETVAL
+
+UV
+trim_arenas()
+CODE:
+    RETVAL = sv_trim_arenas();
+OUTPUT:
+    RETVAL
+
+SV *
+cow_stats()
+CODE:
+    RETVAL = cow_stats(aTHX);
+OUTPUT:
+    RETVAL
+
 MODULE = Devel::Peek		PACKAGE = Devel::Peek	PREFIX = _
 
 SV *
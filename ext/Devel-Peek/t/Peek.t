@@ -1620,4 +1620,48 @@ ok( $dump =~ /AUX_FLAGS = 0/ms,
     like( $d2, qr/^SV = IV\(/m, "ref lexical var stays IV");
 }
 
+# arena_stats and trim_arenas
+{
+    my $s0 = Devel::Peek::arena_stats();
+    my @big = map { { a => $_, b => "x$_" } } 1 .. 20000;
+    my $s1 = Devel::Peek::arena_stats();
+    cmp_ok( $s1->{PVHV}{heads}, '>=', $s0->{PVHV}{heads} + 20000,
+            'arena_stats counts the live hashes' );
+    cmp_ok( $s1->{HE}{bodies}, '>=', 40000, 'arena_stats counts the HEs' );
+    cmp_ok( $s1->{head_bytes}, '>', 20000 * 2 * 16, 'head_bytes' );
+    my @keep = @big[map { $_ * 200 } 0 .. 99];
+    @big = ();
+    my $s2 = Devel::Peek::arena_stats();
+    cmp_ok( $s2->{HE}{bodies_free}, '>=', 39000, 'freed HEs' );
+    my $freed = Devel::Peek::trim_arenas();
+    cmp_ok( $freed, '>', 0, 'trim_arenas frees the empty arenas' );
+    my $s3 = Devel::Peek::arena_stats();
+    cmp_ok( $s3->{HE}{body_arenas}, '<', $s2->{HE}{body_arenas},
+            'less HE arenas' );
+    cmp_ok( $s3->{head_arenas}, '<', $s2->{head_arenas},
+            'less SV head arenas' );
+    is( scalar(grep { $_->{b} eq "x$_->{a}" } @keep), 100,
+        'live hashes are kept' );
+    my @again = map { { a => $_ } } 1 .. 20000;
+    is( scalar(grep { $_->{a} == 1 } @again), 1,
+        'arenas are usable after trim_arenas' );
+}
+
+# cow_stats
+SKIP: {
+    my $c0 = Devel::Peek::cow_stats();
+    skip "no COW", 2 unless exists $c0->{refcnt_limit};
+    my $s = "x" x 100;
+    my @copies;
+    push @copies, $s for 1 .. 300;
+    my $c1 = Devel::Peek::cow_stats();
+    if ($c1->{refcnt_limit} < 300) {
+        is( $c1->{max_refcnt}, $c1->{refcnt_limit}, 'max COW refcnt' );
+        cmp_ok( $c1->{capped}, '>', $c0->{capped}, 'capped COW copies' );
+    } else {
+        cmp_ok( $c1->{max_refcnt}, '>=', 300, 'max COW refcnt' );
+        is( $c1->{capped}, $c0->{capped}, 'no capped COW copies' );
+    }
+}
+
 done_testing();
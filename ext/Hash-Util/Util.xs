@@ -77,6 +77,13 @@ PPCODE:
     	XSRETURN(1);
 
 
+void
+hash_function()
+PROTOTYPE:
+PPCODE:
+    	mXPUSHs(newSVpv(PERL_HASH_FUNC_NAME, 0));
+    	XSRETURN(1);
+
 void
 hash_value(string,...)
         SV* string
@@ -152,9 +159,14 @@ PPCODE:
         hv = PL_strtab;
     }
     if (hv) {
-        U32 max_bucket_index = HvMAX(hv);
-        U32 total_keys = HvUSEDKEYS(hv);
-        HE **bucket_array = HvARRAY(hv);
+        U32 max_bucket_index;
+        HE **bucket_array;
+        U32 total_keys;
+        if (HvSHAPED(hv))
+            hv_unshape((HV *)hv);
+        max_bucket_index = HvMAX(hv);
+        total_keys = HvUSEDKEYS(hv);
+        bucket_array = HvARRAY(hv);
         mXPUSHi(total_keys);
         mXPUSHi(max_bucket_index+1);
         mXPUSHi(0); /* for the number of used buckets */
@@ -213,7 +225,10 @@ PPCODE:
         hv = PL_strtab;
     }
     if (hv) {
-        HE **he_ptr = HvARRAY(hv);
+        HE **he_ptr;
+        if (HvSHAPED(hv))
+            hv_unshape((HV *)hv);
+        he_ptr = HvARRAY(hv);
         if (!he_ptr) {
             XSRETURN(0);
         } else {
@@ -331,3 +346,100 @@ PPCODE:
         }
 	XSRETURN_UNDEF;
 
+
+void
+open_addressing(rhv, ...)
+        SV* rhv
+PROTOTYPE: \%;$
+PPCODE:
+	if (SvROK(rhv)) {
+            rhv = SvRV(rhv);
+            if ( SvTYPE(rhv) == SVt_PVHV ) {
+                HV * const hv = (HV*)rhv;
+                const bool was = items > 1
+                    ? hv_open_addressing(hv, cBOOL(SvTRUE(ST(1))))
+                    : cBOOL(HvOPENADDR(hv));
+                if (was)
+                    XSRETURN_YES;
+                XSRETURN_NO;
+            }
+        }
+	XSRETURN_UNDEF;
+
+
+void
+hash_shaped(rhv, ...)
+        SV* rhv
+PROTOTYPE: \%;$
+PPCODE:
+	if (SvROK(rhv)) {
+            rhv = SvRV(rhv);
+            if ( SvTYPE(rhv) == SVt_PVHV ) {
+                HV * const hv = (HV*)rhv;
+                bool is = cBOOL(HvSHAPED(hv));
+                if (items > 1) {
+                    if (SvTRUE(ST(1)))
+                        is = hv_shape(hv);
+                    else {
+                        hv_unshape(hv);
+                        is = FALSE;
+                    }
+                }
+                if (is)
+                    XSRETURN_YES;
+                XSRETURN_NO;
+            }
+        }
+	XSRETURN_UNDEF;
+
+
+
+void
+hash_stats(rhv)
+        SV* rhv
+PPCODE:
+    HV * hv = NULL;
+    if (SvROK(rhv) && SvTYPE(SvRV(rhv)) == SVt_PVHV
+        && !(SvRMAGICAL(SvRV(rhv)) && mg_find(SvRV(rhv), PERL_MAGIC_tied))) {
+        hv = (HV *) SvRV(rhv);
+    } else if (!SvOK(rhv)) {
+        hv = PL_strtab;
+    }
+    if (hv) {
+        struct hv_stats st;
+        HV * const ret = newHV();
+        AV * const chains = newAV();
+        U32 i, n;
+        hv_bucket_stats(hv, &st);
+        (void)hv_stores(ret, "keys", newSVuv(st.hvs_keys));
+        (void)hv_stores(ret, "buckets", newSVuv(st.hvs_buckets));
+        (void)hv_stores(ret, "used", newSVuv(st.hvs_used));
+        (void)hv_stores(ret, "placeholders", newSVuv(st.hvs_placeholders));
+        (void)hv_stores(ret, "max_chain", newSVuv(st.hvs_max_chain));
+        (void)hv_stores(ret, "splits", newSVuv(st.hvs_splits));
+        (void)hv_stores(ret, "probes", newSVuv(st.hvs_probes));
+        /* the histogram up to the longest chain */
+        n = st.hvs_buckets
+            ? (st.hvs_max_chain < HV_STATS_CHAINS
+               ? st.hvs_max_chain + 1 : HV_STATS_CHAINS)
+            : 0;
+        for (i = 0; i < n; i++)
+            av_push(chains, newSVuv(st.hvs_chains[i]));
+        (void)hv_stores(ret, "chains", newRV_noinc((SV*)chains));
+        mXPUSHs(newRV_noinc((SV*)ret));
+        XSRETURN(1);
+    }
+    XSRETURN_UNDEF;
+
+
+void
+hsplit_stats(...)
+PPCODE:
+	const UV splits = PL_hv_splits;
+	const UV entries = PL_hv_split_entries;
+	if (items && SvTRUE(ST(0)))
+	    PL_hv_splits = PL_hv_split_entries = 0;
+	EXTEND(SP, 2);
+	mPUSHu(splits);
+	mPUSHu(entries);
+	XSRETURN(2);
@@ -28,7 +28,7 @@ our @EXPORT_OK  = qw(
                      lock_ref_keys_plus
                      hidden_ref_keys legal_ref_keys
 
-                     hash_seed hash_value hv_store
+                     hash_seed hash_value hash_function hv_store
                      bucket_stats bucket_stats_formatted bucket_info bucket_array
                      lock_hash_recurse unlock_hash_recurse
                      lock_hashref_recurse unlock_hashref_recurse
@@ -38,11 +38,15 @@ our @EXPORT_OK  = qw(
                      bucket_ratio
                      used_buckets
                      num_buckets
+                     open_addressing
+                     hash_shaped
+                     hash_stats
+                     hsplit_stats
                     );
 BEGIN {
     # make sure all our XS routines are available early so their prototypes
     # are correctly applied in the following code.
-    our $VERSION = '0.22';
+    our $VERSION = '0.25';
     our $XS_VERSION = $VERSION;
     $VERSION = eval $VERSION;
     require XSLoader;
@@ -528,6 +532,14 @@ see L<perlsec/"Algorithmic Complexity Attacks"> for more information.
 B<Do not disclose the hash value of a string> to people who don't need to
 know it. See also L<perlrun/PERL_HASH_SEED_DEBUG>.
 
+=item B<hash_function>
+
+    my $name = hash_function();
+
+Returns the name of the hash function perl uses, e.g. C<FNV1A>. With
+a perl configured with C<-Dhash_func=SELECT> it can be selected at
+startup, see L<perlrun/PERL_HASH_FUNC>.
+
 =item B<bucket_info>
 
 Return a set of basic information about a hash.
@@ -597,6 +609,39 @@ know it. See also L<perlrun/PERL_HASH_SEED_DEBUG>. This function is provided str
 for  debugging and diagnostics purposes only, it is hard to imagine a reason why it
 would be used in production code.
 
+=item B<hash_stats>
+
+    my $stats = hash_stats(\%hash);
+    my $strtab = hash_stats(undef);
+
+Returns a hash ref with the chain statistics of a hash, computed in C
+by C<hv_bucket_stats> in one pass over the buckets, so it is cheap
+enough to be used in a live process. With undef returns the statistics
+of the shared string table.
+
+    keys         => number of keys
+    buckets      => size of the bucket array, 0 for a shaped hash
+    used         => number of non-empty buckets
+    placeholders => deleted keys of a restricted hash
+    max_chain    => length of the longest chain
+    probes       => entries compared to look up every key once
+    splits       => how often the bucket array was doubled
+    chains       => [ number of buckets with 0, 1, ... keys ]
+
+C<probes / keys> is the average cost of a successful lookup, 1 is
+perfect. The last element of C<chains> also counts all chains longer
+than 15. Unlike bucket_info() it does not convert a shaped hash, see
+hash_shaped(). Returns undef for a tied hash.
+
+=item B<hsplit_stats>
+
+    my ($splits, $rehashed) = hsplit_stats();
+    hsplit_stats(1); # and reset
+
+Returns the number of times any hash in this interpreter grew or
+shrank its bucket array, and the number of entries rehashed by that.
+With a true argument resets both counters.
+
 =cut
 
 
@@ -773,6 +818,37 @@ This function returns the total number of buckets the hash holds, or would
 hold if the array were created. (When a hash is freshly created the array
 may not be allocated even though this value will be non-zero.)
 
+=item B<open_addressing>
+
+    my $was = open_addressing(%hash);
+    open_addressing(%hash, 1);
+
+Returns true if lookups in the hash use the additional open addressing
+index, similar to a Swiss table. With a second argument switches the
+index on or off, and returns the previous state. The index keeps the
+hash and the first bytes of every key in a flat array, so misses and
+lookups in big hashes touch less memory, while inserts and deletes get
+a bit slower. Iteration order and all other hash semantics stay the same.
+
+cperl only. Perl built with C<-DPERL_HV_OPENADDR> switches it on for all
+big hashes.
+
+=item B<hash_shaped>
+
+    my $is = hash_shaped(%$obj);
+    hash_shaped(%$obj, 1);
+
+Returns true if the hash uses the shared-key storage of a hidden class:
+the keys live in a layout shared by all objects of the class with the
+same keys, and the hash only keeps its values. With a true second
+argument tries to convert the hash, with a false one converts it back,
+and returns the new state. Only small hashes without magic, iterator or
+restricted keys can be shaped. Adding or deleting a key, C<each> and
+most introspection convert it back automatically, so this only changes
+the memory use and speed, not the semantics.
+
+cperl only. Perl built with C<-DPERL_HV_SHAPES> shapes hashes at C<bless>.
+
 =back
 
 =head2 Operating on references to hashes.
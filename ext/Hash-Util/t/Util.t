@@ -41,12 +41,16 @@ BEGIN {
                      lock_ref_keys_plus
                      hidden_ref_keys legal_ref_keys
 
-                     hash_seed hash_value bucket_stats bucket_info bucket_array
+                     hash_seed hash_value hash_function
+                     bucket_stats bucket_info bucket_array
                      hv_store
                      lock_hash_recurse unlock_hash_recurse
                      lock_hashref_recurse unlock_hashref_recurse
+                     open_addressing
+                     hash_shaped
+                     hash_stats hsplit_stats
                     );
-    plan tests => 244 + @Exported_Funcs;
+    plan tests => 272 + @Exported_Funcs;
     use_ok 'Hash::Util', @Exported_Funcs;
 }
 foreach my $func (@Exported_Funcs) {
@@ -598,6 +602,20 @@ ok(defined($hash_seed) && $hash_seed ne '', "hash_seed $hash_seed");
     is( $h1, hash_value("foo") );
     is( $h2, hash_value("bar") );
 }
+{
+    like( hash_function(), qr/^\w+$/, "hash_function" );
+    SKIP: {
+        require Config;
+        skip "no -Dhash_func=SELECT", 1
+            unless $Config::Config{hash_func} eq 'SELECT';
+        local $ENV{PERL_HASH_FUNC} = 'djb2';
+        local $ENV{PATH} = '/bin:/usr/bin';
+        local @ENV{qw(IFS CDPATH ENV BASH_ENV)};
+        my ($perl) = $^X =~ /^(.+)$/;   # untaint for -T
+        my $out = `"$perl" -I../../lib -MHash::Util=hash_function -e "print hash_function()"`;
+        is( $out, "DJB2", "PERL_HASH_FUNC selects the hash function" );
+    }
+}
 {
     my @info1= bucket_info({});
     my @info2= bucket_info({1..10});
@@ -614,3 +632,68 @@ ok(defined($hash_seed) && $hash_seed ne '', "hash_seed $hash_seed");
     is("@keys1","");
     is("@keys2","1 3 5 7 9");
 }
+{
+    my $s = hash_stats({});
+    is("@$s{qw(keys buckets used probes max_chain splits)} @{$s->{chains}}",
+       "0 8 0 0 0 0 8", "hash_stats: empty");
+    my %h = map { $_ => 1 } 1..200;
+    $s = hash_stats(\%h);
+    my ($keys, $buckets, $used, @len) = bucket_info(\%h);
+    is("@$s{qw(keys buckets used)}", "$keys $buckets $used",
+       "hash_stats: same as bucket_info");
+    is("@{$s->{chains}}", "@len", "hash_stats: chains");
+    is($s->{max_chain}, $#len, "hash_stats: max_chain");
+    my $probes = 0;
+    $probes += $len[$_] * $_ * ($_ + 1) / 2 for 1..$#len;
+    is($s->{probes}, $probes, "hash_stats: probes");
+    is(8 << $s->{splits}, $buckets, "hash_stats: splits");
+    my %r = (a => 1, b => 2, c => 3);
+    lock_keys(%r);
+    delete $r{a};
+    $s = hash_stats(\%r);
+    is("$s->{keys} $s->{placeholders}", "2 1", "hash_stats: placeholders");
+    ok(hash_stats(undef)->{keys} > 0, "hash_stats: strtab");
+
+    hsplit_stats(1);
+    my %g;
+    $g{$_} = 1 for 1..100;
+    my ($splits, $rehashed) = hsplit_stats(1);
+    ok($splits >= 4, "hsplit_stats: splits");
+    ok($rehashed > 0, "hsplit_stats: rehashed entries");
+    ($splits) = hsplit_stats();
+    is($splits, 0, "hsplit_stats: reset");
+}
+{
+    my %h = map { $_ => $_ * 2 } 1..200;
+    ok(!open_addressing(%h) || $Config::Config{ccflags} =~ /-DPERL_HV_OPENADDR/,
+       "open_addressing: off by default");
+    open_addressing(%h, 1);
+    ok(open_addressing(%h), "open_addressing: on");
+    is(scalar(grep { $h{$_} == $_ * 2 } 1..200), 200, "open_addressing: fetch");
+    ok(!exists $h{201}, "open_addressing: miss");
+    $h{$_} = 1 for 201..1000;
+    delete $h{$_} for 1..500;
+    is(scalar(keys %h), 500, "open_addressing: insert and delete");
+    is(scalar(grep { exists $h{$_} } 1..1000), 500, "open_addressing: exists");
+    my $n = 0;
+    while (my ($k, $v) = each %h) { $n++ }
+    is($n, 500, "open_addressing: each");
+    %h = ();
+    $h{"\x{100}"} = 1;
+    ok(exists $h{"\x{100}"} && !exists $h{"\x{101}"}, "open_addressing: utf8 after clear");
+    ok(open_addressing(%h, 0), "open_addressing: off returns previous state");
+}
+{
+    my $o = bless { a => 1, b => 2 }, "Hash::Util::ShapeTest";
+    my $p = bless { b => 3, a => 4 }, "Hash::Util::ShapeTest";
+    ok(hash_shaped(%$o, 1) && hash_shaped(%$p, 1), "hash_shaped: on");
+    is("$o->{a} $o->{b} $p->{a} $p->{b}", "1 2 4 3", "hash_shaped: fetch");
+    my @info = bucket_info($o);
+    ok(!hash_shaped(%$o) && $info[0] == 2 && $o->{b} == 2, "hash_shaped: bucket_info unshapes");
+    ok(!hash_shaped(%$p, 0) && !hash_shaped(%$p) && $p->{a} == 4, "hash_shaped: off");
+    lock_keys(%$p);
+    ok(!hash_shaped(%$p, 1), "hash_shaped: not restricted hashes");
+    my %big = map { $_ => 1 } 1..100;
+    ok(!hash_shaped(%big, 1), "hash_shaped: not big hashes");
+}
+
@@ -6,7 +6,7 @@ use strict;
 
 our($VERSION, $XS_VERSION, @ISA, @EXPORT_OK);
 
-$VERSION = "1.40_04c";
+$VERSION = "1.40_05c";
 $XS_VERSION = $VERSION;
 $VERSION =~ s/_//g; $VERSION =~ s/c$//;
 
@@ -347,6 +347,7 @@ invert_opset function.
     rv2cv anoncode prototype coreargs avhvswitch anonconst
 
     entersub leavesub leavesublv return method method_named
+    enterinline leaveinline
     method_super method_redir method_redir_super
      -- XXX loops via recursion?
 
@@ -437,8 +438,6 @@ These are a hotchpotch of opcodes still waiting to be considered
     break continue
     smartmatch
 
-    setstate keepstate -- inlined variants of nextstate
-
     custom -- where should this go
 
 =item :base_math
@@ -63,12 +63,17 @@ main_tests (\@keys, \@testkeys, ' [utf8 hash]');
     if (0) {
 	A::B->method();
     }
-    # DESTROY should be in there.
-    eval {
-	delete $strtab->{DESTROY};
-    };
-    $what = $prefix . 'delete';
-    like ($@, qr/^$what/, $what);
+    # DESTROY should be in there, unless the keys are in the
+    # process-global table
+    SKIP: {
+	skip "PERL_GLOBAL_STRTAB", 1
+	    if (Internals::V())[0] =~ /\bPERL_GLOBAL_STRTAB\b/;
+	eval {
+	    delete $strtab->{DESTROY};
+	};
+	$what = $prefix . 'delete';
+	like ($@, qr/^$what/, $what);
+    }
     # I can't work out how to get to the code that flips the wasutf8 flag on
     # the hash key without some ikcy XS
 }
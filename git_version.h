@@ -0,0 +1,8 @@
+/**************************************************************************
+* WARNING: 'git_version.h' is automatically generated by make_patchnum.pl
+*          DO NOT EDIT DIRECTLY - edit make_patchnum.pl instead
+***************************************************************************/
+#define PERL_PATCHNUM "4df4ae8"
+#define PERL_GIT_UNPUSHED_COMMITS		\
+    /*leave-this-comment*/
+#define PERL_GIT_UNCOMMITTED_CHANGES
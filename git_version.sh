@@ -0,0 +1,10 @@
+######################################################################
+# WARNING: 'git_version.sh' is generated by make_patchnum.pl
+#          DO NOT EDIT DIRECTLY - edit make_patchnum.pl instead
+######################################################################
+git_commit_id='4df4ae86708e981d7298b39c3de9a6f7b9b0e91d'
+git_describe='4df4ae8'
+git_branch='master'
+git_uncommitted_changes='256'
+git_commit_id_title='Derived from:'
+git_commit_date='2026-10-18 02:12:32 +0000'
@@ -57,6 +57,13 @@ holds the key and hash value.
 # endif
 #endif
 
+/* continue a pending incremental split, unless an iterator is active */
+#define HV_SPLIT_STEP(hv) STMT_START {					\
+    if (UNLIKELY(SvOOK(hv) && HvAUX(hv)->xhv_split_todo)		\
+        && HvAUX(hv)->xhv_riter == HV_NO_RITER && !HvAUX(hv)->xhv_eiter)	\
+        hsplit_step(hv, PERL_HV_INCR_SPLIT_STEP);			\
+    } STMT_END
+
 static const char S_strtab_error[]
     = "Cannot modify shared string table in hv_%s";
 
@@ -122,6 +129,94 @@ S_new_he(pTHX)
 
 #endif
 
+#ifdef PERL_HASH_FUNC_SELECT
+
+/* The hash functions compiled in with Configure -Dhash_func=SELECT.
+   The names are the ones of PERL_HASH_FUNC, the aliases the ones of
+   Configure. */
+static const struct {
+    const char *name;
+    const char *alias;
+    perl_hash_func_t func;
+    bool hw;			/* needs the CRC32-C instructions */
+} hash_funcs[] = {
+    { "FNV1A",			NULL,		S_perl_hash_fnv1a, 0 },
+    { "FNV1A_YoshimitsuTRIAD",	"FNV1A_YT",	S_perl_hash_fnv1a_yt, 0 },
+    { "SUPERFAST",		NULL,		S_perl_hash_superfast, 0 },
+    { "MURMUR3",		NULL,		S_perl_hash_murmur3, 0 },
+    { "DJB2",			NULL,		S_perl_hash_djb2, 0 },
+    { "SDBM",			NULL,		S_perl_hash_sdbm, 0 },
+    { "ONE_AT_A_TIME",		"OAAT",		S_perl_hash_one_at_a_time, 0 },
+    { "ONE_AT_A_TIME_HARD",	"OAAT_HARD",	S_perl_hash_one_at_a_time_hard, 0 },
+#ifdef PERL_HASH_HW_CRC32
+    { "CRC32",			NULL,		S_perl_hash_crc32, 1 },
+#endif
+#ifdef CAN64BITHASH
+    { "SIPHASH_2_4",		"SIPHASH",	S_perl_hash_siphash_2_4, 0 },
+    { "MURMUR_HASH_64A",	"MURMUR64A",	S_perl_hash_murmur_hash_64a, 0 },
+    { "MURMUR_HASH_64B",	"MURMUR64B",	S_perl_hash_murmur_hash_64b, 0 },
+#  ifdef PERL_CRC32C_U64
+    { "METRO64CRC",		NULL,		S_perl_hash_metro64crc, 1 },
+#  endif
+    { "METRO64",		NULL,		S_perl_hash_metro64, 0 },
+    { "SPOOKY32",		NULL,		S_perl_hash_spooky32, 0 },
+#endif
+    { NULL, NULL, NULL, 0 }
+};
+#define HASH_FUNC_NAME_EQ(a, b) \
+    (strlen(a) == strlen(b) && foldEQ((a), (b), (I32)strlen(a)))
+
+/*
+=for apidoc hash_func_select
+
+Selects the hash function with the given name, as in
+C<$ENV{PERL_HASH_FUNC}>, with Configure C<-Dhash_func=SELECT>.
+The name is case-insensitive, the Configure names are accepted too.
+With NULL, an unknown name or a CRC32 function on a CPU without the
+CRC32-C instructions the configured default is used.
+
+This must be called once before any hash is created, it is called by
+C<perl_construct> with the hash seed.
+
+=cut
+*/
+void
+Perl_hash_func_select(pTHX_ const char *name)
+{
+    int i, def = 0;
+
+    for (i = 0; hash_funcs[i].name; i++) {
+        if (strEQ(hash_funcs[i].name, PERL_HASH_FUNC))
+            def = i;
+    }
+    PL_hash_func      = hash_funcs[def].func;
+    PL_hash_func_name = hash_funcs[def].name;
+    if (!name || !*name)
+        return;
+    for (i = 0; hash_funcs[i].name; i++) {
+        if (HASH_FUNC_NAME_EQ(hash_funcs[i].name, name)
+            || (hash_funcs[i].alias
+                && HASH_FUNC_NAME_EQ(hash_funcs[i].alias, name)))
+        {
+#ifdef PERL_HASH_HW_CRC32
+            if (hash_funcs[i].hw && !PERL_HASH_HW_CRC32_OK) {
+                Perl_warn(aTHX_ "perl: warning: No CRC32 instructions for "
+                          "$ENV{PERL_HASH_FUNC} %s, using %s\n",
+                          hash_funcs[i].name, PL_hash_func_name);
+                return;
+            }
+#endif
+            PL_hash_func      = hash_funcs[i].func;
+            PL_hash_func_name = hash_funcs[i].name;
+            return;
+        }
+    }
+    Perl_warn(aTHX_ "perl: warning: Unknown hash function in "
+              "$ENV{PERL_HASH_FUNC} %s, using %s\n", name, PL_hash_func_name);
+}
+
+#endif /* PERL_HASH_FUNC_SELECT */
+
 STATIC HEK *
 S_save_hek_flags(const char *str, I32 len, U32 hash, int flags)
 {
@@ -171,6 +266,11 @@ Perl_hek_dup(pTHX_ HEK *source, CLONE_PARAMS* param)
 
     if (!source)
 	return NULL;
+#ifdef PERL_GLOBAL_STRTAB
+    /* all interpreters use the same shared keys */
+    if (!HEK_UNSHARED(source))
+	return share_hek_hek(source);
+#endif
 
     shared = (HEK*)ptr_table_fetch(PL_ptr_table, source);
     if (shared) {
@@ -214,6 +314,9 @@ Perl_he_dup(pTHX_ const HE *e, bool shared, CLONE_PARAMS* param)
 	/* This is hek_dup inlined, which seems to be important for speed
 	   reasons.  */
 	HEK * const source = HeKEY_hek(e);
+#ifdef PERL_GLOBAL_STRTAB
+	HEK *shared = share_hek_hek(source);
+#else
 	HEK *shared = (HEK*)ptr_table_fetch(PL_ptr_table, source);
 
 	if (shared) {
@@ -225,6 +328,7 @@ Perl_he_dup(pTHX_ const HE *e, bool shared, CLONE_PARAMS* param)
                                      HEK_HASH(source), HEK_FLAGS(source));
 	    ptr_table_store(PL_ptr_table, source, shared);
 	}
+#endif
 	HeKEY_hek(ret) = shared;
     }
     else
@@ -515,7 +619,10 @@ Perl_hv_common(pTHX_ HV *hv, SV *keysv, const char *key, I32 klen,
 
     if (UNLIKELY(SvMAGICAL(hv))) {
         int return_action = 0;
-        const void *retval = hv_common_magical(hv, &keysv, key, klen,
+        const void *retval;
+        if (UNLIKELY(HvSHAPED(hv)))
+            hv_unshape(hv);
+        retval = hv_common_magical(hv, &keysv, key, klen,
                                  flags, action, val, hash, &return_action);
         if (!return_action) {
             PERL_DTRACE_PROBE_HASH_RETURN(dtrace_mode, key);
@@ -611,13 +718,86 @@ Perl_hv_common(pTHX_ HV *hv, SV *keysv, const char *key, I32 klen,
 
     masked_flags = (flags & HVhek_MASK);
 
+    /* A shaped hash, see hv_shape. Fetches and stores of existing keys
+       via the SV** interface stay in the value vector, everything else
+       needs the HEs back. */
+    if (UNLIKELY(HvSHAPED(hv))) {
+        if (!SvREADONLY(hv)) {
+            const struct hv_shape * const shape = HvSHAPE(hv);
+            const I32 ix = hv_shape_index(shape, hash, key, klen,
+                                          masked_flags, keysv_hek);
+            if (ix < 0) {
+                if (!(action & (HV_FETCH_LVALUE|HV_FETCH_ISSTORE))) {
+                    if (flags & HVhek_FREEKEY)
+                        Safefree(key);
+                    PERL_DTRACE_PROBE_HASH_RETURN(dtrace_mode, key);
+                    return NULL;
+                }
+            }
+            else if ((action & (HV_FETCH_JUST_SV|HV_FETCH_ISEXISTS))
+                     && (!(action & (HV_FETCH_LVALUE|HV_FETCH_ISSTORE))
+                         || (HEK_FLAGS(shape->hs_heks[ix]) & HVhek_MASK)
+                            == masked_flags)) {
+                SV ** const svp = &HvSHAPED_VALS(hv)[ix];
+                if (action & HV_FETCH_ISSTORE) {
+                    if (!(action & HV_FETCH_NO_SV))
+                        SvREFCNT_dec(*svp);
+                    *svp = val;
+                }
+                DEBUG_H(PerlIO_printf(Perl_debug_log,
+                            "HASH shaped [%d] %s(0x%x)\t{%.*s}\n", (int)ix,
+                            action_name(action), action, (int)klen, key));
+                if (flags & HVhek_FREEKEY)
+                    Safefree(key);
+                PERL_DTRACE_PROBE_HASH_RETURN(dtrace_mode, key);
+                return (void *)svp;
+            }
+        }
+        hv_unshape(hv);
+    }
+    HV_SPLIT_STEP(hv);
+
+    /* A studied readonly hash: one probe and one key compare.
+       The key set is closed, so a miss is a miss. */
+    if (SvREADONLY(hv) && SvOOK(hv) && HvAUX(hv)->xhv_perfect) {
+        const struct xpvhv_perfect * const ph = HvAUX(hv)->xhv_perfect;
+        hindex = HvBUCKET_INDEX(hv, hash);
+        oentry = &(HvARRAY(hv)[ hindex ]);
+        entry = ph->xhvph_slots[ HvPERFECT_SLOT(ph, hash) ];
+        collisions = 0;
+        if (entry
+            && (HeKEY_hek(entry) == keysv_hek
+                || (HeHASH(entry) == hash
+                    && HeKLEN(entry) == klen
+                    && memEQ(HeKEY(entry), key, klen)
+                    && !((HeKFLAGS(entry) ^ masked_flags) & HVhek_UTF8)))) {
+            oentry = &entry; /* skip the move to the front of the chain */
+            goto found;
+        }
+        entry = NULL;
+        goto not_found;
+    }
+    /* The open addressing index, see hv_open_addressing */
+    if (SvOOK(hv) && HvAUX(hv)->xhv_oindex) {
+        hindex = HvBUCKET_INDEX(hv, hash);
+        collisions = 0;
+        entry = hv_oindex_find(HvAUX(hv)->xhv_oindex, hash, key, klen,
+                               masked_flags, keysv_hek);
+        if (entry) {
+            oentry = &entry; /* skip the move to the front of the chain */
+            goto found;
+        }
+        oentry = &(HvARRAY(hv)[ hindex ]);
+        goto not_found;
+    }
+
 #ifdef DYNAMIC_ENV_FETCH
     if (!HvARRAY(hv)) {
         entry = oentry = NULL;
     } else
 #endif
     {
-        hindex = HvHASH_INDEX(hash, HvMAX(hv));
+        hindex = HvBUCKET_INDEX(hv, hash);
 #ifdef PERL_PERTURB_KEYS_TOP
 	oentry = &(HvARRAY(hv)[ hindex ]);
         entry = *oentry;
@@ -875,7 +1055,7 @@ Perl_hv_common(pTHX_ HV *hv, SV *keysv, const char *key, I32 klen,
 #endif
 
 #ifndef PERL_PERTURB_KEYS_TOP
-    oentry = &HvARRAY(hv)[ HvHASH_INDEX(hash, xhv->xhv_max) ];
+    oentry = &HvARRAY(hv)[ HvBUCKET_INDEX(hv, hash) ];
 #endif
 
 #if INTSIZE > 4
@@ -908,6 +1088,10 @@ Perl_hv_common(pTHX_ HV *hv, SV *keysv, const char *key, I32 klen,
 #ifdef USE_SAFE_HASHITER
         HvAUX(hv)->xhv_timestamp++;
 #endif
+        if (UNLIKELY(HvAUX(hv)->xhv_perfect))
+            hv_perfect_free(hv);
+        if (HvAUX(hv)->xhv_aux_flags & HvAUXf_OPENADDR)
+            hv_oindex_insert(hv, entry);
     }
 #ifdef PERL_HASH_RANDOMIZE_KEYS
     /* This logic semi-randomizes the insert order in a bucket.
@@ -1315,6 +1499,27 @@ Perl_hv_pushkv(pTHX_ HV *hv, U32 flags)
     PERL_ARGS_ASSERT_HV_PUSHKV;
     assert(flags); /* must be pushing at least one of keys and values */
 
+    if (HvSHAPED(hv) && !SvRMAGICAL(hv)) {
+        /* no iterator, so it can stay shaped */
+        const struct hv_shape * const shape = HvSHAPE(hv);
+        SV * const * const vals = HvSHAPED_VALS(hv);
+        U32 i;
+
+        EXTEND_MORTAL(shape->hs_keys);
+        EXTEND(SP, shape->hs_keys * ((flags == 3) ? 2 : 1));
+        for (i = 0; i < shape->hs_keys; i++) {
+            if (flags & 1) {
+                SV *keysv = newSVhek(shape->hs_heks[i]);
+                SvTEMP_on(keysv);
+                PL_tmps_stack[++PL_tmps_ix] = keysv;
+                PUSHs(keysv);
+            }
+            if (flags & 2)
+                PUSHs(vals[i]);
+        }
+        PUTBACK;
+        return;
+    }
     (void)hv_iterinit(hv);
 
     if (tied) {
@@ -1443,6 +1648,8 @@ S_hv_delete_common(pTHX_ HV *hv, SV *keysv, const char *key, I32 klen,
     int collisions = -1;
 
     PERL_DTRACE_PROBE_HASH_ENTRY(PERL_DTRACE_HASH_MODE_DELETE, key);
+    if (UNLIKELY(HvSHAPED(hv)))
+        hv_unshape(hv);
     if (UNLIKELY(SvRMAGICAL(hv))) {
 	bool needs_copy;
 	bool needs_store;
@@ -1529,13 +1736,28 @@ S_hv_delete_common(pTHX_ HV *hv, SV *keysv, const char *key, I32 klen,
         PERL_HASH(hash, key, klen);
 
     masked_flags = (k_flags & HVhek_MASK);
+    HV_SPLIT_STEP(hv);
 
-    first_entry = oentry = &HvARRAY(hv)[ HvHASH_INDEX(hash, HvMAX(hv)) ];
+    first_entry = oentry = &HvARRAY(hv)[ HvBUCKET_INDEX(hv, hash) ];
     entry = *oentry;
 
     if (!entry)
         goto not_found;
 
+    /* Find the HE via the open addressing index, then its predecessor
+       in the chain by pointer compares only */
+    if (SvOOK(hv) && HvAUX(hv)->xhv_oindex) {
+        HE * const he = hv_oindex_find(HvAUX(hv)->xhv_oindex, hash, key, klen,
+                                       masked_flags, keysv_hek);
+        if (!he)
+            goto not_found;
+        while (entry != he) {
+            oentry = &HeNEXT(entry);
+            entry = *oentry;
+        }
+        goto found;
+    }
+
     if (keysv_hek) {
         /* keysv is actually a HEK in disguise, so we can match just by
          * comparing the HEK pointers in the HE chain. There is a slight
@@ -1717,6 +1939,10 @@ S_hv_delete_common(pTHX_ HV *hv, SV *keysv, const char *key, I32 klen,
 #ifdef USE_SAFE_HASHITER
                 aux->xhv_timestamp++;
 #endif
+                if (UNLIKELY(aux->xhv_perfect))
+                    hv_perfect_free(hv);
+                if (aux->xhv_oindex)
+                    hv_oindex_delete(aux->xhv_oindex, entry);
                 if (entry == aux->xhv_eiter)
                     HvLAZYDEL_on(hv);
                 else {
@@ -1808,11 +2034,91 @@ S_hsplit_move_aux(pTHX_ HV *hv, U32 const oldsize, U32 newsize)
 }
 
 
+/* Move the entries of bucket i, which do not belong there with newmax,
+   to their new bucket. */
+STATIC void
+S_hsplit_bucket(pTHX_ HE **aep, U32 i, U32 newmax)
+{
+    HE **oentry = aep + i;
+    HE *entry = aep[i];
+
+    PERL_ARGS_ASSERT_HSPLIT_BUCKET;
+
+    while (entry) {                         /* non-existent */
+        U32 j = (HeHASH(entry) & newmax);
+        PL_hv_split_entries++;
+#ifdef DEBUGGING
+        if (DEBUG_H_TEST_ && DEBUG_v_TEST_) {
+            PerlIO_printf(Perl_debug_log, "HASH split %u->%u\n",(unsigned)i,(unsigned)j);
+            deb_hechain(aep[i]);
+        }
+#endif
+        if (j != i) {
+            *oentry = HeNEXT(entry);
+#ifdef PERL_HASH_RANDOMIZE_KEYS
+            /* if the target cell is empty or PL_HASH_RAND_BITS_ENABLED is false
+             * insert to top, otherwise rotate the bucket rand 1 bit,
+             * and use the new low bit to decide if we insert at top,
+             * or next from top. IOW, we only rotate on a collision.*/
+            if (aep[j] && PL_HASH_RAND_BITS_ENABLED) {
+                PL_hash_rand_bits+= ROTL32(HeHASH(entry), 17);
+                PL_hash_rand_bits= ROTL_UV(PL_hash_rand_bits,1);
+                if (PL_hash_rand_bits & 1) {
+                    HeNEXT(entry)= HeNEXT(aep[j]);
+                    HeNEXT(aep[j])= entry;
+                } else {
+                    /* Note, this is structured in such a way as the optimizer
+                    * should eliminate the duplicated code here and below without
+                    * us needing to explicitly use a goto. */
+                    HeNEXT(entry) = aep[j];
+                    aep[j] = entry;
+                }
+            } else
+#endif
+            {
+                /* see comment above about duplicated code */
+                HeNEXT(entry) = aep[j];
+                aep[j] = entry;
+            }
+        }
+        else {
+            oentry = &HeNEXT(entry);
+        }
+#ifdef DEBUGGING
+        if (DEBUG_H_TEST_ && DEBUG_v_TEST_) {
+            if (*oentry)
+                deb_hechain(*oentry);
+            if (i!=j)
+                deb_hechain(aep[j]);
+        }
+#endif
+        entry = *oentry;
+    }
+}
+
+/* Split the next n buckets of a pending incremental split. */
+STATIC void
+S_hsplit_step(pTHX_ HV *hv, U32 n)
+{
+    struct xpvhv_aux * const aux = HvAUX(hv);
+    const U32 newmax = HvMAX(hv);
+    const U32 half = (newmax >> 1) + 1;
+
+    PERL_ARGS_ASSERT_HSPLIT_STEP;
+
+    if (n > aux->xhv_split_todo)
+        n = aux->xhv_split_todo;
+    for (; n; n--) {
+        hsplit_bucket(HvARRAY(hv), half - aux->xhv_split_todo, newmax);
+        aux->xhv_split_todo--;
+    }
+}
+
 STATIC void
 S_hsplit(pTHX_ HV *hv, U32 const oldsize, U32 newsize)
 {
     U32 i, newmax;
-    char *a = (char*) HvARRAY(hv);
+    char *a;
     HE **aep;
 
     bool do_aux= (
@@ -1821,11 +2127,18 @@ S_hsplit(pTHX_ HV *hv, U32 const oldsize, U32 newsize)
         /* no HvAUX() but array we are going to allocate is large enough
          * there is no point in saving the space for the iterator, and
          * speeds up later traversals. */
-        ( ( hv != PL_strtab ) && ( newsize >= PERL_HV_ALLOC_AUX_SIZE ) )
+        ( ( hv != PL_strtab ) && ( newsize >= PERL_HV_ALLOC_AUX_SIZE ) ) ||
+        /* and for the incremental split, also for PL_strtab */
+        ( PERL_HV_INCR_SPLIT_MIN && newsize >= PERL_HV_INCR_SPLIT_MIN
+          && newsize > oldsize )
     );
 
     PERL_ARGS_ASSERT_HSPLIT;
 
+    PL_hv_splits++;
+    if (SvOOK(hv) && HvAUX(hv)->xhv_split_todo) /* finish the pending one */
+        hsplit_step(hv, HvAUX(hv)->xhv_split_todo);
+    a = (char*) HvARRAY(hv);
     if (LIKELY(newsize > oldsize)) {
         PL_nomemok = TRUE;
         Renew(a, PERL_HV_ARRAY_ALLOC_BYTES(newsize)
@@ -1855,8 +2168,13 @@ S_hsplit(pTHX_ HV *hv, U32 const oldsize, U32 newsize)
         /* on grow before we zero the newly added memory, we
          * need to deal with the aux struct that may be there
          * or have been allocated by us */
-        if (do_aux) /* move to realloced right */
+        if (do_aux) { /* move to realloced right */
             hsplit_move_aux(hv, oldsize, newsize);
+#ifdef PERL_HV_OPENADDR
+            if (newsize >= PERL_HV_OINDEX_MIN && hv != PL_strtab)
+                HvAUX(hv)->xhv_aux_flags |= HvAUXf_OPENADDR;
+#endif
+        }
         /* now we can safely clear the second half */
         Zero(&a[oldsize * sizeof(HE*)], (newsize-oldsize) * sizeof(HE*), char);
     }
@@ -1864,61 +2182,19 @@ S_hsplit(pTHX_ HV *hv, U32 const oldsize, U32 newsize)
     if (!HvTOTALKEYS(hv))       /* skip rest if no entries */
         return;
 
-    aep = (HE**)a;
-    for (i=0; i < oldsize; i++) {
-	HE **oentry = aep + i;
-	HE *entry = aep[i];
-
-	while (entry) {				/* non-existent */
-            U32 j = (HeHASH(entry) & newmax);
-#ifdef DEBUGGING
-            if (DEBUG_H_TEST_ && DEBUG_v_TEST_) {
-                PerlIO_printf(Perl_debug_log, "HASH split %u->%u\n",(unsigned)i,(unsigned)j);
-                deb_hechain(aep[i]);
-            }
-#endif
-	    if (j != i) {
-		*oentry = HeNEXT(entry);
-#ifdef PERL_HASH_RANDOMIZE_KEYS
-                /* if the target cell is empty or PL_HASH_RAND_BITS_ENABLED is false
-                 * insert to top, otherwise rotate the bucket rand 1 bit,
-                 * and use the new low bit to decide if we insert at top,
-                 * or next from top. IOW, we only rotate on a collision.*/
-                if (aep[j] && PL_HASH_RAND_BITS_ENABLED) {
-                    PL_hash_rand_bits+= ROTL32(HeHASH(entry), 17);
-                    PL_hash_rand_bits= ROTL_UV(PL_hash_rand_bits,1);
-                    if (PL_hash_rand_bits & 1) {
-                        HeNEXT(entry)= HeNEXT(aep[j]);
-                        HeNEXT(aep[j])= entry;
-                    } else {
-                        /* Note, this is structured in such a way as the optimizer
-                        * should eliminate the duplicated code here and below without
-                        * us needing to explicitly use a goto. */
-                        HeNEXT(entry) = aep[j];
-                        aep[j] = entry;
-                    }
-                } else
-#endif
-                {
-                    /* see comment above about duplicated code */
-                    HeNEXT(entry) = aep[j];
-                    aep[j] = entry;
-                }
-	    }
-	    else {
-		oentry = &HeNEXT(entry);
-	    }
-#ifdef DEBUGGING
-            if (DEBUG_H_TEST_ && DEBUG_v_TEST_) {
-                if (*oentry)
-                    deb_hechain(*oentry);
-                if (i!=j)
-                    deb_hechain(aep[j]);
-            }
-#endif
-	    entry = *oentry;
-	}
+    if (PERL_HV_INCR_SPLIT_MIN && newsize >= PERL_HV_INCR_SPLIT_MIN
+        && newsize == oldsize * 2 && do_aux) {
+        /* move the entries later, a few buckets per access */
+        HvAUX(hv)->xhv_split_todo = oldsize;
+        DEBUG_H(PerlIO_printf(Perl_debug_log, "HASH split incr %u\t%6u\t%s\n",
+                              (unsigned)HvTOTALKEYS(hv), (unsigned)newmax,
+                              HvNAME_get(hv)?HvNAME_get(hv):""));
+        return;
     }
+
+    aep = (HE**)a;
+    for (i=0; i < oldsize; i++)
+        hsplit_bucket(aep, i, newmax);
     if (UNLIKELY(newsize < oldsize)) { /* shrinked */
         if (do_aux) /* move to left */
             hsplit_move_aux(hv, oldsize, newsize);
@@ -1929,12 +2205,136 @@ S_hsplit(pTHX_ HV *hv, U32 const oldsize, U32 newsize)
     }
 }
 
+/* Max. number of displacements tried per group, before giving up */
+#ifndef HV_PERFECT_MAXTRIES
+# define HV_PERFECT_MAXTRIES 4096
+#endif
+
+/* Build a perfect hash index (CHD, "hash and displace") over all HEs
+   of hv, including placeholders. The keys are grouped by the low bits
+   of their hash, the biggest groups placed first, and for every group
+   a displacement is searched which moves all its keys into free slots.
+   Returns NULL if no index could be found, e.g. with full 32bit hash
+   collisions. */
+STATIC struct xpvhv_perfect*
+S_hv_perfect_build(pTHX_ HV *hv)
+{
+    struct xpvhv_perfect *ph;
+    const U32 keys = HvTOTALKEYS(hv);
+    U32 size, dsize, bits, i, g, n, maxgroup;
+    U32 *counts, *starts;
+    HE **ents;
+
+    PERL_ARGS_ASSERT_HV_PERFECT_BUILD;
+
+    if (!keys || !HvARRAY(hv) || keys > (U32_MAX >> 3))
+        return NULL;
+    /* load factor 0.8 max, min. 2 slots */
+    size = keys < 2 ? 2 : S_ceil_to_power2(keys + (keys >> 2));
+    dsize = keys < 4 ? 1 : S_ceil_to_power2(keys >> 1);
+    bits = CTZ(size);
+
+    Newxc(ph, STRUCT_OFFSET(struct xpvhv_perfect, xhvph_slots)
+              + size * sizeof(HE*) + dsize * sizeof(U32), char,
+          struct xpvhv_perfect);
+    Zero(ph, STRUCT_OFFSET(struct xpvhv_perfect, xhvph_slots)
+              + size * sizeof(HE*) + dsize * sizeof(U32), char);
+    ph->xhvph_shift = 32 - bits;
+    ph->xhvph_dmax  = dsize - 1;
+    ph->xhvph_disp  = (U32*)&ph->xhvph_slots[size];
+
+    /* bucket sort the entries by group */
+    Newxz(counts, dsize + 1, U32);
+    Newx(starts, dsize + 1, U32);
+    Newx(ents, keys, HE*);
+    for (i = 0; i <= HvMAX(hv); i++) {
+        HE *entry = HvARRAY(hv)[i];
+        for (; entry; entry = HeNEXT(entry))
+            counts[HeHASH(entry) & (dsize - 1)]++;
+    }
+    maxgroup = 0;
+    for (g = 0, n = 0; g < dsize; g++) {
+        starts[g] = n;
+        n += counts[g];
+        if (counts[g] > maxgroup)
+            maxgroup = counts[g];
+    }
+    starts[dsize] = n;
+    assert(n == keys);
+    Zero(counts, dsize, U32);
+    for (i = 0; i <= HvMAX(hv); i++) {
+        HE *entry = HvARRAY(hv)[i];
+        for (; entry; entry = HeNEXT(entry)) {
+            g = HeHASH(entry) & (dsize - 1);
+            ents[starts[g] + counts[g]++] = entry;
+        }
+    }
+
+    /* place the groups, biggest first */
+    for (n = maxgroup; n > 0; n--) {
+        for (g = 0; g < dsize; g++) {
+            HE ** const grp = &ents[starts[g]];
+            U32 d;
+            if (counts[g] != n)
+                continue;
+            for (d = 0; d < HV_PERFECT_MAXTRIES; d++) {
+                U32 j, k;
+                ph->xhvph_disp[g] = d;
+                for (j = 0; j < n; j++) {
+                    const U32 s = HvPERFECT_SLOT(ph, HeHASH(grp[j]));
+                    if (ph->xhvph_slots[s])
+                        break;
+                    for (k = 0; k < j; k++)
+                        if (HvPERFECT_SLOT(ph, HeHASH(grp[k])) == s)
+                            break;
+                    if (k < j)
+                        break;
+                }
+                if (j == n)
+                    break;
+            }
+            if (d == HV_PERFECT_MAXTRIES) {
+                DEBUG_H(PerlIO_printf(Perl_debug_log,
+                          "HASH study perfect failed at group %u of %u\t%s\n",
+                          (unsigned)g, (unsigned)dsize,
+                          HvNAME_get(hv)?HvNAME_get(hv):""));
+                Safefree(ph);
+                ph = NULL;
+                goto done;
+            }
+            for (i = 0; i < n; i++)
+                ph->xhvph_slots[ HvPERFECT_SLOT(ph, HeHASH(grp[i])) ] = grp[i];
+        }
+    }
+  done:
+    Safefree(counts);
+    Safefree(starts);
+    Safefree(ents);
+    return ph;
+}
+
+/* Drop the perfect hash index. Needed before the HEs of hv change. */
+STATIC void
+S_hv_perfect_free(pTHX_ HV *hv)
+{
+    PERL_ARGS_ASSERT_HV_PERFECT_FREE;
+    if (SvOOK(hv) && HvAUX(hv)->xhv_perfect) {
+        DEBUG_H(PerlIO_printf(Perl_debug_log, "HASH perfect free\t%s\n",
+                              HvNAME_get(hv)?HvNAME_get(hv):""));
+        Safefree(HvAUX(hv)->xhv_perfect);
+        HvAUX(hv)->xhv_perfect = NULL;
+    }
+}
+
 /*
 =for apidoc hv_study
 
 Optimizes the internal structure of a hash.
-Clears placeholders, shrinks it, and later for a readonly hash possibly
-re-arrange to a perfect hash.
+Clears placeholders and shrinks it. For a readonly hash, such as a
+restricted hash, a C<:const> hash or a closed class stash, it also
+adds a perfect hash index, so that every lookup needs only one probe
+and one key comparison. The index is dropped again when a key is added
+or freed.
 
 =cut
 */
@@ -1944,6 +2344,9 @@ Perl_hv_study(pTHX_ HV *hv)
     U32 oldsize, oldkeys, deleted;
     PERL_ARGS_ASSERT_HV_STUDY;
 
+    if (HvSHAPED(hv))
+        hv_unshape(hv);
+
     oldsize = HvMAX(hv) + 1;
     oldkeys = HvTOTALKEYS(hv);
     deleted = HvPLACEHOLDERS_get(hv);
@@ -1976,19 +2379,485 @@ Perl_hv_study(pTHX_ HV *hv)
                           0,
                           HvNAME_get(hv)?HvNAME_get(hv):""));
     }
-    /* for a readonly hash possibly re-arrange to perfect hash */
+    if (SvREADONLY(hv) && HvTOTALKEYS(hv)
+        && !(SvRMAGICAL(hv) && mg_find((const SV *)hv, PERL_MAGIC_tied))) {
+        struct xpvhv_perfect *ph;
+        hv_perfect_free(hv);
+        ph = hv_perfect_build(hv);
+        if (ph) {
+            if (!SvOOK(hv))
+                hv_auxinit(hv);
+            HvAUX(hv)->xhv_perfect = ph;
+            DEBUG_H(PerlIO_printf(Perl_debug_log,
+                          "HASH study perfect %u\t%6u\t%6u\t\t%s\n",
+                          (unsigned)HvTOTALKEYS(hv),
+                          (unsigned)(U32_MAX >> ph->xhvph_shift),
+                          (unsigned)ph->xhvph_dmax,
+                          HvNAME_get(hv)?HvNAME_get(hv):""));
+        }
+    }
+}
+
+/* Group probing of the oindex ctrl bytes. HvOINDEX_GROUP sets bit k of
+   match for every byte p[k] equal to tag, and bit k of empty for every
+   HVo_EMPTY byte, for 0 <= k < HVo_GROUP. With SWAR a byte above a real
+   match may match falsely, but only a full slot, so the hash compare
+   catches it. */
+#if HVo_GROUP == 16
+#  include <emmintrin.h>
+#  define HvOINDEX_GROUP(p, tag, match, empty) STMT_START {		\
+        const __m128i g_ = _mm_loadu_si128((const __m128i*)(p));	\
+        match = (U32)_mm_movemask_epi8(					\
+                    _mm_cmpeq_epi8(g_, _mm_set1_epi8((char)(tag))));	\
+        empty = (U32)_mm_movemask_epi8(					\
+                    _mm_cmpeq_epi8(g_, _mm_set1_epi8((char)HVo_EMPTY))); \
+    } STMT_END
+#elif defined(HAS_QUAD) && (BYTEORDER == 0x1234 || BYTEORDER == 0x12345678)
+#  define HVo_LSB	UINT64_C(0x0101010101010101)
+#  define HVo_MSB	UINT64_C(0x8080808080808080)
+/* the high bit of each byte into the low 8 bits */
+#  define HVo_GATHER(x)	(U32)((((x) >> 7) * UINT64_C(0x0102040810204080)) >> 56)
+#  define HvOINDEX_GROUP(p, tag, match, empty) STMT_START {		\
+        U64 g_, x_;							\
+        Copy((p), &g_, 1, U64);						\
+        x_ = g_ ^ (HVo_LSB * (tag));					\
+        match = HVo_GATHER((x_ - HVo_LSB) & ~x_ & HVo_MSB);		\
+        empty = HVo_GATHER(g_ & ~(g_ << 6) & HVo_MSB);			\
+    } STMT_END
+#else
+#  define HvOINDEX_GROUP(p, tag, match, empty) STMT_START {		\
+        int k_;								\
+        match = empty = 0;						\
+        for (k_ = 0; k_ < HVo_GROUP; k_++) {				\
+            if ((p)[k_] == (tag))					\
+                match |= 1U << k_;					\
+            else if ((p)[k_] == HVo_EMPTY)				\
+                empty |= 1U << k_;					\
+        }								\
+    } STMT_END
+#endif
+
+/* The first 4 bytes of the key, 0 padded. Kept in the slot so that
+   most mismatches are caught without touching the HEK. */
+PERL_STATIC_INLINE U32
+S_hv_oindex_prefix(const char *key, I32 klen)
+{
+    U32 prefix = 0;
+    PERL_ARGS_ASSERT_HV_OINDEX_PREFIX;
+    Copy(key, &prefix, klen < 4 ? klen : 4, char);
+    return prefix;
+}
+
+/* (Re)build the open addressing index over all HEs of hv, with room
+   for at least keys entries. Requires the aux struct. */
+STATIC void
+S_hv_oindex_build(pTHX_ HV *hv, U32 keys)
+{
+    struct xpvhv_oindex *ox;
+    U32 size, i;
+    HE **array = HvARRAY(hv);
+
+    PERL_ARGS_ASSERT_HV_OINDEX_BUILD;
+    assert(SvOOK(hv));
+
+    /* at most half full after the build */
+    size = keys < 8 ? 16 : S_ceil_to_power2(keys) << 1;
+    hv_oindex_free(hv);
+    Newxc(ox, STRUCT_OFFSET(struct xpvhv_oindex, xhvo_slots)
+              + size * (sizeof(struct hv_oslot) + 1) + HVo_GROUP, char,
+          struct xpvhv_oindex);
+    ox->xhvo_max = size - 1;
+    ox->xhvo_used = 0;
+    ox->xhvo_ctrl = (U8*)&ox->xhvo_slots[size];
+    memset(ox->xhvo_ctrl, HVo_EMPTY, size + HVo_GROUP);
+    HvAUX(hv)->xhv_oindex = ox;
+
+    for (i = 0; i <= HvMAX(hv); i++) {
+        HE *entry;
+        for (entry = array[i]; entry; entry = HeNEXT(entry)) {
+            U32 j = HeHASH(entry) & ox->xhvo_max;
+            while (!(ox->xhvo_ctrl[j] & HVo_EMPTY))
+                j = (j + 1) & ox->xhvo_max;
+            HvOINDEX_SETCTRL(ox, j, HvOINDEX_TAG(HeHASH(entry)));
+            ox->xhvo_slots[j].hos_hash = HeHASH(entry);
+            ox->xhvo_slots[j].hos_prefix =
+                hv_oindex_prefix(HeKEY(entry), HeKLEN(entry));
+            ox->xhvo_slots[j].hos_he = entry;
+            ox->xhvo_used++;
+        }
+    }
+    DEBUG_H(PerlIO_printf(Perl_debug_log, "HASH oindex build %u\t%6u\t%s\n",
+                          (unsigned)ox->xhvo_used, (unsigned)ox->xhvo_max,
+                          HvNAME_get(hv)?HvNAME_get(hv):""));
+}
+
+/* Add a new HE, which is not yet linked into the HvARRAY chains.
+   Builds the index if missing, and rebuilds it bigger when full,
+   which also drops the deleted slots. */
+STATIC void
+S_hv_oindex_insert(pTHX_ HV *hv, HE *entry)
+{
+    struct xpvhv_oindex *ox = HvAUX(hv)->xhv_oindex;
+    const U32 hash = HeHASH(entry);
+    U32 j;
+
+    PERL_ARGS_ASSERT_HV_OINDEX_INSERT;
+
+    if (!ox || HvOINDEX_FULL(ox)) {
+        hv_oindex_build(hv, HvTOTALKEYS(hv) + 1);
+        ox = HvAUX(hv)->xhv_oindex;
+    }
+    j = hash & ox->xhvo_max;
+    while (!(ox->xhvo_ctrl[j] & HVo_EMPTY))
+        j = (j + 1) & ox->xhvo_max;
+    if (ox->xhvo_ctrl[j] == HVo_EMPTY) /* reused deleted slots count already */
+        ox->xhvo_used++;
+    HvOINDEX_SETCTRL(ox, j, HvOINDEX_TAG(hash));
+    ox->xhvo_slots[j].hos_hash = hash;
+    ox->xhvo_slots[j].hos_prefix = hv_oindex_prefix(HeKEY(entry), HeKLEN(entry));
+    ox->xhvo_slots[j].hos_he = entry;
+}
+
+/* Remove the HE from the index, before it is unlinked from its chain. */
+STATIC void
+S_hv_oindex_delete(struct xpvhv_oindex *ox, HE *entry)
+{
+    U32 j = HeHASH(entry) & ox->xhvo_max;
+
+    PERL_ARGS_ASSERT_HV_OINDEX_DELETE;
+
+    while (ox->xhvo_ctrl[j] != HVo_EMPTY) {
+        if (ox->xhvo_slots[j].hos_he == entry) {
+            /* only a slot ending a probe sequence may become empty */
+            if (ox->xhvo_ctrl[(j + 1) & ox->xhvo_max] == HVo_EMPTY) {
+                HvOINDEX_SETCTRL(ox, j, HVo_EMPTY);
+                ox->xhvo_used--;
+            }
+            else
+                HvOINDEX_SETCTRL(ox, j, HVo_DELETED);
+            ox->xhvo_slots[j].hos_he = NULL;
+            return;
+        }
+        j = (j + 1) & ox->xhvo_max;
+    }
+    assert(!"HE not in oindex");
+}
+
+/* Probe the index, a group of HVo_GROUP tags at once. Compares the tag,
+   the full hash and the key prefix inline, and only follows the HE
+   pointer to compare the whole key. */
+STATIC HE*
+S_hv_oindex_find(const struct xpvhv_oindex *ox, U32 hash, const char *key,
+                 I32 klen, int flags, const HEK *keysv_hek)
+{
+    const U8 tag = HvOINDEX_TAG(hash);
+    const U32 prefix = hv_oindex_prefix(key, klen);
+    U32 j = hash & ox->xhvo_max;
+
+    PERL_ARGS_ASSERT_HV_OINDEX_FIND;
+
+    for (;;) {
+        U32 match, empty;
+        HvOINDEX_GROUP(ox->xhvo_ctrl + j, tag, match, empty);
+        if (empty) /* the probe sequence ends at the first empty slot */
+            match &= (empty & (0U - empty)) - 1;
+        while (match) {
+            const struct hv_oslot * const slot =
+                &ox->xhvo_slots[(j + CTZ(match)) & ox->xhvo_max];
+            if (slot->hos_hash == hash && slot->hos_prefix == prefix) {
+                HE * const entry = slot->hos_he;
+                if (HeKEY_hek(entry) == keysv_hek
+                    || (HeKLEN(entry) == klen
+                        && memEQ(HeKEY(entry), key, klen)
+                        && !((HeKFLAGS(entry) ^ flags) & HVhek_UTF8)))
+                    return entry;
+            }
+            match &= match - 1;
+        }
+        if (empty)
+            return NULL;
+        j = (j + HVo_GROUP) & ox->xhvo_max;
+    }
+}
+
+/* Drop the open addressing index, but keep the HvAUXf_OPENADDR flag. */
+STATIC void
+S_hv_oindex_free(pTHX_ HV *hv)
+{
+    PERL_ARGS_ASSERT_HV_OINDEX_FREE;
+    if (SvOOK(hv) && HvAUX(hv)->xhv_oindex) {
+        DEBUG_H(PerlIO_printf(Perl_debug_log, "HASH oindex free\t%s\n",
+                              HvNAME_get(hv)?HvNAME_get(hv):""));
+        Safefree(HvAUX(hv)->xhv_oindex);
+        HvAUX(hv)->xhv_oindex = NULL;
+    }
+}
+
+/*
+=for apidoc hv_open_addressing
+
+Switches the lookup of a hash to an additional open addressing index,
+which keeps the full hash and a prefix of every key inline in a flat
+array, similar to a Swiss table. Lookups of missing keys and of big
+hashes with long collision chains need fewer cache misses, at the cost
+of 9 bytes per slot and a bit slower inserts and deletes.
+The HEs stay in the buckets, so iteration, C<each> and C<delete> work
+as before. With C<on> false the index is freed. Returns the previous
+state. C<PL_strtab> is never switched.
+
+=cut
+*/
+bool
+Perl_hv_open_addressing(pTHX_ HV *hv, bool on)
+{
+    const bool was = cBOOL(HvOPENADDR(hv));
+    PERL_ARGS_ASSERT_HV_OPEN_ADDRESSING;
+
+    if (on && !was) {
+        if (hv == PL_strtab)
+            return FALSE;
+        if (!SvOOK(hv))
+            hv_auxinit(hv);
+        HvAUX(hv)->xhv_aux_flags |= HvAUXf_OPENADDR;
+        if (HvTOTALKEYS(hv))
+            hv_oindex_build(hv, HvTOTALKEYS(hv));
+    }
+    else if (!on && was) {
+        hv_oindex_free(hv);
+        HvAUX(hv)->xhv_aux_flags &= ~HvAUXf_OPENADDR;
+    }
+    return was;
+}
+
+/* The value index of a key in a shape, or -1 */
+STATIC I32
+S_hv_shape_index(const struct hv_shape *shape, U32 hash, const char *key,
+                 I32 klen, int flags, const HEK *keysv_hek)
+{
+    HEK * const * const heks = shape->hs_heks;
+    const U32 n = shape->hs_keys;
+    U32 i;
+    PERL_ARGS_ASSERT_HV_SHAPE_INDEX;
+
+    if (keysv_hek) {
+        for (i = 0; i < n; i++)
+            if (heks[i] == keysv_hek)
+                return (I32)i;
+    }
+    /* the other HEK of a key with both plain and utf8 representations */
+    for (i = 0; i < n; i++) {
+        const HEK * const hek = heks[i];
+        if (HEK_HASH(hek) == hash
+            && HEK_LEN(hek) == klen
+            && memEQ(HEK_KEY(hek), key, klen)
+            && !((HEK_FLAGS(hek) ^ flags) & HVhek_UTF8))
+            return (I32)i;
+    }
+    return -1;
+}
+
+STATIC void
+S_hv_shape_dec(pTHX_ struct hv_shape *shape)
+{
+    PERL_ARGS_ASSERT_HV_SHAPE_DEC;
+    assert(shape->hs_refcnt);
+    if (!--shape->hs_refcnt) {
+        U32 i;
+        for (i = 0; i < shape->hs_keys; i++)
+            unshare_hek(shape->hs_heks[i]);
+        Safefree(shape);
+    }
+}
+
+/* Drop the value vector and the shape of a shaped hash without values */
+STATIC void
+S_hv_shape_free(pTHX_ HV *hv)
+{
+    struct xpvhv_shaped * const body = HvSHAPED_BODY(hv);
+    PERL_ARGS_ASSERT_HV_SHAPE_FREE;
+    assert(HvSHAPED(hv));
+    assert(!HvTOTALKEYS(hv));
+
+    HvSHAPED_off(hv);
+    HvARRAY(hv) = NULL;
+    hv_shape_dec(body->xhvs_shape);
+    Safefree(body);
+}
+
+/*
+=for apidoc hv_shape
+
+Converts a small hash to the shared-key storage of a hidden class: the
+keys move to a key layout descriptor, which is shared by all objects of
+the same class with the same keys, and the hash keeps only the vector
+of its values. Fetches and stores of existing keys stay in the vector,
+any other access, like a new key, C<delete>, C<each>, C<keys> or magic,
+converts it back to a normal hash with L</hv_unshape>.
+
+Only hashes with shared keys and up to C<PERL_HV_SHAPE_MAX> keys, no
+magic, no iterator and no other auxiliary data can be shaped. Returns
+true if the hash is shaped.
+
+With C<-DPERL_HV_SHAPES> C<bless> shapes all such hashes.
+
+=cut
+*/
+bool
+Perl_hv_shape(pTHX_ HV *hv)
+{
+    HEK *heks[PERL_HV_SHAPE_MAX];
+    SV *vals[PERL_HV_SHAPE_MAX];
+    struct hv_shape *shape = NULL;
+    struct xpvhv_shaped *body;
+    HV * const stash = SvOBJECT(hv) ? SvSTASH(hv) : NULL;
+    HE ** const array = HvARRAY(hv);
+    const U32 keys = HvTOTALKEYS(hv);
+    U32 i, n = 0, nshapes = 0;
+    PERL_ARGS_ASSERT_HV_SHAPE;
+
+    if (HvSHAPED(hv))
+        return TRUE;
+    if (!keys || keys > PERL_HV_SHAPE_MAX || !array || !HvSHAREKEYS(hv)
+        || SvMAGICAL(hv) || SvMAGIC(hv) || SvREADONLY(hv) || hv == PL_strtab)
+        return FALSE;
+    if (SvOOK(hv)) {
+        const struct xpvhv_aux * const aux = HvAUX(hv);
+        if (aux->xhv_name_u.xhvnameu_name || aux->xhv_backreferences
+            || aux->xhv_eiter || aux->xhv_riter != HV_NO_RITER
+            || aux->xhv_mro_meta || aux->xhv_aux_flags || aux->xhv_split_todo
+            || aux->xhv_aux_fields || aux->xhv_perfect || aux->xhv_oindex
+            || aux->xhv_shapes)
+            return FALSE;
+    }
+
+    /* sort by HEK address, so the key order does not matter */
+    for (i = 0; i <= HvMAX(hv); i++) {
+        const HE *entry;
+        for (entry = array[i]; entry; entry = HeNEXT(entry)) {
+            HEK * const hek = HeKEY_hek(entry);
+            U32 j = n++;
+            while (j && PTR2UV(heks[j-1]) > PTR2UV(hek)) {
+                heks[j] = heks[j-1];
+                vals[j] = vals[j-1];
+                j--;
+            }
+            heks[j] = hek;
+            vals[j] = HeVAL(entry);
+        }
+    }
+    assert(n == keys);
+
+    if (stash && SvOOK(stash)) {
+        for (shape = HvAUX(stash)->xhv_shapes; shape; shape = shape->hs_next) {
+            if (shape->hs_keys == n
+                && memEQ(shape->hs_heks, heks, n * sizeof(HEK*)))
+                break;
+            nshapes++;
+        }
+    }
+    if (!shape) {
+        Newxc(shape, STRUCT_OFFSET(struct hv_shape, hs_heks) + n * sizeof(HEK*),
+              char, struct hv_shape);
+        shape->hs_refcnt = 0;
+        shape->hs_keys = n;
+        shape->hs_next = NULL;
+        for (i = 0; i < n; i++)
+            shape->hs_heks[i] = share_hek_hek(heks[i]);
+        /* classes with too many key sets get private shapes */
+        if (stash && SvOOK(stash) && nshapes < PERL_HV_SHAPE_MAX) {
+            shape->hs_next = HvAUX(stash)->xhv_shapes;
+            HvAUX(stash)->xhv_shapes = shape;
+            shape->hs_refcnt++;
+        }
+        DEBUG_H(PerlIO_printf(Perl_debug_log, "HASH shape new\t%u keys\t%s\n",
+                              (unsigned)n, stash && HvNAME_get(stash)
+                              ? HvNAME_get(stash) : ""));
+    }
+    shape->hs_refcnt++;
+
+    Newxc(body, STRUCT_OFFSET(struct xpvhv_shaped, xhvs_vals) + n * sizeof(SV*),
+          char, struct xpvhv_shaped);
+    body->xhvs_shape = shape;
+    for (i = 0; i < n; i++)
+        body->xhvs_vals[i] = vals[i];
+
+    /* the values moved, free the HEs */
+    for (i = 0; i <= HvMAX(hv); i++) {
+        HE *entry = array[i];
+        while (entry) {
+            HE * const next = HeNEXT(entry);
+            unshare_hek(HeKEY_hek(entry));
+            del_HE(entry);
+            entry = next;
+        }
+    }
+    Safefree(array);
+    SvFLAGS(hv) &= ~SVf_OOK;
+    HvARRAY(hv) = (HE**)body;
+    HvSHAPED_on(hv);
+    return TRUE;
+}
+
+/*
+=for apidoc hv_unshape
+
+Converts a shaped hash back to a normal hash with buckets of HEs.
+Does nothing with other hashes. See L</hv_shape>.
+
+=cut
+*/
+void
+Perl_hv_unshape(pTHX_ HV *hv)
+{
+    struct xpvhv_shaped *body;
+    struct hv_shape *shape;
+    HE **array;
+    char *a;
+    U32 max = PERL_HASH_DEFAULT_HvMAX;
+    U32 i;
+    PERL_ARGS_ASSERT_HV_UNSHAPE;
+
+    if (!HvSHAPED(hv))
+        return;
+    body = HvSHAPED_BODY(hv);
+    shape = body->xhvs_shape;
+    assert(shape->hs_keys == HvTOTALKEYS(hv));
+    while (max + 1 < shape->hs_keys)
+        max = max * 2 + 1;
+    DEBUG_H(PerlIO_printf(Perl_debug_log, "HASH unshape\t%u keys\n",
+                          (unsigned)shape->hs_keys));
+
+    Newxz(a, PERL_HV_ARRAY_ALLOC_BYTES(max + 1), char);
+    array = (HE**)a;
+    for (i = 0; i < shape->hs_keys; i++) {
+        HEK * const hek = shape->hs_heks[i];
+        HE ** const bucket = &array[ HvHASH_INDEX(HEK_HASH(hek), max) ];
+        HE * const entry = new_HE();
+        HeKEY_hek(entry) = share_hek_hek(hek);
+        HeVAL(entry) = body->xhvs_vals[i];
+        HeNEXT(entry) = *bucket;
+        *bucket = entry;
+    }
+    HvSHAPED_off(hv);
+    HvARRAY(hv) = array;
+    HvMAX(hv) = max;
+    hv_shape_dec(shape);
+    Safefree(body);
 }
 
 void
 Perl_hv_ksplit(pTHX_ HV *hv, U32 newmax)
 {
     XPVHV* xhv = (XPVHV*)SvANY(hv);
-    const U32 oldsize = xhv->xhv_max + 1;
+    U32 oldsize;
     U32 newsize;
     char *a;
 
     PERL_ARGS_ASSERT_HV_KSPLIT;
 
+    if (HvSHAPED(hv))
+        hv_unshape(hv);
+    oldsize = xhv->xhv_max + 1;
     newsize = newmax;
     if (newmax <= oldsize)
 	return;
@@ -2011,6 +2880,201 @@ Perl_hv_ksplit(pTHX_ HV *hv, U32 newmax)
     }
 }
 
+/* keys hashed at once by hv_store_list, before they are inserted */
+#ifndef HV_STORE_LIST_CHUNK
+#  define HV_STORE_LIST_CHUNK 32
+#endif
+
+/*
+=for apidoc hv_store_list
+
+Stores C<npairs> key/value pairs from C<kv> into C<hv>, the keys at the
+even and the values at the odd positions, as with C<hv_store_ent> for
+each pair. A later duplicate key replaces the earlier value. The hash
+takes over one reference count of every value.
+
+The bucket array is sized once for all pairs, the keys are hashed in
+batches and the entries are linked directly, without the magic,
+restricted and split checks of C<hv_common> for every key.
+C<hv> must not be magical or readonly. Keys which are magical,
+references, undefined or UTF-8 are stored via C<hv_store_ent>.
+
+Used by the list assignment to a hash and the anonymous hash
+constructor.
+
+=cut
+*/
+
+void
+Perl_hv_store_list(pTHX_ HV *hv, SV **kv, U32 npairs)
+{
+    XPVHV * const xhv = (XPVHV*)SvANY(hv);
+    const char *keys[HV_STORE_LIST_CHUNK];
+    STRLEN lens[HV_STORE_LIST_CHUNK];
+    U32 hashes[HV_STORE_LIST_CHUNK];
+    U32 i, total, newsize;
+    bool oindex = FALSE;
+
+    PERL_ARGS_ASSERT_HV_STORE_LIST;
+    assert(!SvMAGICAL(hv));
+    assert(!SvREADONLY(hv));
+    assert(hv != PL_strtab);
+
+    if (!npairs)
+        return;
+    if (HvSHAPED(hv))
+        hv_unshape(hv);
+
+    /* size it once, as hv_study. Duplicate keys may leave it too big. */
+    total = xhv->xhv_keys + npairs;
+    if (total < npairs)
+        Perl_croak(aTHX_ "Too many elements");
+    newsize = S_ceil_to_power2(total);
+#if HV_FILL_RATE < 100
+    if (newsize >= total && ((U32)(total * 100) >> CTZ(newsize)) >= HV_FILL_RATE)
+#else
+    if (newsize >= total && total >= newsize - 1)
+#endif
+        newsize = newsize << 1;
+    if (newsize >= total)
+        hv_ksplit(hv, newsize);
+    if (!HvARRAY(hv))
+        Newxz(HvARRAY(hv), PERL_HV_ARRAY_ALLOC_BYTES(xhv->xhv_max+1), HE*);
+    /* a big hash gets its aux struct now, as in hsplit */
+    if (!SvOOK(hv) && xhv->xhv_max + 1 >= PERL_HV_ALLOC_AUX_SIZE) {
+        (void)hv_auxinit(hv);
+#ifdef PERL_HV_OPENADDR
+        if (xhv->xhv_max + 1 >= PERL_HV_OINDEX_MIN)
+            HvAUX(hv)->xhv_aux_flags |= HvAUXf_OPENADDR;
+#endif
+    }
+    if (SvOOK(hv)) {
+        struct xpvhv_aux * const aux = HvAUX(hv);
+        if (aux->xhv_split_todo)
+            hsplit_step(hv, aux->xhv_split_todo);
+        if (UNLIKELY(aux->xhv_perfect))
+            hv_perfect_free(hv);
+        oindex = cBOOL(aux->xhv_aux_flags & HvAUXf_OPENADDR);
+#ifdef USE_SAFE_HASHITER
+        aux->xhv_timestamp++;
+#endif
+    }
+    DEBUG_H(PerlIO_printf(Perl_debug_log, "HASH store list %u\t%6u\t%s\n",
+                          (unsigned)npairs, (unsigned)xhv->xhv_max,
+                          HvNAME_get(hv)?HvNAME_get(hv):""));
+
+    for (i = 0; i < npairs; ) {
+        SV ** const pairs = kv + 2 * (SSize_t)i;
+        const U32 max = npairs - i < HV_STORE_LIST_CHUNK
+                      ? npairs - i : HV_STORE_LIST_CHUNK;
+        U32 j, n;
+
+        /* first hash the keys of the chunk, up to the first slow one */
+        for (n = 0; n < max; n++) {
+            SV * const keysv = pairs[2 * n];
+            if (UNLIKELY(SvGMAGICAL(keysv) || SvROK(keysv) || !SvOK(keysv)))
+                break;
+            keys[n] = SvPV_nomg_const(keysv, lens[n]);
+            if (UNLIKELY(SvUTF8(keysv) || lens[n] > I32_MAX))
+                break;
+            if (SvIsCOW_shared_hash(keysv))
+                hashes[n] = SvSHARED_HASH(keysv);
+            else
+                PERL_HASH(hashes[n], keys[n], lens[n]);
+        }
+
+        /* then link them */
+        for (j = 0; j < n; j++) {
+            SV * const keysv = pairs[2 * j];
+            SV * const val = pairs[2 * j + 1];
+            const char * const key = keys[j];
+            const I32 klen = (I32)lens[j];
+            const U32 hash = hashes[j];
+            HEK * const keyhek = HvSHAREKEYS(hv) && SvIsCOW_shared_hash(keysv)
+                ? SvSHARED_HEK_FROM_PV(key) : NULL;
+            HE ** const oentry = &HvARRAY(hv)[ HvBUCKET_INDEX(hv, hash) ];
+            HE *entry;
+            int collisions = -1;
+
+            for (entry = *oentry; entry; entry = HeNEXT(entry)) {
+                CHECK_HASH_FLOOD(collisions)
+                if (HeKEY_hek(entry) == keyhek)
+                    break;
+                if (HeHASH(entry) == hash && HeKLEN(entry) == klen
+                    && memEQ(HeKEY(entry), key, klen)
+                    && !(HeKFLAGS(entry) & HVhek_UTF8))
+                    break;
+            }
+            if (entry) {
+                /* a duplicate. hv_common swaps a WASUTF8 key */
+                if (UNLIKELY(HeKFLAGS(entry) & HVhek_MASK))
+                    (void)hv_store_ent(hv, keysv, val, hash);
+                else {
+                    assert(HeVAL(entry) != &PL_sv_placeholder);
+                    SvREFCNT_dec(HeVAL(entry));
+                    HeVAL(entry) = val;
+                }
+                continue;
+            }
+
+            entry = new_HE();
+            if (keyhek)
+                HeKEY_hek(entry) = share_hek_hek(keyhek);
+            else if (HvSHAREKEYS(hv))
+                HeKEY_hek(entry) = share_hek_flags(key, klen, hash, 0);
+            else
+                HeKEY_hek(entry) = save_hek_flags(key, klen, hash, 0);
+            HeVAL(entry) = val;
+            if (oindex)
+                hv_oindex_insert(hv, entry);
+            xhv->xhv_keys++;
+#ifdef PERL_HASH_RANDOMIZE_KEYS
+            /* the same semi-random insert order in a bucket as hv_common */
+            if (*oentry && PL_HASH_RAND_BITS_ENABLED) {
+                PL_hash_rand_bits++;
+                PL_hash_rand_bits = ROTL_UV(PL_hash_rand_bits,1);
+                if (PL_hash_rand_bits & 1) {
+                    HeNEXT(entry) = HeNEXT(*oentry);
+                    HeNEXT(*oentry) = entry;
+                    continue;
+                }
+            }
+#endif
+            HeNEXT(entry) = *oentry;
+            *oentry = entry;
+        }
+        i += n;
+        if (n < max) {
+            /* A slow key, which may run code, e.g. an overloaded "".
+               Store it normally, and all others too if that code made
+               the hash magical. */
+            (void)hv_store_ent(hv, pairs[2 * n], pairs[2 * n + 1], 0);
+            i++;
+            if (UNLIKELY(SvMAGICAL(hv) || SvREADONLY(hv) || HvSHAPED(hv)
+                         || !HvARRAY(hv))) {
+                for (; i < npairs; i++)
+                    (void)hv_store_ent(hv, kv[2 * (SSize_t)i],
+                                       kv[2 * (SSize_t)i + 1], 0);
+                return;
+            }
+            oindex = SvOOK(hv)
+                && cBOOL(HvAUX(hv)->xhv_aux_flags & HvAUXf_OPENADDR);
+        }
+    }
+    if (UNLIKELY(DO_HSPLIT(xhv))) /* only if some code added keys */
+        hsplit(hv, xhv->xhv_max + 1, (xhv->xhv_max + 1) * 2);
+#ifdef PERL_HASH_RANDOMIZE_KEYS
+    if (SvOOK(hv)) {
+        if (PL_HASH_RAND_BITS_ENABLED) {
+            if (PL_HASH_RAND_BITS_ENABLED == 1)
+                PL_hash_rand_bits += ptr_hash((PTRV)HvARRAY(hv));
+            PL_hash_rand_bits = ROTL_UV(PL_hash_rand_bits,1);
+        }
+        HvAUX(hv)->xhv_rand = (U32)PL_hash_rand_bits;
+    }
+#endif
+}
+
 /* IMO this should also handle cases where hv_max is smaller than hv_keys
  * as tied hashes could play silly buggers and mess us around. We will
  * do the right thing during hv_store() afterwards, but still - Yves */
@@ -2037,7 +3101,20 @@ Perl_newHVhv(pTHX_ HV *ohv)
 	return hv;
     hv_max = HvMAX(ohv);
 
-    if (!SvMAGICAL((const SV *)ohv)) {
+    if (HvSHAPED(ohv)) {
+	/* copy into a normal hash, and leave ohv shaped */
+	const struct hv_shape * const shape = HvSHAPE(ohv);
+	SV * const * const vals = HvSHAPED_VALS(ohv);
+	U32 i;
+	for (i = 0; i < shape->hs_keys; i++) {
+	    const HEK * const hek = shape->hs_heks[i];
+	    SV * const val = vals[i];
+	    (void)hv_store_flags(hv, HEK_KEY(hek), HEK_LEN(hek),
+				 SvIMMORTAL(val) ? val : newSVsv(val),
+				 HEK_HASH(hek), HEK_FLAGS(hek));
+	}
+    }
+    else if (!SvMAGICAL((const SV *)ohv)) {
 	/* It's an ordinary hash, so copy it fast. AMS 20010804 */
 	U32 i;
 	const bool shared = !!HvSHAREKEYS(ohv);
@@ -2075,6 +3152,13 @@ Perl_newHVhv(pTHX_ HV *ohv)
 	    }
 	}
 
+	/* the copy has no aux, so finish a pending split of ohv in it */
+	if (SvOOK(ohv) && HvAUX(ohv)->xhv_split_todo) {
+	    const U32 half = (hv_max >> 1) + 1;
+	    for (i = half - HvAUX(ohv)->xhv_split_todo; i < half; i++)
+		hsplit_bucket(ents, i, hv_max);
+	}
+
 	HvMAX(hv)   = hv_max;
 	HvTOTALKEYS(hv)  = HvTOTALKEYS(ohv);
 	HvARRAY(hv) = ents;
@@ -2249,6 +3333,8 @@ Perl_hv_clear(pTHX_ HV *hv)
     EXTEND_MORTAL(1);
     PL_tmps_stack[++PL_tmps_ix] = SvREFCNT_inc_simple_NN(hv);
     orig_ix = PL_tmps_ix;
+    if (SvREADONLY(hv) && HvSHAPED(hv))
+        hv_unshape(hv);
     if (SvREADONLY(hv) && HvARRAY(hv) != NULL) {
 	/* restricted hash: convert all keys to placeholders */
 	U32 i;
@@ -2330,6 +3416,7 @@ S_clear_placeholders(pTHX_ HV *hv, U32 items)
 
     if (items == 0)
 	return;
+    hv_perfect_free(hv);
 
     for (i = 0; i <= HvMAX(hv); i++) {
 	/* Loop down the linked list heads  */
@@ -2339,6 +3426,8 @@ S_clear_placeholders(pTHX_ HV *hv, U32 items)
 	while ((entry = *oentry)) {
 	    if (HeVAL(entry) == PLACEHOLDER) {
 		*oentry = HeNEXT(entry);
+		if (SvOOK(hv) && HvAUX(hv)->xhv_oindex)
+		    hv_oindex_delete(HvAUX(hv)->xhv_oindex, entry);
 		if (entry == HvEITER_get(hv))
 		    HvLAZYDEL_on(hv);
 		else {
@@ -2402,7 +3491,24 @@ Perl_hfree_next_entry(pTHX_ HV *hv, U32 *indexp)
 
     PERL_ARGS_ASSERT_HFREE_NEXT_ENTRY;
 
+    if (HvSHAPED(hv)) {
+        /* pop the values, and drop the shape with the last one */
+        XPVHV * const xhv = (XPVHV*)SvANY(hv);
+        SV *sv;
+        if (!xhv->xhv_keys) {
+            hv_shape_free(hv);
+            return NULL;
+        }
+        sv = HvSHAPED_VALS(hv)[--xhv->xhv_keys];
+        if (!xhv->xhv_keys)
+            hv_shape_free(hv);
+        return sv;
+    }
     if (SvOOK(hv) && ((iter = HvAUX(hv)))) {
+        if (iter->xhv_perfect)
+            hv_perfect_free(hv);
+        if (iter->xhv_oindex)
+            hv_oindex_free(hv);
 	if ((entry = iter->xhv_eiter)) {
             DEBUG_H(PerlIO_printf(Perl_debug_log, "HASH hfree iter [%u]\t%u %u DEL\t%s\n",
                                   (unsigned)*indexp, (unsigned)HvTOTALKEYS(hv),
@@ -2576,6 +3682,14 @@ Perl_hv_undef_flags(pTHX_ HV *hv, U32 flags)
             Safefree(meta);
             HvAUX(hv)->xhv_mro_meta = NULL;
         }
+        hv_perfect_free(hv);
+        hv_oindex_free(hv);
+        while (HvAUX(hv)->xhv_shapes) {
+            struct hv_shape * const shape = HvAUX(hv)->xhv_shapes;
+            HvAUX(hv)->xhv_shapes = shape->hs_next;
+            shape->hs_next = NULL;
+            hv_shape_dec(shape);
+        }
         if (!HvAUX(hv)->xhv_name_u.xhvnameu_name && ! HvAUX(hv)->xhv_backreferences)
             SvFLAGS(hv) &= ~SVf_OOK;
 #if defined(HvFIELDS_get)
@@ -2632,8 +3746,9 @@ Perl_hv_fill(pTHX_ HV *const hv)
     PERL_ARGS_ASSERT_HV_FILL;
 
     /* No keys implies no buckets used.
-       One key can only possibly mean one bucket used.  */
-    if (HvTOTALKEYS(hv) < 2)
+       One key can only possibly mean one bucket used.
+       A shaped hash has no buckets, count it as perfectly filled. */
+    if (HvTOTALKEYS(hv) < 2 || HvSHAPED(hv))
         return HvTOTALKEYS(hv);
 
     if (ents) {
@@ -2653,6 +3768,96 @@ Perl_hv_fill(pTHX_ HV *const hv)
     return count;
 }
 
+/*
+=for apidoc hv_bucket_stats
+
+Fills C<st> with the chain statistics of the hash: the number of keys,
+buckets, used buckets and placeholders, a histogram of the chain
+lengths, the longest chain and the number of entries compared when
+every key is looked up once. C<hvs_splits> is the number of times the
+bucket array was doubled from its initial size, by inserts or
+presizing. A shaped hash has no chains, it needs one probe per key.
+With C<-DPERL_GLOBAL_STRTAB> the stats of C<PL_strtab> are the sums of
+all stripes of the process-global string table.
+
+Unlike C<Hash::Util::bucket_info> this does not convert a shaped hash
+and needs no C<DEBUGGING> build. It walks all buckets once, so it
+costs about as much as C<HvFILL>.
+
+The interpreter counts all C<hsplit> calls in C<PL_hv_splits> and the
+entries they rehashed in C<PL_hv_split_entries>.
+
+=cut
+*/
+
+void
+Perl_hv_bucket_stats(pTHX_ HV *const hv, struct hv_stats *st)
+{
+    HE **ents;
+    U32 max, i;
+
+    PERL_ARGS_ASSERT_HV_BUCKET_STATS;
+
+    Zero(st, 1, struct hv_stats);
+#ifdef PERL_GLOBAL_STRTAB
+    if (hv == PL_strtab) {
+        /* the shared keys are in the stripes of the global table */
+        int s;
+        for (s = 0; s < PERL_STRTAB_STRIPES; s++) {
+            struct strtab_stripe * const ss = &PL_strtab_stripes[s];
+            MUTEX_LOCK(&ss->ss_lock);
+            if (ss->ss_array) {
+                st->hvs_keys += ss->ss_keys;
+                st->hvs_buckets += ss->ss_max + 1;
+                bucket_chain_stats(ss->ss_array, ss->ss_max, st);
+            }
+            MUTEX_UNLOCK(&ss->ss_lock);
+        }
+        return;
+    }
+#endif
+    st->hvs_keys = HvUSEDKEYS(hv);
+    if (HvSHAPED(hv)) {
+        st->hvs_probes = st->hvs_keys;
+        return;
+    }
+    max = HvMAX(hv);
+    st->hvs_buckets = max + 1;
+    for (i = max / (PERL_HASH_DEFAULT_HvMAX + 1) + 1; i > 1; i >>= 1)
+        st->hvs_splits++;
+    ents = HvARRAY(hv);
+    if (!ents) {
+        st->hvs_chains[0] = st->hvs_buckets;
+        return;
+    }
+    bucket_chain_stats(ents, max, st);
+}
+
+/* adds the chains of the buckets to the stats */
+STATIC void
+S_bucket_chain_stats(pTHX_ HE *const *ents, U32 max, struct hv_stats *st)
+{
+    U32 i;
+
+    PERL_ARGS_ASSERT_BUCKET_CHAIN_STATS;
+    for (i = 0; i <= max; i++) {
+        U32 len = 0;
+        const HE *he;
+        for (he = ents[i]; he; he = HeNEXT(he)) {
+            len++;
+            if (HeVAL(he) == &PL_sv_placeholder)
+                st->hvs_placeholders++;
+            else
+                st->hvs_probes += len;
+        }
+        if (len > st->hvs_max_chain)
+            st->hvs_max_chain = len;
+        st->hvs_chains[len < HV_STATS_CHAINS ? len : HV_STATS_CHAINS - 1]++;
+        if (len)
+            st->hvs_used++;
+    }
+}
+
 /* hash a pointer to a U32 - Used in the hash traversal randomization
  * and bucket order randomization code
  *
@@ -2712,6 +3917,8 @@ S_hv_auxinit(pTHX_ HV *hv) {
     PERL_ARGS_ASSERT_HV_AUXINIT;
 
     if (!SvOOK(hv)) {
+        if (HvSHAPED(hv))
+            hv_unshape(hv);
         if (!HvARRAY(hv)) {
             Newxz(array, PERL_HV_ARRAY_ALLOC_BYTES(HvMAX(hv) + 1)
                 + sizeof(struct xpvhv_aux), char);
@@ -2775,9 +3982,9 @@ Perl_hv_iterinit(pTHX_ HV *hv)
 #ifdef USE_SAFE_HASHITER
         iter->xhv_savedstamp = iter->xhv_timestamp;
 #endif
-    } else {
+    } else if (!HvSHAPED(hv)) {
 	hv_auxinit(hv);
-    }
+    } /* else no iterator to reset, hv_iternext converts a shaped hash */
 
     /* note this includes placeholders! */
     return HvTOTALKEYS(hv);
@@ -3192,7 +4399,7 @@ Perl_hv_iternext_flags(pTHX_ HV *hv, I32 flags)
 	/* Too many things (well, pp_each at least) merrily assume that you can
 	   call hv_iternext without calling hv_iterinit, so we'll have to deal
 	   with it.  */
-	(void)hv_iterinit(hv);
+	(void)hv_auxinit(hv);
     }
     iter = HvAUX(hv);
 
@@ -3491,9 +4698,12 @@ Perl_unshare_hek(pTHX_ const HEK *hek)
 STATIC void
 S_unshare_hek_or_pvn(pTHX_ const HEK *hek, const char *str, I32 len, U32 hash)
 {
+#ifndef PERL_GLOBAL_STRTAB
     XPVHV* xhv;
     HE *entry;
     HE **oentry;
+#endif
+    bool found;
     bool is_utf8 = FALSE;
     int k_flags = 0;
     const char * const save = str;
@@ -3509,10 +4719,12 @@ S_unshare_hek_or_pvn(pTHX_ const HEK *hek, const char *str, I32 len, U32 hash)
            shared hek */
         assert (he->shared_he_he.hent_hek == hek);
 
+#ifndef PERL_GLOBAL_STRTAB
         if (he->shared_he_he.he_valu.hent_refcount - 1) {
             --he->shared_he_he.he_valu.hent_refcount;
             return;
         }
+#endif
 
         hash = HEK_HASH(hek);
     } else if (len < 0) {
@@ -3527,6 +4739,10 @@ S_unshare_hek_or_pvn(pTHX_ const HEK *hek, const char *str, I32 len, U32 hash)
             k_flags |= HVhek_WASUTF8 | HVhek_FREEKEY;
     }
 
+#ifdef PERL_GLOBAL_STRTAB
+    found = unshare_hek_global(he ? &(he->shared_he_he) : NULL,
+                               str, len, hash, k_flags);
+#else
     /* what follows was the moral equivalent of:
     if ((Svp = hv_fetch(PL_strtab, tmpsv, FALSE, hash))) {
 	if (--*Svp == NULL)
@@ -3534,7 +4750,7 @@ S_unshare_hek_or_pvn(pTHX_ const HEK *hek, const char *str, I32 len, U32 hash)
     } */
     xhv = (XPVHV*)SvANY(PL_strtab);
     /* assert(xhv_array != 0) */
-    oentry = &HvARRAY(PL_strtab)[ HvHASH_INDEX(hash, HvMAX(PL_strtab)) ];
+    oentry = &HvARRAY(PL_strtab)[ HvBUCKET_INDEX(PL_strtab, hash) ];
     if (he) {
 	const HE *const he_he = &(he->shared_he_he);
         for (entry = *oentry; entry; oentry = &HeNEXT(entry), entry = *oentry) {
@@ -3572,8 +4788,10 @@ S_unshare_hek_or_pvn(pTHX_ const HEK *hek, const char *str, I32 len, U32 hash)
             xhv->xhv_keys--;
         }
     }
+    found = entry != NULL;
+#endif
 
-    if (!entry)
+    if (!found)
 	Perl_ck_warner_d(aTHX_ packWARN(WARN_INTERNAL),
 			 "Attempt to free nonexistent shared string '%s'%s"
 			 pTHX__FORMAT,
@@ -3641,12 +4859,17 @@ S_share_hek_flags(pTHX_ const char *str, I32 len, U32 hash, int flags)
 {
     HE *entry;
     const int flags_masked = flags & HVhek_MASK;
-    const U32 hindex = HvHASH_INDEX(hash, HvMAX(PL_strtab));
+    U32 hindex;
     XPVHV * const xhv = (XPVHV*)SvANY(PL_strtab);
     int collisions = -1;
 
     PERL_ARGS_ASSERT_SHARE_HEK_FLAGS;
     assert(len >= 0);
+#ifdef PERL_GLOBAL_STRTAB
+    return share_hek_global(str, len, hash, flags);
+#endif
+    HV_SPLIT_STEP(PL_strtab);
+    hindex = HvBUCKET_INDEX(PL_strtab, hash);
 
     /* what follows is the moral equivalent of:
 
@@ -3738,6 +4961,235 @@ S_share_hek_flags(pTHX_ const char *str, I32 len, U32 hash, int flags)
     return HeKEY_hek(entry);
 }
 
+#ifdef PERL_GLOBAL_STRTAB
+
+/*
+=for apidoc strtab_init
+
+Initializes the process-global shared string table of a
+C<-DPERL_GLOBAL_STRTAB> build, which replaces the per-interpreter
+C<PL_strtab> for the shared keys. Called with the first interpreter,
+the buckets of a stripe are allocated with its first key.
+
+=for apidoc strtab_term
+
+Frees the process-global shared string table with all remaining keys,
+after the last interpreter was destructed.
+
+=cut
+*/
+void
+Perl_strtab_init(void)
+{
+    dVAR;
+    int i;
+
+    for (i = 0; i < PERL_STRTAB_STRIPES; i++) {
+        struct strtab_stripe * const ss = &PL_strtab_stripes[i];
+        MUTEX_INIT(&ss->ss_lock);
+        ss->ss_array = NULL;
+        ss->ss_max = ss->ss_keys = 0;
+    }
+}
+
+void
+Perl_strtab_term(void)
+{
+    dVAR;
+    int i;
+
+    for (i = 0; i < PERL_STRTAB_STRIPES; i++) {
+        struct strtab_stripe * const ss = &PL_strtab_stripes[i];
+        if (ss->ss_array) {
+            U32 j;
+            for (j = 0; j <= ss->ss_max; j++) {
+                HE *entry = ss->ss_array[j];
+                while (entry) {
+                    HE * const next = HeNEXT(entry);
+                    PerlMemShared_free(entry);
+                    entry = next;
+                }
+            }
+            PerlMemShared_free(ss->ss_array);
+            ss->ss_array = NULL;
+            ss->ss_keys = 0;
+        }
+        MUTEX_DESTROY(&ss->ss_lock);
+    }
+}
+
+/*
+=for apidoc strtab_hek_inc
+
+Increments the refcount of a shared key in the process-global string
+table under the lock of its stripe. This is C<share_hek_hek> with
+C<-DPERL_GLOBAL_STRTAB>.
+
+=cut
+*/
+HEK *
+Perl_strtab_hek_inc(const HEK *hek)
+{
+    dVAR;
+    struct strtab_stripe * const ss = STRTAB_STRIPE(HEK_HASH(hek));
+
+    PERL_ARGS_ASSERT_STRTAB_HEK_INC;
+    MUTEX_LOCK(&ss->ss_lock);
+    ++(share_hek_he(hek)->shared_he_he.he_valu.hent_refcount);
+    MUTEX_UNLOCK(&ss->ss_lock);
+    return (HEK *)hek;
+}
+
+/* doubles the buckets of a stripe, with its lock held */
+STATIC void
+S_strtab_stripe_split(struct strtab_stripe *ss)
+{
+    const U32 oldsize = ss->ss_max + 1;
+    const U32 newmax = oldsize * 2 - 1;
+    HE ** const ary = (HE **)PerlMemShared_calloc(newmax + 1, sizeof(HE *));
+    U32 i;
+
+    PERL_ARGS_ASSERT_STRTAB_STRIPE_SPLIT;
+    if (!ary)           /* keep the longer chains */
+        return;
+    for (i = 0; i < oldsize; i++) {
+        HE *entry = ss->ss_array[i];
+        while (entry) {
+            HE * const next = HeNEXT(entry);
+            HE ** const head = &ary[HeHASH(entry) & newmax];
+            HeNEXT(entry) = *head;
+            *head = entry;
+            entry = next;
+        }
+    }
+    PerlMemShared_free(ss->ss_array);
+    ss->ss_array = ary;
+    ss->ss_max = newmax;
+}
+
+/* share_hek_flags() with the process-global string table. The lookup,
+   insert and refcount are done under the lock of the stripe, the flood
+   check after the unlock as it may croak. */
+STATIC HEK *
+S_share_hek_global(pTHX_ const char *str, I32 len, U32 hash, int flags)
+{
+    dVAR;
+    struct strtab_stripe * const ss = STRTAB_STRIPE(hash);
+    const int flags_masked = flags & HVhek_MASK;
+    HE *entry;
+    HEK *hek;
+    int collisions = -1;
+
+    PERL_ARGS_ASSERT_SHARE_HEK_GLOBAL;
+
+    MUTEX_LOCK(&ss->ss_lock);
+    if (UNLIKELY(!ss->ss_array)) {
+        ss->ss_array = (HE **)PerlMemShared_calloc(PERL_STRTAB_STRIPE_MIN,
+                                                   sizeof(HE *));
+        if (!ss->ss_array) {
+            MUTEX_UNLOCK(&ss->ss_lock);
+            croak_no_mem();
+        }
+        ss->ss_max = PERL_STRTAB_STRIPE_MIN - 1;
+    }
+    for (entry = ss->ss_array[hash & ss->ss_max]; entry;
+         entry = HeNEXT(entry)) {
+        collisions++;
+        if (HeHASH(entry) == hash && HeKLEN(entry) == len
+            && (HeKEY(entry) == str || memEQ(HeKEY(entry), str, len))
+            && HeKFLAGS(entry) == flags_masked)
+            break;
+    }
+
+    if (!entry) {
+        /* one chunk for the HE and the HEK, as in share_hek_flags() */
+        HE ** const head = &ss->ss_array[hash & ss->ss_max];
+        struct shared_he * const new_entry = (struct shared_he *)
+            PerlMemShared_malloc(STRUCT_OFFSET(struct shared_he,
+                                               shared_he_hek.hek_key[0])
+                                 + len + 2);
+        if (!new_entry) {
+            MUTEX_UNLOCK(&ss->ss_lock);
+            croak_no_mem();
+        }
+        entry = &(new_entry->shared_he_he);
+        hek = &(new_entry->shared_he_hek);
+        Copy(str, HEK_KEY(hek), len, char);
+        HEK_KEY(hek)[len] = 0;
+        HEK_LEN(hek) = len;
+        HEK_HASH(hek) = hash;
+        HEK_FLAGS(hek) = (unsigned char)flags_masked;
+        HeKEY_hek(entry) = hek;
+        entry->he_valu.hent_refcount = 0;
+        HeNEXT(entry) = *head;
+        *head = entry;
+        if (++ss->ss_keys > ss->ss_max)
+            strtab_stripe_split(ss);
+        DEBUG_H(PerlIO_printf(Perl_debug_log,
+            "HASH insert shared [%d] %u %u %d\tstrtab[%d]{%.*s}\n",
+            (int)(hash & ss->ss_max), (unsigned)ss->ss_keys,
+            (unsigned)ss->ss_max, collisions,
+            (int)(ss - PL_strtab_stripes), (int)len, str));
+    }
+    ++entry->he_valu.hent_refcount;
+    hek = HeKEY_hek(entry);
+    MUTEX_UNLOCK(&ss->ss_lock);
+
+    if (UNLIKELY(collisions > 127)) {
+        collisions--;
+        CHECK_HASH_FLOOD(collisions)
+    }
+    if (flags & HVhek_FREEKEY && !(flags & HVhek_STATIC))
+	Safefree(str);
+    return hek;
+}
+
+/* unshare_hek_or_pvn() with the process-global string table, by the
+   shared HE of a hek or by the key. Returns false if it was not shared. */
+STATIC bool
+S_unshare_hek_global(pTHX_ const HE *he_he, const char *str, I32 len,
+                     U32 hash, int k_flags)
+{
+    dVAR;
+    struct strtab_stripe * const ss = STRTAB_STRIPE(hash);
+    const int flags_masked = k_flags & HVhek_MASK;
+    HE *entry = NULL;
+    HE *freed = NULL;
+    bool found;
+
+    MUTEX_LOCK(&ss->ss_lock);
+    if (ss->ss_array) {
+        HE **oentry = &ss->ss_array[hash & ss->ss_max];
+        for (entry = *oentry; entry; oentry = &HeNEXT(entry), entry = *oentry) {
+            if (he_he) {
+                if (entry == he_he)
+                    break;
+            }
+            else if (HeHASH(entry) == hash && HeKLEN(entry) == len
+                     && (HeKEY(entry) == str || memEQ(HeKEY(entry), str, len))
+                     && HeKFLAGS(entry) == flags_masked)
+                break;
+        }
+        if (entry && --entry->he_valu.hent_refcount == 0) {
+            *oentry = HeNEXT(entry);
+            ss->ss_keys--;
+            freed = entry;
+        }
+    }
+    found = entry != NULL;
+    MUTEX_UNLOCK(&ss->ss_lock);
+
+    if (freed) {
+        DEBUG_m(PerlIO_printf(Perl_debug_log,
+            "0x%" UVxf ": unshare_hek(0x%" UVxf ") %ld len\n",
+            PTR2UV(freed), PTR2UV(HeKEY_hek(freed)), (long)HeKLEN(freed)));
+        PerlMemShared_free(freed);
+    }
+    return found;
+}
+
+#endif /* PERL_GLOBAL_STRTAB */
+
 /*
 =for apidoc hv_placeholders_p
 
@@ -67,6 +67,32 @@ struct shared_he {
     struct hek shared_he_hek;
 };
 
+/* With -DPERL_GLOBAL_STRTAB a threaded perl keeps the shared keys in one
+   process-global table instead of a PL_strtab per interpreter, so all
+   threads reference the same key strings and perl_clone does not copy
+   them. The table is split into PERL_STRTAB_STRIPES hashes with their
+   own lock, selected by the high bits of the key hash. */
+#if defined(PERL_GLOBAL_STRTAB) && !defined(USE_ITHREADS)
+#  undef PERL_GLOBAL_STRTAB
+#endif
+#ifdef PERL_GLOBAL_STRTAB
+#  ifndef PERL_STRTAB_STRIPE_BITS
+#    define PERL_STRTAB_STRIPE_BITS	4
+#  endif
+#  define PERL_STRTAB_STRIPES	(1 << PERL_STRTAB_STRIPE_BITS)
+#  define PERL_STRTAB_STRIPE_MIN	256	/* initial buckets of a stripe */
+
+struct strtab_stripe {
+    perl_mutex	ss_lock;
+    HE	      **ss_array;	/* shared_he chains, PerlMemShared */
+    U32		ss_max;		/* number of buckets - 1 */
+    U32		ss_keys;
+};
+
+#  define STRTAB_STRIPE(hash)						\
+    (&PL_strtab_stripes[(U32)(hash) >> (32 - PERL_STRTAB_STRIPE_BITS)])
+#endif
+
 /* Subject to change.
    Don't access this directly.
    Use the funcs in mro_core.c
@@ -135,14 +161,140 @@ struct xpvhv_aux {
     U32         xhv_savedstamp; /* timestamp state at hv_iterinit */
 #endif
     U32         xhv_aux_flags;  /* assorted extra flags */
+    U32         xhv_split_todo; /* lower half buckets not yet split, see hsplit */
     char *      xhv_aux_fields; /* buffer of class field "name\0"pad entries */
+    struct xpvhv_perfect *xhv_perfect; /* perfect hash index, see hv_study */
+    struct xpvhv_oindex *xhv_oindex; /* open addressing index, see HvAUXf_OPENADDR */
+    struct hv_shape *xhv_shapes; /* class stash: shapes of its objects, see hv_shape */
+};
+
+/* cperl only. A perfect hash index over the HEs of a readonly hash,
+   built by hv_study. The key hash selects a displacement, which selects
+   exactly one slot. The HEs stay in HvARRAY, this only points to them.
+   Dropped on every insert or free of an entry. */
+struct xpvhv_perfect {
+    U32		xhvph_shift;	/* 32 - log2(number of slots) */
+    U32		xhvph_dmax;	/* number of displacements - 1 */
+    U32	       *xhvph_disp;	/* displacement per hash & xhvph_dmax */
+    HE	       *xhvph_slots[1];	/* variable-length, HE or NULL */
 };
 
+#define HvPERFECT_SLOT(ph, hash) \
+    ((U32)(((U32)(hash) ^ ((ph)->xhvph_disp[(hash) & (ph)->xhvph_dmax] \
+                           * 0x85EBCA6BU)) * 0x9E3779B1U) >> (ph)->xhvph_shift)
+
 #define HvAUXf_SCAN_STASH   0x1   /* stash is being scanned by gv_check */
 #define HvAUXf_NO_DEREF     0x2   /* @{}, %{} etc (and nomethod) not present */
 #define HvAUXf_STATIC       0x8   /* HvARRAY and xpvhv_aux is statically allocated (embedders) */
 #define HvAUXf_SMALL       0x10   /* Small hash, linear scan */
 #define HvAUXf_ROLE        0x20   /* The class is a role */
+#define HvAUXf_OPENADDR    0x40   /* Lookup via the open addressing xhv_oindex */
+
+/* cperl only. An open addressing index over the HEs of a hash, in the
+   style of a Swiss table. Every slot keeps the full hash and the first
+   bytes of the key inline, so a probe only needs to follow the HE
+   pointer on a likely match, and a miss touches no HE or HEK at all.
+   The HEs stay in the HvARRAY chains, which still serve iteration.
+   Enabled per hash by the HvAUXf_OPENADDR flag, see hv_open_addressing,
+   or for all big hashes with -DPERL_HV_OPENADDR.
+   The index is allocated lazily on the next insert after a clear. */
+struct hv_oslot {
+    U32		hos_hash;	/* full hash of the key */
+    U32		hos_prefix;	/* first 4 bytes of the key, 0 padded */
+    HE	       *hos_he;
+};
+
+struct xpvhv_oindex {
+    U32		xhvo_max;	/* number of slots - 1 */
+    U32		xhvo_used;	/* full and deleted slots */
+    U8	       *xhvo_ctrl;	/* per slot: HVo_EMPTY, HVo_DELETED or the tag,
+                                   followed by a copy of the first HVo_GROUP */
+    struct hv_oslot xhvo_slots[1]; /* variable-length */
+};
+
+#define HVo_EMPTY	0x80
+#define HVo_DELETED	0xFE
+/* The ctrl bytes are probed in groups: 16 with SSE2, else 8 with SWAR */
+#ifndef HVo_GROUP
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define HVo_GROUP	16
+#  else
+#    define HVo_GROUP	8
+#  endif
+#endif
+/* set a ctrl byte, and its copy behind the end for the wrapping groups */
+#define HvOINDEX_SETCTRL(ox, i, c) STMT_START {			\
+        (ox)->xhvo_ctrl[i] = (c);					\
+        if ((i) < HVo_GROUP)						\
+            (ox)->xhvo_ctrl[(ox)->xhvo_max + 1 + (i)] = (c);		\
+    } STMT_END
+/* the low bits of the hash select the slot, the top 7 bits are the tag */
+#define HvOINDEX_TAG(hash)	((U8)((U32)(hash) >> 25))
+/* grow when more than 7/8 of the slots are full or deleted */
+#define HvOINDEX_FULL(ox)	((ox)->xhvo_used >= ((ox)->xhvo_max + 1) - (((ox)->xhvo_max + 1) >> 3))
+#ifndef PERL_HV_OINDEX_MIN
+/* with -DPERL_HV_OPENADDR the index is added to all hashes growing to
+   this many buckets. Smaller than PERL_HV_ALLOC_AUX_SIZE has no effect. */
+#  define PERL_HV_OINDEX_MIN PERL_HV_ALLOC_AUX_SIZE
+#endif
+
+/* cperl only. A shaped hash keeps no HEs at all, HvARRAY points to a
+   xpvhv_shaped with a pointer to the shared key layout and the dense
+   vector of values. Objects of one class with the same keys share
+   their hv_shape via the xhv_shapes list of the class stash.
+   Any new key, delete, iteration, magic or aux data converts it back
+   to a normal hash, see hv_shape and hv_unshape.
+   A shaped hash is never SvOOK. */
+struct hv_shape {
+    U32		hs_refcnt;	/* the class list and every shaped hash */
+    U32		hs_keys;	/* number of keys and values */
+    struct hv_shape *hs_next;	/* next shape of the same class */
+    HEK	       *hs_heks[1];	/* variable-length, shared keys sorted by
+                                   address, the value index is the position */
+};
+
+struct xpvhv_shaped {
+    struct hv_shape *xhvs_shape;
+    SV	       *xhvs_vals[1];	/* variable-length, hs_keys values */
+};
+
+#ifndef PERL_HV_SHAPE_MAX
+/* hashes with more keys are not worth the linear key scan */
+#  define PERL_HV_SHAPE_MAX 32
+#endif
+
+/* cperl only. The inline cache of the hash element ops with a shared
+   key, see hv_fetch_icache in pp_hot.c. Each site, the helem op or the
+   key item of a multideref, remembers where its key was found last:
+   the HE and its bucket, or the shape and the value index of a shaped
+   hash. Nothing needs to be invalidated, a hit is verified against
+   the current bucket chain or shape. */
+struct hv_icache {
+    const void *hic_site;	/* the op or the UNOP_AUX_item of the key */
+    const void *hic_ptr;	/* the HE, or the struct hv_shape */
+    U32		hic_index;	/* the bucket, or the value index */
+};
+
+#ifndef PERL_HV_ICACHE_SIZE
+/* direct-mapped per interpreter, a power of 2 */
+#  define PERL_HV_ICACHE_SIZE 256
+#endif
+#define HvICACHE_SLOT(site) \
+    (((PTR2UV(site) >> 4) ^ (PTR2UV(site) >> 12)) & (PERL_HV_ICACHE_SIZE - 1))
+
+/* cperl only. The chain statistics of a hash, filled by hv_bucket_stats.
+   The last hvs_chains slot also counts all longer chains. */
+#define HV_STATS_CHAINS 16
+struct hv_stats {
+    U32		hvs_keys;	/* keys, without placeholders */
+    U32		hvs_buckets;	/* size of the bucket array, 0 if shaped */
+    U32		hvs_used;	/* non-empty buckets */
+    U32		hvs_placeholders; /* deleted keys of a restricted hash */
+    U32		hvs_max_chain;	/* longest chain, with placeholders */
+    U32		hvs_splits;	/* doublings of the bucket array */
+    UV		hvs_probes;	/* entries compared to find every key once */
+    U32		hvs_chains[HV_STATS_CHAINS]; /* buckets per chain length */
+};
 
 /* hash structure: */
 /* This structure must match the beginning of struct xpvmg in sv.h. */
@@ -357,6 +509,22 @@ C<SV*>.
  * */
 #define PERL_HV_ALLOC_AUX_SIZE (1 << 9)
 
+/* Hashes growing to this many buckets are split incrementally, like
+ * the rehashing of a Redis dict: hsplit only grows the array, and each
+ * later lookup and store moves the entries of a few more buckets of the
+ * lower half up to their new twins. Until then the unsplit buckets from
+ * the split cursor up to the half still hold the entries of their upper
+ * twins, and HvBUCKET_INDEX looks there. Nothing moves while an iterator
+ * is active, and a new split finishes the pending one first.
+ * Define as 0 to always split at once. */
+#ifndef PERL_HV_INCR_SPLIT_MIN
+#  define PERL_HV_INCR_SPLIT_MIN (1 << 16)
+#endif
+/* number of buckets split per hash access */
+#ifndef PERL_HV_INCR_SPLIT_STEP
+#  define PERL_HV_INCR_SPLIT_STEP 4
+#endif
+
 /* 64bit arith is faster, even with the added mask */
 #if LONGSIZE >= 8
 #define HvHASH_INDEX(hash, max) \
@@ -365,6 +533,14 @@ C<SV*>.
 #define HvHASH_INDEX(hash, max) (hash & (max))
 #endif
 
+/* The bucket of hash, also while an incremental split is pending */
+#define HvBUCKET_INDEX(hv, hash)					\
+    (UNLIKELY(SvOOK(hv) && HvAUX(hv)->xhv_split_todo)			\
+     && ((hash) & (HvMAX(hv) >> 1))					\
+          >= ((HvMAX(hv) >> 1) + 1) - HvAUX(hv)->xhv_split_todo	\
+     ? (hash) & (HvMAX(hv) >> 1)					\
+     : HvHASH_INDEX(hash, HvMAX(hv)))
+
 /* these hash entry flags ride on hent_klen (for use only in magic/tied HVs) */
 #define HEf_SVKEY	-2	/* hent_key is an SV* */
 
@@ -404,6 +580,15 @@ C<SV*>.
 #define HvFIELDS_get(hv)  (SvOOK(hv) && HvCLASS(hv) \
                            ? HvAUX(hv)->xhv_aux_fields : NULL)
 #define HvFIELDS(hv)      HvAUX(hv)->xhv_aux_fields
+#define HvPERFECT_get(hv) (SvOOK(hv) ? HvAUX(hv)->xhv_perfect : NULL)
+#define HvOPENADDR(hv)    (HvFLAGS(hv) & HvAUXf_OPENADDR)
+#define HvOINDEX_get(hv)  (SvOOK(hv) ? HvAUX(hv)->xhv_oindex : NULL)
+#define HvSHAPED(hv)      (SvFLAGS(hv) & SVphv_SHAPED)
+#define HvSHAPED_on(hv)   (SvFLAGS(hv) |= SVphv_SHAPED)
+#define HvSHAPED_off(hv)  (SvFLAGS(hv) &= ~SVphv_SHAPED)
+#define HvSHAPED_BODY(hv) ((struct xpvhv_shaped*)HvARRAY(hv))
+#define HvSHAPE(hv)       (HvSHAPED_BODY(hv)->xhvs_shape)
+#define HvSHAPED_VALS(hv) (HvSHAPED_BODY(hv)->xhvs_vals)
 
 /* Checking that hv is a valid package stash is the
    caller's responsibility */
@@ -597,10 +782,15 @@ C<SV*>.
 #define share_hek_he(hek)						\
     ((struct shared_he *)(((char *)hek)                                 \
      - STRUCT_OFFSET(struct shared_he, shared_he_hek)))
+#ifdef PERL_GLOBAL_STRTAB
+#define share_hek_hek(hek)						\
+    (UNLIKELY(HEK_STATIC(hek)) ? (hek) : Perl_strtab_hek_inc(hek))
+#else
 #define share_hek_hek(hek)						\
     (UNLIKELY(HEK_STATIC(hek)) ? (hek) :                                \
      (++(share_hek_he(hek)->shared_he_he.he_valu.hent_refcount),        \
      hek))
+#endif
 
 #define hv_store_ent(hv, keysv, val, hash)				\
     ((HE *) hv_common((hv), (keysv), NULL, 0, 0, HV_FETCH_ISSTORE,	\
@@ -616,6 +806,13 @@ C<SV*>.
 #define hv_fetch_ent(hv, keysv, lval, hash)				\
     ((HE *) hv_common((hv), (keysv), NULL, 0, 0,			\
 		      ((lval) ? HV_FETCH_LVALUE : 0), NULL, (hash)))
+#ifdef PERL_CORE
+/* the value slot of an element, which keeps a shaped hash shaped */
+#define hv_fetch_ent_svp(hv, keysv, lval)				\
+    ((SV**) hv_common((hv), (keysv), NULL, 0, 0,			\
+		      ((lval) ? HV_FETCH_LVALUE : 0) | HV_FETCH_JUST_SV,	\
+		      NULL, 0))
+#endif
 #define hv_delete_ent(hv, key, discard, hash)				\
     (MUTABLE_SV(hv_common((hv), (key), NULL, 0, 0, (discard)|HV_DELETE, \
 			  NULL, (hash))))
@@ -800,6 +997,14 @@ instead of a string/length pair, and no precomputed hash.
 #  define HINTS_REFCNT_TERM		NOOP
 #endif
 
+#ifdef PERL_GLOBAL_STRTAB
+#  define STRTAB_INIT			Perl_strtab_init()
+#  define STRTAB_TERM			Perl_strtab_term()
+#else
+#  define STRTAB_INIT			NOOP
+#  define STRTAB_TERM			NOOP
+#endif
+
 /* Hash actions
  * Passed in PERL_MAGIC_uvar calls
  */
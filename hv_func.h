@@ -128,6 +128,79 @@
 #   define PERL_HASH_WITH_SEED(seed,hash,str,len) (hash)= S_perl_hash_farmhash64((seed),(U8*)(str),(len))
 #endif
 
+/* With Configure -Dhash_func=SELECT all hash functions usable on this
+   platform are compiled in, and one of them is selected at startup by
+   $ENV{PERL_HASH_FUNC}, see hash_func_select in hv.c. Without it the
+   default function above, PERL_HASH_FUNC, is used.
+   PERL_HASH_FUNC_NAME is the name of the used function. */
+#ifdef PERL_HASH_FUNC_SELECT
+#   define PERL_HASH_FUNC_NAME PL_hash_func_name
+#   undef  PERL_HASH_SEED_BYTES
+#   define PERL_HASH_SEED_BYTES 16
+#   undef  PERL_HASH_WITH_SEED
+#   define PERL_HASH_WITH_SEED(seed,hash,str,len) (hash)= (*PL_hash_func)((seed),(U8*)(str),(len))
+#   define PERL_HASH_FUNC_SUPERFAST
+#   define PERL_HASH_FUNC_MURMUR3
+#   define PERL_HASH_FUNC_DJB2
+#   define PERL_HASH_FUNC_SDBM
+#   define PERL_HASH_FUNC_ONE_AT_A_TIME
+#   define PERL_HASH_FUNC_ONE_AT_A_TIME_HARD
+#   define PERL_HASH_FUNC_FNV1A
+#   define PERL_HASH_FUNC_FNV1A_YOSHIMITSUTRIAD
+#   define PERL_HASH_FUNC_CRC32
+#   ifdef CAN64BITHASH
+#     define PERL_HASH_FUNC_SIPHASH
+#     define PERL_HASH_FUNC_MURMUR64A
+#     define PERL_HASH_FUNC_MURMUR64B
+#     define PERL_HASH_FUNC_METRO64CRC
+#     define PERL_HASH_FUNC_METRO64
+#     define PERL_HASH_FUNC_SPOOKY32
+#   endif
+#else
+#   define PERL_HASH_FUNC_NAME PERL_HASH_FUNC
+#endif
+
+/* hash functions take the seed, the string and its length */
+typedef U32 (*perl_hash_func_t)(const unsigned char * const seed,
+                                const unsigned char *str, const STRLEN len);
+
+/* The CRC32-C instructions of SSE4.2 and ARMv8, for CRC32 and METRO64CRC.
+   With hash_func=SELECT on x86_64 the functions are compiled for SSE4.2
+   and can only be selected when the CPU has it. */
+#if defined(__SSE4_2__)
+#   define PERL_HASH_HW_CRC32
+#   define PERL_HASH_HW_CRC32_TARGET
+#   define PERL_HASH_HW_CRC32_OK 1
+#elif defined(PERL_HASH_FUNC_SELECT) && defined(__x86_64__) \
+    && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#   define PERL_HASH_HW_CRC32
+#   define PERL_HASH_HW_CRC32_TARGET __attribute__((target("sse4.2")))
+#   define PERL_HASH_HW_CRC32_OK __builtin_cpu_supports("sse4.2")
+#elif defined(__ARM_FEATURE_CRC32)
+#   define PERL_HASH_HW_CRC32
+#   define PERL_HASH_HW_CRC32_TARGET
+#   define PERL_HASH_HW_CRC32_OK 1
+#endif
+#ifdef PERL_HASH_HW_CRC32
+#  if defined(__ARM_FEATURE_CRC32)
+#    include <arm_acle.h>
+#    define PERL_CRC32C_U8(crc, v)  __crc32cb((crc), (v))
+#    define PERL_CRC32C_U16(crc, v) __crc32ch((crc), (v))
+#    define PERL_CRC32C_U32(crc, v) __crc32cw((crc), (v))
+#    ifdef __aarch64__
+#      define PERL_CRC32C_U64(crc, v) __crc32cd((U32)(crc), (v))
+#    endif
+#  else
+#    include <nmmintrin.h>
+#    define PERL_CRC32C_U8(crc, v)  _mm_crc32_u8((crc), (v))
+#    define PERL_CRC32C_U16(crc, v) _mm_crc32_u16((crc), (v))
+#    define PERL_CRC32C_U32(crc, v) _mm_crc32_u32((crc), (v))
+#    ifdef __x86_64__
+#      define PERL_CRC32C_U64(crc, v) _mm_crc32_u64((crc), (v))
+#    endif
+#  endif
+#endif
+
 #ifndef PERL_HASH_WITH_SEED
 #error "No hash function defined!"
 #endif
@@ -825,8 +898,7 @@ S_perl_hash_fnv1a_yt(const unsigned char * const s, const unsigned char *str, co
 }
 #endif
 
-#if defined(PERL_HASH_FUNC_CRC32) && (defined(__SSE4_2__) || defined(AARCH64_FL_CRC))
-#include <smmintrin.h>
+#if defined(PERL_HASH_FUNC_CRC32) && defined(PERL_HASH_HW_CRC32)
 
 /* Byte-boundary alignment issues */
 #define ALIGN_SIZE      0x08UL
@@ -843,22 +915,22 @@ S_perl_hash_fnv1a_yt(const unsigned char * const s, const unsigned char *str, co
    and has low qualities in smhasher.
    See https://github.com/rurban/smhasher
 */
-PERL_STATIC_INLINE U32
+PERL_STATIC_INLINE PERL_HASH_HW_CRC32_TARGET U32
 S_perl_hash_crc32(const unsigned char * const seed, const unsigned char *str, STRLEN len) {
     const char* buf = (const char*)str;
     U32 hash = *((U32*)seed); /* tested nok + len in variant .1 much higher collision costs */
 
     /* Align the input to the word boundary */
     for (; (len > 0) && ((size_t)buf & ALIGN_MASK); len--, buf++) {
-        hash = _mm_crc32_u8(hash, *buf);
+        hash = PERL_CRC32C_U8(hash, *buf);
     }
 
-#ifdef __x86_64__
-    CALC_CRC(_mm_crc32_u64, hash, U64TYPE, buf, len);
+#ifdef PERL_CRC32C_U64
+    CALC_CRC(PERL_CRC32C_U64, hash, U64TYPE, buf, len);
 #endif
-    CALC_CRC(_mm_crc32_u32, hash, U32, buf, len);
-    CALC_CRC(_mm_crc32_u16, hash, U16, buf, len);
-    CALC_CRC(_mm_crc32_u8,  hash, U8,  buf, len);
+    CALC_CRC(PERL_CRC32C_U32, hash, U32, buf, len);
+    CALC_CRC(PERL_CRC32C_U16, hash, U16, buf, len);
+    CALC_CRC(PERL_CRC32C_U8,  hash, U8,  buf, len);
 
     return hash;
 }
@@ -866,20 +938,20 @@ S_perl_hash_crc32(const unsigned char * const seed, const unsigned char *str, ST
 
 #if defined(CAN64BITHASH) && (defined(PERL_HASH_FUNC_METRO64CRC) || defined(PERL_HASH_FUNC_METRO64))
 /* rotate right idiom recognized by compiler*/
-inline static U64TYPE rotate_right(U64TYPE v, unsigned k) {
+inline static U64TYPE metro_rotate_right(U64TYPE v, unsigned k) {
     return (v >> k) | (v << (64 - k));
 }
 // unaligned reads, fast and safe on Nehalem and later microarchitectures
-inline static U64TYPE read_u64(const void * const ptr) {
+inline static U64TYPE metro_read_u64(const void * const ptr) {
     return *(U64TYPE*)ptr;
 }
-inline static U64TYPE read_u32(const void * const ptr) {
+inline static U64TYPE metro_read_u32(const void * const ptr) {
     return (U64TYPE)(*(U32*)ptr);
 }
-inline static U64TYPE read_u16(const void * const ptr) {
+inline static U64TYPE metro_read_u16(const void * const ptr) {
     return (U64TYPE)(*(U16*)ptr);
 }
-inline static U64TYPE read_u8 (const void * const ptr) {
+inline static U64TYPE metro_read_u8 (const void * const ptr) {
     return (U64TYPE)(*(U8*)ptr);
 }
 #endif
@@ -888,16 +960,15 @@ inline static U64TYPE read_u8 (const void * const ptr) {
    is almost as fast as CRC32, one of the best hash functions
    and relatively secure.
    cfarmhash for 32 bit would be a bit better though. */
-#if defined(PERL_HASH_FUNC_METRO64CRC) && \
-    (defined(__SSE4_2__) || defined(AARCH64_FL_CRC))
-#include <nmmintrin.h>
+#if defined(PERL_HASH_FUNC_METRO64CRC) && defined(CAN64BITHASH) \
+    && defined(PERL_CRC32C_U64)
 
 /* The MIT License (MIT)
   Copyright (c) 2015 J. Andrew Rogers
   Copyright (c) 2015 cPanel Inc.
   See https://github.com/rurban/smhasher
  */
-PERL_STATIC_INLINE U32
+PERL_STATIC_INLINE PERL_HASH_HW_CRC32_TARGET U32
 S_perl_hash_metro64crc(const unsigned char * const seed, const unsigned char *str, STRLEN len) {
     static const U64TYPE k0 = 0xC83A91E1;
     static const U64TYPE k1 = 0x8648DBDB;
@@ -917,44 +988,45 @@ S_perl_hash_metro64crc(const unsigned char * const seed, const unsigned char *st
         v[3] = hash;
 
         do {
-            v[0] ^= _mm_crc32_u64(v[0], read_u64(ptr) * k0); ptr += 8;
-            v[1] ^= _mm_crc32_u64(v[1], read_u64(ptr) * k1); ptr += 8;
-            v[2] ^= _mm_crc32_u64(v[2], read_u64(ptr) * k2); ptr += 8;
-            v[3] ^= _mm_crc32_u64(v[3], read_u64(ptr) * k3); ptr += 8;
+            v[0] ^= PERL_CRC32C_U64(v[0], metro_read_u64(ptr) * k0); ptr += 8;
+            v[1] ^= PERL_CRC32C_U64(v[1], metro_read_u64(ptr) * k1); ptr += 8;
+            v[2] ^= PERL_CRC32C_U64(v[2], metro_read_u64(ptr) * k2); ptr += 8;
+            v[3] ^= PERL_CRC32C_U64(v[3], metro_read_u64(ptr) * k3); ptr += 8;
         } while (ptr <= (end - 32));
 
-        v[2] ^= rotate_right(((v[0] + v[3]) * k0) + v[1], 33) * k1;
-        v[3] ^= rotate_right(((v[1] + v[2]) * k1) + v[0], 33) * k0;
-        v[0] ^= rotate_right(((v[0] + v[2]) * k0) + v[3], 33) * k1;
-        v[1] ^= rotate_right(((v[1] + v[3]) * k1) + v[2], 33) * k0;
+        v[2] ^= metro_rotate_right(((v[0] + v[3]) * k0) + v[1], 33) * k1;
+        v[3] ^= metro_rotate_right(((v[1] + v[2]) * k1) + v[0], 33) * k0;
+        v[0] ^= metro_rotate_right(((v[0] + v[2]) * k0) + v[3], 33) * k1;
+        v[1] ^= metro_rotate_right(((v[1] + v[3]) * k1) + v[2], 33) * k0;
         hash += v[0] ^ v[1];
     }
     if ((end - ptr) >= 16) {
-        U64TYPE v0 = hash + (read_u64(ptr) * k0); ptr += 8; v0 = rotate_right(v0,33) * k1;
-        U64TYPE v1 = hash + (read_u64(ptr) * k1); ptr += 8; v1 = rotate_right(v1,33) * k2;
-        v0 ^= rotate_right(v0 * k0, 35) + v1;
-        v1 ^= rotate_right(v1 * k3, 35) + v0;
+        U64TYPE v0, v1;
+        v0 = hash + (metro_read_u64(ptr) * k0); ptr += 8; v0 = metro_rotate_right(v0,33) * k1;
+        v1 = hash + (metro_read_u64(ptr) * k1); ptr += 8; v1 = metro_rotate_right(v1,33) * k2;
+        v0 ^= metro_rotate_right(v0 * k0, 35) + v1;
+        v1 ^= metro_rotate_right(v1 * k3, 35) + v0;
         hash += v1;
     }
     if ((end - ptr) >= 8) {
-        hash += _mm_crc32_u64(hash, read_u64(ptr)); ptr += 8;
-        hash ^= rotate_right(hash, 33) * k1;
+        hash += PERL_CRC32C_U64(hash, metro_read_u64(ptr)); ptr += 8;
+        hash ^= metro_rotate_right(hash, 33) * k1;
     }
     if ((end - ptr) >= 4) {
-        hash ^= _mm_crc32_u64(hash, read_u32(ptr)); ptr += 4;
-        hash ^= rotate_right(hash, 15) * k1;
+        hash ^= PERL_CRC32C_U64(hash, metro_read_u32(ptr)); ptr += 4;
+        hash ^= metro_rotate_right(hash, 15) * k1;
     }
     if ((end - ptr) >= 2) {
-        hash ^= _mm_crc32_u64(hash, read_u16(ptr)); ptr += 2;
-        hash ^= rotate_right(hash, 13) * k1;
+        hash ^= PERL_CRC32C_U64(hash, metro_read_u16(ptr)); ptr += 2;
+        hash ^= metro_rotate_right(hash, 13) * k1;
     }
     if ((end - ptr) >= 1) {
-        hash ^= _mm_crc32_u64(hash, read_u8(ptr));
-        hash ^= rotate_right(hash, 25) * k1;
+        hash ^= PERL_CRC32C_U64(hash, metro_read_u8(ptr));
+        hash ^= metro_rotate_right(hash, 25) * k1;
     }
-    hash ^= rotate_right(hash, 33);
+    hash ^= metro_rotate_right(hash, 33);
     hash *= k0;
-    hash ^= rotate_right(hash, 33);
+    hash ^= metro_rotate_right(hash, 33);
 
     return (U32)hash;
 }
@@ -981,45 +1053,46 @@ S_perl_hash_metro64(const unsigned char * const seed, const unsigned char *str,
         v[3] = hash;
 
         do {
-            v[0] += read_u64(ptr) * k0; ptr += 8; v[0] = rotate_right(v[0],29) + v[2];
-            v[1] += read_u64(ptr) * k1; ptr += 8; v[1] = rotate_right(v[1],29) + v[3];
-            v[2] += read_u64(ptr) * k2; ptr += 8; v[2] = rotate_right(v[2],29) + v[0];
-            v[3] += read_u64(ptr) * k3; ptr += 8; v[3] = rotate_right(v[3],29) + v[1];
+            v[0] += metro_read_u64(ptr) * k0; ptr += 8; v[0] = metro_rotate_right(v[0],29) + v[2];
+            v[1] += metro_read_u64(ptr) * k1; ptr += 8; v[1] = metro_rotate_right(v[1],29) + v[3];
+            v[2] += metro_read_u64(ptr) * k2; ptr += 8; v[2] = metro_rotate_right(v[2],29) + v[0];
+            v[3] += metro_read_u64(ptr) * k3; ptr += 8; v[3] = metro_rotate_right(v[3],29) + v[1];
         } while (ptr <= (end - 32));
 
-        v[2] ^= rotate_right(((v[0] + v[3]) * k0) + v[1], 33) * k1;
-        v[3] ^= rotate_right(((v[1] + v[2]) * k1) + v[0], 33) * k0;
-        v[0] ^= rotate_right(((v[0] + v[2]) * k0) + v[3], 33) * k1;
-        v[1] ^= rotate_right(((v[1] + v[3]) * k1) + v[2], 33) * k0;
+        v[2] ^= metro_rotate_right(((v[0] + v[3]) * k0) + v[1], 33) * k1;
+        v[3] ^= metro_rotate_right(((v[1] + v[2]) * k1) + v[0], 33) * k0;
+        v[0] ^= metro_rotate_right(((v[0] + v[2]) * k0) + v[3], 33) * k1;
+        v[1] ^= metro_rotate_right(((v[1] + v[3]) * k1) + v[2], 33) * k0;
         hash += v[0] ^ v[1];
     }
     if ((end - ptr) >= 16) {
-        U64TYPE v0 = hash + (read_u64(ptr) * k0); ptr += 8; v0 = rotate_right(v0,33) * k1;
-        U64TYPE v1 = hash + (read_u64(ptr) * k1); ptr += 8; v1 = rotate_right(v1,33) * k2;
-        v0 ^= rotate_right(v0 * k0, 35) + v1;
-        v1 ^= rotate_right(v1 * k3, 35) + v0;
+        U64TYPE v0, v1;
+        v0 = hash + (metro_read_u64(ptr) * k0); ptr += 8; v0 = metro_rotate_right(v0,33) * k1;
+        v1 = hash + (metro_read_u64(ptr) * k1); ptr += 8; v1 = metro_rotate_right(v1,33) * k2;
+        v0 ^= metro_rotate_right(v0 * k0, 35) + v1;
+        v1 ^= metro_rotate_right(v1 * k3, 35) + v0;
         hash += v1;
     }
     if ((end - ptr) >= 8) {
-        hash += read_u64(ptr) * k3; ptr += 8;
-        hash ^= rotate_right(hash, 33) * k1;
+        hash += metro_read_u64(ptr) * k3; ptr += 8;
+        hash ^= metro_rotate_right(hash, 33) * k1;
     }
     if ((end - ptr) >= 4) {
-        hash += read_u32(ptr) * k3; ptr += 4;
-        hash ^= rotate_right(hash, 15) * k1;
+        hash += metro_read_u32(ptr) * k3; ptr += 4;
+        hash ^= metro_rotate_right(hash, 15) * k1;
     }
     if ((end - ptr) >= 2) {
-        hash += read_u16(ptr) * k3; ptr += 2;
-        hash ^= rotate_right(hash, 13) * k1;
+        hash += metro_read_u16(ptr) * k3; ptr += 2;
+        hash ^= metro_rotate_right(hash, 13) * k1;
     }
     if ((end - ptr) >= 1) {
-        hash += read_u8 (ptr) * k3;
-        hash ^= rotate_right(hash, 25) * k1;
+        hash += metro_read_u8 (ptr) * k3;
+        hash ^= metro_rotate_right(hash, 25) * k1;
     }
 
-    hash ^= rotate_right(hash, 33);
+    hash ^= metro_rotate_right(hash, 33);
     hash *= k0;
-    hash ^= rotate_right(hash, 33);
+    hash ^= metro_rotate_right(hash, 33);
 
     return (U32)hash;
 }
@@ -1111,6 +1184,11 @@ S_perl_hash_spooky32(const unsigned char * const seed, const unsigned char *str,
         U64TYPE  *p64; 
         size_t    i; 
     } u;
+    size_t remainder = len%32;
+    U64TYPE a = *hash1;
+    U64TYPE b = *hash2;
+    U64TYPE c = sc_const;
+    U64TYPE d = sc_const;
 
     u.p8 = (const U8 *)str;
 
@@ -1120,12 +1198,6 @@ S_perl_hash_spooky32(const unsigned char * const seed, const unsigned char *str,
         u.p64 = buf;
     }
 
-    size_t remainder = len%32;
-    U64TYPE a = *hash1;
-    U64TYPE b = *hash2;
-    U64TYPE c = sc_const;
-    U64TYPE d = sc_const;
-
     if (len > 15)
     {
         const U64TYPE *end = u.p64 + (len/32)*4;
@@ -1201,6 +1273,25 @@ S_perl_hash_spooky32(const unsigned char * const seed, const unsigned char *str,
 }
 #endif
 
+#ifdef PERL_HASH_FUNC_SELECT
+/* the guards above only selected the bodies, the function in use is
+   PL_hash_func. Keep -V and the extensions from seeing all of them. */
+#   undef PERL_HASH_FUNC_SUPERFAST
+#   undef PERL_HASH_FUNC_MURMUR3
+#   undef PERL_HASH_FUNC_DJB2
+#   undef PERL_HASH_FUNC_SDBM
+#   undef PERL_HASH_FUNC_ONE_AT_A_TIME
+#   undef PERL_HASH_FUNC_ONE_AT_A_TIME_HARD
+#   undef PERL_HASH_FUNC_FNV1A
+#   undef PERL_HASH_FUNC_FNV1A_YOSHIMITSUTRIAD
+#   undef PERL_HASH_FUNC_CRC32
+#   undef PERL_HASH_FUNC_SIPHASH
+#   undef PERL_HASH_FUNC_MURMUR64A
+#   undef PERL_HASH_FUNC_MURMUR64B
+#   undef PERL_HASH_FUNC_METRO64CRC
+#   undef PERL_HASH_FUNC_METRO64
+#   undef PERL_HASH_FUNC_SPOOKY32
+#endif
 
 /* legacy - only mod_perl should be doing this. */
 #ifdef PERL_HASH_INTERNAL_ACCESS
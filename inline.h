@@ -1031,7 +1031,11 @@ Perl_is_utf8_string_loclen(const U8 *s, STRLEN len, const U8 **ep, STRLEN *el)
         STRLEN outlen = first_variant - s;
 
         while (x < send) {
-            const STRLEN cur_len = isUTF8_CHAR(x, send);
+            STRLEN cur_len;
+            x = _utf8_valid_prefix(x, send, &outlen, 0);
+            if (x == send)
+                break;
+            cur_len = isUTF8_CHAR(x, send);
             if (UNLIKELY(! cur_len)) {
                 break;
             }
@@ -1308,7 +1312,11 @@ S_is_strict_utf8_string_loclen(const U8 *s, STRLEN len, const U8 **ep, STRLEN *e
         STRLEN outlen = first_variant - s;
 
         while (x < send) {
-            const STRLEN cur_len = isSTRICT_UTF8_CHAR(x, send);
+            STRLEN cur_len;
+            x = _utf8_valid_prefix(x, send, &outlen, UTF8_DISALLOW_NONCHAR);
+            if (x == send)
+                break;
+            cur_len = isSTRICT_UTF8_CHAR(x, send);
             if (UNLIKELY(! cur_len)) {
                 break;
             }
@@ -1385,7 +1393,11 @@ S_is_c9strict_utf8_string_loclen(const U8 *s, STRLEN len, const U8 **ep, STRLEN
         STRLEN outlen = first_variant - s;
 
         while (x < send) {
-            const STRLEN cur_len = isC9_STRICT_UTF8_CHAR(x, send);
+            STRLEN cur_len;
+            x = _utf8_valid_prefix(x, send, &outlen, 0);
+            if (x == send)
+                break;
+            cur_len = isC9_STRICT_UTF8_CHAR(x, send);
             if (UNLIKELY(! cur_len)) {
                 break;
             }
@@ -1485,7 +1497,11 @@ S_is_utf8_string_loclen_flags(const U8 *s, STRLEN len, const U8 **ep, STRLEN *el
         STRLEN outlen = first_variant - s;
 
         while (x < send) {
-            const STRLEN cur_len = isUTF8_CHAR_flags(x, send, flags);
+            STRLEN cur_len;
+            x = _utf8_valid_prefix(x, send, &outlen, flags);
+            if (x == send)
+                break;
+            cur_len = isUTF8_CHAR_flags(x, send, flags);
             if (UNLIKELY(! cur_len)) {
                 break;
             }
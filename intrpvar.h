@@ -810,11 +810,14 @@ PERLVARA(I, op_exec_cnt, OP_max+2, UV)	/* Counts of executed OPs of the given ty
                                            DEBUGGING is enabled, too. */
 #endif
 
+#ifdef PERL_JIT
+PERLVARI(I, jit_code,	struct jit_code *, NULL) /* compiled loops, in run.c */
+#endif
+
 PERLVAR(I, random_state, PL_RANDOM_STATE_TYPE)
 
 #ifdef DEBUGGING
 PERLVARI(I, max_refcnt, UV, 0)		/* Highest SvREFCNT */
-PERLVARI(I, max_cowrefcnt, UV, 0)	/* Highest CowREFCNT */
 PERLVARI(I, max_refcnt_sv, SV*, NULL)	/* SV with highest SvREFCNT */
 PERLVARI(I, count_null_ops, UV, 0)	/* Number of optimized away NULL ops */
 #endif
@@ -834,6 +837,18 @@ PERLVARI(I, hash_slowdos, U16, 0)       /* Number of concurrent hash DoS attacks
 
 PERLVAR(I, internal_random_state, PL_RANDOM_STATE_TYPE)
 
+/* inline cache of the constant key hash element ops, see hv_fetch_icache */
+PERLVARA(I, hv_icache, PERL_HV_ICACHE_SIZE, struct hv_icache)
+
+/* hsplit calls and the entries they rehashed, see hv_bucket_stats */
+PERLVARI(I, hv_splits, UV, 0)
+PERLVARI(I, hv_split_entries, UV, 0)
+
+/* Highest CowREFCNT, and the string copies because a COW buffer had
+   already SV_COW_REFCNT_MAX copies */
+PERLVARI(I, max_cowrefcnt, UV, 0)
+PERLVARI(I, cowrefcnt_capped, UV, 0)
+
 /* If you are adding a U8 or U16, check to see if there are 'Space' comments
  * above on where there are gaps which currently will be structure padding.  */
 
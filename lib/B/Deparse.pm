@@ -73,7 +73,7 @@ use B qw(main_root main_start main_cv svref_2object opnumber perlstring
         SIGNATURE_SHIFT
     );
 
-$VERSION = '1.49_05c';
+$VERSION = '1.49_06c';
 $VERSION =~ s/c$//;
 use strict;
 our $AUTOLOAD;
@@ -1582,7 +1582,7 @@ sub is_scope {
 
 sub is_state {
     my $name = $_[0]->name;
-    return $name eq "nextstate" || $name eq "dbstate" || $name eq "setstate";
+    return $name eq "nextstate" || $name eq "dbstate";
 }
 
 sub is_miniwhile { # check for one-line loop ('foo() while $y--')
@@ -2433,7 +2433,13 @@ sub hint_pragmas {
 }
 
 sub pp_dbstate { pp_nextstate(@_) }
-sub pp_setstate { pp_nextstate(@_) }
+
+# an inlined sub call keeps the original call as first kid
+sub pp_enterinline {
+    my $self = shift;
+    my($op, $cx) = @_;
+    return $self->deparse($op->first, $cx);
+}
 
 sub pp_unstack { return "" } # see also leaveloop
 
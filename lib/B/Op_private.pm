@@ -132,7 +132,7 @@ $bits{$_}{3} = 'OPpFT_STACKING' for qw(ftatime ftbinary ftblk ftchr ftctime ftdi
 $bits{$_}{1} = 'OPpGREP_LEX' for qw(grepstart grepwhile mapstart mapwhile);
 $bits{$_}{4} = 'OPpHASHPAIRS' for qw(mapwhile padav rv2av);
 $bits{$_}{1} = 'OPpHINT_STRICT_REFS' for qw(enterffi entersub enterxssub multideref rv2av rv2cv rv2gv rv2hv rv2sv);
-$bits{$_}{5} = 'OPpHUSH_VMSISH' for qw(dbstate keepstate nextstate setstate);
+$bits{$_}{5} = 'OPpHUSH_VMSISH' for qw(dbstate nextstate);
 $bits{$_}{6} = 'OPpINDEX_BOOLNEG' for qw(index rindex);
 $bits{$_}{1} = 'OPpITER_REVERSED' for qw(enteriter iter);
 $bits{$_}{7} = 'OPpLVALUE' for qw(leave leaveloop);
@@ -199,6 +199,13 @@ my @bf = (
         bitmax    => 3,
         bitmask   => 15,
     },
+    {
+        label     => 'args',
+        mask_def  => 'OPpINLINE_ARGSMASK',
+        bitmin    => 0,
+        bitmax    => 6,
+        bitmask   => 127,
+    },
     {
         label     => 'range',
         mask_def  => 'OPpPADRANGE_COUNTMASK',
@@ -243,11 +250,11 @@ $bits{abs}{0} = $bf[0];
 @{$bits{accept}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
 @{$bits{add}}{1,0} = ($bf[1], $bf[1]);
 $bits{aeach}{0} = $bf[0];
-@{$bits{aelem}}{5,4,1,0} = ($bf[7], $bf[7], $bf[1], $bf[1]);
+@{$bits{aelem}}{5,4,1,0} = ($bf[8], $bf[8], $bf[1], $bf[1]);
 @{$bits{aelem_u}}{1,0} = ($bf[1], $bf[1]);
-@{$bits{aelemfast}}{7,6,5,4,3,2,1,0} = ($bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6]);
-@{$bits{aelemfast_lex}}{7,6,5,4,3,2,1,0} = ($bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6]);
-@{$bits{aelemfast_lex_u}}{7,6,5,4,3,2,1,0} = ($bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6]);
+@{$bits{aelemfast}}{7,6,5,4,3,2,1,0} = ($bf[7], $bf[7], $bf[7], $bf[7], $bf[7], $bf[7], $bf[7], $bf[7]);
+@{$bits{aelemfast_lex}}{7,6,5,4,3,2,1,0} = ($bf[7], $bf[7], $bf[7], $bf[7], $bf[7], $bf[7], $bf[7], $bf[7]);
+@{$bits{aelemfast_lex_u}}{7,6,5,4,3,2,1,0} = ($bf[7], $bf[7], $bf[7], $bf[7], $bf[7], $bf[7], $bf[7], $bf[7]);
 $bits{akeys}{0} = $bf[0];
 $bits{alarm}{0} = $bf[0];
 $bits{and}{0} = $bf[0];
@@ -297,14 +304,15 @@ $bits{dorassign}{0} = $bf[0];
 $bits{dump}{0} = $bf[0];
 $bits{each}{0} = $bf[0];
 @{$bits{entereval}}{5,4,3,2,1,0} = ('OPpEVAL_RE_REPARSING', 'OPpEVAL_COPHH', 'OPpEVAL_BYTES', 'OPpEVAL_UNICODE', 'OPpEVAL_HAS_HH', $bf[0]);
-@{$bits{enterffi}}{5,4} = ($bf[7], $bf[7]);
+@{$bits{enterffi}}{5,4} = ($bf[8], $bf[8]);
 $bits{entergiven}{0} = $bf[0];
+@{$bits{enterinline}}{6,5,4,3,2,1,0} = ($bf[5], $bf[5], $bf[5], $bf[5], $bf[5], $bf[5], $bf[5]);
 $bits{enteriter}{3} = 'OPpITER_DEF';
-@{$bits{entersub}}{5,4} = ($bf[7], $bf[7]);
+@{$bits{entersub}}{5,4} = ($bf[8], $bf[8]);
 $bits{entertry}{0} = $bf[0];
 $bits{enterwhen}{0} = $bf[0];
 @{$bits{enterwrite}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
-@{$bits{enterxssub}}{5,4} = ($bf[7], $bf[7]);
+@{$bits{enterxssub}}{5,4} = ($bf[8], $bf[8]);
 @{$bits{eof}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
 @{$bits{eq}}{1,0} = ($bf[1], $bf[1]);
 @{$bits{exec}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
@@ -372,7 +380,7 @@ $bits{grepwhile}{0} = $bf[0];
 @{$bits{gsockopt}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
 @{$bits{gt}}{1,0} = ($bf[1], $bf[1]);
 @{$bits{gv}}{6,5} = ('OPpGV_WASMETHOD', 'OPpEARLY_CV');
-@{$bits{helem}}{5,4,1,0} = ($bf[7], $bf[7], $bf[1], $bf[1]);
+@{$bits{helem}}{5,4,1,0} = ($bf[8], $bf[8], $bf[1], $bf[1]);
 $bits{hex}{0} = $bf[0];
 @{$bits{i_add}}{1,0} = ($bf[1], $bf[1]);
 @{$bits{i_aelem}}{1,0} = ($bf[1], $bf[1]);
@@ -414,6 +422,7 @@ $bits{lcfirst}{0} = $bf[0];
 $bits{leave}{5} = 'OPpLEAVE_SP';
 $bits{leaveeval}{0} = $bf[0];
 $bits{leavegiven}{0} = $bf[0];
+@{$bits{leaveinline}}{7,6,5,4,3,2,1,0} = ('OPpINLINE_INARGS', $bf[5], $bf[5], $bf[5], $bf[5], $bf[5], $bf[5], $bf[5]);
 @{$bits{leaveloop}}{1,0} = ($bf[1], $bf[1]);
 $bits{leavesub}{0} = $bf[0];
 $bits{leavesublv}{0} = $bf[0];
@@ -431,7 +440,7 @@ $bits{log}{0} = $bf[0];
 $bits{lstat}{0} = $bf[0];
 @{$bits{lt}}{1,0} = ($bf[1], $bf[1]);
 $bits{lvavref}{0} = $bf[0];
-@{$bits{lvref}}{5,4,0} = ($bf[8], $bf[8], $bf[0]);
+@{$bits{lvref}}{5,4,0} = ($bf[9], $bf[9], $bf[0]);
 $bits{mapstart}{0} = $bf[0];
 @{$bits{mapwhile}}{2,0} = ('OPpMAP_HASH', $bf[0]);
 $bits{method}{0} = $bf[0];
@@ -456,7 +465,7 @@ $bits{next}{0} = $bf[0];
 $bits{not}{0} = $bf[0];
 $bits{oct}{0} = $bf[0];
 @{$bits{oelem}}{1,0} = ($bf[1], $bf[1]);
-@{$bits{oelemfast}}{7,6,5,4,3,2,1,0} = ($bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6]);
+@{$bits{oelemfast}}{7,6,5,4,3,2,1,0} = ($bf[7], $bf[7], $bf[7], $bf[7], $bf[7], $bf[7], $bf[7], $bf[7]);
 $bits{once}{0} = $bf[0];
 @{$bits{open}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
 @{$bits{open_dir}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
@@ -465,8 +474,8 @@ $bits{orassign}{0} = $bf[0];
 $bits{ord}{0} = $bf[0];
 @{$bits{pack}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
 $bits{padhv}{0} = 'OPpPADHV_ISKEYS';
-@{$bits{padrange}}{6,5,4,3,2,1,0} = ($bf[5], $bf[5], $bf[5], $bf[5], $bf[5], $bf[5], $bf[5]);
-@{$bits{padsv}}{5,4} = ($bf[7], $bf[7]);
+@{$bits{padrange}}{6,5,4,3,2,1,0} = ($bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6], $bf[6]);
+@{$bits{padsv}}{5,4} = ($bf[8], $bf[8]);
 @{$bits{pipe_op}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
 $bits{pop}{0} = $bf[0];
 $bits{pos}{0} = $bf[0];
@@ -487,7 +496,7 @@ $bits{readlink}{0} = $bf[0];
 @{$bits{recv}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
 $bits{redo}{0} = $bf[0];
 $bits{ref}{0} = $bf[0];
-@{$bits{refassign}}{5,4,1,0} = ($bf[8], $bf[8], $bf[1], $bf[1]);
+@{$bits{refassign}}{5,4,1,0} = ($bf[9], $bf[9], $bf[1], $bf[1]);
 $bits{refgen}{0} = $bf[0];
 $bits{regcmaybe}{0} = $bf[0];
 $bits{regcomp}{0} = $bf[0];
@@ -503,9 +512,9 @@ $bits{rewinddir}{0} = $bf[0];
 $bits{rmdir}{0} = $bf[0];
 $bits{rv2av}{0} = $bf[0];
 @{$bits{rv2cv}}{7,5,0} = ('OPpENTERSUB_NOPAREN', 'OPpMAY_RETURN_CONSTANT', $bf[0]);
-@{$bits{rv2gv}}{6,5,4,2,0} = ('OPpALLOW_FAKE', $bf[7], $bf[7], 'OPpDONT_INIT_GV', $bf[0]);
+@{$bits{rv2gv}}{6,5,4,2,0} = ('OPpALLOW_FAKE', $bf[8], $bf[8], 'OPpDONT_INIT_GV', $bf[0]);
 $bits{rv2hv}{0} = 'OPpRV2HV_ISKEYS';
-@{$bits{rv2sv}}{5,4,2,0} = ($bf[7], $bf[7], 'OPpHINT_STRICT_NAMES', $bf[0]);
+@{$bits{rv2sv}}{5,4,2,0} = ($bf[8], $bf[8], 'OPpHINT_STRICT_NAMES', $bf[0]);
 @{$bits{s_aelem}}{1,0} = ($bf[1], $bf[1]);
 @{$bits{s_aelem_u}}{1,0} = ($bf[1], $bf[1]);
 @{$bits{s_bit_and}}{1,0} = ($bf[1], $bf[1]);
@@ -583,7 +592,7 @@ $bits{ucfirst}{0} = $bf[0];
 @{$bits{umask}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
 $bits{undef}{0} = $bf[0];
 @{$bits{unlink}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
-@{$bits{unpack}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
+@{$bits{unpack}}{4,3,2,1,0} = ('OPpUNPACK_ASSIGN', $bf[4], $bf[4], $bf[4], $bf[4]);
 @{$bits{unshift}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
 $bits{untie}{0} = $bf[0];
 @{$bits{utime}}{3,2,1,0} = ($bf[4], $bf[4], $bf[4], $bf[4]);
@@ -647,6 +656,8 @@ our %defines = (
     OPpHINT_STRICT_REFS      =>   2,
     OPpHUSH_VMSISH           =>  32,
     OPpINDEX_BOOLNEG         =>  64,
+    OPpINLINE_ARGSMASK       => 127,
+    OPpINLINE_INARGS         => 128,
     OPpITER_DEF              =>   8,
     OPpITER_REVERSED         =>   2,
     OPpKVSLICE               =>  32,
@@ -712,6 +723,7 @@ our %defines = (
     OPpTRANS_SQUASH          =>   8,
     OPpTRANS_TO_UTF          =>   2,
     OPpTRUEBOOL              =>  32,
+    OPpUNPACK_ASSIGN         =>  16,
 );
 
 our %labels = (
@@ -761,6 +773,7 @@ our %labels = (
     OPpHINT_STRICT_REFS      => 'STRICT',
     OPpHUSH_VMSISH           => 'HUSH',
     OPpINDEX_BOOLNEG         => 'NEG',
+    OPpINLINE_INARGS         => 'INARGS',
     OPpITER_DEF              => 'DEF',
     OPpITER_REVERSED         => 'REVERSED',
     OPpKVSLICE               => 'KVSLICE',
@@ -823,6 +836,7 @@ our %labels = (
     OPpTRANS_SQUASH          => 'SQUASH',
     OPpTRANS_TO_UTF          => '>UTF',
     OPpTRUEBOOL              => 'BOOL',
+    OPpUNPACK_ASSIGN         => 'ASSIGN',
 );
 
 
@@ -846,8 +860,9 @@ our %ops_using = (
     OPpHASHPAIRS             => [qw(mapwhile padav rv2av)],
     OPpHINT_STRICT_NAMES     => [qw(rv2sv)],
     OPpHINT_STRICT_REFS      => [qw(enterffi entersub enterxssub multideref rv2av rv2cv rv2gv rv2hv rv2sv)],
-    OPpHUSH_VMSISH           => [qw(dbstate keepstate nextstate setstate)],
+    OPpHUSH_VMSISH           => [qw(dbstate nextstate)],
     OPpINDEX_BOOLNEG         => [qw(index rindex)],
+    OPpINLINE_INARGS         => [qw(leaveinline)],
     OPpITER_DEF              => [qw(enteriter)],
     OPpITER_REVERSED         => [qw(enteriter iter)],
     OPpKVSLICE               => [qw(delete)],
@@ -882,6 +897,7 @@ our %ops_using = (
     OPpTARGET_MY             => [qw(abs add atan2 chdir chmod chomp chown chr chroot concat cos crypt divide exec exp flock getpgrp getppid getpriority hex i_add i_bit_and i_bit_or i_bit_xor i_complement i_divide i_modulo i_multiply i_pow i_subtract index int kill left_shift length link log match mkdir modulo multiconcat multiply oct ord pow push qr rand rename right_shift rindex rmdir s_complement schomp setpgrp setpriority sin sleep sqrt srand stringify subst subtract symlink system time trans transr u_add u_multiply u_subtract unlink unshift utime wait waitpid)],
     OPpTRANS_COMPLEMENT      => [qw(trans transr)],
     OPpTRUEBOOL              => [qw(grepwhile index length padav padhv pos ref rindex rv2av rv2hv subst)],
+    OPpUNPACK_ASSIGN         => [qw(unpack)],
 );
 
 $ops_using{OPpASSIGN_COMMON_RC1} = $ops_using{OPpASSIGN_COMMON_AGG};
@@ -0,0 +1,197 @@
+# This file was created by configpm when Perl was built. Any changes
+# made to this file will be lost the next time perl is built.
+
+package Config;
+use strict;
+use warnings;
+our %Config;
+
+sub bincompat_options {
+    return split ' ', (Internals::V())[0];
+}
+
+sub non_bincompat_options {
+    return split ' ', (Internals::V())[1];
+}
+
+sub compile_date {
+    return (Internals::V())[2]
+}
+
+sub local_patches {
+    my (undef, undef, undef, @patches) = Internals::V();
+    return @patches;
+}
+
+sub _V {
+    die "Perl lib was built for 'linux' but is being run on '$^O'"
+        unless "linux" eq $^O;
+
+    my ($bincompat, $non_bincompat, $date, @patches) = Internals::V();
+
+    my $opts = join ' ', sort split ' ', "$bincompat $non_bincompat";
+
+    # wrap at 76 columns.
+
+    $opts =~ s/(?=.{53})(.{1,53}) /$1\n                        /mg;
+
+    print Config::myconfig();
+    print "\nCharacteristics of this binary (from libperl): \n";
+
+    print "  Compile-time options: $opts\n";
+
+    if (@patches) {
+        print "  Locally applied patches:\n";
+        print "\t$_\n" foreach @patches;
+    }
+
+    print "  Built under linux\n";
+
+    print "  $date\n" if defined $date;
+
+    my @env = map { "$_=\"$ENV{$_}\"" } sort grep {/^PERL/} keys %ENV;
+
+    if (@env) {
+        print "  \%ENV:\n";
+        print "    $_\n" foreach @env;
+    }
+    print "  \@INC:\n";
+    print "    $_\n" foreach @INC;
+}
+
+sub header_files {
+    return qw(EXTERN.h INTERN.h XSUB.h av.h config.h cop.h cv.h
+              dosish.h embed.h embedvar.h form.h gv.h handy.h hv.h hv_func.h
+              intrpvar.h iperlsys.h keywords.h mg.h nostdio.h op.h opcode.h
+              pad.h parser.h patchlevel.h perl.h perlio.h perliol.h perlsdio.h
+              perlvars.h perly.h pp.h pp_proto.h proto.h regcomp.h regexp.h
+              regnodes.h scope.h sv.h thread.h time64.h unixish.h utf8.h
+              util.h);
+}
+
+##
+## This file was produced by running the Configure script. It holds all the
+## definitions figured out by Configure. Should you modify one of these values,
+## do not forget to propagate your changes by running "Configure -der". You may
+## instead choose to run each of the .SH files by yourself, or "Configure -S".
+##
+#
+## Package name      : cperl
+## Source directory  : .
+## Configuration time: Sat Oct 17 10:23:34 UTC 2026
+## Configured by     : root
+## Target system     : linux vm 6.18.44-fc-v139 #1 smp preempt_dynamic @0 x86_64 gnulinux 
+#
+#: Configure command line arguments.
+#
+#: Variables propagated from previous config.sh file.
+
+our $summary = <<'!END!';
+Summary of my $package (revision $revision $version_patchlevel_string) configuration:
+  $git_commit_id_title $git_commit_id$git_ancestor_line $git_describe
+    git_branch=$git_branch
+  Platform:
+    osname=$osname, osvers=$osvers, archname=$archname
+    uname='$myuname'
+    config_args='$config_args'
+    hint=$hint, useposix=$useposix, d_sigaction=$d_sigaction
+    useithreads=$useithreads, usemultiplicity=$usemultiplicity
+    use64bitint=$use64bitint, use64bitall=$use64bitall, uselongdouble=$uselongdouble
+    usemymalloc=$usemymalloc, bincompat5005=undef default_inc_excludes_dot=$default_inc_excludes_dot
+  Compiler:
+    cc='$cc', ccflags ='$ccflags',
+    optimize='$optimize',
+    cppflags='$cppflags'
+    ccversion='$ccversion', gccversion='$gccversion', gccosandvers='$gccosandvers'
+    intsize=$intsize, longsize=$longsize, ptrsize=$ptrsize, doublesize=$doublesize, byteorder=$byteorder, doublekind=$doublekind
+    d_longlong=$d_longlong, longlongsize=$longlongsize, d_longdbl=$d_longdbl, longdblsize=$longdblsize, longdblkind=$longdblkind
+    ivtype='$ivtype', ivsize=$ivsize, nvtype='$nvtype', nvsize=$nvsize, Off_t='$lseektype', lseeksize=$lseeksize
+    alignbytes=$alignbytes
+  Linker and Libraries:
+    ld='$ld', ldflags ='$ldflags'
+    libpth=$libpth
+    libs=$libs
+    perllibs=$perllibs
+    libc=$libc, so=$so, useshrplib=$useshrplib, libperl=$libperl
+    gnulibc_version='$gnulibc_version'
+  Dynamic Linking:
+    dlsrc=$dlsrc, dlext=$dlext, d_dlsymun=$d_dlsymun, ccdlflags='$ccdlflags'
+    cccdlflags='$cccdlflags', lddlflags='$lddlflags'
+
+!END!
+my $summary_expanded;
+
+sub myconfig {
+    return $summary_expanded if $summary_expanded;
+    ($summary_expanded = $summary) =~ s{\$(\w+)}
+		 { 
+			my $c;
+			if ($1 eq 'git_ancestor_line') {
+				if ($Config::Config{git_ancestor}) {
+					$c= "\n  Ancestor: $Config::Config{git_ancestor}";
+				} else {
+					$c= "";
+				}
+			} else {
+                     		$c = $Config::Config{$1}; 
+			}
+			defined($c) ? $c : 'undef' 
+		}ge;
+    $summary_expanded;
+}
+
+sub STORE  { die "\%Config::Config is read-only\n" }
+*DELETE = *CLEAR = \*STORE; # Typeglob aliasing uses less space
+
+sub config_sh {
+    my $s = ' ' x 32000; # prealloc 32.000 byte, I got 33568
+    $s = '';
+    for my $k (sort &Config::KEYS) { # XXX sort Config::KEYS() is broken
+        my $v = Config->FETCH($k);
+        $s .= defined $v ? "$k='$v'\n" : "$k=''\n";
+    }
+    $s
+}
+
+sub config_re {
+    my $re = shift or return ();
+    my @s;
+    for my $k (sort &Config::KEYS) {
+       if (eval { $k =~ /^(?:$re)/ }) {
+            my $v = Config->FETCH($k);
+            push @s, defined $v ? "$k='$v'" : "$k=''";
+        }
+    }
+    sort @s
+}
+
+sub config_vars {
+    # implements -V:cfgvar option (see perlrun -V:)
+    foreach (@_) {
+	# find optional leading, trailing colons; and query-spec
+	my ($notag,$qry,$lncont) = m/^(:)?(.*?)(:)?$/;	# flags fore and aft, 
+	# map colon-flags to print decorations
+	my $prfx = $notag ? '': "$qry=";		# tag-prefix for print
+	my $lnend = $lncont ? ' ' : ";\n";		# line ending for print
+
+	# all config-vars are by definition \w only, any \W means regex
+	if ($qry =~ /\W/) {
+	    my @matches = config_re($qry);
+	    print map "$_$lnend", @matches ? @matches : "$qry: not found"		if !$notag;
+	    print map { s/\w+=//; "$_$lnend" } @matches ? @matches : "$qry: not found"	if  $notag;
+	} else {
+	    my $v = (exists $Config::Config{$qry}) ? $Config::Config{$qry}
+						   : 'UNKNOWN';
+	    $v = 'undef' unless defined $v;
+	    print "${prfx}'${v}'$lnend";
+	}
+    }
+}
+
+# Called by the real AUTOLOAD
+sub launcher {
+    undef &AUTOLOAD;
+    goto \&$Config::AUTOLOAD;
+}
+
+1;
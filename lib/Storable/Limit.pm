@@ -0,0 +1,6 @@
+# Overridable current limits bisected by stacksize. See also stacksize.h
+$Storable::recursion_limit = 10461
+  unless defined $Storable::recursion_limit;
+$Storable::recursion_limit_hash = 6276
+  unless defined $Storable::recursion_limit_hash;
+1;
@@ -1,5 +1,5 @@
-package cperl;
-our $VERSION = "0.01";
+package inline;
+our $VERSION = "0.02";
 
 sub import {
     delete $^H{'inline'};
@@ -22,11 +22,33 @@ inline - Perl pragma to disable inlining
 
 =head1 DESCRIPTION
 
-The cperl variant enables function inlining per default for all inlinable
-functions.
+cperl inlines calls to small subroutines per default. A call like
+C<add($x, 1)> or C<get($obj)> is replaced by a guarded copy of the body
+of the called sub, when it was already defined at compile-time and
 
-With no inline you can disable this feature lexically.
+=over
 
-See L<perlcperl>
+=item has a signature, or a C<my(...) = @_> fake signature, with only
+mandatory untyped scalar params,
+
+=item its body is a single expression of max. 10 pure ops, like
+arithmetic, comparisons, bit ops and numeric functions, on the params
+and constants, or a single hash or array element access of a param,
+like C<< $self->{field} >> or C<< $_[0]->[2] >>,
+
+=item and it is no method, lvalue sub or closure.
+
+=back
+
+At run-time the original call is done instead, when the sub was
+redefined meanwhile, the args are tied or overloaded, or when
+C<$SIG{__WARN__}> or C<$SIG{__DIE__}> handlers are set.
+Warnings and errors report the same file and lines as the call.
+
+With C<no inline> you can disable this feature lexically, e.g. for code
+inspecting the C<caller()> frames, or for profilers.
+The perl debugger disables inlining.
+
+See L<perlcperl/"Inlined functions">
 
 =cut
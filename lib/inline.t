@@ -1,7 +1,7 @@
 #!./perl
 
 my $i=1;
-print "1..20\n";
+print "1..46\n";
 
 sub x1 { shift; 1 }    # inlined
 sub x2 { $_[0] = 1; }  # call-by-ref, not yet
@@ -37,3 +37,89 @@ print x4 != 1  ? "not ":"", "ok ",$i++,"\n";
   print x3(2) != 0  ? "not ":"", "ok ",$i++,"\n";
   print x4 != 1  ? "not ":"", "ok ",$i++,"\n";
 }
+
+# signature subs, inlined into the callers below
+use B ();
+sub add ($x, $y) { $x + $y }
+sub mul { my ($x, $y) = @_; $x * $y }
+sub dbl ($x) { return $x * 2 }
+sub neg ($x) { !$x }
+sub div ($x, $y) { $x / $y }
+sub get ($s) { $s->{f} }
+sub third ($s) { $s->[2] }
+sub opt ($x, $y=1) { $x + $y }     # optional arg, not
+sub lv ($x) :lvalue { $x }          # lvalue, not
+
+for (qw(add mul dbl neg div get third)) {
+  print B::svref_2object(\&$_)->CvFLAGS & B::CVf_INLINABLE
+    ? "" : "not ", "ok ", $i++, " # $_ inlinable\n";
+}
+for (qw(opt lv)) {
+  print B::svref_2object(\&$_)->CvFLAGS & B::CVf_INLINABLE
+    ? "not " : "", "ok ", $i++, " # $_ not inlinable\n";
+}
+
+my ($b, $h) = (3, { f => "field" });
+print add($b, 4) != 7   ? "not ":"", "ok ",$i++,"\n";
+print mul($b, 4) != 12  ? "not ":"", "ok ",$i++,"\n";
+print dbl(2.5) != 5     ? "not ":"", "ok ",$i++,"\n";
+print get($h) ne "field" ? "not ":"", "ok ",$i++,"\n";
+print third([1..3]) != 3 ? "not ":"", "ok ",$i++,"\n";
+my @one = (1);
+eval { &add(@one) };
+print $@ !~ /^Not enough arguments for subroutine add\. Want: 2, but got: 1/ ? "not ":"", "ok ",$i++,"\n";
+
+# errors report the line of the sub
+my $line;
+open my $fh, '<', $0 or die "$0: $!";
+while (<$fh>) { $line = $., last if /^sub div / }
+close $fh;
+eval { div(1, 0) };
+print $@ ne "Illegal division by zero at $0 line $line.\n" ? "not ":"", "ok ",$i++,"\n";
+
+# results are copies
+my $r = \ neg(1);
+eval { $$r = 2 };
+print $@ || $$r != 2 ? "not ":"", "ok ",$i++,"\n";
+my @a = map { add($_, 1) } 1..3;
+print "@a" ne "2 3 4" ? "not ":"", "ok ",$i++,"\n";
+
+# args are released when leaving
+my $destroyed = 0;
+sub D::DESTROY { $destroyed++ }
+{ my $o = bless {f => 1}, 'D'; get($o); }
+print $destroyed != 1 ? "not ":"", "ok ",$i++,"\n";
+
+# tied and overloaded args are passed to the sub
+{
+  package T; sub TIESCALAR { bless [] } sub FETCH { 2 }
+  package O; use overload '+' => sub { 42 }, fallback => 1;
+}
+tie my $t, 'T';
+print add($t, 1) != 3 ? "not ":"", "ok ",$i++,"\n";
+print add(bless([], 'O'), 1) != 42 ? "not ":"", "ok ",$i++,"\n";
+
+# redefinition
+sub call_add { add($_[0], $_[1]) }
+{
+  no warnings 'redefine';
+  *add = sub { $_[0] - $_[1] };
+  print call_add(5, 3) != 2 ? "not ":"", "ok ",$i++,"\n";
+  eval 'sub add ($x, $y) { $x * $y }';
+  print call_add(5, 3) != 15 ? "not ":"", "ok ",$i++,"\n";
+  undef &add;
+  eval { call_add(5, 3) };
+  print $@ !~ /^Undefined subroutine &main::add called/ ? "not ":"", "ok ",$i++,"\n";
+}
+
+# caller in die handlers sees the sub
+{
+  my $caller;
+  local $SIG{__DIE__} = sub { $caller = (caller 1)[3] };
+  eval { div(1, 0) };
+  print $caller ne "main::div" ? "not ":"", "ok ",$i++,"\n";
+}
+{
+  no inline;
+  print get($h) ne "field" ? "not ":"", "ok ",$i++,"\n";
+}
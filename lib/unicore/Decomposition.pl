@@ -0,0 +1,5708 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+A0		<noBreak> 0020
+A8		<compat> 0020 0308
+AA		<super> 0061
+AF		<compat> 0020 0304
+B2		<super> 0032
+B3		<super> 0033
+B4		<compat> 0020 0301
+B5		<compat> 03BC
+B8		<compat> 0020 0327
+B9		<super> 0031
+BA		<super> 006F
+BC		<fraction> 0031 2044 0034
+BD		<fraction> 0031 2044 0032
+BE		<fraction> 0033 2044 0034
+C0		0041 0300
+C1		0041 0301
+C2		0041 0302
+C3		0041 0303
+C4		0041 0308
+C5		0041 030A
+C7		0043 0327
+C8		0045 0300
+C9		0045 0301
+CA		0045 0302
+CB		0045 0308
+CC		0049 0300
+CD		0049 0301
+CE		0049 0302
+CF		0049 0308
+D1		004E 0303
+D2		004F 0300
+D3		004F 0301
+D4		004F 0302
+D5		004F 0303
+D6		004F 0308
+D9		0055 0300
+DA		0055 0301
+DB		0055 0302
+DC		0055 0308
+DD		0059 0301
+E0		0061 0300
+E1		0061 0301
+E2		0061 0302
+E3		0061 0303
+E4		0061 0308
+E5		0061 030A
+E7		0063 0327
+E8		0065 0300
+E9		0065 0301
+EA		0065 0302
+EB		0065 0308
+EC		0069 0300
+ED		0069 0301
+EE		0069 0302
+EF		0069 0308
+F1		006E 0303
+F2		006F 0300
+F3		006F 0301
+F4		006F 0302
+F5		006F 0303
+F6		006F 0308
+F9		0075 0300
+FA		0075 0301
+FB		0075 0302
+FC		0075 0308
+FD		0079 0301
+FF		0079 0308
+100		0041 0304
+101		0061 0304
+102		0041 0306
+103		0061 0306
+104		0041 0328
+105		0061 0328
+106		0043 0301
+107		0063 0301
+108		0043 0302
+109		0063 0302
+10A		0043 0307
+10B		0063 0307
+10C		0043 030C
+10D		0063 030C
+10E		0044 030C
+10F		0064 030C
+112		0045 0304
+113		0065 0304
+114		0045 0306
+115		0065 0306
+116		0045 0307
+117		0065 0307
+118		0045 0328
+119		0065 0328
+11A		0045 030C
+11B		0065 030C
+11C		0047 0302
+11D		0067 0302
+11E		0047 0306
+11F		0067 0306
+120		0047 0307
+121		0067 0307
+122		0047 0327
+123		0067 0327
+124		0048 0302
+125		0068 0302
+128		0049 0303
+129		0069 0303
+12A		0049 0304
+12B		0069 0304
+12C		0049 0306
+12D		0069 0306
+12E		0049 0328
+12F		0069 0328
+130		0049 0307
+132		<compat> 0049 004A
+133		<compat> 0069 006A
+134		004A 0302
+135		006A 0302
+136		004B 0327
+137		006B 0327
+139		004C 0301
+13A		006C 0301
+13B		004C 0327
+13C		006C 0327
+13D		004C 030C
+13E		006C 030C
+13F		<compat> 004C 00B7
+140		<compat> 006C 00B7
+143		004E 0301
+144		006E 0301
+145		004E 0327
+146		006E 0327
+147		004E 030C
+148		006E 030C
+149		<compat> 02BC 006E
+14C		004F 0304
+14D		006F 0304
+14E		004F 0306
+14F		006F 0306
+150		004F 030B
+151		006F 030B
+154		0052 0301
+155		0072 0301
+156		0052 0327
+157		0072 0327
+158		0052 030C
+159		0072 030C
+15A		0053 0301
+15B		0073 0301
+15C		0053 0302
+15D		0073 0302
+15E		0053 0327
+15F		0073 0327
+160		0053 030C
+161		0073 030C
+162		0054 0327
+163		0074 0327
+164		0054 030C
+165		0074 030C
+168		0055 0303
+169		0075 0303
+16A		0055 0304
+16B		0075 0304
+16C		0055 0306
+16D		0075 0306
+16E		0055 030A
+16F		0075 030A
+170		0055 030B
+171		0075 030B
+172		0055 0328
+173		0075 0328
+174		0057 0302
+175		0077 0302
+176		0059 0302
+177		0079 0302
+178		0059 0308
+179		005A 0301
+17A		007A 0301
+17B		005A 0307
+17C		007A 0307
+17D		005A 030C
+17E		007A 030C
+17F		<compat> 0073
+1A0		004F 031B
+1A1		006F 031B
+1AF		0055 031B
+1B0		0075 031B
+1C4		<compat> 0044 017D
+1C5		<compat> 0044 017E
+1C6		<compat> 0064 017E
+1C7		<compat> 004C 004A
+1C8		<compat> 004C 006A
+1C9		<compat> 006C 006A
+1CA		<compat> 004E 004A
+1CB		<compat> 004E 006A
+1CC		<compat> 006E 006A
+1CD		0041 030C
+1CE		0061 030C
+1CF		0049 030C
+1D0		0069 030C
+1D1		004F 030C
+1D2		006F 030C
+1D3		0055 030C
+1D4		0075 030C
+1D5		00DC 0304
+1D6		00FC 0304
+1D7		00DC 0301
+1D8		00FC 0301
+1D9		00DC 030C
+1DA		00FC 030C
+1DB		00DC 0300
+1DC		00FC 0300
+1DE		00C4 0304
+1DF		00E4 0304
+1E0		0226 0304
+1E1		0227 0304
+1E2		00C6 0304
+1E3		00E6 0304
+1E6		0047 030C
+1E7		0067 030C
+1E8		004B 030C
+1E9		006B 030C
+1EA		004F 0328
+1EB		006F 0328
+1EC		01EA 0304
+1ED		01EB 0304
+1EE		01B7 030C
+1EF		0292 030C
+1F0		006A 030C
+1F1		<compat> 0044 005A
+1F2		<compat> 0044 007A
+1F3		<compat> 0064 007A
+1F4		0047 0301
+1F5		0067 0301
+1F8		004E 0300
+1F9		006E 0300
+1FA		00C5 0301
+1FB		00E5 0301
+1FC		00C6 0301
+1FD		00E6 0301
+1FE		00D8 0301
+1FF		00F8 0301
+200		0041 030F
+201		0061 030F
+202		0041 0311
+203		0061 0311
+204		0045 030F
+205		0065 030F
+206		0045 0311
+207		0065 0311
+208		0049 030F
+209		0069 030F
+20A		0049 0311
+20B		0069 0311
+20C		004F 030F
+20D		006F 030F
+20E		004F 0311
+20F		006F 0311
+210		0052 030F
+211		0072 030F
+212		0052 0311
+213		0072 0311
+214		0055 030F
+215		0075 030F
+216		0055 0311
+217		0075 0311
+218		0053 0326
+219		0073 0326
+21A		0054 0326
+21B		0074 0326
+21E		0048 030C
+21F		0068 030C
+226		0041 0307
+227		0061 0307
+228		0045 0327
+229		0065 0327
+22A		00D6 0304
+22B		00F6 0304
+22C		00D5 0304
+22D		00F5 0304
+22E		004F 0307
+22F		006F 0307
+230		022E 0304
+231		022F 0304
+232		0059 0304
+233		0079 0304
+2B0		<super> 0068
+2B1		<super> 0266
+2B2		<super> 006A
+2B3		<super> 0072
+2B4		<super> 0279
+2B5		<super> 027B
+2B6		<super> 0281
+2B7		<super> 0077
+2B8		<super> 0079
+2D8		<compat> 0020 0306
+2D9		<compat> 0020 0307
+2DA		<compat> 0020 030A
+2DB		<compat> 0020 0328
+2DC		<compat> 0020 0303
+2DD		<compat> 0020 030B
+2E0		<super> 0263
+2E1		<super> 006C
+2E2		<super> 0073
+2E3		<super> 0078
+2E4		<super> 0295
+340		0300
+341		0301
+343		0313
+344		0308 0301
+374		02B9
+37A		<compat> 0020 0345
+37E		003B
+384		<compat> 0020 0301
+385		00A8 0301
+386		0391 0301
+387		00B7
+388		0395 0301
+389		0397 0301
+38A		0399 0301
+38C		039F 0301
+38E		03A5 0301
+38F		03A9 0301
+390		03CA 0301
+3AA		0399 0308
+3AB		03A5 0308
+3AC		03B1 0301
+3AD		03B5 0301
+3AE		03B7 0301
+3AF		03B9 0301
+3B0		03CB 0301
+3CA		03B9 0308
+3CB		03C5 0308
+3CC		03BF 0301
+3CD		03C5 0301
+3CE		03C9 0301
+3D0		<compat> 03B2
+3D1		<compat> 03B8
+3D2		<compat> 03A5
+3D3		03D2 0301
+3D4		03D2 0308
+3D5		<compat> 03C6
+3D6		<compat> 03C0
+3F0		<compat> 03BA
+3F1		<compat> 03C1
+3F2		<compat> 03C2
+3F4		<compat> 0398
+3F5		<compat> 03B5
+3F9		<compat> 03A3
+400		0415 0300
+401		0415 0308
+403		0413 0301
+407		0406 0308
+40C		041A 0301
+40D		0418 0300
+40E		0423 0306
+419		0418 0306
+439		0438 0306
+450		0435 0300
+451		0435 0308
+453		0433 0301
+457		0456 0308
+45C		043A 0301
+45D		0438 0300
+45E		0443 0306
+476		0474 030F
+477		0475 030F
+4C1		0416 0306
+4C2		0436 0306
+4D0		0410 0306
+4D1		0430 0306
+4D2		0410 0308
+4D3		0430 0308
+4D6		0415 0306
+4D7		0435 0306
+4DA		04D8 0308
+4DB		04D9 0308
+4DC		0416 0308
+4DD		0436 0308
+4DE		0417 0308
+4DF		0437 0308
+4E2		0418 0304
+4E3		0438 0304
+4E4		0418 0308
+4E5		0438 0308
+4E6		041E 0308
+4E7		043E 0308
+4EA		04E8 0308
+4EB		04E9 0308
+4EC		042D 0308
+4ED		044D 0308
+4EE		0423 0304
+4EF		0443 0304
+4F0		0423 0308
+4F1		0443 0308
+4F2		0423 030B
+4F3		0443 030B
+4F4		0427 0308
+4F5		0447 0308
+4F8		042B 0308
+4F9		044B 0308
+587		<compat> 0565 0582
+622		0627 0653
+623		0627 0654
+624		0648 0654
+625		0627 0655
+626		064A 0654
+675		<compat> 0627 0674
+676		<compat> 0648 0674
+677		<compat> 06C7 0674
+678		<compat> 064A 0674
+6C0		06D5 0654
+6C2		06C1 0654
+6D3		06D2 0654
+929		0928 093C
+931		0930 093C
+934		0933 093C
+958		0915 093C
+959		0916 093C
+95A		0917 093C
+95B		091C 093C
+95C		0921 093C
+95D		0922 093C
+95E		092B 093C
+95F		092F 093C
+9CB		09C7 09BE
+9CC		09C7 09D7
+9DC		09A1 09BC
+9DD		09A2 09BC
+9DF		09AF 09BC
+A33		0A32 0A3C
+A36		0A38 0A3C
+A59		0A16 0A3C
+A5A		0A17 0A3C
+A5B		0A1C 0A3C
+A5E		0A2B 0A3C
+B48		0B47 0B56
+B4B		0B47 0B3E
+B4C		0B47 0B57
+B5C		0B21 0B3C
+B5D		0B22 0B3C
+B94		0B92 0BD7
+BCA		0BC6 0BBE
+BCB		0BC7 0BBE
+BCC		0BC6 0BD7
+C48		0C46 0C56
+CC0		0CBF 0CD5
+CC7		0CC6 0CD5
+CC8		0CC6 0CD6
+CCA		0CC6 0CC2
+CCB		0CCA 0CD5
+D4A		0D46 0D3E
+D4B		0D47 0D3E
+D4C		0D46 0D57
+DDA		0DD9 0DCA
+DDC		0DD9 0DCF
+DDD		0DDC 0DCA
+DDE		0DD9 0DDF
+E33		<compat> 0E4D 0E32
+EB3		<compat> 0ECD 0EB2
+EDC		<compat> 0EAB 0E99
+EDD		<compat> 0EAB 0EA1
+F0C		<noBreak> 0F0B
+F43		0F42 0FB7
+F4D		0F4C 0FB7
+F52		0F51 0FB7
+F57		0F56 0FB7
+F5C		0F5B 0FB7
+F69		0F40 0FB5
+F73		0F71 0F72
+F75		0F71 0F74
+F76		0FB2 0F80
+F77		<compat> 0FB2 0F81
+F78		0FB3 0F80
+F79		<compat> 0FB3 0F81
+F81		0F71 0F80
+F93		0F92 0FB7
+F9D		0F9C 0FB7
+FA2		0FA1 0FB7
+FA7		0FA6 0FB7
+FAC		0FAB 0FB7
+FB9		0F90 0FB5
+1026		1025 102E
+10FC		<super> 10DC
+1B06		1B05 1B35
+1B08		1B07 1B35
+1B0A		1B09 1B35
+1B0C		1B0B 1B35
+1B0E		1B0D 1B35
+1B12		1B11 1B35
+1B3B		1B3A 1B35
+1B3D		1B3C 1B35
+1B40		1B3E 1B35
+1B41		1B3F 1B35
+1B43		1B42 1B35
+1D2C		<super> 0041
+1D2D		<super> 00C6
+1D2E		<super> 0042
+1D30		<super> 0044
+1D31		<super> 0045
+1D32		<super> 018E
+1D33		<super> 0047
+1D34		<super> 0048
+1D35		<super> 0049
+1D36		<super> 004A
+1D37		<super> 004B
+1D38		<super> 004C
+1D39		<super> 004D
+1D3A		<super> 004E
+1D3C		<super> 004F
+1D3D		<super> 0222
+1D3E		<super> 0050
+1D3F		<super> 0052
+1D40		<super> 0054
+1D41		<super> 0055
+1D42		<super> 0057
+1D43		<super> 0061
+1D44		<super> 0250
+1D45		<super> 0251
+1D46		<super> 1D02
+1D47		<super> 0062
+1D48		<super> 0064
+1D49		<super> 0065
+1D4A		<super> 0259
+1D4B		<super> 025B
+1D4C		<super> 025C
+1D4D		<super> 0067
+1D4F		<super> 006B
+1D50		<super> 006D
+1D51		<super> 014B
+1D52		<super> 006F
+1D53		<super> 0254
+1D54		<super> 1D16
+1D55		<super> 1D17
+1D56		<super> 0070
+1D57		<super> 0074
+1D58		<super> 0075
+1D59		<super> 1D1D
+1D5A		<super> 026F
+1D5B		<super> 0076
+1D5C		<super> 1D25
+1D5D		<super> 03B2
+1D5E		<super> 03B3
+1D5F		<super> 03B4
+1D60		<super> 03C6
+1D61		<super> 03C7
+1D62		<sub> 0069
+1D63		<sub> 0072
+1D64		<sub> 0075
+1D65		<sub> 0076
+1D66		<sub> 03B2
+1D67		<sub> 03B3
+1D68		<sub> 03C1
+1D69		<sub> 03C6
+1D6A		<sub> 03C7
+1D78		<super> 043D
+1D9B		<super> 0252
+1D9C		<super> 0063
+1D9D		<super> 0255
+1D9E		<super> 00F0
+1D9F		<super> 025C
+1DA0		<super> 0066
+1DA1		<super> 025F
+1DA2		<super> 0261
+1DA3		<super> 0265
+1DA4		<super> 0268
+1DA5		<super> 0269
+1DA6		<super> 026A
+1DA7		<super> 1D7B
+1DA8		<super> 029D
+1DA9		<super> 026D
+1DAA		<super> 1D85
+1DAB		<super> 029F
+1DAC		<super> 0271
+1DAD		<super> 0270
+1DAE		<super> 0272
+1DAF		<super> 0273
+1DB0		<super> 0274
+1DB1		<super> 0275
+1DB2		<super> 0278
+1DB3		<super> 0282
+1DB4		<super> 0283
+1DB5		<super> 01AB
+1DB6		<super> 0289
+1DB7		<super> 028A
+1DB8		<super> 1D1C
+1DB9		<super> 028B
+1DBA		<super> 028C
+1DBB		<super> 007A
+1DBC		<super> 0290
+1DBD		<super> 0291
+1DBE		<super> 0292
+1DBF		<super> 03B8
+1E00		0041 0325
+1E01		0061 0325
+1E02		0042 0307
+1E03		0062 0307
+1E04		0042 0323
+1E05		0062 0323
+1E06		0042 0331
+1E07		0062 0331
+1E08		00C7 0301
+1E09		00E7 0301
+1E0A		0044 0307
+1E0B		0064 0307
+1E0C		0044 0323
+1E0D		0064 0323
+1E0E		0044 0331
+1E0F		0064 0331
+1E10		0044 0327
+1E11		0064 0327
+1E12		0044 032D
+1E13		0064 032D
+1E14		0112 0300
+1E15		0113 0300
+1E16		0112 0301
+1E17		0113 0301
+1E18		0045 032D
+1E19		0065 032D
+1E1A		0045 0330
+1E1B		0065 0330
+1E1C		0228 0306
+1E1D		0229 0306
+1E1E		0046 0307
+1E1F		0066 0307
+1E20		0047 0304
+1E21		0067 0304
+1E22		0048 0307
+1E23		0068 0307
+1E24		0048 0323
+1E25		0068 0323
+1E26		0048 0308
+1E27		0068 0308
+1E28		0048 0327
+1E29		0068 0327
+1E2A		0048 032E
+1E2B		0068 032E
+1E2C		0049 0330
+1E2D		0069 0330
+1E2E		00CF 0301
+1E2F		00EF 0301
+1E30		004B 0301
+1E31		006B 0301
+1E32		004B 0323
+1E33		006B 0323
+1E34		004B 0331
+1E35		006B 0331
+1E36		004C 0323
+1E37		006C 0323
+1E38		1E36 0304
+1E39		1E37 0304
+1E3A		004C 0331
+1E3B		006C 0331
+1E3C		004C 032D
+1E3D		006C 032D
+1E3E		004D 0301
+1E3F		006D 0301
+1E40		004D 0307
+1E41		006D 0307
+1E42		004D 0323
+1E43		006D 0323
+1E44		004E 0307
+1E45		006E 0307
+1E46		004E 0323
+1E47		006E 0323
+1E48		004E 0331
+1E49		006E 0331
+1E4A		004E 032D
+1E4B		006E 032D
+1E4C		00D5 0301
+1E4D		00F5 0301
+1E4E		00D5 0308
+1E4F		00F5 0308
+1E50		014C 0300
+1E51		014D 0300
+1E52		014C 0301
+1E53		014D 0301
+1E54		0050 0301
+1E55		0070 0301
+1E56		0050 0307
+1E57		0070 0307
+1E58		0052 0307
+1E59		0072 0307
+1E5A		0052 0323
+1E5B		0072 0323
+1E5C		1E5A 0304
+1E5D		1E5B 0304
+1E5E		0052 0331
+1E5F		0072 0331
+1E60		0053 0307
+1E61		0073 0307
+1E62		0053 0323
+1E63		0073 0323
+1E64		015A 0307
+1E65		015B 0307
+1E66		0160 0307
+1E67		0161 0307
+1E68		1E62 0307
+1E69		1E63 0307
+1E6A		0054 0307
+1E6B		0074 0307
+1E6C		0054 0323
+1E6D		0074 0323
+1E6E		0054 0331
+1E6F		0074 0331
+1E70		0054 032D
+1E71		0074 032D
+1E72		0055 0324
+1E73		0075 0324
+1E74		0055 0330
+1E75		0075 0330
+1E76		0055 032D
+1E77		0075 032D
+1E78		0168 0301
+1E79		0169 0301
+1E7A		016A 0308
+1E7B		016B 0308
+1E7C		0056 0303
+1E7D		0076 0303
+1E7E		0056 0323
+1E7F		0076 0323
+1E80		0057 0300
+1E81		0077 0300
+1E82		0057 0301
+1E83		0077 0301
+1E84		0057 0308
+1E85		0077 0308
+1E86		0057 0307
+1E87		0077 0307
+1E88		0057 0323
+1E89		0077 0323
+1E8A		0058 0307
+1E8B		0078 0307
+1E8C		0058 0308
+1E8D		0078 0308
+1E8E		0059 0307
+1E8F		0079 0307
+1E90		005A 0302
+1E91		007A 0302
+1E92		005A 0323
+1E93		007A 0323
+1E94		005A 0331
+1E95		007A 0331
+1E96		0068 0331
+1E97		0074 0308
+1E98		0077 030A
+1E99		0079 030A
+1E9A		<compat> 0061 02BE
+1E9B		017F 0307
+1EA0		0041 0323
+1EA1		0061 0323
+1EA2		0041 0309
+1EA3		0061 0309
+1EA4		00C2 0301
+1EA5		00E2 0301
+1EA6		00C2 0300
+1EA7		00E2 0300
+1EA8		00C2 0309
+1EA9		00E2 0309
+1EAA		00C2 0303
+1EAB		00E2 0303
+1EAC		1EA0 0302
+1EAD		1EA1 0302
+1EAE		0102 0301
+1EAF		0103 0301
+1EB0		0102 0300
+1EB1		0103 0300
+1EB2		0102 0309
+1EB3		0103 0309
+1EB4		0102 0303
+1EB5		0103 0303
+1EB6		1EA0 0306
+1EB7		1EA1 0306
+1EB8		0045 0323
+1EB9		0065 0323
+1EBA		0045 0309
+1EBB		0065 0309
+1EBC		0045 0303
+1EBD		0065 0303
+1EBE		00CA 0301
+1EBF		00EA 0301
+1EC0		00CA 0300
+1EC1		00EA 0300
+1EC2		00CA 0309
+1EC3		00EA 0309
+1EC4		00CA 0303
+1EC5		00EA 0303
+1EC6		1EB8 0302
+1EC7		1EB9 0302
+1EC8		0049 0309
+1EC9		0069 0309
+1ECA		0049 0323
+1ECB		0069 0323
+1ECC		004F 0323
+1ECD		006F 0323
+1ECE		004F 0309
+1ECF		006F 0309
+1ED0		00D4 0301
+1ED1		00F4 0301
+1ED2		00D4 0300
+1ED3		00F4 0300
+1ED4		00D4 0309
+1ED5		00F4 0309
+1ED6		00D4 0303
+1ED7		00F4 0303
+1ED8		1ECC 0302
+1ED9		1ECD 0302
+1EDA		01A0 0301
+1EDB		01A1 0301
+1EDC		01A0 0300
+1EDD		01A1 0300
+1EDE		01A0 0309
+1EDF		01A1 0309
+1EE0		01A0 0303
+1EE1		01A1 0303
+1EE2		01A0 0323
+1EE3		01A1 0323
+1EE4		0055 0323
+1EE5		0075 0323
+1EE6		0055 0309
+1EE7		0075 0309
+1EE8		01AF 0301
+1EE9		01B0 0301
+1EEA		01AF 0300
+1EEB		01B0 0300
+1EEC		01AF 0309
+1EED		01B0 0309
+1EEE		01AF 0303
+1EEF		01B0 0303
+1EF0		01AF 0323
+1EF1		01B0 0323
+1EF2		0059 0300
+1EF3		0079 0300
+1EF4		0059 0323
+1EF5		0079 0323
+1EF6		0059 0309
+1EF7		0079 0309
+1EF8		0059 0303
+1EF9		0079 0303
+1F00		03B1 0313
+1F01		03B1 0314
+1F02		1F00 0300
+1F03		1F01 0300
+1F04		1F00 0301
+1F05		1F01 0301
+1F06		1F00 0342
+1F07		1F01 0342
+1F08		0391 0313
+1F09		0391 0314
+1F0A		1F08 0300
+1F0B		1F09 0300
+1F0C		1F08 0301
+1F0D		1F09 0301
+1F0E		1F08 0342
+1F0F		1F09 0342
+1F10		03B5 0313
+1F11		03B5 0314
+1F12		1F10 0300
+1F13		1F11 0300
+1F14		1F10 0301
+1F15		1F11 0301
+1F18		0395 0313
+1F19		0395 0314
+1F1A		1F18 0300
+1F1B		1F19 0300
+1F1C		1F18 0301
+1F1D		1F19 0301
+1F20		03B7 0313
+1F21		03B7 0314
+1F22		1F20 0300
+1F23		1F21 0300
+1F24		1F20 0301
+1F25		1F21 0301
+1F26		1F20 0342
+1F27		1F21 0342
+1F28		0397 0313
+1F29		0397 0314
+1F2A		1F28 0300
+1F2B		1F29 0300
+1F2C		1F28 0301
+1F2D		1F29 0301
+1F2E		1F28 0342
+1F2F		1F29 0342
+1F30		03B9 0313
+1F31		03B9 0314
+1F32		1F30 0300
+1F33		1F31 0300
+1F34		1F30 0301
+1F35		1F31 0301
+1F36		1F30 0342
+1F37		1F31 0342
+1F38		0399 0313
+1F39		0399 0314
+1F3A		1F38 0300
+1F3B		1F39 0300
+1F3C		1F38 0301
+1F3D		1F39 0301
+1F3E		1F38 0342
+1F3F		1F39 0342
+1F40		03BF 0313
+1F41		03BF 0314
+1F42		1F40 0300
+1F43		1F41 0300
+1F44		1F40 0301
+1F45		1F41 0301
+1F48		039F 0313
+1F49		039F 0314
+1F4A		1F48 0300
+1F4B		1F49 0300
+1F4C		1F48 0301
+1F4D		1F49 0301
+1F50		03C5 0313
+1F51		03C5 0314
+1F52		1F50 0300
+1F53		1F51 0300
+1F54		1F50 0301
+1F55		1F51 0301
+1F56		1F50 0342
+1F57		1F51 0342
+1F59		03A5 0314
+1F5B		1F59 0300
+1F5D		1F59 0301
+1F5F		1F59 0342
+1F60		03C9 0313
+1F61		03C9 0314
+1F62		1F60 0300
+1F63		1F61 0300
+1F64		1F60 0301
+1F65		1F61 0301
+1F66		1F60 0342
+1F67		1F61 0342
+1F68		03A9 0313
+1F69		03A9 0314
+1F6A		1F68 0300
+1F6B		1F69 0300
+1F6C		1F68 0301
+1F6D		1F69 0301
+1F6E		1F68 0342
+1F6F		1F69 0342
+1F70		03B1 0300
+1F71		03AC
+1F72		03B5 0300
+1F73		03AD
+1F74		03B7 0300
+1F75		03AE
+1F76		03B9 0300
+1F77		03AF
+1F78		03BF 0300
+1F79		03CC
+1F7A		03C5 0300
+1F7B		03CD
+1F7C		03C9 0300
+1F7D		03CE
+1F80		1F00 0345
+1F81		1F01 0345
+1F82		1F02 0345
+1F83		1F03 0345
+1F84		1F04 0345
+1F85		1F05 0345
+1F86		1F06 0345
+1F87		1F07 0345
+1F88		1F08 0345
+1F89		1F09 0345
+1F8A		1F0A 0345
+1F8B		1F0B 0345
+1F8C		1F0C 0345
+1F8D		1F0D 0345
+1F8E		1F0E 0345
+1F8F		1F0F 0345
+1F90		1F20 0345
+1F91		1F21 0345
+1F92		1F22 0345
+1F93		1F23 0345
+1F94		1F24 0345
+1F95		1F25 0345
+1F96		1F26 0345
+1F97		1F27 0345
+1F98		1F28 0345
+1F99		1F29 0345
+1F9A		1F2A 0345
+1F9B		1F2B 0345
+1F9C		1F2C 0345
+1F9D		1F2D 0345
+1F9E		1F2E 0345
+1F9F		1F2F 0345
+1FA0		1F60 0345
+1FA1		1F61 0345
+1FA2		1F62 0345
+1FA3		1F63 0345
+1FA4		1F64 0345
+1FA5		1F65 0345
+1FA6		1F66 0345
+1FA7		1F67 0345
+1FA8		1F68 0345
+1FA9		1F69 0345
+1FAA		1F6A 0345
+1FAB		1F6B 0345
+1FAC		1F6C 0345
+1FAD		1F6D 0345
+1FAE		1F6E 0345
+1FAF		1F6F 0345
+1FB0		03B1 0306
+1FB1		03B1 0304
+1FB2		1F70 0345
+1FB3		03B1 0345
+1FB4		03AC 0345
+1FB6		03B1 0342
+1FB7		1FB6 0345
+1FB8		0391 0306
+1FB9		0391 0304
+1FBA		0391 0300
+1FBB		0386
+1FBC		0391 0345
+1FBD		<compat> 0020 0313
+1FBE		03B9
+1FBF		<compat> 0020 0313
+1FC0		<compat> 0020 0342
+1FC1		00A8 0342
+1FC2		1F74 0345
+1FC3		03B7 0345
+1FC4		03AE 0345
+1FC6		03B7 0342
+1FC7		1FC6 0345
+1FC8		0395 0300
+1FC9		0388
+1FCA		0397 0300
+1FCB		0389
+1FCC		0397 0345
+1FCD		1FBF 0300
+1FCE		1FBF 0301
+1FCF		1FBF 0342
+1FD0		03B9 0306
+1FD1		03B9 0304
+1FD2		03CA 0300
+1FD3		0390
+1FD6		03B9 0342
+1FD7		03CA 0342
+1FD8		0399 0306
+1FD9		0399 0304
+1FDA		0399 0300
+1FDB		038A
+1FDD		1FFE 0300
+1FDE		1FFE 0301
+1FDF		1FFE 0342
+1FE0		03C5 0306
+1FE1		03C5 0304
+1FE2		03CB 0300
+1FE3		03B0
+1FE4		03C1 0313
+1FE5		03C1 0314
+1FE6		03C5 0342
+1FE7		03CB 0342
+1FE8		03A5 0306
+1FE9		03A5 0304
+1FEA		03A5 0300
+1FEB		038E
+1FEC		03A1 0314
+1FED		00A8 0300
+1FEE		0385
+1FEF		0060
+1FF2		1F7C 0345
+1FF3		03C9 0345
+1FF4		03CE 0345
+1FF6		03C9 0342
+1FF7		1FF6 0345
+1FF8		039F 0300
+1FF9		038C
+1FFA		03A9 0300
+1FFB		038F
+1FFC		03A9 0345
+1FFD		00B4
+1FFE		<compat> 0020 0314
+2000		2002
+2001		2003
+2002	2006	<compat> 0020
+2007		<noBreak> 0020
+2008	200A	<compat> 0020
+2011		<noBreak> 2010
+2017		<compat> 0020 0333
+2024		<compat> 002E
+2025		<compat> 002E 002E
+2026		<compat> 002E 002E 002E
+202F		<noBreak> 0020
+2033		<compat> 2032 2032
+2034		<compat> 2032 2032 2032
+2036		<compat> 2035 2035
+2037		<compat> 2035 2035 2035
+203C		<compat> 0021 0021
+203E		<compat> 0020 0305
+2047		<compat> 003F 003F
+2048		<compat> 003F 0021
+2049		<compat> 0021 003F
+2057		<compat> 2032 2032 2032 2032
+205F		<compat> 0020
+2070		<super> 0030
+2071		<super> 0069
+2074		<super> 0034
+2075		<super> 0035
+2076		<super> 0036
+2077		<super> 0037
+2078		<super> 0038
+2079		<super> 0039
+207A		<super> 002B
+207B		<super> 2212
+207C		<super> 003D
+207D		<super> 0028
+207E		<super> 0029
+207F		<super> 006E
+2080		<sub> 0030
+2081		<sub> 0031
+2082		<sub> 0032
+2083		<sub> 0033
+2084		<sub> 0034
+2085		<sub> 0035
+2086		<sub> 0036
+2087		<sub> 0037
+2088		<sub> 0038
+2089		<sub> 0039
+208A		<sub> 002B
+208B		<sub> 2212
+208C		<sub> 003D
+208D		<sub> 0028
+208E		<sub> 0029
+2090		<sub> 0061
+2091		<sub> 0065
+2092		<sub> 006F
+2093		<sub> 0078
+2094		<sub> 0259
+2095		<sub> 0068
+2096		<sub> 006B
+2097		<sub> 006C
+2098		<sub> 006D
+2099		<sub> 006E
+209A		<sub> 0070
+209B		<sub> 0073
+209C		<sub> 0074
+20A8		<compat> 0052 0073
+2100		<compat> 0061 002F 0063
+2101		<compat> 0061 002F 0073
+2102		<font> 0043
+2103		<compat> 00B0 0043
+2105		<compat> 0063 002F 006F
+2106		<compat> 0063 002F 0075
+2107		<compat> 0190
+2109		<compat> 00B0 0046
+210A		<font> 0067
+210B	210D	<font> 0048
+210E		<font> 0068
+210F		<font> 0127
+2110	2111	<font> 0049
+2112		<font> 004C
+2113		<font> 006C
+2115		<font> 004E
+2116		<compat> 004E 006F
+2119		<font> 0050
+211A		<font> 0051
+211B	211D	<font> 0052
+2120		<super> 0053 004D
+2121		<compat> 0054 0045 004C
+2122		<super> 0054 004D
+2124		<font> 005A
+2126		03A9
+2128		<font> 005A
+212A		004B
+212B		00C5
+212C		<font> 0042
+212D		<font> 0043
+212F		<font> 0065
+2130		<font> 0045
+2131		<font> 0046
+2133		<font> 004D
+2134		<font> 006F
+2135		<compat> 05D0
+2136		<compat> 05D1
+2137		<compat> 05D2
+2138		<compat> 05D3
+2139		<font> 0069
+213B		<compat> 0046 0041 0058
+213C		<font> 03C0
+213D		<font> 03B3
+213E		<font> 0393
+213F		<font> 03A0
+2140		<font> 2211
+2145		<font> 0044
+2146		<font> 0064
+2147		<font> 0065
+2148		<font> 0069
+2149		<font> 006A
+2150		<fraction> 0031 2044 0037
+2151		<fraction> 0031 2044 0039
+2152		<fraction> 0031 2044 0031 0030
+2153		<fraction> 0031 2044 0033
+2154		<fraction> 0032 2044 0033
+2155		<fraction> 0031 2044 0035
+2156		<fraction> 0032 2044 0035
+2157		<fraction> 0033 2044 0035
+2158		<fraction> 0034 2044 0035
+2159		<fraction> 0031 2044 0036
+215A		<fraction> 0035 2044 0036
+215B		<fraction> 0031 2044 0038
+215C		<fraction> 0033 2044 0038
+215D		<fraction> 0035 2044 0038
+215E		<fraction> 0037 2044 0038
+215F		<fraction> 0031 2044
+2160		<compat> 0049
+2161		<compat> 0049 0049
+2162		<compat> 0049 0049 0049
+2163		<compat> 0049 0056
+2164		<compat> 0056
+2165		<compat> 0056 0049
+2166		<compat> 0056 0049 0049
+2167		<compat> 0056 0049 0049 0049
+2168		<compat> 0049 0058
+2169		<compat> 0058
+216A		<compat> 0058 0049
+216B		<compat> 0058 0049 0049
+216C		<compat> 004C
+216D		<compat> 0043
+216E		<compat> 0044
+216F		<compat> 004D
+2170		<compat> 0069
+2171		<compat> 0069 0069
+2172		<compat> 0069 0069 0069
+2173		<compat> 0069 0076
+2174		<compat> 0076
+2175		<compat> 0076 0069
+2176		<compat> 0076 0069 0069
+2177		<compat> 0076 0069 0069 0069
+2178		<compat> 0069 0078
+2179		<compat> 0078
+217A		<compat> 0078 0069
+217B		<compat> 0078 0069 0069
+217C		<compat> 006C
+217D		<compat> 0063
+217E		<compat> 0064
+217F		<compat> 006D
+2189		<fraction> 0030 2044 0033
+219A		2190 0338
+219B		2192 0338
+21AE		2194 0338
+21CD		21D0 0338
+21CE		21D4 0338
+21CF		21D2 0338
+2204		2203 0338
+2209		2208 0338
+220C		220B 0338
+2224		2223 0338
+2226		2225 0338
+222C		<compat> 222B 222B
+222D		<compat> 222B 222B 222B
+222F		<compat> 222E 222E
+2230		<compat> 222E 222E 222E
+2241		223C 0338
+2244		2243 0338
+2247		2245 0338
+2249		2248 0338
+2260		003D 0338
+2262		2261 0338
+226D		224D 0338
+226E		003C 0338
+226F		003E 0338
+2270		2264 0338
+2271		2265 0338
+2274		2272 0338
+2275		2273 0338
+2278		2276 0338
+2279		2277 0338
+2280		227A 0338
+2281		227B 0338
+2284		2282 0338
+2285		2283 0338
+2288		2286 0338
+2289		2287 0338
+22AC		22A2 0338
+22AD		22A8 0338
+22AE		22A9 0338
+22AF		22AB 0338
+22E0		227C 0338
+22E1		227D 0338
+22E2		2291 0338
+22E3		2292 0338
+22EA		22B2 0338
+22EB		22B3 0338
+22EC		22B4 0338
+22ED		22B5 0338
+2329		3008
+232A		3009
+2460		<circle> 0031
+2461		<circle> 0032
+2462		<circle> 0033
+2463		<circle> 0034
+2464		<circle> 0035
+2465		<circle> 0036
+2466		<circle> 0037
+2467		<circle> 0038
+2468		<circle> 0039
+2469		<circle> 0031 0030
+246A		<circle> 0031 0031
+246B		<circle> 0031 0032
+246C		<circle> 0031 0033
+246D		<circle> 0031 0034
+246E		<circle> 0031 0035
+246F		<circle> 0031 0036
+2470		<circle> 0031 0037
+2471		<circle> 0031 0038
+2472		<circle> 0031 0039
+2473		<circle> 0032 0030
+2474		<compat> 0028 0031 0029
+2475		<compat> 0028 0032 0029
+2476		<compat> 0028 0033 0029
+2477		<compat> 0028 0034 0029
+2478		<compat> 0028 0035 0029
+2479		<compat> 0028 0036 0029
+247A		<compat> 0028 0037 0029
+247B		<compat> 0028 0038 0029
+247C		<compat> 0028 0039 0029
+247D		<compat> 0028 0031 0030 0029
+247E		<compat> 0028 0031 0031 0029
+247F		<compat> 0028 0031 0032 0029
+2480		<compat> 0028 0031 0033 0029
+2481		<compat> 0028 0031 0034 0029
+2482		<compat> 0028 0031 0035 0029
+2483		<compat> 0028 0031 0036 0029
+2484		<compat> 0028 0031 0037 0029
+2485		<compat> 0028 0031 0038 0029
+2486		<compat> 0028 0031 0039 0029
+2487		<compat> 0028 0032 0030 0029
+2488		<compat> 0031 002E
+2489		<compat> 0032 002E
+248A		<compat> 0033 002E
+248B		<compat> 0034 002E
+248C		<compat> 0035 002E
+248D		<compat> 0036 002E
+248E		<compat> 0037 002E
+248F		<compat> 0038 002E
+2490		<compat> 0039 002E
+2491		<compat> 0031 0030 002E
+2492		<compat> 0031 0031 002E
+2493		<compat> 0031 0032 002E
+2494		<compat> 0031 0033 002E
+2495		<compat> 0031 0034 002E
+2496		<compat> 0031 0035 002E
+2497		<compat> 0031 0036 002E
+2498		<compat> 0031 0037 002E
+2499		<compat> 0031 0038 002E
+249A		<compat> 0031 0039 002E
+249B		<compat> 0032 0030 002E
+249C		<compat> 0028 0061 0029
+249D		<compat> 0028 0062 0029
+249E		<compat> 0028 0063 0029
+249F		<compat> 0028 0064 0029
+24A0		<compat> 0028 0065 0029
+24A1		<compat> 0028 0066 0029
+24A2		<compat> 0028 0067 0029
+24A3		<compat> 0028 0068 0029
+24A4		<compat> 0028 0069 0029
+24A5		<compat> 0028 006A 0029
+24A6		<compat> 0028 006B 0029
+24A7		<compat> 0028 006C 0029
+24A8		<compat> 0028 006D 0029
+24A9		<compat> 0028 006E 0029
+24AA		<compat> 0028 006F 0029
+24AB		<compat> 0028 0070 0029
+24AC		<compat> 0028 0071 0029
+24AD		<compat> 0028 0072 0029
+24AE		<compat> 0028 0073 0029
+24AF		<compat> 0028 0074 0029
+24B0		<compat> 0028 0075 0029
+24B1		<compat> 0028 0076 0029
+24B2		<compat> 0028 0077 0029
+24B3		<compat> 0028 0078 0029
+24B4		<compat> 0028 0079 0029
+24B5		<compat> 0028 007A 0029
+24B6		<circle> 0041
+24B7		<circle> 0042
+24B8		<circle> 0043
+24B9		<circle> 0044
+24BA		<circle> 0045
+24BB		<circle> 0046
+24BC		<circle> 0047
+24BD		<circle> 0048
+24BE		<circle> 0049
+24BF		<circle> 004A
+24C0		<circle> 004B
+24C1		<circle> 004C
+24C2		<circle> 004D
+24C3		<circle> 004E
+24C4		<circle> 004F
+24C5		<circle> 0050
+24C6		<circle> 0051
+24C7		<circle> 0052
+24C8		<circle> 0053
+24C9		<circle> 0054
+24CA		<circle> 0055
+24CB		<circle> 0056
+24CC		<circle> 0057
+24CD		<circle> 0058
+24CE		<circle> 0059
+24CF		<circle> 005A
+24D0		<circle> 0061
+24D1		<circle> 0062
+24D2		<circle> 0063
+24D3		<circle> 0064
+24D4		<circle> 0065
+24D5		<circle> 0066
+24D6		<circle> 0067
+24D7		<circle> 0068
+24D8		<circle> 0069
+24D9		<circle> 006A
+24DA		<circle> 006B
+24DB		<circle> 006C
+24DC		<circle> 006D
+24DD		<circle> 006E
+24DE		<circle> 006F
+24DF		<circle> 0070
+24E0		<circle> 0071
+24E1		<circle> 0072
+24E2		<circle> 0073
+24E3		<circle> 0074
+24E4		<circle> 0075
+24E5		<circle> 0076
+24E6		<circle> 0077
+24E7		<circle> 0078
+24E8		<circle> 0079
+24E9		<circle> 007A
+24EA		<circle> 0030
+2A0C		<compat> 222B 222B 222B 222B
+2A74		<compat> 003A 003A 003D
+2A75		<compat> 003D 003D
+2A76		<compat> 003D 003D 003D
+2ADC		2ADD 0338
+2C7C		<sub> 006A
+2C7D		<super> 0056
+2D6F		<super> 2D61
+2E9F		<compat> 6BCD
+2EF3		<compat> 9F9F
+2F00		<compat> 4E00
+2F01		<compat> 4E28
+2F02		<compat> 4E36
+2F03		<compat> 4E3F
+2F04		<compat> 4E59
+2F05		<compat> 4E85
+2F06		<compat> 4E8C
+2F07		<compat> 4EA0
+2F08		<compat> 4EBA
+2F09		<compat> 513F
+2F0A		<compat> 5165
+2F0B		<compat> 516B
+2F0C		<compat> 5182
+2F0D		<compat> 5196
+2F0E		<compat> 51AB
+2F0F		<compat> 51E0
+2F10		<compat> 51F5
+2F11		<compat> 5200
+2F12		<compat> 529B
+2F13		<compat> 52F9
+2F14		<compat> 5315
+2F15		<compat> 531A
+2F16		<compat> 5338
+2F17		<compat> 5341
+2F18		<compat> 535C
+2F19		<compat> 5369
+2F1A		<compat> 5382
+2F1B		<compat> 53B6
+2F1C		<compat> 53C8
+2F1D		<compat> 53E3
+2F1E		<compat> 56D7
+2F1F		<compat> 571F
+2F20		<compat> 58EB
+2F21		<compat> 5902
+2F22		<compat> 590A
+2F23		<compat> 5915
+2F24		<compat> 5927
+2F25		<compat> 5973
+2F26		<compat> 5B50
+2F27		<compat> 5B80
+2F28		<compat> 5BF8
+2F29		<compat> 5C0F
+2F2A		<compat> 5C22
+2F2B		<compat> 5C38
+2F2C		<compat> 5C6E
+2F2D		<compat> 5C71
+2F2E		<compat> 5DDB
+2F2F		<compat> 5DE5
+2F30		<compat> 5DF1
+2F31		<compat> 5DFE
+2F32		<compat> 5E72
+2F33		<compat> 5E7A
+2F34		<compat> 5E7F
+2F35		<compat> 5EF4
+2F36		<compat> 5EFE
+2F37		<compat> 5F0B
+2F38		<compat> 5F13
+2F39		<compat> 5F50
+2F3A		<compat> 5F61
+2F3B		<compat> 5F73
+2F3C		<compat> 5FC3
+2F3D		<compat> 6208
+2F3E		<compat> 6236
+2F3F		<compat> 624B
+2F40		<compat> 652F
+2F41		<compat> 6534
+2F42		<compat> 6587
+2F43		<compat> 6597
+2F44		<compat> 65A4
+2F45		<compat> 65B9
+2F46		<compat> 65E0
+2F47		<compat> 65E5
+2F48		<compat> 66F0
+2F49		<compat> 6708
+2F4A		<compat> 6728
+2F4B		<compat> 6B20
+2F4C		<compat> 6B62
+2F4D		<compat> 6B79
+2F4E		<compat> 6BB3
+2F4F		<compat> 6BCB
+2F50		<compat> 6BD4
+2F51		<compat> 6BDB
+2F52		<compat> 6C0F
+2F53		<compat> 6C14
+2F54		<compat> 6C34
+2F55		<compat> 706B
+2F56		<compat> 722A
+2F57		<compat> 7236
+2F58		<compat> 723B
+2F59		<compat> 723F
+2F5A		<compat> 7247
+2F5B		<compat> 7259
+2F5C		<compat> 725B
+2F5D		<compat> 72AC
+2F5E		<compat> 7384
+2F5F		<compat> 7389
+2F60		<compat> 74DC
+2F61		<compat> 74E6
+2F62		<compat> 7518
+2F63		<compat> 751F
+2F64		<compat> 7528
+2F65		<compat> 7530
+2F66		<compat> 758B
+2F67		<compat> 7592
+2F68		<compat> 7676
+2F69		<compat> 767D
+2F6A		<compat> 76AE
+2F6B		<compat> 76BF
+2F6C		<compat> 76EE
+2F6D		<compat> 77DB
+2F6E		<compat> 77E2
+2F6F		<compat> 77F3
+2F70		<compat> 793A
+2F71		<compat> 79B8
+2F72		<compat> 79BE
+2F73		<compat> 7A74
+2F74		<compat> 7ACB
+2F75		<compat> 7AF9
+2F76		<compat> 7C73
+2F77		<compat> 7CF8
+2F78		<compat> 7F36
+2F79		<compat> 7F51
+2F7A		<compat> 7F8A
+2F7B		<compat> 7FBD
+2F7C		<compat> 8001
+2F7D		<compat> 800C
+2F7E		<compat> 8012
+2F7F		<compat> 8033
+2F80		<compat> 807F
+2F81		<compat> 8089
+2F82		<compat> 81E3
+2F83		<compat> 81EA
+2F84		<compat> 81F3
+2F85		<compat> 81FC
+2F86		<compat> 820C
+2F87		<compat> 821B
+2F88		<compat> 821F
+2F89		<compat> 826E
+2F8A		<compat> 8272
+2F8B		<compat> 8278
+2F8C		<compat> 864D
+2F8D		<compat> 866B
+2F8E		<compat> 8840
+2F8F		<compat> 884C
+2F90		<compat> 8863
+2F91		<compat> 897E
+2F92		<compat> 898B
+2F93		<compat> 89D2
+2F94		<compat> 8A00
+2F95		<compat> 8C37
+2F96		<compat> 8C46
+2F97		<compat> 8C55
+2F98		<compat> 8C78
+2F99		<compat> 8C9D
+2F9A		<compat> 8D64
+2F9B		<compat> 8D70
+2F9C		<compat> 8DB3
+2F9D		<compat> 8EAB
+2F9E		<compat> 8ECA
+2F9F		<compat> 8F9B
+2FA0		<compat> 8FB0
+2FA1		<compat> 8FB5
+2FA2		<compat> 9091
+2FA3		<compat> 9149
+2FA4		<compat> 91C6
+2FA5		<compat> 91CC
+2FA6		<compat> 91D1
+2FA7		<compat> 9577
+2FA8		<compat> 9580
+2FA9		<compat> 961C
+2FAA		<compat> 96B6
+2FAB		<compat> 96B9
+2FAC		<compat> 96E8
+2FAD		<compat> 9751
+2FAE		<compat> 975E
+2FAF		<compat> 9762
+2FB0		<compat> 9769
+2FB1		<compat> 97CB
+2FB2		<compat> 97ED
+2FB3		<compat> 97F3
+2FB4		<compat> 9801
+2FB5		<compat> 98A8
+2FB6		<compat> 98DB
+2FB7		<compat> 98DF
+2FB8		<compat> 9996
+2FB9		<compat> 9999
+2FBA		<compat> 99AC
+2FBB		<compat> 9AA8
+2FBC		<compat> 9AD8
+2FBD		<compat> 9ADF
+2FBE		<compat> 9B25
+2FBF		<compat> 9B2F
+2FC0		<compat> 9B32
+2FC1		<compat> 9B3C
+2FC2		<compat> 9B5A
+2FC3		<compat> 9CE5
+2FC4		<compat> 9E75
+2FC5		<compat> 9E7F
+2FC6		<compat> 9EA5
+2FC7		<compat> 9EBB
+2FC8		<compat> 9EC3
+2FC9		<compat> 9ECD
+2FCA		<compat> 9ED1
+2FCB		<compat> 9EF9
+2FCC		<compat> 9EFD
+2FCD		<compat> 9F0E
+2FCE		<compat> 9F13
+2FCF		<compat> 9F20
+2FD0		<compat> 9F3B
+2FD1		<compat> 9F4A
+2FD2		<compat> 9F52
+2FD3		<compat> 9F8D
+2FD4		<compat> 9F9C
+2FD5		<compat> 9FA0
+3000		<wide> 0020
+3036		<compat> 3012
+3038		<compat> 5341
+3039		<compat> 5344
+303A		<compat> 5345
+304C		304B 3099
+304E		304D 3099
+3050		304F 3099
+3052		3051 3099
+3054		3053 3099
+3056		3055 3099
+3058		3057 3099
+305A		3059 3099
+305C		305B 3099
+305E		305D 3099
+3060		305F 3099
+3062		3061 3099
+3065		3064 3099
+3067		3066 3099
+3069		3068 3099
+3070		306F 3099
+3071		306F 309A
+3073		3072 3099
+3074		3072 309A
+3076		3075 3099
+3077		3075 309A
+3079		3078 3099
+307A		3078 309A
+307C		307B 3099
+307D		307B 309A
+3094		3046 3099
+309B		<compat> 0020 3099
+309C		<compat> 0020 309A
+309E		309D 3099
+309F		<vertical> 3088 308A
+30AC		30AB 3099
+30AE		30AD 3099
+30B0		30AF 3099
+30B2		30B1 3099
+30B4		30B3 3099
+30B6		30B5 3099
+30B8		30B7 3099
+30BA		30B9 3099
+30BC		30BB 3099
+30BE		30BD 3099
+30C0		30BF 3099
+30C2		30C1 3099
+30C5		30C4 3099
+30C7		30C6 3099
+30C9		30C8 3099
+30D0		30CF 3099
+30D1		30CF 309A
+30D3		30D2 3099
+30D4		30D2 309A
+30D6		30D5 3099
+30D7		30D5 309A
+30D9		30D8 3099
+30DA		30D8 309A
+30DC		30DB 3099
+30DD		30DB 309A
+30F4		30A6 3099
+30F7		30EF 3099
+30F8		30F0 3099
+30F9		30F1 3099
+30FA		30F2 3099
+30FE		30FD 3099
+30FF		<vertical> 30B3 30C8
+3131		<compat> 1100
+3132		<compat> 1101
+3133		<compat> 11AA
+3134		<compat> 1102
+3135		<compat> 11AC
+3136		<compat> 11AD
+3137		<compat> 1103
+3138		<compat> 1104
+3139		<compat> 1105
+313A		<compat> 11B0
+313B		<compat> 11B1
+313C		<compat> 11B2
+313D		<compat> 11B3
+313E		<compat> 11B4
+313F		<compat> 11B5
+3140		<compat> 111A
+3141		<compat> 1106
+3142		<compat> 1107
+3143		<compat> 1108
+3144		<compat> 1121
+3145		<compat> 1109
+3146		<compat> 110A
+3147		<compat> 110B
+3148		<compat> 110C
+3149		<compat> 110D
+314A		<compat> 110E
+314B		<compat> 110F
+314C		<compat> 1110
+314D		<compat> 1111
+314E		<compat> 1112
+314F		<compat> 1161
+3150		<compat> 1162
+3151		<compat> 1163
+3152		<compat> 1164
+3153		<compat> 1165
+3154		<compat> 1166
+3155		<compat> 1167
+3156		<compat> 1168
+3157		<compat> 1169
+3158		<compat> 116A
+3159		<compat> 116B
+315A		<compat> 116C
+315B		<compat> 116D
+315C		<compat> 116E
+315D		<compat> 116F
+315E		<compat> 1170
+315F		<compat> 1171
+3160		<compat> 1172
+3161		<compat> 1173
+3162		<compat> 1174
+3163		<compat> 1175
+3164		<compat> 1160
+3165		<compat> 1114
+3166		<compat> 1115
+3167		<compat> 11C7
+3168		<compat> 11C8
+3169		<compat> 11CC
+316A		<compat> 11CE
+316B		<compat> 11D3
+316C		<compat> 11D7
+316D		<compat> 11D9
+316E		<compat> 111C
+316F		<compat> 11DD
+3170		<compat> 11DF
+3171		<compat> 111D
+3172		<compat> 111E
+3173		<compat> 1120
+3174		<compat> 1122
+3175		<compat> 1123
+3176		<compat> 1127
+3177		<compat> 1129
+3178		<compat> 112B
+3179		<compat> 112C
+317A		<compat> 112D
+317B		<compat> 112E
+317C		<compat> 112F
+317D		<compat> 1132
+317E		<compat> 1136
+317F		<compat> 1140
+3180		<compat> 1147
+3181		<compat> 114C
+3182		<compat> 11F1
+3183		<compat> 11F2
+3184		<compat> 1157
+3185		<compat> 1158
+3186		<compat> 1159
+3187		<compat> 1184
+3188		<compat> 1185
+3189		<compat> 1188
+318A		<compat> 1191
+318B		<compat> 1192
+318C		<compat> 1194
+318D		<compat> 119E
+318E		<compat> 11A1
+3192		<super> 4E00
+3193		<super> 4E8C
+3194		<super> 4E09
+3195		<super> 56DB
+3196		<super> 4E0A
+3197		<super> 4E2D
+3198		<super> 4E0B
+3199		<super> 7532
+319A		<super> 4E59
+319B		<super> 4E19
+319C		<super> 4E01
+319D		<super> 5929
+319E		<super> 5730
+319F		<super> 4EBA
+3200		<compat> 0028 1100 0029
+3201		<compat> 0028 1102 0029
+3202		<compat> 0028 1103 0029
+3203		<compat> 0028 1105 0029
+3204		<compat> 0028 1106 0029
+3205		<compat> 0028 1107 0029
+3206		<compat> 0028 1109 0029
+3207		<compat> 0028 110B 0029
+3208		<compat> 0028 110C 0029
+3209		<compat> 0028 110E 0029
+320A		<compat> 0028 110F 0029
+320B		<compat> 0028 1110 0029
+320C		<compat> 0028 1111 0029
+320D		<compat> 0028 1112 0029
+320E		<compat> 0028 1100 1161 0029
+320F		<compat> 0028 1102 1161 0029
+3210		<compat> 0028 1103 1161 0029
+3211		<compat> 0028 1105 1161 0029
+3212		<compat> 0028 1106 1161 0029
+3213		<compat> 0028 1107 1161 0029
+3214		<compat> 0028 1109 1161 0029
+3215		<compat> 0028 110B 1161 0029
+3216		<compat> 0028 110C 1161 0029
+3217		<compat> 0028 110E 1161 0029
+3218		<compat> 0028 110F 1161 0029
+3219		<compat> 0028 1110 1161 0029
+321A		<compat> 0028 1111 1161 0029
+321B		<compat> 0028 1112 1161 0029
+321C		<compat> 0028 110C 116E 0029
+321D		<compat> 0028 110B 1169 110C 1165 11AB 0029
+321E		<compat> 0028 110B 1169 1112 116E 0029
+3220		<compat> 0028 4E00 0029
+3221		<compat> 0028 4E8C 0029
+3222		<compat> 0028 4E09 0029
+3223		<compat> 0028 56DB 0029
+3224		<compat> 0028 4E94 0029
+3225		<compat> 0028 516D 0029
+3226		<compat> 0028 4E03 0029
+3227		<compat> 0028 516B 0029
+3228		<compat> 0028 4E5D 0029
+3229		<compat> 0028 5341 0029
+322A		<compat> 0028 6708 0029
+322B		<compat> 0028 706B 0029
+322C		<compat> 0028 6C34 0029
+322D		<compat> 0028 6728 0029
+322E		<compat> 0028 91D1 0029
+322F		<compat> 0028 571F 0029
+3230		<compat> 0028 65E5 0029
+3231		<compat> 0028 682A 0029
+3232		<compat> 0028 6709 0029
+3233		<compat> 0028 793E 0029
+3234		<compat> 0028 540D 0029
+3235		<compat> 0028 7279 0029
+3236		<compat> 0028 8CA1 0029
+3237		<compat> 0028 795D 0029
+3238		<compat> 0028 52B4 0029
+3239		<compat> 0028 4EE3 0029
+323A		<compat> 0028 547C 0029
+323B		<compat> 0028 5B66 0029
+323C		<compat> 0028 76E3 0029
+323D		<compat> 0028 4F01 0029
+323E		<compat> 0028 8CC7 0029
+323F		<compat> 0028 5354 0029
+3240		<compat> 0028 796D 0029
+3241		<compat> 0028 4F11 0029
+3242		<compat> 0028 81EA 0029
+3243		<compat> 0028 81F3 0029
+3244		<circle> 554F
+3245		<circle> 5E7C
+3246		<circle> 6587
+3247		<circle> 7B8F
+3250		<square> 0050 0054 0045
+3251		<circle> 0032 0031
+3252		<circle> 0032 0032
+3253		<circle> 0032 0033
+3254		<circle> 0032 0034
+3255		<circle> 0032 0035
+3256		<circle> 0032 0036
+3257		<circle> 0032 0037
+3258		<circle> 0032 0038
+3259		<circle> 0032 0039
+325A		<circle> 0033 0030
+325B		<circle> 0033 0031
+325C		<circle> 0033 0032
+325D		<circle> 0033 0033
+325E		<circle> 0033 0034
+325F		<circle> 0033 0035
+3260		<circle> 1100
+3261		<circle> 1102
+3262		<circle> 1103
+3263		<circle> 1105
+3264		<circle> 1106
+3265		<circle> 1107
+3266		<circle> 1109
+3267		<circle> 110B
+3268		<circle> 110C
+3269		<circle> 110E
+326A		<circle> 110F
+326B		<circle> 1110
+326C		<circle> 1111
+326D		<circle> 1112
+326E		<circle> 1100 1161
+326F		<circle> 1102 1161
+3270		<circle> 1103 1161
+3271		<circle> 1105 1161
+3272		<circle> 1106 1161
+3273		<circle> 1107 1161
+3274		<circle> 1109 1161
+3275		<circle> 110B 1161
+3276		<circle> 110C 1161
+3277		<circle> 110E 1161
+3278		<circle> 110F 1161
+3279		<circle> 1110 1161
+327A		<circle> 1111 1161
+327B		<circle> 1112 1161
+327C		<circle> 110E 1161 11B7 1100 1169
+327D		<circle> 110C 116E 110B 1174
+327E		<circle> 110B 116E
+3280		<circle> 4E00
+3281		<circle> 4E8C
+3282		<circle> 4E09
+3283		<circle> 56DB
+3284		<circle> 4E94
+3285		<circle> 516D
+3286		<circle> 4E03
+3287		<circle> 516B
+3288		<circle> 4E5D
+3289		<circle> 5341
+328A		<circle> 6708
+328B		<circle> 706B
+328C		<circle> 6C34
+328D		<circle> 6728
+328E		<circle> 91D1
+328F		<circle> 571F
+3290		<circle> 65E5
+3291		<circle> 682A
+3292		<circle> 6709
+3293		<circle> 793E
+3294		<circle> 540D
+3295		<circle> 7279
+3296		<circle> 8CA1
+3297		<circle> 795D
+3298		<circle> 52B4
+3299		<circle> 79D8
+329A		<circle> 7537
+329B		<circle> 5973
+329C		<circle> 9069
+329D		<circle> 512A
+329E		<circle> 5370
+329F		<circle> 6CE8
+32A0		<circle> 9805
+32A1		<circle> 4F11
+32A2		<circle> 5199
+32A3		<circle> 6B63
+32A4		<circle> 4E0A
+32A5		<circle> 4E2D
+32A6		<circle> 4E0B
+32A7		<circle> 5DE6
+32A8		<circle> 53F3
+32A9		<circle> 533B
+32AA		<circle> 5B97
+32AB		<circle> 5B66
+32AC		<circle> 76E3
+32AD		<circle> 4F01
+32AE		<circle> 8CC7
+32AF		<circle> 5354
+32B0		<circle> 591C
+32B1		<circle> 0033 0036
+32B2		<circle> 0033 0037
+32B3		<circle> 0033 0038
+32B4		<circle> 0033 0039
+32B5		<circle> 0034 0030
+32B6		<circle> 0034 0031
+32B7		<circle> 0034 0032
+32B8		<circle> 0034 0033
+32B9		<circle> 0034 0034
+32BA		<circle> 0034 0035
+32BB		<circle> 0034 0036
+32BC		<circle> 0034 0037
+32BD		<circle> 0034 0038
+32BE		<circle> 0034 0039
+32BF		<circle> 0035 0030
+32C0		<compat> 0031 6708
+32C1		<compat> 0032 6708
+32C2		<compat> 0033 6708
+32C3		<compat> 0034 6708
+32C4		<compat> 0035 6708
+32C5		<compat> 0036 6708
+32C6		<compat> 0037 6708
+32C7		<compat> 0038 6708
+32C8		<compat> 0039 6708
+32C9		<compat> 0031 0030 6708
+32CA		<compat> 0031 0031 6708
+32CB		<compat> 0031 0032 6708
+32CC		<square> 0048 0067
+32CD		<square> 0065 0072 0067
+32CE		<square> 0065 0056
+32CF		<square> 004C 0054 0044
+32D0		<circle> 30A2
+32D1		<circle> 30A4
+32D2		<circle> 30A6
+32D3		<circle> 30A8
+32D4		<circle> 30AA
+32D5		<circle> 30AB
+32D6		<circle> 30AD
+32D7		<circle> 30AF
+32D8		<circle> 30B1
+32D9		<circle> 30B3
+32DA		<circle> 30B5
+32DB		<circle> 30B7
+32DC		<circle> 30B9
+32DD		<circle> 30BB
+32DE		<circle> 30BD
+32DF		<circle> 30BF
+32E0		<circle> 30C1
+32E1		<circle> 30C4
+32E2		<circle> 30C6
+32E3		<circle> 30C8
+32E4		<circle> 30CA
+32E5		<circle> 30CB
+32E6		<circle> 30CC
+32E7		<circle> 30CD
+32E8		<circle> 30CE
+32E9		<circle> 30CF
+32EA		<circle> 30D2
+32EB		<circle> 30D5
+32EC		<circle> 30D8
+32ED		<circle> 30DB
+32EE		<circle> 30DE
+32EF		<circle> 30DF
+32F0		<circle> 30E0
+32F1		<circle> 30E1
+32F2		<circle> 30E2
+32F3		<circle> 30E4
+32F4		<circle> 30E6
+32F5		<circle> 30E8
+32F6		<circle> 30E9
+32F7		<circle> 30EA
+32F8		<circle> 30EB
+32F9		<circle> 30EC
+32FA		<circle> 30ED
+32FB		<circle> 30EF
+32FC		<circle> 30F0
+32FD		<circle> 30F1
+32FE		<circle> 30F2
+32FF		<square> 4EE4 548C
+3300		<square> 30A2 30D1 30FC 30C8
+3301		<square> 30A2 30EB 30D5 30A1
+3302		<square> 30A2 30F3 30DA 30A2
+3303		<square> 30A2 30FC 30EB
+3304		<square> 30A4 30CB 30F3 30B0
+3305		<square> 30A4 30F3 30C1
+3306		<square> 30A6 30A9 30F3
+3307		<square> 30A8 30B9 30AF 30FC 30C9
+3308		<square> 30A8 30FC 30AB 30FC
+3309		<square> 30AA 30F3 30B9
+330A		<square> 30AA 30FC 30E0
+330B		<square> 30AB 30A4 30EA
+330C		<square> 30AB 30E9 30C3 30C8
+330D		<square> 30AB 30ED 30EA 30FC
+330E		<square> 30AC 30ED 30F3
+330F		<square> 30AC 30F3 30DE
+3310		<square> 30AE 30AC
+3311		<square> 30AE 30CB 30FC
+3312		<square> 30AD 30E5 30EA 30FC
+3313		<square> 30AE 30EB 30C0 30FC
+3314		<square> 30AD 30ED
+3315		<square> 30AD 30ED 30B0 30E9 30E0
+3316		<square> 30AD 30ED 30E1 30FC 30C8 30EB
+3317		<square> 30AD 30ED 30EF 30C3 30C8
+3318		<square> 30B0 30E9 30E0
+3319		<square> 30B0 30E9 30E0 30C8 30F3
+331A		<square> 30AF 30EB 30BC 30A4 30ED
+331B		<square> 30AF 30ED 30FC 30CD
+331C		<square> 30B1 30FC 30B9
+331D		<square> 30B3 30EB 30CA
+331E		<square> 30B3 30FC 30DD
+331F		<square> 30B5 30A4 30AF 30EB
+3320		<square> 30B5 30F3 30C1 30FC 30E0
+3321		<square> 30B7 30EA 30F3 30B0
+3322		<square> 30BB 30F3 30C1
+3323		<square> 30BB 30F3 30C8
+3324		<square> 30C0 30FC 30B9
+3325		<square> 30C7 30B7
+3326		<square> 30C9 30EB
+3327		<square> 30C8 30F3
+3328		<square> 30CA 30CE
+3329		<square> 30CE 30C3 30C8
+332A		<square> 30CF 30A4 30C4
+332B		<square> 30D1 30FC 30BB 30F3 30C8
+332C		<square> 30D1 30FC 30C4
+332D		<square> 30D0 30FC 30EC 30EB
+332E		<square> 30D4 30A2 30B9 30C8 30EB
+332F		<square> 30D4 30AF 30EB
+3330		<square> 30D4 30B3
+3331		<square> 30D3 30EB
+3332		<square> 30D5 30A1 30E9 30C3 30C9
+3333		<square> 30D5 30A3 30FC 30C8
+3334		<square> 30D6 30C3 30B7 30A7 30EB
+3335		<square> 30D5 30E9 30F3
+3336		<square> 30D8 30AF 30BF 30FC 30EB
+3337		<square> 30DA 30BD
+3338		<square> 30DA 30CB 30D2
+3339		<square> 30D8 30EB 30C4
+333A		<square> 30DA 30F3 30B9
+333B		<square> 30DA 30FC 30B8
+333C		<square> 30D9 30FC 30BF
+333D		<square> 30DD 30A4 30F3 30C8
+333E		<square> 30DC 30EB 30C8
+333F		<square> 30DB 30F3
+3340		<square> 30DD 30F3 30C9
+3341		<square> 30DB 30FC 30EB
+3342		<square> 30DB 30FC 30F3
+3343		<square> 30DE 30A4 30AF 30ED
+3344		<square> 30DE 30A4 30EB
+3345		<square> 30DE 30C3 30CF
+3346		<square> 30DE 30EB 30AF
+3347		<square> 30DE 30F3 30B7 30E7 30F3
+3348		<square> 30DF 30AF 30ED 30F3
+3349		<square> 30DF 30EA
+334A		<square> 30DF 30EA 30D0 30FC 30EB
+334B		<square> 30E1 30AC
+334C		<square> 30E1 30AC 30C8 30F3
+334D		<square> 30E1 30FC 30C8 30EB
+334E		<square> 30E4 30FC 30C9
+334F		<square> 30E4 30FC 30EB
+3350		<square> 30E6 30A2 30F3
+3351		<square> 30EA 30C3 30C8 30EB
+3352		<square> 30EA 30E9
+3353		<square> 30EB 30D4 30FC
+3354		<square> 30EB 30FC 30D6 30EB
+3355		<square> 30EC 30E0
+3356		<square> 30EC 30F3 30C8 30B2 30F3
+3357		<square> 30EF 30C3 30C8
+3358		<compat> 0030 70B9
+3359		<compat> 0031 70B9
+335A		<compat> 0032 70B9
+335B		<compat> 0033 70B9
+335C		<compat> 0034 70B9
+335D		<compat> 0035 70B9
+335E		<compat> 0036 70B9
+335F		<compat> 0037 70B9
+3360		<compat> 0038 70B9
+3361		<compat> 0039 70B9
+3362		<compat> 0031 0030 70B9
+3363		<compat> 0031 0031 70B9
+3364		<compat> 0031 0032 70B9
+3365		<compat> 0031 0033 70B9
+3366		<compat> 0031 0034 70B9
+3367		<compat> 0031 0035 70B9
+3368		<compat> 0031 0036 70B9
+3369		<compat> 0031 0037 70B9
+336A		<compat> 0031 0038 70B9
+336B		<compat> 0031 0039 70B9
+336C		<compat> 0032 0030 70B9
+336D		<compat> 0032 0031 70B9
+336E		<compat> 0032 0032 70B9
+336F		<compat> 0032 0033 70B9
+3370		<compat> 0032 0034 70B9
+3371		<square> 0068 0050 0061
+3372		<square> 0064 0061
+3373		<square> 0041 0055
+3374		<square> 0062 0061 0072
+3375		<square> 006F 0056
+3376		<square> 0070 0063
+3377		<square> 0064 006D
+3378		<square> 0064 006D 00B2
+3379		<square> 0064 006D 00B3
+337A		<square> 0049 0055
+337B		<square> 5E73 6210
+337C		<square> 662D 548C
+337D		<square> 5927 6B63
+337E		<square> 660E 6CBB
+337F		<square> 682A 5F0F 4F1A 793E
+3380		<square> 0070 0041
+3381		<square> 006E 0041
+3382		<square> 03BC 0041
+3383		<square> 006D 0041
+3384		<square> 006B 0041
+3385		<square> 004B 0042
+3386		<square> 004D 0042
+3387		<square> 0047 0042
+3388		<square> 0063 0061 006C
+3389		<square> 006B 0063 0061 006C
+338A		<square> 0070 0046
+338B		<square> 006E 0046
+338C		<square> 03BC 0046
+338D		<square> 03BC 0067
+338E		<square> 006D 0067
+338F		<square> 006B 0067
+3390		<square> 0048 007A
+3391		<square> 006B 0048 007A
+3392		<square> 004D 0048 007A
+3393		<square> 0047 0048 007A
+3394		<square> 0054 0048 007A
+3395		<square> 03BC 2113
+3396		<square> 006D 2113
+3397		<square> 0064 2113
+3398		<square> 006B 2113
+3399		<square> 0066 006D
+339A		<square> 006E 006D
+339B		<square> 03BC 006D
+339C		<square> 006D 006D
+339D		<square> 0063 006D
+339E		<square> 006B 006D
+339F		<square> 006D 006D 00B2
+33A0		<square> 0063 006D 00B2
+33A1		<square> 006D 00B2
+33A2		<square> 006B 006D 00B2
+33A3		<square> 006D 006D 00B3
+33A4		<square> 0063 006D 00B3
+33A5		<square> 006D 00B3
+33A6		<square> 006B 006D 00B3
+33A7		<square> 006D 2215 0073
+33A8		<square> 006D 2215 0073 00B2
+33A9		<square> 0050 0061
+33AA		<square> 006B 0050 0061
+33AB		<square> 004D 0050 0061
+33AC		<square> 0047 0050 0061
+33AD		<square> 0072 0061 0064
+33AE		<square> 0072 0061 0064 2215 0073
+33AF		<square> 0072 0061 0064 2215 0073 00B2
+33B0		<square> 0070 0073
+33B1		<square> 006E 0073
+33B2		<square> 03BC 0073
+33B3		<square> 006D 0073
+33B4		<square> 0070 0056
+33B5		<square> 006E 0056
+33B6		<square> 03BC 0056
+33B7		<square> 006D 0056
+33B8		<square> 006B 0056
+33B9		<square> 004D 0056
+33BA		<square> 0070 0057
+33BB		<square> 006E 0057
+33BC		<square> 03BC 0057
+33BD		<square> 006D 0057
+33BE		<square> 006B 0057
+33BF		<square> 004D 0057
+33C0		<square> 006B 03A9
+33C1		<square> 004D 03A9
+33C2		<square> 0061 002E 006D 002E
+33C3		<square> 0042 0071
+33C4		<square> 0063 0063
+33C5		<square> 0063 0064
+33C6		<square> 0043 2215 006B 0067
+33C7		<square> 0043 006F 002E
+33C8		<square> 0064 0042
+33C9		<square> 0047 0079
+33CA		<square> 0068 0061
+33CB		<square> 0048 0050
+33CC		<square> 0069 006E
+33CD		<square> 004B 004B
+33CE		<square> 004B 004D
+33CF		<square> 006B 0074
+33D0		<square> 006C 006D
+33D1		<square> 006C 006E
+33D2		<square> 006C 006F 0067
+33D3		<square> 006C 0078
+33D4		<square> 006D 0062
+33D5		<square> 006D 0069 006C
+33D6		<square> 006D 006F 006C
+33D7		<square> 0050 0048
+33D8		<square> 0070 002E 006D 002E
+33D9		<square> 0050 0050 004D
+33DA		<square> 0050 0052
+33DB		<square> 0073 0072
+33DC		<square> 0053 0076
+33DD		<square> 0057 0062
+33DE		<square> 0056 2215 006D
+33DF		<square> 0041 2215 006D
+33E0		<compat> 0031 65E5
+33E1		<compat> 0032 65E5
+33E2		<compat> 0033 65E5
+33E3		<compat> 0034 65E5
+33E4		<compat> 0035 65E5
+33E5		<compat> 0036 65E5
+33E6		<compat> 0037 65E5
+33E7		<compat> 0038 65E5
+33E8		<compat> 0039 65E5
+33E9		<compat> 0031 0030 65E5
+33EA		<compat> 0031 0031 65E5
+33EB		<compat> 0031 0032 65E5
+33EC		<compat> 0031 0033 65E5
+33ED		<compat> 0031 0034 65E5
+33EE		<compat> 0031 0035 65E5
+33EF		<compat> 0031 0036 65E5
+33F0		<compat> 0031 0037 65E5
+33F1		<compat> 0031 0038 65E5
+33F2		<compat> 0031 0039 65E5
+33F3		<compat> 0032 0030 65E5
+33F4		<compat> 0032 0031 65E5
+33F5		<compat> 0032 0032 65E5
+33F6		<compat> 0032 0033 65E5
+33F7		<compat> 0032 0034 65E5
+33F8		<compat> 0032 0035 65E5
+33F9		<compat> 0032 0036 65E5
+33FA		<compat> 0032 0037 65E5
+33FB		<compat> 0032 0038 65E5
+33FC		<compat> 0032 0039 65E5
+33FD		<compat> 0033 0030 65E5
+33FE		<compat> 0033 0031 65E5
+33FF		<square> 0067 0061 006C
+A69C		<super> 044A
+A69D		<super> 044C
+A770		<super> A76F
+A7F8		<super> 0126
+A7F9		<super> 0153
+AB5C		<super> A727
+AB5D		<super> AB37
+AB5E		<super> 026B
+AB5F		<super> AB52
+F900		8C48
+F901		66F4
+F902		8ECA
+F903		8CC8
+F904		6ED1
+F905		4E32
+F906		53E5
+F907	F908	9F9C
+F909		5951
+F90A		91D1
+F90B		5587
+F90C		5948
+F90D		61F6
+F90E		7669
+F90F		7F85
+F910		863F
+F911		87BA
+F912		88F8
+F913		908F
+F914		6A02
+F915		6D1B
+F916		70D9
+F917		73DE
+F918		843D
+F919		916A
+F91A		99F1
+F91B		4E82
+F91C		5375
+F91D		6B04
+F91E		721B
+F91F		862D
+F920		9E1E
+F921		5D50
+F922		6FEB
+F923		85CD
+F924		8964
+F925		62C9
+F926		81D8
+F927		881F
+F928		5ECA
+F929		6717
+F92A		6D6A
+F92B		72FC
+F92C		90CE
+F92D		4F86
+F92E		51B7
+F92F		52DE
+F930		64C4
+F931		6AD3
+F932		7210
+F933		76E7
+F934		8001
+F935		8606
+F936		865C
+F937		8DEF
+F938		9732
+F939		9B6F
+F93A		9DFA
+F93B		788C
+F93C		797F
+F93D		7DA0
+F93E		83C9
+F93F		9304
+F940		9E7F
+F941		8AD6
+F942		58DF
+F943		5F04
+F944		7C60
+F945		807E
+F946		7262
+F947		78CA
+F948		8CC2
+F949		96F7
+F94A		58D8
+F94B		5C62
+F94C		6A13
+F94D		6DDA
+F94E		6F0F
+F94F		7D2F
+F950		7E37
+F951		964B
+F952		52D2
+F953		808B
+F954		51DC
+F955		51CC
+F956		7A1C
+F957		7DBE
+F958		83F1
+F959		9675
+F95A		8B80
+F95B		62CF
+F95C		6A02
+F95D		8AFE
+F95E		4E39
+F95F		5BE7
+F960		6012
+F961		7387
+F962		7570
+F963		5317
+F964		78FB
+F965		4FBF
+F966		5FA9
+F967		4E0D
+F968		6CCC
+F969		6578
+F96A		7D22
+F96B		53C3
+F96C		585E
+F96D		7701
+F96E		8449
+F96F		8AAA
+F970		6BBA
+F971		8FB0
+F972		6C88
+F973		62FE
+F974		82E5
+F975		63A0
+F976		7565
+F977		4EAE
+F978		5169
+F979		51C9
+F97A		6881
+F97B		7CE7
+F97C		826F
+F97D		8AD2
+F97E		91CF
+F97F		52F5
+F980		5442
+F981		5973
+F982		5EEC
+F983		65C5
+F984		6FFE
+F985		792A
+F986		95AD
+F987		9A6A
+F988		9E97
+F989		9ECE
+F98A		529B
+F98B		66C6
+F98C		6B77
+F98D		8F62
+F98E		5E74
+F98F		6190
+F990		6200
+F991		649A
+F992		6F23
+F993		7149
+F994		7489
+F995		79CA
+F996		7DF4
+F997		806F
+F998		8F26
+F999		84EE
+F99A		9023
+F99B		934A
+F99C		5217
+F99D		52A3
+F99E		54BD
+F99F		70C8
+F9A0		88C2
+F9A1		8AAA
+F9A2		5EC9
+F9A3		5FF5
+F9A4		637B
+F9A5		6BAE
+F9A6		7C3E
+F9A7		7375
+F9A8		4EE4
+F9A9		56F9
+F9AA		5BE7
+F9AB		5DBA
+F9AC		601C
+F9AD		73B2
+F9AE		7469
+F9AF		7F9A
+F9B0		8046
+F9B1		9234
+F9B2		96F6
+F9B3		9748
+F9B4		9818
+F9B5		4F8B
+F9B6		79AE
+F9B7		91B4
+F9B8		96B8
+F9B9		60E1
+F9BA		4E86
+F9BB		50DA
+F9BC		5BEE
+F9BD		5C3F
+F9BE		6599
+F9BF		6A02
+F9C0		71CE
+F9C1		7642
+F9C2		84FC
+F9C3		907C
+F9C4		9F8D
+F9C5		6688
+F9C6		962E
+F9C7		5289
+F9C8		677B
+F9C9		67F3
+F9CA		6D41
+F9CB		6E9C
+F9CC		7409
+F9CD		7559
+F9CE		786B
+F9CF		7D10
+F9D0		985E
+F9D1		516D
+F9D2		622E
+F9D3		9678
+F9D4		502B
+F9D5		5D19
+F9D6		6DEA
+F9D7		8F2A
+F9D8		5F8B
+F9D9		6144
+F9DA		6817
+F9DB		7387
+F9DC		9686
+F9DD		5229
+F9DE		540F
+F9DF		5C65
+F9E0		6613
+F9E1		674E
+F9E2		68A8
+F9E3		6CE5
+F9E4		7406
+F9E5		75E2
+F9E6		7F79
+F9E7		88CF
+F9E8		88E1
+F9E9		91CC
+F9EA		96E2
+F9EB		533F
+F9EC		6EBA
+F9ED		541D
+F9EE		71D0
+F9EF		7498
+F9F0		85FA
+F9F1		96A3
+F9F2		9C57
+F9F3		9E9F
+F9F4		6797
+F9F5		6DCB
+F9F6		81E8
+F9F7		7ACB
+F9F8		7B20
+F9F9		7C92
+F9FA		72C0
+F9FB		7099
+F9FC		8B58
+F9FD		4EC0
+F9FE		8336
+F9FF		523A
+FA00		5207
+FA01		5EA6
+FA02		62D3
+FA03		7CD6
+FA04		5B85
+FA05		6D1E
+FA06		66B4
+FA07		8F3B
+FA08		884C
+FA09		964D
+FA0A		898B
+FA0B		5ED3
+FA0C		5140
+FA0D		55C0
+FA10		585A
+FA12		6674
+FA15		51DE
+FA16		732A
+FA17		76CA
+FA18		793C
+FA19		795E
+FA1A		7965
+FA1B		798F
+FA1C		9756
+FA1D		7CBE
+FA1E		7FBD
+FA20		8612
+FA22		8AF8
+FA25		9038
+FA26		90FD
+FA2A		98EF
+FA2B		98FC
+FA2C		9928
+FA2D		9DB4
+FA2E		90DE
+FA2F		96B7
+FA30		4FAE
+FA31		50E7
+FA32		514D
+FA33		52C9
+FA34		52E4
+FA35		5351
+FA36		559D
+FA37		5606
+FA38		5668
+FA39		5840
+FA3A		58A8
+FA3B		5C64
+FA3C		5C6E
+FA3D		6094
+FA3E		6168
+FA3F		618E
+FA40		61F2
+FA41		654F
+FA42		65E2
+FA43		6691
+FA44		6885
+FA45		6D77
+FA46		6E1A
+FA47		6F22
+FA48		716E
+FA49		722B
+FA4A		7422
+FA4B		7891
+FA4C		793E
+FA4D		7949
+FA4E		7948
+FA4F		7950
+FA50		7956
+FA51		795D
+FA52		798D
+FA53		798E
+FA54		7A40
+FA55		7A81
+FA56		7BC0
+FA57		7DF4
+FA58		7E09
+FA59		7E41
+FA5A		7F72
+FA5B		8005
+FA5C		81ED
+FA5D	FA5E	8279
+FA5F		8457
+FA60		8910
+FA61		8996
+FA62		8B01
+FA63		8B39
+FA64		8CD3
+FA65		8D08
+FA66		8FB6
+FA67		9038
+FA68		96E3
+FA69		97FF
+FA6A		983B
+FA6B		6075
+FA6C		242EE
+FA6D		8218
+FA70		4E26
+FA71		51B5
+FA72		5168
+FA73		4F80
+FA74		5145
+FA75		5180
+FA76		52C7
+FA77		52FA
+FA78		559D
+FA79		5555
+FA7A		5599
+FA7B		55E2
+FA7C		585A
+FA7D		58B3
+FA7E		5944
+FA7F		5954
+FA80		5A62
+FA81		5B28
+FA82		5ED2
+FA83		5ED9
+FA84		5F69
+FA85		5FAD
+FA86		60D8
+FA87		614E
+FA88		6108
+FA89		618E
+FA8A		6160
+FA8B		61F2
+FA8C		6234
+FA8D		63C4
+FA8E		641C
+FA8F		6452
+FA90		6556
+FA91		6674
+FA92		6717
+FA93		671B
+FA94		6756
+FA95		6B79
+FA96		6BBA
+FA97		6D41
+FA98		6EDB
+FA99		6ECB
+FA9A		6F22
+FA9B		701E
+FA9C		716E
+FA9D		77A7
+FA9E		7235
+FA9F		72AF
+FAA0		732A
+FAA1		7471
+FAA2		7506
+FAA3		753B
+FAA4		761D
+FAA5		761F
+FAA6		76CA
+FAA7		76DB
+FAA8		76F4
+FAA9		774A
+FAAA		7740
+FAAB		78CC
+FAAC		7AB1
+FAAD		7BC0
+FAAE		7C7B
+FAAF		7D5B
+FAB0		7DF4
+FAB1		7F3E
+FAB2		8005
+FAB3		8352
+FAB4		83EF
+FAB5		8779
+FAB6		8941
+FAB7		8986
+FAB8		8996
+FAB9		8ABF
+FABA		8AF8
+FABB		8ACB
+FABC		8B01
+FABD		8AFE
+FABE		8AED
+FABF		8B39
+FAC0		8B8A
+FAC1		8D08
+FAC2		8F38
+FAC3		9072
+FAC4		9199
+FAC5		9276
+FAC6		967C
+FAC7		96E3
+FAC8		9756
+FAC9		97DB
+FACA		97FF
+FACB		980B
+FACC		983B
+FACD		9B12
+FACE		9F9C
+FACF		2284A
+FAD0		22844
+FAD1		233D5
+FAD2		3B9D
+FAD3		4018
+FAD4		4039
+FAD5		25249
+FAD6		25CD0
+FAD7		27ED3
+FAD8		9F43
+FAD9		9F8E
+FB00		<compat> 0066 0066
+FB01		<compat> 0066 0069
+FB02		<compat> 0066 006C
+FB03		<compat> 0066 0066 0069
+FB04		<compat> 0066 0066 006C
+FB05		<compat> 017F 0074
+FB06		<compat> 0073 0074
+FB13		<compat> 0574 0576
+FB14		<compat> 0574 0565
+FB15		<compat> 0574 056B
+FB16		<compat> 057E 0576
+FB17		<compat> 0574 056D
+FB1D		05D9 05B4
+FB1F		05F2 05B7
+FB20		<font> 05E2
+FB21		<font> 05D0
+FB22		<font> 05D3
+FB23		<font> 05D4
+FB24		<font> 05DB
+FB25		<font> 05DC
+FB26		<font> 05DD
+FB27		<font> 05E8
+FB28		<font> 05EA
+FB29		<font> 002B
+FB2A		05E9 05C1
+FB2B		05E9 05C2
+FB2C		FB49 05C1
+FB2D		FB49 05C2
+FB2E		05D0 05B7
+FB2F		05D0 05B8
+FB30		05D0 05BC
+FB31		05D1 05BC
+FB32		05D2 05BC
+FB33		05D3 05BC
+FB34		05D4 05BC
+FB35		05D5 05BC
+FB36		05D6 05BC
+FB38		05D8 05BC
+FB39		05D9 05BC
+FB3A		05DA 05BC
+FB3B		05DB 05BC
+FB3C		05DC 05BC
+FB3E		05DE 05BC
+FB40		05E0 05BC
+FB41		05E1 05BC
+FB43		05E3 05BC
+FB44		05E4 05BC
+FB46		05E6 05BC
+FB47		05E7 05BC
+FB48		05E8 05BC
+FB49		05E9 05BC
+FB4A		05EA 05BC
+FB4B		05D5 05B9
+FB4C		05D1 05BF
+FB4D		05DB 05BF
+FB4E		05E4 05BF
+FB4F		<compat> 05D0 05DC
+FB50		<isolated> 0671
+FB51		<final> 0671
+FB52		<isolated> 067B
+FB53		<final> 067B
+FB54		<initial> 067B
+FB55		<medial> 067B
+FB56		<isolated> 067E
+FB57		<final> 067E
+FB58		<initial> 067E
+FB59		<medial> 067E
+FB5A		<isolated> 0680
+FB5B		<final> 0680
+FB5C		<initial> 0680
+FB5D		<medial> 0680
+FB5E		<isolated> 067A
+FB5F		<final> 067A
+FB60		<initial> 067A
+FB61		<medial> 067A
+FB62		<isolated> 067F
+FB63		<final> 067F
+FB64		<initial> 067F
+FB65		<medial> 067F
+FB66		<isolated> 0679
+FB67		<final> 0679
+FB68		<initial> 0679
+FB69		<medial> 0679
+FB6A		<isolated> 06A4
+FB6B		<final> 06A4
+FB6C		<initial> 06A4
+FB6D		<medial> 06A4
+FB6E		<isolated> 06A6
+FB6F		<final> 06A6
+FB70		<initial> 06A6
+FB71		<medial> 06A6
+FB72		<isolated> 0684
+FB73		<final> 0684
+FB74		<initial> 0684
+FB75		<medial> 0684
+FB76		<isolated> 0683
+FB77		<final> 0683
+FB78		<initial> 0683
+FB79		<medial> 0683
+FB7A		<isolated> 0686
+FB7B		<final> 0686
+FB7C		<initial> 0686
+FB7D		<medial> 0686
+FB7E		<isolated> 0687
+FB7F		<final> 0687
+FB80		<initial> 0687
+FB81		<medial> 0687
+FB82		<isolated> 068D
+FB83		<final> 068D
+FB84		<isolated> 068C
+FB85		<final> 068C
+FB86		<isolated> 068E
+FB87		<final> 068E
+FB88		<isolated> 0688
+FB89		<final> 0688
+FB8A		<isolated> 0698
+FB8B		<final> 0698
+FB8C		<isolated> 0691
+FB8D		<final> 0691
+FB8E		<isolated> 06A9
+FB8F		<final> 06A9
+FB90		<initial> 06A9
+FB91		<medial> 06A9
+FB92		<isolated> 06AF
+FB93		<final> 06AF
+FB94		<initial> 06AF
+FB95		<medial> 06AF
+FB96		<isolated> 06B3
+FB97		<final> 06B3
+FB98		<initial> 06B3
+FB99		<medial> 06B3
+FB9A		<isolated> 06B1
+FB9B		<final> 06B1
+FB9C		<initial> 06B1
+FB9D		<medial> 06B1
+FB9E		<isolated> 06BA
+FB9F		<final> 06BA
+FBA0		<isolated> 06BB
+FBA1		<final> 06BB
+FBA2		<initial> 06BB
+FBA3		<medial> 06BB
+FBA4		<isolated> 06C0
+FBA5		<final> 06C0
+FBA6		<isolated> 06C1
+FBA7		<final> 06C1
+FBA8		<initial> 06C1
+FBA9		<medial> 06C1
+FBAA		<isolated> 06BE
+FBAB		<final> 06BE
+FBAC		<initial> 06BE
+FBAD		<medial> 06BE
+FBAE		<isolated> 06D2
+FBAF		<final> 06D2
+FBB0		<isolated> 06D3
+FBB1		<final> 06D3
+FBD3		<isolated> 06AD
+FBD4		<final> 06AD
+FBD5		<initial> 06AD
+FBD6		<medial> 06AD
+FBD7		<isolated> 06C7
+FBD8		<final> 06C7
+FBD9		<isolated> 06C6
+FBDA		<final> 06C6
+FBDB		<isolated> 06C8
+FBDC		<final> 06C8
+FBDD		<isolated> 0677
+FBDE		<isolated> 06CB
+FBDF		<final> 06CB
+FBE0		<isolated> 06C5
+FBE1		<final> 06C5
+FBE2		<isolated> 06C9
+FBE3		<final> 06C9
+FBE4		<isolated> 06D0
+FBE5		<final> 06D0
+FBE6		<initial> 06D0
+FBE7		<medial> 06D0
+FBE8		<initial> 0649
+FBE9		<medial> 0649
+FBEA		<isolated> 0626 0627
+FBEB		<final> 0626 0627
+FBEC		<isolated> 0626 06D5
+FBED		<final> 0626 06D5
+FBEE		<isolated> 0626 0648
+FBEF		<final> 0626 0648
+FBF0		<isolated> 0626 06C7
+FBF1		<final> 0626 06C7
+FBF2		<isolated> 0626 06C6
+FBF3		<final> 0626 06C6
+FBF4		<isolated> 0626 06C8
+FBF5		<final> 0626 06C8
+FBF6		<isolated> 0626 06D0
+FBF7		<final> 0626 06D0
+FBF8		<initial> 0626 06D0
+FBF9		<isolated> 0626 0649
+FBFA		<final> 0626 0649
+FBFB		<initial> 0626 0649
+FBFC		<isolated> 06CC
+FBFD		<final> 06CC
+FBFE		<initial> 06CC
+FBFF		<medial> 06CC
+FC00		<isolated> 0626 062C
+FC01		<isolated> 0626 062D
+FC02		<isolated> 0626 0645
+FC03		<isolated> 0626 0649
+FC04		<isolated> 0626 064A
+FC05		<isolated> 0628 062C
+FC06		<isolated> 0628 062D
+FC07		<isolated> 0628 062E
+FC08		<isolated> 0628 0645
+FC09		<isolated> 0628 0649
+FC0A		<isolated> 0628 064A
+FC0B		<isolated> 062A 062C
+FC0C		<isolated> 062A 062D
+FC0D		<isolated> 062A 062E
+FC0E		<isolated> 062A 0645
+FC0F		<isolated> 062A 0649
+FC10		<isolated> 062A 064A
+FC11		<isolated> 062B 062C
+FC12		<isolated> 062B 0645
+FC13		<isolated> 062B 0649
+FC14		<isolated> 062B 064A
+FC15		<isolated> 062C 062D
+FC16		<isolated> 062C 0645
+FC17		<isolated> 062D 062C
+FC18		<isolated> 062D 0645
+FC19		<isolated> 062E 062C
+FC1A		<isolated> 062E 062D
+FC1B		<isolated> 062E 0645
+FC1C		<isolated> 0633 062C
+FC1D		<isolated> 0633 062D
+FC1E		<isolated> 0633 062E
+FC1F		<isolated> 0633 0645
+FC20		<isolated> 0635 062D
+FC21		<isolated> 0635 0645
+FC22		<isolated> 0636 062C
+FC23		<isolated> 0636 062D
+FC24		<isolated> 0636 062E
+FC25		<isolated> 0636 0645
+FC26		<isolated> 0637 062D
+FC27		<isolated> 0637 0645
+FC28		<isolated> 0638 0645
+FC29		<isolated> 0639 062C
+FC2A		<isolated> 0639 0645
+FC2B		<isolated> 063A 062C
+FC2C		<isolated> 063A 0645
+FC2D		<isolated> 0641 062C
+FC2E		<isolated> 0641 062D
+FC2F		<isolated> 0641 062E
+FC30		<isolated> 0641 0645
+FC31		<isolated> 0641 0649
+FC32		<isolated> 0641 064A
+FC33		<isolated> 0642 062D
+FC34		<isolated> 0642 0645
+FC35		<isolated> 0642 0649
+FC36		<isolated> 0642 064A
+FC37		<isolated> 0643 0627
+FC38		<isolated> 0643 062C
+FC39		<isolated> 0643 062D
+FC3A		<isolated> 0643 062E
+FC3B		<isolated> 0643 0644
+FC3C		<isolated> 0643 0645
+FC3D		<isolated> 0643 0649
+FC3E		<isolated> 0643 064A
+FC3F		<isolated> 0644 062C
+FC40		<isolated> 0644 062D
+FC41		<isolated> 0644 062E
+FC42		<isolated> 0644 0645
+FC43		<isolated> 0644 0649
+FC44		<isolated> 0644 064A
+FC45		<isolated> 0645 062C
+FC46		<isolated> 0645 062D
+FC47		<isolated> 0645 062E
+FC48		<isolated> 0645 0645
+FC49		<isolated> 0645 0649
+FC4A		<isolated> 0645 064A
+FC4B		<isolated> 0646 062C
+FC4C		<isolated> 0646 062D
+FC4D		<isolated> 0646 062E
+FC4E		<isolated> 0646 0645
+FC4F		<isolated> 0646 0649
+FC50		<isolated> 0646 064A
+FC51		<isolated> 0647 062C
+FC52		<isolated> 0647 0645
+FC53		<isolated> 0647 0649
+FC54		<isolated> 0647 064A
+FC55		<isolated> 064A 062C
+FC56		<isolated> 064A 062D
+FC57		<isolated> 064A 062E
+FC58		<isolated> 064A 0645
+FC59		<isolated> 064A 0649
+FC5A		<isolated> 064A 064A
+FC5B		<isolated> 0630 0670
+FC5C		<isolated> 0631 0670
+FC5D		<isolated> 0649 0670
+FC5E		<isolated> 0020 064C 0651
+FC5F		<isolated> 0020 064D 0651
+FC60		<isolated> 0020 064E 0651
+FC61		<isolated> 0020 064F 0651
+FC62		<isolated> 0020 0650 0651
+FC63		<isolated> 0020 0651 0670
+FC64		<final> 0626 0631
+FC65		<final> 0626 0632
+FC66		<final> 0626 0645
+FC67		<final> 0626 0646
+FC68		<final> 0626 0649
+FC69		<final> 0626 064A
+FC6A		<final> 0628 0631
+FC6B		<final> 0628 0632
+FC6C		<final> 0628 0645
+FC6D		<final> 0628 0646
+FC6E		<final> 0628 0649
+FC6F		<final> 0628 064A
+FC70		<final> 062A 0631
+FC71		<final> 062A 0632
+FC72		<final> 062A 0645
+FC73		<final> 062A 0646
+FC74		<final> 062A 0649
+FC75		<final> 062A 064A
+FC76		<final> 062B 0631
+FC77		<final> 062B 0632
+FC78		<final> 062B 0645
+FC79		<final> 062B 0646
+FC7A		<final> 062B 0649
+FC7B		<final> 062B 064A
+FC7C		<final> 0641 0649
+FC7D		<final> 0641 064A
+FC7E		<final> 0642 0649
+FC7F		<final> 0642 064A
+FC80		<final> 0643 0627
+FC81		<final> 0643 0644
+FC82		<final> 0643 0645
+FC83		<final> 0643 0649
+FC84		<final> 0643 064A
+FC85		<final> 0644 0645
+FC86		<final> 0644 0649
+FC87		<final> 0644 064A
+FC88		<final> 0645 0627
+FC89		<final> 0645 0645
+FC8A		<final> 0646 0631
+FC8B		<final> 0646 0632
+FC8C		<final> 0646 0645
+FC8D		<final> 0646 0646
+FC8E		<final> 0646 0649
+FC8F		<final> 0646 064A
+FC90		<final> 0649 0670
+FC91		<final> 064A 0631
+FC92		<final> 064A 0632
+FC93		<final> 064A 0645
+FC94		<final> 064A 0646
+FC95		<final> 064A 0649
+FC96		<final> 064A 064A
+FC97		<initial> 0626 062C
+FC98		<initial> 0626 062D
+FC99		<initial> 0626 062E
+FC9A		<initial> 0626 0645
+FC9B		<initial> 0626 0647
+FC9C		<initial> 0628 062C
+FC9D		<initial> 0628 062D
+FC9E		<initial> 0628 062E
+FC9F		<initial> 0628 0645
+FCA0		<initial> 0628 0647
+FCA1		<initial> 062A 062C
+FCA2		<initial> 062A 062D
+FCA3		<initial> 062A 062E
+FCA4		<initial> 062A 0645
+FCA5		<initial> 062A 0647
+FCA6		<initial> 062B 0645
+FCA7		<initial> 062C 062D
+FCA8		<initial> 062C 0645
+FCA9		<initial> 062D 062C
+FCAA		<initial> 062D 0645
+FCAB		<initial> 062E 062C
+FCAC		<initial> 062E 0645
+FCAD		<initial> 0633 062C
+FCAE		<initial> 0633 062D
+FCAF		<initial> 0633 062E
+FCB0		<initial> 0633 0645
+FCB1		<initial> 0635 062D
+FCB2		<initial> 0635 062E
+FCB3		<initial> 0635 0645
+FCB4		<initial> 0636 062C
+FCB5		<initial> 0636 062D
+FCB6		<initial> 0636 062E
+FCB7		<initial> 0636 0645
+FCB8		<initial> 0637 062D
+FCB9		<initial> 0638 0645
+FCBA		<initial> 0639 062C
+FCBB		<initial> 0639 0645
+FCBC		<initial> 063A 062C
+FCBD		<initial> 063A 0645
+FCBE		<initial> 0641 062C
+FCBF		<initial> 0641 062D
+FCC0		<initial> 0641 062E
+FCC1		<initial> 0641 0645
+FCC2		<initial> 0642 062D
+FCC3		<initial> 0642 0645
+FCC4		<initial> 0643 062C
+FCC5		<initial> 0643 062D
+FCC6		<initial> 0643 062E
+FCC7		<initial> 0643 0644
+FCC8		<initial> 0643 0645
+FCC9		<initial> 0644 062C
+FCCA		<initial> 0644 062D
+FCCB		<initial> 0644 062E
+FCCC		<initial> 0644 0645
+FCCD		<initial> 0644 0647
+FCCE		<initial> 0645 062C
+FCCF		<initial> 0645 062D
+FCD0		<initial> 0645 062E
+FCD1		<initial> 0645 0645
+FCD2		<initial> 0646 062C
+FCD3		<initial> 0646 062D
+FCD4		<initial> 0646 062E
+FCD5		<initial> 0646 0645
+FCD6		<initial> 0646 0647
+FCD7		<initial> 0647 062C
+FCD8		<initial> 0647 0645
+FCD9		<initial> 0647 0670
+FCDA		<initial> 064A 062C
+FCDB		<initial> 064A 062D
+FCDC		<initial> 064A 062E
+FCDD		<initial> 064A 0645
+FCDE		<initial> 064A 0647
+FCDF		<medial> 0626 0645
+FCE0		<medial> 0626 0647
+FCE1		<medial> 0628 0645
+FCE2		<medial> 0628 0647
+FCE3		<medial> 062A 0645
+FCE4		<medial> 062A 0647
+FCE5		<medial> 062B 0645
+FCE6		<medial> 062B 0647
+FCE7		<medial> 0633 0645
+FCE8		<medial> 0633 0647
+FCE9		<medial> 0634 0645
+FCEA		<medial> 0634 0647
+FCEB		<medial> 0643 0644
+FCEC		<medial> 0643 0645
+FCED		<medial> 0644 0645
+FCEE		<medial> 0646 0645
+FCEF		<medial> 0646 0647
+FCF0		<medial> 064A 0645
+FCF1		<medial> 064A 0647
+FCF2		<medial> 0640 064E 0651
+FCF3		<medial> 0640 064F 0651
+FCF4		<medial> 0640 0650 0651
+FCF5		<isolated> 0637 0649
+FCF6		<isolated> 0637 064A
+FCF7		<isolated> 0639 0649
+FCF8		<isolated> 0639 064A
+FCF9		<isolated> 063A 0649
+FCFA		<isolated> 063A 064A
+FCFB		<isolated> 0633 0649
+FCFC		<isolated> 0633 064A
+FCFD		<isolated> 0634 0649
+FCFE		<isolated> 0634 064A
+FCFF		<isolated> 062D 0649
+FD00		<isolated> 062D 064A
+FD01		<isolated> 062C 0649
+FD02		<isolated> 062C 064A
+FD03		<isolated> 062E 0649
+FD04		<isolated> 062E 064A
+FD05		<isolated> 0635 0649
+FD06		<isolated> 0635 064A
+FD07		<isolated> 0636 0649
+FD08		<isolated> 0636 064A
+FD09		<isolated> 0634 062C
+FD0A		<isolated> 0634 062D
+FD0B		<isolated> 0634 062E
+FD0C		<isolated> 0634 0645
+FD0D		<isolated> 0634 0631
+FD0E		<isolated> 0633 0631
+FD0F		<isolated> 0635 0631
+FD10		<isolated> 0636 0631
+FD11		<final> 0637 0649
+FD12		<final> 0637 064A
+FD13		<final> 0639 0649
+FD14		<final> 0639 064A
+FD15		<final> 063A 0649
+FD16		<final> 063A 064A
+FD17		<final> 0633 0649
+FD18		<final> 0633 064A
+FD19		<final> 0634 0649
+FD1A		<final> 0634 064A
+FD1B		<final> 062D 0649
+FD1C		<final> 062D 064A
+FD1D		<final> 062C 0649
+FD1E		<final> 062C 064A
+FD1F		<final> 062E 0649
+FD20		<final> 062E 064A
+FD21		<final> 0635 0649
+FD22		<final> 0635 064A
+FD23		<final> 0636 0649
+FD24		<final> 0636 064A
+FD25		<final> 0634 062C
+FD26		<final> 0634 062D
+FD27		<final> 0634 062E
+FD28		<final> 0634 0645
+FD29		<final> 0634 0631
+FD2A		<final> 0633 0631
+FD2B		<final> 0635 0631
+FD2C		<final> 0636 0631
+FD2D		<initial> 0634 062C
+FD2E		<initial> 0634 062D
+FD2F		<initial> 0634 062E
+FD30		<initial> 0634 0645
+FD31		<initial> 0633 0647
+FD32		<initial> 0634 0647
+FD33		<initial> 0637 0645
+FD34		<medial> 0633 062C
+FD35		<medial> 0633 062D
+FD36		<medial> 0633 062E
+FD37		<medial> 0634 062C
+FD38		<medial> 0634 062D
+FD39		<medial> 0634 062E
+FD3A		<medial> 0637 0645
+FD3B		<medial> 0638 0645
+FD3C		<final> 0627 064B
+FD3D		<isolated> 0627 064B
+FD50		<initial> 062A 062C 0645
+FD51		<final> 062A 062D 062C
+FD52		<initial> 062A 062D 062C
+FD53		<initial> 062A 062D 0645
+FD54		<initial> 062A 062E 0645
+FD55		<initial> 062A 0645 062C
+FD56		<initial> 062A 0645 062D
+FD57		<initial> 062A 0645 062E
+FD58		<final> 062C 0645 062D
+FD59		<initial> 062C 0645 062D
+FD5A		<final> 062D 0645 064A
+FD5B		<final> 062D 0645 0649
+FD5C		<initial> 0633 062D 062C
+FD5D		<initial> 0633 062C 062D
+FD5E		<final> 0633 062C 0649
+FD5F		<final> 0633 0645 062D
+FD60		<initial> 0633 0645 062D
+FD61		<initial> 0633 0645 062C
+FD62		<final> 0633 0645 0645
+FD63		<initial> 0633 0645 0645
+FD64		<final> 0635 062D 062D
+FD65		<initial> 0635 062D 062D
+FD66		<final> 0635 0645 0645
+FD67		<final> 0634 062D 0645
+FD68		<initial> 0634 062D 0645
+FD69		<final> 0634 062C 064A
+FD6A		<final> 0634 0645 062E
+FD6B		<initial> 0634 0645 062E
+FD6C		<final> 0634 0645 0645
+FD6D		<initial> 0634 0645 0645
+FD6E		<final> 0636 062D 0649
+FD6F		<final> 0636 062E 0645
+FD70		<initial> 0636 062E 0645
+FD71		<final> 0637 0645 062D
+FD72		<initial> 0637 0645 062D
+FD73		<initial> 0637 0645 0645
+FD74		<final> 0637 0645 064A
+FD75		<final> 0639 062C 0645
+FD76		<final> 0639 0645 0645
+FD77		<initial> 0639 0645 0645
+FD78		<final> 0639 0645 0649
+FD79		<final> 063A 0645 0645
+FD7A		<final> 063A 0645 064A
+FD7B		<final> 063A 0645 0649
+FD7C		<final> 0641 062E 0645
+FD7D		<initial> 0641 062E 0645
+FD7E		<final> 0642 0645 062D
+FD7F		<final> 0642 0645 0645
+FD80		<final> 0644 062D 0645
+FD81		<final> 0644 062D 064A
+FD82		<final> 0644 062D 0649
+FD83		<initial> 0644 062C 062C
+FD84		<final> 0644 062C 062C
+FD85		<final> 0644 062E 0645
+FD86		<initial> 0644 062E 0645
+FD87		<final> 0644 0645 062D
+FD88		<initial> 0644 0645 062D
+FD89		<initial> 0645 062D 062C
+FD8A		<initial> 0645 062D 0645
+FD8B		<final> 0645 062D 064A
+FD8C		<initial> 0645 062C 062D
+FD8D		<initial> 0645 062C 0645
+FD8E		<initial> 0645 062E 062C
+FD8F		<initial> 0645 062E 0645
+FD92		<initial> 0645 062C 062E
+FD93		<initial> 0647 0645 062C
+FD94		<initial> 0647 0645 0645
+FD95		<initial> 0646 062D 0645
+FD96		<final> 0646 062D 0649
+FD97		<final> 0646 062C 0645
+FD98		<initial> 0646 062C 0645
+FD99		<final> 0646 062C 0649
+FD9A		<final> 0646 0645 064A
+FD9B		<final> 0646 0645 0649
+FD9C		<final> 064A 0645 0645
+FD9D		<initial> 064A 0645 0645
+FD9E		<final> 0628 062E 064A
+FD9F		<final> 062A 062C 064A
+FDA0		<final> 062A 062C 0649
+FDA1		<final> 062A 062E 064A
+FDA2		<final> 062A 062E 0649
+FDA3		<final> 062A 0645 064A
+FDA4		<final> 062A 0645 0649
+FDA5		<final> 062C 0645 064A
+FDA6		<final> 062C 062D 0649
+FDA7		<final> 062C 0645 0649
+FDA8		<final> 0633 062E 0649
+FDA9		<final> 0635 062D 064A
+FDAA		<final> 0634 062D 064A
+FDAB		<final> 0636 062D 064A
+FDAC		<final> 0644 062C 064A
+FDAD		<final> 0644 0645 064A
+FDAE		<final> 064A 062D 064A
+FDAF		<final> 064A 062C 064A
+FDB0		<final> 064A 0645 064A
+FDB1		<final> 0645 0645 064A
+FDB2		<final> 0642 0645 064A
+FDB3		<final> 0646 062D 064A
+FDB4		<initial> 0642 0645 062D
+FDB5		<initial> 0644 062D 0645
+FDB6		<final> 0639 0645 064A
+FDB7		<final> 0643 0645 064A
+FDB8		<initial> 0646 062C 062D
+FDB9		<final> 0645 062E 064A
+FDBA		<initial> 0644 062C 0645
+FDBB		<final> 0643 0645 0645
+FDBC		<final> 0644 062C 0645
+FDBD		<final> 0646 062C 062D
+FDBE		<final> 062C 062D 064A
+FDBF		<final> 062D 062C 064A
+FDC0		<final> 0645 062C 064A
+FDC1		<final> 0641 0645 064A
+FDC2		<final> 0628 062D 064A
+FDC3		<initial> 0643 0645 0645
+FDC4		<initial> 0639 062C 0645
+FDC5		<initial> 0635 0645 0645
+FDC6		<final> 0633 062E 064A
+FDC7		<final> 0646 062C 064A
+FDF0		<isolated> 0635 0644 06D2
+FDF1		<isolated> 0642 0644 06D2
+FDF2		<isolated> 0627 0644 0644 0647
+FDF3		<isolated> 0627 0643 0628 0631
+FDF4		<isolated> 0645 062D 0645 062F
+FDF5		<isolated> 0635 0644 0639 0645
+FDF6		<isolated> 0631 0633 0648 0644
+FDF7		<isolated> 0639 0644 064A 0647
+FDF8		<isolated> 0648 0633 0644 0645
+FDF9		<isolated> 0635 0644 0649
+FDFA		<isolated> 0635 0644 0649 0020 0627 0644 0644 0647 0020 0639 0644 064A 0647 0020 0648 0633 0644 0645
+FDFB		<isolated> 062C 0644 0020 062C 0644 0627 0644 0647
+FDFC		<isolated> 0631 06CC 0627 0644
+FE10		<vertical> 002C
+FE11		<vertical> 3001
+FE12		<vertical> 3002
+FE13		<vertical> 003A
+FE14		<vertical> 003B
+FE15		<vertical> 0021
+FE16		<vertical> 003F
+FE17		<vertical> 3016
+FE18		<vertical> 3017
+FE19		<vertical> 2026
+FE30		<vertical> 2025
+FE31		<vertical> 2014
+FE32		<vertical> 2013
+FE33	FE34	<vertical> 005F
+FE35		<vertical> 0028
+FE36		<vertical> 0029
+FE37		<vertical> 007B
+FE38		<vertical> 007D
+FE39		<vertical> 3014
+FE3A		<vertical> 3015
+FE3B		<vertical> 3010
+FE3C		<vertical> 3011
+FE3D		<vertical> 300A
+FE3E		<vertical> 300B
+FE3F		<vertical> 3008
+FE40		<vertical> 3009
+FE41		<vertical> 300C
+FE42		<vertical> 300D
+FE43		<vertical> 300E
+FE44		<vertical> 300F
+FE47		<vertical> 005B
+FE48		<vertical> 005D
+FE49	FE4C	<compat> 203E
+FE4D	FE4F	<compat> 005F
+FE50		<small> 002C
+FE51		<small> 3001
+FE52		<small> 002E
+FE54		<small> 003B
+FE55		<small> 003A
+FE56		<small> 003F
+FE57		<small> 0021
+FE58		<small> 2014
+FE59		<small> 0028
+FE5A		<small> 0029
+FE5B		<small> 007B
+FE5C		<small> 007D
+FE5D		<small> 3014
+FE5E		<small> 3015
+FE5F		<small> 0023
+FE60		<small> 0026
+FE61		<small> 002A
+FE62		<small> 002B
+FE63		<small> 002D
+FE64		<small> 003C
+FE65		<small> 003E
+FE66		<small> 003D
+FE68		<small> 005C
+FE69		<small> 0024
+FE6A		<small> 0025
+FE6B		<small> 0040
+FE70		<isolated> 0020 064B
+FE71		<medial> 0640 064B
+FE72		<isolated> 0020 064C
+FE74		<isolated> 0020 064D
+FE76		<isolated> 0020 064E
+FE77		<medial> 0640 064E
+FE78		<isolated> 0020 064F
+FE79		<medial> 0640 064F
+FE7A		<isolated> 0020 0650
+FE7B		<medial> 0640 0650
+FE7C		<isolated> 0020 0651
+FE7D		<medial> 0640 0651
+FE7E		<isolated> 0020 0652
+FE7F		<medial> 0640 0652
+FE80		<isolated> 0621
+FE81		<isolated> 0622
+FE82		<final> 0622
+FE83		<isolated> 0623
+FE84		<final> 0623
+FE85		<isolated> 0624
+FE86		<final> 0624
+FE87		<isolated> 0625
+FE88		<final> 0625
+FE89		<isolated> 0626
+FE8A		<final> 0626
+FE8B		<initial> 0626
+FE8C		<medial> 0626
+FE8D		<isolated> 0627
+FE8E		<final> 0627
+FE8F		<isolated> 0628
+FE90		<final> 0628
+FE91		<initial> 0628
+FE92		<medial> 0628
+FE93		<isolated> 0629
+FE94		<final> 0629
+FE95		<isolated> 062A
+FE96		<final> 062A
+FE97		<initial> 062A
+FE98		<medial> 062A
+FE99		<isolated> 062B
+FE9A		<final> 062B
+FE9B		<initial> 062B
+FE9C		<medial> 062B
+FE9D		<isolated> 062C
+FE9E		<final> 062C
+FE9F		<initial> 062C
+FEA0		<medial> 062C
+FEA1		<isolated> 062D
+FEA2		<final> 062D
+FEA3		<initial> 062D
+FEA4		<medial> 062D
+FEA5		<isolated> 062E
+FEA6		<final> 062E
+FEA7		<initial> 062E
+FEA8		<medial> 062E
+FEA9		<isolated> 062F
+FEAA		<final> 062F
+FEAB		<isolated> 0630
+FEAC		<final> 0630
+FEAD		<isolated> 0631
+FEAE		<final> 0631
+FEAF		<isolated> 0632
+FEB0		<final> 0632
+FEB1		<isolated> 0633
+FEB2		<final> 0633
+FEB3		<initial> 0633
+FEB4		<medial> 0633
+FEB5		<isolated> 0634
+FEB6		<final> 0634
+FEB7		<initial> 0634
+FEB8		<medial> 0634
+FEB9		<isolated> 0635
+FEBA		<final> 0635
+FEBB		<initial> 0635
+FEBC		<medial> 0635
+FEBD		<isolated> 0636
+FEBE		<final> 0636
+FEBF		<initial> 0636
+FEC0		<medial> 0636
+FEC1		<isolated> 0637
+FEC2		<final> 0637
+FEC3		<initial> 0637
+FEC4		<medial> 0637
+FEC5		<isolated> 0638
+FEC6		<final> 0638
+FEC7		<initial> 0638
+FEC8		<medial> 0638
+FEC9		<isolated> 0639
+FECA		<final> 0639
+FECB		<initial> 0639
+FECC		<medial> 0639
+FECD		<isolated> 063A
+FECE		<final> 063A
+FECF		<initial> 063A
+FED0		<medial> 063A
+FED1		<isolated> 0641
+FED2		<final> 0641
+FED3		<initial> 0641
+FED4		<medial> 0641
+FED5		<isolated> 0642
+FED6		<final> 0642
+FED7		<initial> 0642
+FED8		<medial> 0642
+FED9		<isolated> 0643
+FEDA		<final> 0643
+FEDB		<initial> 0643
+FEDC		<medial> 0643
+FEDD		<isolated> 0644
+FEDE		<final> 0644
+FEDF		<initial> 0644
+FEE0		<medial> 0644
+FEE1		<isolated> 0645
+FEE2		<final> 0645
+FEE3		<initial> 0645
+FEE4		<medial> 0645
+FEE5		<isolated> 0646
+FEE6		<final> 0646
+FEE7		<initial> 0646
+FEE8		<medial> 0646
+FEE9		<isolated> 0647
+FEEA		<final> 0647
+FEEB		<initial> 0647
+FEEC		<medial> 0647
+FEED		<isolated> 0648
+FEEE		<final> 0648
+FEEF		<isolated> 0649
+FEF0		<final> 0649
+FEF1		<isolated> 064A
+FEF2		<final> 064A
+FEF3		<initial> 064A
+FEF4		<medial> 064A
+FEF5		<isolated> 0644 0622
+FEF6		<final> 0644 0622
+FEF7		<isolated> 0644 0623
+FEF8		<final> 0644 0623
+FEF9		<isolated> 0644 0625
+FEFA		<final> 0644 0625
+FEFB		<isolated> 0644 0627
+FEFC		<final> 0644 0627
+FF01		<wide> 0021
+FF02		<wide> 0022
+FF03		<wide> 0023
+FF04		<wide> 0024
+FF05		<wide> 0025
+FF06		<wide> 0026
+FF07		<wide> 0027
+FF08		<wide> 0028
+FF09		<wide> 0029
+FF0A		<wide> 002A
+FF0B		<wide> 002B
+FF0C		<wide> 002C
+FF0D		<wide> 002D
+FF0E		<wide> 002E
+FF0F		<wide> 002F
+FF10		<wide> 0030
+FF11		<wide> 0031
+FF12		<wide> 0032
+FF13		<wide> 0033
+FF14		<wide> 0034
+FF15		<wide> 0035
+FF16		<wide> 0036
+FF17		<wide> 0037
+FF18		<wide> 0038
+FF19		<wide> 0039
+FF1A		<wide> 003A
+FF1B		<wide> 003B
+FF1C		<wide> 003C
+FF1D		<wide> 003D
+FF1E		<wide> 003E
+FF1F		<wide> 003F
+FF20		<wide> 0040
+FF21		<wide> 0041
+FF22		<wide> 0042
+FF23		<wide> 0043
+FF24		<wide> 0044
+FF25		<wide> 0045
+FF26		<wide> 0046
+FF27		<wide> 0047
+FF28		<wide> 0048
+FF29		<wide> 0049
+FF2A		<wide> 004A
+FF2B		<wide> 004B
+FF2C		<wide> 004C
+FF2D		<wide> 004D
+FF2E		<wide> 004E
+FF2F		<wide> 004F
+FF30		<wide> 0050
+FF31		<wide> 0051
+FF32		<wide> 0052
+FF33		<wide> 0053
+FF34		<wide> 0054
+FF35		<wide> 0055
+FF36		<wide> 0056
+FF37		<wide> 0057
+FF38		<wide> 0058
+FF39		<wide> 0059
+FF3A		<wide> 005A
+FF3B		<wide> 005B
+FF3C		<wide> 005C
+FF3D		<wide> 005D
+FF3E		<wide> 005E
+FF3F		<wide> 005F
+FF40		<wide> 0060
+FF41		<wide> 0061
+FF42		<wide> 0062
+FF43		<wide> 0063
+FF44		<wide> 0064
+FF45		<wide> 0065
+FF46		<wide> 0066
+FF47		<wide> 0067
+FF48		<wide> 0068
+FF49		<wide> 0069
+FF4A		<wide> 006A
+FF4B		<wide> 006B
+FF4C		<wide> 006C
+FF4D		<wide> 006D
+FF4E		<wide> 006E
+FF4F		<wide> 006F
+FF50		<wide> 0070
+FF51		<wide> 0071
+FF52		<wide> 0072
+FF53		<wide> 0073
+FF54		<wide> 0074
+FF55		<wide> 0075
+FF56		<wide> 0076
+FF57		<wide> 0077
+FF58		<wide> 0078
+FF59		<wide> 0079
+FF5A		<wide> 007A
+FF5B		<wide> 007B
+FF5C		<wide> 007C
+FF5D		<wide> 007D
+FF5E		<wide> 007E
+FF5F		<wide> 2985
+FF60		<wide> 2986
+FF61		<narrow> 3002
+FF62		<narrow> 300C
+FF63		<narrow> 300D
+FF64		<narrow> 3001
+FF65		<narrow> 30FB
+FF66		<narrow> 30F2
+FF67		<narrow> 30A1
+FF68		<narrow> 30A3
+FF69		<narrow> 30A5
+FF6A		<narrow> 30A7
+FF6B		<narrow> 30A9
+FF6C		<narrow> 30E3
+FF6D		<narrow> 30E5
+FF6E		<narrow> 30E7
+FF6F		<narrow> 30C3
+FF70		<narrow> 30FC
+FF71		<narrow> 30A2
+FF72		<narrow> 30A4
+FF73		<narrow> 30A6
+FF74		<narrow> 30A8
+FF75		<narrow> 30AA
+FF76		<narrow> 30AB
+FF77		<narrow> 30AD
+FF78		<narrow> 30AF
+FF79		<narrow> 30B1
+FF7A		<narrow> 30B3
+FF7B		<narrow> 30B5
+FF7C		<narrow> 30B7
+FF7D		<narrow> 30B9
+FF7E		<narrow> 30BB
+FF7F		<narrow> 30BD
+FF80		<narrow> 30BF
+FF81		<narrow> 30C1
+FF82		<narrow> 30C4
+FF83		<narrow> 30C6
+FF84		<narrow> 30C8
+FF85		<narrow> 30CA
+FF86		<narrow> 30CB
+FF87		<narrow> 30CC
+FF88		<narrow> 30CD
+FF89		<narrow> 30CE
+FF8A		<narrow> 30CF
+FF8B		<narrow> 30D2
+FF8C		<narrow> 30D5
+FF8D		<narrow> 30D8
+FF8E		<narrow> 30DB
+FF8F		<narrow> 30DE
+FF90		<narrow> 30DF
+FF91		<narrow> 30E0
+FF92		<narrow> 30E1
+FF93		<narrow> 30E2
+FF94		<narrow> 30E4
+FF95		<narrow> 30E6
+FF96		<narrow> 30E8
+FF97		<narrow> 30E9
+FF98		<narrow> 30EA
+FF99		<narrow> 30EB
+FF9A		<narrow> 30EC
+FF9B		<narrow> 30ED
+FF9C		<narrow> 30EF
+FF9D		<narrow> 30F3
+FF9E		<narrow> 3099
+FF9F		<narrow> 309A
+FFA0		<narrow> 3164
+FFA1		<narrow> 3131
+FFA2		<narrow> 3132
+FFA3		<narrow> 3133
+FFA4		<narrow> 3134
+FFA5		<narrow> 3135
+FFA6		<narrow> 3136
+FFA7		<narrow> 3137
+FFA8		<narrow> 3138
+FFA9		<narrow> 3139
+FFAA		<narrow> 313A
+FFAB		<narrow> 313B
+FFAC		<narrow> 313C
+FFAD		<narrow> 313D
+FFAE		<narrow> 313E
+FFAF		<narrow> 313F
+FFB0		<narrow> 3140
+FFB1		<narrow> 3141
+FFB2		<narrow> 3142
+FFB3		<narrow> 3143
+FFB4		<narrow> 3144
+FFB5		<narrow> 3145
+FFB6		<narrow> 3146
+FFB7		<narrow> 3147
+FFB8		<narrow> 3148
+FFB9		<narrow> 3149
+FFBA		<narrow> 314A
+FFBB		<narrow> 314B
+FFBC		<narrow> 314C
+FFBD		<narrow> 314D
+FFBE		<narrow> 314E
+FFC2		<narrow> 314F
+FFC3		<narrow> 3150
+FFC4		<narrow> 3151
+FFC5		<narrow> 3152
+FFC6		<narrow> 3153
+FFC7		<narrow> 3154
+FFCA		<narrow> 3155
+FFCB		<narrow> 3156
+FFCC		<narrow> 3157
+FFCD		<narrow> 3158
+FFCE		<narrow> 3159
+FFCF		<narrow> 315A
+FFD2		<narrow> 315B
+FFD3		<narrow> 315C
+FFD4		<narrow> 315D
+FFD5		<narrow> 315E
+FFD6		<narrow> 315F
+FFD7		<narrow> 3160
+FFDA		<narrow> 3161
+FFDB		<narrow> 3162
+FFDC		<narrow> 3163
+FFE0		<wide> 00A2
+FFE1		<wide> 00A3
+FFE2		<wide> 00AC
+FFE3		<wide> 00AF
+FFE4		<wide> 00A6
+FFE5		<wide> 00A5
+FFE6		<wide> 20A9
+FFE8		<narrow> 2502
+FFE9		<narrow> 2190
+FFEA		<narrow> 2191
+FFEB		<narrow> 2192
+FFEC		<narrow> 2193
+FFED		<narrow> 25A0
+FFEE		<narrow> 25CB
+1109A		11099 110BA
+1109C		1109B 110BA
+110AB		110A5 110BA
+1112E		11131 11127
+1112F		11132 11127
+1134B		11347 1133E
+1134C		11347 11357
+114BB		114B9 114BA
+114BC		114B9 114B0
+114BE		114B9 114BD
+115BA		115B8 115AF
+115BB		115B9 115AF
+1D15E		1D157 1D165
+1D15F		1D158 1D165
+1D160		1D15F 1D16E
+1D161		1D15F 1D16F
+1D162		1D15F 1D170
+1D163		1D15F 1D171
+1D164		1D15F 1D172
+1D1BB		1D1B9 1D165
+1D1BC		1D1BA 1D165
+1D1BD		1D1BB 1D16E
+1D1BE		1D1BC 1D16E
+1D1BF		1D1BB 1D16F
+1D1C0		1D1BC 1D16F
+1D400		<font> 0041
+1D401		<font> 0042
+1D402		<font> 0043
+1D403		<font> 0044
+1D404		<font> 0045
+1D405		<font> 0046
+1D406		<font> 0047
+1D407		<font> 0048
+1D408		<font> 0049
+1D409		<font> 004A
+1D40A		<font> 004B
+1D40B		<font> 004C
+1D40C		<font> 004D
+1D40D		<font> 004E
+1D40E		<font> 004F
+1D40F		<font> 0050
+1D410		<font> 0051
+1D411		<font> 0052
+1D412		<font> 0053
+1D413		<font> 0054
+1D414		<font> 0055
+1D415		<font> 0056
+1D416		<font> 0057
+1D417		<font> 0058
+1D418		<font> 0059
+1D419		<font> 005A
+1D41A		<font> 0061
+1D41B		<font> 0062
+1D41C		<font> 0063
+1D41D		<font> 0064
+1D41E		<font> 0065
+1D41F		<font> 0066
+1D420		<font> 0067
+1D421		<font> 0068
+1D422		<font> 0069
+1D423		<font> 006A
+1D424		<font> 006B
+1D425		<font> 006C
+1D426		<font> 006D
+1D427		<font> 006E
+1D428		<font> 006F
+1D429		<font> 0070
+1D42A		<font> 0071
+1D42B		<font> 0072
+1D42C		<font> 0073
+1D42D		<font> 0074
+1D42E		<font> 0075
+1D42F		<font> 0076
+1D430		<font> 0077
+1D431		<font> 0078
+1D432		<font> 0079
+1D433		<font> 007A
+1D434		<font> 0041
+1D435		<font> 0042
+1D436		<font> 0043
+1D437		<font> 0044
+1D438		<font> 0045
+1D439		<font> 0046
+1D43A		<font> 0047
+1D43B		<font> 0048
+1D43C		<font> 0049
+1D43D		<font> 004A
+1D43E		<font> 004B
+1D43F		<font> 004C
+1D440		<font> 004D
+1D441		<font> 004E
+1D442		<font> 004F
+1D443		<font> 0050
+1D444		<font> 0051
+1D445		<font> 0052
+1D446		<font> 0053
+1D447		<font> 0054
+1D448		<font> 0055
+1D449		<font> 0056
+1D44A		<font> 0057
+1D44B		<font> 0058
+1D44C		<font> 0059
+1D44D		<font> 005A
+1D44E		<font> 0061
+1D44F		<font> 0062
+1D450		<font> 0063
+1D451		<font> 0064
+1D452		<font> 0065
+1D453		<font> 0066
+1D454		<font> 0067
+1D456		<font> 0069
+1D457		<font> 006A
+1D458		<font> 006B
+1D459		<font> 006C
+1D45A		<font> 006D
+1D45B		<font> 006E
+1D45C		<font> 006F
+1D45D		<font> 0070
+1D45E		<font> 0071
+1D45F		<font> 0072
+1D460		<font> 0073
+1D461		<font> 0074
+1D462		<font> 0075
+1D463		<font> 0076
+1D464		<font> 0077
+1D465		<font> 0078
+1D466		<font> 0079
+1D467		<font> 007A
+1D468		<font> 0041
+1D469		<font> 0042
+1D46A		<font> 0043
+1D46B		<font> 0044
+1D46C		<font> 0045
+1D46D		<font> 0046
+1D46E		<font> 0047
+1D46F		<font> 0048
+1D470		<font> 0049
+1D471		<font> 004A
+1D472		<font> 004B
+1D473		<font> 004C
+1D474		<font> 004D
+1D475		<font> 004E
+1D476		<font> 004F
+1D477		<font> 0050
+1D478		<font> 0051
+1D479		<font> 0052
+1D47A		<font> 0053
+1D47B		<font> 0054
+1D47C		<font> 0055
+1D47D		<font> 0056
+1D47E		<font> 0057
+1D47F		<font> 0058
+1D480		<font> 0059
+1D481		<font> 005A
+1D482		<font> 0061
+1D483		<font> 0062
+1D484		<font> 0063
+1D485		<font> 0064
+1D486		<font> 0065
+1D487		<font> 0066
+1D488		<font> 0067
+1D489		<font> 0068
+1D48A		<font> 0069
+1D48B		<font> 006A
+1D48C		<font> 006B
+1D48D		<font> 006C
+1D48E		<font> 006D
+1D48F		<font> 006E
+1D490		<font> 006F
+1D491		<font> 0070
+1D492		<font> 0071
+1D493		<font> 0072
+1D494		<font> 0073
+1D495		<font> 0074
+1D496		<font> 0075
+1D497		<font> 0076
+1D498		<font> 0077
+1D499		<font> 0078
+1D49A		<font> 0079
+1D49B		<font> 007A
+1D49C		<font> 0041
+1D49E		<font> 0043
+1D49F		<font> 0044
+1D4A2		<font> 0047
+1D4A5		<font> 004A
+1D4A6		<font> 004B
+1D4A9		<font> 004E
+1D4AA		<font> 004F
+1D4AB		<font> 0050
+1D4AC		<font> 0051
+1D4AE		<font> 0053
+1D4AF		<font> 0054
+1D4B0		<font> 0055
+1D4B1		<font> 0056
+1D4B2		<font> 0057
+1D4B3		<font> 0058
+1D4B4		<font> 0059
+1D4B5		<font> 005A
+1D4B6		<font> 0061
+1D4B7		<font> 0062
+1D4B8		<font> 0063
+1D4B9		<font> 0064
+1D4BB		<font> 0066
+1D4BD		<font> 0068
+1D4BE		<font> 0069
+1D4BF		<font> 006A
+1D4C0		<font> 006B
+1D4C1		<font> 006C
+1D4C2		<font> 006D
+1D4C3		<font> 006E
+1D4C5		<font> 0070
+1D4C6		<font> 0071
+1D4C7		<font> 0072
+1D4C8		<font> 0073
+1D4C9		<font> 0074
+1D4CA		<font> 0075
+1D4CB		<font> 0076
+1D4CC		<font> 0077
+1D4CD		<font> 0078
+1D4CE		<font> 0079
+1D4CF		<font> 007A
+1D4D0		<font> 0041
+1D4D1		<font> 0042
+1D4D2		<font> 0043
+1D4D3		<font> 0044
+1D4D4		<font> 0045
+1D4D5		<font> 0046
+1D4D6		<font> 0047
+1D4D7		<font> 0048
+1D4D8		<font> 0049
+1D4D9		<font> 004A
+1D4DA		<font> 004B
+1D4DB		<font> 004C
+1D4DC		<font> 004D
+1D4DD		<font> 004E
+1D4DE		<font> 004F
+1D4DF		<font> 0050
+1D4E0		<font> 0051
+1D4E1		<font> 0052
+1D4E2		<font> 0053
+1D4E3		<font> 0054
+1D4E4		<font> 0055
+1D4E5		<font> 0056
+1D4E6		<font> 0057
+1D4E7		<font> 0058
+1D4E8		<font> 0059
+1D4E9		<font> 005A
+1D4EA		<font> 0061
+1D4EB		<font> 0062
+1D4EC		<font> 0063
+1D4ED		<font> 0064
+1D4EE		<font> 0065
+1D4EF		<font> 0066
+1D4F0		<font> 0067
+1D4F1		<font> 0068
+1D4F2		<font> 0069
+1D4F3		<font> 006A
+1D4F4		<font> 006B
+1D4F5		<font> 006C
+1D4F6		<font> 006D
+1D4F7		<font> 006E
+1D4F8		<font> 006F
+1D4F9		<font> 0070
+1D4FA		<font> 0071
+1D4FB		<font> 0072
+1D4FC		<font> 0073
+1D4FD		<font> 0074
+1D4FE		<font> 0075
+1D4FF		<font> 0076
+1D500		<font> 0077
+1D501		<font> 0078
+1D502		<font> 0079
+1D503		<font> 007A
+1D504		<font> 0041
+1D505		<font> 0042
+1D507		<font> 0044
+1D508		<font> 0045
+1D509		<font> 0046
+1D50A		<font> 0047
+1D50D		<font> 004A
+1D50E		<font> 004B
+1D50F		<font> 004C
+1D510		<font> 004D
+1D511		<font> 004E
+1D512		<font> 004F
+1D513		<font> 0050
+1D514		<font> 0051
+1D516		<font> 0053
+1D517		<font> 0054
+1D518		<font> 0055
+1D519		<font> 0056
+1D51A		<font> 0057
+1D51B		<font> 0058
+1D51C		<font> 0059
+1D51E		<font> 0061
+1D51F		<font> 0062
+1D520		<font> 0063
+1D521		<font> 0064
+1D522		<font> 0065
+1D523		<font> 0066
+1D524		<font> 0067
+1D525		<font> 0068
+1D526		<font> 0069
+1D527		<font> 006A
+1D528		<font> 006B
+1D529		<font> 006C
+1D52A		<font> 006D
+1D52B		<font> 006E
+1D52C		<font> 006F
+1D52D		<font> 0070
+1D52E		<font> 0071
+1D52F		<font> 0072
+1D530		<font> 0073
+1D531		<font> 0074
+1D532		<font> 0075
+1D533		<font> 0076
+1D534		<font> 0077
+1D535		<font> 0078
+1D536		<font> 0079
+1D537		<font> 007A
+1D538		<font> 0041
+1D539		<font> 0042
+1D53B		<font> 0044
+1D53C		<font> 0045
+1D53D		<font> 0046
+1D53E		<font> 0047
+1D540		<font> 0049
+1D541		<font> 004A
+1D542		<font> 004B
+1D543		<font> 004C
+1D544		<font> 004D
+1D546		<font> 004F
+1D54A		<font> 0053
+1D54B		<font> 0054
+1D54C		<font> 0055
+1D54D		<font> 0056
+1D54E		<font> 0057
+1D54F		<font> 0058
+1D550		<font> 0059
+1D552		<font> 0061
+1D553		<font> 0062
+1D554		<font> 0063
+1D555		<font> 0064
+1D556		<font> 0065
+1D557		<font> 0066
+1D558		<font> 0067
+1D559		<font> 0068
+1D55A		<font> 0069
+1D55B		<font> 006A
+1D55C		<font> 006B
+1D55D		<font> 006C
+1D55E		<font> 006D
+1D55F		<font> 006E
+1D560		<font> 006F
+1D561		<font> 0070
+1D562		<font> 0071
+1D563		<font> 0072
+1D564		<font> 0073
+1D565		<font> 0074
+1D566		<font> 0075
+1D567		<font> 0076
+1D568		<font> 0077
+1D569		<font> 0078
+1D56A		<font> 0079
+1D56B		<font> 007A
+1D56C		<font> 0041
+1D56D		<font> 0042
+1D56E		<font> 0043
+1D56F		<font> 0044
+1D570		<font> 0045
+1D571		<font> 0046
+1D572		<font> 0047
+1D573		<font> 0048
+1D574		<font> 0049
+1D575		<font> 004A
+1D576		<font> 004B
+1D577		<font> 004C
+1D578		<font> 004D
+1D579		<font> 004E
+1D57A		<font> 004F
+1D57B		<font> 0050
+1D57C		<font> 0051
+1D57D		<font> 0052
+1D57E		<font> 0053
+1D57F		<font> 0054
+1D580		<font> 0055
+1D581		<font> 0056
+1D582		<font> 0057
+1D583		<font> 0058
+1D584		<font> 0059
+1D585		<font> 005A
+1D586		<font> 0061
+1D587		<font> 0062
+1D588		<font> 0063
+1D589		<font> 0064
+1D58A		<font> 0065
+1D58B		<font> 0066
+1D58C		<font> 0067
+1D58D		<font> 0068
+1D58E		<font> 0069
+1D58F		<font> 006A
+1D590		<font> 006B
+1D591		<font> 006C
+1D592		<font> 006D
+1D593		<font> 006E
+1D594		<font> 006F
+1D595		<font> 0070
+1D596		<font> 0071
+1D597		<font> 0072
+1D598		<font> 0073
+1D599		<font> 0074
+1D59A		<font> 0075
+1D59B		<font> 0076
+1D59C		<font> 0077
+1D59D		<font> 0078
+1D59E		<font> 0079
+1D59F		<font> 007A
+1D5A0		<font> 0041
+1D5A1		<font> 0042
+1D5A2		<font> 0043
+1D5A3		<font> 0044
+1D5A4		<font> 0045
+1D5A5		<font> 0046
+1D5A6		<font> 0047
+1D5A7		<font> 0048
+1D5A8		<font> 0049
+1D5A9		<font> 004A
+1D5AA		<font> 004B
+1D5AB		<font> 004C
+1D5AC		<font> 004D
+1D5AD		<font> 004E
+1D5AE		<font> 004F
+1D5AF		<font> 0050
+1D5B0		<font> 0051
+1D5B1		<font> 0052
+1D5B2		<font> 0053
+1D5B3		<font> 0054
+1D5B4		<font> 0055
+1D5B5		<font> 0056
+1D5B6		<font> 0057
+1D5B7		<font> 0058
+1D5B8		<font> 0059
+1D5B9		<font> 005A
+1D5BA		<font> 0061
+1D5BB		<font> 0062
+1D5BC		<font> 0063
+1D5BD		<font> 0064
+1D5BE		<font> 0065
+1D5BF		<font> 0066
+1D5C0		<font> 0067
+1D5C1		<font> 0068
+1D5C2		<font> 0069
+1D5C3		<font> 006A
+1D5C4		<font> 006B
+1D5C5		<font> 006C
+1D5C6		<font> 006D
+1D5C7		<font> 006E
+1D5C8		<font> 006F
+1D5C9		<font> 0070
+1D5CA		<font> 0071
+1D5CB		<font> 0072
+1D5CC		<font> 0073
+1D5CD		<font> 0074
+1D5CE		<font> 0075
+1D5CF		<font> 0076
+1D5D0		<font> 0077
+1D5D1		<font> 0078
+1D5D2		<font> 0079
+1D5D3		<font> 007A
+1D5D4		<font> 0041
+1D5D5		<font> 0042
+1D5D6		<font> 0043
+1D5D7		<font> 0044
+1D5D8		<font> 0045
+1D5D9		<font> 0046
+1D5DA		<font> 0047
+1D5DB		<font> 0048
+1D5DC		<font> 0049
+1D5DD		<font> 004A
+1D5DE		<font> 004B
+1D5DF		<font> 004C
+1D5E0		<font> 004D
+1D5E1		<font> 004E
+1D5E2		<font> 004F
+1D5E3		<font> 0050
+1D5E4		<font> 0051
+1D5E5		<font> 0052
+1D5E6		<font> 0053
+1D5E7		<font> 0054
+1D5E8		<font> 0055
+1D5E9		<font> 0056
+1D5EA		<font> 0057
+1D5EB		<font> 0058
+1D5EC		<font> 0059
+1D5ED		<font> 005A
+1D5EE		<font> 0061
+1D5EF		<font> 0062
+1D5F0		<font> 0063
+1D5F1		<font> 0064
+1D5F2		<font> 0065
+1D5F3		<font> 0066
+1D5F4		<font> 0067
+1D5F5		<font> 0068
+1D5F6		<font> 0069
+1D5F7		<font> 006A
+1D5F8		<font> 006B
+1D5F9		<font> 006C
+1D5FA		<font> 006D
+1D5FB		<font> 006E
+1D5FC		<font> 006F
+1D5FD		<font> 0070
+1D5FE		<font> 0071
+1D5FF		<font> 0072
+1D600		<font> 0073
+1D601		<font> 0074
+1D602		<font> 0075
+1D603		<font> 0076
+1D604		<font> 0077
+1D605		<font> 0078
+1D606		<font> 0079
+1D607		<font> 007A
+1D608		<font> 0041
+1D609		<font> 0042
+1D60A		<font> 0043
+1D60B		<font> 0044
+1D60C		<font> 0045
+1D60D		<font> 0046
+1D60E		<font> 0047
+1D60F		<font> 0048
+1D610		<font> 0049
+1D611		<font> 004A
+1D612		<font> 004B
+1D613		<font> 004C
+1D614		<font> 004D
+1D615		<font> 004E
+1D616		<font> 004F
+1D617		<font> 0050
+1D618		<font> 0051
+1D619		<font> 0052
+1D61A		<font> 0053
+1D61B		<font> 0054
+1D61C		<font> 0055
+1D61D		<font> 0056
+1D61E		<font> 0057
+1D61F		<font> 0058
+1D620		<font> 0059
+1D621		<font> 005A
+1D622		<font> 0061
+1D623		<font> 0062
+1D624		<font> 0063
+1D625		<font> 0064
+1D626		<font> 0065
+1D627		<font> 0066
+1D628		<font> 0067
+1D629		<font> 0068
+1D62A		<font> 0069
+1D62B		<font> 006A
+1D62C		<font> 006B
+1D62D		<font> 006C
+1D62E		<font> 006D
+1D62F		<font> 006E
+1D630		<font> 006F
+1D631		<font> 0070
+1D632		<font> 0071
+1D633		<font> 0072
+1D634		<font> 0073
+1D635		<font> 0074
+1D636		<font> 0075
+1D637		<font> 0076
+1D638		<font> 0077
+1D639		<font> 0078
+1D63A		<font> 0079
+1D63B		<font> 007A
+1D63C		<font> 0041
+1D63D		<font> 0042
+1D63E		<font> 0043
+1D63F		<font> 0044
+1D640		<font> 0045
+1D641		<font> 0046
+1D642		<font> 0047
+1D643		<font> 0048
+1D644		<font> 0049
+1D645		<font> 004A
+1D646		<font> 004B
+1D647		<font> 004C
+1D648		<font> 004D
+1D649		<font> 004E
+1D64A		<font> 004F
+1D64B		<font> 0050
+1D64C		<font> 0051
+1D64D		<font> 0052
+1D64E		<font> 0053
+1D64F		<font> 0054
+1D650		<font> 0055
+1D651		<font> 0056
+1D652		<font> 0057
+1D653		<font> 0058
+1D654		<font> 0059
+1D655		<font> 005A
+1D656		<font> 0061
+1D657		<font> 0062
+1D658		<font> 0063
+1D659		<font> 0064
+1D65A		<font> 0065
+1D65B		<font> 0066
+1D65C		<font> 0067
+1D65D		<font> 0068
+1D65E		<font> 0069
+1D65F		<font> 006A
+1D660		<font> 006B
+1D661		<font> 006C
+1D662		<font> 006D
+1D663		<font> 006E
+1D664		<font> 006F
+1D665		<font> 0070
+1D666		<font> 0071
+1D667		<font> 0072
+1D668		<font> 0073
+1D669		<font> 0074
+1D66A		<font> 0075
+1D66B		<font> 0076
+1D66C		<font> 0077
+1D66D		<font> 0078
+1D66E		<font> 0079
+1D66F		<font> 007A
+1D670		<font> 0041
+1D671		<font> 0042
+1D672		<font> 0043
+1D673		<font> 0044
+1D674		<font> 0045
+1D675		<font> 0046
+1D676		<font> 0047
+1D677		<font> 0048
+1D678		<font> 0049
+1D679		<font> 004A
+1D67A		<font> 004B
+1D67B		<font> 004C
+1D67C		<font> 004D
+1D67D		<font> 004E
+1D67E		<font> 004F
+1D67F		<font> 0050
+1D680		<font> 0051
+1D681		<font> 0052
+1D682		<font> 0053
+1D683		<font> 0054
+1D684		<font> 0055
+1D685		<font> 0056
+1D686		<font> 0057
+1D687		<font> 0058
+1D688		<font> 0059
+1D689		<font> 005A
+1D68A		<font> 0061
+1D68B		<font> 0062
+1D68C		<font> 0063
+1D68D		<font> 0064
+1D68E		<font> 0065
+1D68F		<font> 0066
+1D690		<font> 0067
+1D691		<font> 0068
+1D692		<font> 0069
+1D693		<font> 006A
+1D694		<font> 006B
+1D695		<font> 006C
+1D696		<font> 006D
+1D697		<font> 006E
+1D698		<font> 006F
+1D699		<font> 0070
+1D69A		<font> 0071
+1D69B		<font> 0072
+1D69C		<font> 0073
+1D69D		<font> 0074
+1D69E		<font> 0075
+1D69F		<font> 0076
+1D6A0		<font> 0077
+1D6A1		<font> 0078
+1D6A2		<font> 0079
+1D6A3		<font> 007A
+1D6A4		<font> 0131
+1D6A5		<font> 0237
+1D6A8		<font> 0391
+1D6A9		<font> 0392
+1D6AA		<font> 0393
+1D6AB		<font> 0394
+1D6AC		<font> 0395
+1D6AD		<font> 0396
+1D6AE		<font> 0397
+1D6AF		<font> 0398
+1D6B0		<font> 0399
+1D6B1		<font> 039A
+1D6B2		<font> 039B
+1D6B3		<font> 039C
+1D6B4		<font> 039D
+1D6B5		<font> 039E
+1D6B6		<font> 039F
+1D6B7		<font> 03A0
+1D6B8		<font> 03A1
+1D6B9		<font> 03F4
+1D6BA		<font> 03A3
+1D6BB		<font> 03A4
+1D6BC		<font> 03A5
+1D6BD		<font> 03A6
+1D6BE		<font> 03A7
+1D6BF		<font> 03A8
+1D6C0		<font> 03A9
+1D6C1		<font> 2207
+1D6C2		<font> 03B1
+1D6C3		<font> 03B2
+1D6C4		<font> 03B3
+1D6C5		<font> 03B4
+1D6C6		<font> 03B5
+1D6C7		<font> 03B6
+1D6C8		<font> 03B7
+1D6C9		<font> 03B8
+1D6CA		<font> 03B9
+1D6CB		<font> 03BA
+1D6CC		<font> 03BB
+1D6CD		<font> 03BC
+1D6CE		<font> 03BD
+1D6CF		<font> 03BE
+1D6D0		<font> 03BF
+1D6D1		<font> 03C0
+1D6D2		<font> 03C1
+1D6D3		<font> 03C2
+1D6D4		<font> 03C3
+1D6D5		<font> 03C4
+1D6D6		<font> 03C5
+1D6D7		<font> 03C6
+1D6D8		<font> 03C7
+1D6D9		<font> 03C8
+1D6DA		<font> 03C9
+1D6DB		<font> 2202
+1D6DC		<font> 03F5
+1D6DD		<font> 03D1
+1D6DE		<font> 03F0
+1D6DF		<font> 03D5
+1D6E0		<font> 03F1
+1D6E1		<font> 03D6
+1D6E2		<font> 0391
+1D6E3		<font> 0392
+1D6E4		<font> 0393
+1D6E5		<font> 0394
+1D6E6		<font> 0395
+1D6E7		<font> 0396
+1D6E8		<font> 0397
+1D6E9		<font> 0398
+1D6EA		<font> 0399
+1D6EB		<font> 039A
+1D6EC		<font> 039B
+1D6ED		<font> 039C
+1D6EE		<font> 039D
+1D6EF		<font> 039E
+1D6F0		<font> 039F
+1D6F1		<font> 03A0
+1D6F2		<font> 03A1
+1D6F3		<font> 03F4
+1D6F4		<font> 03A3
+1D6F5		<font> 03A4
+1D6F6		<font> 03A5
+1D6F7		<font> 03A6
+1D6F8		<font> 03A7
+1D6F9		<font> 03A8
+1D6FA		<font> 03A9
+1D6FB		<font> 2207
+1D6FC		<font> 03B1
+1D6FD		<font> 03B2
+1D6FE		<font> 03B3
+1D6FF		<font> 03B4
+1D700		<font> 03B5
+1D701		<font> 03B6
+1D702		<font> 03B7
+1D703		<font> 03B8
+1D704		<font> 03B9
+1D705		<font> 03BA
+1D706		<font> 03BB
+1D707		<font> 03BC
+1D708		<font> 03BD
+1D709		<font> 03BE
+1D70A		<font> 03BF
+1D70B		<font> 03C0
+1D70C		<font> 03C1
+1D70D		<font> 03C2
+1D70E		<font> 03C3
+1D70F		<font> 03C4
+1D710		<font> 03C5
+1D711		<font> 03C6
+1D712		<font> 03C7
+1D713		<font> 03C8
+1D714		<font> 03C9
+1D715		<font> 2202
+1D716		<font> 03F5
+1D717		<font> 03D1
+1D718		<font> 03F0
+1D719		<font> 03D5
+1D71A		<font> 03F1
+1D71B		<font> 03D6
+1D71C		<font> 0391
+1D71D		<font> 0392
+1D71E		<font> 0393
+1D71F		<font> 0394
+1D720		<font> 0395
+1D721		<font> 0396
+1D722		<font> 0397
+1D723		<font> 0398
+1D724		<font> 0399
+1D725		<font> 039A
+1D726		<font> 039B
+1D727		<font> 039C
+1D728		<font> 039D
+1D729		<font> 039E
+1D72A		<font> 039F
+1D72B		<font> 03A0
+1D72C		<font> 03A1
+1D72D		<font> 03F4
+1D72E		<font> 03A3
+1D72F		<font> 03A4
+1D730		<font> 03A5
+1D731		<font> 03A6
+1D732		<font> 03A7
+1D733		<font> 03A8
+1D734		<font> 03A9
+1D735		<font> 2207
+1D736		<font> 03B1
+1D737		<font> 03B2
+1D738		<font> 03B3
+1D739		<font> 03B4
+1D73A		<font> 03B5
+1D73B		<font> 03B6
+1D73C		<font> 03B7
+1D73D		<font> 03B8
+1D73E		<font> 03B9
+1D73F		<font> 03BA
+1D740		<font> 03BB
+1D741		<font> 03BC
+1D742		<font> 03BD
+1D743		<font> 03BE
+1D744		<font> 03BF
+1D745		<font> 03C0
+1D746		<font> 03C1
+1D747		<font> 03C2
+1D748		<font> 03C3
+1D749		<font> 03C4
+1D74A		<font> 03C5
+1D74B		<font> 03C6
+1D74C		<font> 03C7
+1D74D		<font> 03C8
+1D74E		<font> 03C9
+1D74F		<font> 2202
+1D750		<font> 03F5
+1D751		<font> 03D1
+1D752		<font> 03F0
+1D753		<font> 03D5
+1D754		<font> 03F1
+1D755		<font> 03D6
+1D756		<font> 0391
+1D757		<font> 0392
+1D758		<font> 0393
+1D759		<font> 0394
+1D75A		<font> 0395
+1D75B		<font> 0396
+1D75C		<font> 0397
+1D75D		<font> 0398
+1D75E		<font> 0399
+1D75F		<font> 039A
+1D760		<font> 039B
+1D761		<font> 039C
+1D762		<font> 039D
+1D763		<font> 039E
+1D764		<font> 039F
+1D765		<font> 03A0
+1D766		<font> 03A1
+1D767		<font> 03F4
+1D768		<font> 03A3
+1D769		<font> 03A4
+1D76A		<font> 03A5
+1D76B		<font> 03A6
+1D76C		<font> 03A7
+1D76D		<font> 03A8
+1D76E		<font> 03A9
+1D76F		<font> 2207
+1D770		<font> 03B1
+1D771		<font> 03B2
+1D772		<font> 03B3
+1D773		<font> 03B4
+1D774		<font> 03B5
+1D775		<font> 03B6
+1D776		<font> 03B7
+1D777		<font> 03B8
+1D778		<font> 03B9
+1D779		<font> 03BA
+1D77A		<font> 03BB
+1D77B		<font> 03BC
+1D77C		<font> 03BD
+1D77D		<font> 03BE
+1D77E		<font> 03BF
+1D77F		<font> 03C0
+1D780		<font> 03C1
+1D781		<font> 03C2
+1D782		<font> 03C3
+1D783		<font> 03C4
+1D784		<font> 03C5
+1D785		<font> 03C6
+1D786		<font> 03C7
+1D787		<font> 03C8
+1D788		<font> 03C9
+1D789		<font> 2202
+1D78A		<font> 03F5
+1D78B		<font> 03D1
+1D78C		<font> 03F0
+1D78D		<font> 03D5
+1D78E		<font> 03F1
+1D78F		<font> 03D6
+1D790		<font> 0391
+1D791		<font> 0392
+1D792		<font> 0393
+1D793		<font> 0394
+1D794		<font> 0395
+1D795		<font> 0396
+1D796		<font> 0397
+1D797		<font> 0398
+1D798		<font> 0399
+1D799		<font> 039A
+1D79A		<font> 039B
+1D79B		<font> 039C
+1D79C		<font> 039D
+1D79D		<font> 039E
+1D79E		<font> 039F
+1D79F		<font> 03A0
+1D7A0		<font> 03A1
+1D7A1		<font> 03F4
+1D7A2		<font> 03A3
+1D7A3		<font> 03A4
+1D7A4		<font> 03A5
+1D7A5		<font> 03A6
+1D7A6		<font> 03A7
+1D7A7		<font> 03A8
+1D7A8		<font> 03A9
+1D7A9		<font> 2207
+1D7AA		<font> 03B1
+1D7AB		<font> 03B2
+1D7AC		<font> 03B3
+1D7AD		<font> 03B4
+1D7AE		<font> 03B5
+1D7AF		<font> 03B6
+1D7B0		<font> 03B7
+1D7B1		<font> 03B8
+1D7B2		<font> 03B9
+1D7B3		<font> 03BA
+1D7B4		<font> 03BB
+1D7B5		<font> 03BC
+1D7B6		<font> 03BD
+1D7B7		<font> 03BE
+1D7B8		<font> 03BF
+1D7B9		<font> 03C0
+1D7BA		<font> 03C1
+1D7BB		<font> 03C2
+1D7BC		<font> 03C3
+1D7BD		<font> 03C4
+1D7BE		<font> 03C5
+1D7BF		<font> 03C6
+1D7C0		<font> 03C7
+1D7C1		<font> 03C8
+1D7C2		<font> 03C9
+1D7C3		<font> 2202
+1D7C4		<font> 03F5
+1D7C5		<font> 03D1
+1D7C6		<font> 03F0
+1D7C7		<font> 03D5
+1D7C8		<font> 03F1
+1D7C9		<font> 03D6
+1D7CA		<font> 03DC
+1D7CB		<font> 03DD
+1D7CE		<font> 0030
+1D7CF		<font> 0031
+1D7D0		<font> 0032
+1D7D1		<font> 0033
+1D7D2		<font> 0034
+1D7D3		<font> 0035
+1D7D4		<font> 0036
+1D7D5		<font> 0037
+1D7D6		<font> 0038
+1D7D7		<font> 0039
+1D7D8		<font> 0030
+1D7D9		<font> 0031
+1D7DA		<font> 0032
+1D7DB		<font> 0033
+1D7DC		<font> 0034
+1D7DD		<font> 0035
+1D7DE		<font> 0036
+1D7DF		<font> 0037
+1D7E0		<font> 0038
+1D7E1		<font> 0039
+1D7E2		<font> 0030
+1D7E3		<font> 0031
+1D7E4		<font> 0032
+1D7E5		<font> 0033
+1D7E6		<font> 0034
+1D7E7		<font> 0035
+1D7E8		<font> 0036
+1D7E9		<font> 0037
+1D7EA		<font> 0038
+1D7EB		<font> 0039
+1D7EC		<font> 0030
+1D7ED		<font> 0031
+1D7EE		<font> 0032
+1D7EF		<font> 0033
+1D7F0		<font> 0034
+1D7F1		<font> 0035
+1D7F2		<font> 0036
+1D7F3		<font> 0037
+1D7F4		<font> 0038
+1D7F5		<font> 0039
+1D7F6		<font> 0030
+1D7F7		<font> 0031
+1D7F8		<font> 0032
+1D7F9		<font> 0033
+1D7FA		<font> 0034
+1D7FB		<font> 0035
+1D7FC		<font> 0036
+1D7FD		<font> 0037
+1D7FE		<font> 0038
+1D7FF		<font> 0039
+1EE00		<font> 0627
+1EE01		<font> 0628
+1EE02		<font> 062C
+1EE03		<font> 062F
+1EE05		<font> 0648
+1EE06		<font> 0632
+1EE07		<font> 062D
+1EE08		<font> 0637
+1EE09		<font> 064A
+1EE0A		<font> 0643
+1EE0B		<font> 0644
+1EE0C		<font> 0645
+1EE0D		<font> 0646
+1EE0E		<font> 0633
+1EE0F		<font> 0639
+1EE10		<font> 0641
+1EE11		<font> 0635
+1EE12		<font> 0642
+1EE13		<font> 0631
+1EE14		<font> 0634
+1EE15		<font> 062A
+1EE16		<font> 062B
+1EE17		<font> 062E
+1EE18		<font> 0630
+1EE19		<font> 0636
+1EE1A		<font> 0638
+1EE1B		<font> 063A
+1EE1C		<font> 066E
+1EE1D		<font> 06BA
+1EE1E		<font> 06A1
+1EE1F		<font> 066F
+1EE21		<font> 0628
+1EE22		<font> 062C
+1EE24		<font> 0647
+1EE27		<font> 062D
+1EE29		<font> 064A
+1EE2A		<font> 0643
+1EE2B		<font> 0644
+1EE2C		<font> 0645
+1EE2D		<font> 0646
+1EE2E		<font> 0633
+1EE2F		<font> 0639
+1EE30		<font> 0641
+1EE31		<font> 0635
+1EE32		<font> 0642
+1EE34		<font> 0634
+1EE35		<font> 062A
+1EE36		<font> 062B
+1EE37		<font> 062E
+1EE39		<font> 0636
+1EE3B		<font> 063A
+1EE42		<font> 062C
+1EE47		<font> 062D
+1EE49		<font> 064A
+1EE4B		<font> 0644
+1EE4D		<font> 0646
+1EE4E		<font> 0633
+1EE4F		<font> 0639
+1EE51		<font> 0635
+1EE52		<font> 0642
+1EE54		<font> 0634
+1EE57		<font> 062E
+1EE59		<font> 0636
+1EE5B		<font> 063A
+1EE5D		<font> 06BA
+1EE5F		<font> 066F
+1EE61		<font> 0628
+1EE62		<font> 062C
+1EE64		<font> 0647
+1EE67		<font> 062D
+1EE68		<font> 0637
+1EE69		<font> 064A
+1EE6A		<font> 0643
+1EE6C		<font> 0645
+1EE6D		<font> 0646
+1EE6E		<font> 0633
+1EE6F		<font> 0639
+1EE70		<font> 0641
+1EE71		<font> 0635
+1EE72		<font> 0642
+1EE74		<font> 0634
+1EE75		<font> 062A
+1EE76		<font> 062B
+1EE77		<font> 062E
+1EE79		<font> 0636
+1EE7A		<font> 0638
+1EE7B		<font> 063A
+1EE7C		<font> 066E
+1EE7E		<font> 06A1
+1EE80		<font> 0627
+1EE81		<font> 0628
+1EE82		<font> 062C
+1EE83		<font> 062F
+1EE84		<font> 0647
+1EE85		<font> 0648
+1EE86		<font> 0632
+1EE87		<font> 062D
+1EE88		<font> 0637
+1EE89		<font> 064A
+1EE8B		<font> 0644
+1EE8C		<font> 0645
+1EE8D		<font> 0646
+1EE8E		<font> 0633
+1EE8F		<font> 0639
+1EE90		<font> 0641
+1EE91		<font> 0635
+1EE92		<font> 0642
+1EE93		<font> 0631
+1EE94		<font> 0634
+1EE95		<font> 062A
+1EE96		<font> 062B
+1EE97		<font> 062E
+1EE98		<font> 0630
+1EE99		<font> 0636
+1EE9A		<font> 0638
+1EE9B		<font> 063A
+1EEA1		<font> 0628
+1EEA2		<font> 062C
+1EEA3		<font> 062F
+1EEA5		<font> 0648
+1EEA6		<font> 0632
+1EEA7		<font> 062D
+1EEA8		<font> 0637
+1EEA9		<font> 064A
+1EEAB		<font> 0644
+1EEAC		<font> 0645
+1EEAD		<font> 0646
+1EEAE		<font> 0633
+1EEAF		<font> 0639
+1EEB0		<font> 0641
+1EEB1		<font> 0635
+1EEB2		<font> 0642
+1EEB3		<font> 0631
+1EEB4		<font> 0634
+1EEB5		<font> 062A
+1EEB6		<font> 062B
+1EEB7		<font> 062E
+1EEB8		<font> 0630
+1EEB9		<font> 0636
+1EEBA		<font> 0638
+1EEBB		<font> 063A
+1F100		<compat> 0030 002E
+1F101		<compat> 0030 002C
+1F102		<compat> 0031 002C
+1F103		<compat> 0032 002C
+1F104		<compat> 0033 002C
+1F105		<compat> 0034 002C
+1F106		<compat> 0035 002C
+1F107		<compat> 0036 002C
+1F108		<compat> 0037 002C
+1F109		<compat> 0038 002C
+1F10A		<compat> 0039 002C
+1F110		<compat> 0028 0041 0029
+1F111		<compat> 0028 0042 0029
+1F112		<compat> 0028 0043 0029
+1F113		<compat> 0028 0044 0029
+1F114		<compat> 0028 0045 0029
+1F115		<compat> 0028 0046 0029
+1F116		<compat> 0028 0047 0029
+1F117		<compat> 0028 0048 0029
+1F118		<compat> 0028 0049 0029
+1F119		<compat> 0028 004A 0029
+1F11A		<compat> 0028 004B 0029
+1F11B		<compat> 0028 004C 0029
+1F11C		<compat> 0028 004D 0029
+1F11D		<compat> 0028 004E 0029
+1F11E		<compat> 0028 004F 0029
+1F11F		<compat> 0028 0050 0029
+1F120		<compat> 0028 0051 0029
+1F121		<compat> 0028 0052 0029
+1F122		<compat> 0028 0053 0029
+1F123		<compat> 0028 0054 0029
+1F124		<compat> 0028 0055 0029
+1F125		<compat> 0028 0056 0029
+1F126		<compat> 0028 0057 0029
+1F127		<compat> 0028 0058 0029
+1F128		<compat> 0028 0059 0029
+1F129		<compat> 0028 005A 0029
+1F12A		<compat> 3014 0053 3015
+1F12B		<circle> 0043
+1F12C		<circle> 0052
+1F12D		<circle> 0043 0044
+1F12E		<circle> 0057 005A
+1F130		<square> 0041
+1F131		<square> 0042
+1F132		<square> 0043
+1F133		<square> 0044
+1F134		<square> 0045
+1F135		<square> 0046
+1F136		<square> 0047
+1F137		<square> 0048
+1F138		<square> 0049
+1F139		<square> 004A
+1F13A		<square> 004B
+1F13B		<square> 004C
+1F13C		<square> 004D
+1F13D		<square> 004E
+1F13E		<square> 004F
+1F13F		<square> 0050
+1F140		<square> 0051
+1F141		<square> 0052
+1F142		<square> 0053
+1F143		<square> 0054
+1F144		<square> 0055
+1F145		<square> 0056
+1F146		<square> 0057
+1F147		<square> 0058
+1F148		<square> 0059
+1F149		<square> 005A
+1F14A		<square> 0048 0056
+1F14B		<square> 004D 0056
+1F14C		<square> 0053 0044
+1F14D		<square> 0053 0053
+1F14E		<square> 0050 0050 0056
+1F14F		<square> 0057 0043
+1F16A		<super> 004D 0043
+1F16B		<super> 004D 0044
+1F16C		<super> 004D 0052
+1F190		<square> 0044 004A
+1F200		<square> 307B 304B
+1F201		<square> 30B3 30B3
+1F202		<square> 30B5
+1F210		<square> 624B
+1F211		<square> 5B57
+1F212		<square> 53CC
+1F213		<square> 30C7
+1F214		<square> 4E8C
+1F215		<square> 591A
+1F216		<square> 89E3
+1F217		<square> 5929
+1F218		<square> 4EA4
+1F219		<square> 6620
+1F21A		<square> 7121
+1F21B		<square> 6599
+1F21C		<square> 524D
+1F21D		<square> 5F8C
+1F21E		<square> 518D
+1F21F		<square> 65B0
+1F220		<square> 521D
+1F221		<square> 7D42
+1F222		<square> 751F
+1F223		<square> 8CA9
+1F224		<square> 58F0
+1F225		<square> 5439
+1F226		<square> 6F14
+1F227		<square> 6295
+1F228		<square> 6355
+1F229		<square> 4E00
+1F22A		<square> 4E09
+1F22B		<square> 904A
+1F22C		<square> 5DE6
+1F22D		<square> 4E2D
+1F22E		<square> 53F3
+1F22F		<square> 6307
+1F230		<square> 8D70
+1F231		<square> 6253
+1F232		<square> 7981
+1F233		<square> 7A7A
+1F234		<square> 5408
+1F235		<square> 6E80
+1F236		<square> 6709
+1F237		<square> 6708
+1F238		<square> 7533
+1F239		<square> 5272
+1F23A		<square> 55B6
+1F23B		<square> 914D
+1F240		<compat> 3014 672C 3015
+1F241		<compat> 3014 4E09 3015
+1F242		<compat> 3014 4E8C 3015
+1F243		<compat> 3014 5B89 3015
+1F244		<compat> 3014 70B9 3015
+1F245		<compat> 3014 6253 3015
+1F246		<compat> 3014 76D7 3015
+1F247		<compat> 3014 52DD 3015
+1F248		<compat> 3014 6557 3015
+1F250		<circle> 5F97
+1F251		<circle> 53EF
+2F800		4E3D
+2F801		4E38
+2F802		4E41
+2F803		20122
+2F804		4F60
+2F805		4FAE
+2F806		4FBB
+2F807		5002
+2F808		507A
+2F809		5099
+2F80A		50E7
+2F80B		50CF
+2F80C		349E
+2F80D		2063A
+2F80E		514D
+2F80F		5154
+2F810		5164
+2F811		5177
+2F812		2051C
+2F813		34B9
+2F814		5167
+2F815		518D
+2F816		2054B
+2F817		5197
+2F818		51A4
+2F819		4ECC
+2F81A		51AC
+2F81B		51B5
+2F81C		291DF
+2F81D		51F5
+2F81E		5203
+2F81F		34DF
+2F820		523B
+2F821		5246
+2F822		5272
+2F823		5277
+2F824		3515
+2F825		52C7
+2F826		52C9
+2F827		52E4
+2F828		52FA
+2F829		5305
+2F82A		5306
+2F82B		5317
+2F82C		5349
+2F82D		5351
+2F82E		535A
+2F82F		5373
+2F830		537D
+2F831	2F833	537F
+2F834		20A2C
+2F835		7070
+2F836		53CA
+2F837		53DF
+2F838		20B63
+2F839		53EB
+2F83A		53F1
+2F83B		5406
+2F83C		549E
+2F83D		5438
+2F83E		5448
+2F83F		5468
+2F840		54A2
+2F841		54F6
+2F842		5510
+2F843		5553
+2F844		5563
+2F845	2F846	5584
+2F847		5599
+2F848		55AB
+2F849		55B3
+2F84A		55C2
+2F84B		5716
+2F84C		5606
+2F84D		5717
+2F84E		5651
+2F84F		5674
+2F850		5207
+2F851		58EE
+2F852		57CE
+2F853		57F4
+2F854		580D
+2F855		578B
+2F856		5832
+2F857		5831
+2F858		58AC
+2F859		214E4
+2F85A		58F2
+2F85B		58F7
+2F85C		5906
+2F85D		591A
+2F85E		5922
+2F85F		5962
+2F860		216A8
+2F861		216EA
+2F862		59EC
+2F863		5A1B
+2F864		5A27
+2F865		59D8
+2F866		5A66
+2F867		36EE
+2F868		36FC
+2F869		5B08
+2F86A	2F86B	5B3E
+2F86C		219C8
+2F86D		5BC3
+2F86E		5BD8
+2F86F		5BE7
+2F870		5BF3
+2F871		21B18
+2F872		5BFF
+2F873		5C06
+2F874		5F53
+2F875		5C22
+2F876		3781
+2F877		5C60
+2F878		5C6E
+2F879		5CC0
+2F87A		5C8D
+2F87B		21DE4
+2F87C		5D43
+2F87D		21DE6
+2F87E		5D6E
+2F87F		5D6B
+2F880		5D7C
+2F881		5DE1
+2F882		5DE2
+2F883		382F
+2F884		5DFD
+2F885		5E28
+2F886		5E3D
+2F887		5E69
+2F888		3862
+2F889		22183
+2F88A		387C
+2F88B		5EB0
+2F88C		5EB3
+2F88D		5EB6
+2F88E		5ECA
+2F88F		2A392
+2F890		5EFE
+2F891	2F892	22331
+2F893		8201
+2F894	2F895	5F22
+2F896		38C7
+2F897		232B8
+2F898		261DA
+2F899		5F62
+2F89A		5F6B
+2F89B		38E3
+2F89C		5F9A
+2F89D		5FCD
+2F89E		5FD7
+2F89F		5FF9
+2F8A0		6081
+2F8A1		393A
+2F8A2		391C
+2F8A3		6094
+2F8A4		226D4
+2F8A5		60C7
+2F8A6		6148
+2F8A7		614C
+2F8A8		614E
+2F8A9		614C
+2F8AA		617A
+2F8AB		618E
+2F8AC		61B2
+2F8AD		61A4
+2F8AE		61AF
+2F8AF		61DE
+2F8B0		61F2
+2F8B1		61F6
+2F8B2		6210
+2F8B3		621B
+2F8B4		625D
+2F8B5		62B1
+2F8B6		62D4
+2F8B7		6350
+2F8B8		22B0C
+2F8B9		633D
+2F8BA		62FC
+2F8BB		6368
+2F8BC		6383
+2F8BD		63E4
+2F8BE		22BF1
+2F8BF		6422
+2F8C0		63C5
+2F8C1		63A9
+2F8C2		3A2E
+2F8C3		6469
+2F8C4		647E
+2F8C5		649D
+2F8C6		6477
+2F8C7		3A6C
+2F8C8		654F
+2F8C9		656C
+2F8CA		2300A
+2F8CB		65E3
+2F8CC		66F8
+2F8CD		6649
+2F8CE		3B19
+2F8CF		6691
+2F8D0		3B08
+2F8D1		3AE4
+2F8D2		5192
+2F8D3		5195
+2F8D4		6700
+2F8D5		669C
+2F8D6		80AD
+2F8D7		43D9
+2F8D8		6717
+2F8D9		671B
+2F8DA		6721
+2F8DB		675E
+2F8DC		6753
+2F8DD		233C3
+2F8DE		3B49
+2F8DF		67FA
+2F8E0		6785
+2F8E1		6852
+2F8E2		6885
+2F8E3		2346D
+2F8E4		688E
+2F8E5		681F
+2F8E6		6914
+2F8E7		3B9D
+2F8E8		6942
+2F8E9		69A3
+2F8EA		69EA
+2F8EB		6AA8
+2F8EC		236A3
+2F8ED		6ADB
+2F8EE		3C18
+2F8EF		6B21
+2F8F0		238A7
+2F8F1		6B54
+2F8F2		3C4E
+2F8F3		6B72
+2F8F4		6B9F
+2F8F5		6BBA
+2F8F6		6BBB
+2F8F7		23A8D
+2F8F8		21D0B
+2F8F9		23AFA
+2F8FA		6C4E
+2F8FB		23CBC
+2F8FC		6CBF
+2F8FD		6CCD
+2F8FE		6C67
+2F8FF		6D16
+2F900		6D3E
+2F901		6D77
+2F902		6D41
+2F903		6D69
+2F904		6D78
+2F905		6D85
+2F906		23D1E
+2F907		6D34
+2F908		6E2F
+2F909		6E6E
+2F90A		3D33
+2F90B		6ECB
+2F90C		6EC7
+2F90D		23ED1
+2F90E		6DF9
+2F90F		6F6E
+2F910		23F5E
+2F911		23F8E
+2F912		6FC6
+2F913		7039
+2F914		701E
+2F915		701B
+2F916		3D96
+2F917		704A
+2F918		707D
+2F919		7077
+2F91A		70AD
+2F91B		20525
+2F91C		7145
+2F91D		24263
+2F91E		719C
+2F91F		243AB
+2F920		7228
+2F921		7235
+2F922		7250
+2F923		24608
+2F924		7280
+2F925		7295
+2F926		24735
+2F927		24814
+2F928		737A
+2F929		738B
+2F92A		3EAC
+2F92B		73A5
+2F92C	2F92D	3EB8
+2F92E		7447
+2F92F		745C
+2F930		7471
+2F931		7485
+2F932		74CA
+2F933		3F1B
+2F934		7524
+2F935		24C36
+2F936		753E
+2F937		24C92
+2F938		7570
+2F939		2219F
+2F93A		7610
+2F93B		24FA1
+2F93C		24FB8
+2F93D		25044
+2F93E		3FFC
+2F93F		4008
+2F940		76F4
+2F941		250F3
+2F942		250F2
+2F943		25119
+2F944		25133
+2F945		771E
+2F946	2F947	771F
+2F948		774A
+2F949		4039
+2F94A		778B
+2F94B		4046
+2F94C		4096
+2F94D		2541D
+2F94E		784E
+2F94F		788C
+2F950		78CC
+2F951		40E3
+2F952		25626
+2F953		7956
+2F954		2569A
+2F955		256C5
+2F956		798F
+2F957		79EB
+2F958		412F
+2F959		7A40
+2F95A		7A4A
+2F95B		7A4F
+2F95C		2597C
+2F95D	2F95E	25AA7
+2F95F		7AEE
+2F960		4202
+2F961		25BAB
+2F962		7BC6
+2F963		7BC9
+2F964		4227
+2F965		25C80
+2F966		7CD2
+2F967		42A0
+2F968		7CE8
+2F969		7CE3
+2F96A		7D00
+2F96B		25F86
+2F96C		7D63
+2F96D		4301
+2F96E		7DC7
+2F96F		7E02
+2F970		7E45
+2F971		4334
+2F972		26228
+2F973		26247
+2F974		4359
+2F975		262D9
+2F976		7F7A
+2F977		2633E
+2F978		7F95
+2F979		7FFA
+2F97A		8005
+2F97B		264DA
+2F97C		26523
+2F97D		8060
+2F97E		265A8
+2F97F		8070
+2F980		2335F
+2F981		43D5
+2F982		80B2
+2F983		8103
+2F984		440B
+2F985		813E
+2F986		5AB5
+2F987		267A7
+2F988		267B5
+2F989		23393
+2F98A		2339C
+2F98B		8201
+2F98C		8204
+2F98D		8F9E
+2F98E		446B
+2F98F		8291
+2F990		828B
+2F991		829D
+2F992		52B3
+2F993		82B1
+2F994		82B3
+2F995		82BD
+2F996		82E6
+2F997		26B3C
+2F998		82E5
+2F999		831D
+2F99A		8363
+2F99B		83AD
+2F99C		8323
+2F99D		83BD
+2F99E		83E7
+2F99F		8457
+2F9A0		8353
+2F9A1		83CA
+2F9A2		83CC
+2F9A3		83DC
+2F9A4		26C36
+2F9A5		26D6B
+2F9A6		26CD5
+2F9A7		452B
+2F9A8		84F1
+2F9A9		84F3
+2F9AA		8516
+2F9AB		273CA
+2F9AC		8564
+2F9AD		26F2C
+2F9AE		455D
+2F9AF		4561
+2F9B0		26FB1
+2F9B1		270D2
+2F9B2		456B
+2F9B3		8650
+2F9B4		865C
+2F9B5		8667
+2F9B6		8669
+2F9B7		86A9
+2F9B8		8688
+2F9B9		870E
+2F9BA		86E2
+2F9BB		8779
+2F9BC		8728
+2F9BD		876B
+2F9BE		8786
+2F9BF		45D7
+2F9C0		87E1
+2F9C1		8801
+2F9C2		45F9
+2F9C3		8860
+2F9C4		8863
+2F9C5		27667
+2F9C6		88D7
+2F9C7		88DE
+2F9C8		4635
+2F9C9		88FA
+2F9CA		34BB
+2F9CB		278AE
+2F9CC		27966
+2F9CD		46BE
+2F9CE		46C7
+2F9CF		8AA0
+2F9D0		8AED
+2F9D1		8B8A
+2F9D2		8C55
+2F9D3		27CA8
+2F9D4		8CAB
+2F9D5		8CC1
+2F9D6		8D1B
+2F9D7		8D77
+2F9D8		27F2F
+2F9D9		20804
+2F9DA		8DCB
+2F9DB		8DBC
+2F9DC		8DF0
+2F9DD		208DE
+2F9DE		8ED4
+2F9DF		8F38
+2F9E0		285D2
+2F9E1		285ED
+2F9E2		9094
+2F9E3		90F1
+2F9E4		9111
+2F9E5		2872E
+2F9E6		911B
+2F9E7		9238
+2F9E8		92D7
+2F9E9		92D8
+2F9EA		927C
+2F9EB		93F9
+2F9EC		9415
+2F9ED		28BFA
+2F9EE		958B
+2F9EF		4995
+2F9F0		95B7
+2F9F1		28D77
+2F9F2		49E6
+2F9F3		96C3
+2F9F4		5DB2
+2F9F5		9723
+2F9F6		29145
+2F9F7		2921A
+2F9F8		4A6E
+2F9F9		4A76
+2F9FA		97E0
+2F9FB		2940A
+2F9FC		4AB2
+2F9FD		29496
+2F9FE	2F9FF	980B
+2FA00		9829
+2FA01		295B6
+2FA02		98E2
+2FA03		4B33
+2FA04		9929
+2FA05		99A7
+2FA06		99C2
+2FA07		99FE
+2FA08		4BCE
+2FA09		29B30
+2FA0A		9B12
+2FA0B		9C40
+2FA0C		9CFD
+2FA0D		4CCE
+2FA0E		4CED
+2FA0F		9D67
+2FA10		2A0CE
+2FA11		4CF8
+2FA12		2A105
+2FA13		2A20E
+2FA14		2A291
+2FA15		9EBB
+2FA16		4D56
+2FA17		9EF9
+2FA18		9EFE
+2FA19		9F05
+2FA1A		9F0F
+2FA1B		9F16
+2FA1C		9F3B
+2FA1D		2A600
+END
@@ -0,0 +1,7375 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+# This file is for the use of utf8_heavy.pl and Unicode::UCD
+
+# Maps Unicode (not Perl single-form extensions) property names in loose
+# standard form to their corresponding standard names
+%utf8::loose_property_name_of = (
+'age' => 'age',
+'ahex' => 'ahex',
+'alpha' => 'alpha',
+'alphabetic' => 'alpha',
+'asciihexdigit' => 'ahex',
+'bc' => 'bc',
+'bidic' => 'bidic',
+'bidiclass' => 'bc',
+'bidicontrol' => 'bidic',
+'bidim' => 'bidim',
+'bidimirrored' => 'bidim',
+'bidipairedbrackettype' => 'bpt',
+'blk' => 'blk',
+'block' => 'blk',
+'bpt' => 'bpt',
+'canonicalcombiningclass' => 'ccc',
+'cased' => 'cased',
+'caseignorable' => 'ci',
+'category' => 'gc',
+'ccc' => 'ccc',
+'ce' => 'ce',
+'changeswhencasefolded' => 'cwcf',
+'changeswhencasemapped' => 'cwcm',
+'changeswhenlowercased' => 'cwl',
+'changeswhennfkccasefolded' => 'cwkcf',
+'changeswhentitlecased' => 'cwt',
+'changeswhenuppercased' => 'cwu',
+'ci' => 'ci',
+'compex' => 'compex',
+'compositionexclusion' => 'ce',
+'cwcf' => 'cwcf',
+'cwcm' => 'cwcm',
+'cwkcf' => 'cwkcf',
+'cwl' => 'cwl',
+'cwt' => 'cwt',
+'cwu' => 'cwu',
+'dash' => 'dash',
+'decompositiontype' => 'dt',
+'defaultignorablecodepoint' => 'di',
+'dep' => 'dep',
+'deprecated' => 'dep',
+'di' => 'di',
+'dia' => 'dia',
+'diacritic' => 'dia',
+'dt' => 'dt',
+'ea' => 'ea',
+'eastasianwidth' => 'ea',
+'ext' => 'ext',
+'extender' => 'ext',
+'fullcompositionexclusion' => 'compex',
+'gc' => 'gc',
+'gcb' => 'gcb',
+'generalcategory' => 'gc',
+'graphemebase' => 'grbase',
+'graphemeclusterbreak' => 'gcb',
+'graphemeextend' => 'grext',
+'grbase' => 'grbase',
+'grext' => 'grext',
+'hangulsyllabletype' => 'hst',
+'hex' => 'hex',
+'hexdigit' => 'hex',
+'hst' => 'hst',
+'hyphen' => 'hyphen',
+'idc' => 'idc',
+'idcontinue' => 'idc',
+'ideo' => 'ideo',
+'ideographic' => 'ideo',
+'ids' => 'ids',
+'idsb' => 'idsb',
+'idsbinaryoperator' => 'idsb',
+'idst' => 'idst',
+'idstart' => 'ids',
+'idstrinaryoperator' => 'idst',
+'in' => 'in',
+'indicpositionalcategory' => 'inpc',
+'indicsyllabiccategory' => 'insc',
+'inpc' => 'inpc',
+'insc' => 'insc',
+'jg' => 'jg',
+'joinc' => 'joinc',
+'joincontrol' => 'joinc',
+'joininggroup' => 'jg',
+'joiningtype' => 'jt',
+'jt' => 'jt',
+'lb' => 'lb',
+'linebreak' => 'lb',
+'loe' => 'loe',
+'logicalorderexception' => 'loe',
+'lower' => 'lower',
+'lowercase' => 'lower',
+'math' => 'math',
+'nchar' => 'nchar',
+'nfcqc' => 'nfcqc',
+'nfcquickcheck' => 'nfcqc',
+'nfdqc' => 'nfdqc',
+'nfdquickcheck' => 'nfdqc',
+'nfkcqc' => 'nfkcqc',
+'nfkcquickcheck' => 'nfkcqc',
+'nfkdqc' => 'nfkdqc',
+'nfkdquickcheck' => 'nfkdqc',
+'noncharactercodepoint' => 'nchar',
+'nt' => 'nt',
+'numerictype' => 'nt',
+'numericvalue' => 'nv',
+'nv' => 'nv',
+'patsyn' => 'patsyn',
+'patternsyntax' => 'patsyn',
+'patternwhitespace' => 'patws',
+'patws' => 'patws',
+'pcm' => 'pcm',
+'prependedconcatenationmark' => 'pcm',
+'presentin' => 'in',
+'qmark' => 'qmark',
+'quotationmark' => 'qmark',
+'radical' => 'radical',
+'regionalindicator' => 'ri',
+'ri' => 'ri',
+'sb' => 'sb',
+'sc' => 'sc',
+'script' => 'sc',
+'scriptextensions' => 'scx',
+'scx' => 'scx',
+'sd' => 'sd',
+'sentencebreak' => 'sb',
+'sentenceterminal' => 'sterm',
+'softdotted' => 'sd',
+'space' => 'wspace',
+'sterm' => 'sterm',
+'term' => 'term',
+'terminalpunctuation' => 'term',
+'uideo' => 'uideo',
+'unifiedideograph' => 'uideo',
+'upper' => 'upper',
+'uppercase' => 'upper',
+'variationselector' => 'vs',
+'verticalorientation' => 'vo',
+'vo' => 'vo',
+'vs' => 'vs',
+'wb' => 'wb',
+'whitespace' => 'wspace',
+'wordbreak' => 'wb',
+'wspace' => 'wspace',
+'xidc' => 'xidc',
+'xidcontinue' => 'xidc',
+'xids' => 'xids',
+'xidstart' => 'xids',
+);
+
+# Same, but strict names
+%utf8::strict_property_name_of = (
+'_perlgcb' => 'gcb',
+'_perlsb' => 'sb',
+'_perlscx' => '_perlscx',
+'_perlwb' => 'wb',
+);
+
+# Gives the definitions (in the form of inversion lists) for those properties
+# whose definitions aren't kept in files
+@utf8::inline_definitions = (
+
+'V0',
+'V1
+0',
+'V2
+0
+1114112',
+'V4
+9
+14
+32
+33',
+'V6
+10
+14
+133
+134
+8232
+8234',
+'V6
+48
+58
+65
+91
+97
+123',
+'V4
+65
+91
+97
+123',
+'V4
+9
+10
+32
+33',
+'V4
+0
+32
+127
+128',
+'V2
+48
+58',
+'V2
+33
+127',
+'V2
+97
+123',
+'V2
+32
+127',
+'V2
+65
+91',
+'V2
+55296
+57344',
+'V2
+12334
+12336',
+'V2
+119149
+119150',
+'V2
+12330
+12331',
+'V6
+861
+863
+864
+866
+7629
+7630',
+'V2
+837
+838',
+'V2
+12441
+12443',
+'V2
+7630
+7631',
+'V6
+801
+803
+807
+809
+7632
+7633',
+'V2
+1456
+1457',
+'V2
+1457
+1458',
+'V2
+1458
+1459',
+'V2
+1459
+1460',
+'V2
+1460
+1461',
+'V2
+1461
+1462',
+'V2
+1462
+1463',
+'V2
+1463
+1464',
+'V4
+1464
+1465
+1479
+1480',
+'V2
+1465
+1467',
+'V2
+1467
+1468',
+'V2
+1468
+1469',
+'V2
+1469
+1470',
+'V2
+1471
+1472',
+'V2
+1473
+1474',
+'V2
+1474
+1475',
+'V2
+64286
+64287',
+'V4
+1611
+1612
+2288
+2289',
+'V4
+1612
+1613
+2289
+2290',
+'V4
+1613
+1614
+2290
+2291',
+'V4
+1560
+1561
+1614
+1615',
+'V4
+1561
+1562
+1615
+1616',
+'V4
+1562
+1563
+1616
+1617',
+'V2
+1617
+1618',
+'V2
+1618
+1619',
+'V2
+1648
+1649',
+'V2
+1809
+1810',
+'V2
+3157
+3158',
+'V2
+3158
+3159',
+'V2
+3640
+3642',
+'V2
+3656
+3660',
+'V2
+3768
+3770',
+'V2
+3784
+3788',
+'V2
+3953
+3954',
+'V6
+3954
+3955
+3962
+3966
+3968
+3969',
+'V2
+3956
+3957',
+'V6
+48
+58
+65
+71
+97
+103',
+'V4
+4352
+4448
+43360
+43389',
+'V4
+4520
+4608
+55243
+55292',
+'V4
+4448
+4520
+55216
+55239',
+'V2
+13
+14',
+'V2
+10
+11',
+'V2
+127462
+127488',
+'V2
+8205
+8206',
+'V4
+12272
+12274
+12276
+12284',
+'V2
+12274
+12276',
+'V2
+43455
+43456',
+'V4
+6971
+6972
+43456
+43457',
+'V2
+6973
+6974',
+'V2
+8204
+8205',
+'V6
+6512
+6517
+43712
+43713
+43714
+43715',
+'V2
+69759
+69760',
+'V6
+2673
+2674
+70199
+70200
+72344
+72345',
+'V4
+3660
+3661
+6093
+6094',
+'V2
+2947
+2948',
+'V2
+6089
+6091',
+'V6
+70082
+70084
+72250
+72251
+72324
+72330',
+'V2
+69714
+69734',
+'V2
+3976
+3981',
+'V6
+3313
+3315
+7413
+7415
+69635
+69637',
+'V4
+3406
+3407
+73030
+73031',
+'V2
+6746
+6747',
+'V2
+8204
+8206',
+'V6
+11904
+11930
+11931
+12020
+12032
+12246',
+'V4
+133
+134
+8232
+8234',
+'V6
+6155
+6158
+65024
+65040
+917760
+918000',
+'V2
+34
+35',
+'V6
+11
+13
+133
+134
+8232
+8234',
+'V2
+39
+40',
+'V4
+8364
+8365
+65532
+65533',
+'V2
+8378
+8379',
+'V4
+1564
+1565
+8294
+8298',
+'V2
+13055
+13056',
+'V6
+9
+10
+11
+12
+31
+32',
+'V2
+8296
+8297',
+'V2
+8234
+8235',
+'V2
+8294
+8295',
+'V2
+8237
+8238',
+'V2
+8236
+8237',
+'V2
+8297
+8298',
+'V2
+8235
+8236',
+'V2
+8295
+8296',
+'V2
+8238
+8239',
+'V2
+65024
+65040',
+'V2
+19968
+40960',
+'V2
+12272
+12288',
+'V2
+3712
+3840',
+'V2
+92736
+92784',
+'V2
+1984
+2048',
+'V2
+9280
+9312',
+'V2
+57344
+63744',
+'V2
+42240
+42560',
+'V2
+71424
+71488',
+'V2
+43520
+43616',
+'V2
+4352
+4608',
+'V2
+42192
+42240',
+'V2
+93952
+94112',
+'V2
+71168
+71264',
+'V2
+70656
+70784',
+'V2
+69216
+69248',
+'V2
+917504
+917632',
+'V2
+3584
+3712',
+'V2
+5120
+5760',
+'V2
+0
+128',
+'V2
+125184
+125280',
+'V2
+42656
+42752',
+'V2
+7104
+7168',
+'V2
+5952
+5984',
+'V2
+71680
+71760',
+'V2
+880
+1024',
+'V2
+6016
+6144',
+'V2
+6400
+6480',
+'V2
+119040
+119296',
+'V2
+110960
+111360',
+'V2
+5760
+5792',
+'V2
+2816
+2944',
+'V2
+66736
+66816',
+'V2
+5792
+5888',
+'V2
+6480
+6528',
+'V2
+71296
+71376',
+'V2
+2944
+3072',
+'V2
+917760
+918000',
+'V2
+1536
+1792',
+'V2
+8592
+8704',
+'V2
+69632
+69760',
+'V2
+66208
+66272',
+'V2
+69888
+69968',
+'V2
+11392
+11520',
+'V2
+127024
+127136',
+'V2
+66352
+66384',
+'V2
+44032
+55216',
+'V2
+67808
+67840',
+'V2
+1424
+1536',
+'V2
+592
+688',
+'V2
+69760
+69840',
+'V2
+12688
+12704',
+'V2
+12032
+12256',
+'V2
+70144
+70224',
+'V2
+128
+256',
+'V2
+7168
+7248',
+'V2
+66176
+66208',
+'V2
+67872
+67904',
+'V2
+43312
+43360',
+'V2
+1792
+1872',
+'V2
+94208
+100352',
+'V2
+3072
+3200',
+'V2
+1920
+1984',
+'V2
+123584
+123648',
+'V2
+19904
+19968',
+'V2
+68352
+68416',
+'V2
+2432
+2560',
+'V2
+10240
+10496',
+'V2
+13312
+19904',
+'V2
+131072
+173792',
+'V2
+173824
+177984',
+'V2
+177984
+178208',
+'V2
+178208
+183984',
+'V2
+183984
+191472',
+'V2
+66560
+66640',
+'V2
+66816
+66864',
+'V2
+69600
+69632',
+'V2
+70400
+70528',
+'V2
+5920
+5952',
+'V2
+110592
+110848',
+'V2
+3200
+3328',
+'V2
+43264
+43312',
+'V2
+67072
+67456',
+'V2
+126976
+127024',
+'V2
+73440
+73472',
+'V2
+2112
+2144',
+'V2
+72816
+72896',
+'V2
+70272
+70320',
+'V2
+4096
+4256',
+'V2
+7248
+7296',
+'V2
+66688
+66736',
+'V2
+43072
+43136',
+'V2
+70016
+70112',
+'V2
+66640
+66688',
+'V2
+71040
+71168',
+'V2
+3456
+3584',
+'V2
+69424
+69488',
+'V2
+72272
+72368',
+'V2
+983040
+1048576',
+'V2
+1048576
+1114112',
+'V2
+5888
+5920',
+'V2
+6688
+6832',
+'V2
+43648
+43744',
+'V2
+3840
+4096',
+'V2
+70784
+70880',
+'V2
+6320
+6400',
+'V2
+1328
+1424',
+'V2
+6912
+7040',
+'V2
+92160
+92736',
+'V2
+92880
+92928',
+'V2
+12544
+12592',
+'V2
+6656
+6688',
+'V2
+5024
+5120',
+'V2
+1024
+1280',
+'V2
+9984
+10176',
+'V2
+113664
+113824',
+'V2
+4608
+4992',
+'V2
+4256
+4352',
+'V2
+7936
+8192',
+'V2
+2688
+2816',
+'V2
+2560
+2688',
+'V2
+12352
+12448',
+'V2
+43360
+43392',
+'V2
+55216
+55296',
+'V2
+43392
+43488',
+'V2
+110848
+110896',
+'V2
+12448
+12544',
+'V2
+69968
+70016',
+'V2
+66000
+66048',
+'V2
+65520
+65536',
+'V2
+5984
+6016',
+'V2
+73664
+73728',
+'V2
+11568
+11648',
+'V2
+66432
+66464',
+'V2
+7376
+7424',
+'V2
+64336
+65024',
+'V2
+65136
+65280',
+'V2
+1872
+1920',
+'V2
+72704
+72816',
+'V2
+13056
+13312',
+'V2
+73728
+74752',
+'V2
+128512
+128592',
+'V2
+65056
+65072',
+'V2
+70320
+70400',
+'V2
+256
+384',
+'V2
+384
+592',
+'V2
+11360
+11392',
+'V2
+42784
+43008',
+'V2
+43824
+43888',
+'V2
+3328
+3456',
+'V2
+6144
+6320',
+'V2
+67712
+67760',
+'V2
+6528
+6624',
+'V2
+66304
+66352',
+'V2
+66384
+66432',
+'V2
+68608
+68688',
+'V2
+67680
+67712',
+'V2
+72384
+72448',
+'V2
+2048
+2112',
+'V2
+7040
+7104',
+'V2
+2144
+2160',
+'V2
+128768
+128896',
+'V2
+2208
+2304',
+'V2
+126464
+126720',
+'V2
+9472
+9600',
+'V2
+12736
+12784',
+'V2
+12288
+12352',
+'V2
+12592
+12688',
+'V2
+2304
+2432',
+'V2
+11264
+11360',
+'V2
+68096
+68192',
+'V2
+68288
+68352',
+'V2
+11008
+11264',
+'V2
+66464
+66528',
+'V2
+69376
+69424',
+'V2
+67840
+67872',
+'V2
+43136
+43232',
+'V2
+65104
+65136',
+'V2
+10224
+10240',
+'V2
+10496
+10624',
+'V2
+129024
+129280',
+'V2
+71840
+71936',
+'V2
+42128
+42192',
+'V2
+12704
+12736',
+'V2
+43888
+43968',
+'V2
+119648
+119680',
+'V2
+1280
+1328',
+'V2
+12800
+13056',
+'V2
+11648
+11744',
+'V2
+4992
+5024',
+'V2
+7312
+7360',
+'V2
+11520
+11568',
+'V2
+12784
+12800',
+'V2
+93760
+93856',
+'V2
+43968
+44032',
+'V2
+9728
+9984',
+'V2
+43616
+43648',
+'V2
+43488
+43520',
+'V2
+72096
+72192',
+'V2
+8528
+8592',
+'V2
+92928
+93072',
+'V2
+7424
+7552',
+'V2
+8192
+8304',
+'V2
+69840
+69888',
+'V2
+8304
+8352',
+'V2
+43008
+43056',
+'V2
+119552
+119648',
+'V2
+40960
+42128',
+'V2
+64256
+64336',
+'V2
+129536
+129648',
+'V2
+11744
+11776',
+'V2
+42560
+42656',
+'V2
+7296
+7312',
+'V2
+768
+880',
+'V2
+43776
+43824',
+'V2
+73056
+73136',
+'V2
+6624
+6656',
+'V2
+72960
+73056',
+'V2
+119808
+120832',
+'V2
+124928
+125152',
+'V2
+71264
+71296',
+'V2
+68736
+68864',
+'V2
+127136
+127232',
+'V2
+110896
+110960',
+'V2
+7360
+7376',
+'V2
+65792
+65856',
+'V2
+9600
+9632',
+'V2
+43232
+43264',
+'V2
+122880
+122928',
+'V2
+56320
+57344',
+'V2
+8704
+8960',
+'V2
+119520
+119552',
+'V2
+8960
+9216',
+'V2
+65040
+65056',
+'V2
+65936
+66000',
+'V2
+118784
+119040',
+'V2
+65072
+65104',
+'V2
+11904
+12032',
+'V2
+68864
+68928',
+'V2
+55296
+56192',
+'V2
+43744
+43776',
+'V2
+7552
+7616',
+'V2
+68480
+68528',
+'V2
+11776
+11904',
+'V2
+9216
+9280',
+'V2
+8352
+8400',
+'V2
+6832
+6912',
+'V2
+7616
+7680',
+'V2
+9632
+9728',
+'V2
+67648
+67680',
+'V2
+68000
+68096',
+'V2
+127744
+128512',
+'V2
+688
+768',
+'V2
+68224
+68256',
+'V2
+68192
+68224',
+'V2
+128640
+128768',
+'V2
+72192
+72272',
+'V2
+74752
+74880',
+'V2
+67584
+67648',
+'V2
+9312
+9472',
+'V2
+65280
+65520',
+'V2
+56192
+56320',
+'V2
+43056
+43072',
+'V2
+65664
+65792',
+'V2
+65536
+65664',
+'V2
+10176
+10224',
+'V2
+10624
+10752',
+'V2
+10752
+11008',
+'V2
+100352
+101120',
+'V2
+119296
+119376',
+'V2
+66864
+66928',
+'V2
+126064
+126144',
+'V2
+8448
+8528',
+'V2
+120832
+121520',
+'V2
+66272
+66304',
+'V2
+128896
+129024',
+'V2
+94176
+94208',
+'V2
+7680
+7936',
+'V2
+128592
+128640',
+'V2
+65856
+65936',
+'V2
+63744
+64256',
+'V2
+77824
+78896',
+'V2
+127232
+127488',
+'V2
+67968
+68000',
+'V2
+42752
+42784',
+'V2
+126208
+126288',
+'V2
+82944
+83584',
+'V2
+68448
+68480',
+'V2
+123136
+123216',
+'V2
+68416
+68448',
+'V2
+70112
+70144',
+'V2
+194560
+195104',
+'V2
+8400
+8448',
+'V2
+74880
+75088',
+'V2
+127488
+127744',
+'V2
+113824
+113840',
+'V2
+129280
+129536',
+'V2
+129648
+129792',
+'V2
+78896
+78912',
+'V6
+188
+191
+8528
+8544
+8585
+8586',
+'V6
+65104
+65107
+65108
+65127
+65128
+65132',
+'V6
+12288
+12289
+65281
+65377
+65504
+65511',
+'V4
+0
+32
+127
+160',
+'V6
+57344
+63744
+983040
+1048574
+1048576
+1114110',
+'V2
+8232
+8233',
+'V2
+8233
+8234',
+'V2
+1829
+1830',
+'V2
+1871
+1872',
+'V2
+1815
+1816',
+'V2
+1830
+1831',
+'V2
+1607
+1608',
+'V2
+1825
+1826',
+'V2
+1826
+1827',
+'V2
+1725
+1726',
+'V6
+1591
+1593
+1695
+1696
+2211
+2212',
+'V2
+1836
+1837',
+'V4
+1810
+1811
+1837
+1838',
+'V2
+1818
+1819',
+'V2
+1823
+1824',
+'V6
+1605
+1606
+1893
+1895
+2215
+2216',
+'V6
+1606
+1607
+1721
+1725
+1895
+1898',
+'V2
+1833
+1834',
+'V2
+1835
+1836',
+'V2
+1819
+1821',
+'V2
+1821
+1822',
+'V2
+1817
+1818',
+'V2
+1808
+1809',
+'V4
+1811
+1813
+1838
+1839',
+'V2
+1870
+1871',
+'V2
+1832
+1833',
+'V2
+1869
+1870',
+'V2
+1824
+1825',
+'V2
+1822
+1823',
+'V2
+1729
+1731',
+'V2
+1827
+1828',
+'V2
+1706
+1707',
+'V2
+1816
+1817',
+'V2
+1746
+1748',
+'V2
+2235
+2236',
+'V2
+2236
+2237',
+'V6
+1813
+1815
+1834
+1835
+1839
+1840',
+'V4
+1726
+1727
+1791
+1792',
+'V2
+1831
+1832',
+'V6
+1577
+1578
+1728
+1729
+1749
+1750',
+'V2
+2237
+2238',
+'V2
+2145
+2146',
+'V2
+2151
+2152',
+'V2
+2220
+2221',
+'V2
+2225
+2226',
+'V2
+1741
+1742',
+'V2
+1828
+1829',
+'V2
+2150
+2151',
+'V2
+2152
+2153',
+'V2
+2144
+2145',
+'V2
+2148
+2149',
+'V2
+2146
+2147',
+'V2
+2154
+2155',
+'V2
+2147
+2148',
+'V2
+68315
+68317',
+'V2
+2153
+2154',
+'V2
+2149
+2150',
+'V2
+68310
+68311',
+'V2
+68311
+68312',
+'V2
+68331
+68332',
+'V2
+68324
+68325',
+'V2
+68333
+68334',
+'V2
+68295
+68296',
+'V2
+1731
+1732',
+'V2
+68313
+68315',
+'V2
+68289
+68291',
+'V2
+68332
+68333',
+'V2
+68301
+68302',
+'V2
+68304
+68307',
+'V2
+68318
+68321',
+'V2
+68321
+68322',
+'V2
+68302
+68303',
+'V2
+68303
+68304',
+'V2
+68288
+68289',
+'V2
+68291
+68293',
+'V2
+68317
+68318',
+'V2
+68297
+68299',
+'V6
+68866
+68867
+68873
+68874
+68892
+68893',
+'V2
+68293
+68294',
+'V2
+68307
+68308',
+'V2
+68312
+68313',
+'V2
+68334
+68335',
+'V2
+68308
+68309',
+'V2
+68335
+68336',
+'V2
+68309
+68310',
+'V2
+1914
+1916',
+'V4
+8212
+8213
+11834
+11836',
+'V4
+11
+13
+8232
+8234',
+'V2
+65532
+65533',
+'V4
+41
+42
+93
+94',
+'V2
+127995
+128000',
+'V2
+45
+46',
+'V2
+133
+134',
+'V2
+55296
+57344',
+'V2
+32
+33',
+'V2
+47
+48',
+'V4
+8288
+8289
+65279
+65280',
+'V2
+8203
+8204',
+'V2
+12881
+12882',
+'V2
+12882
+12883',
+'V2
+12883
+12884',
+'V2
+12884
+12885',
+'V2
+12885
+12886',
+'V2
+12886
+12887',
+'V2
+12887
+12888',
+'V2
+12888
+12889',
+'V2
+12889
+12890',
+'V2
+12891
+12892',
+'V2
+12892
+12893',
+'V2
+12893
+12894',
+'V2
+12894
+12895',
+'V2
+12895
+12896',
+'V2
+12977
+12978',
+'V2
+12978
+12979',
+'V2
+12979
+12980',
+'V2
+12980
+12981',
+'V2
+12982
+12983',
+'V2
+12983
+12984',
+'V2
+12984
+12985',
+'V2
+12985
+12986',
+'V2
+12986
+12987',
+'V2
+12987
+12988',
+'V2
+12988
+12989',
+'V2
+12989
+12990',
+'V2
+12990
+12991',
+'V6
+3422
+3423
+8533
+8534
+73679
+73680',
+'V2
+8528
+8529',
+'V2
+8529
+8530',
+'V2
+8534
+8535',
+'V2
+3883
+3884',
+'V2
+8535
+8536',
+'V2
+8540
+8541',
+'V2
+8536
+8537',
+'V2
+3884
+3885',
+'V6
+8538
+8539
+68095
+68096
+74844
+74845',
+'V2
+8541
+8542',
+'V2
+3885
+3886',
+'V2
+8542
+8543',
+'V2
+3886
+3887',
+'V2
+3891
+3892',
+'V6
+3420
+3421
+8530
+8531
+73675
+73676',
+'V2
+68086
+68087',
+'V4
+3419
+3420
+73672
+73673',
+'V2
+73669
+73670',
+'V4
+3417
+3418
+73668
+73669',
+'V2
+73667
+73668',
+'V2
+73666
+73667',
+'V2
+3887
+3888',
+'V2
+3888
+3889',
+'V2
+3889
+3890',
+'V2
+3890
+3891',
+'V4
+3421
+3422
+73677
+73678',
+'V2
+73671
+73672',
+'V4
+3418
+3419
+73670
+73671',
+'V2
+68090
+68091',
+'V2
+68092
+68093',
+'V4
+3416
+3417
+73665
+73666',
+'V4
+73664
+73665
+73684
+73685',
+'V2
+68028
+68029',
+'V4
+68078
+68079
+126111
+126112',
+'V2
+74802
+74803',
+'V2
+68079
+68080',
+'V2
+68080
+68081',
+'V2
+74803
+74804',
+'V2
+68081
+68082',
+'V2
+68082
+68083',
+'V2
+68083
+68084',
+'V2
+68084
+68085',
+'V2
+68085
+68086',
+'V2
+93022
+93023',
+'V2
+126113
+126114',
+'V2
+126114
+126115',
+'V6
+20159
+20160
+20740
+20741
+93023
+93024',
+'V2
+93024
+93025',
+'V4
+20806
+20807
+93025
+93026',
+'V4
+40960
+42125
+42128
+42183',
+'V6
+125184
+125260
+125264
+125274
+125278
+125280',
+'V6
+746
+748
+12549
+12592
+12704
+12731',
+'V4
+6656
+6684
+6686
+6688',
+'V2
+5952
+5972',
+'V4
+69888
+69941
+69942
+69959',
+'V6
+994
+1008
+11392
+11508
+11513
+11520',
+'V2
+71680
+71740',
+'V2
+5920
+5941',
+'V6
+43392
+43470
+43472
+43482
+43486
+43488',
+'V4
+43264
+43310
+43311
+43312',
+'V4
+70144
+70162
+70163
+70207',
+'V4
+69760
+69826
+69837
+69838',
+'V6
+67072
+67383
+67392
+67414
+67424
+67432',
+'V2
+69968
+70007',
+'V4
+2112
+2140
+2142
+2143',
+'V4
+68288
+68327
+68331
+68343',
+'V4
+71168
+71237
+71248
+71258',
+'V6
+4096
+4256
+43488
+43519
+43616
+43648',
+'V6
+72096
+72104
+72106
+72152
+72154
+72165',
+'V2
+66384
+66427',
+'V2
+43072
+43128',
+'V6
+68480
+68498
+68505
+68509
+68521
+68528',
+'V4
+68864
+68904
+68912
+68922',
+'V4
+70016
+70094
+70096
+70112',
+'V4
+70320
+70379
+70384
+70394',
+'V2
+69424
+69466',
+'V2
+43008
+43052',
+'V6
+5984
+5997
+5998
+6001
+6002
+6004',
+'V4
+71296
+71353
+71360
+71370',
+'V4
+6480
+6510
+6512
+6517',
+'V4
+5888
+5901
+5902
+5909',
+'V2
+1920
+1970',
+'V4
+70784
+70856
+70864
+70874',
+'V6
+92736
+92767
+92768
+92778
+92782
+92784',
+'V4
+1984
+2043
+2045
+2048',
+'V2
+42240
+42540',
+'V4
+66864
+66916
+66927
+66928',
+'V6
+71424
+71451
+71453
+71468
+71472
+71488',
+'V4
+67648
+67670
+67671
+67680',
+'V4
+68352
+68406
+68409
+68416',
+'V4
+6912
+6988
+6992
+7037',
+'V4
+42656
+42744
+92160
+92729',
+'V4
+92880
+92910
+92912
+92918',
+'V4
+7104
+7156
+7164
+7168',
+'V6
+69632
+69710
+69714
+69744
+69759
+69760',
+'V6
+6656
+6684
+6686
+6688
+43471
+43472',
+'V4
+5941
+5943
+5952
+5972',
+'V4
+5120
+5760
+6320
+6390',
+'V2
+66208
+66257',
+'V6
+5024
+5110
+5112
+5118
+43888
+43968',
+'V6
+2404
+2416
+43056
+43066
+71680
+71740',
+'V4
+77824
+78895
+78896
+78905',
+'V2
+66816
+66856',
+'V2
+69600
+69623',
+'V2
+66352
+66379',
+'V2
+5920
+5943',
+'V6
+67808
+67827
+67828
+67830
+67835
+67840',
+'V2
+82944
+83527',
+'V6
+68736
+68787
+68800
+68851
+68858
+68864',
+'V4
+66304
+66340
+66349
+66352',
+'V6
+43392
+43470
+43471
+43482
+43486
+43488',
+'V6
+7168
+7224
+7227
+7242
+7245
+7248',
+'V2
+66176
+66205',
+'V4
+67872
+67898
+67903
+67904',
+'V6
+2404
+2416
+43056
+43066
+69968
+70007',
+'V2
+73440
+73465',
+'V6
+1600
+1601
+2112
+2140
+2142
+2143',
+'V6
+1600
+1601
+68288
+68327
+68331
+68343',
+'V6
+72816
+72848
+72850
+72872
+72873
+72887',
+'V2
+93760
+93851',
+'V4
+124928
+125125
+125127
+125143',
+'V6
+68000
+68024
+68028
+68048
+68050
+68096',
+'V6
+93952
+94027
+94031
+94088
+94095
+94112',
+'V6
+43056
+43066
+71168
+71237
+71248
+71258',
+'V6
+43744
+43767
+43968
+44014
+44016
+44026',
+'V4
+67712
+67743
+67751
+67760',
+'V6
+70656
+70746
+70747
+70748
+70749
+70752',
+'V4
+94177
+94178
+110960
+111356',
+'V2
+5760
+5789',
+'V2
+68608
+68681',
+'V4
+66736
+66772
+66776
+66812',
+'V4
+66688
+66718
+66720
+66730',
+'V2
+72384
+72441',
+'V4
+1155
+1156
+66384
+66427',
+'V6
+6146
+6148
+6149
+6150
+43072
+43128',
+'V4
+68448
+68467
+68472
+68480',
+'V4
+67840
+67868
+67871
+67872',
+'V4
+68416
+68438
+68440
+68448',
+'V4
+43312
+43348
+43359
+43360',
+'V4
+5792
+5867
+5870
+5881',
+'V4
+2048
+2094
+2096
+2111',
+'V4
+43136
+43206
+43214
+43226',
+'V6
+120832
+121484
+121499
+121504
+121505
+121520',
+'V4
+71040
+71094
+71096
+71134',
+'V4
+1600
+1601
+69424
+69466',
+'V2
+69376
+69416',
+'V4
+69840
+69865
+69872
+69882',
+'V2
+72272
+72355',
+'V4
+7040
+7104
+7360
+7368',
+'V6
+2404
+2406
+2534
+2544
+43008
+43052',
+'V6
+4160
+4170
+6480
+6510
+6512
+6517',
+'V6
+94176
+94177
+94208
+100344
+100352
+101107',
+'V4
+43648
+43715
+43739
+43744',
+'V6
+11568
+11624
+11631
+11633
+11647
+11648',
+'V6
+5888
+5901
+5902
+5909
+5941
+5943',
+'V4
+3585
+3643
+3648
+3676',
+'V4
+66432
+66462
+66463
+66464',
+'V4
+71840
+71923
+71935
+71936',
+'V4
+123584
+123642
+123647
+123648',
+'V4
+66464
+66500
+66504
+66518',
+'V2
+72192
+72264',
+,
+);
+
+# Maps property, table to file for those using stricter matching.  For paths
+# whose directory is '#', the file is in the form of a numeric index into
+# @inline_definitions
+%utf8::stricter_to_file_of = (
+'_perl_any_folds' => 'Perl/_PerlAny',
+'_perl_charname_begin' => 'Perl/_PerlCha',
+'_perl_charname_continue' => 'Perl/_PerlCh2',
+'_perl_folds_to_multi_char' => 'Perl/_PerlFol',
+'_perl_idcont' => 'Perl/_PerlIDC',
+'_perl_idstart' => 'Perl/_PerlIDS',
+'_perl_is_in_multi_char_fold' => 'Perl/_PerlIsI',
+'_perl_nchar' => 'Perl/_PerlNch',
+'_perl_non_final_folds' => 'Perl/_PerlNon',
+'_perl_patws' => 'Perl/_PerlPat',
+'_perl_problematic_locale_foldeds_start' => 'Perl/_PerlPr2',
+'_perl_problematic_locale_folds' => 'Perl/_PerlPro',
+'_perl_quotemeta' => 'Perl/_PerlQuo',
+'_perl_surrogate' => '#/14',
+'age=1.1' => 'Age/V11',
+'age=10' => 'Age/V100',
+'age=10.0' => 'Age/V100',
+'age=11' => 'Age/V110',
+'age=11.0' => 'Age/V110',
+'age=12' => 'Age/V120',
+'age=12.0' => 'Age/V120',
+'age=12.1' => '#/95',
+'age=2' => 'Age/V20',
+'age=2.0' => 'Age/V20',
+'age=2.1' => '#/92',
+'age=3' => 'Age/V30',
+'age=3.0' => 'Age/V30',
+'age=3.1' => 'Age/V31',
+'age=3.2' => 'Age/V32',
+'age=4' => 'Age/V40',
+'age=4.0' => 'Age/V40',
+'age=4.1' => 'Age/V41',
+'age=5' => 'Age/V50',
+'age=5.0' => 'Age/V50',
+'age=5.1' => 'Age/V51',
+'age=5.2' => 'Age/V52',
+'age=6' => 'Age/V60',
+'age=6.0' => 'Age/V60',
+'age=6.1' => 'Age/V61',
+'age=6.2' => '#/93',
+'age=6.3' => '#/94',
+'age=7' => 'Age/V70',
+'age=7.0' => 'Age/V70',
+'age=8' => 'Age/V80',
+'age=8.0' => 'Age/V80',
+'age=9' => 'Age/V90',
+'age=9.0' => 'Age/V90',
+'ccc=0' => 'Ccc/NR',
+'ccc=1' => 'Ccc/OV',
+'ccc=10' => '#/23',
+'ccc=103' => '#/52',
+'ccc=107' => '#/53',
+'ccc=11' => '#/24',
+'ccc=118' => '#/54',
+'ccc=12' => '#/25',
+'ccc=122' => '#/55',
+'ccc=129' => '#/56',
+'ccc=13' => '#/26',
+'ccc=130' => '#/57',
+'ccc=132' => '#/58',
+'ccc=133' => '#/0',
+'ccc=14' => '#/27',
+'ccc=15' => '#/28',
+'ccc=16' => '#/29',
+'ccc=17' => '#/30',
+'ccc=18' => '#/31',
+'ccc=19' => '#/32',
+'ccc=20' => '#/33',
+'ccc=200' => '#/0',
+'ccc=202' => '#/22',
+'ccc=21' => '#/34',
+'ccc=214' => '#/21',
+'ccc=216' => 'Ccc/ATAR',
+'ccc=218' => '#/17',
+'ccc=22' => '#/35',
+'ccc=220' => 'Ccc/B',
+'ccc=222' => 'Ccc/BR',
+'ccc=224' => '#/15',
+'ccc=226' => '#/16',
+'ccc=228' => 'Ccc/AL',
+'ccc=23' => '#/36',
+'ccc=230' => 'Ccc/A',
+'ccc=232' => 'Ccc/AR',
+'ccc=233' => 'Ccc/DB',
+'ccc=234' => '#/18',
+'ccc=24' => '#/37',
+'ccc=240' => '#/19',
+'ccc=25' => '#/38',
+'ccc=26' => '#/39',
+'ccc=27' => '#/40',
+'ccc=28' => '#/41',
+'ccc=29' => '#/42',
+'ccc=30' => '#/43',
+'ccc=31' => '#/44',
+'ccc=32' => '#/45',
+'ccc=33' => '#/46',
+'ccc=34' => '#/47',
+'ccc=35' => '#/48',
+'ccc=36' => '#/49',
+'ccc=7' => 'Ccc/NK',
+'ccc=8' => '#/20',
+'ccc=84' => '#/50',
+'ccc=9' => 'Ccc/VR',
+'ccc=91' => '#/51',
+'in=1.1' => 'Age/V11',
+'in=10' => 'In/10_0',
+'in=10.0' => 'In/10_0',
+'in=11' => 'In/11_0',
+'in=11.0' => 'In/11_0',
+'in=12' => 'In/12_0',
+'in=12.0' => 'In/12_0',
+'in=12.1' => 'In/12_1',
+'in=2' => 'In/2_0',
+'in=2.0' => 'In/2_0',
+'in=2.1' => 'In/2_1',
+'in=3' => 'In/3_0',
+'in=3.0' => 'In/3_0',
+'in=3.1' => 'In/3_1',
+'in=3.2' => 'In/3_2',
+'in=4' => 'In/4_0',
+'in=4.0' => 'In/4_0',
+'in=4.1' => 'In/4_1',
+'in=5' => 'In/5_0',
+'in=5.0' => 'In/5_0',
+'in=5.1' => 'In/5_1',
+'in=5.2' => 'In/5_2',
+'in=6' => 'In/6_0',
+'in=6.0' => 'In/6_0',
+'in=6.1' => 'In/6_1',
+'in=6.2' => 'In/6_2',
+'in=6.3' => 'In/6_3',
+'in=7' => 'In/7_0',
+'in=7.0' => 'In/7_0',
+'in=8' => 'In/8_0',
+'in=8.0' => 'In/8_0',
+'in=9' => 'In/9_0',
+'in=9.0' => 'In/9_0',
+'nv=-1/2' => '#/550',
+'nv=0' => 'Nv/0',
+'nv=1' => 'Nv/1',
+'nv=1/10' => '#/551',
+'nv=1/12' => '#/552',
+'nv=1/16' => 'Nv/1_16',
+'nv=1/160' => '#/567',
+'nv=1/2' => 'Nv/1_2',
+'nv=1/20' => '#/553',
+'nv=1/3' => 'Nv/1_3',
+'nv=1/32' => '#/554',
+'nv=1/320' => '#/568',
+'nv=1/4' => 'Nv/1_4',
+'nv=1/40' => '#/555',
+'nv=1/5' => '#/536',
+'nv=1/6' => 'Nv/1_6',
+'nv=1/64' => '#/556',
+'nv=1/7' => '#/537',
+'nv=1/8' => 'Nv/1_8',
+'nv=1/80' => '#/557',
+'nv=1/9' => '#/538',
+'nv=10' => 'Nv/10',
+'nv=100' => 'Nv/100',
+'nv=1000' => 'Nv/1000',
+'nv=10000' => 'Nv/10000',
+'nv=100000' => 'Nv/100000',
+'nv=1000000' => '#/580',
+'nv=10000000' => '#/581',
+'nv=100000000' => '#/583',
+'nv=10000000000' => '#/584',
+'nv=1000000000000' => '#/585',
+'nv=11' => 'Nv/11',
+'nv=11/12' => '#/569',
+'nv=11/2' => '#/558',
+'nv=12' => 'Nv/12',
+'nv=13' => 'Nv/13',
+'nv=13/2' => '#/559',
+'nv=14' => 'Nv/14',
+'nv=15' => 'Nv/15',
+'nv=15/2' => '#/560',
+'nv=16' => 'Nv/16',
+'nv=17' => 'Nv/17',
+'nv=17/2' => '#/561',
+'nv=18' => 'Nv/18',
+'nv=19' => 'Nv/19',
+'nv=2' => 'Nv/2',
+'nv=2/3' => 'Nv/2_3',
+'nv=2/5' => '#/539',
+'nv=20' => 'Nv/20',
+'nv=200' => 'Nv/200',
+'nv=2000' => 'Nv/2000',
+'nv=20000' => 'Nv/20000',
+'nv=200000' => '#/570',
+'nv=20000000' => '#/582',
+'nv=21' => '#/509',
+'nv=216000' => '#/571',
+'nv=22' => '#/510',
+'nv=23' => '#/511',
+'nv=24' => '#/512',
+'nv=25' => '#/513',
+'nv=26' => '#/514',
+'nv=27' => '#/515',
+'nv=28' => '#/516',
+'nv=29' => '#/517',
+'nv=3' => 'Nv/3',
+'nv=3/16' => 'Nv/3_16',
+'nv=3/2' => '#/540',
+'nv=3/20' => '#/562',
+'nv=3/4' => 'Nv/3_4',
+'nv=3/5' => '#/541',
+'nv=3/64' => '#/563',
+'nv=3/8' => '#/542',
+'nv=3/80' => '#/564',
+'nv=30' => 'Nv/30',
+'nv=300' => 'Nv/300',
+'nv=3000' => 'Nv/3000',
+'nv=30000' => 'Nv/30000',
+'nv=300000' => '#/572',
+'nv=31' => '#/518',
+'nv=32' => '#/519',
+'nv=33' => '#/520',
+'nv=34' => '#/521',
+'nv=35' => '#/522',
+'nv=36' => '#/523',
+'nv=37' => '#/524',
+'nv=38' => '#/525',
+'nv=39' => '#/526',
+'nv=4' => 'Nv/4',
+'nv=4/5' => '#/543',
+'nv=40' => 'Nv/40',
+'nv=400' => 'Nv/400',
+'nv=4000' => 'Nv/4000',
+'nv=40000' => 'Nv/40000',
+'nv=400000' => '#/573',
+'nv=41' => '#/527',
+'nv=42' => '#/528',
+'nv=43' => '#/529',
+'nv=432000' => '#/574',
+'nv=44' => '#/530',
+'nv=45' => '#/531',
+'nv=46' => '#/532',
+'nv=47' => '#/533',
+'nv=48' => '#/534',
+'nv=49' => '#/535',
+'nv=5' => 'Nv/5',
+'nv=5/12' => '#/565',
+'nv=5/2' => '#/544',
+'nv=5/6' => '#/545',
+'nv=5/8' => '#/546',
+'nv=50' => 'Nv/50',
+'nv=500' => 'Nv/500',
+'nv=5000' => 'Nv/5000',
+'nv=50000' => 'Nv/50000',
+'nv=500000' => '#/575',
+'nv=6' => 'Nv/6',
+'nv=60' => 'Nv/60',
+'nv=600' => 'Nv/600',
+'nv=6000' => 'Nv/6000',
+'nv=60000' => 'Nv/60000',
+'nv=600000' => '#/576',
+'nv=7' => 'Nv/7',
+'nv=7/12' => '#/566',
+'nv=7/2' => '#/547',
+'nv=7/8' => '#/548',
+'nv=70' => 'Nv/70',
+'nv=700' => 'Nv/700',
+'nv=7000' => 'Nv/7000',
+'nv=70000' => 'Nv/70000',
+'nv=700000' => '#/577',
+'nv=8' => 'Nv/8',
+'nv=80' => 'Nv/80',
+'nv=800' => 'Nv/800',
+'nv=8000' => 'Nv/8000',
+'nv=80000' => 'Nv/80000',
+'nv=800000' => '#/578',
+'nv=9' => 'Nv/9',
+'nv=9/2' => '#/549',
+'nv=90' => 'Nv/90',
+'nv=900' => 'Nv/900',
+'nv=9000' => 'Nv/9000',
+'nv=90000' => 'Nv/90000',
+'nv=900000' => '#/579',
+);
+
+# Maps property, table to file for those using loose matching.  For paths
+# whose directory is '#', the file is in the form of a numeric index into
+# @inline_definitions
+%utf8::loose_to_file_of = (
+'adlam' => 'Scx/Adlm',
+'adlm' => 'Scx/Adlm',
+'aegeannumbers' => '#/332',
+'age=na' => 'Age/NA',
+'age=unassigned' => 'Age/NA',
+'age=v100' => 'Age/V100',
+'age=v11' => 'Age/V11',
+'age=v110' => 'Age/V110',
+'age=v120' => 'Age/V120',
+'age=v121' => '#/95',
+'age=v20' => 'Age/V20',
+'age=v21' => '#/92',
+'age=v30' => 'Age/V30',
+'age=v31' => 'Age/V31',
+'age=v32' => 'Age/V32',
+'age=v40' => 'Age/V40',
+'age=v41' => 'Age/V41',
+'age=v50' => 'Age/V50',
+'age=v51' => 'Age/V51',
+'age=v52' => 'Age/V52',
+'age=v60' => 'Age/V60',
+'age=v61' => 'Age/V61',
+'age=v62' => '#/93',
+'age=v63' => '#/94',
+'age=v70' => 'Age/V70',
+'age=v80' => 'Age/V80',
+'age=v90' => 'Age/V90',
+'aghb' => '#/623',
+'ahex' => '#/59',
+'ahex=f' => '#/!59',
+'ahex=false' => '#/!59',
+'ahex=n' => '#/!59',
+'ahex=no' => '#/!59',
+'ahex=t' => '#/59',
+'ahex=true' => '#/59',
+'ahex=y' => '#/59',
+'ahex=yes' => '#/59',
+'ahom' => '#/624',
+'alchemical' => '#/268',
+'alchemicalsymbols' => '#/268',
+'all' => '#/1',
+'alnum' => 'Perl/Alnum',
+'alpha' => 'Alpha/Y',
+'alpha=f' => '!Alpha/Y',
+'alpha=false' => '!Alpha/Y',
+'alpha=n' => '!Alpha/Y',
+'alpha=no' => '!Alpha/Y',
+'alpha=t' => 'Alpha/Y',
+'alpha=true' => 'Alpha/Y',
+'alpha=y' => 'Alpha/Y',
+'alpha=yes' => 'Alpha/Y',
+'alphabetic' => 'Alpha/Y',
+'alphabeticpf' => '#/315',
+'alphabeticpresentationforms' => '#/315',
+'anatolianhieroglyphs' => '#/644',
+'ancientgreekmusic' => '#/376',
+'ancientgreekmusicalnotation' => '#/376',
+'ancientgreeknumbers' => '#/386',
+'ancientsymbols' => '#/341',
+'any' => '#/2',
+'arab' => 'Scx/Arab',
+'arabic' => 'Scx/Arab',
+'arabicexta' => '#/269',
+'arabicextendeda' => '#/269',
+'arabicmath' => '#/270',
+'arabicmathematicalalphabeticsymbols' => '#/270',
+'arabicpfa' => '#/242',
+'arabicpfb' => '#/243',
+'arabicpresentationformsa' => '#/242',
+'arabicpresentationformsb' => '#/243',
+'arabicsup' => '#/244',
+'arabicsupplement' => '#/244',
+'armenian' => 'Scx/Armn',
+'armi' => '#/625',
+'armn' => 'Scx/Armn',
+'arrows' => '#/146',
+'ascii' => '#/126',
+'asciihexdigit' => '#/59',
+'assigned' => 'Perl/Assigned',
+'avestan' => '#/626',
+'avst' => '#/626',
+'bali' => '#/627',
+'balinese' => '#/627',
+'bamu' => '#/628',
+'bamum' => '#/628',
+'bamumsup' => '#/215',
+'bamumsupplement' => '#/215',
+'basiclatin' => '#/126',
+'bass' => '#/629',
+'bassavah' => '#/629',
+'batak' => '#/630',
+'batk' => '#/630',
+'bc=al' => 'Bc/AL',
+'bc=an' => 'Bc/AN',
+'bc=arabicletter' => 'Bc/AL',
+'bc=arabicnumber' => 'Bc/AN',
+'bc=b' => 'Bc/B',
+'bc=bn' => 'Bc/BN',
+'bc=boundaryneutral' => 'Bc/BN',
+'bc=commonseparator' => 'Bc/CS',
+'bc=cs' => 'Bc/CS',
+'bc=en' => 'Bc/EN',
+'bc=es' => 'Bc/ES',
+'bc=et' => 'Bc/ET',
+'bc=europeannumber' => 'Bc/EN',
+'bc=europeanseparator' => 'Bc/ES',
+'bc=europeanterminator' => 'Bc/ET',
+'bc=firststrongisolate' => '#/97',
+'bc=fsi' => '#/97',
+'bc=l' => 'Bc/L',
+'bc=lefttoright' => 'Bc/L',
+'bc=lefttorightembedding' => '#/98',
+'bc=lefttorightisolate' => '#/99',
+'bc=lefttorightoverride' => '#/100',
+'bc=lre' => '#/98',
+'bc=lri' => '#/99',
+'bc=lro' => '#/100',
+'bc=nonspacingmark' => 'Bc/NSM',
+'bc=nsm' => 'Bc/NSM',
+'bc=on' => 'Bc/ON',
+'bc=otherneutral' => 'Bc/ON',
+'bc=paragraphseparator' => 'Bc/B',
+'bc=pdf' => '#/101',
+'bc=pdi' => '#/102',
+'bc=popdirectionalformat' => '#/101',
+'bc=popdirectionalisolate' => '#/102',
+'bc=r' => 'Bc/R',
+'bc=righttoleft' => 'Bc/R',
+'bc=righttoleftembedding' => '#/103',
+'bc=righttoleftisolate' => '#/104',
+'bc=righttoleftoverride' => '#/105',
+'bc=rle' => '#/103',
+'bc=rli' => '#/104',
+'bc=rlo' => '#/105',
+'bc=s' => '#/96',
+'bc=segmentseparator' => '#/96',
+'bc=whitespace' => 'Bc/WS',
+'bc=ws' => 'Bc/WS',
+'beng' => 'Scx/Beng',
+'bengali' => 'Scx/Beng',
+'bhaiksuki' => 'Scx/Bhks',
+'bhks' => 'Scx/Bhks',
+'bidic' => 'BidiC/Y',
+'bidic=f' => '!BidiC/Y',
+'bidic=false' => '!BidiC/Y',
+'bidic=n' => '!BidiC/Y',
+'bidic=no' => '!BidiC/Y',
+'bidic=t' => 'BidiC/Y',
+'bidic=true' => 'BidiC/Y',
+'bidic=y' => 'BidiC/Y',
+'bidic=yes' => 'BidiC/Y',
+'bidicontrol' => 'BidiC/Y',
+'bidim' => 'BidiM/Y',
+'bidim=f' => '!BidiM/Y',
+'bidim=false' => '!BidiM/Y',
+'bidim=n' => '!BidiM/Y',
+'bidim=no' => '!BidiM/Y',
+'bidim=t' => 'BidiM/Y',
+'bidim=true' => 'BidiM/Y',
+'bidim=y' => 'BidiM/Y',
+'bidim=yes' => 'BidiM/Y',
+'bidimirrored' => 'BidiM/Y',
+'blank' => 'Perl/Blank',
+'blk=adlam' => '#/127',
+'blk=aegeannumbers' => '#/332',
+'blk=ahom' => '#/115',
+'blk=alchemical' => '#/268',
+'blk=alchemicalsymbols' => '#/268',
+'blk=alphabeticpf' => '#/315',
+'blk=alphabeticpresentationforms' => '#/315',
+'blk=anatolianhieroglyphs' => '#/393',
+'blk=ancientgreekmusic' => '#/376',
+'blk=ancientgreekmusicalnotation' => '#/376',
+'blk=ancientgreeknumbers' => '#/386',
+'blk=ancientsymbols' => '#/341',
+'blk=arabic' => '#/145',
+'blk=arabicexta' => '#/269',
+'blk=arabicextendeda' => '#/269',
+'blk=arabicmath' => '#/270',
+'blk=arabicmathematicalalphabeticsymbols' => '#/270',
+'blk=arabicpfa' => '#/242',
+'blk=arabicpfb' => '#/243',
+'blk=arabicpresentationformsa' => '#/242',
+'blk=arabicpresentationformsb' => '#/243',
+'blk=arabicsup' => '#/244',
+'blk=arabicsupplement' => '#/244',
+'blk=armenian' => '#/213',
+'blk=arrows' => '#/146',
+'blk=ascii' => '#/126',
+'blk=avestan' => '#/172',
+'blk=balinese' => '#/214',
+'blk=bamum' => '#/128',
+'blk=bamumsup' => '#/215',
+'blk=bamumsupplement' => '#/215',
+'blk=basiclatin' => '#/126',
+'blk=bassavah' => '#/216',
+'blk=batak' => '#/129',
+'blk=bengali' => '#/173',
+'blk=bhaiksuki' => '#/245',
+'blk=blockelements' => '#/333',
+'blk=bopomofo' => '#/217',
+'blk=bopomofoext' => '#/290',
+'blk=bopomofoextended' => '#/290',
+'blk=boxdrawing' => '#/271',
+'blk=brahmi' => '#/147',
+'blk=braille' => '#/174',
+'blk=braillepatterns' => '#/174',
+'blk=buginese' => '#/218',
+'blk=buhid' => '#/130',
+'blk=byzantinemusic' => '#/342',
+'blk=byzantinemusicalsymbols' => '#/342',
+'blk=canadiansyllabics' => '#/125',
+'blk=carian' => '#/148',
+'blk=caucasianalbanian' => '#/377',
+'blk=chakma' => '#/149',
+'blk=cham' => '#/116',
+'blk=cherokee' => '#/219',
+'blk=cherokeesup' => '#/291',
+'blk=cherokeesupplement' => '#/291',
+'blk=chesssymbols' => '#/316',
+'blk=cjk' => '#/107',
+'blk=cjkcompat' => '#/246',
+'blk=cjkcompatforms' => '#/343',
+'blk=cjkcompatibility' => '#/246',
+'blk=cjkcompatibilityforms' => '#/343',
+'blk=cjkcompatibilityideographs' => '#/387',
+'blk=cjkcompatibilityideographssupplement' => '#/398',
+'blk=cjkcompatideographs' => '#/387',
+'blk=cjkcompatideographssup' => '#/398',
+'blk=cjkexta' => '#/175',
+'blk=cjkextb' => '#/176',
+'blk=cjkextc' => '#/177',
+'blk=cjkextd' => '#/178',
+'blk=cjkexte' => '#/179',
+'blk=cjkextf' => '#/180',
+'blk=cjkradicalssup' => '#/344',
+'blk=cjkradicalssupplement' => '#/344',
+'blk=cjkstrokes' => '#/272',
+'blk=cjksymbols' => '#/273',
+'blk=cjksymbolsandpunctuation' => '#/273',
+'blk=cjkunifiedideographs' => '#/107',
+'blk=cjkunifiedideographsextensiona' => '#/175',
+'blk=cjkunifiedideographsextensionb' => '#/176',
+'blk=cjkunifiedideographsextensionc' => '#/177',
+'blk=cjkunifiedideographsextensiond' => '#/178',
+'blk=cjkunifiedideographsextensione' => '#/179',
+'blk=cjkunifiedideographsextensionf' => '#/180',
+'blk=combiningdiacriticalmarks' => '#/320',
+'blk=combiningdiacriticalmarksextended' => '#/353',
+'blk=combiningdiacriticalmarksforsymbols' => '#/399',
+'blk=combiningdiacriticalmarkssupplement' => '#/354',
+'blk=combininghalfmarks' => '#/249',
+'blk=combiningmarksforsymbols' => '#/399',
+'blk=commonindicnumberforms' => '#/369',
+'blk=compatjamo' => '#/274',
+'blk=controlpictures' => '#/351',
+'blk=coptic' => '#/150',
+'blk=copticepactnumbers' => '#/381',
+'blk=countingrod' => '#/292',
+'blk=countingrodnumerals' => '#/292',
+'blk=cuneiform' => '#/247',
+'blk=cuneiformnumbers' => '#/364',
+'blk=cuneiformnumbersandpunctuation' => '#/364',
+'blk=currencysymbols' => '#/352',
+'blk=cypriotsyllabary' => '#/365',
+'blk=cyrillic' => '#/220',
+'blk=cyrillicexta' => '#/317',
+'blk=cyrillicextb' => '#/318',
+'blk=cyrillicextc' => '#/319',
+'blk=cyrillicextendeda' => '#/317',
+'blk=cyrillicextendedb' => '#/318',
+'blk=cyrillicextendedc' => '#/319',
+'blk=cyrillicsup' => '#/293',
+'blk=cyrillicsupplement' => '#/293',
+'blk=cyrillicsupplementary' => '#/293',
+'blk=deseret' => '#/181',
+'blk=devanagari' => '#/275',
+'blk=devanagariext' => '#/334',
+'blk=devanagariextended' => '#/334',
+'blk=diacriticals' => '#/320',
+'blk=diacriticalsext' => '#/353',
+'blk=diacriticalsforsymbols' => '#/399',
+'blk=diacriticalssup' => '#/354',
+'blk=dingbats' => '#/221',
+'blk=dogra' => '#/131',
+'blk=domino' => '#/151',
+'blk=dominotiles' => '#/151',
+'blk=duployan' => '#/222',
+'blk=earlydynasticcuneiform' => '#/400',
+'blk=egyptianhieroglyphformatcontrols' => '#/405',
+'blk=egyptianhieroglyphs' => '#/388',
+'blk=elbasan' => '#/182',
+'blk=elymaic' => '#/183',
+'blk=emoticons' => '#/248',
+'blk=enclosedalphanum' => '#/366',
+'blk=enclosedalphanumerics' => '#/366',
+'blk=enclosedalphanumericsupplement' => '#/389',
+'blk=enclosedalphanumsup' => '#/389',
+'blk=enclosedcjk' => '#/294',
+'blk=enclosedcjklettersandmonths' => '#/294',
+'blk=enclosedideographicsup' => '#/401',
+'blk=enclosedideographicsupplement' => '#/401',
+'blk=ethiopic' => '#/223',
+'blk=ethiopicext' => '#/295',
+'blk=ethiopicexta' => '#/321',
+'blk=ethiopicextended' => '#/295',
+'blk=ethiopicextendeda' => '#/321',
+'blk=ethiopicsup' => '#/296',
+'blk=ethiopicsupplement' => '#/296',
+'blk=generalpunctuation' => '#/309',
+'blk=geometricshapes' => '#/355',
+'blk=geometricshapesext' => '#/382',
+'blk=geometricshapesextended' => '#/382',
+'blk=georgian' => '#/224',
+'blk=georgianext' => '#/297',
+'blk=georgianextended' => '#/297',
+'blk=georgiansup' => '#/298',
+'blk=georgiansupplement' => '#/298',
+'blk=glagolitic' => '#/276',
+'blk=glagoliticsup' => '#/335',
+'blk=glagoliticsupplement' => '#/335',
+'blk=gothic' => '#/152',
+'blk=grantha' => '#/184',
+'blk=greek' => '#/132',
+'blk=greekandcoptic' => '#/132',
+'blk=greekext' => '#/225',
+'blk=greekextended' => '#/225',
+'blk=gujarati' => '#/226',
+'blk=gunjalagondi' => '#/322',
+'blk=gurmukhi' => '#/227',
+'blk=halfandfullforms' => '#/367',
+'blk=halfmarks' => '#/249',
+'blk=halfwidthandfullwidthforms' => '#/367',
+'blk=hangul' => '#/153',
+'blk=hangulcompatibilityjamo' => '#/274',
+'blk=hanguljamo' => '#/117',
+'blk=hanguljamoextendeda' => '#/229',
+'blk=hanguljamoextendedb' => '#/230',
+'blk=hangulsyllables' => '#/153',
+'blk=hanifirohingya' => '#/345',
+'blk=hanunoo' => '#/185',
+'blk=hatran' => '#/154',
+'blk=hebrew' => '#/155',
+'blk=highprivateusesurrogates' => '#/368',
+'blk=highpusurrogates' => '#/368',
+'blk=highsurrogates' => '#/346',
+'blk=hiragana' => '#/228',
+'blk=idc' => '#/108',
+'blk=ideographicdescriptioncharacters' => '#/108',
+'blk=ideographicsymbols' => '#/383',
+'blk=ideographicsymbolsandpunctuation' => '#/383',
+'blk=imperialaramaic' => '#/356',
+'blk=indicnumberforms' => '#/369',
+'blk=indicsiyaqnumbers' => '#/378',
+'blk=inscriptionalpahlavi' => '#/394',
+'blk=inscriptionalparthian' => '#/396',
+'blk=ipaext' => '#/156',
+'blk=ipaextensions' => '#/156',
+'blk=jamo' => '#/117',
+'blk=jamoexta' => '#/229',
+'blk=jamoextb' => '#/230',
+'blk=javanese' => '#/231',
+'blk=kaithi' => '#/157',
+'blk=kanaexta' => '#/232',
+'blk=kanaextendeda' => '#/232',
+'blk=kanasup' => '#/186',
+'blk=kanasupplement' => '#/186',
+'blk=kanbun' => '#/158',
+'blk=kangxi' => '#/159',
+'blk=kangxiradicals' => '#/159',
+'blk=kannada' => '#/187',
+'blk=katakana' => '#/233',
+'blk=katakanaext' => '#/299',
+'blk=katakanaphoneticextensions' => '#/299',
+'blk=kayahli' => '#/188',
+'blk=kharoshthi' => '#/277',
+'blk=khmer' => '#/133',
+'blk=khmersymbols' => '#/323',
+'blk=khojki' => '#/160',
+'blk=khudawadi' => '#/250',
+'blk=lao' => '#/109',
+'blk=latin1' => '#/161',
+'blk=latin1sup' => '#/161',
+'blk=latin1supplement' => '#/161',
+'blk=latinexta' => '#/251',
+'blk=latinextadditional' => '#/384',
+'blk=latinextb' => '#/252',
+'blk=latinextc' => '#/253',
+'blk=latinextd' => '#/254',
+'blk=latinexte' => '#/255',
+'blk=latinextendeda' => '#/251',
+'blk=latinextendedadditional' => '#/384',
+'blk=latinextendedb' => '#/252',
+'blk=latinextendedc' => '#/253',
+'blk=latinextendedd' => '#/254',
+'blk=latinextendede' => '#/255',
+'blk=lepcha' => '#/162',
+'blk=letterlikesymbols' => '#/379',
+'blk=limbu' => '#/134',
+'blk=lineara' => '#/189',
+'blk=linearbideograms' => '#/370',
+'blk=linearbsyllabary' => '#/371',
+'blk=lisu' => '#/118',
+'blk=lowsurrogates' => '#/336',
+'blk=lycian' => '#/163',
+'blk=lydian' => '#/164',
+'blk=mahajani' => '#/234',
+'blk=mahjong' => '#/190',
+'blk=mahjongtiles' => '#/190',
+'blk=makasar' => '#/191',
+'blk=malayalam' => '#/256',
+'blk=mandaic' => '#/192',
+'blk=manichaean' => '#/278',
+'blk=marchen' => '#/193',
+'blk=masaramgondi' => '#/324',
+'blk=mathalphanum' => '#/325',
+'blk=mathematicalalphanumericsymbols' => '#/325',
+'blk=mathematicaloperators' => '#/337',
+'blk=mathoperators' => '#/337',
+'blk=mayannumerals' => '#/338',
+'blk=medefaidrin' => '#/300',
+'blk=meeteimayek' => '#/301',
+'blk=meeteimayekext' => '#/347',
+'blk=meeteimayekextensions' => '#/347',
+'blk=mendekikakui' => '#/326',
+'blk=meroiticcursive' => '#/357',
+'blk=meroitichieroglyphs' => '#/390',
+'blk=miao' => '#/119',
+'blk=miscarrows' => '#/279',
+'blk=miscellaneousmathematicalsymbolsa' => '#/372',
+'blk=miscellaneousmathematicalsymbolsb' => '#/373',
+'blk=miscellaneoussymbols' => '#/302',
+'blk=miscellaneoussymbolsandarrows' => '#/279',
+'blk=miscellaneoussymbolsandpictographs' => '#/358',
+'blk=miscellaneoustechnical' => '#/339',
+'blk=miscmathsymbolsa' => '#/372',
+'blk=miscmathsymbolsb' => '#/373',
+'blk=miscpictographs' => '#/358',
+'blk=miscsymbols' => '#/302',
+'blk=misctechnical' => '#/339',
+'blk=modi' => '#/120',
+'blk=modifierletters' => '#/359',
+'blk=modifiertoneletters' => '#/391',
+'blk=mongolian' => '#/257',
+'blk=mongoliansup' => '#/327',
+'blk=mongoliansupplement' => '#/327',
+'blk=mro' => '#/110',
+'blk=multani' => '#/194',
+'blk=music' => '#/135',
+'blk=musicalsymbols' => '#/135',
+'blk=myanmar' => '#/195',
+'blk=myanmarexta' => '#/303',
+'blk=myanmarextb' => '#/304',
+'blk=myanmarextendeda' => '#/303',
+'blk=myanmarextendedb' => '#/304',
+'blk=nabataean' => '#/258',
+'blk=nandinagari' => '#/305',
+'blk=nb' => 'Blk/NB',
+'blk=newa' => '#/121',
+'blk=newtailue' => '#/259',
+'blk=nko' => '#/111',
+'blk=noblock' => 'Blk/NB',
+'blk=numberforms' => '#/306',
+'blk=nushu' => '#/136',
+'blk=nyiakengpuachuehmong' => '#/395',
+'blk=ocr' => '#/112',
+'blk=ogham' => '#/137',
+'blk=olchiki' => '#/196',
+'blk=oldhungarian' => '#/328',
+'blk=olditalic' => '#/260',
+'blk=oldnortharabian' => '#/360',
+'blk=oldpermic' => '#/261',
+'blk=oldpersian' => '#/280',
+'blk=oldsogdian' => '#/281',
+'blk=oldsoutharabian' => '#/361',
+'blk=oldturkic' => '#/262',
+'blk=opticalcharacterrecognition' => '#/112',
+'blk=oriya' => '#/138',
+'blk=ornamentaldingbats' => '#/385',
+'blk=osage' => '#/139',
+'blk=osmanya' => '#/197',
+'blk=ottomansiyaqnumbers' => '#/392',
+'blk=pahawhhmong' => '#/307',
+'blk=palmyrene' => '#/263',
+'blk=paucinhau' => '#/264',
+'blk=phagspa' => '#/198',
+'blk=phaistos' => '#/235',
+'blk=phaistosdisc' => '#/235',
+'blk=phoenician' => '#/282',
+'blk=phoneticext' => '#/308',
+'blk=phoneticextensions' => '#/308',
+'blk=phoneticextensionssupplement' => '#/348',
+'blk=phoneticextsup' => '#/348',
+'blk=playingcards' => '#/329',
+'blk=privateuse' => '#/113',
+'blk=privateusearea' => '#/113',
+'blk=psalterpahlavi' => '#/349',
+'blk=pua' => '#/113',
+'blk=punctuation' => '#/309',
+'blk=rejang' => '#/165',
+'blk=rumi' => '#/122',
+'blk=ruminumeralsymbols' => '#/122',
+'blk=runic' => '#/140',
+'blk=samaritan' => '#/265',
+'blk=saurashtra' => '#/283',
+'blk=sharada' => '#/199',
+'blk=shavian' => '#/200',
+'blk=shorthandformatcontrols' => '#/402',
+'blk=siddham' => '#/201',
+'blk=sinhala' => '#/202',
+'blk=sinhalaarchaicnumbers' => '#/397',
+'blk=smallforms' => '#/284',
+'blk=smallformvariants' => '#/284',
+'blk=smallkanaext' => '#/330',
+'blk=smallkanaextension' => '#/330',
+'blk=sogdian' => '#/203',
+'blk=sorasompeng' => '#/310',
+'blk=soyombo' => '#/204',
+'blk=spacingmodifierletters' => '#/359',
+'blk=specials' => '#/236',
+'blk=sundanese' => '#/266',
+'blk=sundanesesup' => '#/331',
+'blk=sundanesesupplement' => '#/331',
+'blk=suparrowsa' => '#/285',
+'blk=suparrowsb' => '#/286',
+'blk=suparrowsc' => '#/287',
+'blk=superandsub' => '#/311',
+'blk=superscriptsandsubscripts' => '#/311',
+'blk=supmathoperators' => '#/374',
+'blk=supplementalarrowsa' => '#/285',
+'blk=supplementalarrowsb' => '#/286',
+'blk=supplementalarrowsc' => '#/287',
+'blk=supplementalmathematicaloperators' => '#/374',
+'blk=supplementalpunctuation' => '#/350',
+'blk=supplementalsymbolsandpictographs' => '#/403',
+'blk=supplementaryprivateuseareaa' => '#/205',
+'blk=supplementaryprivateuseareab' => '#/206',
+'blk=suppuaa' => '#/205',
+'blk=suppuab' => '#/206',
+'blk=suppunctuation' => '#/350',
+'blk=supsymbolsandpictographs' => '#/403',
+'blk=suttonsignwriting' => '#/380',
+'blk=sylotinagri' => '#/312',
+'blk=symbolsandpictographsexta' => '#/404',
+'blk=symbolsandpictographsextendeda' => '#/404',
+'blk=syriac' => '#/166',
+'blk=syriacsup' => '#/267',
+'blk=syriacsupplement' => '#/267',
+'blk=tagalog' => '#/207',
+'blk=tagbanwa' => '#/237',
+'blk=tags' => '#/123',
+'blk=taile' => '#/141',
+'blk=taitham' => '#/208',
+'blk=taiviet' => '#/209',
+'blk=taixuanjing' => '#/313',
+'blk=taixuanjingsymbols' => '#/313',
+'blk=takri' => '#/142',
+'blk=tamil' => '#/143',
+'blk=tamilsup' => '#/238',
+'blk=tamilsupplement' => '#/238',
+'blk=tangut' => '#/167',
+'blk=tangutcomponents' => '#/375',
+'blk=telugu' => '#/168',
+'blk=thaana' => '#/169',
+'blk=thai' => '#/124',
+'blk=tibetan' => '#/210',
+'blk=tifinagh' => '#/239',
+'blk=tirhuta' => '#/211',
+'blk=transportandmap' => '#/362',
+'blk=transportandmapsymbols' => '#/362',
+'blk=ucas' => '#/125',
+'blk=ucasext' => '#/212',
+'blk=ugaritic' => '#/240',
+'blk=unifiedcanadianaboriginalsyllabics' => '#/125',
+'blk=unifiedcanadianaboriginalsyllabicsextended' => '#/212',
+'blk=vai' => '#/114',
+'blk=variationselectors' => '#/106',
+'blk=variationselectorssupplement' => '#/144',
+'blk=vedicext' => '#/241',
+'blk=vedicextensions' => '#/241',
+'blk=verticalforms' => '#/340',
+'blk=vs' => '#/106',
+'blk=vssup' => '#/144',
+'blk=wancho' => '#/170',
+'blk=warangciti' => '#/288',
+'blk=yijing' => '#/171',
+'blk=yijinghexagramsymbols' => '#/171',
+'blk=yiradicals' => '#/289',
+'blk=yisyllables' => '#/314',
+'blk=zanabazarsquare' => '#/363',
+'blockelements' => '#/333',
+'bopo' => 'Scx/Bopo',
+'bopomofo' => 'Scx/Bopo',
+'bopomofoext' => '#/290',
+'bopomofoextended' => '#/290',
+'boxdrawing' => '#/271',
+'bpt=c' => 'Bpt/C',
+'bpt=close' => 'Bpt/C',
+'bpt=n' => 'Bpt/N',
+'bpt=none' => 'Bpt/N',
+'bpt=o' => 'Bpt/O',
+'bpt=open' => 'Bpt/O',
+'brah' => '#/631',
+'brahmi' => '#/631',
+'brai' => '#/174',
+'braille' => '#/174',
+'braillepatterns' => '#/174',
+'bugi' => '#/632',
+'buginese' => '#/632',
+'buhd' => '#/633',
+'buhid' => '#/633',
+'byzantinemusic' => '#/342',
+'byzantinemusicalsymbols' => '#/342',
+'c' => 'Gc/C',
+'cakm' => 'Scx/Cakm',
+'canadianaboriginal' => '#/634',
+'canadiansyllabics' => '#/125',
+'cans' => '#/634',
+'cari' => '#/635',
+'carian' => '#/635',
+'cased' => 'Cased/Y',
+'cased=f' => '!Cased/Y',
+'cased=false' => '!Cased/Y',
+'cased=n' => '!Cased/Y',
+'cased=no' => '!Cased/Y',
+'cased=t' => 'Cased/Y',
+'cased=true' => 'Cased/Y',
+'cased=y' => 'Cased/Y',
+'cased=yes' => 'Cased/Y',
+'casedletter' => 'Gc/LC',
+'caseignorable' => 'CI/Y',
+'caucasianalbanian' => '#/623',
+'cc' => '#/409',
+'ccc=a' => 'Ccc/A',
+'ccc=above' => 'Ccc/A',
+'ccc=aboveleft' => 'Ccc/AL',
+'ccc=aboveright' => 'Ccc/AR',
+'ccc=al' => 'Ccc/AL',
+'ccc=ar' => 'Ccc/AR',
+'ccc=ata' => '#/21',
+'ccc=atar' => 'Ccc/ATAR',
+'ccc=atb' => '#/22',
+'ccc=atbl' => '#/0',
+'ccc=attachedabove' => '#/21',
+'ccc=attachedaboveright' => 'Ccc/ATAR',
+'ccc=attachedbelow' => '#/22',
+'ccc=attachedbelowleft' => '#/0',
+'ccc=b' => 'Ccc/B',
+'ccc=below' => 'Ccc/B',
+'ccc=belowleft' => '#/17',
+'ccc=belowright' => 'Ccc/BR',
+'ccc=bl' => '#/17',
+'ccc=br' => 'Ccc/BR',
+'ccc=ccc10' => '#/23',
+'ccc=ccc103' => '#/52',
+'ccc=ccc107' => '#/53',
+'ccc=ccc11' => '#/24',
+'ccc=ccc118' => '#/54',
+'ccc=ccc12' => '#/25',
+'ccc=ccc122' => '#/55',
+'ccc=ccc129' => '#/56',
+'ccc=ccc13' => '#/26',
+'ccc=ccc130' => '#/57',
+'ccc=ccc132' => '#/58',
+'ccc=ccc133' => '#/0',
+'ccc=ccc14' => '#/27',
+'ccc=ccc15' => '#/28',
+'ccc=ccc16' => '#/29',
+'ccc=ccc17' => '#/30',
+'ccc=ccc18' => '#/31',
+'ccc=ccc19' => '#/32',
+'ccc=ccc20' => '#/33',
+'ccc=ccc21' => '#/34',
+'ccc=ccc22' => '#/35',
+'ccc=ccc23' => '#/36',
+'ccc=ccc24' => '#/37',
+'ccc=ccc25' => '#/38',
+'ccc=ccc26' => '#/39',
+'ccc=ccc27' => '#/40',
+'ccc=ccc28' => '#/41',
+'ccc=ccc29' => '#/42',
+'ccc=ccc30' => '#/43',
+'ccc=ccc31' => '#/44',
+'ccc=ccc32' => '#/45',
+'ccc=ccc33' => '#/46',
+'ccc=ccc34' => '#/47',
+'ccc=ccc35' => '#/48',
+'ccc=ccc36' => '#/49',
+'ccc=ccc84' => '#/50',
+'ccc=ccc91' => '#/51',
+'ccc=da' => '#/18',
+'ccc=db' => 'Ccc/DB',
+'ccc=doubleabove' => '#/18',
+'ccc=doublebelow' => 'Ccc/DB',
+'ccc=iotasubscript' => '#/19',
+'ccc=is' => '#/19',
+'ccc=kanavoicing' => '#/20',
+'ccc=kv' => '#/20',
+'ccc=l' => '#/15',
+'ccc=left' => '#/15',
+'ccc=nk' => 'Ccc/NK',
+'ccc=notreordered' => 'Ccc/NR',
+'ccc=nr' => 'Ccc/NR',
+'ccc=nukta' => 'Ccc/NK',
+'ccc=ov' => 'Ccc/OV',
+'ccc=overlay' => 'Ccc/OV',
+'ccc=r' => '#/16',
+'ccc=right' => '#/16',
+'ccc=virama' => 'Ccc/VR',
+'ccc=vr' => 'Ccc/VR',
+'ce' => 'CE/Y',
+'ce=f' => '!CE/Y',
+'ce=false' => '!CE/Y',
+'ce=n' => '!CE/Y',
+'ce=no' => '!CE/Y',
+'ce=t' => 'CE/Y',
+'ce=true' => 'CE/Y',
+'ce=y' => 'CE/Y',
+'ce=yes' => 'CE/Y',
+'cf' => 'Gc/Cf',
+'chakma' => 'Scx/Cakm',
+'cham' => 'Scx/Cham',
+'changeswhencasefolded' => 'CWCF/Y',
+'changeswhencasemapped' => 'CWCM/Y',
+'changeswhenlowercased' => 'CWL/Y',
+'changeswhennfkccasefolded' => 'CWKCF/Y',
+'changeswhentitlecased' => 'CWT/Y',
+'changeswhenuppercased' => 'CWU/Y',
+'cher' => '#/636',
+'cherokee' => '#/636',
+'cherokeesup' => '#/291',
+'cherokeesupplement' => '#/291',
+'chesssymbols' => '#/316',
+'ci' => 'CI/Y',
+'ci=f' => '!CI/Y',
+'ci=false' => '!CI/Y',
+'ci=n' => '!CI/Y',
+'ci=no' => '!CI/Y',
+'ci=t' => 'CI/Y',
+'ci=true' => 'CI/Y',
+'ci=y' => 'CI/Y',
+'ci=yes' => 'CI/Y',
+'cjk' => '#/107',
+'cjkcompat' => '#/246',
+'cjkcompatforms' => '#/343',
+'cjkcompatibility' => '#/246',
+'cjkcompatibilityforms' => '#/343',
+'cjkcompatibilityideographs' => '#/387',
+'cjkcompatibilityideographssupplement' => '#/398',
+'cjkcompatideographs' => '#/387',
+'cjkcompatideographssup' => '#/398',
+'cjkexta' => '#/175',
+'cjkextb' => '#/176',
+'cjkextc' => '#/177',
+'cjkextd' => '#/178',
+'cjkexte' => '#/179',
+'cjkextf' => '#/180',
+'cjkradicalssup' => '#/344',
+'cjkradicalssupplement' => '#/344',
+'cjkstrokes' => '#/272',
+'cjksymbols' => '#/273',
+'cjksymbolsandpunctuation' => '#/273',
+'cjkunifiedideographs' => '#/107',
+'cjkunifiedideographsextensiona' => '#/175',
+'cjkunifiedideographsextensionb' => '#/176',
+'cjkunifiedideographsextensionc' => '#/177',
+'cjkunifiedideographsextensiond' => '#/178',
+'cjkunifiedideographsextensione' => '#/179',
+'cjkunifiedideographsextensionf' => '#/180',
+'closepunctuation' => 'Gc/Pe',
+'cn' => 'Gc/Cn',
+'cntrl' => '#/409',
+'co' => '#/410',
+'combiningdiacriticalmarks' => '#/320',
+'combiningdiacriticalmarksextended' => '#/353',
+'combiningdiacriticalmarksforsymbols' => '#/399',
+'combiningdiacriticalmarkssupplement' => '#/354',
+'combininghalfmarks' => '#/249',
+'combiningmark' => 'Gc/M',
+'combiningmarksforsymbols' => '#/399',
+'common' => 'Scx/Zyyy',
+'commonindicnumberforms' => '#/369',
+'compatjamo' => '#/274',
+'compex' => 'CompEx/Y',
+'compex=f' => '!CompEx/Y',
+'compex=false' => '!CompEx/Y',
+'compex=n' => '!CompEx/Y',
+'compex=no' => '!CompEx/Y',
+'compex=t' => 'CompEx/Y',
+'compex=true' => 'CompEx/Y',
+'compex=y' => 'CompEx/Y',
+'compex=yes' => 'CompEx/Y',
+'compositionexclusion' => 'CE/Y',
+'connectorpunctuation' => 'Gc/Pc',
+'control' => '#/409',
+'controlpictures' => '#/351',
+'copt' => 'Scx/Copt',
+'coptic' => 'Scx/Copt',
+'copticepactnumbers' => '#/381',
+'countingrod' => '#/292',
+'countingrodnumerals' => '#/292',
+'cprt' => 'Scx/Cprt',
+'cs' => '#/14',
+'cuneiform' => 'Scx/Xsux',
+'cuneiformnumbers' => '#/364',
+'cuneiformnumbersandpunctuation' => '#/364',
+'currencysymbol' => 'Gc/Sc',
+'currencysymbols' => '#/352',
+'cwcf' => 'CWCF/Y',
+'cwcf=f' => '!CWCF/Y',
+'cwcf=false' => '!CWCF/Y',
+'cwcf=n' => '!CWCF/Y',
+'cwcf=no' => '!CWCF/Y',
+'cwcf=t' => 'CWCF/Y',
+'cwcf=true' => 'CWCF/Y',
+'cwcf=y' => 'CWCF/Y',
+'cwcf=yes' => 'CWCF/Y',
+'cwcm' => 'CWCM/Y',
+'cwcm=f' => '!CWCM/Y',
+'cwcm=false' => '!CWCM/Y',
+'cwcm=n' => '!CWCM/Y',
+'cwcm=no' => '!CWCM/Y',
+'cwcm=t' => 'CWCM/Y',
+'cwcm=true' => 'CWCM/Y',
+'cwcm=y' => 'CWCM/Y',
+'cwcm=yes' => 'CWCM/Y',
+'cwkcf' => 'CWKCF/Y',
+'cwkcf=f' => '!CWKCF/Y',
+'cwkcf=false' => '!CWKCF/Y',
+'cwkcf=n' => '!CWKCF/Y',
+'cwkcf=no' => '!CWKCF/Y',
+'cwkcf=t' => 'CWKCF/Y',
+'cwkcf=true' => 'CWKCF/Y',
+'cwkcf=y' => 'CWKCF/Y',
+'cwkcf=yes' => 'CWKCF/Y',
+'cwl' => 'CWL/Y',
+'cwl=f' => '!CWL/Y',
+'cwl=false' => '!CWL/Y',
+'cwl=n' => '!CWL/Y',
+'cwl=no' => '!CWL/Y',
+'cwl=t' => 'CWL/Y',
+'cwl=true' => 'CWL/Y',
+'cwl=y' => 'CWL/Y',
+'cwl=yes' => 'CWL/Y',
+'cwt' => 'CWT/Y',
+'cwt=f' => '!CWT/Y',
+'cwt=false' => '!CWT/Y',
+'cwt=n' => '!CWT/Y',
+'cwt=no' => '!CWT/Y',
+'cwt=t' => 'CWT/Y',
+'cwt=true' => 'CWT/Y',
+'cwt=y' => 'CWT/Y',
+'cwt=yes' => 'CWT/Y',
+'cwu' => 'CWU/Y',
+'cwu=f' => '!CWU/Y',
+'cwu=false' => '!CWU/Y',
+'cwu=n' => '!CWU/Y',
+'cwu=no' => '!CWU/Y',
+'cwu=t' => 'CWU/Y',
+'cwu=true' => 'CWU/Y',
+'cwu=y' => 'CWU/Y',
+'cwu=yes' => 'CWU/Y',
+'cypriot' => 'Scx/Cprt',
+'cypriotsyllabary' => '#/365',
+'cyrillic' => 'Scx/Cyrl',
+'cyrillicexta' => '#/317',
+'cyrillicextb' => '#/318',
+'cyrillicextc' => '#/319',
+'cyrillicextendeda' => '#/317',
+'cyrillicextendedb' => '#/318',
+'cyrillicextendedc' => '#/319',
+'cyrillicsup' => '#/293',
+'cyrillicsupplement' => '#/293',
+'cyrillicsupplementary' => '#/293',
+'cyrl' => 'Scx/Cyrl',
+'dash' => 'Dash/Y',
+'dash=f' => '!Dash/Y',
+'dash=false' => '!Dash/Y',
+'dash=n' => '!Dash/Y',
+'dash=no' => '!Dash/Y',
+'dash=t' => 'Dash/Y',
+'dash=true' => 'Dash/Y',
+'dash=y' => 'Dash/Y',
+'dash=yes' => 'Dash/Y',
+'dashpunctuation' => 'Gc/Pd',
+'decimalnumber' => 'Gc/Nd',
+'defaultignorablecodepoint' => 'DI/Y',
+'dep' => 'Dep/Y',
+'dep=f' => '!Dep/Y',
+'dep=false' => '!Dep/Y',
+'dep=n' => '!Dep/Y',
+'dep=no' => '!Dep/Y',
+'dep=t' => 'Dep/Y',
+'dep=true' => 'Dep/Y',
+'dep=y' => 'Dep/Y',
+'dep=yes' => 'Dep/Y',
+'deprecated' => 'Dep/Y',
+'deseret' => '#/181',
+'deva' => 'Scx/Deva',
+'devanagari' => 'Scx/Deva',
+'devanagariext' => '#/334',
+'devanagariextended' => '#/334',
+'di' => 'DI/Y',
+'di=f' => '!DI/Y',
+'di=false' => '!DI/Y',
+'di=n' => '!DI/Y',
+'di=no' => '!DI/Y',
+'di=t' => 'DI/Y',
+'di=true' => 'DI/Y',
+'di=y' => 'DI/Y',
+'di=yes' => 'DI/Y',
+'dia' => 'Dia/Y',
+'dia=f' => '!Dia/Y',
+'dia=false' => '!Dia/Y',
+'dia=n' => '!Dia/Y',
+'dia=no' => '!Dia/Y',
+'dia=t' => 'Dia/Y',
+'dia=true' => 'Dia/Y',
+'dia=y' => 'Dia/Y',
+'dia=yes' => 'Dia/Y',
+'diacritic' => 'Dia/Y',
+'diacriticals' => '#/320',
+'diacriticalsext' => '#/353',
+'diacriticalsforsymbols' => '#/399',
+'diacriticalssup' => '#/354',
+'digit' => 'Gc/Nd',
+'dingbats' => '#/221',
+'dogr' => '#/637',
+'dogra' => '#/637',
+'domino' => '#/151',
+'dominotiles' => '#/151',
+'dsrt' => '#/181',
+'dt=can' => 'NFDQC/N',
+'dt=canonical' => 'NFDQC/N',
+'dt=circle' => 'Dt/Enc',
+'dt=com' => 'Dt/Com',
+'dt=compat' => 'Dt/Com',
+'dt=enc' => 'Dt/Enc',
+'dt=fin' => 'Dt/Fin',
+'dt=final' => 'Dt/Fin',
+'dt=font' => 'Dt/Font',
+'dt=fra' => '#/406',
+'dt=fraction' => '#/406',
+'dt=init' => 'Dt/Init',
+'dt=initial' => 'Dt/Init',
+'dt=iso' => 'Dt/Iso',
+'dt=isolated' => 'Dt/Iso',
+'dt=med' => 'Dt/Med',
+'dt=medial' => 'Dt/Med',
+'dt=nar' => 'Dt/Nar',
+'dt=narrow' => 'Dt/Nar',
+'dt=nb' => 'Dt/Nb',
+'dt=nobreak' => 'Dt/Nb',
+'dt=noncanon' => 'Dt/NonCanon',
+'dt=noncanonical' => 'Dt/NonCanon',
+'dt=none' => 'NFKDQC/Y',
+'dt=small' => '#/407',
+'dt=sml' => '#/407',
+'dt=sqr' => 'Dt/Sqr',
+'dt=square' => 'Dt/Sqr',
+'dt=sub' => 'Dt/Sub',
+'dt=sup' => 'Dt/Sup',
+'dt=super' => 'Dt/Sup',
+'dt=vert' => 'Dt/Vert',
+'dt=vertical' => 'Dt/Vert',
+'dt=wide' => '#/408',
+'dupl' => 'Scx/Dupl',
+'duployan' => 'Scx/Dupl',
+'ea=a' => 'Ea/A',
+'ea=ambiguous' => 'Ea/A',
+'ea=f' => '#/408',
+'ea=fullwidth' => '#/408',
+'ea=h' => 'Ea/H',
+'ea=halfwidth' => 'Ea/H',
+'ea=n' => 'Ea/N',
+'ea=na' => 'Ea/Na',
+'ea=narrow' => 'Ea/Na',
+'ea=neutral' => 'Ea/N',
+'ea=w' => 'Ea/W',
+'ea=wide' => 'Ea/W',
+'earlydynasticcuneiform' => '#/400',
+'egyp' => '#/638',
+'egyptianhieroglyphformatcontrols' => '#/405',
+'egyptianhieroglyphs' => '#/638',
+'elba' => '#/639',
+'elbasan' => '#/639',
+'elym' => '#/640',
+'elymaic' => '#/640',
+'emoticons' => '#/248',
+'enclosedalphanum' => '#/366',
+'enclosedalphanumerics' => '#/366',
+'enclosedalphanumericsupplement' => '#/389',
+'enclosedalphanumsup' => '#/389',
+'enclosedcjk' => '#/294',
+'enclosedcjklettersandmonths' => '#/294',
+'enclosedideographicsup' => '#/401',
+'enclosedideographicsupplement' => '#/401',
+'enclosingmark' => 'Gc/Me',
+'ethi' => 'Scx/Ethi',
+'ethiopic' => 'Scx/Ethi',
+'ethiopicext' => '#/295',
+'ethiopicexta' => '#/321',
+'ethiopicextended' => '#/295',
+'ethiopicextendeda' => '#/321',
+'ethiopicsup' => '#/296',
+'ethiopicsupplement' => '#/296',
+'ext' => 'Ext/Y',
+'ext=f' => '!Ext/Y',
+'ext=false' => '!Ext/Y',
+'ext=n' => '!Ext/Y',
+'ext=no' => '!Ext/Y',
+'ext=t' => 'Ext/Y',
+'ext=true' => 'Ext/Y',
+'ext=y' => 'Ext/Y',
+'ext=yes' => 'Ext/Y',
+'extender' => 'Ext/Y',
+'finalpunctuation' => 'Gc/Pf',
+'format' => 'Gc/Cf',
+'fullcompositionexclusion' => 'CompEx/Y',
+'gc=c' => 'Gc/C',
+'gc=casedletter' => 'Gc/LC',
+'gc=cc' => '#/409',
+'gc=cf' => 'Gc/Cf',
+'gc=closepunctuation' => 'Gc/Pe',
+'gc=cn' => 'Gc/Cn',
+'gc=cntrl' => '#/409',
+'gc=co' => '#/410',
+'gc=combiningmark' => 'Gc/M',
+'gc=connectorpunctuation' => 'Gc/Pc',
+'gc=control' => '#/409',
+'gc=cs' => '#/14',
+'gc=currencysymbol' => 'Gc/Sc',
+'gc=dashpunctuation' => 'Gc/Pd',
+'gc=decimalnumber' => 'Gc/Nd',
+'gc=digit' => 'Gc/Nd',
+'gc=enclosingmark' => 'Gc/Me',
+'gc=finalpunctuation' => 'Gc/Pf',
+'gc=format' => 'Gc/Cf',
+'gc=initialpunctuation' => 'Gc/Pi',
+'gc=l' => 'Gc/L',
+'gc=l&' => 'Gc/LC',
+'gc=l_' => 'Gc/LC',
+'gc=lc' => 'Gc/LC',
+'gc=letter' => 'Gc/L',
+'gc=letternumber' => 'Gc/Nl',
+'gc=lineseparator' => '#/411',
+'gc=ll' => 'Gc/Ll',
+'gc=lm' => 'Gc/Lm',
+'gc=lo' => 'Gc/Lo',
+'gc=lowercaseletter' => 'Gc/Ll',
+'gc=lt' => 'Perl/Title',
+'gc=lu' => 'Gc/Lu',
+'gc=m' => 'Gc/M',
+'gc=mark' => 'Gc/M',
+'gc=mathsymbol' => 'Gc/Sm',
+'gc=mc' => 'Gc/Mc',
+'gc=me' => 'Gc/Me',
+'gc=mn' => 'Gc/Mn',
+'gc=modifierletter' => 'Gc/Lm',
+'gc=modifiersymbol' => 'Gc/Sk',
+'gc=n' => 'Gc/N',
+'gc=nd' => 'Gc/Nd',
+'gc=nl' => 'Gc/Nl',
+'gc=no' => 'Gc/No',
+'gc=nonspacingmark' => 'Gc/Mn',
+'gc=number' => 'Gc/N',
+'gc=openpunctuation' => 'Gc/Ps',
+'gc=other' => 'Gc/C',
+'gc=otherletter' => 'Gc/Lo',
+'gc=othernumber' => 'Gc/No',
+'gc=otherpunctuation' => 'Gc/Po',
+'gc=othersymbol' => 'Gc/So',
+'gc=p' => 'Gc/P',
+'gc=paragraphseparator' => '#/412',
+'gc=pc' => 'Gc/Pc',
+'gc=pd' => 'Gc/Pd',
+'gc=pe' => 'Gc/Pe',
+'gc=pf' => 'Gc/Pf',
+'gc=pi' => 'Gc/Pi',
+'gc=po' => 'Gc/Po',
+'gc=privateuse' => '#/410',
+'gc=ps' => 'Gc/Ps',
+'gc=punct' => 'Gc/P',
+'gc=punctuation' => 'Gc/P',
+'gc=s' => 'Gc/S',
+'gc=sc' => 'Gc/Sc',
+'gc=separator' => 'Gc/Z',
+'gc=sk' => 'Gc/Sk',
+'gc=sm' => 'Gc/Sm',
+'gc=so' => 'Gc/So',
+'gc=spaceseparator' => 'Gc/Zs',
+'gc=spacingmark' => 'Gc/Mc',
+'gc=surrogate' => '#/14',
+'gc=symbol' => 'Gc/S',
+'gc=titlecaseletter' => 'Perl/Title',
+'gc=unassigned' => 'Gc/Cn',
+'gc=uppercaseletter' => 'Gc/Lu',
+'gc=z' => 'Gc/Z',
+'gc=zl' => '#/411',
+'gc=zp' => '#/412',
+'gc=zs' => 'Gc/Zs',
+'gcb=cn' => 'GCB/CN',
+'gcb=control' => 'GCB/CN',
+'gcb=cr' => '#/63',
+'gcb=eb' => '#/0',
+'gcb=ebase' => '#/0',
+'gcb=ebasegaz' => '#/0',
+'gcb=ebg' => '#/0',
+'gcb=em' => '#/0',
+'gcb=emodifier' => '#/0',
+'gcb=ex' => 'GCB/EX',
+'gcb=extend' => 'GCB/EX',
+'gcb=gaz' => '#/0',
+'gcb=glueafterzwj' => '#/0',
+'gcb=l' => '#/60',
+'gcb=lf' => '#/64',
+'gcb=lv' => 'GCB/LV',
+'gcb=lvt' => 'GCB/LVT',
+'gcb=other' => 'GCB/XX',
+'gcb=pp' => 'GCB/PP',
+'gcb=prepend' => 'GCB/PP',
+'gcb=regionalindicator' => '#/65',
+'gcb=ri' => '#/65',
+'gcb=sm' => 'GCB/SM',
+'gcb=spacingmark' => 'GCB/SM',
+'gcb=t' => '#/61',
+'gcb=v' => '#/62',
+'gcb=xx' => 'GCB/XX',
+'gcb=zwj' => '#/66',
+'generalpunctuation' => '#/309',
+'geometricshapes' => '#/355',
+'geometricshapesext' => '#/382',
+'geometricshapesextended' => '#/382',
+'geor' => 'Scx/Geor',
+'georgian' => 'Scx/Geor',
+'georgianext' => '#/297',
+'georgianextended' => '#/297',
+'georgiansup' => '#/298',
+'georgiansupplement' => '#/298',
+'glag' => 'Scx/Glag',
+'glagolitic' => 'Scx/Glag',
+'glagoliticsup' => '#/335',
+'glagoliticsupplement' => '#/335',
+'gong' => 'Scx/Gong',
+'gonm' => 'Scx/Gonm',
+'goth' => '#/641',
+'gothic' => '#/641',
+'gran' => 'Scx/Gran',
+'grantha' => 'Scx/Gran',
+'graph' => 'Perl/Graph',
+'graphemebase' => 'GrBase/Y',
+'graphemeextend' => 'GrExt/Y',
+'grbase' => 'GrBase/Y',
+'grbase=f' => '!GrBase/Y',
+'grbase=false' => '!GrBase/Y',
+'grbase=n' => '!GrBase/Y',
+'grbase=no' => '!GrBase/Y',
+'grbase=t' => 'GrBase/Y',
+'grbase=true' => 'GrBase/Y',
+'grbase=y' => 'GrBase/Y',
+'grbase=yes' => 'GrBase/Y',
+'greek' => 'Scx/Grek',
+'greekandcoptic' => '#/132',
+'greekext' => '#/225',
+'greekextended' => '#/225',
+'grek' => 'Scx/Grek',
+'grext' => 'GrExt/Y',
+'grext=f' => '!GrExt/Y',
+'grext=false' => '!GrExt/Y',
+'grext=n' => '!GrExt/Y',
+'grext=no' => '!GrExt/Y',
+'grext=t' => 'GrExt/Y',
+'grext=true' => 'GrExt/Y',
+'grext=y' => 'GrExt/Y',
+'grext=yes' => 'GrExt/Y',
+'gujarati' => 'Scx/Gujr',
+'gujr' => 'Scx/Gujr',
+'gunjalagondi' => 'Scx/Gong',
+'gurmukhi' => 'Scx/Guru',
+'guru' => 'Scx/Guru',
+'halfandfullforms' => '#/367',
+'halfmarks' => '#/249',
+'halfwidthandfullwidthforms' => '#/367',
+'han' => 'Scx/Han',
+'hang' => 'Scx/Hang',
+'hangul' => 'Scx/Hang',
+'hangulcompatibilityjamo' => '#/274',
+'hanguljamo' => '#/117',
+'hanguljamoextendeda' => '#/229',
+'hanguljamoextendedb' => '#/230',
+'hangulsyllables' => '#/153',
+'hani' => 'Scx/Han',
+'hanifirohingya' => 'Scx/Rohg',
+'hano' => '#/642',
+'hanunoo' => '#/642',
+'hatr' => '#/643',
+'hatran' => '#/643',
+'hebr' => 'Scx/Hebr',
+'hebrew' => 'Scx/Hebr',
+'hex' => 'Hex/Y',
+'hex=f' => '!Hex/Y',
+'hex=false' => '!Hex/Y',
+'hex=n' => '!Hex/Y',
+'hex=no' => '!Hex/Y',
+'hex=t' => 'Hex/Y',
+'hex=true' => 'Hex/Y',
+'hex=y' => 'Hex/Y',
+'hex=yes' => 'Hex/Y',
+'hexdigit' => 'Hex/Y',
+'highprivateusesurrogates' => '#/368',
+'highpusurrogates' => '#/368',
+'highsurrogates' => '#/346',
+'hira' => 'Scx/Hira',
+'hiragana' => 'Scx/Hira',
+'hluw' => '#/644',
+'hmng' => 'Scx/Hmng',
+'hmnp' => 'Scx/Hmnp',
+'horizspace' => 'Perl/Blank',
+'hst=l' => '#/60',
+'hst=leadingjamo' => '#/60',
+'hst=lv' => 'GCB/LV',
+'hst=lvsyllable' => 'GCB/LV',
+'hst=lvt' => 'GCB/LVT',
+'hst=lvtsyllable' => 'GCB/LVT',
+'hst=na' => 'Hst/NA',
+'hst=notapplicable' => 'Hst/NA',
+'hst=t' => '#/61',
+'hst=trailingjamo' => '#/61',
+'hst=v' => '#/62',
+'hst=voweljamo' => '#/62',
+'hung' => '#/645',
+'hyphen' => 'Hyphen/T',
+'hyphen=f' => '!Hyphen/T',
+'hyphen=false' => '!Hyphen/T',
+'hyphen=n' => '!Hyphen/T',
+'hyphen=no' => '!Hyphen/T',
+'hyphen=t' => 'Hyphen/T',
+'hyphen=true' => 'Hyphen/T',
+'hyphen=y' => 'Hyphen/T',
+'hyphen=yes' => 'Hyphen/T',
+'idc' => 'IDC/Y',
+'idc=f' => '!IDC/Y',
+'idc=false' => '!IDC/Y',
+'idc=n' => '!IDC/Y',
+'idc=no' => '!IDC/Y',
+'idc=t' => 'IDC/Y',
+'idc=true' => 'IDC/Y',
+'idc=y' => 'IDC/Y',
+'idc=yes' => 'IDC/Y',
+'idcontinue' => 'IDC/Y',
+'ideo' => 'Ideo/Y',
+'ideo=f' => '!Ideo/Y',
+'ideo=false' => '!Ideo/Y',
+'ideo=n' => '!Ideo/Y',
+'ideo=no' => '!Ideo/Y',
+'ideo=t' => 'Ideo/Y',
+'ideo=true' => 'Ideo/Y',
+'ideo=y' => 'Ideo/Y',
+'ideo=yes' => 'Ideo/Y',
+'ideographic' => 'Ideo/Y',
+'ideographicdescriptioncharacters' => '#/108',
+'ideographicsymbols' => '#/383',
+'ideographicsymbolsandpunctuation' => '#/383',
+'ids' => 'IDS/Y',
+'ids=f' => '!IDS/Y',
+'ids=false' => '!IDS/Y',
+'ids=n' => '!IDS/Y',
+'ids=no' => '!IDS/Y',
+'ids=t' => 'IDS/Y',
+'ids=true' => 'IDS/Y',
+'ids=y' => 'IDS/Y',
+'ids=yes' => 'IDS/Y',
+'idsb' => '#/67',
+'idsb=f' => '#/!67',
+'idsb=false' => '#/!67',
+'idsb=n' => '#/!67',
+'idsb=no' => '#/!67',
+'idsb=t' => '#/67',
+'idsb=true' => '#/67',
+'idsb=y' => '#/67',
+'idsb=yes' => '#/67',
+'idsbinaryoperator' => '#/67',
+'idst' => '#/68',
+'idst=f' => '#/!68',
+'idst=false' => '#/!68',
+'idst=n' => '#/!68',
+'idst=no' => '#/!68',
+'idst=t' => '#/68',
+'idst=true' => '#/68',
+'idst=y' => '#/68',
+'idst=yes' => '#/68',
+'idstart' => 'IDS/Y',
+'idstrinaryoperator' => '#/68',
+'imperialaramaic' => '#/625',
+'in=unassigned' => 'Age/NA',
+'in=v100' => 'In/10_0',
+'in=v110' => 'In/11_0',
+'in=v120' => 'In/12_0',
+'in=v121' => 'In/12_1',
+'in=v20' => 'In/2_0',
+'in=v21' => 'In/2_1',
+'in=v30' => 'In/3_0',
+'in=v31' => 'In/3_1',
+'in=v32' => 'In/3_2',
+'in=v40' => 'In/4_0',
+'in=v41' => 'In/4_1',
+'in=v50' => 'In/5_0',
+'in=v51' => 'In/5_1',
+'in=v52' => 'In/5_2',
+'in=v60' => 'In/6_0',
+'in=v61' => 'In/6_1',
+'in=v62' => 'In/6_2',
+'in=v63' => 'In/6_3',
+'in=v70' => 'In/7_0',
+'in=v80' => 'In/8_0',
+'in=v90' => 'In/9_0',
+'inadlam' => '#/127',
+'inaegeannumbers' => '#/332',
+'inahom' => '#/115',
+'inalchemical' => '#/268',
+'inalchemicalsymbols' => '#/268',
+'inalphabeticpf' => '#/315',
+'inalphabeticpresentationforms' => '#/315',
+'inanatolianhieroglyphs' => '#/393',
+'inancientgreekmusic' => '#/376',
+'inancientgreekmusicalnotation' => '#/376',
+'inancientgreeknumbers' => '#/386',
+'inancientsymbols' => '#/341',
+'inarabic' => '#/145',
+'inarabicexta' => '#/269',
+'inarabicextendeda' => '#/269',
+'inarabicmath' => '#/270',
+'inarabicmathematicalalphabeticsymbols' => '#/270',
+'inarabicpfa' => '#/242',
+'inarabicpfb' => '#/243',
+'inarabicpresentationformsa' => '#/242',
+'inarabicpresentationformsb' => '#/243',
+'inarabicsup' => '#/244',
+'inarabicsupplement' => '#/244',
+'inarmenian' => '#/213',
+'inarrows' => '#/146',
+'inascii' => '#/126',
+'inavestan' => '#/172',
+'inbalinese' => '#/214',
+'inbamum' => '#/128',
+'inbamumsup' => '#/215',
+'inbamumsupplement' => '#/215',
+'inbasiclatin' => '#/126',
+'inbassavah' => '#/216',
+'inbatak' => '#/129',
+'inbengali' => '#/173',
+'inbhaiksuki' => '#/245',
+'inblockelements' => '#/333',
+'inbopomofo' => '#/217',
+'inbopomofoext' => '#/290',
+'inbopomofoextended' => '#/290',
+'inboxdrawing' => '#/271',
+'inbrahmi' => '#/147',
+'inbraille' => '#/174',
+'inbraillepatterns' => '#/174',
+'inbuginese' => '#/218',
+'inbuhid' => '#/130',
+'inbyzantinemusic' => '#/342',
+'inbyzantinemusicalsymbols' => '#/342',
+'incanadiansyllabics' => '#/125',
+'incarian' => '#/148',
+'incaucasianalbanian' => '#/377',
+'inchakma' => '#/149',
+'incham' => '#/116',
+'incherokee' => '#/219',
+'incherokeesup' => '#/291',
+'incherokeesupplement' => '#/291',
+'inchesssymbols' => '#/316',
+'incjk' => '#/107',
+'incjkcompat' => '#/246',
+'incjkcompatforms' => '#/343',
+'incjkcompatibility' => '#/246',
+'incjkcompatibilityforms' => '#/343',
+'incjkcompatibilityideographs' => '#/387',
+'incjkcompatibilityideographssupplement' => '#/398',
+'incjkcompatideographs' => '#/387',
+'incjkcompatideographssup' => '#/398',
+'incjkexta' => '#/175',
+'incjkextb' => '#/176',
+'incjkextc' => '#/177',
+'incjkextd' => '#/178',
+'incjkexte' => '#/179',
+'incjkextf' => '#/180',
+'incjkradicalssup' => '#/344',
+'incjkradicalssupplement' => '#/344',
+'incjkstrokes' => '#/272',
+'incjksymbols' => '#/273',
+'incjksymbolsandpunctuation' => '#/273',
+'incjkunifiedideographs' => '#/107',
+'incjkunifiedideographsextensiona' => '#/175',
+'incjkunifiedideographsextensionb' => '#/176',
+'incjkunifiedideographsextensionc' => '#/177',
+'incjkunifiedideographsextensiond' => '#/178',
+'incjkunifiedideographsextensione' => '#/179',
+'incjkunifiedideographsextensionf' => '#/180',
+'incombiningdiacriticalmarks' => '#/320',
+'incombiningdiacriticalmarksextended' => '#/353',
+'incombiningdiacriticalmarksforsymbols' => '#/399',
+'incombiningdiacriticalmarkssupplement' => '#/354',
+'incombininghalfmarks' => '#/249',
+'incombiningmarksforsymbols' => '#/399',
+'incommonindicnumberforms' => '#/369',
+'incompatjamo' => '#/274',
+'incontrolpictures' => '#/351',
+'incoptic' => '#/150',
+'incopticepactnumbers' => '#/381',
+'incountingrod' => '#/292',
+'incountingrodnumerals' => '#/292',
+'incuneiform' => '#/247',
+'incuneiformnumbers' => '#/364',
+'incuneiformnumbersandpunctuation' => '#/364',
+'incurrencysymbols' => '#/352',
+'incypriotsyllabary' => '#/365',
+'incyrillic' => '#/220',
+'incyrillicexta' => '#/317',
+'incyrillicextb' => '#/318',
+'incyrillicextc' => '#/319',
+'incyrillicextendeda' => '#/317',
+'incyrillicextendedb' => '#/318',
+'incyrillicextendedc' => '#/319',
+'incyrillicsup' => '#/293',
+'incyrillicsupplement' => '#/293',
+'incyrillicsupplementary' => '#/293',
+'indeseret' => '#/181',
+'indevanagari' => '#/275',
+'indevanagariext' => '#/334',
+'indevanagariextended' => '#/334',
+'indiacriticals' => '#/320',
+'indiacriticalsext' => '#/353',
+'indiacriticalsforsymbols' => '#/399',
+'indiacriticalssup' => '#/354',
+'indicnumberforms' => '#/369',
+'indicsiyaqnumbers' => '#/378',
+'indingbats' => '#/221',
+'indogra' => '#/131',
+'indomino' => '#/151',
+'indominotiles' => '#/151',
+'induployan' => '#/222',
+'inearlydynasticcuneiform' => '#/400',
+'inegyptianhieroglyphformatcontrols' => '#/405',
+'inegyptianhieroglyphs' => '#/388',
+'inelbasan' => '#/182',
+'inelymaic' => '#/183',
+'inemoticons' => '#/248',
+'inenclosedalphanum' => '#/366',
+'inenclosedalphanumerics' => '#/366',
+'inenclosedalphanumericsupplement' => '#/389',
+'inenclosedalphanumsup' => '#/389',
+'inenclosedcjk' => '#/294',
+'inenclosedcjklettersandmonths' => '#/294',
+'inenclosedideographicsup' => '#/401',
+'inenclosedideographicsupplement' => '#/401',
+'inethiopic' => '#/223',
+'inethiopicext' => '#/295',
+'inethiopicexta' => '#/321',
+'inethiopicextended' => '#/295',
+'inethiopicextendeda' => '#/321',
+'inethiopicsup' => '#/296',
+'inethiopicsupplement' => '#/296',
+'ingeneralpunctuation' => '#/309',
+'ingeometricshapes' => '#/355',
+'ingeometricshapesext' => '#/382',
+'ingeometricshapesextended' => '#/382',
+'ingeorgian' => '#/224',
+'ingeorgianext' => '#/297',
+'ingeorgianextended' => '#/297',
+'ingeorgiansup' => '#/298',
+'ingeorgiansupplement' => '#/298',
+'inglagolitic' => '#/276',
+'inglagoliticsup' => '#/335',
+'inglagoliticsupplement' => '#/335',
+'ingothic' => '#/152',
+'ingrantha' => '#/184',
+'ingreek' => '#/132',
+'ingreekandcoptic' => '#/132',
+'ingreekext' => '#/225',
+'ingreekextended' => '#/225',
+'ingujarati' => '#/226',
+'ingunjalagondi' => '#/322',
+'ingurmukhi' => '#/227',
+'inhalfandfullforms' => '#/367',
+'inhalfmarks' => '#/249',
+'inhalfwidthandfullwidthforms' => '#/367',
+'inhangul' => '#/153',
+'inhangulcompatibilityjamo' => '#/274',
+'inhanguljamo' => '#/117',
+'inhanguljamoextendeda' => '#/229',
+'inhanguljamoextendedb' => '#/230',
+'inhangulsyllables' => '#/153',
+'inhanifirohingya' => '#/345',
+'inhanunoo' => '#/185',
+'inhatran' => '#/154',
+'inhebrew' => '#/155',
+'inherited' => 'Scx/Zinh',
+'inhighprivateusesurrogates' => '#/368',
+'inhighpusurrogates' => '#/368',
+'inhighsurrogates' => '#/346',
+'inhiragana' => '#/228',
+'inidc' => '#/108',
+'inideographicdescriptioncharacters' => '#/108',
+'inideographicsymbols' => '#/383',
+'inideographicsymbolsandpunctuation' => '#/383',
+'inimperialaramaic' => '#/356',
+'inindicnumberforms' => '#/369',
+'inindicsiyaqnumbers' => '#/378',
+'ininscriptionalpahlavi' => '#/394',
+'ininscriptionalparthian' => '#/396',
+'inipaext' => '#/156',
+'inipaextensions' => '#/156',
+'initialpunctuation' => 'Gc/Pi',
+'injamo' => '#/117',
+'injamoexta' => '#/229',
+'injamoextb' => '#/230',
+'injavanese' => '#/231',
+'inkaithi' => '#/157',
+'inkanaexta' => '#/232',
+'inkanaextendeda' => '#/232',
+'inkanasup' => '#/186',
+'inkanasupplement' => '#/186',
+'inkanbun' => '#/158',
+'inkangxi' => '#/159',
+'inkangxiradicals' => '#/159',
+'inkannada' => '#/187',
+'inkatakana' => '#/233',
+'inkatakanaext' => '#/299',
+'inkatakanaphoneticextensions' => '#/299',
+'inkayahli' => '#/188',
+'inkharoshthi' => '#/277',
+'inkhmer' => '#/133',
+'inkhmersymbols' => '#/323',
+'inkhojki' => '#/160',
+'inkhudawadi' => '#/250',
+'inlao' => '#/109',
+'inlatin1' => '#/161',
+'inlatin1sup' => '#/161',
+'inlatin1supplement' => '#/161',
+'inlatinexta' => '#/251',
+'inlatinextadditional' => '#/384',
+'inlatinextb' => '#/252',
+'inlatinextc' => '#/253',
+'inlatinextd' => '#/254',
+'inlatinexte' => '#/255',
+'inlatinextendeda' => '#/251',
+'inlatinextendedadditional' => '#/384',
+'inlatinextendedb' => '#/252',
+'inlatinextendedc' => '#/253',
+'inlatinextendedd' => '#/254',
+'inlatinextendede' => '#/255',
+'inlepcha' => '#/162',
+'inletterlikesymbols' => '#/379',
+'inlimbu' => '#/134',
+'inlineara' => '#/189',
+'inlinearbideograms' => '#/370',
+'inlinearbsyllabary' => '#/371',
+'inlisu' => '#/118',
+'inlowsurrogates' => '#/336',
+'inlycian' => '#/163',
+'inlydian' => '#/164',
+'inmahajani' => '#/234',
+'inmahjong' => '#/190',
+'inmahjongtiles' => '#/190',
+'inmakasar' => '#/191',
+'inmalayalam' => '#/256',
+'inmandaic' => '#/192',
+'inmanichaean' => '#/278',
+'inmarchen' => '#/193',
+'inmasaramgondi' => '#/324',
+'inmathalphanum' => '#/325',
+'inmathematicalalphanumericsymbols' => '#/325',
+'inmathematicaloperators' => '#/337',
+'inmathoperators' => '#/337',
+'inmayannumerals' => '#/338',
+'inmedefaidrin' => '#/300',
+'inmeeteimayek' => '#/301',
+'inmeeteimayekext' => '#/347',
+'inmeeteimayekextensions' => '#/347',
+'inmendekikakui' => '#/326',
+'inmeroiticcursive' => '#/357',
+'inmeroitichieroglyphs' => '#/390',
+'inmiao' => '#/119',
+'inmiscarrows' => '#/279',
+'inmiscellaneousmathematicalsymbolsa' => '#/372',
+'inmiscellaneousmathematicalsymbolsb' => '#/373',
+'inmiscellaneoussymbols' => '#/302',
+'inmiscellaneoussymbolsandarrows' => '#/279',
+'inmiscellaneoussymbolsandpictographs' => '#/358',
+'inmiscellaneoustechnical' => '#/339',
+'inmiscmathsymbolsa' => '#/372',
+'inmiscmathsymbolsb' => '#/373',
+'inmiscpictographs' => '#/358',
+'inmiscsymbols' => '#/302',
+'inmisctechnical' => '#/339',
+'inmodi' => '#/120',
+'inmodifierletters' => '#/359',
+'inmodifiertoneletters' => '#/391',
+'inmongolian' => '#/257',
+'inmongoliansup' => '#/327',
+'inmongoliansupplement' => '#/327',
+'inmro' => '#/110',
+'inmultani' => '#/194',
+'inmusic' => '#/135',
+'inmusicalsymbols' => '#/135',
+'inmyanmar' => '#/195',
+'inmyanmarexta' => '#/303',
+'inmyanmarextb' => '#/304',
+'inmyanmarextendeda' => '#/303',
+'inmyanmarextendedb' => '#/304',
+'innabataean' => '#/258',
+'innandinagari' => '#/305',
+'innb' => 'Blk/NB',
+'innewa' => '#/121',
+'innewtailue' => '#/259',
+'innko' => '#/111',
+'innoblock' => 'Blk/NB',
+'innumberforms' => '#/306',
+'innushu' => '#/136',
+'innyiakengpuachuehmong' => '#/395',
+'inocr' => '#/112',
+'inogham' => '#/137',
+'inolchiki' => '#/196',
+'inoldhungarian' => '#/328',
+'inolditalic' => '#/260',
+'inoldnortharabian' => '#/360',
+'inoldpermic' => '#/261',
+'inoldpersian' => '#/280',
+'inoldsogdian' => '#/281',
+'inoldsoutharabian' => '#/361',
+'inoldturkic' => '#/262',
+'inopticalcharacterrecognition' => '#/112',
+'inoriya' => '#/138',
+'inornamentaldingbats' => '#/385',
+'inosage' => '#/139',
+'inosmanya' => '#/197',
+'inottomansiyaqnumbers' => '#/392',
+'inpahawhhmong' => '#/307',
+'inpalmyrene' => '#/263',
+'inpaucinhau' => '#/264',
+'inpc=bottom' => 'InPC/Bottom',
+'inpc=bottomandleft' => '#/69',
+'inpc=bottomandright' => '#/70',
+'inpc=left' => 'InPC/Left',
+'inpc=leftandright' => 'InPC/LeftAndR',
+'inpc=na' => 'InPC/NA',
+'inpc=overstruck' => 'InPC/Overstru',
+'inpc=right' => 'InPC/Right',
+'inpc=top' => 'InPC/Top',
+'inpc=topandbottom' => 'InPC/TopAndBo',
+'inpc=topandbottomandright' => '#/71',
+'inpc=topandleft' => 'InPC/TopAndLe',
+'inpc=topandleftandright' => 'InPC/TopAndL2',
+'inpc=topandright' => 'InPC/TopAndRi',
+'inpc=visualorderleft' => 'InPC/VisualOr',
+'inphagspa' => '#/198',
+'inphaistos' => '#/235',
+'inphaistosdisc' => '#/235',
+'inphoenician' => '#/282',
+'inphoneticext' => '#/308',
+'inphoneticextensions' => '#/308',
+'inphoneticextensionssupplement' => '#/348',
+'inphoneticextsup' => '#/348',
+'inplayingcards' => '#/329',
+'inprivateuse' => '#/113',
+'inprivateusearea' => '#/113',
+'inpsalterpahlavi' => '#/349',
+'inpua' => '#/113',
+'inpunctuation' => '#/309',
+'inrejang' => '#/165',
+'inrumi' => '#/122',
+'inruminumeralsymbols' => '#/122',
+'inrunic' => '#/140',
+'insamaritan' => '#/265',
+'insaurashtra' => '#/283',
+'insc=avagraha' => 'InSC/Avagraha',
+'insc=bindu' => 'InSC/Bindu',
+'insc=brahmijoiningnumber' => '#/80',
+'insc=cantillationmark' => 'InSC/Cantilla',
+'insc=consonant' => 'InSC/Consonan',
+'insc=consonantdead' => 'InSC/Consona2',
+'insc=consonantfinal' => 'InSC/Consona3',
+'insc=consonantheadletter' => '#/81',
+'insc=consonantinitialpostfixed' => '#/84',
+'insc=consonantkiller' => '#/76',
+'insc=consonantmedial' => 'InSC/Consona4',
+'insc=consonantplaceholder' => 'InSC/Consona6',
+'insc=consonantprecedingrepha' => '#/83',
+'insc=consonantprefixed' => '#/79',
+'insc=consonantsubjoined' => 'InSC/Consona5',
+'insc=consonantsucceedingrepha' => 'InSC/Consona7',
+'insc=consonantwithstacker' => '#/82',
+'insc=geminationmark' => '#/75',
+'insc=invisiblestacker' => 'InSC/Invisibl',
+'insc=joiner' => '#/66',
+'insc=modifyingletter' => '#/77',
+'insc=nonjoiner' => '#/72',
+'insc=nukta' => 'InSC/Nukta',
+'insc=number' => 'InSC/Number',
+'insc=numberjoiner' => '#/74',
+'insc=other' => 'InSC/Other',
+'insc=purekiller' => 'InSC/PureKill',
+'insc=registershifter' => '#/78',
+'insc=syllablemodifier' => 'InSC/Syllable',
+'insc=toneletter' => '#/73',
+'insc=tonemark' => 'InSC/ToneMark',
+'insc=virama' => 'InSC/Virama',
+'insc=visarga' => 'InSC/Visarga',
+'insc=vowel' => 'InSC/Vowel',
+'insc=voweldependent' => 'InSC/VowelDep',
+'insc=vowelindependent' => 'InSC/VowelInd',
+'inscriptionalpahlavi' => '#/672',
+'inscriptionalparthian' => '#/674',
+'insharada' => '#/199',
+'inshavian' => '#/200',
+'inshorthandformatcontrols' => '#/402',
+'insiddham' => '#/201',
+'insinhala' => '#/202',
+'insinhalaarchaicnumbers' => '#/397',
+'insmallforms' => '#/284',
+'insmallformvariants' => '#/284',
+'insmallkanaext' => '#/330',
+'insmallkanaextension' => '#/330',
+'insogdian' => '#/203',
+'insorasompeng' => '#/310',
+'insoyombo' => '#/204',
+'inspacingmodifierletters' => '#/359',
+'inspecials' => '#/236',
+'insundanese' => '#/266',
+'insundanesesup' => '#/331',
+'insundanesesupplement' => '#/331',
+'insuparrowsa' => '#/285',
+'insuparrowsb' => '#/286',
+'insuparrowsc' => '#/287',
+'insuperandsub' => '#/311',
+'insuperscriptsandsubscripts' => '#/311',
+'insupmathoperators' => '#/374',
+'insupplementalarrowsa' => '#/285',
+'insupplementalarrowsb' => '#/286',
+'insupplementalarrowsc' => '#/287',
+'insupplementalmathematicaloperators' => '#/374',
+'insupplementalpunctuation' => '#/350',
+'insupplementalsymbolsandpictographs' => '#/403',
+'insupplementaryprivateuseareaa' => '#/205',
+'insupplementaryprivateuseareab' => '#/206',
+'insuppuaa' => '#/205',
+'insuppuab' => '#/206',
+'insuppunctuation' => '#/350',
+'insupsymbolsandpictographs' => '#/403',
+'insuttonsignwriting' => '#/380',
+'insylotinagri' => '#/312',
+'insymbolsandpictographsexta' => '#/404',
+'insymbolsandpictographsextendeda' => '#/404',
+'insyriac' => '#/166',
+'insyriacsup' => '#/267',
+'insyriacsupplement' => '#/267',
+'intagalog' => '#/207',
+'intagbanwa' => '#/237',
+'intags' => '#/123',
+'intaile' => '#/141',
+'intaitham' => '#/208',
+'intaiviet' => '#/209',
+'intaixuanjing' => '#/313',
+'intaixuanjingsymbols' => '#/313',
+'intakri' => '#/142',
+'intamil' => '#/143',
+'intamilsup' => '#/238',
+'intamilsupplement' => '#/238',
+'intangut' => '#/167',
+'intangutcomponents' => '#/375',
+'intelugu' => '#/168',
+'inthaana' => '#/169',
+'inthai' => '#/124',
+'intibetan' => '#/210',
+'intifinagh' => '#/239',
+'intirhuta' => '#/211',
+'intransportandmap' => '#/362',
+'intransportandmapsymbols' => '#/362',
+'inucas' => '#/125',
+'inucasext' => '#/212',
+'inugaritic' => '#/240',
+'inunifiedcanadianaboriginalsyllabics' => '#/125',
+'inunifiedcanadianaboriginalsyllabicsextended' => '#/212',
+'invai' => '#/114',
+'invariationselectors' => '#/106',
+'invariationselectorssupplement' => '#/144',
+'invedicext' => '#/241',
+'invedicextensions' => '#/241',
+'inverticalforms' => '#/340',
+'invs' => '#/106',
+'invssup' => '#/144',
+'inwancho' => '#/170',
+'inwarangciti' => '#/288',
+'inyijing' => '#/171',
+'inyijinghexagramsymbols' => '#/171',
+'inyiradicals' => '#/289',
+'inyisyllables' => '#/314',
+'inzanabazarsquare' => '#/363',
+'ipaext' => '#/156',
+'ipaextensions' => '#/156',
+'isadlam' => 'Scx/Adlm',
+'isadlm' => 'Scx/Adlm',
+'isaegeannumbers' => '#/332',
+'isaghb' => '#/623',
+'isahex' => '#/59',
+'isahom' => '#/624',
+'isalchemical' => '#/268',
+'isalchemicalsymbols' => '#/268',
+'isall' => '#/1',
+'isalnum' => 'Perl/Alnum',
+'isalpha' => 'Alpha/Y',
+'isalphabetic' => 'Alpha/Y',
+'isalphabeticpf' => '#/315',
+'isalphabeticpresentationforms' => '#/315',
+'isanatolianhieroglyphs' => '#/644',
+'isancientgreekmusic' => '#/376',
+'isancientgreekmusicalnotation' => '#/376',
+'isancientgreeknumbers' => '#/386',
+'isancientsymbols' => '#/341',
+'isany' => '#/2',
+'isarab' => 'Scx/Arab',
+'isarabic' => 'Scx/Arab',
+'isarabicexta' => '#/269',
+'isarabicextendeda' => '#/269',
+'isarabicmath' => '#/270',
+'isarabicmathematicalalphabeticsymbols' => '#/270',
+'isarabicpfa' => '#/242',
+'isarabicpfb' => '#/243',
+'isarabicpresentationformsa' => '#/242',
+'isarabicpresentationformsb' => '#/243',
+'isarabicsup' => '#/244',
+'isarabicsupplement' => '#/244',
+'isarmenian' => 'Scx/Armn',
+'isarmi' => '#/625',
+'isarmn' => 'Scx/Armn',
+'isarrows' => '#/146',
+'isascii' => '#/126',
+'isasciihexdigit' => '#/59',
+'isassigned' => 'Perl/Assigned',
+'isavestan' => '#/626',
+'isavst' => '#/626',
+'isbali' => '#/627',
+'isbalinese' => '#/627',
+'isbamu' => '#/628',
+'isbamum' => '#/628',
+'isbamumsup' => '#/215',
+'isbamumsupplement' => '#/215',
+'isbasiclatin' => '#/126',
+'isbass' => '#/629',
+'isbassavah' => '#/629',
+'isbatak' => '#/630',
+'isbatk' => '#/630',
+'isbeng' => 'Scx/Beng',
+'isbengali' => 'Scx/Beng',
+'isbhaiksuki' => 'Scx/Bhks',
+'isbhks' => 'Scx/Bhks',
+'isbidic' => 'BidiC/Y',
+'isbidicontrol' => 'BidiC/Y',
+'isbidim' => 'BidiM/Y',
+'isbidimirrored' => 'BidiM/Y',
+'isblank' => 'Perl/Blank',
+'isblockelements' => '#/333',
+'isbopo' => 'Scx/Bopo',
+'isbopomofo' => 'Scx/Bopo',
+'isbopomofoext' => '#/290',
+'isbopomofoextended' => '#/290',
+'isboxdrawing' => '#/271',
+'isbrah' => '#/631',
+'isbrahmi' => '#/631',
+'isbrai' => '#/174',
+'isbraille' => '#/174',
+'isbraillepatterns' => '#/174',
+'isbugi' => '#/632',
+'isbuginese' => '#/632',
+'isbuhd' => '#/633',
+'isbuhid' => '#/633',
+'isbyzantinemusic' => '#/342',
+'isbyzantinemusicalsymbols' => '#/342',
+'isc' => 'Gc/C',
+'iscakm' => 'Scx/Cakm',
+'iscanadianaboriginal' => '#/634',
+'iscanadiansyllabics' => '#/125',
+'iscans' => '#/634',
+'iscari' => '#/635',
+'iscarian' => '#/635',
+'iscased' => 'Cased/Y',
+'iscasedletter' => 'Gc/LC',
+'iscaseignorable' => 'CI/Y',
+'iscaucasianalbanian' => '#/623',
+'iscc' => '#/409',
+'isce' => 'CE/Y',
+'iscf' => 'Gc/Cf',
+'ischakma' => 'Scx/Cakm',
+'ischam' => 'Scx/Cham',
+'ischangeswhencasefolded' => 'CWCF/Y',
+'ischangeswhencasemapped' => 'CWCM/Y',
+'ischangeswhenlowercased' => 'CWL/Y',
+'ischangeswhennfkccasefolded' => 'CWKCF/Y',
+'ischangeswhentitlecased' => 'CWT/Y',
+'ischangeswhenuppercased' => 'CWU/Y',
+'ischer' => '#/636',
+'ischerokee' => '#/636',
+'ischerokeesup' => '#/291',
+'ischerokeesupplement' => '#/291',
+'ischesssymbols' => '#/316',
+'isci' => 'CI/Y',
+'iscjk' => '#/107',
+'iscjkcompat' => '#/246',
+'iscjkcompatforms' => '#/343',
+'iscjkcompatibility' => '#/246',
+'iscjkcompatibilityforms' => '#/343',
+'iscjkcompatibilityideographs' => '#/387',
+'iscjkcompatibilityideographssupplement' => '#/398',
+'iscjkcompatideographs' => '#/387',
+'iscjkcompatideographssup' => '#/398',
+'iscjkexta' => '#/175',
+'iscjkextb' => '#/176',
+'iscjkextc' => '#/177',
+'iscjkextd' => '#/178',
+'iscjkexte' => '#/179',
+'iscjkextf' => '#/180',
+'iscjkradicalssup' => '#/344',
+'iscjkradicalssupplement' => '#/344',
+'iscjkstrokes' => '#/272',
+'iscjksymbols' => '#/273',
+'iscjksymbolsandpunctuation' => '#/273',
+'iscjkunifiedideographs' => '#/107',
+'iscjkunifiedideographsextensiona' => '#/175',
+'iscjkunifiedideographsextensionb' => '#/176',
+'iscjkunifiedideographsextensionc' => '#/177',
+'iscjkunifiedideographsextensiond' => '#/178',
+'iscjkunifiedideographsextensione' => '#/179',
+'iscjkunifiedideographsextensionf' => '#/180',
+'isclosepunctuation' => 'Gc/Pe',
+'iscn' => 'Gc/Cn',
+'iscntrl' => '#/409',
+'isco' => '#/410',
+'iscombiningdiacriticalmarks' => '#/320',
+'iscombiningdiacriticalmarksextended' => '#/353',
+'iscombiningdiacriticalmarksforsymbols' => '#/399',
+'iscombiningdiacriticalmarkssupplement' => '#/354',
+'iscombininghalfmarks' => '#/249',
+'iscombiningmark' => 'Gc/M',
+'iscombiningmarksforsymbols' => '#/399',
+'iscommon' => 'Scx/Zyyy',
+'iscommonindicnumberforms' => '#/369',
+'iscompatjamo' => '#/274',
+'iscompex' => 'CompEx/Y',
+'iscompositionexclusion' => 'CE/Y',
+'isconnectorpunctuation' => 'Gc/Pc',
+'iscontrol' => '#/409',
+'iscontrolpictures' => '#/351',
+'iscopt' => 'Scx/Copt',
+'iscoptic' => 'Scx/Copt',
+'iscopticepactnumbers' => '#/381',
+'iscountingrod' => '#/292',
+'iscountingrodnumerals' => '#/292',
+'iscprt' => 'Scx/Cprt',
+'iscs' => '#/14',
+'iscuneiform' => 'Scx/Xsux',
+'iscuneiformnumbers' => '#/364',
+'iscuneiformnumbersandpunctuation' => '#/364',
+'iscurrencysymbol' => 'Gc/Sc',
+'iscurrencysymbols' => '#/352',
+'iscwcf' => 'CWCF/Y',
+'iscwcm' => 'CWCM/Y',
+'iscwkcf' => 'CWKCF/Y',
+'iscwl' => 'CWL/Y',
+'iscwt' => 'CWT/Y',
+'iscwu' => 'CWU/Y',
+'iscypriot' => 'Scx/Cprt',
+'iscypriotsyllabary' => '#/365',
+'iscyrillic' => 'Scx/Cyrl',
+'iscyrillicexta' => '#/317',
+'iscyrillicextb' => '#/318',
+'iscyrillicextc' => '#/319',
+'iscyrillicextendeda' => '#/317',
+'iscyrillicextendedb' => '#/318',
+'iscyrillicextendedc' => '#/319',
+'iscyrillicsup' => '#/293',
+'iscyrillicsupplement' => '#/293',
+'iscyrillicsupplementary' => '#/293',
+'iscyrl' => 'Scx/Cyrl',
+'isdash' => 'Dash/Y',
+'isdashpunctuation' => 'Gc/Pd',
+'isdecimalnumber' => 'Gc/Nd',
+'isdefaultignorablecodepoint' => 'DI/Y',
+'isdep' => 'Dep/Y',
+'isdeprecated' => 'Dep/Y',
+'isdeseret' => '#/181',
+'isdeva' => 'Scx/Deva',
+'isdevanagari' => 'Scx/Deva',
+'isdevanagariext' => '#/334',
+'isdevanagariextended' => '#/334',
+'isdi' => 'DI/Y',
+'isdia' => 'Dia/Y',
+'isdiacritic' => 'Dia/Y',
+'isdiacriticals' => '#/320',
+'isdiacriticalsext' => '#/353',
+'isdiacriticalsforsymbols' => '#/399',
+'isdiacriticalssup' => '#/354',
+'isdigit' => 'Gc/Nd',
+'isdingbats' => '#/221',
+'isdogr' => '#/637',
+'isdogra' => '#/637',
+'isdomino' => '#/151',
+'isdominotiles' => '#/151',
+'isdsrt' => '#/181',
+'isdupl' => 'Scx/Dupl',
+'isduployan' => 'Scx/Dupl',
+'isearlydynasticcuneiform' => '#/400',
+'isegyp' => '#/638',
+'isegyptianhieroglyphformatcontrols' => '#/405',
+'isegyptianhieroglyphs' => '#/638',
+'iselba' => '#/639',
+'iselbasan' => '#/639',
+'iselym' => '#/640',
+'iselymaic' => '#/640',
+'isemoticons' => '#/248',
+'isenclosedalphanum' => '#/366',
+'isenclosedalphanumerics' => '#/366',
+'isenclosedalphanumericsupplement' => '#/389',
+'isenclosedalphanumsup' => '#/389',
+'isenclosedcjk' => '#/294',
+'isenclosedcjklettersandmonths' => '#/294',
+'isenclosedideographicsup' => '#/401',
+'isenclosedideographicsupplement' => '#/401',
+'isenclosingmark' => 'Gc/Me',
+'isethi' => 'Scx/Ethi',
+'isethiopic' => 'Scx/Ethi',
+'isethiopicext' => '#/295',
+'isethiopicexta' => '#/321',
+'isethiopicextended' => '#/295',
+'isethiopicextendeda' => '#/321',
+'isethiopicsup' => '#/296',
+'isethiopicsupplement' => '#/296',
+'isext' => 'Ext/Y',
+'isextender' => 'Ext/Y',
+'isfinalpunctuation' => 'Gc/Pf',
+'isformat' => 'Gc/Cf',
+'isfullcompositionexclusion' => 'CompEx/Y',
+'isgeneralpunctuation' => '#/309',
+'isgeometricshapes' => '#/355',
+'isgeometricshapesext' => '#/382',
+'isgeometricshapesextended' => '#/382',
+'isgeor' => 'Scx/Geor',
+'isgeorgian' => 'Scx/Geor',
+'isgeorgianext' => '#/297',
+'isgeorgianextended' => '#/297',
+'isgeorgiansup' => '#/298',
+'isgeorgiansupplement' => '#/298',
+'isglag' => 'Scx/Glag',
+'isglagolitic' => 'Scx/Glag',
+'isglagoliticsup' => '#/335',
+'isglagoliticsupplement' => '#/335',
+'isgong' => 'Scx/Gong',
+'isgonm' => 'Scx/Gonm',
+'isgoth' => '#/641',
+'isgothic' => '#/641',
+'isgran' => 'Scx/Gran',
+'isgrantha' => 'Scx/Gran',
+'isgraph' => 'Perl/Graph',
+'isgraphemebase' => 'GrBase/Y',
+'isgraphemeextend' => 'GrExt/Y',
+'isgrbase' => 'GrBase/Y',
+'isgreek' => 'Scx/Grek',
+'isgreekandcoptic' => '#/132',
+'isgreekext' => '#/225',
+'isgreekextended' => '#/225',
+'isgrek' => 'Scx/Grek',
+'isgrext' => 'GrExt/Y',
+'isgujarati' => 'Scx/Gujr',
+'isgujr' => 'Scx/Gujr',
+'isgunjalagondi' => 'Scx/Gong',
+'isgurmukhi' => 'Scx/Guru',
+'isguru' => 'Scx/Guru',
+'ishalfandfullforms' => '#/367',
+'ishalfmarks' => '#/249',
+'ishalfwidthandfullwidthforms' => '#/367',
+'ishan' => 'Scx/Han',
+'ishang' => 'Scx/Hang',
+'ishangul' => 'Scx/Hang',
+'ishangulcompatibilityjamo' => '#/274',
+'ishanguljamo' => '#/117',
+'ishanguljamoextendeda' => '#/229',
+'ishanguljamoextendedb' => '#/230',
+'ishangulsyllables' => '#/153',
+'ishani' => 'Scx/Han',
+'ishanifirohingya' => 'Scx/Rohg',
+'ishano' => '#/642',
+'ishanunoo' => '#/642',
+'ishatr' => '#/643',
+'ishatran' => '#/643',
+'ishebr' => 'Scx/Hebr',
+'ishebrew' => 'Scx/Hebr',
+'ishex' => 'Hex/Y',
+'ishexdigit' => 'Hex/Y',
+'ishighprivateusesurrogates' => '#/368',
+'ishighpusurrogates' => '#/368',
+'ishighsurrogates' => '#/346',
+'ishira' => 'Scx/Hira',
+'ishiragana' => 'Scx/Hira',
+'ishluw' => '#/644',
+'ishmng' => 'Scx/Hmng',
+'ishmnp' => 'Scx/Hmnp',
+'ishorizspace' => 'Perl/Blank',
+'ishung' => '#/645',
+'ishyphen' => 'Hyphen/T',
+'isidc' => 'IDC/Y',
+'isidcontinue' => 'IDC/Y',
+'isideo' => 'Ideo/Y',
+'isideographic' => 'Ideo/Y',
+'isideographicdescriptioncharacters' => '#/108',
+'isideographicsymbols' => '#/383',
+'isideographicsymbolsandpunctuation' => '#/383',
+'isids' => 'IDS/Y',
+'isidsb' => '#/67',
+'isidsbinaryoperator' => '#/67',
+'isidst' => '#/68',
+'isidstart' => 'IDS/Y',
+'isidstrinaryoperator' => '#/68',
+'isimperialaramaic' => '#/625',
+'isindicnumberforms' => '#/369',
+'isindicsiyaqnumbers' => '#/378',
+'isinherited' => 'Scx/Zinh',
+'isinitialpunctuation' => 'Gc/Pi',
+'isinscriptionalpahlavi' => '#/672',
+'isinscriptionalparthian' => '#/674',
+'isipaext' => '#/156',
+'isipaextensions' => '#/156',
+'isital' => '#/646',
+'isjamo' => '#/117',
+'isjamoexta' => '#/229',
+'isjamoextb' => '#/230',
+'isjava' => '#/647',
+'isjavanese' => '#/647',
+'isjoinc' => '#/85',
+'isjoincontrol' => '#/85',
+'iskaithi' => 'Scx/Kthi',
+'iskali' => '#/188',
+'iskana' => 'Scx/Kana',
+'iskanaexta' => '#/232',
+'iskanaextendeda' => '#/232',
+'iskanasup' => '#/186',
+'iskanasupplement' => '#/186',
+'iskanbun' => '#/158',
+'iskangxi' => '#/159',
+'iskangxiradicals' => '#/159',
+'iskannada' => 'Scx/Knda',
+'iskatakana' => 'Scx/Kana',
+'iskatakanaext' => '#/299',
+'iskatakanaphoneticextensions' => '#/299',
+'iskayahli' => '#/188',
+'iskhar' => 'Scx/Khar',
+'iskharoshthi' => 'Scx/Khar',
+'iskhmer' => 'Scx/Khmr',
+'iskhmersymbols' => '#/323',
+'iskhmr' => 'Scx/Khmr',
+'iskhoj' => 'Scx/Khoj',
+'iskhojki' => 'Scx/Khoj',
+'iskhudawadi' => 'Scx/Sind',
+'isknda' => 'Scx/Knda',
+'iskthi' => 'Scx/Kthi',
+'isl' => 'Gc/L',
+'isl&' => 'Gc/LC',
+'isl_' => 'Gc/LC',
+'islana' => 'Scx/Lana',
+'islao' => 'Scx/Lao',
+'islaoo' => 'Scx/Lao',
+'islatin' => 'Scx/Latn',
+'islatin1' => '#/161',
+'islatin1sup' => '#/161',
+'islatin1supplement' => '#/161',
+'islatinexta' => '#/251',
+'islatinextadditional' => '#/384',
+'islatinextb' => '#/252',
+'islatinextc' => '#/253',
+'islatinextd' => '#/254',
+'islatinexte' => '#/255',
+'islatinextendeda' => '#/251',
+'islatinextendedadditional' => '#/384',
+'islatinextendedb' => '#/252',
+'islatinextendedc' => '#/253',
+'islatinextendedd' => '#/254',
+'islatinextendede' => '#/255',
+'islatn' => 'Scx/Latn',
+'islc' => 'Gc/LC',
+'islepc' => '#/648',
+'islepcha' => '#/648',
+'isletter' => 'Gc/L',
+'isletterlikesymbols' => '#/379',
+'isletternumber' => 'Gc/Nl',
+'islimb' => 'Scx/Limb',
+'islimbu' => 'Scx/Limb',
+'islina' => 'Scx/Lina',
+'islinb' => 'Scx/Linb',
+'islineara' => 'Scx/Lina',
+'islinearb' => 'Scx/Linb',
+'islinearbideograms' => '#/370',
+'islinearbsyllabary' => '#/371',
+'islineseparator' => '#/411',
+'islisu' => '#/118',
+'isll' => 'Gc/Ll',
+'islm' => 'Gc/Lm',
+'islo' => 'Gc/Lo',
+'isloe' => 'InPC/VisualOr',
+'islogicalorderexception' => 'InPC/VisualOr',
+'islower' => 'Lower/Y',
+'islowercase' => 'Lower/Y',
+'islowercaseletter' => 'Gc/Ll',
+'islowsurrogates' => '#/336',
+'islt' => 'Perl/Title',
+'islu' => 'Gc/Lu',
+'islyci' => '#/649',
+'islycian' => '#/649',
+'islydi' => '#/650',
+'islydian' => '#/650',
+'ism' => 'Gc/M',
+'ismahajani' => '#/651',
+'ismahj' => '#/651',
+'ismahjong' => '#/190',
+'ismahjongtiles' => '#/190',
+'ismaka' => '#/652',
+'ismakasar' => '#/652',
+'ismalayalam' => 'Scx/Mlym',
+'ismand' => '#/653',
+'ismandaic' => '#/653',
+'ismani' => '#/654',
+'ismanichaean' => '#/654',
+'ismarc' => '#/655',
+'ismarchen' => '#/655',
+'ismark' => 'Gc/M',
+'ismasaramgondi' => 'Scx/Gonm',
+'ismath' => 'Math/Y',
+'ismathalphanum' => '#/325',
+'ismathematicalalphanumericsymbols' => '#/325',
+'ismathematicaloperators' => '#/337',
+'ismathoperators' => '#/337',
+'ismathsymbol' => 'Gc/Sm',
+'ismayannumerals' => '#/338',
+'ismc' => 'Gc/Mc',
+'isme' => 'Gc/Me',
+'ismedefaidrin' => '#/656',
+'ismedf' => '#/656',
+'ismeeteimayek' => '#/661',
+'ismeeteimayekext' => '#/347',
+'ismeeteimayekextensions' => '#/347',
+'ismend' => '#/657',
+'ismendekikakui' => '#/657',
+'ismerc' => '#/658',
+'ismero' => '#/390',
+'ismeroiticcursive' => '#/658',
+'ismeroitichieroglyphs' => '#/390',
+'ismiao' => '#/659',
+'ismiscarrows' => '#/279',
+'ismiscellaneousmathematicalsymbolsa' => '#/372',
+'ismiscellaneousmathematicalsymbolsb' => '#/373',
+'ismiscellaneoussymbols' => '#/302',
+'ismiscellaneoussymbolsandarrows' => '#/279',
+'ismiscellaneoussymbolsandpictographs' => '#/358',
+'ismiscellaneoustechnical' => '#/339',
+'ismiscmathsymbolsa' => '#/372',
+'ismiscmathsymbolsb' => '#/373',
+'ismiscpictographs' => '#/358',
+'ismiscsymbols' => '#/302',
+'ismisctechnical' => '#/339',
+'ismlym' => 'Scx/Mlym',
+'ismn' => 'Gc/Mn',
+'ismodi' => '#/660',
+'ismodifierletter' => 'Gc/Lm',
+'ismodifierletters' => '#/359',
+'ismodifiersymbol' => 'Gc/Sk',
+'ismodifiertoneletters' => '#/391',
+'ismong' => 'Scx/Mong',
+'ismongolian' => 'Scx/Mong',
+'ismongoliansup' => '#/327',
+'ismongoliansupplement' => '#/327',
+'ismro' => '#/620',
+'ismroo' => '#/620',
+'ismtei' => '#/661',
+'ismult' => 'Scx/Mult',
+'ismultani' => 'Scx/Mult',
+'ismusic' => '#/135',
+'ismusicalsymbols' => '#/135',
+'ismyanmar' => 'Scx/Mymr',
+'ismyanmarexta' => '#/303',
+'ismyanmarextb' => '#/304',
+'ismyanmarextendeda' => '#/303',
+'ismyanmarextendedb' => '#/304',
+'ismymr' => 'Scx/Mymr',
+'isn' => 'Gc/N',
+'isnabataean' => '#/662',
+'isnand' => 'Scx/Nand',
+'isnandinagari' => 'Scx/Nand',
+'isnarb' => '#/360',
+'isnb' => 'Blk/NB',
+'isnbat' => '#/662',
+'isnchar' => 'Perl/_PerlNch',
+'isnd' => 'Gc/Nd',
+'isnewa' => '#/663',
+'isnewtailue' => 'Scx/Talu',
+'isnko' => '#/621',
+'isnkoo' => '#/621',
+'isnl' => 'Gc/Nl',
+'isno' => 'Gc/No',
+'isnoblock' => 'Blk/NB',
+'isnoncharactercodepoint' => 'Perl/_PerlNch',
+'isnonspacingmark' => 'Gc/Mn',
+'isnshu' => '#/664',
+'isnumber' => 'Gc/N',
+'isnumberforms' => '#/306',
+'isnushu' => '#/664',
+'isnyiakengpuachuehmong' => 'Scx/Hmnp',
+'isocr' => '#/112',
+'isogam' => '#/665',
+'isogham' => '#/665',
+'isolchiki' => '#/196',
+'isolck' => '#/196',
+'isoldhungarian' => '#/645',
+'isolditalic' => '#/646',
+'isoldnortharabian' => '#/360',
+'isoldpermic' => '#/670',
+'isoldpersian' => '#/696',
+'isoldsogdian' => '#/682',
+'isoldsoutharabian' => '#/361',
+'isoldturkic' => '#/666',
+'isopenpunctuation' => 'Gc/Ps',
+'isopticalcharacterrecognition' => '#/112',
+'isoriya' => 'Scx/Orya',
+'isorkh' => '#/666',
+'isornamentaldingbats' => '#/385',
+'isorya' => 'Scx/Orya',
+'isosage' => '#/667',
+'isosge' => '#/667',
+'isosma' => '#/668',
+'isosmanya' => '#/668',
+'isother' => 'Gc/C',
+'isotherletter' => 'Gc/Lo',
+'isothernumber' => 'Gc/No',
+'isotherpunctuation' => 'Gc/Po',
+'isothersymbol' => 'Gc/So',
+'isottomansiyaqnumbers' => '#/392',
+'isp' => 'Gc/P',
+'ispahawhhmong' => 'Scx/Hmng',
+'ispalm' => '#/263',
+'ispalmyrene' => '#/263',
+'isparagraphseparator' => '#/412',
+'ispatsyn' => 'PatSyn/Y',
+'ispatternsyntax' => 'PatSyn/Y',
+'ispatternwhitespace' => 'Perl/_PerlPat',
+'ispatws' => 'Perl/_PerlPat',
+'ispauc' => '#/669',
+'ispaucinhau' => '#/669',
+'ispc' => 'Gc/Pc',
+'ispcm' => 'PCM/Y',
+'ispd' => 'Gc/Pd',
+'ispe' => 'Gc/Pe',
+'isperlspace' => '#/3',
+'isperlword' => 'Perl/PerlWord',
+'isperm' => '#/670',
+'ispf' => 'Gc/Pf',
+'isphag' => '#/671',
+'isphagspa' => '#/671',
+'isphaistos' => '#/235',
+'isphaistosdisc' => '#/235',
+'isphli' => '#/672',
+'isphlp' => 'Scx/Phlp',
+'isphnx' => '#/673',
+'isphoenician' => '#/673',
+'isphoneticext' => '#/308',
+'isphoneticextensions' => '#/308',
+'isphoneticextensionssupplement' => '#/348',
+'isphoneticextsup' => '#/348',
+'ispi' => 'Gc/Pi',
+'isplayingcards' => '#/329',
+'isplrd' => '#/659',
+'ispo' => 'Gc/Po',
+'isposixalnum' => '#/5',
+'isposixalpha' => '#/6',
+'isposixblank' => '#/7',
+'isposixcntrl' => '#/8',
+'isposixdigit' => '#/9',
+'isposixgraph' => '#/10',
+'isposixlower' => '#/11',
+'isposixprint' => '#/12',
+'isposixpunct' => 'Perl/PosixPun',
+'isposixspace' => '#/3',
+'isposixupper' => '#/13',
+'isposixword' => 'Perl/PerlWord',
+'isposixxdigit' => '#/59',
+'isprependedconcatenationmark' => 'PCM/Y',
+'isprint' => 'Perl/Print',
+'isprivateuse' => '#/410',
+'isprivateusearea' => '#/113',
+'isprti' => '#/674',
+'isps' => 'Gc/Ps',
+'ispsalterpahlavi' => 'Scx/Phlp',
+'ispua' => '#/113',
+'ispunct' => 'Gc/P',
+'ispunctuation' => 'Gc/P',
+'isqaac' => 'Scx/Copt',
+'isqaai' => 'Scx/Zinh',
+'isqmark' => 'QMark/Y',
+'isquotationmark' => 'QMark/Y',
+'isradical' => '#/86',
+'isregionalindicator' => '#/65',
+'isrejang' => '#/675',
+'isri' => '#/65',
+'isrjng' => '#/675',
+'isrohg' => 'Scx/Rohg',
+'isrumi' => '#/122',
+'isruminumeralsymbols' => '#/122',
+'isrunic' => '#/676',
+'isrunr' => '#/676',
+'iss' => 'Gc/S',
+'issamaritan' => '#/677',
+'issamr' => '#/677',
+'issarb' => '#/361',
+'issaur' => '#/678',
+'issaurashtra' => '#/678',
+'issc' => 'Gc/Sc',
+'issd' => 'SD/Y',
+'issentenceterminal' => 'STerm/Y',
+'isseparator' => 'Gc/Z',
+'issgnw' => '#/679',
+'issharada' => 'Scx/Shrd',
+'isshavian' => '#/200',
+'isshaw' => '#/200',
+'isshorthandformatcontrols' => '#/402',
+'isshrd' => 'Scx/Shrd',
+'issidd' => '#/680',
+'issiddham' => '#/680',
+'issignwriting' => '#/679',
+'issind' => 'Scx/Sind',
+'issinh' => 'Scx/Sinh',
+'issinhala' => 'Scx/Sinh',
+'issinhalaarchaicnumbers' => '#/397',
+'issk' => 'Gc/Sk',
+'issm' => 'Gc/Sm',
+'issmallforms' => '#/284',
+'issmallformvariants' => '#/284',
+'issmallkanaext' => '#/330',
+'issmallkanaextension' => '#/330',
+'isso' => 'Gc/So',
+'issoftdotted' => 'SD/Y',
+'issogd' => '#/681',
+'issogdian' => '#/681',
+'issogo' => '#/682',
+'issora' => '#/683',
+'issorasompeng' => '#/683',
+'issoyo' => '#/684',
+'issoyombo' => '#/684',
+'isspace' => 'Perl/SpacePer',
+'isspaceperl' => 'Perl/SpacePer',
+'isspaceseparator' => 'Gc/Zs',
+'isspacingmark' => 'Gc/Mc',
+'isspacingmodifierletters' => '#/359',
+'isspecials' => '#/236',
+'issterm' => 'STerm/Y',
+'issund' => '#/685',
+'issundanese' => '#/685',
+'issundanesesup' => '#/331',
+'issundanesesupplement' => '#/331',
+'issuparrowsa' => '#/285',
+'issuparrowsb' => '#/286',
+'issuparrowsc' => '#/287',
+'issuperandsub' => '#/311',
+'issuperscriptsandsubscripts' => '#/311',
+'issupmathoperators' => '#/374',
+'issupplementalarrowsa' => '#/285',
+'issupplementalarrowsb' => '#/286',
+'issupplementalarrowsc' => '#/287',
+'issupplementalmathematicaloperators' => '#/374',
+'issupplementalpunctuation' => '#/350',
+'issupplementalsymbolsandpictographs' => '#/403',
+'issupplementaryprivateuseareaa' => '#/205',
+'issupplementaryprivateuseareab' => '#/206',
+'issuppuaa' => '#/205',
+'issuppuab' => '#/206',
+'issuppunctuation' => '#/350',
+'issupsymbolsandpictographs' => '#/403',
+'issurrogate' => '#/14',
+'issuttonsignwriting' => '#/380',
+'issylo' => '#/686',
+'issylotinagri' => '#/686',
+'issymbol' => 'Gc/S',
+'issymbolsandpictographsexta' => '#/404',
+'issymbolsandpictographsextendeda' => '#/404',
+'issyrc' => 'Scx/Syrc',
+'issyriac' => 'Scx/Syrc',
+'issyriacsup' => '#/267',
+'issyriacsupplement' => '#/267',
+'istagalog' => '#/691',
+'istagb' => 'Scx/Tagb',
+'istagbanwa' => 'Scx/Tagb',
+'istags' => '#/123',
+'istaile' => '#/687',
+'istaitham' => 'Scx/Lana',
+'istaiviet' => '#/689',
+'istaixuanjing' => '#/313',
+'istaixuanjingsymbols' => '#/313',
+'istakr' => 'Scx/Takr',
+'istakri' => 'Scx/Takr',
+'istale' => '#/687',
+'istalu' => 'Scx/Talu',
+'istamil' => 'Scx/Taml',
+'istamilsup' => '#/238',
+'istamilsupplement' => '#/238',
+'istaml' => 'Scx/Taml',
+'istang' => '#/688',
+'istangut' => '#/688',
+'istangutcomponents' => '#/375',
+'istavt' => '#/689',
+'istelu' => 'Scx/Telu',
+'istelugu' => 'Scx/Telu',
+'isterm' => 'Term/Y',
+'isterminalpunctuation' => 'Term/Y',
+'istfng' => '#/690',
+'istglg' => '#/691',
+'isthaa' => 'Scx/Thaa',
+'isthaana' => 'Scx/Thaa',
+'isthai' => '#/692',
+'istibetan' => 'Scx/Tibt',
+'istibt' => 'Scx/Tibt',
+'istifinagh' => '#/690',
+'istirh' => 'Scx/Tirh',
+'istirhuta' => 'Scx/Tirh',
+'istitle' => 'Perl/Title',
+'istitlecase' => 'Perl/Title',
+'istitlecaseletter' => 'Perl/Title',
+'istransportandmap' => '#/362',
+'istransportandmapsymbols' => '#/362',
+'isucas' => '#/125',
+'isucasext' => '#/212',
+'isugar' => '#/693',
+'isugaritic' => '#/693',
+'isuideo' => 'UIdeo/Y',
+'isunassigned' => 'Gc/Cn',
+'isunicode' => '#/2',
+'isunifiedcanadianaboriginalsyllabics' => '#/125',
+'isunifiedcanadianaboriginalsyllabicsextended' => '#/212',
+'isunifiedideograph' => 'UIdeo/Y',
+'isunknown' => 'Scx/Zzzz',
+'isupper' => 'Upper/Y',
+'isuppercase' => 'Upper/Y',
+'isuppercaseletter' => 'Gc/Lu',
+'isvai' => '#/622',
+'isvaii' => '#/622',
+'isvariationselector' => '#/88',
+'isvariationselectors' => '#/106',
+'isvariationselectorssupplement' => '#/144',
+'isvedicext' => '#/241',
+'isvedicextensions' => '#/241',
+'isverticalforms' => '#/340',
+'isvertspace' => '#/4',
+'isvs' => '#/88',
+'isvssup' => '#/144',
+'iswancho' => '#/695',
+'iswara' => '#/694',
+'iswarangciti' => '#/694',
+'iswcho' => '#/695',
+'iswhitespace' => 'Perl/SpacePer',
+'isword' => 'Perl/Word',
+'iswspace' => 'Perl/SpacePer',
+'isxdigit' => 'Hex/Y',
+'isxidc' => 'XIDC/Y',
+'isxidcontinue' => 'XIDC/Y',
+'isxids' => 'XIDS/Y',
+'isxidstart' => 'XIDS/Y',
+'isxpeo' => '#/696',
+'isxperlspace' => 'Perl/SpacePer',
+'isxposixalnum' => 'Perl/Alnum',
+'isxposixalpha' => 'Alpha/Y',
+'isxposixblank' => 'Perl/Blank',
+'isxposixcntrl' => '#/409',
+'isxposixdigit' => 'Gc/Nd',
+'isxposixgraph' => 'Perl/Graph',
+'isxposixlower' => 'Lower/Y',
+'isxposixprint' => 'Perl/Print',
+'isxposixpunct' => 'Perl/XPosixPu',
+'isxposixspace' => 'Perl/SpacePer',
+'isxposixupper' => 'Upper/Y',
+'isxposixword' => 'Perl/Word',
+'isxposixxdigit' => 'Hex/Y',
+'isxsux' => 'Scx/Xsux',
+'isyi' => 'Scx/Yi',
+'isyiii' => 'Scx/Yi',
+'isyijing' => '#/171',
+'isyijinghexagramsymbols' => '#/171',
+'isyiradicals' => '#/289',
+'isyisyllables' => '#/314',
+'isz' => 'Gc/Z',
+'iszanabazarsquare' => '#/697',
+'iszanb' => '#/697',
+'iszinh' => 'Scx/Zinh',
+'iszl' => '#/411',
+'iszp' => '#/412',
+'iszs' => 'Gc/Zs',
+'iszyyy' => 'Scx/Zyyy',
+'iszzzz' => 'Scx/Zzzz',
+'ital' => '#/646',
+'jamo' => '#/117',
+'jamoexta' => '#/229',
+'jamoextb' => '#/230',
+'java' => '#/647',
+'javanese' => '#/647',
+'jg=africanfeh' => '#/445',
+'jg=africannoon' => '#/451',
+'jg=africanqaf' => '#/446',
+'jg=ain' => 'Jg/Ain',
+'jg=alaph' => '#/433',
+'jg=alef' => 'Jg/Alef',
+'jg=beh' => 'Jg/Beh',
+'jg=beth' => '#/423',
+'jg=burushaskiyehbarree' => '#/496',
+'jg=dal' => 'Jg/Dal',
+'jg=dalathrish' => '#/447',
+'jg=e' => '#/413',
+'jg=farsiyeh' => 'Jg/FarsiYeh',
+'jg=fe' => '#/414',
+'jg=feh' => 'Jg/Feh',
+'jg=finalsemkath' => '#/457',
+'jg=gaf' => 'Jg/Gaf',
+'jg=gamal' => '#/434',
+'jg=hah' => 'Jg/Hah',
+'jg=hamzaonhehgoal' => '#/474',
+'jg=hanifirohingyakinnaya' => 'Jg/HanifiRo',
+'jg=hanifirohingyapa' => '#/488',
+'jg=he' => '#/415',
+'jg=heh' => '#/417',
+'jg=hehgoal' => '#/440',
+'jg=heth' => '#/424',
+'jg=kaf' => 'Jg/Kaf',
+'jg=kaph' => '#/425',
+'jg=khaph' => '#/435',
+'jg=knottedheh' => '#/448',
+'jg=lam' => 'Jg/Lam',
+'jg=lamadh' => '#/438',
+'jg=malayalambha' => '#/458',
+'jg=malayalamja' => '#/452',
+'jg=malayalamlla' => '#/459',
+'jg=malayalamllla' => '#/466',
+'jg=malayalamnga' => '#/460',
+'jg=malayalamnna' => '#/461',
+'jg=malayalamnnna' => '#/467',
+'jg=malayalamnya' => '#/462',
+'jg=malayalamra' => '#/453',
+'jg=malayalamssa' => '#/463',
+'jg=malayalamtta' => '#/464',
+'jg=manichaeanaleph' => '#/484',
+'jg=manichaeanayin' => '#/475',
+'jg=manichaeanbeth' => '#/476',
+'jg=manichaeandaleth' => '#/489',
+'jg=manichaeandhamedh' => '#/493',
+'jg=manichaeanfive' => '#/477',
+'jg=manichaeangimel' => '#/485',
+'jg=manichaeanheth' => '#/478',
+'jg=manichaeanhundred' => '#/494',
+'jg=manichaeankaph' => '#/479',
+'jg=manichaeanlamedh' => '#/490',
+'jg=manichaeanmem' => '#/468',
+'jg=manichaeannun' => '#/469',
+'jg=manichaeanone' => '#/470',
+'jg=manichaeanpe' => '#/465',
+'jg=manichaeanqoph' => '#/480',
+'jg=manichaeanresh' => '#/481',
+'jg=manichaeansadhe' => '#/486',
+'jg=manichaeansamekh' => '#/491',
+'jg=manichaeantaw' => '#/471',
+'jg=manichaeanten' => '#/472',
+'jg=manichaeanteth' => '#/482',
+'jg=manichaeanthamedh' => '#/495',
+'jg=manichaeantwenty' => '#/492',
+'jg=manichaeanwaw' => '#/473',
+'jg=manichaeanyodh' => '#/483',
+'jg=manichaeanzayin' => '#/487',
+'jg=meem' => '#/426',
+'jg=mim' => '#/418',
+'jg=nojoininggroup' => 'Jg/NoJoinin',
+'jg=noon' => '#/427',
+'jg=nun' => '#/419',
+'jg=nya' => '#/420',
+'jg=pe' => '#/416',
+'jg=qaf' => 'Jg/Qaf',
+'jg=qaph' => '#/428',
+'jg=reh' => 'Jg/Reh',
+'jg=reversedpe' => '#/449',
+'jg=rohingyayeh' => '#/454',
+'jg=sad' => 'Jg/Sad',
+'jg=sadhe' => '#/436',
+'jg=seen' => 'Jg/Seen',
+'jg=semkath' => '#/441',
+'jg=shin' => '#/429',
+'jg=straightwaw' => '#/455',
+'jg=swashkaf' => '#/442',
+'jg=syriacwaw' => '#/443',
+'jg=tah' => '#/421',
+'jg=taw' => '#/422',
+'jg=tehmarbuta' => '#/450',
+'jg=tehmarbutagoal' => '#/474',
+'jg=teth' => '#/430',
+'jg=waw' => 'Jg/Waw',
+'jg=yeh' => 'Jg/Yeh',
+'jg=yehbarree' => '#/444',
+'jg=yehwithtail' => '#/456',
+'jg=yudh' => '#/431',
+'jg=yudhhe' => '#/439',
+'jg=zain' => '#/432',
+'jg=zhain' => '#/437',
+'joinc' => '#/85',
+'joinc=f' => '#/!85',
+'joinc=false' => '#/!85',
+'joinc=n' => '#/!85',
+'joinc=no' => '#/!85',
+'joinc=t' => '#/85',
+'joinc=true' => '#/85',
+'joinc=y' => '#/85',
+'joinc=yes' => '#/85',
+'joincontrol' => '#/85',
+'jt=c' => 'Jt/C',
+'jt=d' => 'Jt/D',
+'jt=dualjoining' => 'Jt/D',
+'jt=joincausing' => 'Jt/C',
+'jt=l' => 'Jt/L',
+'jt=leftjoining' => 'Jt/L',
+'jt=nonjoining' => 'Jt/U',
+'jt=r' => 'Jt/R',
+'jt=rightjoining' => 'Jt/R',
+'jt=t' => 'Jt/T',
+'jt=transparent' => 'Jt/T',
+'jt=u' => 'Jt/U',
+'kaithi' => 'Scx/Kthi',
+'kali' => '#/188',
+'kana' => 'Scx/Kana',
+'kanaexta' => '#/232',
+'kanaextendeda' => '#/232',
+'kanasup' => '#/186',
+'kanasupplement' => '#/186',
+'kanbun' => '#/158',
+'kangxi' => '#/159',
+'kangxiradicals' => '#/159',
+'kannada' => 'Scx/Knda',
+'katakana' => 'Scx/Kana',
+'katakanaext' => '#/299',
+'katakanaphoneticextensions' => '#/299',
+'kayahli' => '#/188',
+'khar' => 'Scx/Khar',
+'kharoshthi' => 'Scx/Khar',
+'khmer' => 'Scx/Khmr',
+'khmersymbols' => '#/323',
+'khmr' => 'Scx/Khmr',
+'khoj' => 'Scx/Khoj',
+'khojki' => 'Scx/Khoj',
+'khudawadi' => 'Scx/Sind',
+'knda' => 'Scx/Knda',
+'kthi' => 'Scx/Kthi',
+'l' => 'Gc/L',
+'l&' => 'Gc/LC',
+'l_' => 'Gc/LC',
+'lana' => 'Scx/Lana',
+'lao' => 'Scx/Lao',
+'laoo' => 'Scx/Lao',
+'latin' => 'Scx/Latn',
+'latin1' => '#/161',
+'latin1sup' => '#/161',
+'latin1supplement' => '#/161',
+'latinexta' => '#/251',
+'latinextadditional' => '#/384',
+'latinextb' => '#/252',
+'latinextc' => '#/253',
+'latinextd' => '#/254',
+'latinexte' => '#/255',
+'latinextendeda' => '#/251',
+'latinextendedadditional' => '#/384',
+'latinextendedb' => '#/252',
+'latinextendedc' => '#/253',
+'latinextendedd' => '#/254',
+'latinextendede' => '#/255',
+'latn' => 'Scx/Latn',
+'lb=ai' => 'Lb/AI',
+'lb=al' => 'Lb/AL',
+'lb=alphabetic' => 'Lb/AL',
+'lb=ambiguous' => 'Lb/AI',
+'lb=b2' => '#/497',
+'lb=ba' => 'Lb/BA',
+'lb=bb' => 'Lb/BB',
+'lb=bk' => '#/498',
+'lb=breakafter' => 'Lb/BA',
+'lb=breakbefore' => 'Lb/BB',
+'lb=breakboth' => '#/497',
+'lb=breaksymbols' => '#/506',
+'lb=carriagereturn' => '#/63',
+'lb=cb' => '#/499',
+'lb=cj' => 'Lb/CJ',
+'lb=cl' => 'Lb/CL',
+'lb=closeparenthesis' => '#/500',
+'lb=closepunctuation' => 'Lb/CL',
+'lb=cm' => 'Lb/CM',
+'lb=combiningmark' => 'Lb/CM',
+'lb=complexcontext' => 'Lb/SA',
+'lb=conditionaljapanesestarter' => 'Lb/CJ',
+'lb=contingentbreak' => '#/499',
+'lb=cp' => '#/500',
+'lb=cr' => '#/63',
+'lb=eb' => 'Lb/EB',
+'lb=ebase' => 'Lb/EB',
+'lb=em' => '#/501',
+'lb=emodifier' => '#/501',
+'lb=ex' => 'Lb/EX',
+'lb=exclamation' => 'Lb/EX',
+'lb=gl' => 'Lb/GL',
+'lb=glue' => 'Lb/GL',
+'lb=h2' => 'GCB/LV',
+'lb=h3' => 'GCB/LVT',
+'lb=hebrewletter' => 'WB/HL',
+'lb=hl' => 'WB/HL',
+'lb=hy' => '#/502',
+'lb=hyphen' => '#/502',
+'lb=id' => 'Lb/ID',
+'lb=ideographic' => 'Lb/ID',
+'lb=in' => 'Lb/IN',
+'lb=infixnumeric' => 'Lb/IS',
+'lb=inseparable' => 'Lb/IN',
+'lb=inseperable' => 'Lb/IN',
+'lb=is' => 'Lb/IS',
+'lb=jl' => '#/60',
+'lb=jt' => '#/61',
+'lb=jv' => '#/62',
+'lb=lf' => '#/64',
+'lb=linefeed' => '#/64',
+'lb=mandatorybreak' => '#/498',
+'lb=nextline' => '#/503',
+'lb=nl' => '#/503',
+'lb=nonstarter' => 'Lb/NS',
+'lb=ns' => 'Lb/NS',
+'lb=nu' => 'Lb/NU',
+'lb=numeric' => 'Lb/NU',
+'lb=op' => 'Lb/OP',
+'lb=openpunctuation' => 'Lb/OP',
+'lb=po' => 'Lb/PO',
+'lb=postfixnumeric' => 'Lb/PO',
+'lb=pr' => 'Lb/PR',
+'lb=prefixnumeric' => 'Lb/PR',
+'lb=qu' => 'Lb/QU',
+'lb=quotation' => 'Lb/QU',
+'lb=regionalindicator' => '#/65',
+'lb=ri' => '#/65',
+'lb=sa' => 'Lb/SA',
+'lb=sg' => '#/504',
+'lb=sp' => '#/505',
+'lb=space' => '#/505',
+'lb=surrogate' => '#/504',
+'lb=sy' => '#/506',
+'lb=unknown' => 'Lb/XX',
+'lb=wj' => '#/507',
+'lb=wordjoiner' => '#/507',
+'lb=xx' => 'Lb/XX',
+'lb=zw' => '#/508',
+'lb=zwj' => '#/66',
+'lb=zwspace' => '#/508',
+'lc' => 'Gc/LC',
+'lepc' => '#/648',
+'lepcha' => '#/648',
+'letter' => 'Gc/L',
+'letterlikesymbols' => '#/379',
+'letternumber' => 'Gc/Nl',
+'limb' => 'Scx/Limb',
+'limbu' => 'Scx/Limb',
+'lina' => 'Scx/Lina',
+'linb' => 'Scx/Linb',
+'lineara' => 'Scx/Lina',
+'linearb' => 'Scx/Linb',
+'linearbideograms' => '#/370',
+'linearbsyllabary' => '#/371',
+'lineseparator' => '#/411',
+'lisu' => '#/118',
+'ll' => 'Gc/Ll',
+'lm' => 'Gc/Lm',
+'lo' => 'Gc/Lo',
+'loe' => 'InPC/VisualOr',
+'loe=f' => '!InPC/VisualOr',
+'loe=false' => '!InPC/VisualOr',
+'loe=n' => '!InPC/VisualOr',
+'loe=no' => '!InPC/VisualOr',
+'loe=t' => 'InPC/VisualOr',
+'loe=true' => 'InPC/VisualOr',
+'loe=y' => 'InPC/VisualOr',
+'loe=yes' => 'InPC/VisualOr',
+'logicalorderexception' => 'InPC/VisualOr',
+'lower' => 'Lower/Y',
+'lower=f' => '!Lower/Y',
+'lower=false' => '!Lower/Y',
+'lower=n' => '!Lower/Y',
+'lower=no' => '!Lower/Y',
+'lower=t' => 'Lower/Y',
+'lower=true' => 'Lower/Y',
+'lower=y' => 'Lower/Y',
+'lower=yes' => 'Lower/Y',
+'lowercase' => 'Lower/Y',
+'lowercaseletter' => 'Gc/Ll',
+'lowsurrogates' => '#/336',
+'lt' => 'Perl/Title',
+'lu' => 'Gc/Lu',
+'lyci' => '#/649',
+'lycian' => '#/649',
+'lydi' => '#/650',
+'lydian' => '#/650',
+'m' => 'Gc/M',
+'mahajani' => '#/651',
+'mahj' => '#/651',
+'mahjong' => '#/190',
+'mahjongtiles' => '#/190',
+'maka' => '#/652',
+'makasar' => '#/652',
+'malayalam' => 'Scx/Mlym',
+'mand' => '#/653',
+'mandaic' => '#/653',
+'mani' => '#/654',
+'manichaean' => '#/654',
+'marc' => '#/655',
+'marchen' => '#/655',
+'mark' => 'Gc/M',
+'masaramgondi' => 'Scx/Gonm',
+'math' => 'Math/Y',
+'math=f' => '!Math/Y',
+'math=false' => '!Math/Y',
+'math=n' => '!Math/Y',
+'math=no' => '!Math/Y',
+'math=t' => 'Math/Y',
+'math=true' => 'Math/Y',
+'math=y' => 'Math/Y',
+'math=yes' => 'Math/Y',
+'mathalphanum' => '#/325',
+'mathematicalalphanumericsymbols' => '#/325',
+'mathematicaloperators' => '#/337',
+'mathoperators' => '#/337',
+'mathsymbol' => 'Gc/Sm',
+'mayannumerals' => '#/338',
+'mc' => 'Gc/Mc',
+'me' => 'Gc/Me',
+'medefaidrin' => '#/656',
+'medf' => '#/656',
+'meeteimayek' => '#/661',
+'meeteimayekext' => '#/347',
+'meeteimayekextensions' => '#/347',
+'mend' => '#/657',
+'mendekikakui' => '#/657',
+'merc' => '#/658',
+'mero' => '#/390',
+'meroiticcursive' => '#/658',
+'meroitichieroglyphs' => '#/390',
+'miao' => '#/659',
+'miscarrows' => '#/279',
+'miscellaneousmathematicalsymbolsa' => '#/372',
+'miscellaneousmathematicalsymbolsb' => '#/373',
+'miscellaneoussymbols' => '#/302',
+'miscellaneoussymbolsandarrows' => '#/279',
+'miscellaneoussymbolsandpictographs' => '#/358',
+'miscellaneoustechnical' => '#/339',
+'miscmathsymbolsa' => '#/372',
+'miscmathsymbolsb' => '#/373',
+'miscpictographs' => '#/358',
+'miscsymbols' => '#/302',
+'misctechnical' => '#/339',
+'mlym' => 'Scx/Mlym',
+'mn' => 'Gc/Mn',
+'modi' => '#/660',
+'modifierletter' => 'Gc/Lm',
+'modifierletters' => '#/359',
+'modifiersymbol' => 'Gc/Sk',
+'modifiertoneletters' => '#/391',
+'mong' => 'Scx/Mong',
+'mongolian' => 'Scx/Mong',
+'mongoliansup' => '#/327',
+'mongoliansupplement' => '#/327',
+'mro' => '#/620',
+'mroo' => '#/620',
+'mtei' => '#/661',
+'mult' => 'Scx/Mult',
+'multani' => 'Scx/Mult',
+'music' => '#/135',
+'musicalsymbols' => '#/135',
+'myanmar' => 'Scx/Mymr',
+'myanmarexta' => '#/303',
+'myanmarextb' => '#/304',
+'myanmarextendeda' => '#/303',
+'myanmarextendedb' => '#/304',
+'mymr' => 'Scx/Mymr',
+'n' => 'Gc/N',
+'nabataean' => '#/662',
+'nand' => 'Scx/Nand',
+'nandinagari' => 'Scx/Nand',
+'narb' => '#/360',
+'nb' => 'Blk/NB',
+'nbat' => '#/662',
+'nchar' => 'Perl/_PerlNch',
+'nchar=f' => '!Perl/_PerlNch',
+'nchar=false' => '!Perl/_PerlNch',
+'nchar=n' => '!Perl/_PerlNch',
+'nchar=no' => '!Perl/_PerlNch',
+'nchar=t' => 'Perl/_PerlNch',
+'nchar=true' => 'Perl/_PerlNch',
+'nchar=y' => 'Perl/_PerlNch',
+'nchar=yes' => 'Perl/_PerlNch',
+'nd' => 'Gc/Nd',
+'newa' => '#/663',
+'newtailue' => 'Scx/Talu',
+'nfcqc=m' => 'NFCQC/M',
+'nfcqc=maybe' => 'NFCQC/M',
+'nfcqc=n' => 'CompEx/Y',
+'nfcqc=no' => 'CompEx/Y',
+'nfcqc=y' => 'NFCQC/Y',
+'nfcqc=yes' => 'NFCQC/Y',
+'nfdqc=n' => 'NFDQC/N',
+'nfdqc=no' => 'NFDQC/N',
+'nfdqc=y' => 'NFDQC/Y',
+'nfdqc=yes' => 'NFDQC/Y',
+'nfkcqc=m' => 'NFCQC/M',
+'nfkcqc=maybe' => 'NFCQC/M',
+'nfkcqc=n' => 'NFKCQC/N',
+'nfkcqc=no' => 'NFKCQC/N',
+'nfkcqc=y' => 'NFKCQC/Y',
+'nfkcqc=yes' => 'NFKCQC/Y',
+'nfkdqc=n' => 'NFKDQC/N',
+'nfkdqc=no' => 'NFKDQC/N',
+'nfkdqc=y' => 'NFKDQC/Y',
+'nfkdqc=yes' => 'NFKDQC/Y',
+'nko' => '#/621',
+'nkoo' => '#/621',
+'nl' => 'Gc/Nl',
+'no' => 'Gc/No',
+'noblock' => 'Blk/NB',
+'noncharactercodepoint' => 'Perl/_PerlNch',
+'nonspacingmark' => 'Gc/Mn',
+'nshu' => '#/664',
+'nt=de' => 'Gc/Nd',
+'nt=decimal' => 'Gc/Nd',
+'nt=di' => 'Nt/Di',
+'nt=digit' => 'Nt/Di',
+'nt=none' => 'Nt/None',
+'nt=nu' => 'Nt/Nu',
+'nt=numeric' => 'Nt/Nu',
+'number' => 'Gc/N',
+'numberforms' => '#/306',
+'nushu' => '#/664',
+'nv=nan' => 'Nt/None',
+'nyiakengpuachuehmong' => 'Scx/Hmnp',
+'ocr' => '#/112',
+'ogam' => '#/665',
+'ogham' => '#/665',
+'olchiki' => '#/196',
+'olck' => '#/196',
+'oldhungarian' => '#/645',
+'olditalic' => '#/646',
+'oldnortharabian' => '#/360',
+'oldpermic' => '#/670',
+'oldpersian' => '#/696',
+'oldsogdian' => '#/682',
+'oldsoutharabian' => '#/361',
+'oldturkic' => '#/666',
+'openpunctuation' => 'Gc/Ps',
+'opticalcharacterrecognition' => '#/112',
+'oriya' => 'Scx/Orya',
+'orkh' => '#/666',
+'ornamentaldingbats' => '#/385',
+'orya' => 'Scx/Orya',
+'osage' => '#/667',
+'osge' => '#/667',
+'osma' => '#/668',
+'osmanya' => '#/668',
+'other' => 'Gc/C',
+'otherletter' => 'Gc/Lo',
+'othernumber' => 'Gc/No',
+'otherpunctuation' => 'Gc/Po',
+'othersymbol' => 'Gc/So',
+'ottomansiyaqnumbers' => '#/392',
+'p' => 'Gc/P',
+'pahawhhmong' => 'Scx/Hmng',
+'palm' => '#/263',
+'palmyrene' => '#/263',
+'paragraphseparator' => '#/412',
+'patsyn' => 'PatSyn/Y',
+'patsyn=f' => '!PatSyn/Y',
+'patsyn=false' => '!PatSyn/Y',
+'patsyn=n' => '!PatSyn/Y',
+'patsyn=no' => '!PatSyn/Y',
+'patsyn=t' => 'PatSyn/Y',
+'patsyn=true' => 'PatSyn/Y',
+'patsyn=y' => 'PatSyn/Y',
+'patsyn=yes' => 'PatSyn/Y',
+'patternsyntax' => 'PatSyn/Y',
+'patternwhitespace' => 'Perl/_PerlPat',
+'patws' => 'Perl/_PerlPat',
+'patws=f' => '!Perl/_PerlPat',
+'patws=false' => '!Perl/_PerlPat',
+'patws=n' => '!Perl/_PerlPat',
+'patws=no' => '!Perl/_PerlPat',
+'patws=t' => 'Perl/_PerlPat',
+'patws=true' => 'Perl/_PerlPat',
+'patws=y' => 'Perl/_PerlPat',
+'patws=yes' => 'Perl/_PerlPat',
+'pauc' => '#/669',
+'paucinhau' => '#/669',
+'pc' => 'Gc/Pc',
+'pcm' => 'PCM/Y',
+'pcm=f' => '!PCM/Y',
+'pcm=false' => '!PCM/Y',
+'pcm=n' => '!PCM/Y',
+'pcm=no' => '!PCM/Y',
+'pcm=t' => 'PCM/Y',
+'pcm=true' => 'PCM/Y',
+'pcm=y' => 'PCM/Y',
+'pcm=yes' => 'PCM/Y',
+'pd' => 'Gc/Pd',
+'pe' => 'Gc/Pe',
+'perlspace' => '#/3',
+'perlword' => 'Perl/PerlWord',
+'perm' => '#/670',
+'pf' => 'Gc/Pf',
+'phag' => '#/671',
+'phagspa' => '#/671',
+'phaistos' => '#/235',
+'phaistosdisc' => '#/235',
+'phli' => '#/672',
+'phlp' => 'Scx/Phlp',
+'phnx' => '#/673',
+'phoenician' => '#/673',
+'phoneticext' => '#/308',
+'phoneticextensions' => '#/308',
+'phoneticextensionssupplement' => '#/348',
+'phoneticextsup' => '#/348',
+'pi' => 'Gc/Pi',
+'playingcards' => '#/329',
+'plrd' => '#/659',
+'po' => 'Gc/Po',
+'posixalnum' => '#/5',
+'posixalpha' => '#/6',
+'posixblank' => '#/7',
+'posixcntrl' => '#/8',
+'posixdigit' => '#/9',
+'posixgraph' => '#/10',
+'posixlower' => '#/11',
+'posixprint' => '#/12',
+'posixpunct' => 'Perl/PosixPun',
+'posixspace' => '#/3',
+'posixupper' => '#/13',
+'posixword' => 'Perl/PerlWord',
+'posixxdigit' => '#/59',
+'prependedconcatenationmark' => 'PCM/Y',
+'print' => 'Perl/Print',
+'privateuse' => '#/410',
+'privateusearea' => '#/113',
+'prti' => '#/674',
+'ps' => 'Gc/Ps',
+'psalterpahlavi' => 'Scx/Phlp',
+'pua' => '#/113',
+'punct' => 'Gc/P',
+'punctuation' => 'Gc/P',
+'qaac' => 'Scx/Copt',
+'qaai' => 'Scx/Zinh',
+'qmark' => 'QMark/Y',
+'qmark=f' => '!QMark/Y',
+'qmark=false' => '!QMark/Y',
+'qmark=n' => '!QMark/Y',
+'qmark=no' => '!QMark/Y',
+'qmark=t' => 'QMark/Y',
+'qmark=true' => 'QMark/Y',
+'qmark=y' => 'QMark/Y',
+'qmark=yes' => 'QMark/Y',
+'quotationmark' => 'QMark/Y',
+'radical' => '#/86',
+'radical=f' => '#/!86',
+'radical=false' => '#/!86',
+'radical=n' => '#/!86',
+'radical=no' => '#/!86',
+'radical=t' => '#/86',
+'radical=true' => '#/86',
+'radical=y' => '#/86',
+'radical=yes' => '#/86',
+'regionalindicator' => '#/65',
+'rejang' => '#/675',
+'ri' => '#/65',
+'ri=f' => '#/!65',
+'ri=false' => '#/!65',
+'ri=n' => '#/!65',
+'ri=no' => '#/!65',
+'ri=t' => '#/65',
+'ri=true' => '#/65',
+'ri=y' => '#/65',
+'ri=yes' => '#/65',
+'rjng' => '#/675',
+'rohg' => 'Scx/Rohg',
+'rumi' => '#/122',
+'ruminumeralsymbols' => '#/122',
+'runic' => '#/676',
+'runr' => '#/676',
+'s' => 'Gc/S',
+'samaritan' => '#/677',
+'samr' => '#/677',
+'sarb' => '#/361',
+'saur' => '#/678',
+'saurashtra' => '#/678',
+'sb=at' => 'SB/AT',
+'sb=aterm' => 'SB/AT',
+'sb=cl' => 'SB/CL',
+'sb=close' => 'SB/CL',
+'sb=cr' => '#/63',
+'sb=ex' => 'SB/EX',
+'sb=extend' => 'SB/EX',
+'sb=fo' => 'SB/FO',
+'sb=format' => 'SB/FO',
+'sb=le' => 'SB/LE',
+'sb=lf' => '#/64',
+'sb=lo' => 'SB/LO',
+'sb=lower' => 'SB/LO',
+'sb=nu' => 'SB/NU',
+'sb=numeric' => 'SB/NU',
+'sb=oletter' => 'SB/LE',
+'sb=other' => 'SB/XX',
+'sb=sc' => 'SB/SC',
+'sb=scontinue' => 'SB/SC',
+'sb=se' => '#/87',
+'sb=sep' => '#/87',
+'sb=sp' => 'SB/Sp',
+'sb=st' => 'SB/ST',
+'sb=sterm' => 'SB/ST',
+'sb=up' => 'SB/UP',
+'sb=upper' => 'SB/UP',
+'sb=xx' => 'SB/XX',
+'sc' => 'Gc/Sc',
+'sc=adlam' => '#/587',
+'sc=adlm' => '#/587',
+'sc=aghb' => '#/623',
+'sc=ahom' => '#/624',
+'sc=anatolianhieroglyphs' => '#/644',
+'sc=arab' => 'Sc/Arab',
+'sc=arabic' => 'Sc/Arab',
+'sc=armenian' => 'Sc/Armn',
+'sc=armi' => '#/625',
+'sc=armn' => 'Sc/Armn',
+'sc=avestan' => '#/626',
+'sc=avst' => '#/626',
+'sc=bali' => '#/627',
+'sc=balinese' => '#/627',
+'sc=bamu' => '#/628',
+'sc=bamum' => '#/628',
+'sc=bass' => '#/629',
+'sc=bassavah' => '#/629',
+'sc=batak' => '#/630',
+'sc=batk' => '#/630',
+'sc=beng' => 'Sc/Beng',
+'sc=bengali' => 'Sc/Beng',
+'sc=bhaiksuki' => 'Scx/Bhks',
+'sc=bhks' => 'Scx/Bhks',
+'sc=bopo' => '#/588',
+'sc=bopomofo' => '#/588',
+'sc=brah' => '#/631',
+'sc=brahmi' => '#/631',
+'sc=brai' => '#/174',
+'sc=braille' => '#/174',
+'sc=bugi' => '#/589',
+'sc=buginese' => '#/589',
+'sc=buhd' => '#/590',
+'sc=buhid' => '#/590',
+'sc=cakm' => '#/591',
+'sc=canadianaboriginal' => '#/634',
+'sc=cans' => '#/634',
+'sc=cari' => '#/635',
+'sc=carian' => '#/635',
+'sc=caucasianalbanian' => '#/623',
+'sc=chakma' => '#/591',
+'sc=cham' => 'Scx/Cham',
+'sc=cher' => '#/636',
+'sc=cherokee' => '#/636',
+'sc=common' => 'Sc/Zyyy',
+'sc=copt' => '#/592',
+'sc=coptic' => '#/592',
+'sc=cprt' => 'Sc/Cprt',
+'sc=cuneiform' => 'Scx/Xsux',
+'sc=cypriot' => 'Sc/Cprt',
+'sc=cyrillic' => 'Sc/Cyrl',
+'sc=cyrl' => 'Sc/Cyrl',
+'sc=deseret' => '#/181',
+'sc=deva' => 'Sc/Deva',
+'sc=devanagari' => 'Sc/Deva',
+'sc=dogr' => '#/593',
+'sc=dogra' => '#/593',
+'sc=dsrt' => '#/181',
+'sc=dupl' => 'Sc/Dupl',
+'sc=duployan' => 'Sc/Dupl',
+'sc=egyp' => '#/638',
+'sc=egyptianhieroglyphs' => '#/638',
+'sc=elba' => '#/639',
+'sc=elbasan' => '#/639',
+'sc=elym' => '#/640',
+'sc=elymaic' => '#/640',
+'sc=ethi' => 'Scx/Ethi',
+'sc=ethiopic' => 'Scx/Ethi',
+'sc=geor' => 'Sc/Geor',
+'sc=georgian' => 'Sc/Geor',
+'sc=glag' => 'Sc/Glag',
+'sc=glagolitic' => 'Sc/Glag',
+'sc=gong' => 'Sc/Gong',
+'sc=gonm' => 'Sc/Gonm',
+'sc=goth' => '#/641',
+'sc=gothic' => '#/641',
+'sc=gran' => 'Sc/Gran',
+'sc=grantha' => 'Sc/Gran',
+'sc=greek' => 'Sc/Grek',
+'sc=grek' => 'Sc/Grek',
+'sc=gujarati' => 'Sc/Gujr',
+'sc=gujr' => 'Sc/Gujr',
+'sc=gunjalagondi' => 'Sc/Gong',
+'sc=gurmukhi' => 'Sc/Guru',
+'sc=guru' => 'Sc/Guru',
+'sc=han' => 'Sc/Han',
+'sc=hang' => 'Sc/Hang',
+'sc=hangul' => 'Sc/Hang',
+'sc=hani' => 'Sc/Han',
+'sc=hanifirohingya' => '#/609',
+'sc=hano' => '#/594',
+'sc=hanunoo' => '#/594',
+'sc=hatr' => '#/643',
+'sc=hatran' => '#/643',
+'sc=hebr' => 'Scx/Hebr',
+'sc=hebrew' => 'Scx/Hebr',
+'sc=hira' => 'Sc/Hira',
+'sc=hiragana' => 'Sc/Hira',
+'sc=hluw' => '#/644',
+'sc=hmng' => 'Scx/Hmng',
+'sc=hmnp' => 'Scx/Hmnp',
+'sc=hung' => '#/645',
+'sc=imperialaramaic' => '#/625',
+'sc=inherited' => 'Sc/Zinh',
+'sc=inscriptionalpahlavi' => '#/672',
+'sc=inscriptionalparthian' => '#/674',
+'sc=ital' => '#/646',
+'sc=java' => '#/595',
+'sc=javanese' => '#/595',
+'sc=kaithi' => '#/598',
+'sc=kali' => '#/596',
+'sc=kana' => 'Sc/Kana',
+'sc=kannada' => 'Sc/Knda',
+'sc=katakana' => 'Sc/Kana',
+'sc=kayahli' => '#/596',
+'sc=khar' => 'Scx/Khar',
+'sc=kharoshthi' => 'Scx/Khar',
+'sc=khmer' => 'Scx/Khmr',
+'sc=khmr' => 'Scx/Khmr',
+'sc=khoj' => '#/597',
+'sc=khojki' => '#/597',
+'sc=khudawadi' => '#/611',
+'sc=knda' => 'Sc/Knda',
+'sc=kthi' => '#/598',
+'sc=lana' => 'Scx/Lana',
+'sc=lao' => 'Scx/Lao',
+'sc=laoo' => 'Scx/Lao',
+'sc=latin' => 'Sc/Latn',
+'sc=latn' => 'Sc/Latn',
+'sc=lepc' => '#/648',
+'sc=lepcha' => '#/648',
+'sc=limb' => 'Sc/Limb',
+'sc=limbu' => 'Sc/Limb',
+'sc=lina' => '#/599',
+'sc=linb' => 'Sc/Linb',
+'sc=lineara' => '#/599',
+'sc=linearb' => 'Sc/Linb',
+'sc=lisu' => '#/118',
+'sc=lyci' => '#/649',
+'sc=lycian' => '#/649',
+'sc=lydi' => '#/650',
+'sc=lydian' => '#/650',
+'sc=mahajani' => '#/600',
+'sc=mahj' => '#/600',
+'sc=maka' => '#/652',
+'sc=makasar' => '#/652',
+'sc=malayalam' => 'Sc/Mlym',
+'sc=mand' => '#/601',
+'sc=mandaic' => '#/601',
+'sc=mani' => '#/602',
+'sc=manichaean' => '#/602',
+'sc=marc' => '#/655',
+'sc=marchen' => '#/655',
+'sc=masaramgondi' => 'Sc/Gonm',
+'sc=medefaidrin' => '#/656',
+'sc=medf' => '#/656',
+'sc=meeteimayek' => '#/661',
+'sc=mend' => '#/657',
+'sc=mendekikakui' => '#/657',
+'sc=merc' => '#/658',
+'sc=mero' => '#/390',
+'sc=meroiticcursive' => '#/658',
+'sc=meroitichieroglyphs' => '#/390',
+'sc=miao' => '#/659',
+'sc=mlym' => 'Sc/Mlym',
+'sc=modi' => '#/603',
+'sc=mong' => 'Sc/Mong',
+'sc=mongolian' => 'Sc/Mong',
+'sc=mro' => '#/620',
+'sc=mroo' => '#/620',
+'sc=mtei' => '#/661',
+'sc=mult' => 'Sc/Mult',
+'sc=multani' => 'Sc/Mult',
+'sc=myanmar' => '#/604',
+'sc=mymr' => '#/604',
+'sc=nabataean' => '#/662',
+'sc=nand' => '#/605',
+'sc=nandinagari' => '#/605',
+'sc=narb' => '#/360',
+'sc=nbat' => '#/662',
+'sc=newa' => '#/663',
+'sc=newtailue' => 'Scx/Talu',
+'sc=nko' => '#/621',
+'sc=nkoo' => '#/621',
+'sc=nshu' => '#/664',
+'sc=nushu' => '#/664',
+'sc=nyiakengpuachuehmong' => 'Scx/Hmnp',
+'sc=ogam' => '#/665',
+'sc=ogham' => '#/665',
+'sc=olchiki' => '#/196',
+'sc=olck' => '#/196',
+'sc=oldhungarian' => '#/645',
+'sc=olditalic' => '#/646',
+'sc=oldnortharabian' => '#/360',
+'sc=oldpermic' => '#/606',
+'sc=oldpersian' => '#/696',
+'sc=oldsogdian' => '#/682',
+'sc=oldsoutharabian' => '#/361',
+'sc=oldturkic' => '#/666',
+'sc=oriya' => 'Sc/Orya',
+'sc=orkh' => '#/666',
+'sc=orya' => 'Sc/Orya',
+'sc=osage' => '#/667',
+'sc=osge' => '#/667',
+'sc=osma' => '#/668',
+'sc=osmanya' => '#/668',
+'sc=pahawhhmong' => 'Scx/Hmng',
+'sc=palm' => '#/263',
+'sc=palmyrene' => '#/263',
+'sc=pauc' => '#/669',
+'sc=paucinhau' => '#/669',
+'sc=perm' => '#/606',
+'sc=phag' => '#/607',
+'sc=phagspa' => '#/607',
+'sc=phli' => '#/672',
+'sc=phlp' => '#/608',
+'sc=phnx' => '#/673',
+'sc=phoenician' => '#/673',
+'sc=plrd' => '#/659',
+'sc=prti' => '#/674',
+'sc=psalterpahlavi' => '#/608',
+'sc=qaac' => '#/592',
+'sc=qaai' => 'Sc/Zinh',
+'sc=rejang' => '#/675',
+'sc=rjng' => '#/675',
+'sc=rohg' => '#/609',
+'sc=runic' => '#/676',
+'sc=runr' => '#/676',
+'sc=samaritan' => '#/677',
+'sc=samr' => '#/677',
+'sc=sarb' => '#/361',
+'sc=saur' => '#/678',
+'sc=saurashtra' => '#/678',
+'sc=sgnw' => '#/679',
+'sc=sharada' => '#/610',
+'sc=shavian' => '#/200',
+'sc=shaw' => '#/200',
+'sc=shrd' => '#/610',
+'sc=sidd' => '#/680',
+'sc=siddham' => '#/680',
+'sc=signwriting' => '#/679',
+'sc=sind' => '#/611',
+'sc=sinh' => 'Sc/Sinh',
+'sc=sinhala' => 'Sc/Sinh',
+'sc=sogd' => '#/612',
+'sc=sogdian' => '#/612',
+'sc=sogo' => '#/682',
+'sc=sora' => '#/683',
+'sc=sorasompeng' => '#/683',
+'sc=soyo' => '#/684',
+'sc=soyombo' => '#/684',
+'sc=sund' => '#/685',
+'sc=sundanese' => '#/685',
+'sc=sylo' => '#/613',
+'sc=sylotinagri' => '#/613',
+'sc=syrc' => 'Sc/Syrc',
+'sc=syriac' => 'Sc/Syrc',
+'sc=tagalog' => '#/617',
+'sc=tagb' => '#/614',
+'sc=tagbanwa' => '#/614',
+'sc=taile' => '#/616',
+'sc=taitham' => 'Scx/Lana',
+'sc=taiviet' => '#/689',
+'sc=takr' => '#/615',
+'sc=takri' => '#/615',
+'sc=tale' => '#/616',
+'sc=talu' => 'Scx/Talu',
+'sc=tamil' => 'Sc/Taml',
+'sc=taml' => 'Sc/Taml',
+'sc=tang' => '#/688',
+'sc=tangut' => '#/688',
+'sc=tavt' => '#/689',
+'sc=telu' => 'Sc/Telu',
+'sc=telugu' => 'Sc/Telu',
+'sc=tfng' => '#/690',
+'sc=tglg' => '#/617',
+'sc=thaa' => '#/618',
+'sc=thaana' => '#/618',
+'sc=thai' => '#/692',
+'sc=tibetan' => 'Scx/Tibt',
+'sc=tibt' => 'Scx/Tibt',
+'sc=tifinagh' => '#/690',
+'sc=tirh' => '#/619',
+'sc=tirhuta' => '#/619',
+'sc=ugar' => '#/693',
+'sc=ugaritic' => '#/693',
+'sc=unknown' => 'Scx/Zzzz',
+'sc=vai' => '#/622',
+'sc=vaii' => '#/622',
+'sc=wancho' => '#/695',
+'sc=wara' => '#/694',
+'sc=warangciti' => '#/694',
+'sc=wcho' => '#/695',
+'sc=xpeo' => '#/696',
+'sc=xsux' => 'Scx/Xsux',
+'sc=yi' => '#/586',
+'sc=yiii' => '#/586',
+'sc=zanabazarsquare' => '#/697',
+'sc=zanb' => '#/697',
+'sc=zinh' => 'Sc/Zinh',
+'sc=zyyy' => 'Sc/Zyyy',
+'sc=zzzz' => 'Scx/Zzzz',
+'scx=adlam' => 'Scx/Adlm',
+'scx=adlm' => 'Scx/Adlm',
+'scx=aghb' => '#/623',
+'scx=ahom' => '#/624',
+'scx=anatolianhieroglyphs' => '#/644',
+'scx=arab' => 'Scx/Arab',
+'scx=arabic' => 'Scx/Arab',
+'scx=armenian' => 'Scx/Armn',
+'scx=armi' => '#/625',
+'scx=armn' => 'Scx/Armn',
+'scx=avestan' => '#/626',
+'scx=avst' => '#/626',
+'scx=bali' => '#/627',
+'scx=balinese' => '#/627',
+'scx=bamu' => '#/628',
+'scx=bamum' => '#/628',
+'scx=bass' => '#/629',
+'scx=bassavah' => '#/629',
+'scx=batak' => '#/630',
+'scx=batk' => '#/630',
+'scx=beng' => 'Scx/Beng',
+'scx=bengali' => 'Scx/Beng',
+'scx=bhaiksuki' => 'Scx/Bhks',
+'scx=bhks' => 'Scx/Bhks',
+'scx=bopo' => 'Scx/Bopo',
+'scx=bopomofo' => 'Scx/Bopo',
+'scx=brah' => '#/631',
+'scx=brahmi' => '#/631',
+'scx=brai' => '#/174',
+'scx=braille' => '#/174',
+'scx=bugi' => '#/632',
+'scx=buginese' => '#/632',
+'scx=buhd' => '#/633',
+'scx=buhid' => '#/633',
+'scx=cakm' => 'Scx/Cakm',
+'scx=canadianaboriginal' => '#/634',
+'scx=cans' => '#/634',
+'scx=cari' => '#/635',
+'scx=carian' => '#/635',
+'scx=caucasianalbanian' => '#/623',
+'scx=chakma' => 'Scx/Cakm',
+'scx=cham' => 'Scx/Cham',
+'scx=cher' => '#/636',
+'scx=cherokee' => '#/636',
+'scx=common' => 'Scx/Zyyy',
+'scx=copt' => 'Scx/Copt',
+'scx=coptic' => 'Scx/Copt',
+'scx=cprt' => 'Scx/Cprt',
+'scx=cuneiform' => 'Scx/Xsux',
+'scx=cypriot' => 'Scx/Cprt',
+'scx=cyrillic' => 'Scx/Cyrl',
+'scx=cyrl' => 'Scx/Cyrl',
+'scx=deseret' => '#/181',
+'scx=deva' => 'Scx/Deva',
+'scx=devanagari' => 'Scx/Deva',
+'scx=dogr' => '#/637',
+'scx=dogra' => '#/637',
+'scx=dsrt' => '#/181',
+'scx=dupl' => 'Scx/Dupl',
+'scx=duployan' => 'Scx/Dupl',
+'scx=egyp' => '#/638',
+'scx=egyptianhieroglyphs' => '#/638',
+'scx=elba' => '#/639',
+'scx=elbasan' => '#/639',
+'scx=elym' => '#/640',
+'scx=elymaic' => '#/640',
+'scx=ethi' => 'Scx/Ethi',
+'scx=ethiopic' => 'Scx/Ethi',
+'scx=geor' => 'Scx/Geor',
+'scx=georgian' => 'Scx/Geor',
+'scx=glag' => 'Scx/Glag',
+'scx=glagolitic' => 'Scx/Glag',
+'scx=gong' => 'Scx/Gong',
+'scx=gonm' => 'Scx/Gonm',
+'scx=goth' => '#/641',
+'scx=gothic' => '#/641',
+'scx=gran' => 'Scx/Gran',
+'scx=grantha' => 'Scx/Gran',
+'scx=greek' => 'Scx/Grek',
+'scx=grek' => 'Scx/Grek',
+'scx=gujarati' => 'Scx/Gujr',
+'scx=gujr' => 'Scx/Gujr',
+'scx=gunjalagondi' => 'Scx/Gong',
+'scx=gurmukhi' => 'Scx/Guru',
+'scx=guru' => 'Scx/Guru',
+'scx=han' => 'Scx/Han',
+'scx=hang' => 'Scx/Hang',
+'scx=hangul' => 'Scx/Hang',
+'scx=hani' => 'Scx/Han',
+'scx=hanifirohingya' => 'Scx/Rohg',
+'scx=hano' => '#/642',
+'scx=hanunoo' => '#/642',
+'scx=hatr' => '#/643',
+'scx=hatran' => '#/643',
+'scx=hebr' => 'Scx/Hebr',
+'scx=hebrew' => 'Scx/Hebr',
+'scx=hira' => 'Scx/Hira',
+'scx=hiragana' => 'Scx/Hira',
+'scx=hluw' => '#/644',
+'scx=hmng' => 'Scx/Hmng',
+'scx=hmnp' => 'Scx/Hmnp',
+'scx=hung' => '#/645',
+'scx=imperialaramaic' => '#/625',
+'scx=inherited' => 'Scx/Zinh',
+'scx=inscriptionalpahlavi' => '#/672',
+'scx=inscriptionalparthian' => '#/674',
+'scx=ital' => '#/646',
+'scx=java' => '#/647',
+'scx=javanese' => '#/647',
+'scx=kaithi' => 'Scx/Kthi',
+'scx=kali' => '#/188',
+'scx=kana' => 'Scx/Kana',
+'scx=kannada' => 'Scx/Knda',
+'scx=katakana' => 'Scx/Kana',
+'scx=kayahli' => '#/188',
+'scx=khar' => 'Scx/Khar',
+'scx=kharoshthi' => 'Scx/Khar',
+'scx=khmer' => 'Scx/Khmr',
+'scx=khmr' => 'Scx/Khmr',
+'scx=khoj' => 'Scx/Khoj',
+'scx=khojki' => 'Scx/Khoj',
+'scx=khudawadi' => 'Scx/Sind',
+'scx=knda' => 'Scx/Knda',
+'scx=kthi' => 'Scx/Kthi',
+'scx=lana' => 'Scx/Lana',
+'scx=lao' => 'Scx/Lao',
+'scx=laoo' => 'Scx/Lao',
+'scx=latin' => 'Scx/Latn',
+'scx=latn' => 'Scx/Latn',
+'scx=lepc' => '#/648',
+'scx=lepcha' => '#/648',
+'scx=limb' => 'Scx/Limb',
+'scx=limbu' => 'Scx/Limb',
+'scx=lina' => 'Scx/Lina',
+'scx=linb' => 'Scx/Linb',
+'scx=lineara' => 'Scx/Lina',
+'scx=linearb' => 'Scx/Linb',
+'scx=lisu' => '#/118',
+'scx=lyci' => '#/649',
+'scx=lycian' => '#/649',
+'scx=lydi' => '#/650',
+'scx=lydian' => '#/650',
+'scx=mahajani' => '#/651',
+'scx=mahj' => '#/651',
+'scx=maka' => '#/652',
+'scx=makasar' => '#/652',
+'scx=malayalam' => 'Scx/Mlym',
+'scx=mand' => '#/653',
+'scx=mandaic' => '#/653',
+'scx=mani' => '#/654',
+'scx=manichaean' => '#/654',
+'scx=marc' => '#/655',
+'scx=marchen' => '#/655',
+'scx=masaramgondi' => 'Scx/Gonm',
+'scx=medefaidrin' => '#/656',
+'scx=medf' => '#/656',
+'scx=meeteimayek' => '#/661',
+'scx=mend' => '#/657',
+'scx=mendekikakui' => '#/657',
+'scx=merc' => '#/658',
+'scx=mero' => '#/390',
+'scx=meroiticcursive' => '#/658',
+'scx=meroitichieroglyphs' => '#/390',
+'scx=miao' => '#/659',
+'scx=mlym' => 'Scx/Mlym',
+'scx=modi' => '#/660',
+'scx=mong' => 'Scx/Mong',
+'scx=mongolian' => 'Scx/Mong',
+'scx=mro' => '#/620',
+'scx=mroo' => '#/620',
+'scx=mtei' => '#/661',
+'scx=mult' => 'Scx/Mult',
+'scx=multani' => 'Scx/Mult',
+'scx=myanmar' => 'Scx/Mymr',
+'scx=mymr' => 'Scx/Mymr',
+'scx=nabataean' => '#/662',
+'scx=nand' => 'Scx/Nand',
+'scx=nandinagari' => 'Scx/Nand',
+'scx=narb' => '#/360',
+'scx=nbat' => '#/662',
+'scx=newa' => '#/663',
+'scx=newtailue' => 'Scx/Talu',
+'scx=nko' => '#/621',
+'scx=nkoo' => '#/621',
+'scx=nshu' => '#/664',
+'scx=nushu' => '#/664',
+'scx=nyiakengpuachuehmong' => 'Scx/Hmnp',
+'scx=ogam' => '#/665',
+'scx=ogham' => '#/665',
+'scx=olchiki' => '#/196',
+'scx=olck' => '#/196',
+'scx=oldhungarian' => '#/645',
+'scx=olditalic' => '#/646',
+'scx=oldnortharabian' => '#/360',
+'scx=oldpermic' => '#/670',
+'scx=oldpersian' => '#/696',
+'scx=oldsogdian' => '#/682',
+'scx=oldsoutharabian' => '#/361',
+'scx=oldturkic' => '#/666',
+'scx=oriya' => 'Scx/Orya',
+'scx=orkh' => '#/666',
+'scx=orya' => 'Scx/Orya',
+'scx=osage' => '#/667',
+'scx=osge' => '#/667',
+'scx=osma' => '#/668',
+'scx=osmanya' => '#/668',
+'scx=pahawhhmong' => 'Scx/Hmng',
+'scx=palm' => '#/263',
+'scx=palmyrene' => '#/263',
+'scx=pauc' => '#/669',
+'scx=paucinhau' => '#/669',
+'scx=perm' => '#/670',
+'scx=phag' => '#/671',
+'scx=phagspa' => '#/671',
+'scx=phli' => '#/672',
+'scx=phlp' => 'Scx/Phlp',
+'scx=phnx' => '#/673',
+'scx=phoenician' => '#/673',
+'scx=plrd' => '#/659',
+'scx=prti' => '#/674',
+'scx=psalterpahlavi' => 'Scx/Phlp',
+'scx=qaac' => 'Scx/Copt',
+'scx=qaai' => 'Scx/Zinh',
+'scx=rejang' => '#/675',
+'scx=rjng' => '#/675',
+'scx=rohg' => 'Scx/Rohg',
+'scx=runic' => '#/676',
+'scx=runr' => '#/676',
+'scx=samaritan' => '#/677',
+'scx=samr' => '#/677',
+'scx=sarb' => '#/361',
+'scx=saur' => '#/678',
+'scx=saurashtra' => '#/678',
+'scx=sgnw' => '#/679',
+'scx=sharada' => 'Scx/Shrd',
+'scx=shavian' => '#/200',
+'scx=shaw' => '#/200',
+'scx=shrd' => 'Scx/Shrd',
+'scx=sidd' => '#/680',
+'scx=siddham' => '#/680',
+'scx=signwriting' => '#/679',
+'scx=sind' => 'Scx/Sind',
+'scx=sinh' => 'Scx/Sinh',
+'scx=sinhala' => 'Scx/Sinh',
+'scx=sogd' => '#/681',
+'scx=sogdian' => '#/681',
+'scx=sogo' => '#/682',
+'scx=sora' => '#/683',
+'scx=sorasompeng' => '#/683',
+'scx=soyo' => '#/684',
+'scx=soyombo' => '#/684',
+'scx=sund' => '#/685',
+'scx=sundanese' => '#/685',
+'scx=sylo' => '#/686',
+'scx=sylotinagri' => '#/686',
+'scx=syrc' => 'Scx/Syrc',
+'scx=syriac' => 'Scx/Syrc',
+'scx=tagalog' => '#/691',
+'scx=tagb' => 'Scx/Tagb',
+'scx=tagbanwa' => 'Scx/Tagb',
+'scx=taile' => '#/687',
+'scx=taitham' => 'Scx/Lana',
+'scx=taiviet' => '#/689',
+'scx=takr' => 'Scx/Takr',
+'scx=takri' => 'Scx/Takr',
+'scx=tale' => '#/687',
+'scx=talu' => 'Scx/Talu',
+'scx=tamil' => 'Scx/Taml',
+'scx=taml' => 'Scx/Taml',
+'scx=tang' => '#/688',
+'scx=tangut' => '#/688',
+'scx=tavt' => '#/689',
+'scx=telu' => 'Scx/Telu',
+'scx=telugu' => 'Scx/Telu',
+'scx=tfng' => '#/690',
+'scx=tglg' => '#/691',
+'scx=thaa' => 'Scx/Thaa',
+'scx=thaana' => 'Scx/Thaa',
+'scx=thai' => '#/692',
+'scx=tibetan' => 'Scx/Tibt',
+'scx=tibt' => 'Scx/Tibt',
+'scx=tifinagh' => '#/690',
+'scx=tirh' => 'Scx/Tirh',
+'scx=tirhuta' => 'Scx/Tirh',
+'scx=ugar' => '#/693',
+'scx=ugaritic' => '#/693',
+'scx=unknown' => 'Scx/Zzzz',
+'scx=vai' => '#/622',
+'scx=vaii' => '#/622',
+'scx=wancho' => '#/695',
+'scx=wara' => '#/694',
+'scx=warangciti' => '#/694',
+'scx=wcho' => '#/695',
+'scx=xpeo' => '#/696',
+'scx=xsux' => 'Scx/Xsux',
+'scx=yi' => 'Scx/Yi',
+'scx=yiii' => 'Scx/Yi',
+'scx=zanabazarsquare' => '#/697',
+'scx=zanb' => '#/697',
+'scx=zinh' => 'Scx/Zinh',
+'scx=zyyy' => 'Scx/Zyyy',
+'scx=zzzz' => 'Scx/Zzzz',
+'sd' => 'SD/Y',
+'sd=f' => '!SD/Y',
+'sd=false' => '!SD/Y',
+'sd=n' => '!SD/Y',
+'sd=no' => '!SD/Y',
+'sd=t' => 'SD/Y',
+'sd=true' => 'SD/Y',
+'sd=y' => 'SD/Y',
+'sd=yes' => 'SD/Y',
+'sentenceterminal' => 'STerm/Y',
+'separator' => 'Gc/Z',
+'sgnw' => '#/679',
+'sharada' => 'Scx/Shrd',
+'shavian' => '#/200',
+'shaw' => '#/200',
+'shorthandformatcontrols' => '#/402',
+'shrd' => 'Scx/Shrd',
+'sidd' => '#/680',
+'siddham' => '#/680',
+'signwriting' => '#/679',
+'sind' => 'Scx/Sind',
+'sinh' => 'Scx/Sinh',
+'sinhala' => 'Scx/Sinh',
+'sinhalaarchaicnumbers' => '#/397',
+'sk' => 'Gc/Sk',
+'sm' => 'Gc/Sm',
+'smallforms' => '#/284',
+'smallformvariants' => '#/284',
+'smallkanaext' => '#/330',
+'smallkanaextension' => '#/330',
+'so' => 'Gc/So',
+'softdotted' => 'SD/Y',
+'sogd' => '#/681',
+'sogdian' => '#/681',
+'sogo' => '#/682',
+'sora' => '#/683',
+'sorasompeng' => '#/683',
+'soyo' => '#/684',
+'soyombo' => '#/684',
+'space' => 'Perl/SpacePer',
+'spaceperl' => 'Perl/SpacePer',
+'spaceseparator' => 'Gc/Zs',
+'spacingmark' => 'Gc/Mc',
+'spacingmodifierletters' => '#/359',
+'specials' => '#/236',
+'sterm' => 'STerm/Y',
+'sterm=f' => '!STerm/Y',
+'sterm=false' => '!STerm/Y',
+'sterm=n' => '!STerm/Y',
+'sterm=no' => '!STerm/Y',
+'sterm=t' => 'STerm/Y',
+'sterm=true' => 'STerm/Y',
+'sterm=y' => 'STerm/Y',
+'sterm=yes' => 'STerm/Y',
+'sund' => '#/685',
+'sundanese' => '#/685',
+'sundanesesup' => '#/331',
+'sundanesesupplement' => '#/331',
+'suparrowsa' => '#/285',
+'suparrowsb' => '#/286',
+'suparrowsc' => '#/287',
+'superandsub' => '#/311',
+'superscriptsandsubscripts' => '#/311',
+'supmathoperators' => '#/374',
+'supplementalarrowsa' => '#/285',
+'supplementalarrowsb' => '#/286',
+'supplementalarrowsc' => '#/287',
+'supplementalmathematicaloperators' => '#/374',
+'supplementalpunctuation' => '#/350',
+'supplementalsymbolsandpictographs' => '#/403',
+'supplementaryprivateuseareaa' => '#/205',
+'supplementaryprivateuseareab' => '#/206',
+'suppuaa' => '#/205',
+'suppuab' => '#/206',
+'suppunctuation' => '#/350',
+'supsymbolsandpictographs' => '#/403',
+'surrogate' => '#/14',
+'suttonsignwriting' => '#/380',
+'sylo' => '#/686',
+'sylotinagri' => '#/686',
+'symbol' => 'Gc/S',
+'symbolsandpictographsexta' => '#/404',
+'symbolsandpictographsextendeda' => '#/404',
+'syrc' => 'Scx/Syrc',
+'syriac' => 'Scx/Syrc',
+'syriacsup' => '#/267',
+'syriacsupplement' => '#/267',
+'tagalog' => '#/691',
+'tagb' => 'Scx/Tagb',
+'tagbanwa' => 'Scx/Tagb',
+'tags' => '#/123',
+'taile' => '#/687',
+'taitham' => 'Scx/Lana',
+'taiviet' => '#/689',
+'taixuanjing' => '#/313',
+'taixuanjingsymbols' => '#/313',
+'takr' => 'Scx/Takr',
+'takri' => 'Scx/Takr',
+'tale' => '#/687',
+'talu' => 'Scx/Talu',
+'tamil' => 'Scx/Taml',
+'tamilsup' => '#/238',
+'tamilsupplement' => '#/238',
+'taml' => 'Scx/Taml',
+'tang' => '#/688',
+'tangut' => '#/688',
+'tangutcomponents' => '#/375',
+'tavt' => '#/689',
+'telu' => 'Scx/Telu',
+'telugu' => 'Scx/Telu',
+'term' => 'Term/Y',
+'term=f' => '!Term/Y',
+'term=false' => '!Term/Y',
+'term=n' => '!Term/Y',
+'term=no' => '!Term/Y',
+'term=t' => 'Term/Y',
+'term=true' => 'Term/Y',
+'term=y' => 'Term/Y',
+'term=yes' => 'Term/Y',
+'terminalpunctuation' => 'Term/Y',
+'tfng' => '#/690',
+'tglg' => '#/691',
+'thaa' => 'Scx/Thaa',
+'thaana' => 'Scx/Thaa',
+'thai' => '#/692',
+'tibetan' => 'Scx/Tibt',
+'tibt' => 'Scx/Tibt',
+'tifinagh' => '#/690',
+'tirh' => 'Scx/Tirh',
+'tirhuta' => 'Scx/Tirh',
+'title' => 'Perl/Title',
+'titlecase' => 'Perl/Title',
+'titlecaseletter' => 'Perl/Title',
+'transportandmap' => '#/362',
+'transportandmapsymbols' => '#/362',
+'ucas' => '#/125',
+'ucasext' => '#/212',
+'ugar' => '#/693',
+'ugaritic' => '#/693',
+'uideo' => 'UIdeo/Y',
+'uideo=f' => '!UIdeo/Y',
+'uideo=false' => '!UIdeo/Y',
+'uideo=n' => '!UIdeo/Y',
+'uideo=no' => '!UIdeo/Y',
+'uideo=t' => 'UIdeo/Y',
+'uideo=true' => 'UIdeo/Y',
+'uideo=y' => 'UIdeo/Y',
+'uideo=yes' => 'UIdeo/Y',
+'unassigned' => 'Gc/Cn',
+'unicode' => '#/2',
+'unifiedcanadianaboriginalsyllabics' => '#/125',
+'unifiedcanadianaboriginalsyllabicsextended' => '#/212',
+'unifiedideograph' => 'UIdeo/Y',
+'unknown' => 'Scx/Zzzz',
+'upper' => 'Upper/Y',
+'upper=f' => '!Upper/Y',
+'upper=false' => '!Upper/Y',
+'upper=n' => '!Upper/Y',
+'upper=no' => '!Upper/Y',
+'upper=t' => 'Upper/Y',
+'upper=true' => 'Upper/Y',
+'upper=y' => 'Upper/Y',
+'upper=yes' => 'Upper/Y',
+'uppercase' => 'Upper/Y',
+'uppercaseletter' => 'Gc/Lu',
+'vai' => '#/622',
+'vaii' => '#/622',
+'variationselector' => '#/88',
+'variationselectors' => '#/106',
+'variationselectorssupplement' => '#/144',
+'vedicext' => '#/241',
+'vedicextensions' => '#/241',
+'verticalforms' => '#/340',
+'vertspace' => '#/4',
+'vo=r' => 'Vo/R',
+'vo=rotated' => 'Vo/R',
+'vo=tr' => 'Vo/Tr',
+'vo=transformedrotated' => 'Vo/Tr',
+'vo=transformedupright' => 'Vo/Tu',
+'vo=tu' => 'Vo/Tu',
+'vo=u' => 'Vo/U',
+'vo=upright' => 'Vo/U',
+'vs' => '#/88',
+'vs=f' => '#/!88',
+'vs=false' => '#/!88',
+'vs=n' => '#/!88',
+'vs=no' => '#/!88',
+'vs=t' => '#/88',
+'vs=true' => '#/88',
+'vs=y' => '#/88',
+'vs=yes' => '#/88',
+'vssup' => '#/144',
+'wancho' => '#/695',
+'wara' => '#/694',
+'warangciti' => '#/694',
+'wb=aletter' => 'WB/LE',
+'wb=cr' => '#/63',
+'wb=doublequote' => '#/89',
+'wb=dq' => '#/89',
+'wb=eb' => '#/0',
+'wb=ebase' => '#/0',
+'wb=ebasegaz' => '#/0',
+'wb=ebg' => '#/0',
+'wb=em' => '#/0',
+'wb=emodifier' => '#/0',
+'wb=ex' => 'WB/EX',
+'wb=extend' => 'WB/Extend',
+'wb=extendnumlet' => 'WB/EX',
+'wb=fo' => 'WB/FO',
+'wb=format' => 'WB/FO',
+'wb=gaz' => '#/0',
+'wb=glueafterzwj' => '#/0',
+'wb=hebrewletter' => 'WB/HL',
+'wb=hl' => 'WB/HL',
+'wb=ka' => 'WB/KA',
+'wb=katakana' => 'WB/KA',
+'wb=le' => 'WB/LE',
+'wb=lf' => '#/64',
+'wb=mb' => 'WB/MB',
+'wb=midletter' => 'WB/ML',
+'wb=midnum' => 'WB/MN',
+'wb=midnumlet' => 'WB/MB',
+'wb=ml' => 'WB/ML',
+'wb=mn' => 'WB/MN',
+'wb=newline' => '#/90',
+'wb=nl' => '#/90',
+'wb=nu' => 'WB/NU',
+'wb=numeric' => 'WB/NU',
+'wb=other' => 'WB/XX',
+'wb=regionalindicator' => '#/65',
+'wb=ri' => '#/65',
+'wb=singlequote' => '#/91',
+'wb=sq' => '#/91',
+'wb=wsegspace' => 'WB/WSegSpac',
+'wb=xx' => 'WB/XX',
+'wb=zwj' => '#/66',
+'wcho' => '#/695',
+'whitespace' => 'Perl/SpacePer',
+'word' => 'Perl/Word',
+'wspace' => 'Perl/SpacePer',
+'wspace=f' => '!Perl/SpacePer',
+'wspace=false' => '!Perl/SpacePer',
+'wspace=n' => '!Perl/SpacePer',
+'wspace=no' => '!Perl/SpacePer',
+'wspace=t' => 'Perl/SpacePer',
+'wspace=true' => 'Perl/SpacePer',
+'wspace=y' => 'Perl/SpacePer',
+'wspace=yes' => 'Perl/SpacePer',
+'xdigit' => 'Hex/Y',
+'xidc' => 'XIDC/Y',
+'xidc=f' => '!XIDC/Y',
+'xidc=false' => '!XIDC/Y',
+'xidc=n' => '!XIDC/Y',
+'xidc=no' => '!XIDC/Y',
+'xidc=t' => 'XIDC/Y',
+'xidc=true' => 'XIDC/Y',
+'xidc=y' => 'XIDC/Y',
+'xidc=yes' => 'XIDC/Y',
+'xidcontinue' => 'XIDC/Y',
+'xids' => 'XIDS/Y',
+'xids=f' => '!XIDS/Y',
+'xids=false' => '!XIDS/Y',
+'xids=n' => '!XIDS/Y',
+'xids=no' => '!XIDS/Y',
+'xids=t' => 'XIDS/Y',
+'xids=true' => 'XIDS/Y',
+'xids=y' => 'XIDS/Y',
+'xids=yes' => 'XIDS/Y',
+'xidstart' => 'XIDS/Y',
+'xpeo' => '#/696',
+'xperlspace' => 'Perl/SpacePer',
+'xposixalnum' => 'Perl/Alnum',
+'xposixalpha' => 'Alpha/Y',
+'xposixblank' => 'Perl/Blank',
+'xposixcntrl' => '#/409',
+'xposixdigit' => 'Gc/Nd',
+'xposixgraph' => 'Perl/Graph',
+'xposixlower' => 'Lower/Y',
+'xposixprint' => 'Perl/Print',
+'xposixpunct' => 'Perl/XPosixPu',
+'xposixspace' => 'Perl/SpacePer',
+'xposixupper' => 'Upper/Y',
+'xposixword' => 'Perl/Word',
+'xposixxdigit' => 'Hex/Y',
+'xsux' => 'Scx/Xsux',
+'yi' => 'Scx/Yi',
+'yiii' => 'Scx/Yi',
+'yijing' => '#/171',
+'yijinghexagramsymbols' => '#/171',
+'yiradicals' => '#/289',
+'yisyllables' => '#/314',
+'z' => 'Gc/Z',
+'zanabazarsquare' => '#/697',
+'zanb' => '#/697',
+'zinh' => 'Scx/Zinh',
+'zl' => '#/411',
+'zp' => '#/412',
+'zs' => 'Gc/Zs',
+'zyyy' => 'Scx/Zyyy',
+'zzzz' => 'Scx/Zzzz',
+);
+
+# Maps floating point to fractional form
+%utf8::nv_floating_to_rational = (
+'-5.00e-01' => '-1/2',
+'1.00e-01' => '1/10',
+'1.11e-01' => '1/9',
+'1.25e-01' => '1/8',
+'1.25e-02' => '1/80',
+'1.43e-01' => '1/7',
+'1.50e+00' => '3/2',
+'1.50e-01' => '3/20',
+'1.56e-02' => '1/64',
+'1.67e-01' => '1/6',
+'1.88e-01' => '3/16',
+'2.00e-01' => '1/5',
+'2.50e+00' => '5/2',
+'2.50e-01' => '1/4',
+'2.50e-02' => '1/40',
+'3.12e-02' => '1/32',
+'3.13e-02' => '1/32',
+'3.13e-03' => '1/320',
+'3.33e-01' => '1/3',
+'3.50e+00' => '7/2',
+'3.75e-01' => '3/8',
+'3.75e-02' => '3/80',
+'4.00e-01' => '2/5',
+'4.17e-01' => '5/12',
+'4.50e+00' => '9/2',
+'4.69e-02' => '3/64',
+'5.00e-01' => '1/2',
+'5.00e-02' => '1/20',
+'5.50e+00' => '11/2',
+'5.83e-01' => '7/12',
+'6.00e-01' => '3/5',
+'6.25e-01' => '5/8',
+'6.25e-02' => '1/16',
+'6.25e-03' => '1/160',
+'6.50e+00' => '13/2',
+'6.67e-01' => '2/3',
+'7.50e+00' => '15/2',
+'7.50e-01' => '3/4',
+'8.00e-01' => '4/5',
+'8.33e-01' => '5/6',
+'8.33e-02' => '1/12',
+'8.50e+00' => '17/2',
+'8.75e-01' => '7/8',
+'9.17e-01' => '11/12',
+);
+
+# If a %e floating point number doesn't have this number of digits in it after
+# the decimal point to get this close to a fraction, it isn't considered to be
+# that fraction even if all the digits it does have match.
+$utf8::e_precision = 2;
+
+# Deprecated tables to generate a warning for.  The key is the file containing
+# the table, so as to avoid duplication, as many property names can map to the
+# file, but we only need one entry for all of them.
+%utf8::why_deprecated = (
+'#/504' => 'Surrogates should never appear in well-formed text, and therefore shouldn\'t be the basis for line breaking',
+'Hyphen/T' => 'Supplanted by Line_Break property values; see www.unicode.org/reports/tr14',
+);
+
+# A few properties have different behavior under /i matching.  This maps
+# those to substitute files to use under /i.
+%utf8::caseless_equivalent = (
+'gc=ll' => 'Gc/LC',
+'gc=lowercaseletter' => 'Gc/LC',
+'gc=lt' => 'Gc/LC',
+'gc=lu' => 'Gc/LC',
+'gc=titlecaseletter' => 'Gc/LC',
+'gc=uppercaseletter' => 'Gc/LC',
+'isll' => 'Gc/LC',
+'islower' => 'Cased/Y',
+'islowercase' => 'Cased/Y',
+'islowercaseletter' => 'Gc/LC',
+'islt' => 'Gc/LC',
+'islu' => 'Gc/LC',
+'isposixlower' => '#/6',
+'isposixupper' => '#/6',
+'istitle' => 'Cased/Y',
+'istitlecase' => 'Cased/Y',
+'istitlecaseletter' => 'Gc/LC',
+'isupper' => 'Cased/Y',
+'isuppercase' => 'Cased/Y',
+'isuppercaseletter' => 'Gc/LC',
+'isxposixlower' => 'Cased/Y',
+'isxposixupper' => 'Cased/Y',
+'ll' => 'Gc/LC',
+'lower' => 'Cased/Y',
+'lower=f' => '!Cased/Y',
+'lower=false' => '!Cased/Y',
+'lower=n' => '!Cased/Y',
+'lower=no' => '!Cased/Y',
+'lower=t' => 'Cased/Y',
+'lower=true' => 'Cased/Y',
+'lower=y' => 'Cased/Y',
+'lower=yes' => 'Cased/Y',
+'lowercase' => 'Cased/Y',
+'lowercaseletter' => 'Gc/LC',
+'lt' => 'Gc/LC',
+'lu' => 'Gc/LC',
+'posixlower' => '#/6',
+'posixupper' => '#/6',
+'title' => 'Cased/Y',
+'titlecase' => 'Cased/Y',
+'titlecaseletter' => 'Gc/LC',
+'upper' => 'Cased/Y',
+'upper=f' => '!Cased/Y',
+'upper=false' => '!Cased/Y',
+'upper=n' => '!Cased/Y',
+'upper=no' => '!Cased/Y',
+'upper=t' => 'Cased/Y',
+'upper=true' => 'Cased/Y',
+'upper=y' => 'Cased/Y',
+'upper=yes' => 'Cased/Y',
+'uppercase' => 'Cased/Y',
+'uppercaseletter' => 'Gc/LC',
+'xposixlower' => 'Cased/Y',
+'xposixupper' => 'Cased/Y',
+);
+
+# Property names to mapping files
+%utf8::loose_property_to_file_of = (
+'age' => 'To/Age',
+'bc' => 'To/Bc',
+'bidiclass' => 'To/Bc',
+'bidimirroringglyph' => 'To/Bmg',
+'bidipairedbracket' => 'To/Bpb',
+'bidipairedbrackettype' => 'To/Bpt',
+'bmg' => 'To/Bmg',
+'bpb' => 'To/Bpb',
+'bpt' => 'To/Bpt',
+'canonicalcombiningclass' => 'CombiningClass',
+'casefolding' => 'To/Cf',
+'category' => 'To/Gc',
+'ccc' => 'CombiningClass',
+'cf' => 'To/Cf',
+'ea' => 'To/Ea',
+'eastasianwidth' => 'To/Ea',
+'equideo' => 'To/EqUIdeo',
+'equivalentunifiedideograph' => 'To/EqUIdeo',
+'gc' => 'To/Gc',
+'gcb' => 'To/GCB',
+'generalcategory' => 'To/Gc',
+'graphemeclusterbreak' => 'To/GCB',
+'hangulsyllabletype' => 'To/Hst',
+'hst' => 'To/Hst',
+'indicpositionalcategory' => 'To/InPC',
+'indicsyllabiccategory' => 'To/InSC',
+'inpc' => 'To/InPC',
+'insc' => 'To/InSC',
+'isc' => 'To/Isc',
+'isocomment' => 'To/Isc',
+'jg' => 'To/Jg',
+'joininggroup' => 'To/Jg',
+'joiningtype' => 'To/Jt',
+'jt' => 'To/Jt',
+'lb' => 'To/Lb',
+'lc' => 'To/Lc',
+'linebreak' => 'To/Lb',
+'lowercasemapping' => 'To/Lc',
+'na1' => 'To/Na1',
+'namealias' => 'To/NameAlia',
+'nfcqc' => 'To/NFCQC',
+'nfcquickcheck' => 'To/NFCQC',
+'nfdqc' => 'To/NFDQC',
+'nfdquickcheck' => 'To/NFDQC',
+'nfkccasefold' => 'To/NFKCCF',
+'nfkccf' => 'To/NFKCCF',
+'nfkcqc' => 'To/NFKCQC',
+'nfkcquickcheck' => 'To/NFKCQC',
+'nfkdqc' => 'To/NFKDQC',
+'nfkdquickcheck' => 'To/NFKDQC',
+'nt' => 'To/Nt',
+'numerictype' => 'To/Nt',
+'numericvalue' => 'To/Nv',
+'nv' => 'To/Nv',
+'perldecimaldigit' => 'To/PerlDeci',
+'sb' => 'To/SB',
+'sc' => 'To/Sc',
+'script' => 'To/Sc',
+'scriptextensions' => 'To/Scx',
+'scx' => 'To/Scx',
+'sentencebreak' => 'To/SB',
+'tc' => 'To/Tc',
+'titlecasemapping' => 'To/Tc',
+'uc' => 'To/Uc',
+'unicode1name' => 'To/Na1',
+'uppercasemapping' => 'To/Uc',
+'verticalorientation' => 'To/Vo',
+'vo' => 'To/Vo',
+'wb' => 'To/WB',
+'wordbreak' => 'To/WB',
+);
+
+# Property names to mapping files
+%utf8::strict_property_to_file_of = (
+'_perl_gcb' => 'To/GCB',
+'_perl_lb' => 'To/_PerlLB',
+'_perl_name_alias' => 'To/NameAlia',
+'_perl_sb' => 'To/SB',
+'_perl_scx' => 'To/_PerlSCX',
+'_perl_wb' => 'To/WB',
+);
+
+# Files to the swash names within them.
+%utf8::file_to_swash_name = (
+'CombiningClass' => 'ToCombiningClass',
+'To/_PerlLB' => 'To_PerlLB',
+'To/_PerlSCX' => 'To_PerlSCX',
+'To/Age' => 'ToAge',
+'To/Bc' => 'ToBc',
+'To/Bmg' => 'ToBmg',
+'To/Bpb' => 'ToBpb',
+'To/Bpt' => 'ToBpt',
+'To/Cf' => 'ToCf',
+'To/Ea' => 'ToEa',
+'To/EqUIdeo' => 'ToEqUIdeo',
+'To/Gc' => 'ToGc',
+'To/GCB' => 'ToGCB',
+'To/Hst' => 'ToHst',
+'To/InPC' => 'ToInPC',
+'To/InSC' => 'ToInSC',
+'To/Isc' => 'ToIsc',
+'To/Jg' => 'ToJg',
+'To/Jt' => 'ToJt',
+'To/Lb' => 'ToLb',
+'To/Lc' => 'ToLc',
+'To/Na1' => 'ToNa1',
+'To/NameAlia' => 'ToNameAlias',
+'To/NFCQC' => 'ToNFCQC',
+'To/NFDQC' => 'ToNFDQC',
+'To/NFKCCF' => 'ToNFKCCF',
+'To/NFKCQC' => 'ToNFKCQC',
+'To/NFKDQC' => 'ToNFKDQC',
+'To/Nt' => 'ToNt',
+'To/Nv' => 'ToNv',
+'To/PerlDeci' => 'ToPerlDecimalDigit',
+'To/SB' => 'ToSB',
+'To/Sc' => 'ToSc',
+'To/Scx' => 'ToScx',
+'To/Tc' => 'ToTc',
+'To/Uc' => 'ToUc',
+'To/Vo' => 'ToVo',
+'To/WB' => 'ToWB',
+);
+
+1;
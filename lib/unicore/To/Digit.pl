@@ -0,0 +1,654 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   IT IS DEPRECATED TO USE THIS FILE   !!!!!!!
+
+# This file is for internal use by core Perl only.  It is retained for
+# backwards compatibility with applications that may have come to rely on it,
+# but its format and even its name or existence are subject to change without
+# notice in a future Perl version.  Don't use it directly.  Instead, its
+# contents are now retrievable through a stable API in the Unicode::UCD
+# module: Unicode::UCD::prop_invmap('Perl_Decimal_Digit') (Values for individual
+# code points can be retrieved via Unicode::UCD::charprop());
+
+
+
+# The name this swash is to be known by, with the format of the mappings in
+# the main body of the table, and what all code points missing from this file
+# map to.
+$utf8::SwashInfo{'ToDigit'}{'format'} = 'd'; # single decimal digit
+$utf8::SwashInfo{'ToDigit'}{'missing'} = ''; # code point maps to the null string
+
+return <<'END';
+0030		0
+0031		1
+0032		2
+0033		3
+0034		4
+0035		5
+0036		6
+0037		7
+0038		8
+0039		9
+0660		0
+0661		1
+0662		2
+0663		3
+0664		4
+0665		5
+0666		6
+0667		7
+0668		8
+0669		9
+06F0		0
+06F1		1
+06F2		2
+06F3		3
+06F4		4
+06F5		5
+06F6		6
+06F7		7
+06F8		8
+06F9		9
+07C0		0
+07C1		1
+07C2		2
+07C3		3
+07C4		4
+07C5		5
+07C6		6
+07C7		7
+07C8		8
+07C9		9
+0966		0
+0967		1
+0968		2
+0969		3
+096A		4
+096B		5
+096C		6
+096D		7
+096E		8
+096F		9
+09E6		0
+09E7		1
+09E8		2
+09E9		3
+09EA		4
+09EB		5
+09EC		6
+09ED		7
+09EE		8
+09EF		9
+0A66		0
+0A67		1
+0A68		2
+0A69		3
+0A6A		4
+0A6B		5
+0A6C		6
+0A6D		7
+0A6E		8
+0A6F		9
+0AE6		0
+0AE7		1
+0AE8		2
+0AE9		3
+0AEA		4
+0AEB		5
+0AEC		6
+0AED		7
+0AEE		8
+0AEF		9
+0B66		0
+0B67		1
+0B68		2
+0B69		3
+0B6A		4
+0B6B		5
+0B6C		6
+0B6D		7
+0B6E		8
+0B6F		9
+0BE6		0
+0BE7		1
+0BE8		2
+0BE9		3
+0BEA		4
+0BEB		5
+0BEC		6
+0BED		7
+0BEE		8
+0BEF		9
+0C66		0
+0C67		1
+0C68		2
+0C69		3
+0C6A		4
+0C6B		5
+0C6C		6
+0C6D		7
+0C6E		8
+0C6F		9
+0CE6		0
+0CE7		1
+0CE8		2
+0CE9		3
+0CEA		4
+0CEB		5
+0CEC		6
+0CED		7
+0CEE		8
+0CEF		9
+0D66		0
+0D67		1
+0D68		2
+0D69		3
+0D6A		4
+0D6B		5
+0D6C		6
+0D6D		7
+0D6E		8
+0D6F		9
+0DE6		0
+0DE7		1
+0DE8		2
+0DE9		3
+0DEA		4
+0DEB		5
+0DEC		6
+0DED		7
+0DEE		8
+0DEF		9
+0E50		0
+0E51		1
+0E52		2
+0E53		3
+0E54		4
+0E55		5
+0E56		6
+0E57		7
+0E58		8
+0E59		9
+0ED0		0
+0ED1		1
+0ED2		2
+0ED3		3
+0ED4		4
+0ED5		5
+0ED6		6
+0ED7		7
+0ED8		8
+0ED9		9
+0F20		0
+0F21		1
+0F22		2
+0F23		3
+0F24		4
+0F25		5
+0F26		6
+0F27		7
+0F28		8
+0F29		9
+1040		0
+1041		1
+1042		2
+1043		3
+1044		4
+1045		5
+1046		6
+1047		7
+1048		8
+1049		9
+1090		0
+1091		1
+1092		2
+1093		3
+1094		4
+1095		5
+1096		6
+1097		7
+1098		8
+1099		9
+17E0		0
+17E1		1
+17E2		2
+17E3		3
+17E4		4
+17E5		5
+17E6		6
+17E7		7
+17E8		8
+17E9		9
+1810		0
+1811		1
+1812		2
+1813		3
+1814		4
+1815		5
+1816		6
+1817		7
+1818		8
+1819		9
+1946		0
+1947		1
+1948		2
+1949		3
+194A		4
+194B		5
+194C		6
+194D		7
+194E		8
+194F		9
+19D0		0
+19D1		1
+19D2		2
+19D3		3
+19D4		4
+19D5		5
+19D6		6
+19D7		7
+19D8		8
+19D9		9
+1A80		0
+1A81		1
+1A82		2
+1A83		3
+1A84		4
+1A85		5
+1A86		6
+1A87		7
+1A88		8
+1A89		9
+1A90		0
+1A91		1
+1A92		2
+1A93		3
+1A94		4
+1A95		5
+1A96		6
+1A97		7
+1A98		8
+1A99		9
+1B50		0
+1B51		1
+1B52		2
+1B53		3
+1B54		4
+1B55		5
+1B56		6
+1B57		7
+1B58		8
+1B59		9
+1BB0		0
+1BB1		1
+1BB2		2
+1BB3		3
+1BB4		4
+1BB5		5
+1BB6		6
+1BB7		7
+1BB8		8
+1BB9		9
+1C40		0
+1C41		1
+1C42		2
+1C43		3
+1C44		4
+1C45		5
+1C46		6
+1C47		7
+1C48		8
+1C49		9
+1C50		0
+1C51		1
+1C52		2
+1C53		3
+1C54		4
+1C55		5
+1C56		6
+1C57		7
+1C58		8
+1C59		9
+A620		0
+A621		1
+A622		2
+A623		3
+A624		4
+A625		5
+A626		6
+A627		7
+A628		8
+A629		9
+A8D0		0
+A8D1		1
+A8D2		2
+A8D3		3
+A8D4		4
+A8D5		5
+A8D6		6
+A8D7		7
+A8D8		8
+A8D9		9
+A900		0
+A901		1
+A902		2
+A903		3
+A904		4
+A905		5
+A906		6
+A907		7
+A908		8
+A909		9
+A9D0		0
+A9D1		1
+A9D2		2
+A9D3		3
+A9D4		4
+A9D5		5
+A9D6		6
+A9D7		7
+A9D8		8
+A9D9		9
+A9F0		0
+A9F1		1
+A9F2		2
+A9F3		3
+A9F4		4
+A9F5		5
+A9F6		6
+A9F7		7
+A9F8		8
+A9F9		9
+AA50		0
+AA51		1
+AA52		2
+AA53		3
+AA54		4
+AA55		5
+AA56		6
+AA57		7
+AA58		8
+AA59		9
+ABF0		0
+ABF1		1
+ABF2		2
+ABF3		3
+ABF4		4
+ABF5		5
+ABF6		6
+ABF7		7
+ABF8		8
+ABF9		9
+FF10		0
+FF11		1
+FF12		2
+FF13		3
+FF14		4
+FF15		5
+FF16		6
+FF17		7
+FF18		8
+FF19		9
+104A0		0
+104A1		1
+104A2		2
+104A3		3
+104A4		4
+104A5		5
+104A6		6
+104A7		7
+104A8		8
+104A9		9
+10D30		0
+10D31		1
+10D32		2
+10D33		3
+10D34		4
+10D35		5
+10D36		6
+10D37		7
+10D38		8
+10D39		9
+11066		0
+11067		1
+11068		2
+11069		3
+1106A		4
+1106B		5
+1106C		6
+1106D		7
+1106E		8
+1106F		9
+110F0		0
+110F1		1
+110F2		2
+110F3		3
+110F4		4
+110F5		5
+110F6		6
+110F7		7
+110F8		8
+110F9		9
+11136		0
+11137		1
+11138		2
+11139		3
+1113A		4
+1113B		5
+1113C		6
+1113D		7
+1113E		8
+1113F		9
+111D0		0
+111D1		1
+111D2		2
+111D3		3
+111D4		4
+111D5		5
+111D6		6
+111D7		7
+111D8		8
+111D9		9
+112F0		0
+112F1		1
+112F2		2
+112F3		3
+112F4		4
+112F5		5
+112F6		6
+112F7		7
+112F8		8
+112F9		9
+11450		0
+11451		1
+11452		2
+11453		3
+11454		4
+11455		5
+11456		6
+11457		7
+11458		8
+11459		9
+114D0		0
+114D1		1
+114D2		2
+114D3		3
+114D4		4
+114D5		5
+114D6		6
+114D7		7
+114D8		8
+114D9		9
+11650		0
+11651		1
+11652		2
+11653		3
+11654		4
+11655		5
+11656		6
+11657		7
+11658		8
+11659		9
+116C0		0
+116C1		1
+116C2		2
+116C3		3
+116C4		4
+116C5		5
+116C6		6
+116C7		7
+116C8		8
+116C9		9
+11730		0
+11731		1
+11732		2
+11733		3
+11734		4
+11735		5
+11736		6
+11737		7
+11738		8
+11739		9
+118E0		0
+118E1		1
+118E2		2
+118E3		3
+118E4		4
+118E5		5
+118E6		6
+118E7		7
+118E8		8
+118E9		9
+11C50		0
+11C51		1
+11C52		2
+11C53		3
+11C54		4
+11C55		5
+11C56		6
+11C57		7
+11C58		8
+11C59		9
+11D50		0
+11D51		1
+11D52		2
+11D53		3
+11D54		4
+11D55		5
+11D56		6
+11D57		7
+11D58		8
+11D59		9
+11DA0		0
+11DA1		1
+11DA2		2
+11DA3		3
+11DA4		4
+11DA5		5
+11DA6		6
+11DA7		7
+11DA8		8
+11DA9		9
+16A60		0
+16A61		1
+16A62		2
+16A63		3
+16A64		4
+16A65		5
+16A66		6
+16A67		7
+16A68		8
+16A69		9
+16B50		0
+16B51		1
+16B52		2
+16B53		3
+16B54		4
+16B55		5
+16B56		6
+16B57		7
+16B58		8
+16B59		9
+1D7CE		0
+1D7CF		1
+1D7D0		2
+1D7D1		3
+1D7D2		4
+1D7D3		5
+1D7D4		6
+1D7D5		7
+1D7D6		8
+1D7D7		9
+1D7D8		0
+1D7D9		1
+1D7DA		2
+1D7DB		3
+1D7DC		4
+1D7DD		5
+1D7DE		6
+1D7DF		7
+1D7E0		8
+1D7E1		9
+1D7E2		0
+1D7E3		1
+1D7E4		2
+1D7E5		3
+1D7E6		4
+1D7E7		5
+1D7E8		6
+1D7E9		7
+1D7EA		8
+1D7EB		9
+1D7EC		0
+1D7ED		1
+1D7EE		2
+1D7EF		3
+1D7F0		4
+1D7F1		5
+1D7F2		6
+1D7F3		7
+1D7F4		8
+1D7F5		9
+1D7F6		0
+1D7F7		1
+1D7F8		2
+1D7F9		3
+1D7FA		4
+1D7FB		5
+1D7FC		6
+1D7FD		7
+1D7FE		8
+1D7FF		9
+1E140		0
+1E141		1
+1E142		2
+1E143		3
+1E144		4
+1E145		5
+1E146		6
+1E147		7
+1E148		8
+1E149		9
+1E2F0		0
+1E2F1		1
+1E2F2		2
+1E2F3		3
+1E2F4		4
+1E2F5		5
+1E2F6		6
+1E2F7		7
+1E2F8		8
+1E2F9		9
+1E950		0
+1E951		1
+1E952		2
+1E953		3
+1E954		4
+1E955		5
+1E956		6
+1E957		7
+1E958		8
+1E959		9
+END
@@ -0,0 +1,327 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+
+# The name this swash is to be known by, with the format of the mappings in
+# the main body of the table, and what all code points missing from this file
+# map to.
+$utf8::SwashInfo{'ToEa'}{'format'} = 's'; # string
+$utf8::SwashInfo{'ToEa'}{'missing'} = 'Neutral';
+
+return <<'END';
+20	7E	Na
+A1		A
+A2	A3	Na
+A4		A
+A5	A6	Na
+A7	A8	A
+AA		A
+AC		Na
+AD	AE	A
+AF		Na
+B0	B4	A
+B6	BA	A
+BC	BF	A
+C6		A
+D0		A
+D7	D8	A
+DE	E1	A
+E6		A
+E8	EA	A
+EC	ED	A
+F0		A
+F2	F3	A
+F7	FA	A
+FC		A
+FE		A
+101		A
+111		A
+113		A
+11B		A
+126	127	A
+12B		A
+131	133	A
+138		A
+13F	142	A
+144		A
+148	14B	A
+14D		A
+152	153	A
+166	167	A
+16B		A
+1CE		A
+1D0		A
+1D2		A
+1D4		A
+1D6		A
+1D8		A
+1DA		A
+1DC		A
+251		A
+261		A
+2C4		A
+2C7		A
+2C9	2CB	A
+2CD		A
+2D0		A
+2D8	2DB	A
+2DD		A
+2DF		A
+300	36F	A
+391	3A1	A
+3A3	3A9	A
+3B1	3C1	A
+3C3	3C9	A
+401		A
+410	44F	A
+451		A
+1100	115F	W
+2010		A
+2013	2016	A
+2018	2019	A
+201C	201D	A
+2020	2022	A
+2024	2027	A
+2030		A
+2032	2033	A
+2035		A
+203B		A
+203E		A
+2074		A
+207F		A
+2081	2084	A
+20A9		H
+20AC		A
+2103		A
+2105		A
+2109		A
+2113		A
+2116		A
+2121	2122	A
+2126		A
+212B		A
+2153	2154	A
+215B	215E	A
+2160	216B	A
+2170	2179	A
+2189		A
+2190	2199	A
+21B8	21B9	A
+21D2		A
+21D4		A
+21E7		A
+2200		A
+2202	2203	A
+2207	2208	A
+220B		A
+220F		A
+2211		A
+2215		A
+221A		A
+221D	2220	A
+2223		A
+2225		A
+2227	222C	A
+222E		A
+2234	2237	A
+223C	223D	A
+2248		A
+224C		A
+2252		A
+2260	2261	A
+2264	2267	A
+226A	226B	A
+226E	226F	A
+2282	2283	A
+2286	2287	A
+2295		A
+2299		A
+22A5		A
+22BF		A
+2312		A
+231A	231B	W
+2329	232A	W
+23E9	23EC	W
+23F0		W
+23F3		W
+2460	24E9	A
+24EB	254B	A
+2550	2573	A
+2580	258F	A
+2592	2595	A
+25A0	25A1	A
+25A3	25A9	A
+25B2	25B3	A
+25B6	25B7	A
+25BC	25BD	A
+25C0	25C1	A
+25C6	25C8	A
+25CB		A
+25CE	25D1	A
+25E2	25E5	A
+25EF		A
+25FD	25FE	W
+2605	2606	A
+2609		A
+260E	260F	A
+2614	2615	W
+261C		A
+261E		A
+2640		A
+2642		A
+2648	2653	W
+2660	2661	A
+2663	2665	A
+2667	266A	A
+266C	266D	A
+266F		A
+267F		W
+2693		W
+269E	269F	A
+26A1		W
+26AA	26AB	W
+26BD	26BE	W
+26BF		A
+26C4	26C5	W
+26C6	26CD	A
+26CE		W
+26CF	26D3	A
+26D4		W
+26D5	26E1	A
+26E3		A
+26E8	26E9	A
+26EA		W
+26EB	26F1	A
+26F2	26F3	W
+26F4		A
+26F5		W
+26F6	26F9	A
+26FA		W
+26FB	26FC	A
+26FD		W
+26FE	26FF	A
+2705		W
+270A	270B	W
+2728		W
+273D		A
+274C		W
+274E		W
+2753	2755	W
+2757		W
+2776	277F	A
+2795	2797	W
+27B0		W
+27BF		W
+27E6	27ED	Na
+2985	2986	Na
+2B1B	2B1C	W
+2B50		W
+2B55		W
+2B56	2B59	A
+2E80	2E99	W
+2E9B	2EF3	W
+2F00	2FD5	W
+2FF0	2FFB	W
+3000		F
+3001	303E	W
+3041	3096	W
+3099	30FF	W
+3105	312F	W
+3131	318E	W
+3190	31BA	W
+31C0	31E3	W
+31F0	321E	W
+3220	3247	W
+3248	324F	A
+3250	4DBF	W
+4E00	A48C	W
+A490	A4C6	W
+A960	A97C	W
+AC00	D7A3	W
+E000	F8FF	A
+F900	FAFF	W
+FE00	FE0F	A
+FE10	FE19	W
+FE30	FE52	W
+FE54	FE66	W
+FE68	FE6B	W
+FF01	FF60	F
+FF61	FFBE	H
+FFC2	FFC7	H
+FFCA	FFCF	H
+FFD2	FFD7	H
+FFDA	FFDC	H
+FFE0	FFE6	F
+FFE8	FFEE	H
+FFFD		A
+16FE0	16FE3	W
+17000	187F7	W
+18800	18AF2	W
+1B000	1B11E	W
+1B150	1B152	W
+1B164	1B167	W
+1B170	1B2FB	W
+1F004		W
+1F0CF		W
+1F100	1F10A	A
+1F110	1F12D	A
+1F130	1F169	A
+1F170	1F18D	A
+1F18E		W
+1F18F	1F190	A
+1F191	1F19A	W
+1F19B	1F1AC	A
+1F200	1F202	W
+1F210	1F23B	W
+1F240	1F248	W
+1F250	1F251	W
+1F260	1F265	W
+1F300	1F320	W
+1F32D	1F335	W
+1F337	1F37C	W
+1F37E	1F393	W
+1F3A0	1F3CA	W
+1F3CF	1F3D3	W
+1F3E0	1F3F0	W
+1F3F4		W
+1F3F8	1F43E	W
+1F440		W
+1F442	1F4FC	W
+1F4FF	1F53D	W
+1F54B	1F54E	W
+1F550	1F567	W
+1F57A		W
+1F595	1F596	W
+1F5A4		W
+1F5FB	1F64F	W
+1F680	1F6C5	W
+1F6CC		W
+1F6D0	1F6D2	W
+1F6D5		W
+1F6EB	1F6EC	W
+1F6F4	1F6FA	W
+1F7E0	1F7EB	W
+1F90D	1F971	W
+1F973	1F976	W
+1F97A	1F9A2	W
+1F9A5	1F9AA	W
+1F9AE	1F9CA	W
+1F9CD	1F9FF	W
+1FA70	1FA73	W
+1FA78	1FA7A	W
+1FA80	1FA82	W
+1FA90	1FA95	W
+20000	2FFFD	W
+30000	3FFFD	W
+E0100	E01EF	A
+F0000	FFFFD	A
+100000	10FFFD	A
+END
@@ -0,0 +1,2722 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+
+# The name this swash is to be known by, with the format of the mappings in
+# the main body of the table, and what all code points missing from this file
+# map to.
+$utf8::SwashInfo{'ToLb'}{'format'} = 's'; # string
+$utf8::SwashInfo{'ToLb'}{'missing'} = 'Unknown';
+
+return <<'END';
+0	8	CM
+9		BA
+A		LF
+B	C	BK
+D		CR
+E	1F	CM
+20		SP
+21		EX
+22		QU
+23		AL
+24		PR
+25		PO
+26		AL
+27		QU
+28		OP
+29		CP
+2A		AL
+2B		PR
+2C		IS
+2D		HY
+2E		IS
+2F		SY
+30	39	NU
+3A	3B	IS
+3C	3E	AL
+3F		EX
+40	5A	AL
+5B		OP
+5C		PR
+5D		CP
+5E	7A	AL
+7B		OP
+7C		BA
+7D		CL
+7E		AL
+7F	84	CM
+85		NL
+86	9F	CM
+A0		GL
+A1		OP
+A2		PO
+A3	A5	PR
+A6		AL
+A7	A8	AI
+A9		AL
+AA		AI
+AB		QU
+AC		AL
+AD		BA
+AE	AF	AL
+B0		PO
+B1		PR
+B2	B3	AI
+B4		BB
+B5		AL
+B6	BA	AI
+BB		QU
+BC	BE	AI
+BF		OP
+C0	D6	AL
+D7		AI
+D8	F6	AL
+F7		AI
+F8	2C6	AL
+2C7		AI
+2C8		BB
+2C9	2CB	AI
+2CC		BB
+2CD		AI
+2CE	2CF	AL
+2D0		AI
+2D1	2D7	AL
+2D8	2DB	AI
+2DC		AL
+2DD		AI
+2DE		AL
+2DF		BB
+2E0	2FF	AL
+300	34E	CM
+34F		GL
+350	35B	CM
+35C	362	GL
+363	36F	CM
+370	377	AL
+37A	37D	AL
+37E		IS
+37F		AL
+384	38A	AL
+38C		AL
+38E	3A1	AL
+3A3	482	AL
+483	489	CM
+48A	52F	AL
+531	556	AL
+559	588	AL
+589		IS
+58A		BA
+58D	58E	AL
+58F		PR
+591	5BD	CM
+5BE		BA
+5BF		CM
+5C0		AL
+5C1	5C2	CM
+5C3		AL
+5C4	5C5	CM
+5C6		EX
+5C7		CM
+5D0	5EA	HL
+5EF	5F2	HL
+5F3	5F4	AL
+600	608	AL
+609	60B	PO
+60C	60D	IS
+60E	60F	AL
+610	61A	CM
+61B		EX
+61C		CM
+61E	61F	EX
+620	64A	AL
+64B	65F	CM
+660	669	NU
+66A		PO
+66B	66C	NU
+66D	66F	AL
+670		CM
+671	6D3	AL
+6D4		EX
+6D5		AL
+6D6	6DC	CM
+6DD	6DE	AL
+6DF	6E4	CM
+6E5	6E6	AL
+6E7	6E8	CM
+6E9		AL
+6EA	6ED	CM
+6EE	6EF	AL
+6F0	6F9	NU
+6FA	70D	AL
+70F	710	AL
+711		CM
+712	72F	AL
+730	74A	CM
+74D	7A5	AL
+7A6	7B0	CM
+7B1		AL
+7C0	7C9	NU
+7CA	7EA	AL
+7EB	7F3	CM
+7F4	7F7	AL
+7F8		IS
+7F9		EX
+7FA		AL
+7FD		CM
+7FE	7FF	PR
+800	815	AL
+816	819	CM
+81A		AL
+81B	823	CM
+824		AL
+825	827	CM
+828		AL
+829	82D	CM
+830	83E	AL
+840	858	AL
+859	85B	CM
+85E		AL
+860	86A	AL
+8A0	8B4	AL
+8B6	8BD	AL
+8D3	8E1	CM
+8E2		AL
+8E3	903	CM
+904	939	AL
+93A	93C	CM
+93D		AL
+93E	94F	CM
+950		AL
+951	957	CM
+958	961	AL
+962	963	CM
+964	965	BA
+966	96F	NU
+970	980	AL
+981	983	CM
+985	98C	AL
+98F	990	AL
+993	9A8	AL
+9AA	9B0	AL
+9B2		AL
+9B6	9B9	AL
+9BC		CM
+9BD		AL
+9BE	9C4	CM
+9C7	9C8	CM
+9CB	9CD	CM
+9CE		AL
+9D7		CM
+9DC	9DD	AL
+9DF	9E1	AL
+9E2	9E3	CM
+9E6	9EF	NU
+9F0	9F1	AL
+9F2	9F3	PO
+9F4	9F8	AL
+9F9		PO
+9FA		AL
+9FB		PR
+9FC	9FD	AL
+9FE		CM
+A01	A03	CM
+A05	A0A	AL
+A0F	A10	AL
+A13	A28	AL
+A2A	A30	AL
+A32	A33	AL
+A35	A36	AL
+A38	A39	AL
+A3C		CM
+A3E	A42	CM
+A47	A48	CM
+A4B	A4D	CM
+A51		CM
+A59	A5C	AL
+A5E		AL
+A66	A6F	NU
+A70	A71	CM
+A72	A74	AL
+A75		CM
+A76		AL
+A81	A83	CM
+A85	A8D	AL
+A8F	A91	AL
+A93	AA8	AL
+AAA	AB0	AL
+AB2	AB3	AL
+AB5	AB9	AL
+ABC		CM
+ABD		AL
+ABE	AC5	CM
+AC7	AC9	CM
+ACB	ACD	CM
+AD0		AL
+AE0	AE1	AL
+AE2	AE3	CM
+AE6	AEF	NU
+AF0		AL
+AF1		PR
+AF9		AL
+AFA	AFF	CM
+B01	B03	CM
+B05	B0C	AL
+B0F	B10	AL
+B13	B28	AL
+B2A	B30	AL
+B32	B33	AL
+B35	B39	AL
+B3C		CM
+B3D		AL
+B3E	B44	CM
+B47	B48	CM
+B4B	B4D	CM
+B56	B57	CM
+B5C	B5D	AL
+B5F	B61	AL
+B62	B63	CM
+B66	B6F	NU
+B70	B77	AL
+B82		CM
+B83		AL
+B85	B8A	AL
+B8E	B90	AL
+B92	B95	AL
+B99	B9A	AL
+B9C		AL
+B9E	B9F	AL
+BA3	BA4	AL
+BA8	BAA	AL
+BAE	BB9	AL
+BBE	BC2	CM
+BC6	BC8	CM
+BCA	BCD	CM
+BD0		AL
+BD7		CM
+BE6	BEF	NU
+BF0	BF8	AL
+BF9		PR
+BFA		AL
+C00	C04	CM
+C05	C0C	AL
+C0E	C10	AL
+C12	C28	AL
+C2A	C39	AL
+C3D		AL
+C3E	C44	CM
+C46	C48	CM
+C4A	C4D	CM
+C55	C56	CM
+C58	C5A	AL
+C60	C61	AL
+C62	C63	CM
+C66	C6F	NU
+C77		BB
+C78	C80	AL
+C81	C83	CM
+C84		BB
+C85	C8C	AL
+C8E	C90	AL
+C92	CA8	AL
+CAA	CB3	AL
+CB5	CB9	AL
+CBC		CM
+CBD		AL
+CBE	CC4	CM
+CC6	CC8	CM
+CCA	CCD	CM
+CD5	CD6	CM
+CDE		AL
+CE0	CE1	AL
+CE2	CE3	CM
+CE6	CEF	NU
+CF1	CF2	AL
+D00	D03	CM
+D05	D0C	AL
+D0E	D10	AL
+D12	D3A	AL
+D3B	D3C	CM
+D3D		AL
+D3E	D44	CM
+D46	D48	CM
+D4A	D4D	CM
+D4E	D4F	AL
+D54	D56	AL
+D57		CM
+D58	D61	AL
+D62	D63	CM
+D66	D6F	NU
+D70	D78	AL
+D79		PO
+D7A	D7F	AL
+D82	D83	CM
+D85	D96	AL
+D9A	DB1	AL
+DB3	DBB	AL
+DBD		AL
+DC0	DC6	AL
+DCA		CM
+DCF	DD4	CM
+DD6		CM
+DD8	DDF	CM
+DE6	DEF	NU
+DF2	DF3	CM
+DF4		AL
+E01	E3A	SA
+E3F		PR
+E40	E4E	SA
+E4F		AL
+E50	E59	NU
+E5A	E5B	BA
+E81	E82	SA
+E84		SA
+E86	E8A	SA
+E8C	EA3	SA
+EA5		SA
+EA7	EBD	SA
+EC0	EC4	SA
+EC6		SA
+EC8	ECD	SA
+ED0	ED9	NU
+EDC	EDF	SA
+F00		AL
+F01	F04	BB
+F05		AL
+F06	F07	BB
+F08		GL
+F09	F0A	BB
+F0B		BA
+F0C		GL
+F0D	F11	EX
+F12		GL
+F13		AL
+F14		EX
+F15	F17	AL
+F18	F19	CM
+F1A	F1F	AL
+F20	F29	NU
+F2A	F33	AL
+F34		BA
+F35		CM
+F36		AL
+F37		CM
+F38		AL
+F39		CM
+F3A		OP
+F3B		CL
+F3C		OP
+F3D		CL
+F3E	F3F	CM
+F40	F47	AL
+F49	F6C	AL
+F71	F7E	CM
+F7F		BA
+F80	F84	CM
+F85		BA
+F86	F87	CM
+F88	F8C	AL
+F8D	F97	CM
+F99	FBC	CM
+FBE	FBF	BA
+FC0	FC5	AL
+FC6		CM
+FC7	FCC	AL
+FCE	FCF	AL
+FD0	FD1	BB
+FD2		BA
+FD3		BB
+FD4	FD8	AL
+FD9	FDA	GL
+1000	103F	SA
+1040	1049	NU
+104A	104B	BA
+104C	104F	AL
+1050	108F	SA
+1090	1099	NU
+109A	109F	SA
+10A0	10C5	AL
+10C7		AL
+10CD		AL
+10D0	10FF	AL
+1100	115F	JL
+1160	11A7	JV
+11A8	11FF	JT
+1200	1248	AL
+124A	124D	AL
+1250	1256	AL
+1258		AL
+125A	125D	AL
+1260	1288	AL
+128A	128D	AL
+1290	12B0	AL
+12B2	12B5	AL
+12B8	12BE	AL
+12C0		AL
+12C2	12C5	AL
+12C8	12D6	AL
+12D8	1310	AL
+1312	1315	AL
+1318	135A	AL
+135D	135F	CM
+1360		AL
+1361		BA
+1362	137C	AL
+1380	1399	AL
+13A0	13F5	AL
+13F8	13FD	AL
+1400		BA
+1401	167F	AL
+1680		BA
+1681	169A	AL
+169B		OP
+169C		CL
+16A0	16EA	AL
+16EB	16ED	BA
+16EE	16F8	AL
+1700	170C	AL
+170E	1711	AL
+1712	1714	CM
+1720	1731	AL
+1732	1734	CM
+1735	1736	BA
+1740	1751	AL
+1752	1753	CM
+1760	176C	AL
+176E	1770	AL
+1772	1773	CM
+1780	17D3	SA
+17D4	17D5	BA
+17D6		NS
+17D7		SA
+17D8		BA
+17D9		AL
+17DA		BA
+17DB		PR
+17DC	17DD	SA
+17E0	17E9	NU
+17F0	17F9	AL
+1800	1801	AL
+1802	1803	EX
+1804	1805	BA
+1806		BB
+1807		AL
+1808	1809	EX
+180A		AL
+180B	180D	CM
+180E		GL
+1810	1819	NU
+1820	1878	AL
+1880	1884	AL
+1885	1886	CM
+1887	18A8	AL
+18A9		CM
+18AA		AL
+18B0	18F5	AL
+1900	191E	AL
+1920	192B	CM
+1930	193B	CM
+1940		AL
+1944	1945	EX
+1946	194F	NU
+1950	196D	SA
+1970	1974	SA
+1980	19AB	SA
+19B0	19C9	SA
+19D0	19D9	NU
+19DA		SA
+19DE	19DF	SA
+19E0	1A16	AL
+1A17	1A1B	CM
+1A1E	1A1F	AL
+1A20	1A5E	SA
+1A60	1A7C	SA
+1A7F		CM
+1A80	1A89	NU
+1A90	1A99	NU
+1AA0	1AAD	SA
+1AB0	1ABE	CM
+1B00	1B04	CM
+1B05	1B33	AL
+1B34	1B44	CM
+1B45	1B4B	AL
+1B50	1B59	NU
+1B5A	1B5B	BA
+1B5C		AL
+1B5D	1B60	BA
+1B61	1B6A	AL
+1B6B	1B73	CM
+1B74	1B7C	AL
+1B80	1B82	CM
+1B83	1BA0	AL
+1BA1	1BAD	CM
+1BAE	1BAF	AL
+1BB0	1BB9	NU
+1BBA	1BE5	AL
+1BE6	1BF3	CM
+1BFC	1C23	AL
+1C24	1C37	CM
+1C3B	1C3F	BA
+1C40	1C49	NU
+1C4D	1C4F	AL
+1C50	1C59	NU
+1C5A	1C7D	AL
+1C7E	1C7F	BA
+1C80	1C88	AL
+1C90	1CBA	AL
+1CBD	1CC7	AL
+1CD0	1CD2	CM
+1CD3		AL
+1CD4	1CE8	CM
+1CE9	1CEC	AL
+1CED		CM
+1CEE	1CF3	AL
+1CF4		CM
+1CF5	1CF6	AL
+1CF7	1CF9	CM
+1CFA		AL
+1D00	1DBF	AL
+1DC0	1DF9	CM
+1DFB	1DFF	CM
+1E00	1F15	AL
+1F18	1F1D	AL
+1F20	1F45	AL
+1F48	1F4D	AL
+1F50	1F57	AL
+1F59		AL
+1F5B		AL
+1F5D		AL
+1F5F	1F7D	AL
+1F80	1FB4	AL
+1FB6	1FC4	AL
+1FC6	1FD3	AL
+1FD6	1FDB	AL
+1FDD	1FEF	AL
+1FF2	1FF4	AL
+1FF6	1FFC	AL
+1FFD		BB
+1FFE		AL
+2000	2006	BA
+2007		GL
+2008	200A	BA
+200B		ZW
+200C		CM
+200D		ZWJ
+200E	200F	CM
+2010		BA
+2011		GL
+2012	2013	BA
+2014		B2
+2015	2016	AI
+2017		AL
+2018	2019	QU
+201A		OP
+201B	201D	QU
+201E		OP
+201F		QU
+2020	2021	AI
+2022	2023	AL
+2024	2026	IN
+2027		BA
+2028	2029	BK
+202A	202E	CM
+202F		GL
+2030	2037	PO
+2038		AL
+2039	203A	QU
+203B		AI
+203C	203D	NS
+203E	2043	AL
+2044		IS
+2045		OP
+2046		CL
+2047	2049	NS
+204A	2055	AL
+2056		BA
+2057		AL
+2058	205B	BA
+205C		AL
+205D	205F	BA
+2060		WJ
+2061	2064	AL
+2066	206F	CM
+2070	2071	AL
+2074		AI
+2075	207C	AL
+207D		OP
+207E		CL
+207F		AI
+2080		AL
+2081	2084	AI
+2085	208C	AL
+208D		OP
+208E		CL
+2090	209C	AL
+20A0	20A6	PR
+20A7		PO
+20A8	20B5	PR
+20B6		PO
+20B7	20BA	PR
+20BB		PO
+20BC	20BD	PR
+20BE		PO
+20BF	20CF	PR
+20D0	20F0	CM
+2100	2102	AL
+2103		PO
+2104		AL
+2105		AI
+2106	2108	AL
+2109		PO
+210A	2112	AL
+2113		AI
+2114	2115	AL
+2116		PR
+2117	2120	AL
+2121	2122	AI
+2123	212A	AL
+212B		AI
+212C	2153	AL
+2154	2155	AI
+2156	215A	AL
+215B		AI
+215C	215D	AL
+215E		AI
+215F		AL
+2160	216B	AI
+216C	216F	AL
+2170	2179	AI
+217A	2188	AL
+2189		AI
+218A	218B	AL
+2190	2199	AI
+219A	21D1	AL
+21D2		AI
+21D3		AL
+21D4		AI
+21D5	21FF	AL
+2200		AI
+2201		AL
+2202	2203	AI
+2204	2206	AL
+2207	2208	AI
+2209	220A	AL
+220B		AI
+220C	220E	AL
+220F		AI
+2210		AL
+2211		AI
+2212	2213	PR
+2214		AL
+2215		AI
+2216	2219	AL
+221A		AI
+221B	221C	AL
+221D	2220	AI
+2221	2222	AL
+2223		AI
+2224		AL
+2225		AI
+2226		AL
+2227	222C	AI
+222D		AL
+222E		AI
+222F	2233	AL
+2234	2237	AI
+2238	223B	AL
+223C	223D	AI
+223E	2247	AL
+2248		AI
+2249	224B	AL
+224C		AI
+224D	2251	AL
+2252		AI
+2253	225F	AL
+2260	2261	AI
+2262	2263	AL
+2264	2267	AI
+2268	2269	AL
+226A	226B	AI
+226C	226D	AL
+226E	226F	AI
+2270	2281	AL
+2282	2283	AI
+2284	2285	AL
+2286	2287	AI
+2288	2294	AL
+2295		AI
+2296	2298	AL
+2299		AI
+229A	22A4	AL
+22A5		AI
+22A6	22BE	AL
+22BF		AI
+22C0	22EE	AL
+22EF		IN
+22F0	2307	AL
+2308		OP
+2309		CL
+230A		OP
+230B		CL
+230C	2311	AL
+2312		AI
+2313	2319	AL
+231A	231B	ID
+231C	2328	AL
+2329		OP
+232A		CL
+232B	23EF	AL
+23F0	23F3	ID
+23F4	2426	AL
+2440	244A	AL
+2460	24FE	AI
+24FF		AL
+2500	254B	AI
+254C	254F	AL
+2550	2574	AI
+2575	257F	AL
+2580	258F	AI
+2590	2591	AL
+2592	2595	AI
+2596	259F	AL
+25A0	25A1	AI
+25A2		AL
+25A3	25A9	AI
+25AA	25B1	AL
+25B2	25B3	AI
+25B4	25B5	AL
+25B6	25B7	AI
+25B8	25BB	AL
+25BC	25BD	AI
+25BE	25BF	AL
+25C0	25C1	AI
+25C2	25C5	AL
+25C6	25C8	AI
+25C9	25CA	AL
+25CB		AI
+25CC	25CD	AL
+25CE	25D1	AI
+25D2	25E1	AL
+25E2	25E5	AI
+25E6	25EE	AL
+25EF		AI
+25F0	25FF	AL
+2600	2603	ID
+2604		AL
+2605	2606	AI
+2607	2608	AL
+2609		AI
+260A	260D	AL
+260E	260F	AI
+2610	2613	AL
+2614	2615	ID
+2616	2617	AI
+2618		ID
+2619		AL
+261A	261C	ID
+261D		EB
+261E	261F	ID
+2620	2638	AL
+2639	263B	ID
+263C	263F	AL
+2640		AI
+2641		AL
+2642		AI
+2643	265F	AL
+2660	2661	AI
+2662		AL
+2663	2665	AI
+2666		AL
+2667		AI
+2668		ID
+2669	266A	AI
+266B		AL
+266C	266D	AI
+266E		AL
+266F		AI
+2670	267E	AL
+267F		ID
+2680	269D	AL
+269E	269F	AI
+26A0	26BC	AL
+26BD	26C8	ID
+26C9	26CC	AI
+26CD		ID
+26CE		AL
+26CF	26D1	ID
+26D2		AI
+26D3	26D4	ID
+26D5	26D7	AI
+26D8	26D9	ID
+26DA	26DB	AI
+26DC		ID
+26DD	26DE	AI
+26DF	26E1	ID
+26E2		AL
+26E3		AI
+26E4	26E7	AL
+26E8	26E9	AI
+26EA		ID
+26EB	26F0	AI
+26F1	26F5	ID
+26F6		AI
+26F7	26F8	ID
+26F9		EB
+26FA		ID
+26FB	26FC	AI
+26FD	2704	ID
+2705	2707	AL
+2708	2709	ID
+270A	270D	EB
+270E	2756	AL
+2757		AI
+2758	275A	AL
+275B	2760	QU
+2761		AL
+2762	2763	EX
+2764		ID
+2765	2767	AL
+2768		OP
+2769		CL
+276A		OP
+276B		CL
+276C		OP
+276D		CL
+276E		OP
+276F		CL
+2770		OP
+2771		CL
+2772		OP
+2773		CL
+2774		OP
+2775		CL
+2776	2793	AI
+2794	27C4	AL
+27C5		OP
+27C6		CL
+27C7	27E5	AL
+27E6		OP
+27E7		CL
+27E8		OP
+27E9		CL
+27EA		OP
+27EB		CL
+27EC		OP
+27ED		CL
+27EE		OP
+27EF		CL
+27F0	2982	AL
+2983		OP
+2984		CL
+2985		OP
+2986		CL
+2987		OP
+2988		CL
+2989		OP
+298A		CL
+298B		OP
+298C		CL
+298D		OP
+298E		CL
+298F		OP
+2990		CL
+2991		OP
+2992		CL
+2993		OP
+2994		CL
+2995		OP
+2996		CL
+2997		OP
+2998		CL
+2999	29D7	AL
+29D8		OP
+29D9		CL
+29DA		OP
+29DB		CL
+29DC	29FB	AL
+29FC		OP
+29FD		CL
+29FE	2B54	AL
+2B55	2B59	AI
+2B5A	2B73	AL
+2B76	2B95	AL
+2B98	2C2E	AL
+2C30	2C5E	AL
+2C60	2CEE	AL
+2CEF	2CF1	CM
+2CF2	2CF3	AL
+2CF9		EX
+2CFA	2CFC	BA
+2CFD		AL
+2CFE		EX
+2CFF		BA
+2D00	2D25	AL
+2D27		AL
+2D2D		AL
+2D30	2D67	AL
+2D6F		AL
+2D70		BA
+2D7F		CM
+2D80	2D96	AL
+2DA0	2DA6	AL
+2DA8	2DAE	AL
+2DB0	2DB6	AL
+2DB8	2DBE	AL
+2DC0	2DC6	AL
+2DC8	2DCE	AL
+2DD0	2DD6	AL
+2DD8	2DDE	AL
+2DE0	2DFF	CM
+2E00	2E0D	QU
+2E0E	2E15	BA
+2E16		AL
+2E17		BA
+2E18		OP
+2E19		BA
+2E1A	2E1B	AL
+2E1C	2E1D	QU
+2E1E	2E1F	AL
+2E20	2E21	QU
+2E22		OP
+2E23		CL
+2E24		OP
+2E25		CL
+2E26		OP
+2E27		CL
+2E28		OP
+2E29		CL
+2E2A	2E2D	BA
+2E2E		EX
+2E2F		AL
+2E30	2E31	BA
+2E32		AL
+2E33	2E34	BA
+2E35	2E39	AL
+2E3A	2E3B	B2
+2E3C	2E3E	BA
+2E3F		AL
+2E40	2E41	BA
+2E42		OP
+2E43	2E4A	BA
+2E4B		AL
+2E4C		BA
+2E4D		AL
+2E4E	2E4F	BA
+2E80	2E99	ID
+2E9B	2EF3	ID
+2F00	2FD5	ID
+2FF0	2FFB	ID
+3000		BA
+3001	3002	CL
+3003	3004	ID
+3005		NS
+3006	3007	ID
+3008		OP
+3009		CL
+300A		OP
+300B		CL
+300C		OP
+300D		CL
+300E		OP
+300F		CL
+3010		OP
+3011		CL
+3012	3013	ID
+3014		OP
+3015		CL
+3016		OP
+3017		CL
+3018		OP
+3019		CL
+301A		OP
+301B		CL
+301C		NS
+301D		OP
+301E	301F	CL
+3020	3029	ID
+302A	302F	CM
+3030	3034	ID
+3035		CM
+3036	303A	ID
+303B	303C	NS
+303D	303F	ID
+3041		CJ
+3042		ID
+3043		CJ
+3044		ID
+3045		CJ
+3046		ID
+3047		CJ
+3048		ID
+3049		CJ
+304A	3062	ID
+3063		CJ
+3064	3082	ID
+3083		CJ
+3084		ID
+3085		CJ
+3086		ID
+3087		CJ
+3088	308D	ID
+308E		CJ
+308F	3094	ID
+3095	3096	CJ
+3099	309A	CM
+309B	309E	NS
+309F		ID
+30A0		NS
+30A1		CJ
+30A2		ID
+30A3		CJ
+30A4		ID
+30A5		CJ
+30A6		ID
+30A7		CJ
+30A8		ID
+30A9		CJ
+30AA	30C2	ID
+30C3		CJ
+30C4	30E2	ID
+30E3		CJ
+30E4		ID
+30E5		CJ
+30E6		ID
+30E7		CJ
+30E8	30ED	ID
+30EE		CJ
+30EF	30F4	ID
+30F5	30F6	CJ
+30F7	30FA	ID
+30FB		NS
+30FC		CJ
+30FD	30FE	NS
+30FF		ID
+3105	312F	ID
+3131	318E	ID
+3190	31BA	ID
+31C0	31E3	ID
+31F0	31FF	CJ
+3200	321E	ID
+3220	3247	ID
+3248	324F	AI
+3250	4DBF	ID
+4DC0	4DFF	AL
+4E00	A014	ID
+A015		NS
+A016	A48C	ID
+A490	A4C6	ID
+A4D0	A4FD	AL
+A4FE	A4FF	BA
+A500	A60C	AL
+A60D		BA
+A60E		EX
+A60F		BA
+A610	A61F	AL
+A620	A629	NU
+A62A	A62B	AL
+A640	A66E	AL
+A66F	A672	CM
+A673		AL
+A674	A67D	CM
+A67E	A69D	AL
+A69E	A69F	CM
+A6A0	A6EF	AL
+A6F0	A6F1	CM
+A6F2		AL
+A6F3	A6F7	BA
+A700	A7BF	AL
+A7C2	A7C6	AL
+A7F7	A801	AL
+A802		CM
+A803	A805	AL
+A806		CM
+A807	A80A	AL
+A80B		CM
+A80C	A822	AL
+A823	A827	CM
+A828	A82B	AL
+A830	A837	AL
+A838		PO
+A839		AL
+A840	A873	AL
+A874	A875	BB
+A876	A877	EX
+A880	A881	CM
+A882	A8B3	AL
+A8B4	A8C5	CM
+A8CE	A8CF	BA
+A8D0	A8D9	NU
+A8E0	A8F1	CM
+A8F2	A8FB	AL
+A8FC		BB
+A8FD	A8FE	AL
+A8FF		CM
+A900	A909	NU
+A90A	A925	AL
+A926	A92D	CM
+A92E	A92F	BA
+A930	A946	AL
+A947	A953	CM
+A95F		AL
+A960	A97C	JL
+A980	A983	CM
+A984	A9B2	AL
+A9B3	A9C0	CM
+A9C1	A9C6	AL
+A9C7	A9C9	BA
+A9CA	A9CD	AL
+A9CF		AL
+A9D0	A9D9	NU
+A9DE	A9DF	AL
+A9E0	A9EF	SA
+A9F0	A9F9	NU
+A9FA	A9FE	SA
+AA00	AA28	AL
+AA29	AA36	CM
+AA40	AA42	AL
+AA43		CM
+AA44	AA4B	AL
+AA4C	AA4D	CM
+AA50	AA59	NU
+AA5C		AL
+AA5D	AA5F	BA
+AA60	AAC2	SA
+AADB	AADF	SA
+AAE0	AAEA	AL
+AAEB	AAEF	CM
+AAF0	AAF1	BA
+AAF2	AAF4	AL
+AAF5	AAF6	CM
+AB01	AB06	AL
+AB09	AB0E	AL
+AB11	AB16	AL
+AB20	AB26	AL
+AB28	AB2E	AL
+AB30	AB67	AL
+AB70	ABE2	AL
+ABE3	ABEA	CM
+ABEB		BA
+ABEC	ABED	CM
+ABF0	ABF9	NU
+AC00		H2
+AC01	AC1B	H3
+AC1C		H2
+AC1D	AC37	H3
+AC38		H2
+AC39	AC53	H3
+AC54		H2
+AC55	AC6F	H3
+AC70		H2
+AC71	AC8B	H3
+AC8C		H2
+AC8D	ACA7	H3
+ACA8		H2
+ACA9	ACC3	H3
+ACC4		H2
+ACC5	ACDF	H3
+ACE0		H2
+ACE1	ACFB	H3
+ACFC		H2
+ACFD	AD17	H3
+AD18		H2
+AD19	AD33	H3
+AD34		H2
+AD35	AD4F	H3
+AD50		H2
+AD51	AD6B	H3
+AD6C		H2
+AD6D	AD87	H3
+AD88		H2
+AD89	ADA3	H3
+ADA4		H2
+ADA5	ADBF	H3
+ADC0		H2
+ADC1	ADDB	H3
+ADDC		H2
+ADDD	ADF7	H3
+ADF8		H2
+ADF9	AE13	H3
+AE14		H2
+AE15	AE2F	H3
+AE30		H2
+AE31	AE4B	H3
+AE4C		H2
+AE4D	AE67	H3
+AE68		H2
+AE69	AE83	H3
+AE84		H2
+AE85	AE9F	H3
+AEA0		H2
+AEA1	AEBB	H3
+AEBC		H2
+AEBD	AED7	H3
+AED8		H2
+AED9	AEF3	H3
+AEF4		H2
+AEF5	AF0F	H3
+AF10		H2
+AF11	AF2B	H3
+AF2C		H2
+AF2D	AF47	H3
+AF48		H2
+AF49	AF63	H3
+AF64		H2
+AF65	AF7F	H3
+AF80		H2
+AF81	AF9B	H3
+AF9C		H2
+AF9D	AFB7	H3
+AFB8		H2
+AFB9	AFD3	H3
+AFD4		H2
+AFD5	AFEF	H3
+AFF0		H2
+AFF1	B00B	H3
+B00C		H2
+B00D	B027	H3
+B028		H2
+B029	B043	H3
+B044		H2
+B045	B05F	H3
+B060		H2
+B061	B07B	H3
+B07C		H2
+B07D	B097	H3
+B098		H2
+B099	B0B3	H3
+B0B4		H2
+B0B5	B0CF	H3
+B0D0		H2
+B0D1	B0EB	H3
+B0EC		H2
+B0ED	B107	H3
+B108		H2
+B109	B123	H3
+B124		H2
+B125	B13F	H3
+B140		H2
+B141	B15B	H3
+B15C		H2
+B15D	B177	H3
+B178		H2
+B179	B193	H3
+B194		H2
+B195	B1AF	H3
+B1B0		H2
+B1B1	B1CB	H3
+B1CC		H2
+B1CD	B1E7	H3
+B1E8		H2
+B1E9	B203	H3
+B204		H2
+B205	B21F	H3
+B220		H2
+B221	B23B	H3
+B23C		H2
+B23D	B257	H3
+B258		H2
+B259	B273	H3
+B274		H2
+B275	B28F	H3
+B290		H2
+B291	B2AB	H3
+B2AC		H2
+B2AD	B2C7	H3
+B2C8		H2
+B2C9	B2E3	H3
+B2E4		H2
+B2E5	B2FF	H3
+B300		H2
+B301	B31B	H3
+B31C		H2
+B31D	B337	H3
+B338		H2
+B339	B353	H3
+B354		H2
+B355	B36F	H3
+B370		H2
+B371	B38B	H3
+B38C		H2
+B38D	B3A7	H3
+B3A8		H2
+B3A9	B3C3	H3
+B3C4		H2
+B3C5	B3DF	H3
+B3E0		H2
+B3E1	B3FB	H3
+B3FC		H2
+B3FD	B417	H3
+B418		H2
+B419	B433	H3
+B434		H2
+B435	B44F	H3
+B450		H2
+B451	B46B	H3
+B46C		H2
+B46D	B487	H3
+B488		H2
+B489	B4A3	H3
+B4A4		H2
+B4A5	B4BF	H3
+B4C0		H2
+B4C1	B4DB	H3
+B4DC		H2
+B4DD	B4F7	H3
+B4F8		H2
+B4F9	B513	H3
+B514		H2
+B515	B52F	H3
+B530		H2
+B531	B54B	H3
+B54C		H2
+B54D	B567	H3
+B568		H2
+B569	B583	H3
+B584		H2
+B585	B59F	H3
+B5A0		H2
+B5A1	B5BB	H3
+B5BC		H2
+B5BD	B5D7	H3
+B5D8		H2
+B5D9	B5F3	H3
+B5F4		H2
+B5F5	B60F	H3
+B610		H2
+B611	B62B	H3
+B62C		H2
+B62D	B647	H3
+B648		H2
+B649	B663	H3
+B664		H2
+B665	B67F	H3
+B680		H2
+B681	B69B	H3
+B69C		H2
+B69D	B6B7	H3
+B6B8		H2
+B6B9	B6D3	H3
+B6D4		H2
+B6D5	B6EF	H3
+B6F0		H2
+B6F1	B70B	H3
+B70C		H2
+B70D	B727	H3
+B728		H2
+B729	B743	H3
+B744		H2
+B745	B75F	H3
+B760		H2
+B761	B77B	H3
+B77C		H2
+B77D	B797	H3
+B798		H2
+B799	B7B3	H3
+B7B4		H2
+B7B5	B7CF	H3
+B7D0		H2
+B7D1	B7EB	H3
+B7EC		H2
+B7ED	B807	H3
+B808		H2
+B809	B823	H3
+B824		H2
+B825	B83F	H3
+B840		H2
+B841	B85B	H3
+B85C		H2
+B85D	B877	H3
+B878		H2
+B879	B893	H3
+B894		H2
+B895	B8AF	H3
+B8B0		H2
+B8B1	B8CB	H3
+B8CC		H2
+B8CD	B8E7	H3
+B8E8		H2
+B8E9	B903	H3
+B904		H2
+B905	B91F	H3
+B920		H2
+B921	B93B	H3
+B93C		H2
+B93D	B957	H3
+B958		H2
+B959	B973	H3
+B974		H2
+B975	B98F	H3
+B990		H2
+B991	B9AB	H3
+B9AC		H2
+B9AD	B9C7	H3
+B9C8		H2
+B9C9	B9E3	H3
+B9E4		H2
+B9E5	B9FF	H3
+BA00		H2
+BA01	BA1B	H3
+BA1C		H2
+BA1D	BA37	H3
+BA38		H2
+BA39	BA53	H3
+BA54		H2
+BA55	BA6F	H3
+BA70		H2
+BA71	BA8B	H3
+BA8C		H2
+BA8D	BAA7	H3
+BAA8		H2
+BAA9	BAC3	H3
+BAC4		H2
+BAC5	BADF	H3
+BAE0		H2
+BAE1	BAFB	H3
+BAFC		H2
+BAFD	BB17	H3
+BB18		H2
+BB19	BB33	H3
+BB34		H2
+BB35	BB4F	H3
+BB50		H2
+BB51	BB6B	H3
+BB6C		H2
+BB6D	BB87	H3
+BB88		H2
+BB89	BBA3	H3
+BBA4		H2
+BBA5	BBBF	H3
+BBC0		H2
+BBC1	BBDB	H3
+BBDC		H2
+BBDD	BBF7	H3
+BBF8		H2
+BBF9	BC13	H3
+BC14		H2
+BC15	BC2F	H3
+BC30		H2
+BC31	BC4B	H3
+BC4C		H2
+BC4D	BC67	H3
+BC68		H2
+BC69	BC83	H3
+BC84		H2
+BC85	BC9F	H3
+BCA0		H2
+BCA1	BCBB	H3
+BCBC		H2
+BCBD	BCD7	H3
+BCD8		H2
+BCD9	BCF3	H3
+BCF4		H2
+BCF5	BD0F	H3
+BD10		H2
+BD11	BD2B	H3
+BD2C		H2
+BD2D	BD47	H3
+BD48		H2
+BD49	BD63	H3
+BD64		H2
+BD65	BD7F	H3
+BD80		H2
+BD81	BD9B	H3
+BD9C		H2
+BD9D	BDB7	H3
+BDB8		H2
+BDB9	BDD3	H3
+BDD4		H2
+BDD5	BDEF	H3
+BDF0		H2
+BDF1	BE0B	H3
+BE0C		H2
+BE0D	BE27	H3
+BE28		H2
+BE29	BE43	H3
+BE44		H2
+BE45	BE5F	H3
+BE60		H2
+BE61	BE7B	H3
+BE7C		H2
+BE7D	BE97	H3
+BE98		H2
+BE99	BEB3	H3
+BEB4		H2
+BEB5	BECF	H3
+BED0		H2
+BED1	BEEB	H3
+BEEC		H2
+BEED	BF07	H3
+BF08		H2
+BF09	BF23	H3
+BF24		H2
+BF25	BF3F	H3
+BF40		H2
+BF41	BF5B	H3
+BF5C		H2
+BF5D	BF77	H3
+BF78		H2
+BF79	BF93	H3
+BF94		H2
+BF95	BFAF	H3
+BFB0		H2
+BFB1	BFCB	H3
+BFCC		H2
+BFCD	BFE7	H3
+BFE8		H2
+BFE9	C003	H3
+C004		H2
+C005	C01F	H3
+C020		H2
+C021	C03B	H3
+C03C		H2
+C03D	C057	H3
+C058		H2
+C059	C073	H3
+C074		H2
+C075	C08F	H3
+C090		H2
+C091	C0AB	H3
+C0AC		H2
+C0AD	C0C7	H3
+C0C8		H2
+C0C9	C0E3	H3
+C0E4		H2
+C0E5	C0FF	H3
+C100		H2
+C101	C11B	H3
+C11C		H2
+C11D	C137	H3
+C138		H2
+C139	C153	H3
+C154		H2
+C155	C16F	H3
+C170		H2
+C171	C18B	H3
+C18C		H2
+C18D	C1A7	H3
+C1A8		H2
+C1A9	C1C3	H3
+C1C4		H2
+C1C5	C1DF	H3
+C1E0		H2
+C1E1	C1FB	H3
+C1FC		H2
+C1FD	C217	H3
+C218		H2
+C219	C233	H3
+C234		H2
+C235	C24F	H3
+C250		H2
+C251	C26B	H3
+C26C		H2
+C26D	C287	H3
+C288		H2
+C289	C2A3	H3
+C2A4		H2
+C2A5	C2BF	H3
+C2C0		H2
+C2C1	C2DB	H3
+C2DC		H2
+C2DD	C2F7	H3
+C2F8		H2
+C2F9	C313	H3
+C314		H2
+C315	C32F	H3
+C330		H2
+C331	C34B	H3
+C34C		H2
+C34D	C367	H3
+C368		H2
+C369	C383	H3
+C384		H2
+C385	C39F	H3
+C3A0		H2
+C3A1	C3BB	H3
+C3BC		H2
+C3BD	C3D7	H3
+C3D8		H2
+C3D9	C3F3	H3
+C3F4		H2
+C3F5	C40F	H3
+C410		H2
+C411	C42B	H3
+C42C		H2
+C42D	C447	H3
+C448		H2
+C449	C463	H3
+C464		H2
+C465	C47F	H3
+C480		H2
+C481	C49B	H3
+C49C		H2
+C49D	C4B7	H3
+C4B8		H2
+C4B9	C4D3	H3
+C4D4		H2
+C4D5	C4EF	H3
+C4F0		H2
+C4F1	C50B	H3
+C50C		H2
+C50D	C527	H3
+C528		H2
+C529	C543	H3
+C544		H2
+C545	C55F	H3
+C560		H2
+C561	C57B	H3
+C57C		H2
+C57D	C597	H3
+C598		H2
+C599	C5B3	H3
+C5B4		H2
+C5B5	C5CF	H3
+C5D0		H2
+C5D1	C5EB	H3
+C5EC		H2
+C5ED	C607	H3
+C608		H2
+C609	C623	H3
+C624		H2
+C625	C63F	H3
+C640		H2
+C641	C65B	H3
+C65C		H2
+C65D	C677	H3
+C678		H2
+C679	C693	H3
+C694		H2
+C695	C6AF	H3
+C6B0		H2
+C6B1	C6CB	H3
+C6CC		H2
+C6CD	C6E7	H3
+C6E8		H2
+C6E9	C703	H3
+C704		H2
+C705	C71F	H3
+C720		H2
+C721	C73B	H3
+C73C		H2
+C73D	C757	H3
+C758		H2
+C759	C773	H3
+C774		H2
+C775	C78F	H3
+C790		H2
+C791	C7AB	H3
+C7AC		H2
+C7AD	C7C7	H3
+C7C8		H2
+C7C9	C7E3	H3
+C7E4		H2
+C7E5	C7FF	H3
+C800		H2
+C801	C81B	H3
+C81C		H2
+C81D	C837	H3
+C838		H2
+C839	C853	H3
+C854		H2
+C855	C86F	H3
+C870		H2
+C871	C88B	H3
+C88C		H2
+C88D	C8A7	H3
+C8A8		H2
+C8A9	C8C3	H3
+C8C4		H2
+C8C5	C8DF	H3
+C8E0		H2
+C8E1	C8FB	H3
+C8FC		H2
+C8FD	C917	H3
+C918		H2
+C919	C933	H3
+C934		H2
+C935	C94F	H3
+C950		H2
+C951	C96B	H3
+C96C		H2
+C96D	C987	H3
+C988		H2
+C989	C9A3	H3
+C9A4		H2
+C9A5	C9BF	H3
+C9C0		H2
+C9C1	C9DB	H3
+C9DC		H2
+C9DD	C9F7	H3
+C9F8		H2
+C9F9	CA13	H3
+CA14		H2
+CA15	CA2F	H3
+CA30		H2
+CA31	CA4B	H3
+CA4C		H2
+CA4D	CA67	H3
+CA68		H2
+CA69	CA83	H3
+CA84		H2
+CA85	CA9F	H3
+CAA0		H2
+CAA1	CABB	H3
+CABC		H2
+CABD	CAD7	H3
+CAD8		H2
+CAD9	CAF3	H3
+CAF4		H2
+CAF5	CB0F	H3
+CB10		H2
+CB11	CB2B	H3
+CB2C		H2
+CB2D	CB47	H3
+CB48		H2
+CB49	CB63	H3
+CB64		H2
+CB65	CB7F	H3
+CB80		H2
+CB81	CB9B	H3
+CB9C		H2
+CB9D	CBB7	H3
+CBB8		H2
+CBB9	CBD3	H3
+CBD4		H2
+CBD5	CBEF	H3
+CBF0		H2
+CBF1	CC0B	H3
+CC0C		H2
+CC0D	CC27	H3
+CC28		H2
+CC29	CC43	H3
+CC44		H2
+CC45	CC5F	H3
+CC60		H2
+CC61	CC7B	H3
+CC7C		H2
+CC7D	CC97	H3
+CC98		H2
+CC99	CCB3	H3
+CCB4		H2
+CCB5	CCCF	H3
+CCD0		H2
+CCD1	CCEB	H3
+CCEC		H2
+CCED	CD07	H3
+CD08		H2
+CD09	CD23	H3
+CD24		H2
+CD25	CD3F	H3
+CD40		H2
+CD41	CD5B	H3
+CD5C		H2
+CD5D	CD77	H3
+CD78		H2
+CD79	CD93	H3
+CD94		H2
+CD95	CDAF	H3
+CDB0		H2
+CDB1	CDCB	H3
+CDCC		H2
+CDCD	CDE7	H3
+CDE8		H2
+CDE9	CE03	H3
+CE04		H2
+CE05	CE1F	H3
+CE20		H2
+CE21	CE3B	H3
+CE3C		H2
+CE3D	CE57	H3
+CE58		H2
+CE59	CE73	H3
+CE74		H2
+CE75	CE8F	H3
+CE90		H2
+CE91	CEAB	H3
+CEAC		H2
+CEAD	CEC7	H3
+CEC8		H2
+CEC9	CEE3	H3
+CEE4		H2
+CEE5	CEFF	H3
+CF00		H2
+CF01	CF1B	H3
+CF1C		H2
+CF1D	CF37	H3
+CF38		H2
+CF39	CF53	H3
+CF54		H2
+CF55	CF6F	H3
+CF70		H2
+CF71	CF8B	H3
+CF8C		H2
+CF8D	CFA7	H3
+CFA8		H2
+CFA9	CFC3	H3
+CFC4		H2
+CFC5	CFDF	H3
+CFE0		H2
+CFE1	CFFB	H3
+CFFC		H2
+CFFD	D017	H3
+D018		H2
+D019	D033	H3
+D034		H2
+D035	D04F	H3
+D050		H2
+D051	D06B	H3
+D06C		H2
+D06D	D087	H3
+D088		H2
+D089	D0A3	H3
+D0A4		H2
+D0A5	D0BF	H3
+D0C0		H2
+D0C1	D0DB	H3
+D0DC		H2
+D0DD	D0F7	H3
+D0F8		H2
+D0F9	D113	H3
+D114		H2
+D115	D12F	H3
+D130		H2
+D131	D14B	H3
+D14C		H2
+D14D	D167	H3
+D168		H2
+D169	D183	H3
+D184		H2
+D185	D19F	H3
+D1A0		H2
+D1A1	D1BB	H3
+D1BC		H2
+D1BD	D1D7	H3
+D1D8		H2
+D1D9	D1F3	H3
+D1F4		H2
+D1F5	D20F	H3
+D210		H2
+D211	D22B	H3
+D22C		H2
+D22D	D247	H3
+D248		H2
+D249	D263	H3
+D264		H2
+D265	D27F	H3
+D280		H2
+D281	D29B	H3
+D29C		H2
+D29D	D2B7	H3
+D2B8		H2
+D2B9	D2D3	H3
+D2D4		H2
+D2D5	D2EF	H3
+D2F0		H2
+D2F1	D30B	H3
+D30C		H2
+D30D	D327	H3
+D328		H2
+D329	D343	H3
+D344		H2
+D345	D35F	H3
+D360		H2
+D361	D37B	H3
+D37C		H2
+D37D	D397	H3
+D398		H2
+D399	D3B3	H3
+D3B4		H2
+D3B5	D3CF	H3
+D3D0		H2
+D3D1	D3EB	H3
+D3EC		H2
+D3ED	D407	H3
+D408		H2
+D409	D423	H3
+D424		H2
+D425	D43F	H3
+D440		H2
+D441	D45B	H3
+D45C		H2
+D45D	D477	H3
+D478		H2
+D479	D493	H3
+D494		H2
+D495	D4AF	H3
+D4B0		H2
+D4B1	D4CB	H3
+D4CC		H2
+D4CD	D4E7	H3
+D4E8		H2
+D4E9	D503	H3
+D504		H2
+D505	D51F	H3
+D520		H2
+D521	D53B	H3
+D53C		H2
+D53D	D557	H3
+D558		H2
+D559	D573	H3
+D574		H2
+D575	D58F	H3
+D590		H2
+D591	D5AB	H3
+D5AC		H2
+D5AD	D5C7	H3
+D5C8		H2
+D5C9	D5E3	H3
+D5E4		H2
+D5E5	D5FF	H3
+D600		H2
+D601	D61B	H3
+D61C		H2
+D61D	D637	H3
+D638		H2
+D639	D653	H3
+D654		H2
+D655	D66F	H3
+D670		H2
+D671	D68B	H3
+D68C		H2
+D68D	D6A7	H3
+D6A8		H2
+D6A9	D6C3	H3
+D6C4		H2
+D6C5	D6DF	H3
+D6E0		H2
+D6E1	D6FB	H3
+D6FC		H2
+D6FD	D717	H3
+D718		H2
+D719	D733	H3
+D734		H2
+D735	D74F	H3
+D750		H2
+D751	D76B	H3
+D76C		H2
+D76D	D787	H3
+D788		H2
+D789	D7A3	H3
+D7B0	D7C6	JV
+D7CB	D7FB	JT
+D800	DFFF	SG
+F900	FAFF	ID
+FB00	FB06	AL
+FB13	FB17	AL
+FB1D		HL
+FB1E		CM
+FB1F	FB28	HL
+FB29		AL
+FB2A	FB36	HL
+FB38	FB3C	HL
+FB3E		HL
+FB40	FB41	HL
+FB43	FB44	HL
+FB46	FB4F	HL
+FB50	FBC1	AL
+FBD3	FD3D	AL
+FD3E		CL
+FD3F		OP
+FD50	FD8F	AL
+FD92	FDC7	AL
+FDF0	FDFB	AL
+FDFC		PO
+FDFD		AL
+FE00	FE0F	CM
+FE10		IS
+FE11	FE12	CL
+FE13	FE14	IS
+FE15	FE16	EX
+FE17		OP
+FE18		CL
+FE19		IN
+FE20	FE2F	CM
+FE30	FE34	ID
+FE35		OP
+FE36		CL
+FE37		OP
+FE38		CL
+FE39		OP
+FE3A		CL
+FE3B		OP
+FE3C		CL
+FE3D		OP
+FE3E		CL
+FE3F		OP
+FE40		CL
+FE41		OP
+FE42		CL
+FE43		OP
+FE44		CL
+FE45	FE46	ID
+FE47		OP
+FE48		CL
+FE49	FE4F	ID
+FE50		CL
+FE51		ID
+FE52		CL
+FE54	FE55	NS
+FE56	FE57	EX
+FE58		ID
+FE59		OP
+FE5A		CL
+FE5B		OP
+FE5C		CL
+FE5D		OP
+FE5E		CL
+FE5F	FE66	ID
+FE68		ID
+FE69		PR
+FE6A		PO
+FE6B		ID
+FE70	FE74	AL
+FE76	FEFC	AL
+FEFF		WJ
+FF01		EX
+FF02	FF03	ID
+FF04		PR
+FF05		PO
+FF06	FF07	ID
+FF08		OP
+FF09		CL
+FF0A	FF0B	ID
+FF0C		CL
+FF0D		ID
+FF0E		CL
+FF0F	FF19	ID
+FF1A	FF1B	NS
+FF1C	FF1E	ID
+FF1F		EX
+FF20	FF3A	ID
+FF3B		OP
+FF3C		ID
+FF3D		CL
+FF3E	FF5A	ID
+FF5B		OP
+FF5C		ID
+FF5D		CL
+FF5E		ID
+FF5F		OP
+FF60	FF61	CL
+FF62		OP
+FF63	FF64	CL
+FF65		NS
+FF66		ID
+FF67	FF70	CJ
+FF71	FF9D	ID
+FF9E	FF9F	NS
+FFA0	FFBE	ID
+FFC2	FFC7	ID
+FFCA	FFCF	ID
+FFD2	FFD7	ID
+FFDA	FFDC	ID
+FFE0		PO
+FFE1		PR
+FFE2	FFE4	ID
+FFE5	FFE6	PR
+FFE8	FFEE	AL
+FFF9	FFFB	CM
+FFFC		CB
+FFFD		AI
+10000	1000B	AL
+1000D	10026	AL
+10028	1003A	AL
+1003C	1003D	AL
+1003F	1004D	AL
+10050	1005D	AL
+10080	100FA	AL
+10100	10102	BA
+10107	10133	AL
+10137	1018E	AL
+10190	1019B	AL
+101A0		AL
+101D0	101FC	AL
+101FD		CM
+10280	1029C	AL
+102A0	102D0	AL
+102E0		CM
+102E1	102FB	AL
+10300	10323	AL
+1032D	1034A	AL
+10350	10375	AL
+10376	1037A	CM
+10380	1039D	AL
+1039F		BA
+103A0	103C3	AL
+103C8	103CF	AL
+103D0		BA
+103D1	103D5	AL
+10400	1049D	AL
+104A0	104A9	NU
+104B0	104D3	AL
+104D8	104FB	AL
+10500	10527	AL
+10530	10563	AL
+1056F		AL
+10600	10736	AL
+10740	10755	AL
+10760	10767	AL
+10800	10805	AL
+10808		AL
+1080A	10835	AL
+10837	10838	AL
+1083C		AL
+1083F	10855	AL
+10857		BA
+10858	1089E	AL
+108A7	108AF	AL
+108E0	108F2	AL
+108F4	108F5	AL
+108FB	1091B	AL
+1091F		BA
+10920	10939	AL
+1093F		AL
+10980	109B7	AL
+109BC	109CF	AL
+109D2	10A00	AL
+10A01	10A03	CM
+10A05	10A06	CM
+10A0C	10A0F	CM
+10A10	10A13	AL
+10A15	10A17	AL
+10A19	10A35	AL
+10A38	10A3A	CM
+10A3F		CM
+10A40	10A48	AL
+10A50	10A57	BA
+10A58		AL
+10A60	10A9F	AL
+10AC0	10AE4	AL
+10AE5	10AE6	CM
+10AEB	10AEF	AL
+10AF0	10AF5	BA
+10AF6		IN
+10B00	10B35	AL
+10B39	10B3F	BA
+10B40	10B55	AL
+10B58	10B72	AL
+10B78	10B91	AL
+10B99	10B9C	AL
+10BA9	10BAF	AL
+10C00	10C48	AL
+10C80	10CB2	AL
+10CC0	10CF2	AL
+10CFA	10D23	AL
+10D24	10D27	CM
+10D30	10D39	NU
+10E60	10E7E	AL
+10F00	10F27	AL
+10F30	10F45	AL
+10F46	10F50	CM
+10F51	10F59	AL
+10FE0	10FF6	AL
+11000	11002	CM
+11003	11037	AL
+11038	11046	CM
+11047	11048	BA
+11049	1104D	AL
+11052	11065	AL
+11066	1106F	NU
+1107F	11082	CM
+11083	110AF	AL
+110B0	110BA	CM
+110BB	110BD	AL
+110BE	110C1	BA
+110CD		AL
+110D0	110E8	AL
+110F0	110F9	NU
+11100	11102	CM
+11103	11126	AL
+11127	11134	CM
+11136	1113F	NU
+11140	11143	BA
+11144		AL
+11145	11146	CM
+11150	11172	AL
+11173		CM
+11174		AL
+11175		BB
+11176		AL
+11180	11182	CM
+11183	111B2	AL
+111B3	111C0	CM
+111C1	111C4	AL
+111C5	111C6	BA
+111C7		AL
+111C8		BA
+111C9	111CC	CM
+111CD		AL
+111D0	111D9	NU
+111DA		AL
+111DB		BB
+111DC		AL
+111DD	111DF	BA
+111E1	111F4	AL
+11200	11211	AL
+11213	1122B	AL
+1122C	11237	CM
+11238	11239	BA
+1123A		AL
+1123B	1123C	BA
+1123D		AL
+1123E		CM
+11280	11286	AL
+11288		AL
+1128A	1128D	AL
+1128F	1129D	AL
+1129F	112A8	AL
+112A9		BA
+112B0	112DE	AL
+112DF	112EA	CM
+112F0	112F9	NU
+11300	11303	CM
+11305	1130C	AL
+1130F	11310	AL
+11313	11328	AL
+1132A	11330	AL
+11332	11333	AL
+11335	11339	AL
+1133B	1133C	CM
+1133D		AL
+1133E	11344	CM
+11347	11348	CM
+1134B	1134D	CM
+11350		AL
+11357		CM
+1135D	11361	AL
+11362	11363	CM
+11366	1136C	CM
+11370	11374	CM
+11400	11434	AL
+11435	11446	CM
+11447	1144A	AL
+1144B	1144E	BA
+1144F		AL
+11450	11459	NU
+1145B		BA
+1145D		AL
+1145E		CM
+1145F		AL
+11480	114AF	AL
+114B0	114C3	CM
+114C4	114C7	AL
+114D0	114D9	NU
+11580	115AE	AL
+115AF	115B5	CM
+115B8	115C0	CM
+115C1		BB
+115C2	115C3	BA
+115C4	115C5	EX
+115C6	115C8	AL
+115C9	115D7	BA
+115D8	115DB	AL
+115DC	115DD	CM
+11600	1162F	AL
+11630	11640	CM
+11641	11642	BA
+11643	11644	AL
+11650	11659	NU
+11660	1166C	BB
+11680	116AA	AL
+116AB	116B7	CM
+116B8		AL
+116C0	116C9	NU
+11700	1171A	SA
+1171D	1172B	SA
+11730	11739	NU
+1173A	1173B	SA
+1173C	1173E	BA
+1173F		SA
+11800	1182B	AL
+1182C	1183A	CM
+1183B		AL
+118A0	118DF	AL
+118E0	118E9	NU
+118EA	118F2	AL
+118FF		AL
+119A0	119A7	AL
+119AA	119D0	AL
+119D1	119D7	CM
+119DA	119E0	CM
+119E1		AL
+119E2		BB
+119E3		AL
+119E4		CM
+11A00		AL
+11A01	11A0A	CM
+11A0B	11A32	AL
+11A33	11A39	CM
+11A3A		AL
+11A3B	11A3E	CM
+11A3F		BB
+11A40		AL
+11A41	11A44	BA
+11A45		BB
+11A46		AL
+11A47		CM
+11A50		AL
+11A51	11A5B	CM
+11A5C	11A89	AL
+11A8A	11A99	CM
+11A9A	11A9C	BA
+11A9D		AL
+11A9E	11AA0	BB
+11AA1	11AA2	BA
+11AC0	11AF8	AL
+11C00	11C08	AL
+11C0A	11C2E	AL
+11C2F	11C36	CM
+11C38	11C3F	CM
+11C40		AL
+11C41	11C45	BA
+11C50	11C59	NU
+11C5A	11C6C	AL
+11C70		BB
+11C71		EX
+11C72	11C8F	AL
+11C92	11CA7	CM
+11CA9	11CB6	CM
+11D00	11D06	AL
+11D08	11D09	AL
+11D0B	11D30	AL
+11D31	11D36	CM
+11D3A		CM
+11D3C	11D3D	CM
+11D3F	11D45	CM
+11D46		AL
+11D47		CM
+11D50	11D59	NU
+11D60	11D65	AL
+11D67	11D68	AL
+11D6A	11D89	AL
+11D8A	11D8E	CM
+11D90	11D91	CM
+11D93	11D97	CM
+11D98		AL
+11DA0	11DA9	NU
+11EE0	11EF2	AL
+11EF3	11EF6	CM
+11EF7	11EF8	AL
+11FC0	11FDC	AL
+11FDD	11FE0	PO
+11FE1	11FF1	AL
+11FFF		BA
+12000	12399	AL
+12400	1246E	AL
+12470	12474	BA
+12480	12543	AL
+13000	13257	AL
+13258	1325A	OP
+1325B	1325D	CL
+1325E	13281	AL
+13282		CL
+13283	13285	AL
+13286		OP
+13287		CL
+13288		OP
+13289		CL
+1328A	13378	AL
+13379		OP
+1337A	1337B	CL
+1337C	1342E	AL
+13430	13436	GL
+13437		OP
+13438		CL
+14400	145CD	AL
+145CE		OP
+145CF		CL
+145D0	14646	AL
+16800	16A38	AL
+16A40	16A5E	AL
+16A60	16A69	NU
+16A6E	16A6F	BA
+16AD0	16AED	AL
+16AF0	16AF4	CM
+16AF5		BA
+16B00	16B2F	AL
+16B30	16B36	CM
+16B37	16B39	BA
+16B3A	16B43	AL
+16B44		BA
+16B45		AL
+16B50	16B59	NU
+16B5B	16B61	AL
+16B63	16B77	AL
+16B7D	16B8F	AL
+16E40	16E96	AL
+16E97	16E98	BA
+16E99	16E9A	AL
+16F00	16F4A	AL
+16F4F		CM
+16F50		AL
+16F51	16F87	CM
+16F8F	16F92	CM
+16F93	16F9F	AL
+16FE0	16FE3	NS
+17000	187F7	ID
+18800	18AF2	ID
+1B000	1B11E	ID
+1B150	1B152	CJ
+1B164	1B167	CJ
+1B170	1B2FB	ID
+1BC00	1BC6A	AL
+1BC70	1BC7C	AL
+1BC80	1BC88	AL
+1BC90	1BC99	AL
+1BC9C		AL
+1BC9D	1BC9E	CM
+1BC9F		BA
+1BCA0	1BCA3	CM
+1D000	1D0F5	AL
+1D100	1D126	AL
+1D129	1D164	AL
+1D165	1D169	CM
+1D16A	1D16C	AL
+1D16D	1D182	CM
+1D183	1D184	AL
+1D185	1D18B	CM
+1D18C	1D1A9	AL
+1D1AA	1D1AD	CM
+1D1AE	1D1E8	AL
+1D200	1D241	AL
+1D242	1D244	CM
+1D245		AL
+1D2E0	1D2F3	AL
+1D300	1D356	AL
+1D360	1D378	AL
+1D400	1D454	AL
+1D456	1D49C	AL
+1D49E	1D49F	AL
+1D4A2		AL
+1D4A5	1D4A6	AL
+1D4A9	1D4AC	AL
+1D4AE	1D4B9	AL
+1D4BB		AL
+1D4BD	1D4C3	AL
+1D4C5	1D505	AL
+1D507	1D50A	AL
+1D50D	1D514	AL
+1D516	1D51C	AL
+1D51E	1D539	AL
+1D53B	1D53E	AL
+1D540	1D544	AL
+1D546		AL
+1D54A	1D550	AL
+1D552	1D6A5	AL
+1D6A8	1D7CB	AL
+1D7CE	1D7FF	NU
+1D800	1D9FF	AL
+1DA00	1DA36	CM
+1DA37	1DA3A	AL
+1DA3B	1DA6C	CM
+1DA6D	1DA74	AL
+1DA75		CM
+1DA76	1DA83	AL
+1DA84		CM
+1DA85	1DA86	AL
+1DA87	1DA8A	BA
+1DA8B		AL
+1DA9B	1DA9F	CM
+1DAA1	1DAAF	CM
+1E000	1E006	CM
+1E008	1E018	CM
+1E01B	1E021	CM
+1E023	1E024	CM
+1E026	1E02A	CM
+1E100	1E12C	AL
+1E130	1E136	CM
+1E137	1E13D	AL
+1E140	1E149	NU
+1E14E	1E14F	AL
+1E2C0	1E2EB	AL
+1E2EC	1E2EF	CM
+1E2F0	1E2F9	NU
+1E2FF		PR
+1E800	1E8C4	AL
+1E8C7	1E8CF	AL
+1E8D0	1E8D6	CM
+1E900	1E943	AL
+1E944	1E94A	CM
+1E94B		AL
+1E950	1E959	NU
+1E95E	1E95F	OP
+1EC71	1ECAB	AL
+1ECAC		PO
+1ECAD	1ECAF	AL
+1ECB0		PO
+1ECB1	1ECB4	AL
+1ED01	1ED3D	AL
+1EE00	1EE03	AL
+1EE05	1EE1F	AL
+1EE21	1EE22	AL
+1EE24		AL
+1EE27		AL
+1EE29	1EE32	AL
+1EE34	1EE37	AL
+1EE39		AL
+1EE3B		AL
+1EE42		AL
+1EE47		AL
+1EE49		AL
+1EE4B		AL
+1EE4D	1EE4F	AL
+1EE51	1EE52	AL
+1EE54		AL
+1EE57		AL
+1EE59		AL
+1EE5B		AL
+1EE5D		AL
+1EE5F		AL
+1EE61	1EE62	AL
+1EE64		AL
+1EE67	1EE6A	AL
+1EE6C	1EE72	AL
+1EE74	1EE77	AL
+1EE79	1EE7C	AL
+1EE7E		AL
+1EE80	1EE89	AL
+1EE8B	1EE9B	AL
+1EEA1	1EEA3	AL
+1EEA5	1EEA9	AL
+1EEAB	1EEBB	AL
+1EEF0	1EEF1	AL
+1F000	1F0FF	ID
+1F100	1F10C	AI
+1F10D	1F10F	ID
+1F110	1F12D	AI
+1F12E	1F12F	AL
+1F130	1F169	AI
+1F16A	1F16C	AL
+1F16D	1F16F	ID
+1F170	1F1AC	AI
+1F1AD	1F1E5	ID
+1F1E6	1F1FF	RI
+1F200	1F384	ID
+1F385		EB
+1F386	1F39B	ID
+1F39C	1F39D	AL
+1F39E	1F3B4	ID
+1F3B5	1F3B6	AL
+1F3B7	1F3BB	ID
+1F3BC		AL
+1F3BD	1F3C1	ID
+1F3C2	1F3C4	EB
+1F3C5	1F3C6	ID
+1F3C7		EB
+1F3C8	1F3C9	ID
+1F3CA	1F3CC	EB
+1F3CD	1F3FA	ID
+1F3FB	1F3FF	EM
+1F400	1F441	ID
+1F442	1F443	EB
+1F444	1F445	ID
+1F446	1F450	EB
+1F451	1F465	ID
+1F466	1F478	EB
+1F479	1F47B	ID
+1F47C		EB
+1F47D	1F480	ID
+1F481	1F483	EB
+1F484		ID
+1F485	1F487	EB
+1F488	1F48E	ID
+1F48F		EB
+1F490		ID
+1F491		EB
+1F492	1F49F	ID
+1F4A0		AL
+1F4A1		ID
+1F4A2		AL
+1F4A3		ID
+1F4A4		AL
+1F4A5	1F4A9	ID
+1F4AA		EB
+1F4AB	1F4AE	ID
+1F4AF		AL
+1F4B0		ID
+1F4B1	1F4B2	AL
+1F4B3	1F4FF	ID
+1F500	1F506	AL
+1F507	1F516	ID
+1F517	1F524	AL
+1F525	1F531	ID
+1F532	1F549	AL
+1F54A	1F573	ID
+1F574	1F575	EB
+1F576	1F579	ID
+1F57A		EB
+1F57B	1F58F	ID
+1F590		EB
+1F591	1F594	ID
+1F595	1F596	EB
+1F597	1F5D3	ID
+1F5D4	1F5DB	AL
+1F5DC	1F5F3	ID
+1F5F4	1F5F9	AL
+1F5FA	1F644	ID
+1F645	1F647	EB
+1F648	1F64A	ID
+1F64B	1F64F	EB
+1F650	1F675	AL
+1F676	1F678	QU
+1F679	1F67B	NS
+1F67C	1F67F	AL
+1F680	1F6A2	ID
+1F6A3		EB
+1F6A4	1F6B3	ID
+1F6B4	1F6B6	EB
+1F6B7	1F6BF	ID
+1F6C0		EB
+1F6C1	1F6CB	ID
+1F6CC		EB
+1F6CD	1F6FF	ID
+1F700	1F773	AL
+1F774	1F77F	ID
+1F780	1F7D4	AL
+1F7D5	1F7FF	ID
+1F800	1F80B	AL
+1F80C	1F80F	ID
+1F810	1F847	AL
+1F848	1F84F	ID
+1F850	1F859	AL
+1F85A	1F85F	ID
+1F860	1F887	AL
+1F888	1F88F	ID
+1F890	1F8AD	AL
+1F8AE	1F8FF	ID
+1F900	1F90B	AL
+1F90C	1F90E	ID
+1F90F		EB
+1F910	1F917	ID
+1F918	1F91F	EB
+1F920	1F925	ID
+1F926		EB
+1F927	1F92F	ID
+1F930	1F939	EB
+1F93A	1F93B	ID
+1F93C	1F93E	EB
+1F93F	1F9B4	ID
+1F9B5	1F9B6	EB
+1F9B7		ID
+1F9B8	1F9B9	EB
+1F9BA		ID
+1F9BB		EB
+1F9BC	1F9CC	ID
+1F9CD	1F9CF	EB
+1F9D0		ID
+1F9D1	1F9DD	EB
+1F9DE	1F9FF	ID
+1FA00	1FA53	AL
+1FA54	1FFFD	ID
+20000	2FFFD	ID
+30000	3FFFD	ID
+E0001		CM
+E0020	E007F	CM
+E0100	E01EF	CM
+END
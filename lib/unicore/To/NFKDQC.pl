@@ -0,0 +1,409 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+
+# The name this swash is to be known by, with the format of the mappings in
+# the main body of the table, and what all code points missing from this file
+# map to.
+$utf8::SwashInfo{'ToNFKDQC'}{'format'} = 's'; # string
+$utf8::SwashInfo{'ToNFKDQC'}{'missing'} = 'Yes';
+
+return <<'END';
+A0		N
+A8		N
+AA		N
+AF		N
+B2	B5	N
+B8	BA	N
+BC	BE	N
+C0	C5	N
+C7	CF	N
+D1	D6	N
+D9	DD	N
+E0	E5	N
+E7	EF	N
+F1	F6	N
+F9	FD	N
+FF	10F	N
+112	125	N
+128	130	N
+132	137	N
+139	140	N
+143	149	N
+14C	151	N
+154	165	N
+168	17F	N
+1A0	1A1	N
+1AF	1B0	N
+1C4	1DC	N
+1DE	1E3	N
+1E6	1F5	N
+1F8	21B	N
+21E	21F	N
+226	233	N
+2B0	2B8	N
+2D8	2DD	N
+2E0	2E4	N
+340	341	N
+343	344	N
+374		N
+37A		N
+37E		N
+384	38A	N
+38C		N
+38E	390	N
+3AA	3B0	N
+3CA	3CE	N
+3D0	3D6	N
+3F0	3F2	N
+3F4	3F5	N
+3F9		N
+400	401	N
+403		N
+407		N
+40C	40E	N
+419		N
+439		N
+450	451	N
+453		N
+457		N
+45C	45E	N
+476	477	N
+4C1	4C2	N
+4D0	4D3	N
+4D6	4D7	N
+4DA	4DF	N
+4E2	4E7	N
+4EA	4F5	N
+4F8	4F9	N
+587		N
+622	626	N
+675	678	N
+6C0		N
+6C2		N
+6D3		N
+929		N
+931		N
+934		N
+958	95F	N
+9CB	9CC	N
+9DC	9DD	N
+9DF		N
+A33		N
+A36		N
+A59	A5B	N
+A5E		N
+B48		N
+B4B	B4C	N
+B5C	B5D	N
+B94		N
+BCA	BCC	N
+C48		N
+CC0		N
+CC7	CC8	N
+CCA	CCB	N
+D4A	D4C	N
+DDA		N
+DDC	DDE	N
+E33		N
+EB3		N
+EDC	EDD	N
+F0C		N
+F43		N
+F4D		N
+F52		N
+F57		N
+F5C		N
+F69		N
+F73		N
+F75	F79	N
+F81		N
+F93		N
+F9D		N
+FA2		N
+FA7		N
+FAC		N
+FB9		N
+1026		N
+10FC		N
+1B06		N
+1B08		N
+1B0A		N
+1B0C		N
+1B0E		N
+1B12		N
+1B3B		N
+1B3D		N
+1B40	1B41	N
+1B43		N
+1D2C	1D2E	N
+1D30	1D3A	N
+1D3C	1D4D	N
+1D4F	1D6A	N
+1D78		N
+1D9B	1DBF	N
+1E00	1E9B	N
+1EA0	1EF9	N
+1F00	1F15	N
+1F18	1F1D	N
+1F20	1F45	N
+1F48	1F4D	N
+1F50	1F57	N
+1F59		N
+1F5B		N
+1F5D		N
+1F5F	1F7D	N
+1F80	1FB4	N
+1FB6	1FC4	N
+1FC6	1FD3	N
+1FD6	1FDB	N
+1FDD	1FEF	N
+1FF2	1FF4	N
+1FF6	1FFE	N
+2000	200A	N
+2011		N
+2017		N
+2024	2026	N
+202F		N
+2033	2034	N
+2036	2037	N
+203C		N
+203E		N
+2047	2049	N
+2057		N
+205F		N
+2070	2071	N
+2074	208E	N
+2090	209C	N
+20A8		N
+2100	2103	N
+2105	2107	N
+2109	2113	N
+2115	2116	N
+2119	211D	N
+2120	2122	N
+2124		N
+2126		N
+2128		N
+212A	212D	N
+212F	2131	N
+2133	2139	N
+213B	2140	N
+2145	2149	N
+2150	217F	N
+2189		N
+219A	219B	N
+21AE		N
+21CD	21CF	N
+2204		N
+2209		N
+220C		N
+2224		N
+2226		N
+222C	222D	N
+222F	2230	N
+2241		N
+2244		N
+2247		N
+2249		N
+2260		N
+2262		N
+226D	2271	N
+2274	2275	N
+2278	2279	N
+2280	2281	N
+2284	2285	N
+2288	2289	N
+22AC	22AF	N
+22E0	22E3	N
+22EA	22ED	N
+2329	232A	N
+2460	24EA	N
+2A0C		N
+2A74	2A76	N
+2ADC		N
+2C7C	2C7D	N
+2D6F		N
+2E9F		N
+2EF3		N
+2F00	2FD5	N
+3000		N
+3036		N
+3038	303A	N
+304C		N
+304E		N
+3050		N
+3052		N
+3054		N
+3056		N
+3058		N
+305A		N
+305C		N
+305E		N
+3060		N
+3062		N
+3065		N
+3067		N
+3069		N
+3070	3071	N
+3073	3074	N
+3076	3077	N
+3079	307A	N
+307C	307D	N
+3094		N
+309B	309C	N
+309E	309F	N
+30AC		N
+30AE		N
+30B0		N
+30B2		N
+30B4		N
+30B6		N
+30B8		N
+30BA		N
+30BC		N
+30BE		N
+30C0		N
+30C2		N
+30C5		N
+30C7		N
+30C9		N
+30D0	30D1	N
+30D3	30D4	N
+30D6	30D7	N
+30D9	30DA	N
+30DC	30DD	N
+30F4		N
+30F7	30FA	N
+30FE	30FF	N
+3131	318E	N
+3192	319F	N
+3200	321E	N
+3220	3247	N
+3250	327E	N
+3280	33FF	N
+A69C	A69D	N
+A770		N
+A7F8	A7F9	N
+AB5C	AB5F	N
+AC00	D7A3	N
+F900	FA0D	N
+FA10		N
+FA12		N
+FA15	FA1E	N
+FA20		N
+FA22		N
+FA25	FA26	N
+FA2A	FA6D	N
+FA70	FAD9	N
+FB00	FB06	N
+FB13	FB17	N
+FB1D		N
+FB1F	FB36	N
+FB38	FB3C	N
+FB3E		N
+FB40	FB41	N
+FB43	FB44	N
+FB46	FBB1	N
+FBD3	FD3D	N
+FD50	FD8F	N
+FD92	FDC7	N
+FDF0	FDFC	N
+FE10	FE19	N
+FE30	FE44	N
+FE47	FE52	N
+FE54	FE66	N
+FE68	FE6B	N
+FE70	FE72	N
+FE74		N
+FE76	FEFC	N
+FF01	FFBE	N
+FFC2	FFC7	N
+FFCA	FFCF	N
+FFD2	FFD7	N
+FFDA	FFDC	N
+FFE0	FFE6	N
+FFE8	FFEE	N
+1109A		N
+1109C		N
+110AB		N
+1112E	1112F	N
+1134B	1134C	N
+114BB	114BC	N
+114BE		N
+115BA	115BB	N
+1D15E	1D164	N
+1D1BB	1D1C0	N
+1D400	1D454	N
+1D456	1D49C	N
+1D49E	1D49F	N
+1D4A2		N
+1D4A5	1D4A6	N
+1D4A9	1D4AC	N
+1D4AE	1D4B9	N
+1D4BB		N
+1D4BD	1D4C3	N
+1D4C5	1D505	N
+1D507	1D50A	N
+1D50D	1D514	N
+1D516	1D51C	N
+1D51E	1D539	N
+1D53B	1D53E	N
+1D540	1D544	N
+1D546		N
+1D54A	1D550	N
+1D552	1D6A5	N
+1D6A8	1D7CB	N
+1D7CE	1D7FF	N
+1EE00	1EE03	N
+1EE05	1EE1F	N
+1EE21	1EE22	N
+1EE24		N
+1EE27		N
+1EE29	1EE32	N
+1EE34	1EE37	N
+1EE39		N
+1EE3B		N
+1EE42		N
+1EE47		N
+1EE49		N
+1EE4B		N
+1EE4D	1EE4F	N
+1EE51	1EE52	N
+1EE54		N
+1EE57		N
+1EE59		N
+1EE5B		N
+1EE5D		N
+1EE5F		N
+1EE61	1EE62	N
+1EE64		N
+1EE67	1EE6A	N
+1EE6C	1EE72	N
+1EE74	1EE77	N
+1EE79	1EE7C	N
+1EE7E		N
+1EE80	1EE89	N
+1EE8B	1EE9B	N
+1EEA1	1EEA3	N
+1EEA5	1EEA9	N
+1EEAB	1EEBB	N
+1F100	1F10A	N
+1F110	1F12E	N
+1F130	1F14F	N
+1F16A	1F16C	N
+1F190		N
+1F200	1F202	N
+1F210	1F23B	N
+1F240	1F248	N
+1F250	1F251	N
+2F800	2FA1D	N
+END
@@ -0,0 +1,794 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+# The mappings must be modified to get the correct values by adding the code
+# point ordinal number to each one that is numeric.
+
+# The name this swash is to be known by, with the format of the mappings in
+# the main body of the table, and what all code points missing from this file
+# map to.
+$utf8::SwashInfo{'ToNv'}{'format'} = 'a'; # some entries need adjustment
+$utf8::SwashInfo{'ToNv'}{'missing'} = 'NaN';
+
+return <<'END';
+30	39	0
+B2	B3	2
+B9		1
+BC		1/4
+BD		1/2
+BE		3/4
+660	669	0
+6F0	6F9	0
+7C0	7C9	0
+966	96F	0
+9E6	9EF	0
+9F4		1/16
+9F5		1/8
+9F6		3/16
+9F7		1/4
+9F8		3/4
+9F9		16
+A66	A6F	0
+AE6	AEF	0
+B66	B6F	0
+B72		1/4
+B73		1/2
+B74		3/4
+B75		1/16
+B76		1/8
+B77		3/16
+BE6	BF0	0
+BF1		100
+BF2		1000
+C66	C6F	0
+C78	C7B	0
+C7C	C7E	1
+CE6	CEF	0
+D58		1/160
+D59		1/40
+D5A		3/80
+D5B		1/20
+D5C		1/10
+D5D		3/20
+D5E		1/5
+D66	D70	0
+D71		100
+D72		1000
+D73		1/4
+D74		1/2
+D75		3/4
+D76		1/16
+D77		1/8
+D78		3/16
+DE6	DEF	0
+E50	E59	0
+ED0	ED9	0
+F20	F29	0
+F2A		1/2
+F2B		3/2
+F2C		5/2
+F2D		7/2
+F2E		9/2
+F2F		11/2
+F30		13/2
+F31		15/2
+F32		17/2
+F33		-1/2
+1040	1049	0
+1090	1099	0
+1369	1372	1
+1373		20
+1374		30
+1375		40
+1376		50
+1377		60
+1378		70
+1379		80
+137A		90
+137B		100
+137C		10000
+16EE	16F0	17
+17E0	17E9	0
+17F0	17F9	0
+1810	1819	0
+1946	194F	0
+19D0	19D9	0
+19DA		1
+1A80	1A89	0
+1A90	1A99	0
+1B50	1B59	0
+1BB0	1BB9	0
+1C40	1C49	0
+1C50	1C59	0
+2070		0
+2074	2079	4
+2080	2089	0
+2150		1/7
+2151		1/9
+2152		1/10
+2153		1/3
+2154		2/3
+2155		1/5
+2156		2/5
+2157		3/5
+2158		4/5
+2159		1/6
+215A		5/6
+215B		1/8
+215C		3/8
+215D		5/8
+215E		7/8
+215F		1
+2160	216B	1
+216C		50
+216D		100
+216E		500
+216F		1000
+2170	217B	1
+217C		50
+217D		100
+217E		500
+217F		1000
+2180		1000
+2181		5000
+2182		10000
+2185		6
+2186		50
+2187		50000
+2188		100000
+2189		0
+2460	2473	1
+2474	2487	1
+2488	249B	1
+24EA		0
+24EB	24F4	11
+24F5	24FE	1
+24FF		0
+2776	277F	1
+2780	2789	1
+278A	2793	1
+2CFD		1/2
+3007		0
+3021	3029	1
+3038		10
+3039		20
+303A		30
+3192	3195	1
+3220	3229	1
+3248		10
+3249		20
+324A		30
+324B		40
+324C		50
+324D		60
+324E		70
+324F		80
+3251	325F	21
+3280	3289	1
+32B1	32BF	36
+3405		5
+3483		2
+382A		5
+3B4D		7
+4E00		1
+4E03		7
+4E07		10000
+4E09		3
+4E5D		9
+4E8C		2
+4E94		5
+4E96		4
+4EBF		100000000
+4EC0		10
+4EDF		1000
+4EE8		3
+4F0D		5
+4F70		100
+5104		100000000
+5146		1000000000000
+5169		2
+516B		8
+516D		6
+5341		10
+5343		1000
+5344		20
+5345		30
+534C		40
+53C1		3
+53C2		3
+53C3		3
+53C4		3
+56DB		4
+58F1		1
+58F9		1
+5E7A		1
+5EFE		9
+5EFF		20
+5F0C	5F0E	1
+5F10		2
+62FE		10
+634C		8
+67D2		7
+6F06		7
+7396		9
+767E		100
+8086		4
+842C		10000
+8CAE		2
+8CB3		2
+8D30		2
+9621		1000
+9646		6
+964C		100
+9678		6
+96F6		0
+A620	A629	0
+A6E6	A6EE	1
+A6EF		0
+A830		1/4
+A831		1/2
+A832		3/4
+A833		1/16
+A834		1/8
+A835		3/16
+A8D0	A8D9	0
+A900	A909	0
+A9D0	A9D9	0
+A9F0	A9F9	0
+AA50	AA59	0
+ABF0	ABF9	0
+F96B		3
+F973		10
+F978		2
+F9B2		0
+F9D1		6
+F9D3		6
+F9FD		10
+FF10	FF19	0
+10107	10110	1
+10111		20
+10112		30
+10113		40
+10114		50
+10115		60
+10116		70
+10117		80
+10118		90
+10119		100
+1011A		200
+1011B		300
+1011C		400
+1011D		500
+1011E		600
+1011F		700
+10120		800
+10121		900
+10122		1000
+10123		2000
+10124		3000
+10125		4000
+10126		5000
+10127		6000
+10128		7000
+10129		8000
+1012A		9000
+1012B		10000
+1012C		20000
+1012D		30000
+1012E		40000
+1012F		50000
+10130		60000
+10131		70000
+10132		80000
+10133		90000
+10140		1/4
+10141		1/2
+10142		1
+10143		5
+10144		50
+10145		500
+10146		5000
+10147		50000
+10148		5
+10149		10
+1014A		50
+1014B		100
+1014C		500
+1014D		1000
+1014E		5000
+1014F		5
+10150		10
+10151		50
+10152		100
+10153		500
+10154		1000
+10155		10000
+10156		50000
+10157		10
+10158		1
+10159		1
+1015A	1015B	1
+1015C		2
+1015D		2
+1015E		2
+1015F		5
+10160		10
+10161		10
+10162		10
+10163		10
+10164		10
+10165		30
+10166		50
+10167		50
+10168		50
+10169		50
+1016A		100
+1016B		300
+1016C		500
+1016D		500
+1016E		500
+1016F		500
+10170		500
+10171		1000
+10172		5000
+10173		5
+10174		50
+10175		1/2
+10176		1/2
+10177		2/3
+10178		3/4
+1018A		0
+1018B		1/4
+102E1	102EA	1
+102EB		20
+102EC		30
+102ED		40
+102EE		50
+102EF		60
+102F0		70
+102F1		80
+102F2		90
+102F3		100
+102F4		200
+102F5		300
+102F6		400
+102F7		500
+102F8		600
+102F9		700
+102FA		800
+102FB		900
+10320		1
+10321		5
+10322		10
+10323		50
+10341		90
+1034A		900
+103D1	103D2	1
+103D3		10
+103D4		20
+103D5		100
+104A0	104A9	0
+10858	1085A	1
+1085B		10
+1085C		20
+1085D		100
+1085E		1000
+1085F		10000
+10879	1087D	1
+1087E		10
+1087F		20
+108A7	108AA	1
+108AB	108AC	4
+108AD		10
+108AE		20
+108AF		100
+108FB		1
+108FC		5
+108FD		10
+108FE		20
+108FF		100
+10916		1
+10917		10
+10918		20
+10919		100
+1091A	1091B	2
+109BC		11/12
+109BD		1/2
+109C0	109C9	1
+109CA		20
+109CB		30
+109CC		40
+109CD		50
+109CE		60
+109CF		70
+109D2		100
+109D3		200
+109D4		300
+109D5		400
+109D6		500
+109D7		600
+109D8		700
+109D9		800
+109DA		900
+109DB		1000
+109DC		2000
+109DD		3000
+109DE		4000
+109DF		5000
+109E0		6000
+109E1		7000
+109E2		8000
+109E3		9000
+109E4		10000
+109E5		20000
+109E6		30000
+109E7		40000
+109E8		50000
+109E9		60000
+109EA		70000
+109EB		80000
+109EC		90000
+109ED		100000
+109EE		200000
+109EF		300000
+109F0		400000
+109F1		500000
+109F2		600000
+109F3		700000
+109F4		800000
+109F5		900000
+109F6		1/12
+109F7		1/6
+109F8		1/4
+109F9		1/3
+109FA		5/12
+109FB		1/2
+109FC		7/12
+109FD		2/3
+109FE		3/4
+109FF		5/6
+10A40	10A43	1
+10A44		10
+10A45		20
+10A46		100
+10A47		1000
+10A48		1/2
+10A7D		1
+10A7E		50
+10A9D		1
+10A9E		10
+10A9F		20
+10AEB		1
+10AEC		5
+10AED		10
+10AEE		20
+10AEF		100
+10B58	10B5B	1
+10B5C		10
+10B5D		20
+10B5E		100
+10B5F		1000
+10B78	10B7B	1
+10B7C		10
+10B7D		20
+10B7E		100
+10B7F		1000
+10BA9	10BAC	1
+10BAD		10
+10BAE		20
+10BAF		100
+10CFA		1
+10CFB		5
+10CFC		10
+10CFD		50
+10CFE		100
+10CFF		1000
+10D30	10D39	0
+10E60	10E69	1
+10E6A		20
+10E6B		30
+10E6C		40
+10E6D		50
+10E6E		60
+10E6F		70
+10E70		80
+10E71		90
+10E72		100
+10E73		200
+10E74		300
+10E75		400
+10E76		500
+10E77		600
+10E78		700
+10E79		800
+10E7A		900
+10E7B		1/2
+10E7C		1/4
+10E7D		1/3
+10E7E		2/3
+10F1D	10F21	1
+10F22		10
+10F23		20
+10F24		30
+10F25		100
+10F26		1/2
+10F51		1
+10F52		10
+10F53		20
+10F54		100
+11052	1105B	1
+1105C		20
+1105D		30
+1105E		40
+1105F		50
+11060		60
+11061		70
+11062		80
+11063		90
+11064		100
+11065		1000
+11066	1106F	0
+110F0	110F9	0
+11136	1113F	0
+111D0	111D9	0
+111E1	111EA	1
+111EB		20
+111EC		30
+111ED		40
+111EE		50
+111EF		60
+111F0		70
+111F1		80
+111F2		90
+111F3		100
+111F4		1000
+112F0	112F9	0
+11450	11459	0
+114D0	114D9	0
+11650	11659	0
+116C0	116C9	0
+11730	1173A	0
+1173B		20
+118E0	118EA	0
+118EB		20
+118EC		30
+118ED		40
+118EE		50
+118EF		60
+118F0		70
+118F1		80
+118F2		90
+11C50	11C59	0
+11C5A	11C63	1
+11C64		20
+11C65		30
+11C66		40
+11C67		50
+11C68		60
+11C69		70
+11C6A		80
+11C6B		90
+11C6C		100
+11D50	11D59	0
+11DA0	11DA9	0
+11FC0		1/320
+11FC1		1/160
+11FC2		1/80
+11FC3		1/64
+11FC4		1/40
+11FC5		1/32
+11FC6		3/80
+11FC7		3/64
+11FC8		1/20
+11FC9		1/16
+11FCA		1/16
+11FCB		1/10
+11FCC		1/8
+11FCD		3/20
+11FCE		3/16
+11FCF		1/5
+11FD0		1/4
+11FD1		1/2
+11FD2		1/2
+11FD3		3/4
+11FD4		1/320
+12400	12407	2
+12408	1240E	3
+1240F	12414	4
+12415	1241D	1
+1241E	12422	1
+12423	12424	2
+12425	1242B	3
+1242C	1242E	1
+1242F	12431	3
+12432		216000
+12433		432000
+12434	12436	1
+12437	12439	3
+1243A		3
+1243B	1243C	3
+1243D		4
+1243E		4
+1243F		4
+12440	12441	6
+12442		7
+12443	12444	7
+12445	12446	8
+12447		9
+12448		9
+12449		9
+1244A	1244E	2
+1244F	12452	1
+12453	12454	4
+12455		5
+12456	12457	2
+12458	12459	1
+1245A		1/3
+1245B		2/3
+1245C		5/6
+1245D		1/3
+1245E		2/3
+1245F		1/8
+12460		1/4
+12461		1/6
+12462		1/4
+12463		1/4
+12464		1/2
+12465		1/3
+12466		2/3
+12467		40
+12468		50
+12469	1246E	4
+16A60	16A69	0
+16B50	16B59	0
+16B5B		10
+16B5C		100
+16B5D		10000
+16B5E		1000000
+16B5F		100000000
+16B60		10000000000
+16B61		1000000000000
+16E80	16E93	0
+16E94	16E96	1
+1D2E0	1D2F3	0
+1D360	1D369	1
+1D36A		20
+1D36B		30
+1D36C		40
+1D36D		50
+1D36E		60
+1D36F		70
+1D370		80
+1D371		90
+1D372	1D376	1
+1D377		1
+1D378		5
+1D7CE	1D7D7	0
+1D7D8	1D7E1	0
+1D7E2	1D7EB	0
+1D7EC	1D7F5	0
+1D7F6	1D7FF	0
+1E140	1E149	0
+1E2F0	1E2F9	0
+1E8C7	1E8CF	1
+1E950	1E959	0
+1EC71	1EC7A	1
+1EC7B		20
+1EC7C		30
+1EC7D		40
+1EC7E		50
+1EC7F		60
+1EC80		70
+1EC81		80
+1EC82		90
+1EC83		100
+1EC84		200
+1EC85		300
+1EC86		400
+1EC87		500
+1EC88		600
+1EC89		700
+1EC8A		800
+1EC8B		900
+1EC8C		1000
+1EC8D		2000
+1EC8E		3000
+1EC8F		4000
+1EC90		5000
+1EC91		6000
+1EC92		7000
+1EC93		8000
+1EC94		9000
+1EC95		10000
+1EC96		20000
+1EC97		30000
+1EC98		40000
+1EC99		50000
+1EC9A		60000
+1EC9B		70000
+1EC9C		80000
+1EC9D		90000
+1EC9E		100000
+1EC9F		200000
+1ECA0		100000
+1ECA1		10000000
+1ECA2		20000000
+1ECA3	1ECAB	1
+1ECAD		1/4
+1ECAE		1/2
+1ECAF		3/4
+1ECB1	1ECB2	1
+1ECB3		10000
+1ECB4		100000
+1ED01	1ED0A	1
+1ED0B		20
+1ED0C		30
+1ED0D		40
+1ED0E		50
+1ED0F		60
+1ED10		70
+1ED11		80
+1ED12		90
+1ED13		100
+1ED14		200
+1ED15		300
+1ED16		400
+1ED17		500
+1ED18		600
+1ED19		700
+1ED1A		800
+1ED1B		900
+1ED1C		1000
+1ED1D		2000
+1ED1E		3000
+1ED1F		4000
+1ED20		5000
+1ED21		6000
+1ED22		7000
+1ED23		8000
+1ED24		9000
+1ED25		10000
+1ED26		20000
+1ED27		30000
+1ED28		40000
+1ED29		50000
+1ED2A		60000
+1ED2B		70000
+1ED2C		80000
+1ED2D		90000
+1ED2F	1ED37	2
+1ED38		400
+1ED39		600
+1ED3A		2000
+1ED3B		10000
+1ED3C		1/2
+1ED3D		1/6
+1F100		0
+1F101	1F10A	0
+1F10B		0
+1F10C		0
+20001		7
+20064		4
+200E2		4
+20121		5
+2092A		1
+20983		30
+2098C		40
+2099C		40
+20AEA		6
+20AFD		3
+20B19		3
+22390		2
+22998		3
+23B1B		3
+2626D		4
+2F890		9
+END
@@ -0,0 +1,10165 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+# This file is for the use of Unicode::UCD
+
+# Highest legal Unicode code point
+$Unicode::UCD::MAX_UNICODE_CODEPOINT = 0x10FFFF;
+
+# Hangul syllables
+$Unicode::UCD::HANGUL_BEGIN = 0xAC00;
+$Unicode::UCD::HANGUL_COUNT = 11172;
+
+# Keys are all the possible "prop=value" combinations, in loose form; values
+# are the standard loose name for the 'value' part of the key
+%Unicode::UCD::loose_to_standard_value = (
+'age=1.1' => '1.1',
+'age=10.0' => '10.0',
+'age=11.0' => '11.0',
+'age=12.0' => '12.0',
+'age=12.1' => '12.1',
+'age=2.0' => '2.0',
+'age=2.1' => '2.1',
+'age=3.0' => '3.0',
+'age=3.1' => '3.1',
+'age=3.2' => '3.2',
+'age=4.0' => '4.0',
+'age=4.1' => '4.1',
+'age=5.0' => '5.0',
+'age=5.1' => '5.1',
+'age=5.2' => '5.2',
+'age=6.0' => '6.0',
+'age=6.1' => '6.1',
+'age=6.2' => '6.2',
+'age=6.3' => '6.3',
+'age=7.0' => '7.0',
+'age=8.0' => '8.0',
+'age=9.0' => '9.0',
+'age=na' => 'na',
+'age=unassigned' => 'na',
+'age=v100' => '10.0',
+'age=v11' => '1.1',
+'age=v110' => '11.0',
+'age=v120' => '12.0',
+'age=v121' => '12.1',
+'age=v20' => '2.0',
+'age=v21' => '2.1',
+'age=v30' => '3.0',
+'age=v31' => '3.1',
+'age=v32' => '3.2',
+'age=v40' => '4.0',
+'age=v41' => '4.1',
+'age=v50' => '5.0',
+'age=v51' => '5.1',
+'age=v52' => '5.2',
+'age=v60' => '6.0',
+'age=v61' => '6.1',
+'age=v62' => '6.2',
+'age=v63' => '6.3',
+'age=v70' => '7.0',
+'age=v80' => '8.0',
+'age=v90' => '9.0',
+'ahex=f' => 'n',
+'ahex=false' => 'n',
+'ahex=n' => 'n',
+'ahex=no' => 'n',
+'ahex=t' => 'y',
+'ahex=true' => 'y',
+'ahex=y' => 'y',
+'ahex=yes' => 'y',
+'alpha=f' => 'n',
+'alpha=false' => 'n',
+'alpha=n' => 'n',
+'alpha=no' => 'n',
+'alpha=t' => 'y',
+'alpha=true' => 'y',
+'alpha=y' => 'y',
+'alpha=yes' => 'y',
+'bc=al' => 'al',
+'bc=an' => 'an',
+'bc=arabicletter' => 'al',
+'bc=arabicnumber' => 'an',
+'bc=b' => 'b',
+'bc=bn' => 'bn',
+'bc=boundaryneutral' => 'bn',
+'bc=commonseparator' => 'cs',
+'bc=cs' => 'cs',
+'bc=en' => 'en',
+'bc=es' => 'es',
+'bc=et' => 'et',
+'bc=europeannumber' => 'en',
+'bc=europeanseparator' => 'es',
+'bc=europeanterminator' => 'et',
+'bc=firststrongisolate' => 'fsi',
+'bc=fsi' => 'fsi',
+'bc=l' => 'l',
+'bc=lefttoright' => 'l',
+'bc=lefttorightembedding' => 'lre',
+'bc=lefttorightisolate' => 'lri',
+'bc=lefttorightoverride' => 'lro',
+'bc=lre' => 'lre',
+'bc=lri' => 'lri',
+'bc=lro' => 'lro',
+'bc=nonspacingmark' => 'nsm',
+'bc=nsm' => 'nsm',
+'bc=on' => 'on',
+'bc=otherneutral' => 'on',
+'bc=paragraphseparator' => 'b',
+'bc=pdf' => 'pdf',
+'bc=pdi' => 'pdi',
+'bc=popdirectionalformat' => 'pdf',
+'bc=popdirectionalisolate' => 'pdi',
+'bc=r' => 'r',
+'bc=righttoleft' => 'r',
+'bc=righttoleftembedding' => 'rle',
+'bc=righttoleftisolate' => 'rli',
+'bc=righttoleftoverride' => 'rlo',
+'bc=rle' => 'rle',
+'bc=rli' => 'rli',
+'bc=rlo' => 'rlo',
+'bc=s' => 's',
+'bc=segmentseparator' => 's',
+'bc=whitespace' => 'ws',
+'bc=ws' => 'ws',
+'bidic=f' => 'n',
+'bidic=false' => 'n',
+'bidic=n' => 'n',
+'bidic=no' => 'n',
+'bidic=t' => 'y',
+'bidic=true' => 'y',
+'bidic=y' => 'y',
+'bidic=yes' => 'y',
+'bidim=f' => 'n',
+'bidim=false' => 'n',
+'bidim=n' => 'n',
+'bidim=no' => 'n',
+'bidim=t' => 'y',
+'bidim=true' => 'y',
+'bidim=y' => 'y',
+'bidim=yes' => 'y',
+'blk=adlam' => 'adlam',
+'blk=aegeannumbers' => 'aegeannumbers',
+'blk=ahom' => 'ahom',
+'blk=alchemical' => 'alchemical',
+'blk=alchemicalsymbols' => 'alchemical',
+'blk=alphabeticpf' => 'alphabeticpf',
+'blk=alphabeticpresentationforms' => 'alphabeticpf',
+'blk=anatolianhieroglyphs' => 'anatolianhieroglyphs',
+'blk=ancientgreekmusic' => 'ancientgreekmusic',
+'blk=ancientgreekmusicalnotation' => 'ancientgreekmusic',
+'blk=ancientgreeknumbers' => 'ancientgreeknumbers',
+'blk=ancientsymbols' => 'ancientsymbols',
+'blk=arabic' => 'arabic',
+'blk=arabicexta' => 'arabicexta',
+'blk=arabicextendeda' => 'arabicexta',
+'blk=arabicmath' => 'arabicmath',
+'blk=arabicmathematicalalphabeticsymbols' => 'arabicmath',
+'blk=arabicpfa' => 'arabicpfa',
+'blk=arabicpfb' => 'arabicpfb',
+'blk=arabicpresentationformsa' => 'arabicpfa',
+'blk=arabicpresentationformsb' => 'arabicpfb',
+'blk=arabicsup' => 'arabicsup',
+'blk=arabicsupplement' => 'arabicsup',
+'blk=armenian' => 'armenian',
+'blk=arrows' => 'arrows',
+'blk=ascii' => 'ascii',
+'blk=avestan' => 'avestan',
+'blk=balinese' => 'balinese',
+'blk=bamum' => 'bamum',
+'blk=bamumsup' => 'bamumsup',
+'blk=bamumsupplement' => 'bamumsup',
+'blk=basiclatin' => 'ascii',
+'blk=bassavah' => 'bassavah',
+'blk=batak' => 'batak',
+'blk=bengali' => 'bengali',
+'blk=bhaiksuki' => 'bhaiksuki',
+'blk=blockelements' => 'blockelements',
+'blk=bopomofo' => 'bopomofo',
+'blk=bopomofoext' => 'bopomofoext',
+'blk=bopomofoextended' => 'bopomofoext',
+'blk=boxdrawing' => 'boxdrawing',
+'blk=brahmi' => 'brahmi',
+'blk=braille' => 'braille',
+'blk=braillepatterns' => 'braille',
+'blk=buginese' => 'buginese',
+'blk=buhid' => 'buhid',
+'blk=byzantinemusic' => 'byzantinemusic',
+'blk=byzantinemusicalsymbols' => 'byzantinemusic',
+'blk=canadiansyllabics' => 'ucas',
+'blk=carian' => 'carian',
+'blk=caucasianalbanian' => 'caucasianalbanian',
+'blk=chakma' => 'chakma',
+'blk=cham' => 'cham',
+'blk=cherokee' => 'cherokee',
+'blk=cherokeesup' => 'cherokeesup',
+'blk=cherokeesupplement' => 'cherokeesup',
+'blk=chesssymbols' => 'chesssymbols',
+'blk=cjk' => 'cjk',
+'blk=cjkcompat' => 'cjkcompat',
+'blk=cjkcompatforms' => 'cjkcompatforms',
+'blk=cjkcompatibility' => 'cjkcompat',
+'blk=cjkcompatibilityforms' => 'cjkcompatforms',
+'blk=cjkcompatibilityideographs' => 'cjkcompatideographs',
+'blk=cjkcompatibilityideographssupplement' => 'cjkcompatideographssup',
+'blk=cjkcompatideographs' => 'cjkcompatideographs',
+'blk=cjkcompatideographssup' => 'cjkcompatideographssup',
+'blk=cjkexta' => 'cjkexta',
+'blk=cjkextb' => 'cjkextb',
+'blk=cjkextc' => 'cjkextc',
+'blk=cjkextd' => 'cjkextd',
+'blk=cjkexte' => 'cjkexte',
+'blk=cjkextf' => 'cjkextf',
+'blk=cjkradicalssup' => 'cjkradicalssup',
+'blk=cjkradicalssupplement' => 'cjkradicalssup',
+'blk=cjkstrokes' => 'cjkstrokes',
+'blk=cjksymbols' => 'cjksymbols',
+'blk=cjksymbolsandpunctuation' => 'cjksymbols',
+'blk=cjkunifiedideographs' => 'cjk',
+'blk=cjkunifiedideographsextensiona' => 'cjkexta',
+'blk=cjkunifiedideographsextensionb' => 'cjkextb',
+'blk=cjkunifiedideographsextensionc' => 'cjkextc',
+'blk=cjkunifiedideographsextensiond' => 'cjkextd',
+'blk=cjkunifiedideographsextensione' => 'cjkexte',
+'blk=cjkunifiedideographsextensionf' => 'cjkextf',
+'blk=combiningdiacriticalmarks' => 'diacriticals',
+'blk=combiningdiacriticalmarksextended' => 'diacriticalsext',
+'blk=combiningdiacriticalmarksforsymbols' => 'diacriticalsforsymbols',
+'blk=combiningdiacriticalmarkssupplement' => 'diacriticalssup',
+'blk=combininghalfmarks' => 'halfmarks',
+'blk=combiningmarksforsymbols' => 'diacriticalsforsymbols',
+'blk=commonindicnumberforms' => 'indicnumberforms',
+'blk=compatjamo' => 'compatjamo',
+'blk=controlpictures' => 'controlpictures',
+'blk=coptic' => 'coptic',
+'blk=copticepactnumbers' => 'copticepactnumbers',
+'blk=countingrod' => 'countingrod',
+'blk=countingrodnumerals' => 'countingrod',
+'blk=cuneiform' => 'cuneiform',
+'blk=cuneiformnumbers' => 'cuneiformnumbers',
+'blk=cuneiformnumbersandpunctuation' => 'cuneiformnumbers',
+'blk=currencysymbols' => 'currencysymbols',
+'blk=cypriotsyllabary' => 'cypriotsyllabary',
+'blk=cyrillic' => 'cyrillic',
+'blk=cyrillicexta' => 'cyrillicexta',
+'blk=cyrillicextb' => 'cyrillicextb',
+'blk=cyrillicextc' => 'cyrillicextc',
+'blk=cyrillicextendeda' => 'cyrillicexta',
+'blk=cyrillicextendedb' => 'cyrillicextb',
+'blk=cyrillicextendedc' => 'cyrillicextc',
+'blk=cyrillicsup' => 'cyrillicsup',
+'blk=cyrillicsupplement' => 'cyrillicsup',
+'blk=cyrillicsupplementary' => 'cyrillicsup',
+'blk=deseret' => 'deseret',
+'blk=devanagari' => 'devanagari',
+'blk=devanagariext' => 'devanagariext',
+'blk=devanagariextended' => 'devanagariext',
+'blk=diacriticals' => 'diacriticals',
+'blk=diacriticalsext' => 'diacriticalsext',
+'blk=diacriticalsforsymbols' => 'diacriticalsforsymbols',
+'blk=diacriticalssup' => 'diacriticalssup',
+'blk=dingbats' => 'dingbats',
+'blk=dogra' => 'dogra',
+'blk=domino' => 'domino',
+'blk=dominotiles' => 'domino',
+'blk=duployan' => 'duployan',
+'blk=earlydynasticcuneiform' => 'earlydynasticcuneiform',
+'blk=egyptianhieroglyphformatcontrols' => 'egyptianhieroglyphformatcontrols',
+'blk=egyptianhieroglyphs' => 'egyptianhieroglyphs',
+'blk=elbasan' => 'elbasan',
+'blk=elymaic' => 'elymaic',
+'blk=emoticons' => 'emoticons',
+'blk=enclosedalphanum' => 'enclosedalphanum',
+'blk=enclosedalphanumerics' => 'enclosedalphanum',
+'blk=enclosedalphanumericsupplement' => 'enclosedalphanumsup',
+'blk=enclosedalphanumsup' => 'enclosedalphanumsup',
+'blk=enclosedcjk' => 'enclosedcjk',
+'blk=enclosedcjklettersandmonths' => 'enclosedcjk',
+'blk=enclosedideographicsup' => 'enclosedideographicsup',
+'blk=enclosedideographicsupplement' => 'enclosedideographicsup',
+'blk=ethiopic' => 'ethiopic',
+'blk=ethiopicext' => 'ethiopicext',
+'blk=ethiopicexta' => 'ethiopicexta',
+'blk=ethiopicextended' => 'ethiopicext',
+'blk=ethiopicextendeda' => 'ethiopicexta',
+'blk=ethiopicsup' => 'ethiopicsup',
+'blk=ethiopicsupplement' => 'ethiopicsup',
+'blk=generalpunctuation' => 'punctuation',
+'blk=geometricshapes' => 'geometricshapes',
+'blk=geometricshapesext' => 'geometricshapesext',
+'blk=geometricshapesextended' => 'geometricshapesext',
+'blk=georgian' => 'georgian',
+'blk=georgianext' => 'georgianext',
+'blk=georgianextended' => 'georgianext',
+'blk=georgiansup' => 'georgiansup',
+'blk=georgiansupplement' => 'georgiansup',
+'blk=glagolitic' => 'glagolitic',
+'blk=glagoliticsup' => 'glagoliticsup',
+'blk=glagoliticsupplement' => 'glagoliticsup',
+'blk=gothic' => 'gothic',
+'blk=grantha' => 'grantha',
+'blk=greek' => 'greek',
+'blk=greekandcoptic' => 'greek',
+'blk=greekext' => 'greekext',
+'blk=greekextended' => 'greekext',
+'blk=gujarati' => 'gujarati',
+'blk=gunjalagondi' => 'gunjalagondi',
+'blk=gurmukhi' => 'gurmukhi',
+'blk=halfandfullforms' => 'halfandfullforms',
+'blk=halfmarks' => 'halfmarks',
+'blk=halfwidthandfullwidthforms' => 'halfandfullforms',
+'blk=hangul' => 'hangul',
+'blk=hangulcompatibilityjamo' => 'compatjamo',
+'blk=hanguljamo' => 'jamo',
+'blk=hanguljamoextendeda' => 'jamoexta',
+'blk=hanguljamoextendedb' => 'jamoextb',
+'blk=hangulsyllables' => 'hangul',
+'blk=hanifirohingya' => 'hanifirohingya',
+'blk=hanunoo' => 'hanunoo',
+'blk=hatran' => 'hatran',
+'blk=hebrew' => 'hebrew',
+'blk=highprivateusesurrogates' => 'highpusurrogates',
+'blk=highpusurrogates' => 'highpusurrogates',
+'blk=highsurrogates' => 'highsurrogates',
+'blk=hiragana' => 'hiragana',
+'blk=idc' => 'idc',
+'blk=ideographicdescriptioncharacters' => 'idc',
+'blk=ideographicsymbols' => 'ideographicsymbols',
+'blk=ideographicsymbolsandpunctuation' => 'ideographicsymbols',
+'blk=imperialaramaic' => 'imperialaramaic',
+'blk=indicnumberforms' => 'indicnumberforms',
+'blk=indicsiyaqnumbers' => 'indicsiyaqnumbers',
+'blk=inscriptionalpahlavi' => 'inscriptionalpahlavi',
+'blk=inscriptionalparthian' => 'inscriptionalparthian',
+'blk=ipaext' => 'ipaext',
+'blk=ipaextensions' => 'ipaext',
+'blk=jamo' => 'jamo',
+'blk=jamoexta' => 'jamoexta',
+'blk=jamoextb' => 'jamoextb',
+'blk=javanese' => 'javanese',
+'blk=kaithi' => 'kaithi',
+'blk=kanaexta' => 'kanaexta',
+'blk=kanaextendeda' => 'kanaexta',
+'blk=kanasup' => 'kanasup',
+'blk=kanasupplement' => 'kanasup',
+'blk=kanbun' => 'kanbun',
+'blk=kangxi' => 'kangxi',
+'blk=kangxiradicals' => 'kangxi',
+'blk=kannada' => 'kannada',
+'blk=katakana' => 'katakana',
+'blk=katakanaext' => 'katakanaext',
+'blk=katakanaphoneticextensions' => 'katakanaext',
+'blk=kayahli' => 'kayahli',
+'blk=kharoshthi' => 'kharoshthi',
+'blk=khmer' => 'khmer',
+'blk=khmersymbols' => 'khmersymbols',
+'blk=khojki' => 'khojki',
+'blk=khudawadi' => 'khudawadi',
+'blk=lao' => 'lao',
+'blk=latin1' => 'latin1sup',
+'blk=latin1sup' => 'latin1sup',
+'blk=latin1supplement' => 'latin1sup',
+'blk=latinexta' => 'latinexta',
+'blk=latinextadditional' => 'latinextadditional',
+'blk=latinextb' => 'latinextb',
+'blk=latinextc' => 'latinextc',
+'blk=latinextd' => 'latinextd',
+'blk=latinexte' => 'latinexte',
+'blk=latinextendeda' => 'latinexta',
+'blk=latinextendedadditional' => 'latinextadditional',
+'blk=latinextendedb' => 'latinextb',
+'blk=latinextendedc' => 'latinextc',
+'blk=latinextendedd' => 'latinextd',
+'blk=latinextendede' => 'latinexte',
+'blk=lepcha' => 'lepcha',
+'blk=letterlikesymbols' => 'letterlikesymbols',
+'blk=limbu' => 'limbu',
+'blk=lineara' => 'lineara',
+'blk=linearbideograms' => 'linearbideograms',
+'blk=linearbsyllabary' => 'linearbsyllabary',
+'blk=lisu' => 'lisu',
+'blk=lowsurrogates' => 'lowsurrogates',
+'blk=lycian' => 'lycian',
+'blk=lydian' => 'lydian',
+'blk=mahajani' => 'mahajani',
+'blk=mahjong' => 'mahjong',
+'blk=mahjongtiles' => 'mahjong',
+'blk=makasar' => 'makasar',
+'blk=malayalam' => 'malayalam',
+'blk=mandaic' => 'mandaic',
+'blk=manichaean' => 'manichaean',
+'blk=marchen' => 'marchen',
+'blk=masaramgondi' => 'masaramgondi',
+'blk=mathalphanum' => 'mathalphanum',
+'blk=mathematicalalphanumericsymbols' => 'mathalphanum',
+'blk=mathematicaloperators' => 'mathoperators',
+'blk=mathoperators' => 'mathoperators',
+'blk=mayannumerals' => 'mayannumerals',
+'blk=medefaidrin' => 'medefaidrin',
+'blk=meeteimayek' => 'meeteimayek',
+'blk=meeteimayekext' => 'meeteimayekext',
+'blk=meeteimayekextensions' => 'meeteimayekext',
+'blk=mendekikakui' => 'mendekikakui',
+'blk=meroiticcursive' => 'meroiticcursive',
+'blk=meroitichieroglyphs' => 'meroitichieroglyphs',
+'blk=miao' => 'miao',
+'blk=miscarrows' => 'miscarrows',
+'blk=miscellaneousmathematicalsymbolsa' => 'miscmathsymbolsa',
+'blk=miscellaneousmathematicalsymbolsb' => 'miscmathsymbolsb',
+'blk=miscellaneoussymbols' => 'miscsymbols',
+'blk=miscellaneoussymbolsandarrows' => 'miscarrows',
+'blk=miscellaneoussymbolsandpictographs' => 'miscpictographs',
+'blk=miscellaneoustechnical' => 'misctechnical',
+'blk=miscmathsymbolsa' => 'miscmathsymbolsa',
+'blk=miscmathsymbolsb' => 'miscmathsymbolsb',
+'blk=miscpictographs' => 'miscpictographs',
+'blk=miscsymbols' => 'miscsymbols',
+'blk=misctechnical' => 'misctechnical',
+'blk=modi' => 'modi',
+'blk=modifierletters' => 'modifierletters',
+'blk=modifiertoneletters' => 'modifiertoneletters',
+'blk=mongolian' => 'mongolian',
+'blk=mongoliansup' => 'mongoliansup',
+'blk=mongoliansupplement' => 'mongoliansup',
+'blk=mro' => 'mro',
+'blk=multani' => 'multani',
+'blk=music' => 'music',
+'blk=musicalsymbols' => 'music',
+'blk=myanmar' => 'myanmar',
+'blk=myanmarexta' => 'myanmarexta',
+'blk=myanmarextb' => 'myanmarextb',
+'blk=myanmarextendeda' => 'myanmarexta',
+'blk=myanmarextendedb' => 'myanmarextb',
+'blk=nabataean' => 'nabataean',
+'blk=nandinagari' => 'nandinagari',
+'blk=nb' => 'nb',
+'blk=newa' => 'newa',
+'blk=newtailue' => 'newtailue',
+'blk=nko' => 'nko',
+'blk=noblock' => 'nb',
+'blk=numberforms' => 'numberforms',
+'blk=nushu' => 'nushu',
+'blk=nyiakengpuachuehmong' => 'nyiakengpuachuehmong',
+'blk=ocr' => 'ocr',
+'blk=ogham' => 'ogham',
+'blk=olchiki' => 'olchiki',
+'blk=oldhungarian' => 'oldhungarian',
+'blk=olditalic' => 'olditalic',
+'blk=oldnortharabian' => 'oldnortharabian',
+'blk=oldpermic' => 'oldpermic',
+'blk=oldpersian' => 'oldpersian',
+'blk=oldsogdian' => 'oldsogdian',
+'blk=oldsoutharabian' => 'oldsoutharabian',
+'blk=oldturkic' => 'oldturkic',
+'blk=opticalcharacterrecognition' => 'ocr',
+'blk=oriya' => 'oriya',
+'blk=ornamentaldingbats' => 'ornamentaldingbats',
+'blk=osage' => 'osage',
+'blk=osmanya' => 'osmanya',
+'blk=ottomansiyaqnumbers' => 'ottomansiyaqnumbers',
+'blk=pahawhhmong' => 'pahawhhmong',
+'blk=palmyrene' => 'palmyrene',
+'blk=paucinhau' => 'paucinhau',
+'blk=phagspa' => 'phagspa',
+'blk=phaistos' => 'phaistos',
+'blk=phaistosdisc' => 'phaistos',
+'blk=phoenician' => 'phoenician',
+'blk=phoneticext' => 'phoneticext',
+'blk=phoneticextensions' => 'phoneticext',
+'blk=phoneticextensionssupplement' => 'phoneticextsup',
+'blk=phoneticextsup' => 'phoneticextsup',
+'blk=playingcards' => 'playingcards',
+'blk=privateuse' => 'pua',
+'blk=privateusearea' => 'pua',
+'blk=psalterpahlavi' => 'psalterpahlavi',
+'blk=pua' => 'pua',
+'blk=punctuation' => 'punctuation',
+'blk=rejang' => 'rejang',
+'blk=rumi' => 'rumi',
+'blk=ruminumeralsymbols' => 'rumi',
+'blk=runic' => 'runic',
+'blk=samaritan' => 'samaritan',
+'blk=saurashtra' => 'saurashtra',
+'blk=sharada' => 'sharada',
+'blk=shavian' => 'shavian',
+'blk=shorthandformatcontrols' => 'shorthandformatcontrols',
+'blk=siddham' => 'siddham',
+'blk=sinhala' => 'sinhala',
+'blk=sinhalaarchaicnumbers' => 'sinhalaarchaicnumbers',
+'blk=smallforms' => 'smallforms',
+'blk=smallformvariants' => 'smallforms',
+'blk=smallkanaext' => 'smallkanaext',
+'blk=smallkanaextension' => 'smallkanaext',
+'blk=sogdian' => 'sogdian',
+'blk=sorasompeng' => 'sorasompeng',
+'blk=soyombo' => 'soyombo',
+'blk=spacingmodifierletters' => 'modifierletters',
+'blk=specials' => 'specials',
+'blk=sundanese' => 'sundanese',
+'blk=sundanesesup' => 'sundanesesup',
+'blk=sundanesesupplement' => 'sundanesesup',
+'blk=suparrowsa' => 'suparrowsa',
+'blk=suparrowsb' => 'suparrowsb',
+'blk=suparrowsc' => 'suparrowsc',
+'blk=superandsub' => 'superandsub',
+'blk=superscriptsandsubscripts' => 'superandsub',
+'blk=supmathoperators' => 'supmathoperators',
+'blk=supplementalarrowsa' => 'suparrowsa',
+'blk=supplementalarrowsb' => 'suparrowsb',
+'blk=supplementalarrowsc' => 'suparrowsc',
+'blk=supplementalmathematicaloperators' => 'supmathoperators',
+'blk=supplementalpunctuation' => 'suppunctuation',
+'blk=supplementalsymbolsandpictographs' => 'supsymbolsandpictographs',
+'blk=supplementaryprivateuseareaa' => 'suppuaa',
+'blk=supplementaryprivateuseareab' => 'suppuab',
+'blk=suppuaa' => 'suppuaa',
+'blk=suppuab' => 'suppuab',
+'blk=suppunctuation' => 'suppunctuation',
+'blk=supsymbolsandpictographs' => 'supsymbolsandpictographs',
+'blk=suttonsignwriting' => 'suttonsignwriting',
+'blk=sylotinagri' => 'sylotinagri',
+'blk=symbolsandpictographsexta' => 'symbolsandpictographsexta',
+'blk=symbolsandpictographsextendeda' => 'symbolsandpictographsexta',
+'blk=syriac' => 'syriac',
+'blk=syriacsup' => 'syriacsup',
+'blk=syriacsupplement' => 'syriacsup',
+'blk=tagalog' => 'tagalog',
+'blk=tagbanwa' => 'tagbanwa',
+'blk=tags' => 'tags',
+'blk=taile' => 'taile',
+'blk=taitham' => 'taitham',
+'blk=taiviet' => 'taiviet',
+'blk=taixuanjing' => 'taixuanjing',
+'blk=taixuanjingsymbols' => 'taixuanjing',
+'blk=takri' => 'takri',
+'blk=tamil' => 'tamil',
+'blk=tamilsup' => 'tamilsup',
+'blk=tamilsupplement' => 'tamilsup',
+'blk=tangut' => 'tangut',
+'blk=tangutcomponents' => 'tangutcomponents',
+'blk=telugu' => 'telugu',
+'blk=thaana' => 'thaana',
+'blk=thai' => 'thai',
+'blk=tibetan' => 'tibetan',
+'blk=tifinagh' => 'tifinagh',
+'blk=tirhuta' => 'tirhuta',
+'blk=transportandmap' => 'transportandmap',
+'blk=transportandmapsymbols' => 'transportandmap',
+'blk=ucas' => 'ucas',
+'blk=ucasext' => 'ucasext',
+'blk=ugaritic' => 'ugaritic',
+'blk=unifiedcanadianaboriginalsyllabics' => 'ucas',
+'blk=unifiedcanadianaboriginalsyllabicsextended' => 'ucasext',
+'blk=vai' => 'vai',
+'blk=variationselectors' => 'vs',
+'blk=variationselectorssupplement' => 'vssup',
+'blk=vedicext' => 'vedicext',
+'blk=vedicextensions' => 'vedicext',
+'blk=verticalforms' => 'verticalforms',
+'blk=vs' => 'vs',
+'blk=vssup' => 'vssup',
+'blk=wancho' => 'wancho',
+'blk=warangciti' => 'warangciti',
+'blk=yijing' => 'yijing',
+'blk=yijinghexagramsymbols' => 'yijing',
+'blk=yiradicals' => 'yiradicals',
+'blk=yisyllables' => 'yisyllables',
+'blk=zanabazarsquare' => 'zanabazarsquare',
+'bpt=c' => 'c',
+'bpt=close' => 'c',
+'bpt=n' => 'n',
+'bpt=none' => 'n',
+'bpt=o' => 'o',
+'bpt=open' => 'o',
+'cased=f' => 'n',
+'cased=false' => 'n',
+'cased=n' => 'n',
+'cased=no' => 'n',
+'cased=t' => 'y',
+'cased=true' => 'y',
+'cased=y' => 'y',
+'cased=yes' => 'y',
+'ccc=0' => 'nr',
+'ccc=1' => 'ov',
+'ccc=10' => 'ccc10',
+'ccc=103' => 'ccc103',
+'ccc=107' => 'ccc107',
+'ccc=11' => 'ccc11',
+'ccc=118' => 'ccc118',
+'ccc=12' => 'ccc12',
+'ccc=122' => 'ccc122',
+'ccc=129' => 'ccc129',
+'ccc=13' => 'ccc13',
+'ccc=130' => 'ccc130',
+'ccc=132' => 'ccc132',
+'ccc=133' => 'ccc133',
+'ccc=14' => 'ccc14',
+'ccc=15' => 'ccc15',
+'ccc=16' => 'ccc16',
+'ccc=17' => 'ccc17',
+'ccc=18' => 'ccc18',
+'ccc=19' => 'ccc19',
+'ccc=20' => 'ccc20',
+'ccc=200' => 'atbl',
+'ccc=202' => 'atb',
+'ccc=21' => 'ccc21',
+'ccc=214' => 'ata',
+'ccc=216' => 'atar',
+'ccc=218' => 'bl',
+'ccc=22' => 'ccc22',
+'ccc=220' => 'b',
+'ccc=222' => 'br',
+'ccc=224' => 'l',
+'ccc=226' => 'r',
+'ccc=228' => 'al',
+'ccc=23' => 'ccc23',
+'ccc=230' => 'a',
+'ccc=232' => 'ar',
+'ccc=233' => 'db',
+'ccc=234' => 'da',
+'ccc=24' => 'ccc24',
+'ccc=240' => 'is',
+'ccc=25' => 'ccc25',
+'ccc=26' => 'ccc26',
+'ccc=27' => 'ccc27',
+'ccc=28' => 'ccc28',
+'ccc=29' => 'ccc29',
+'ccc=30' => 'ccc30',
+'ccc=31' => 'ccc31',
+'ccc=32' => 'ccc32',
+'ccc=33' => 'ccc33',
+'ccc=34' => 'ccc34',
+'ccc=35' => 'ccc35',
+'ccc=36' => 'ccc36',
+'ccc=7' => 'nk',
+'ccc=8' => 'kv',
+'ccc=84' => 'ccc84',
+'ccc=9' => 'vr',
+'ccc=91' => 'ccc91',
+'ccc=a' => 'a',
+'ccc=above' => 'a',
+'ccc=aboveleft' => 'al',
+'ccc=aboveright' => 'ar',
+'ccc=al' => 'al',
+'ccc=ar' => 'ar',
+'ccc=ata' => 'ata',
+'ccc=atar' => 'atar',
+'ccc=atb' => 'atb',
+'ccc=atbl' => 'atbl',
+'ccc=attachedabove' => 'ata',
+'ccc=attachedaboveright' => 'atar',
+'ccc=attachedbelow' => 'atb',
+'ccc=attachedbelowleft' => 'atbl',
+'ccc=b' => 'b',
+'ccc=below' => 'b',
+'ccc=belowleft' => 'bl',
+'ccc=belowright' => 'br',
+'ccc=bl' => 'bl',
+'ccc=br' => 'br',
+'ccc=ccc10' => 'ccc10',
+'ccc=ccc103' => 'ccc103',
+'ccc=ccc107' => 'ccc107',
+'ccc=ccc11' => 'ccc11',
+'ccc=ccc118' => 'ccc118',
+'ccc=ccc12' => 'ccc12',
+'ccc=ccc122' => 'ccc122',
+'ccc=ccc129' => 'ccc129',
+'ccc=ccc13' => 'ccc13',
+'ccc=ccc130' => 'ccc130',
+'ccc=ccc132' => 'ccc132',
+'ccc=ccc133' => 'ccc133',
+'ccc=ccc14' => 'ccc14',
+'ccc=ccc15' => 'ccc15',
+'ccc=ccc16' => 'ccc16',
+'ccc=ccc17' => 'ccc17',
+'ccc=ccc18' => 'ccc18',
+'ccc=ccc19' => 'ccc19',
+'ccc=ccc20' => 'ccc20',
+'ccc=ccc21' => 'ccc21',
+'ccc=ccc22' => 'ccc22',
+'ccc=ccc23' => 'ccc23',
+'ccc=ccc24' => 'ccc24',
+'ccc=ccc25' => 'ccc25',
+'ccc=ccc26' => 'ccc26',
+'ccc=ccc27' => 'ccc27',
+'ccc=ccc28' => 'ccc28',
+'ccc=ccc29' => 'ccc29',
+'ccc=ccc30' => 'ccc30',
+'ccc=ccc31' => 'ccc31',
+'ccc=ccc32' => 'ccc32',
+'ccc=ccc33' => 'ccc33',
+'ccc=ccc34' => 'ccc34',
+'ccc=ccc35' => 'ccc35',
+'ccc=ccc36' => 'ccc36',
+'ccc=ccc84' => 'ccc84',
+'ccc=ccc91' => 'ccc91',
+'ccc=da' => 'da',
+'ccc=db' => 'db',
+'ccc=doubleabove' => 'da',
+'ccc=doublebelow' => 'db',
+'ccc=iotasubscript' => 'is',
+'ccc=is' => 'is',
+'ccc=kanavoicing' => 'kv',
+'ccc=kv' => 'kv',
+'ccc=l' => 'l',
+'ccc=left' => 'l',
+'ccc=nk' => 'nk',
+'ccc=notreordered' => 'nr',
+'ccc=nr' => 'nr',
+'ccc=nukta' => 'nk',
+'ccc=ov' => 'ov',
+'ccc=overlay' => 'ov',
+'ccc=r' => 'r',
+'ccc=right' => 'r',
+'ccc=virama' => 'vr',
+'ccc=vr' => 'vr',
+'ce=f' => 'n',
+'ce=false' => 'n',
+'ce=n' => 'n',
+'ce=no' => 'n',
+'ce=t' => 'y',
+'ce=true' => 'y',
+'ce=y' => 'y',
+'ce=yes' => 'y',
+'ci=f' => 'n',
+'ci=false' => 'n',
+'ci=n' => 'n',
+'ci=no' => 'n',
+'ci=t' => 'y',
+'ci=true' => 'y',
+'ci=y' => 'y',
+'ci=yes' => 'y',
+'compex=f' => 'n',
+'compex=false' => 'n',
+'compex=n' => 'n',
+'compex=no' => 'n',
+'compex=t' => 'y',
+'compex=true' => 'y',
+'compex=y' => 'y',
+'compex=yes' => 'y',
+'cwcf=f' => 'n',
+'cwcf=false' => 'n',
+'cwcf=n' => 'n',
+'cwcf=no' => 'n',
+'cwcf=t' => 'y',
+'cwcf=true' => 'y',
+'cwcf=y' => 'y',
+'cwcf=yes' => 'y',
+'cwcm=f' => 'n',
+'cwcm=false' => 'n',
+'cwcm=n' => 'n',
+'cwcm=no' => 'n',
+'cwcm=t' => 'y',
+'cwcm=true' => 'y',
+'cwcm=y' => 'y',
+'cwcm=yes' => 'y',
+'cwkcf=f' => 'n',
+'cwkcf=false' => 'n',
+'cwkcf=n' => 'n',
+'cwkcf=no' => 'n',
+'cwkcf=t' => 'y',
+'cwkcf=true' => 'y',
+'cwkcf=y' => 'y',
+'cwkcf=yes' => 'y',
+'cwl=f' => 'n',
+'cwl=false' => 'n',
+'cwl=n' => 'n',
+'cwl=no' => 'n',
+'cwl=t' => 'y',
+'cwl=true' => 'y',
+'cwl=y' => 'y',
+'cwl=yes' => 'y',
+'cwt=f' => 'n',
+'cwt=false' => 'n',
+'cwt=n' => 'n',
+'cwt=no' => 'n',
+'cwt=t' => 'y',
+'cwt=true' => 'y',
+'cwt=y' => 'y',
+'cwt=yes' => 'y',
+'cwu=f' => 'n',
+'cwu=false' => 'n',
+'cwu=n' => 'n',
+'cwu=no' => 'n',
+'cwu=t' => 'y',
+'cwu=true' => 'y',
+'cwu=y' => 'y',
+'cwu=yes' => 'y',
+'dash=f' => 'n',
+'dash=false' => 'n',
+'dash=n' => 'n',
+'dash=no' => 'n',
+'dash=t' => 'y',
+'dash=true' => 'y',
+'dash=y' => 'y',
+'dash=yes' => 'y',
+'dep=f' => 'n',
+'dep=false' => 'n',
+'dep=n' => 'n',
+'dep=no' => 'n',
+'dep=t' => 'y',
+'dep=true' => 'y',
+'dep=y' => 'y',
+'dep=yes' => 'y',
+'di=f' => 'n',
+'di=false' => 'n',
+'di=n' => 'n',
+'di=no' => 'n',
+'di=t' => 'y',
+'di=true' => 'y',
+'di=y' => 'y',
+'di=yes' => 'y',
+'dia=f' => 'n',
+'dia=false' => 'n',
+'dia=n' => 'n',
+'dia=no' => 'n',
+'dia=t' => 'y',
+'dia=true' => 'y',
+'dia=y' => 'y',
+'dia=yes' => 'y',
+'dt=can' => 'can',
+'dt=canonical' => 'can',
+'dt=circle' => 'enc',
+'dt=com' => 'com',
+'dt=compat' => 'com',
+'dt=enc' => 'enc',
+'dt=fin' => 'fin',
+'dt=final' => 'fin',
+'dt=font' => 'font',
+'dt=fra' => 'fra',
+'dt=fraction' => 'fra',
+'dt=init' => 'init',
+'dt=initial' => 'init',
+'dt=iso' => 'iso',
+'dt=isolated' => 'iso',
+'dt=med' => 'med',
+'dt=medial' => 'med',
+'dt=nar' => 'nar',
+'dt=narrow' => 'nar',
+'dt=nb' => 'nb',
+'dt=nobreak' => 'nb',
+'dt=noncanon' => 'noncanon',
+'dt=noncanonical' => 'noncanon',
+'dt=none' => 'none',
+'dt=small' => 'sml',
+'dt=sml' => 'sml',
+'dt=sqr' => 'sqr',
+'dt=square' => 'sqr',
+'dt=sub' => 'sub',
+'dt=sup' => 'sup',
+'dt=super' => 'sup',
+'dt=vert' => 'vert',
+'dt=vertical' => 'vert',
+'dt=wide' => 'wide',
+'ea=a' => 'a',
+'ea=ambiguous' => 'a',
+'ea=f' => 'f',
+'ea=fullwidth' => 'f',
+'ea=h' => 'h',
+'ea=halfwidth' => 'h',
+'ea=n' => 'n',
+'ea=na' => 'na',
+'ea=narrow' => 'na',
+'ea=neutral' => 'n',
+'ea=w' => 'w',
+'ea=wide' => 'w',
+'ext=f' => 'n',
+'ext=false' => 'n',
+'ext=n' => 'n',
+'ext=no' => 'n',
+'ext=t' => 'y',
+'ext=true' => 'y',
+'ext=y' => 'y',
+'ext=yes' => 'y',
+'gc=c' => 'c',
+'gc=casedletter' => 'lc',
+'gc=cc' => 'cc',
+'gc=cf' => 'cf',
+'gc=closepunctuation' => 'pe',
+'gc=cn' => 'cn',
+'gc=cntrl' => 'cc',
+'gc=co' => 'co',
+'gc=combiningmark' => 'm',
+'gc=connectorpunctuation' => 'pc',
+'gc=control' => 'cc',
+'gc=cs' => 'cs',
+'gc=currencysymbol' => 'sc',
+'gc=dashpunctuation' => 'pd',
+'gc=decimalnumber' => 'nd',
+'gc=digit' => 'nd',
+'gc=enclosingmark' => 'me',
+'gc=finalpunctuation' => 'pf',
+'gc=format' => 'cf',
+'gc=initialpunctuation' => 'pi',
+'gc=l' => 'l',
+'gc=l&' => 'lc',
+'gc=l_' => 'lc',
+'gc=lc' => 'lc',
+'gc=letter' => 'l',
+'gc=letternumber' => 'nl',
+'gc=lineseparator' => 'zl',
+'gc=ll' => 'll',
+'gc=lm' => 'lm',
+'gc=lo' => 'lo',
+'gc=lowercaseletter' => 'll',
+'gc=lt' => 'lt',
+'gc=lu' => 'lu',
+'gc=m' => 'm',
+'gc=mark' => 'm',
+'gc=mathsymbol' => 'sm',
+'gc=mc' => 'mc',
+'gc=me' => 'me',
+'gc=mn' => 'mn',
+'gc=modifierletter' => 'lm',
+'gc=modifiersymbol' => 'sk',
+'gc=n' => 'n',
+'gc=nd' => 'nd',
+'gc=nl' => 'nl',
+'gc=no' => 'no',
+'gc=nonspacingmark' => 'mn',
+'gc=number' => 'n',
+'gc=openpunctuation' => 'ps',
+'gc=other' => 'c',
+'gc=otherletter' => 'lo',
+'gc=othernumber' => 'no',
+'gc=otherpunctuation' => 'po',
+'gc=othersymbol' => 'so',
+'gc=p' => 'p',
+'gc=paragraphseparator' => 'zp',
+'gc=pc' => 'pc',
+'gc=pd' => 'pd',
+'gc=pe' => 'pe',
+'gc=pf' => 'pf',
+'gc=pi' => 'pi',
+'gc=po' => 'po',
+'gc=privateuse' => 'co',
+'gc=ps' => 'ps',
+'gc=punct' => 'p',
+'gc=punctuation' => 'p',
+'gc=s' => 's',
+'gc=sc' => 'sc',
+'gc=separator' => 'z',
+'gc=sk' => 'sk',
+'gc=sm' => 'sm',
+'gc=so' => 'so',
+'gc=spaceseparator' => 'zs',
+'gc=spacingmark' => 'mc',
+'gc=surrogate' => 'cs',
+'gc=symbol' => 's',
+'gc=titlecaseletter' => 'lt',
+'gc=unassigned' => 'cn',
+'gc=uppercaseletter' => 'lu',
+'gc=z' => 'z',
+'gc=zl' => 'zl',
+'gc=zp' => 'zp',
+'gc=zs' => 'zs',
+'gcb=cn' => 'cn',
+'gcb=control' => 'cn',
+'gcb=cr' => 'cr',
+'gcb=eb' => 'eb',
+'gcb=ebase' => 'eb',
+'gcb=ebasegaz' => 'ebg',
+'gcb=ebg' => 'ebg',
+'gcb=em' => 'em',
+'gcb=emodifier' => 'em',
+'gcb=ex' => 'ex',
+'gcb=extend' => 'ex',
+'gcb=gaz' => 'gaz',
+'gcb=glueafterzwj' => 'gaz',
+'gcb=l' => 'l',
+'gcb=lf' => 'lf',
+'gcb=lv' => 'lv',
+'gcb=lvt' => 'lvt',
+'gcb=other' => 'xx',
+'gcb=pp' => 'pp',
+'gcb=prepend' => 'pp',
+'gcb=regionalindicator' => 'ri',
+'gcb=ri' => 'ri',
+'gcb=sm' => 'sm',
+'gcb=spacingmark' => 'sm',
+'gcb=t' => 't',
+'gcb=v' => 'v',
+'gcb=xx' => 'xx',
+'gcb=zwj' => 'zwj',
+'grbase=f' => 'n',
+'grbase=false' => 'n',
+'grbase=n' => 'n',
+'grbase=no' => 'n',
+'grbase=t' => 'y',
+'grbase=true' => 'y',
+'grbase=y' => 'y',
+'grbase=yes' => 'y',
+'grext=f' => 'n',
+'grext=false' => 'n',
+'grext=n' => 'n',
+'grext=no' => 'n',
+'grext=t' => 'y',
+'grext=true' => 'y',
+'grext=y' => 'y',
+'grext=yes' => 'y',
+'hex=f' => 'n',
+'hex=false' => 'n',
+'hex=n' => 'n',
+'hex=no' => 'n',
+'hex=t' => 'y',
+'hex=true' => 'y',
+'hex=y' => 'y',
+'hex=yes' => 'y',
+'hst=l' => 'l',
+'hst=leadingjamo' => 'l',
+'hst=lv' => 'lv',
+'hst=lvsyllable' => 'lv',
+'hst=lvt' => 'lvt',
+'hst=lvtsyllable' => 'lvt',
+'hst=na' => 'na',
+'hst=notapplicable' => 'na',
+'hst=t' => 't',
+'hst=trailingjamo' => 't',
+'hst=v' => 'v',
+'hst=voweljamo' => 'v',
+'hyphen=f' => 'n',
+'hyphen=false' => 'n',
+'hyphen=n' => 'n',
+'hyphen=no' => 'n',
+'hyphen=t' => 'y',
+'hyphen=true' => 'y',
+'hyphen=y' => 'y',
+'hyphen=yes' => 'y',
+'idc=f' => 'n',
+'idc=false' => 'n',
+'idc=n' => 'n',
+'idc=no' => 'n',
+'idc=t' => 'y',
+'idc=true' => 'y',
+'idc=y' => 'y',
+'idc=yes' => 'y',
+'ideo=f' => 'n',
+'ideo=false' => 'n',
+'ideo=n' => 'n',
+'ideo=no' => 'n',
+'ideo=t' => 'y',
+'ideo=true' => 'y',
+'ideo=y' => 'y',
+'ideo=yes' => 'y',
+'ids=f' => 'n',
+'ids=false' => 'n',
+'ids=n' => 'n',
+'ids=no' => 'n',
+'ids=t' => 'y',
+'ids=true' => 'y',
+'ids=y' => 'y',
+'ids=yes' => 'y',
+'idsb=f' => 'n',
+'idsb=false' => 'n',
+'idsb=n' => 'n',
+'idsb=no' => 'n',
+'idsb=t' => 'y',
+'idsb=true' => 'y',
+'idsb=y' => 'y',
+'idsb=yes' => 'y',
+'idst=f' => 'n',
+'idst=false' => 'n',
+'idst=n' => 'n',
+'idst=no' => 'n',
+'idst=t' => 'y',
+'idst=true' => 'y',
+'idst=y' => 'y',
+'idst=yes' => 'y',
+'in=1.1' => '1.1',
+'in=10.0' => '10.0',
+'in=11.0' => '11.0',
+'in=12.0' => '12.0',
+'in=12.1' => '12.1',
+'in=2.0' => '2.0',
+'in=2.1' => '2.1',
+'in=3.0' => '3.0',
+'in=3.1' => '3.1',
+'in=3.2' => '3.2',
+'in=4.0' => '4.0',
+'in=4.1' => '4.1',
+'in=5.0' => '5.0',
+'in=5.1' => '5.1',
+'in=5.2' => '5.2',
+'in=6.0' => '6.0',
+'in=6.1' => '6.1',
+'in=6.2' => '6.2',
+'in=6.3' => '6.3',
+'in=7.0' => '7.0',
+'in=8.0' => '8.0',
+'in=9.0' => '9.0',
+'in=unassigned' => 'unassigned',
+'in=v100' => '10.0',
+'in=v110' => '11.0',
+'in=v120' => '12.0',
+'in=v121' => '12.1',
+'in=v20' => '2.0',
+'in=v21' => '2.1',
+'in=v30' => '3.0',
+'in=v31' => '3.1',
+'in=v32' => '3.2',
+'in=v40' => '4.0',
+'in=v41' => '4.1',
+'in=v50' => '5.0',
+'in=v51' => '5.1',
+'in=v52' => '5.2',
+'in=v60' => '6.0',
+'in=v61' => '6.1',
+'in=v62' => '6.2',
+'in=v63' => '6.3',
+'in=v70' => '7.0',
+'in=v80' => '8.0',
+'in=v90' => '9.0',
+'inpc=bottom' => 'bottom',
+'inpc=bottomandleft' => 'bottomandleft',
+'inpc=bottomandright' => 'bottomandright',
+'inpc=left' => 'left',
+'inpc=leftandright' => 'leftandright',
+'inpc=na' => 'na',
+'inpc=overstruck' => 'overstruck',
+'inpc=right' => 'right',
+'inpc=top' => 'top',
+'inpc=topandbottom' => 'topandbottom',
+'inpc=topandbottomandright' => 'topandbottomandright',
+'inpc=topandleft' => 'topandleft',
+'inpc=topandleftandright' => 'topandleftandright',
+'inpc=topandright' => 'topandright',
+'inpc=visualorderleft' => 'visualorderleft',
+'insc=avagraha' => 'avagraha',
+'insc=bindu' => 'bindu',
+'insc=brahmijoiningnumber' => 'brahmijoiningnumber',
+'insc=cantillationmark' => 'cantillationmark',
+'insc=consonant' => 'consonant',
+'insc=consonantdead' => 'consonantdead',
+'insc=consonantfinal' => 'consonantfinal',
+'insc=consonantheadletter' => 'consonantheadletter',
+'insc=consonantinitialpostfixed' => 'consonantinitialpostfixed',
+'insc=consonantkiller' => 'consonantkiller',
+'insc=consonantmedial' => 'consonantmedial',
+'insc=consonantplaceholder' => 'consonantplaceholder',
+'insc=consonantprecedingrepha' => 'consonantprecedingrepha',
+'insc=consonantprefixed' => 'consonantprefixed',
+'insc=consonantsubjoined' => 'consonantsubjoined',
+'insc=consonantsucceedingrepha' => 'consonantsucceedingrepha',
+'insc=consonantwithstacker' => 'consonantwithstacker',
+'insc=geminationmark' => 'geminationmark',
+'insc=invisiblestacker' => 'invisiblestacker',
+'insc=joiner' => 'joiner',
+'insc=modifyingletter' => 'modifyingletter',
+'insc=nonjoiner' => 'nonjoiner',
+'insc=nukta' => 'nukta',
+'insc=number' => 'number',
+'insc=numberjoiner' => 'numberjoiner',
+'insc=other' => 'other',
+'insc=purekiller' => 'purekiller',
+'insc=registershifter' => 'registershifter',
+'insc=syllablemodifier' => 'syllablemodifier',
+'insc=toneletter' => 'toneletter',
+'insc=tonemark' => 'tonemark',
+'insc=virama' => 'virama',
+'insc=visarga' => 'visarga',
+'insc=vowel' => 'vowel',
+'insc=voweldependent' => 'voweldependent',
+'insc=vowelindependent' => 'vowelindependent',
+'jg=africanfeh' => 'africanfeh',
+'jg=africannoon' => 'africannoon',
+'jg=africanqaf' => 'africanqaf',
+'jg=ain' => 'ain',
+'jg=alaph' => 'alaph',
+'jg=alef' => 'alef',
+'jg=beh' => 'beh',
+'jg=beth' => 'beth',
+'jg=burushaskiyehbarree' => 'burushaskiyehbarree',
+'jg=dal' => 'dal',
+'jg=dalathrish' => 'dalathrish',
+'jg=e' => 'e',
+'jg=farsiyeh' => 'farsiyeh',
+'jg=fe' => 'fe',
+'jg=feh' => 'feh',
+'jg=finalsemkath' => 'finalsemkath',
+'jg=gaf' => 'gaf',
+'jg=gamal' => 'gamal',
+'jg=hah' => 'hah',
+'jg=hamzaonhehgoal' => 'tehmarbutagoal',
+'jg=hanifirohingyakinnaya' => 'hanifirohingyakinnaya',
+'jg=hanifirohingyapa' => 'hanifirohingyapa',
+'jg=he' => 'he',
+'jg=heh' => 'heh',
+'jg=hehgoal' => 'hehgoal',
+'jg=heth' => 'heth',
+'jg=kaf' => 'kaf',
+'jg=kaph' => 'kaph',
+'jg=khaph' => 'khaph',
+'jg=knottedheh' => 'knottedheh',
+'jg=lam' => 'lam',
+'jg=lamadh' => 'lamadh',
+'jg=malayalambha' => 'malayalambha',
+'jg=malayalamja' => 'malayalamja',
+'jg=malayalamlla' => 'malayalamlla',
+'jg=malayalamllla' => 'malayalamllla',
+'jg=malayalamnga' => 'malayalamnga',
+'jg=malayalamnna' => 'malayalamnna',
+'jg=malayalamnnna' => 'malayalamnnna',
+'jg=malayalamnya' => 'malayalamnya',
+'jg=malayalamra' => 'malayalamra',
+'jg=malayalamssa' => 'malayalamssa',
+'jg=malayalamtta' => 'malayalamtta',
+'jg=manichaeanaleph' => 'manichaeanaleph',
+'jg=manichaeanayin' => 'manichaeanayin',
+'jg=manichaeanbeth' => 'manichaeanbeth',
+'jg=manichaeandaleth' => 'manichaeandaleth',
+'jg=manichaeandhamedh' => 'manichaeandhamedh',
+'jg=manichaeanfive' => 'manichaeanfive',
+'jg=manichaeangimel' => 'manichaeangimel',
+'jg=manichaeanheth' => 'manichaeanheth',
+'jg=manichaeanhundred' => 'manichaeanhundred',
+'jg=manichaeankaph' => 'manichaeankaph',
+'jg=manichaeanlamedh' => 'manichaeanlamedh',
+'jg=manichaeanmem' => 'manichaeanmem',
+'jg=manichaeannun' => 'manichaeannun',
+'jg=manichaeanone' => 'manichaeanone',
+'jg=manichaeanpe' => 'manichaeanpe',
+'jg=manichaeanqoph' => 'manichaeanqoph',
+'jg=manichaeanresh' => 'manichaeanresh',
+'jg=manichaeansadhe' => 'manichaeansadhe',
+'jg=manichaeansamekh' => 'manichaeansamekh',
+'jg=manichaeantaw' => 'manichaeantaw',
+'jg=manichaeanten' => 'manichaeanten',
+'jg=manichaeanteth' => 'manichaeanteth',
+'jg=manichaeanthamedh' => 'manichaeanthamedh',
+'jg=manichaeantwenty' => 'manichaeantwenty',
+'jg=manichaeanwaw' => 'manichaeanwaw',
+'jg=manichaeanyodh' => 'manichaeanyodh',
+'jg=manichaeanzayin' => 'manichaeanzayin',
+'jg=meem' => 'meem',
+'jg=mim' => 'mim',
+'jg=nojoininggroup' => 'nojoininggroup',
+'jg=noon' => 'noon',
+'jg=nun' => 'nun',
+'jg=nya' => 'nya',
+'jg=pe' => 'pe',
+'jg=qaf' => 'qaf',
+'jg=qaph' => 'qaph',
+'jg=reh' => 'reh',
+'jg=reversedpe' => 'reversedpe',
+'jg=rohingyayeh' => 'rohingyayeh',
+'jg=sad' => 'sad',
+'jg=sadhe' => 'sadhe',
+'jg=seen' => 'seen',
+'jg=semkath' => 'semkath',
+'jg=shin' => 'shin',
+'jg=straightwaw' => 'straightwaw',
+'jg=swashkaf' => 'swashkaf',
+'jg=syriacwaw' => 'syriacwaw',
+'jg=tah' => 'tah',
+'jg=taw' => 'taw',
+'jg=tehmarbuta' => 'tehmarbuta',
+'jg=tehmarbutagoal' => 'tehmarbutagoal',
+'jg=teth' => 'teth',
+'jg=waw' => 'waw',
+'jg=yeh' => 'yeh',
+'jg=yehbarree' => 'yehbarree',
+'jg=yehwithtail' => 'yehwithtail',
+'jg=yudh' => 'yudh',
+'jg=yudhhe' => 'yudhhe',
+'jg=zain' => 'zain',
+'jg=zhain' => 'zhain',
+'joinc=f' => 'n',
+'joinc=false' => 'n',
+'joinc=n' => 'n',
+'joinc=no' => 'n',
+'joinc=t' => 'y',
+'joinc=true' => 'y',
+'joinc=y' => 'y',
+'joinc=yes' => 'y',
+'jt=c' => 'c',
+'jt=d' => 'd',
+'jt=dualjoining' => 'd',
+'jt=joincausing' => 'c',
+'jt=l' => 'l',
+'jt=leftjoining' => 'l',
+'jt=nonjoining' => 'u',
+'jt=r' => 'r',
+'jt=rightjoining' => 'r',
+'jt=t' => 't',
+'jt=transparent' => 't',
+'jt=u' => 'u',
+'lb=ai' => 'ai',
+'lb=al' => 'al',
+'lb=alphabetic' => 'al',
+'lb=ambiguous' => 'ai',
+'lb=b2' => 'b2',
+'lb=ba' => 'ba',
+'lb=bb' => 'bb',
+'lb=bk' => 'bk',
+'lb=breakafter' => 'ba',
+'lb=breakbefore' => 'bb',
+'lb=breakboth' => 'b2',
+'lb=breaksymbols' => 'sy',
+'lb=carriagereturn' => 'cr',
+'lb=cb' => 'cb',
+'lb=cj' => 'cj',
+'lb=cl' => 'cl',
+'lb=closeparenthesis' => 'cp',
+'lb=closepunctuation' => 'cl',
+'lb=cm' => 'cm',
+'lb=combiningmark' => 'cm',
+'lb=complexcontext' => 'sa',
+'lb=conditionaljapanesestarter' => 'cj',
+'lb=contingentbreak' => 'cb',
+'lb=cp' => 'cp',
+'lb=cr' => 'cr',
+'lb=eb' => 'eb',
+'lb=ebase' => 'eb',
+'lb=em' => 'em',
+'lb=emodifier' => 'em',
+'lb=ex' => 'ex',
+'lb=exclamation' => 'ex',
+'lb=gl' => 'gl',
+'lb=glue' => 'gl',
+'lb=h2' => 'h2',
+'lb=h3' => 'h3',
+'lb=hebrewletter' => 'hl',
+'lb=hl' => 'hl',
+'lb=hy' => 'hy',
+'lb=hyphen' => 'hy',
+'lb=id' => 'id',
+'lb=ideographic' => 'id',
+'lb=in' => 'in',
+'lb=infixnumeric' => 'is',
+'lb=inseparable' => 'in',
+'lb=inseperable' => 'in',
+'lb=is' => 'is',
+'lb=jl' => 'jl',
+'lb=jt' => 'jt',
+'lb=jv' => 'jv',
+'lb=lf' => 'lf',
+'lb=linefeed' => 'lf',
+'lb=mandatorybreak' => 'bk',
+'lb=nextline' => 'nl',
+'lb=nl' => 'nl',
+'lb=nonstarter' => 'ns',
+'lb=ns' => 'ns',
+'lb=nu' => 'nu',
+'lb=numeric' => 'nu',
+'lb=op' => 'op',
+'lb=openpunctuation' => 'op',
+'lb=po' => 'po',
+'lb=postfixnumeric' => 'po',
+'lb=pr' => 'pr',
+'lb=prefixnumeric' => 'pr',
+'lb=qu' => 'qu',
+'lb=quotation' => 'qu',
+'lb=regionalindicator' => 'ri',
+'lb=ri' => 'ri',
+'lb=sa' => 'sa',
+'lb=sg' => 'sg',
+'lb=sp' => 'sp',
+'lb=space' => 'sp',
+'lb=surrogate' => 'sg',
+'lb=sy' => 'sy',
+'lb=unknown' => 'xx',
+'lb=wj' => 'wj',
+'lb=wordjoiner' => 'wj',
+'lb=xx' => 'xx',
+'lb=zw' => 'zw',
+'lb=zwj' => 'zwj',
+'lb=zwspace' => 'zw',
+'loe=f' => 'n',
+'loe=false' => 'n',
+'loe=n' => 'n',
+'loe=no' => 'n',
+'loe=t' => 'y',
+'loe=true' => 'y',
+'loe=y' => 'y',
+'loe=yes' => 'y',
+'lower=f' => 'n',
+'lower=false' => 'n',
+'lower=n' => 'n',
+'lower=no' => 'n',
+'lower=t' => 'y',
+'lower=true' => 'y',
+'lower=y' => 'y',
+'lower=yes' => 'y',
+'math=f' => 'n',
+'math=false' => 'n',
+'math=n' => 'n',
+'math=no' => 'n',
+'math=t' => 'y',
+'math=true' => 'y',
+'math=y' => 'y',
+'math=yes' => 'y',
+'nchar=f' => 'n',
+'nchar=false' => 'n',
+'nchar=n' => 'n',
+'nchar=no' => 'n',
+'nchar=t' => 'y',
+'nchar=true' => 'y',
+'nchar=y' => 'y',
+'nchar=yes' => 'y',
+'nfcqc=m' => 'm',
+'nfcqc=maybe' => 'm',
+'nfcqc=n' => 'n',
+'nfcqc=no' => 'n',
+'nfcqc=y' => 'y',
+'nfcqc=yes' => 'y',
+'nfdqc=n' => 'n',
+'nfdqc=no' => 'n',
+'nfdqc=y' => 'y',
+'nfdqc=yes' => 'y',
+'nfkcqc=m' => 'm',
+'nfkcqc=maybe' => 'm',
+'nfkcqc=n' => 'n',
+'nfkcqc=no' => 'n',
+'nfkcqc=y' => 'y',
+'nfkcqc=yes' => 'y',
+'nfkdqc=n' => 'n',
+'nfkdqc=no' => 'n',
+'nfkdqc=y' => 'y',
+'nfkdqc=yes' => 'y',
+'nt=de' => 'de',
+'nt=decimal' => 'de',
+'nt=di' => 'di',
+'nt=digit' => 'di',
+'nt=none' => 'none',
+'nt=nu' => 'nu',
+'nt=numeric' => 'nu',
+'nv=-1/2' => '-1/2',
+'nv=0' => 0,
+'nv=1' => 1,
+'nv=1/10' => '1/10',
+'nv=1/12' => '1/12',
+'nv=1/16' => '1/16',
+'nv=1/160' => '1/160',
+'nv=1/2' => '1/2',
+'nv=1/20' => '1/20',
+'nv=1/3' => '1/3',
+'nv=1/32' => '1/32',
+'nv=1/320' => '1/320',
+'nv=1/4' => '1/4',
+'nv=1/40' => '1/40',
+'nv=1/5' => '1/5',
+'nv=1/6' => '1/6',
+'nv=1/64' => '1/64',
+'nv=1/7' => '1/7',
+'nv=1/8' => '1/8',
+'nv=1/80' => '1/80',
+'nv=1/9' => '1/9',
+'nv=10' => 10,
+'nv=100' => 100,
+'nv=1000' => 1000,
+'nv=10000' => 10000,
+'nv=100000' => 100000,
+'nv=1000000' => 1000000,
+'nv=10000000' => 10000000,
+'nv=100000000' => 100000000,
+'nv=10000000000' => 10000000000,
+'nv=1000000000000' => 1000000000000,
+'nv=11' => 11,
+'nv=11/12' => '11/12',
+'nv=11/2' => '11/2',
+'nv=12' => 12,
+'nv=13' => 13,
+'nv=13/2' => '13/2',
+'nv=14' => 14,
+'nv=15' => 15,
+'nv=15/2' => '15/2',
+'nv=16' => 16,
+'nv=17' => 17,
+'nv=17/2' => '17/2',
+'nv=18' => 18,
+'nv=19' => 19,
+'nv=2' => 2,
+'nv=2/3' => '2/3',
+'nv=2/5' => '2/5',
+'nv=20' => 20,
+'nv=200' => 200,
+'nv=2000' => 2000,
+'nv=20000' => 20000,
+'nv=200000' => 200000,
+'nv=20000000' => 20000000,
+'nv=21' => 21,
+'nv=216000' => 216000,
+'nv=22' => 22,
+'nv=23' => 23,
+'nv=24' => 24,
+'nv=25' => 25,
+'nv=26' => 26,
+'nv=27' => 27,
+'nv=28' => 28,
+'nv=29' => 29,
+'nv=3' => 3,
+'nv=3/16' => '3/16',
+'nv=3/2' => '3/2',
+'nv=3/20' => '3/20',
+'nv=3/4' => '3/4',
+'nv=3/5' => '3/5',
+'nv=3/64' => '3/64',
+'nv=3/8' => '3/8',
+'nv=3/80' => '3/80',
+'nv=30' => 30,
+'nv=300' => 300,
+'nv=3000' => 3000,
+'nv=30000' => 30000,
+'nv=300000' => 300000,
+'nv=31' => 31,
+'nv=32' => 32,
+'nv=33' => 33,
+'nv=34' => 34,
+'nv=35' => 35,
+'nv=36' => 36,
+'nv=37' => 37,
+'nv=38' => 38,
+'nv=39' => 39,
+'nv=4' => 4,
+'nv=4/5' => '4/5',
+'nv=40' => 40,
+'nv=400' => 400,
+'nv=4000' => 4000,
+'nv=40000' => 40000,
+'nv=400000' => 400000,
+'nv=41' => 41,
+'nv=42' => 42,
+'nv=43' => 43,
+'nv=432000' => 432000,
+'nv=44' => 44,
+'nv=45' => 45,
+'nv=46' => 46,
+'nv=47' => 47,
+'nv=48' => 48,
+'nv=49' => 49,
+'nv=5' => 5,
+'nv=5/12' => '5/12',
+'nv=5/2' => '5/2',
+'nv=5/6' => '5/6',
+'nv=5/8' => '5/8',
+'nv=50' => 50,
+'nv=500' => 500,
+'nv=5000' => 5000,
+'nv=50000' => 50000,
+'nv=500000' => 500000,
+'nv=6' => 6,
+'nv=60' => 60,
+'nv=600' => 600,
+'nv=6000' => 6000,
+'nv=60000' => 60000,
+'nv=600000' => 600000,
+'nv=7' => 7,
+'nv=7/12' => '7/12',
+'nv=7/2' => '7/2',
+'nv=7/8' => '7/8',
+'nv=70' => 70,
+'nv=700' => 700,
+'nv=7000' => 7000,
+'nv=70000' => 70000,
+'nv=700000' => 700000,
+'nv=8' => 8,
+'nv=80' => 80,
+'nv=800' => 800,
+'nv=8000' => 8000,
+'nv=80000' => 80000,
+'nv=800000' => 800000,
+'nv=9' => 9,
+'nv=9/2' => '9/2',
+'nv=90' => 90,
+'nv=900' => 900,
+'nv=9000' => 9000,
+'nv=90000' => 90000,
+'nv=900000' => 900000,
+'nv=nan' => 'nan',
+'patsyn=f' => 'n',
+'patsyn=false' => 'n',
+'patsyn=n' => 'n',
+'patsyn=no' => 'n',
+'patsyn=t' => 'y',
+'patsyn=true' => 'y',
+'patsyn=y' => 'y',
+'patsyn=yes' => 'y',
+'patws=f' => 'n',
+'patws=false' => 'n',
+'patws=n' => 'n',
+'patws=no' => 'n',
+'patws=t' => 'y',
+'patws=true' => 'y',
+'patws=y' => 'y',
+'patws=yes' => 'y',
+'pcm=f' => 'n',
+'pcm=false' => 'n',
+'pcm=n' => 'n',
+'pcm=no' => 'n',
+'pcm=t' => 'y',
+'pcm=true' => 'y',
+'pcm=y' => 'y',
+'pcm=yes' => 'y',
+'qmark=f' => 'n',
+'qmark=false' => 'n',
+'qmark=n' => 'n',
+'qmark=no' => 'n',
+'qmark=t' => 'y',
+'qmark=true' => 'y',
+'qmark=y' => 'y',
+'qmark=yes' => 'y',
+'radical=f' => 'n',
+'radical=false' => 'n',
+'radical=n' => 'n',
+'radical=no' => 'n',
+'radical=t' => 'y',
+'radical=true' => 'y',
+'radical=y' => 'y',
+'radical=yes' => 'y',
+'ri=f' => 'n',
+'ri=false' => 'n',
+'ri=n' => 'n',
+'ri=no' => 'n',
+'ri=t' => 'y',
+'ri=true' => 'y',
+'ri=y' => 'y',
+'ri=yes' => 'y',
+'sb=at' => 'at',
+'sb=aterm' => 'at',
+'sb=cl' => 'cl',
+'sb=close' => 'cl',
+'sb=cr' => 'cr',
+'sb=ex' => 'ex',
+'sb=extend' => 'ex',
+'sb=fo' => 'fo',
+'sb=format' => 'fo',
+'sb=le' => 'le',
+'sb=lf' => 'lf',
+'sb=lo' => 'lo',
+'sb=lower' => 'lo',
+'sb=nu' => 'nu',
+'sb=numeric' => 'nu',
+'sb=oletter' => 'le',
+'sb=other' => 'xx',
+'sb=sc' => 'sc',
+'sb=scontinue' => 'sc',
+'sb=se' => 'se',
+'sb=sep' => 'se',
+'sb=sp' => 'sp',
+'sb=st' => 'st',
+'sb=sterm' => 'st',
+'sb=up' => 'up',
+'sb=upper' => 'up',
+'sb=xx' => 'xx',
+'sc=adlam' => 'adlm',
+'sc=adlm' => 'adlm',
+'sc=aghb' => 'aghb',
+'sc=ahom' => 'ahom',
+'sc=anatolianhieroglyphs' => 'hluw',
+'sc=arab' => 'arab',
+'sc=arabic' => 'arab',
+'sc=armenian' => 'armn',
+'sc=armi' => 'armi',
+'sc=armn' => 'armn',
+'sc=avestan' => 'avst',
+'sc=avst' => 'avst',
+'sc=bali' => 'bali',
+'sc=balinese' => 'bali',
+'sc=bamu' => 'bamu',
+'sc=bamum' => 'bamu',
+'sc=bass' => 'bass',
+'sc=bassavah' => 'bass',
+'sc=batak' => 'batk',
+'sc=batk' => 'batk',
+'sc=beng' => 'beng',
+'sc=bengali' => 'beng',
+'sc=bhaiksuki' => 'bhks',
+'sc=bhks' => 'bhks',
+'sc=bopo' => 'bopo',
+'sc=bopomofo' => 'bopo',
+'sc=brah' => 'brah',
+'sc=brahmi' => 'brah',
+'sc=brai' => 'brai',
+'sc=braille' => 'brai',
+'sc=bugi' => 'bugi',
+'sc=buginese' => 'bugi',
+'sc=buhd' => 'buhd',
+'sc=buhid' => 'buhd',
+'sc=cakm' => 'cakm',
+'sc=canadianaboriginal' => 'cans',
+'sc=cans' => 'cans',
+'sc=cari' => 'cari',
+'sc=carian' => 'cari',
+'sc=caucasianalbanian' => 'aghb',
+'sc=chakma' => 'cakm',
+'sc=cham' => 'cham',
+'sc=cher' => 'cher',
+'sc=cherokee' => 'cher',
+'sc=common' => 'zyyy',
+'sc=copt' => 'copt',
+'sc=coptic' => 'copt',
+'sc=cprt' => 'cprt',
+'sc=cuneiform' => 'xsux',
+'sc=cypriot' => 'cprt',
+'sc=cyrillic' => 'cyrl',
+'sc=cyrl' => 'cyrl',
+'sc=deseret' => 'dsrt',
+'sc=deva' => 'deva',
+'sc=devanagari' => 'deva',
+'sc=dogr' => 'dogr',
+'sc=dogra' => 'dogr',
+'sc=dsrt' => 'dsrt',
+'sc=dupl' => 'dupl',
+'sc=duployan' => 'dupl',
+'sc=egyp' => 'egyp',
+'sc=egyptianhieroglyphs' => 'egyp',
+'sc=elba' => 'elba',
+'sc=elbasan' => 'elba',
+'sc=elym' => 'elym',
+'sc=elymaic' => 'elym',
+'sc=ethi' => 'ethi',
+'sc=ethiopic' => 'ethi',
+'sc=geor' => 'geor',
+'sc=georgian' => 'geor',
+'sc=glag' => 'glag',
+'sc=glagolitic' => 'glag',
+'sc=gong' => 'gong',
+'sc=gonm' => 'gonm',
+'sc=goth' => 'goth',
+'sc=gothic' => 'goth',
+'sc=gran' => 'gran',
+'sc=grantha' => 'gran',
+'sc=greek' => 'grek',
+'sc=grek' => 'grek',
+'sc=gujarati' => 'gujr',
+'sc=gujr' => 'gujr',
+'sc=gunjalagondi' => 'gong',
+'sc=gurmukhi' => 'guru',
+'sc=guru' => 'guru',
+'sc=han' => 'hani',
+'sc=hang' => 'hang',
+'sc=hangul' => 'hang',
+'sc=hani' => 'hani',
+'sc=hanifirohingya' => 'rohg',
+'sc=hano' => 'hano',
+'sc=hanunoo' => 'hano',
+'sc=hatr' => 'hatr',
+'sc=hatran' => 'hatr',
+'sc=hebr' => 'hebr',
+'sc=hebrew' => 'hebr',
+'sc=hira' => 'hira',
+'sc=hiragana' => 'hira',
+'sc=hluw' => 'hluw',
+'sc=hmng' => 'hmng',
+'sc=hmnp' => 'hmnp',
+'sc=hung' => 'hung',
+'sc=imperialaramaic' => 'armi',
+'sc=inherited' => 'zinh',
+'sc=inscriptionalpahlavi' => 'phli',
+'sc=inscriptionalparthian' => 'prti',
+'sc=ital' => 'ital',
+'sc=java' => 'java',
+'sc=javanese' => 'java',
+'sc=kaithi' => 'kthi',
+'sc=kali' => 'kali',
+'sc=kana' => 'kana',
+'sc=kannada' => 'knda',
+'sc=katakana' => 'kana',
+'sc=kayahli' => 'kali',
+'sc=khar' => 'khar',
+'sc=kharoshthi' => 'khar',
+'sc=khmer' => 'khmr',
+'sc=khmr' => 'khmr',
+'sc=khoj' => 'khoj',
+'sc=khojki' => 'khoj',
+'sc=khudawadi' => 'sind',
+'sc=knda' => 'knda',
+'sc=kthi' => 'kthi',
+'sc=lana' => 'lana',
+'sc=lao' => 'laoo',
+'sc=laoo' => 'laoo',
+'sc=latin' => 'latn',
+'sc=latn' => 'latn',
+'sc=lepc' => 'lepc',
+'sc=lepcha' => 'lepc',
+'sc=limb' => 'limb',
+'sc=limbu' => 'limb',
+'sc=lina' => 'lina',
+'sc=linb' => 'linb',
+'sc=lineara' => 'lina',
+'sc=linearb' => 'linb',
+'sc=lisu' => 'lisu',
+'sc=lyci' => 'lyci',
+'sc=lycian' => 'lyci',
+'sc=lydi' => 'lydi',
+'sc=lydian' => 'lydi',
+'sc=mahajani' => 'mahj',
+'sc=mahj' => 'mahj',
+'sc=maka' => 'maka',
+'sc=makasar' => 'maka',
+'sc=malayalam' => 'mlym',
+'sc=mand' => 'mand',
+'sc=mandaic' => 'mand',
+'sc=mani' => 'mani',
+'sc=manichaean' => 'mani',
+'sc=marc' => 'marc',
+'sc=marchen' => 'marc',
+'sc=masaramgondi' => 'gonm',
+'sc=medefaidrin' => 'medf',
+'sc=medf' => 'medf',
+'sc=meeteimayek' => 'mtei',
+'sc=mend' => 'mend',
+'sc=mendekikakui' => 'mend',
+'sc=merc' => 'merc',
+'sc=mero' => 'mero',
+'sc=meroiticcursive' => 'merc',
+'sc=meroitichieroglyphs' => 'mero',
+'sc=miao' => 'plrd',
+'sc=mlym' => 'mlym',
+'sc=modi' => 'modi',
+'sc=mong' => 'mong',
+'sc=mongolian' => 'mong',
+'sc=mro' => 'mroo',
+'sc=mroo' => 'mroo',
+'sc=mtei' => 'mtei',
+'sc=mult' => 'mult',
+'sc=multani' => 'mult',
+'sc=myanmar' => 'mymr',
+'sc=mymr' => 'mymr',
+'sc=nabataean' => 'nbat',
+'sc=nand' => 'nand',
+'sc=nandinagari' => 'nand',
+'sc=narb' => 'narb',
+'sc=nbat' => 'nbat',
+'sc=newa' => 'newa',
+'sc=newtailue' => 'talu',
+'sc=nko' => 'nkoo',
+'sc=nkoo' => 'nkoo',
+'sc=nshu' => 'nshu',
+'sc=nushu' => 'nshu',
+'sc=nyiakengpuachuehmong' => 'hmnp',
+'sc=ogam' => 'ogam',
+'sc=ogham' => 'ogam',
+'sc=olchiki' => 'olck',
+'sc=olck' => 'olck',
+'sc=oldhungarian' => 'hung',
+'sc=olditalic' => 'ital',
+'sc=oldnortharabian' => 'narb',
+'sc=oldpermic' => 'perm',
+'sc=oldpersian' => 'xpeo',
+'sc=oldsogdian' => 'sogo',
+'sc=oldsoutharabian' => 'sarb',
+'sc=oldturkic' => 'orkh',
+'sc=oriya' => 'orya',
+'sc=orkh' => 'orkh',
+'sc=orya' => 'orya',
+'sc=osage' => 'osge',
+'sc=osge' => 'osge',
+'sc=osma' => 'osma',
+'sc=osmanya' => 'osma',
+'sc=pahawhhmong' => 'hmng',
+'sc=palm' => 'palm',
+'sc=palmyrene' => 'palm',
+'sc=pauc' => 'pauc',
+'sc=paucinhau' => 'pauc',
+'sc=perm' => 'perm',
+'sc=phag' => 'phag',
+'sc=phagspa' => 'phag',
+'sc=phli' => 'phli',
+'sc=phlp' => 'phlp',
+'sc=phnx' => 'phnx',
+'sc=phoenician' => 'phnx',
+'sc=plrd' => 'plrd',
+'sc=prti' => 'prti',
+'sc=psalterpahlavi' => 'phlp',
+'sc=qaac' => 'copt',
+'sc=qaai' => 'zinh',
+'sc=rejang' => 'rjng',
+'sc=rjng' => 'rjng',
+'sc=rohg' => 'rohg',
+'sc=runic' => 'runr',
+'sc=runr' => 'runr',
+'sc=samaritan' => 'samr',
+'sc=samr' => 'samr',
+'sc=sarb' => 'sarb',
+'sc=saur' => 'saur',
+'sc=saurashtra' => 'saur',
+'sc=sgnw' => 'sgnw',
+'sc=sharada' => 'shrd',
+'sc=shavian' => 'shaw',
+'sc=shaw' => 'shaw',
+'sc=shrd' => 'shrd',
+'sc=sidd' => 'sidd',
+'sc=siddham' => 'sidd',
+'sc=signwriting' => 'sgnw',
+'sc=sind' => 'sind',
+'sc=sinh' => 'sinh',
+'sc=sinhala' => 'sinh',
+'sc=sogd' => 'sogd',
+'sc=sogdian' => 'sogd',
+'sc=sogo' => 'sogo',
+'sc=sora' => 'sora',
+'sc=sorasompeng' => 'sora',
+'sc=soyo' => 'soyo',
+'sc=soyombo' => 'soyo',
+'sc=sund' => 'sund',
+'sc=sundanese' => 'sund',
+'sc=sylo' => 'sylo',
+'sc=sylotinagri' => 'sylo',
+'sc=syrc' => 'syrc',
+'sc=syriac' => 'syrc',
+'sc=tagalog' => 'tglg',
+'sc=tagb' => 'tagb',
+'sc=tagbanwa' => 'tagb',
+'sc=taile' => 'tale',
+'sc=taitham' => 'lana',
+'sc=taiviet' => 'tavt',
+'sc=takr' => 'takr',
+'sc=takri' => 'takr',
+'sc=tale' => 'tale',
+'sc=talu' => 'talu',
+'sc=tamil' => 'taml',
+'sc=taml' => 'taml',
+'sc=tang' => 'tang',
+'sc=tangut' => 'tang',
+'sc=tavt' => 'tavt',
+'sc=telu' => 'telu',
+'sc=telugu' => 'telu',
+'sc=tfng' => 'tfng',
+'sc=tglg' => 'tglg',
+'sc=thaa' => 'thaa',
+'sc=thaana' => 'thaa',
+'sc=thai' => 'thai',
+'sc=tibetan' => 'tibt',
+'sc=tibt' => 'tibt',
+'sc=tifinagh' => 'tfng',
+'sc=tirh' => 'tirh',
+'sc=tirhuta' => 'tirh',
+'sc=ugar' => 'ugar',
+'sc=ugaritic' => 'ugar',
+'sc=unknown' => 'zzzz',
+'sc=vai' => 'vaii',
+'sc=vaii' => 'vaii',
+'sc=wancho' => 'wcho',
+'sc=wara' => 'wara',
+'sc=warangciti' => 'wara',
+'sc=wcho' => 'wcho',
+'sc=xpeo' => 'xpeo',
+'sc=xsux' => 'xsux',
+'sc=yi' => 'yiii',
+'sc=yiii' => 'yiii',
+'sc=zanabazarsquare' => 'zanb',
+'sc=zanb' => 'zanb',
+'sc=zinh' => 'zinh',
+'sc=zyyy' => 'zyyy',
+'sc=zzzz' => 'zzzz',
+'scx=adlam' => 'adlm',
+'scx=adlm' => 'adlm',
+'scx=aghb' => 'aghb',
+'scx=ahom' => 'ahom',
+'scx=anatolianhieroglyphs' => 'hluw',
+'scx=arab' => 'arab',
+'scx=arabic' => 'arab',
+'scx=armenian' => 'armn',
+'scx=armi' => 'armi',
+'scx=armn' => 'armn',
+'scx=avestan' => 'avst',
+'scx=avst' => 'avst',
+'scx=bali' => 'bali',
+'scx=balinese' => 'bali',
+'scx=bamu' => 'bamu',
+'scx=bamum' => 'bamu',
+'scx=bass' => 'bass',
+'scx=bassavah' => 'bass',
+'scx=batak' => 'batk',
+'scx=batk' => 'batk',
+'scx=beng' => 'beng',
+'scx=bengali' => 'beng',
+'scx=bhaiksuki' => 'bhks',
+'scx=bhks' => 'bhks',
+'scx=bopo' => 'bopo',
+'scx=bopomofo' => 'bopo',
+'scx=brah' => 'brah',
+'scx=brahmi' => 'brah',
+'scx=brai' => 'brai',
+'scx=braille' => 'brai',
+'scx=bugi' => 'bugi',
+'scx=buginese' => 'bugi',
+'scx=buhd' => 'buhd',
+'scx=buhid' => 'buhd',
+'scx=cakm' => 'cakm',
+'scx=canadianaboriginal' => 'cans',
+'scx=cans' => 'cans',
+'scx=cari' => 'cari',
+'scx=carian' => 'cari',
+'scx=caucasianalbanian' => 'aghb',
+'scx=chakma' => 'cakm',
+'scx=cham' => 'cham',
+'scx=cher' => 'cher',
+'scx=cherokee' => 'cher',
+'scx=common' => 'zyyy',
+'scx=copt' => 'copt',
+'scx=coptic' => 'copt',
+'scx=cprt' => 'cprt',
+'scx=cuneiform' => 'xsux',
+'scx=cypriot' => 'cprt',
+'scx=cyrillic' => 'cyrl',
+'scx=cyrl' => 'cyrl',
+'scx=deseret' => 'dsrt',
+'scx=deva' => 'deva',
+'scx=devanagari' => 'deva',
+'scx=dogr' => 'dogr',
+'scx=dogra' => 'dogr',
+'scx=dsrt' => 'dsrt',
+'scx=dupl' => 'dupl',
+'scx=duployan' => 'dupl',
+'scx=egyp' => 'egyp',
+'scx=egyptianhieroglyphs' => 'egyp',
+'scx=elba' => 'elba',
+'scx=elbasan' => 'elba',
+'scx=elym' => 'elym',
+'scx=elymaic' => 'elym',
+'scx=ethi' => 'ethi',
+'scx=ethiopic' => 'ethi',
+'scx=geor' => 'geor',
+'scx=georgian' => 'geor',
+'scx=glag' => 'glag',
+'scx=glagolitic' => 'glag',
+'scx=gong' => 'gong',
+'scx=gonm' => 'gonm',
+'scx=goth' => 'goth',
+'scx=gothic' => 'goth',
+'scx=gran' => 'gran',
+'scx=grantha' => 'gran',
+'scx=greek' => 'grek',
+'scx=grek' => 'grek',
+'scx=gujarati' => 'gujr',
+'scx=gujr' => 'gujr',
+'scx=gunjalagondi' => 'gong',
+'scx=gurmukhi' => 'guru',
+'scx=guru' => 'guru',
+'scx=han' => 'hani',
+'scx=hang' => 'hang',
+'scx=hangul' => 'hang',
+'scx=hani' => 'hani',
+'scx=hanifirohingya' => 'rohg',
+'scx=hano' => 'hano',
+'scx=hanunoo' => 'hano',
+'scx=hatr' => 'hatr',
+'scx=hatran' => 'hatr',
+'scx=hebr' => 'hebr',
+'scx=hebrew' => 'hebr',
+'scx=hira' => 'hira',
+'scx=hiragana' => 'hira',
+'scx=hluw' => 'hluw',
+'scx=hmng' => 'hmng',
+'scx=hmnp' => 'hmnp',
+'scx=hung' => 'hung',
+'scx=imperialaramaic' => 'armi',
+'scx=inherited' => 'zinh',
+'scx=inscriptionalpahlavi' => 'phli',
+'scx=inscriptionalparthian' => 'prti',
+'scx=ital' => 'ital',
+'scx=java' => 'java',
+'scx=javanese' => 'java',
+'scx=kaithi' => 'kthi',
+'scx=kali' => 'kali',
+'scx=kana' => 'kana',
+'scx=kannada' => 'knda',
+'scx=katakana' => 'kana',
+'scx=kayahli' => 'kali',
+'scx=khar' => 'khar',
+'scx=kharoshthi' => 'khar',
+'scx=khmer' => 'khmr',
+'scx=khmr' => 'khmr',
+'scx=khoj' => 'khoj',
+'scx=khojki' => 'khoj',
+'scx=khudawadi' => 'sind',
+'scx=knda' => 'knda',
+'scx=kthi' => 'kthi',
+'scx=lana' => 'lana',
+'scx=lao' => 'laoo',
+'scx=laoo' => 'laoo',
+'scx=latin' => 'latn',
+'scx=latn' => 'latn',
+'scx=lepc' => 'lepc',
+'scx=lepcha' => 'lepc',
+'scx=limb' => 'limb',
+'scx=limbu' => 'limb',
+'scx=lina' => 'lina',
+'scx=linb' => 'linb',
+'scx=lineara' => 'lina',
+'scx=linearb' => 'linb',
+'scx=lisu' => 'lisu',
+'scx=lyci' => 'lyci',
+'scx=lycian' => 'lyci',
+'scx=lydi' => 'lydi',
+'scx=lydian' => 'lydi',
+'scx=mahajani' => 'mahj',
+'scx=mahj' => 'mahj',
+'scx=maka' => 'maka',
+'scx=makasar' => 'maka',
+'scx=malayalam' => 'mlym',
+'scx=mand' => 'mand',
+'scx=mandaic' => 'mand',
+'scx=mani' => 'mani',
+'scx=manichaean' => 'mani',
+'scx=marc' => 'marc',
+'scx=marchen' => 'marc',
+'scx=masaramgondi' => 'gonm',
+'scx=medefaidrin' => 'medf',
+'scx=medf' => 'medf',
+'scx=meeteimayek' => 'mtei',
+'scx=mend' => 'mend',
+'scx=mendekikakui' => 'mend',
+'scx=merc' => 'merc',
+'scx=mero' => 'mero',
+'scx=meroiticcursive' => 'merc',
+'scx=meroitichieroglyphs' => 'mero',
+'scx=miao' => 'plrd',
+'scx=mlym' => 'mlym',
+'scx=modi' => 'modi',
+'scx=mong' => 'mong',
+'scx=mongolian' => 'mong',
+'scx=mro' => 'mroo',
+'scx=mroo' => 'mroo',
+'scx=mtei' => 'mtei',
+'scx=mult' => 'mult',
+'scx=multani' => 'mult',
+'scx=myanmar' => 'mymr',
+'scx=mymr' => 'mymr',
+'scx=nabataean' => 'nbat',
+'scx=nand' => 'nand',
+'scx=nandinagari' => 'nand',
+'scx=narb' => 'narb',
+'scx=nbat' => 'nbat',
+'scx=newa' => 'newa',
+'scx=newtailue' => 'talu',
+'scx=nko' => 'nkoo',
+'scx=nkoo' => 'nkoo',
+'scx=nshu' => 'nshu',
+'scx=nushu' => 'nshu',
+'scx=nyiakengpuachuehmong' => 'hmnp',
+'scx=ogam' => 'ogam',
+'scx=ogham' => 'ogam',
+'scx=olchiki' => 'olck',
+'scx=olck' => 'olck',
+'scx=oldhungarian' => 'hung',
+'scx=olditalic' => 'ital',
+'scx=oldnortharabian' => 'narb',
+'scx=oldpermic' => 'perm',
+'scx=oldpersian' => 'xpeo',
+'scx=oldsogdian' => 'sogo',
+'scx=oldsoutharabian' => 'sarb',
+'scx=oldturkic' => 'orkh',
+'scx=oriya' => 'orya',
+'scx=orkh' => 'orkh',
+'scx=orya' => 'orya',
+'scx=osage' => 'osge',
+'scx=osge' => 'osge',
+'scx=osma' => 'osma',
+'scx=osmanya' => 'osma',
+'scx=pahawhhmong' => 'hmng',
+'scx=palm' => 'palm',
+'scx=palmyrene' => 'palm',
+'scx=pauc' => 'pauc',
+'scx=paucinhau' => 'pauc',
+'scx=perm' => 'perm',
+'scx=phag' => 'phag',
+'scx=phagspa' => 'phag',
+'scx=phli' => 'phli',
+'scx=phlp' => 'phlp',
+'scx=phnx' => 'phnx',
+'scx=phoenician' => 'phnx',
+'scx=plrd' => 'plrd',
+'scx=prti' => 'prti',
+'scx=psalterpahlavi' => 'phlp',
+'scx=qaac' => 'copt',
+'scx=qaai' => 'zinh',
+'scx=rejang' => 'rjng',
+'scx=rjng' => 'rjng',
+'scx=rohg' => 'rohg',
+'scx=runic' => 'runr',
+'scx=runr' => 'runr',
+'scx=samaritan' => 'samr',
+'scx=samr' => 'samr',
+'scx=sarb' => 'sarb',
+'scx=saur' => 'saur',
+'scx=saurashtra' => 'saur',
+'scx=sgnw' => 'sgnw',
+'scx=sharada' => 'shrd',
+'scx=shavian' => 'shaw',
+'scx=shaw' => 'shaw',
+'scx=shrd' => 'shrd',
+'scx=sidd' => 'sidd',
+'scx=siddham' => 'sidd',
+'scx=signwriting' => 'sgnw',
+'scx=sind' => 'sind',
+'scx=sinh' => 'sinh',
+'scx=sinhala' => 'sinh',
+'scx=sogd' => 'sogd',
+'scx=sogdian' => 'sogd',
+'scx=sogo' => 'sogo',
+'scx=sora' => 'sora',
+'scx=sorasompeng' => 'sora',
+'scx=soyo' => 'soyo',
+'scx=soyombo' => 'soyo',
+'scx=sund' => 'sund',
+'scx=sundanese' => 'sund',
+'scx=sylo' => 'sylo',
+'scx=sylotinagri' => 'sylo',
+'scx=syrc' => 'syrc',
+'scx=syriac' => 'syrc',
+'scx=tagalog' => 'tglg',
+'scx=tagb' => 'tagb',
+'scx=tagbanwa' => 'tagb',
+'scx=taile' => 'tale',
+'scx=taitham' => 'lana',
+'scx=taiviet' => 'tavt',
+'scx=takr' => 'takr',
+'scx=takri' => 'takr',
+'scx=tale' => 'tale',
+'scx=talu' => 'talu',
+'scx=tamil' => 'taml',
+'scx=taml' => 'taml',
+'scx=tang' => 'tang',
+'scx=tangut' => 'tang',
+'scx=tavt' => 'tavt',
+'scx=telu' => 'telu',
+'scx=telugu' => 'telu',
+'scx=tfng' => 'tfng',
+'scx=tglg' => 'tglg',
+'scx=thaa' => 'thaa',
+'scx=thaana' => 'thaa',
+'scx=thai' => 'thai',
+'scx=tibetan' => 'tibt',
+'scx=tibt' => 'tibt',
+'scx=tifinagh' => 'tfng',
+'scx=tirh' => 'tirh',
+'scx=tirhuta' => 'tirh',
+'scx=ugar' => 'ugar',
+'scx=ugaritic' => 'ugar',
+'scx=unknown' => 'zzzz',
+'scx=vai' => 'vaii',
+'scx=vaii' => 'vaii',
+'scx=wancho' => 'wcho',
+'scx=wara' => 'wara',
+'scx=warangciti' => 'wara',
+'scx=wcho' => 'wcho',
+'scx=xpeo' => 'xpeo',
+'scx=xsux' => 'xsux',
+'scx=yi' => 'yiii',
+'scx=yiii' => 'yiii',
+'scx=zanabazarsquare' => 'zanb',
+'scx=zanb' => 'zanb',
+'scx=zinh' => 'zinh',
+'scx=zyyy' => 'zyyy',
+'scx=zzzz' => 'zzzz',
+'sd=f' => 'n',
+'sd=false' => 'n',
+'sd=n' => 'n',
+'sd=no' => 'n',
+'sd=t' => 'y',
+'sd=true' => 'y',
+'sd=y' => 'y',
+'sd=yes' => 'y',
+'sterm=f' => 'n',
+'sterm=false' => 'n',
+'sterm=n' => 'n',
+'sterm=no' => 'n',
+'sterm=t' => 'y',
+'sterm=true' => 'y',
+'sterm=y' => 'y',
+'sterm=yes' => 'y',
+'term=f' => 'n',
+'term=false' => 'n',
+'term=n' => 'n',
+'term=no' => 'n',
+'term=t' => 'y',
+'term=true' => 'y',
+'term=y' => 'y',
+'term=yes' => 'y',
+'uideo=f' => 'n',
+'uideo=false' => 'n',
+'uideo=n' => 'n',
+'uideo=no' => 'n',
+'uideo=t' => 'y',
+'uideo=true' => 'y',
+'uideo=y' => 'y',
+'uideo=yes' => 'y',
+'upper=f' => 'n',
+'upper=false' => 'n',
+'upper=n' => 'n',
+'upper=no' => 'n',
+'upper=t' => 'y',
+'upper=true' => 'y',
+'upper=y' => 'y',
+'upper=yes' => 'y',
+'vo=r' => 'r',
+'vo=rotated' => 'r',
+'vo=tr' => 'tr',
+'vo=transformedrotated' => 'tr',
+'vo=transformedupright' => 'tu',
+'vo=tu' => 'tu',
+'vo=u' => 'u',
+'vo=upright' => 'u',
+'vs=f' => 'n',
+'vs=false' => 'n',
+'vs=n' => 'n',
+'vs=no' => 'n',
+'vs=t' => 'y',
+'vs=true' => 'y',
+'vs=y' => 'y',
+'vs=yes' => 'y',
+'wb=aletter' => 'le',
+'wb=cr' => 'cr',
+'wb=doublequote' => 'dq',
+'wb=dq' => 'dq',
+'wb=eb' => 'eb',
+'wb=ebase' => 'eb',
+'wb=ebasegaz' => 'ebg',
+'wb=ebg' => 'ebg',
+'wb=em' => 'em',
+'wb=emodifier' => 'em',
+'wb=ex' => 'ex',
+'wb=extend' => 'extend',
+'wb=extendnumlet' => 'ex',
+'wb=fo' => 'fo',
+'wb=format' => 'fo',
+'wb=gaz' => 'gaz',
+'wb=glueafterzwj' => 'gaz',
+'wb=hebrewletter' => 'hl',
+'wb=hl' => 'hl',
+'wb=ka' => 'ka',
+'wb=katakana' => 'ka',
+'wb=le' => 'le',
+'wb=lf' => 'lf',
+'wb=mb' => 'mb',
+'wb=midletter' => 'ml',
+'wb=midnum' => 'mn',
+'wb=midnumlet' => 'mb',
+'wb=ml' => 'ml',
+'wb=mn' => 'mn',
+'wb=newline' => 'nl',
+'wb=nl' => 'nl',
+'wb=nu' => 'nu',
+'wb=numeric' => 'nu',
+'wb=other' => 'xx',
+'wb=regionalindicator' => 'ri',
+'wb=ri' => 'ri',
+'wb=singlequote' => 'sq',
+'wb=sq' => 'sq',
+'wb=wsegspace' => 'wsegspace',
+'wb=xx' => 'xx',
+'wb=zwj' => 'zwj',
+'wspace=f' => 'n',
+'wspace=false' => 'n',
+'wspace=n' => 'n',
+'wspace=no' => 'n',
+'wspace=t' => 'y',
+'wspace=true' => 'y',
+'wspace=y' => 'y',
+'wspace=yes' => 'y',
+'xidc=f' => 'n',
+'xidc=false' => 'n',
+'xidc=n' => 'n',
+'xidc=no' => 'n',
+'xidc=t' => 'y',
+'xidc=true' => 'y',
+'xidc=y' => 'y',
+'xidc=yes' => 'y',
+'xids=f' => 'n',
+'xids=false' => 'n',
+'xids=n' => 'n',
+'xids=no' => 'n',
+'xids=t' => 'y',
+'xids=true' => 'y',
+'xids=y' => 'y',
+'xids=yes' => 'y',
+);
+
+# String property loose names to standard loose name
+%Unicode::UCD::string_property_loose_to_name = (
+'_perlnamealias' => 'namealias',
+'bidimirroringglyph' => 'bmg',
+'bidipairedbracket' => 'bpb',
+'bmg' => 'bmg',
+'bpb' => 'bpb',
+'casefolding' => 'cf',
+'cf' => 'cf',
+'decompositionmapping' => 'dm',
+'dm' => 'dm',
+'equideo' => 'equideo',
+'equivalentunifiedideograph' => 'equideo',
+'isc' => 'isc',
+'isocomment' => 'isc',
+'lc' => 'lc',
+'lowercasemapping' => 'lc',
+'na' => 'na',
+'na1' => 'na1',
+'name' => 'na',
+'namealias' => 'namealias',
+'nfkccasefold' => 'nfkccf',
+'nfkccf' => 'nfkccf',
+'perldecimaldigit' => 'perldecimaldigit',
+'scf' => 'scf',
+'sfc' => 'scf',
+'simplecasefolding' => 'scf',
+'simplelowercasemapping' => 'slc',
+'simpletitlecasemapping' => 'stc',
+'simpleuppercasemapping' => 'suc',
+'slc' => 'slc',
+'stc' => 'stc',
+'suc' => 'suc',
+'tc' => 'tc',
+'titlecasemapping' => 'tc',
+'uc' => 'uc',
+'unicode1name' => 'na1',
+'uppercasemapping' => 'uc',
+);
+
+# Keys are Perl extensions in loose form; values are each one's list of
+# aliases
+%Unicode::UCD::loose_perlprop_to_name = (
+'all' => 
+[
+'All',
+],
+'alnum' => 
+[
+'Alnum',
+'XPosixAlnum',
+],
+'any' => 
+[
+'Any',
+'Unicode',
+],
+'ascii' => 
+[
+'ASCII',
+],
+'assigned' => 
+[
+'Assigned',
+],
+'blank' => 
+[
+'Blank',
+'XPosixBlank',
+'HorizSpace',
+],
+'cntrl' => 
+[
+'Cntrl',
+'XPosixCntrl',
+],
+'digit' => 
+[
+'Digit',
+'XPosixDigit',
+],
+'graph' => 
+[
+'Graph',
+'XPosixGraph',
+],
+'horizspace' => 
+[
+'Blank',
+'XPosixBlank',
+'HorizSpace',
+],
+'perlspace' => 
+[
+'PosixSpace',
+'PerlSpace',
+],
+'perlword' => 
+[
+'PosixWord',
+'PerlWord',
+],
+'posixalnum' => 
+[
+'PosixAlnum',
+],
+'posixalpha' => 
+[
+'PosixAlpha',
+],
+'posixblank' => 
+[
+'PosixBlank',
+],
+'posixcntrl' => 
+[
+'PosixCntrl',
+],
+'posixdigit' => 
+[
+'PosixDigit',
+],
+'posixgraph' => 
+[
+'PosixGraph',
+],
+'posixlower' => 
+[
+'PosixLower',
+],
+'posixprint' => 
+[
+'PosixPrint',
+],
+'posixpunct' => 
+[
+'PosixPunct',
+],
+'posixspace' => 
+[
+'PosixSpace',
+'PerlSpace',
+],
+'posixupper' => 
+[
+'PosixUpper',
+],
+'posixword' => 
+[
+'PosixWord',
+'PerlWord',
+],
+'posixxdigit' => 
+[
+'PosixXDigit',
+],
+'print' => 
+[
+'Print',
+'XPosixPrint',
+],
+'punct' => 
+[
+'Punct',
+],
+'spaceperl' => 
+[
+'XPosixSpace',
+'XPerlSpace',
+'SpacePerl',
+],
+'title' => 
+[
+'Title',
+'Titlecase',
+],
+'titlecase' => 
+[
+'Title',
+'Titlecase',
+],
+'unicode' => 
+[
+'Any',
+'Unicode',
+],
+'vertspace' => 
+[
+'VertSpace',
+],
+'word' => 
+[
+'Word',
+'XPosixWord',
+],
+'xdigit' => 
+[
+'XDigit',
+'XPosixXDigit',
+],
+'xperlspace' => 
+[
+'XPosixSpace',
+'XPerlSpace',
+'SpacePerl',
+],
+'xposixalnum' => 
+[
+'Alnum',
+'XPosixAlnum',
+],
+'xposixalpha' => 
+[
+'XPosixAlpha',
+],
+'xposixblank' => 
+[
+'Blank',
+'XPosixBlank',
+'HorizSpace',
+],
+'xposixcntrl' => 
+[
+'Cntrl',
+'XPosixCntrl',
+],
+'xposixdigit' => 
+[
+'Digit',
+'XPosixDigit',
+],
+'xposixgraph' => 
+[
+'Graph',
+'XPosixGraph',
+],
+'xposixlower' => 
+[
+'XPosixLower',
+],
+'xposixprint' => 
+[
+'Print',
+'XPosixPrint',
+],
+'xposixpunct' => 
+[
+'XPosixPunct',
+],
+'xposixspace' => 
+[
+'XPosixSpace',
+'XPerlSpace',
+'SpacePerl',
+],
+'xposixupper' => 
+[
+'XPosixUpper',
+],
+'xposixword' => 
+[
+'Word',
+'XPosixWord',
+],
+'xposixxdigit' => 
+[
+'XDigit',
+'XPosixXDigit',
+],
+);
+
+# Keys are standard property name; values are each one's aliases
+%Unicode::UCD::prop_aliases = (
+'age' => 
+[
+'age',
+'Age',
+],
+'ahex' => 
+[
+'AHex',
+'ASCII_Hex_Digit',
+],
+'alpha' => 
+[
+'Alpha',
+'Alphabetic',
+],
+'bc' => 
+[
+'bc',
+'Bidi_Class',
+],
+'bidic' => 
+[
+'Bidi_C',
+'Bidi_Control',
+],
+'bidim' => 
+[
+'Bidi_M',
+'Bidi_Mirrored',
+],
+'blk' => 
+[
+'blk',
+'Block',
+],
+'bmg' => 
+[
+'bmg',
+'Bidi_Mirroring_Glyph',
+],
+'bpb' => 
+[
+'bpb',
+'Bidi_Paired_Bracket',
+],
+'bpt' => 
+[
+'bpt',
+'Bidi_Paired_Bracket_Type',
+],
+'cased' => 
+[
+'Cased',
+'Cased',
+],
+'ccc' => 
+[
+'ccc',
+'Canonical_Combining_Class',
+],
+'ce' => 
+[
+'CE',
+'Composition_Exclusion',
+],
+'cf' => 
+[
+'cf',
+'Case_Folding',
+],
+'ci' => 
+[
+'CI',
+'Case_Ignorable',
+],
+'compex' => 
+[
+'Comp_Ex',
+'Full_Composition_Exclusion',
+],
+'cwcf' => 
+[
+'CWCF',
+'Changes_When_Casefolded',
+],
+'cwcm' => 
+[
+'CWCM',
+'Changes_When_Casemapped',
+],
+'cwkcf' => 
+[
+'CWKCF',
+'Changes_When_NFKC_Casefolded',
+],
+'cwl' => 
+[
+'CWL',
+'Changes_When_Lowercased',
+],
+'cwt' => 
+[
+'CWT',
+'Changes_When_Titlecased',
+],
+'cwu' => 
+[
+'CWU',
+'Changes_When_Uppercased',
+],
+'dash' => 
+[
+'Dash',
+'Dash',
+],
+'dep' => 
+[
+'Dep',
+'Deprecated',
+],
+'di' => 
+[
+'DI',
+'Default_Ignorable_Code_Point',
+],
+'dia' => 
+[
+'Dia',
+'Diacritic',
+],
+'dm' => 
+[
+'dm',
+'Decomposition_Mapping',
+],
+'dt' => 
+[
+'dt',
+'Decomposition_Type',
+],
+'ea' => 
+[
+'ea',
+'East_Asian_Width',
+],
+'equideo' => 
+[
+'EqUIdeo',
+'Equivalent_Unified_Ideograph',
+],
+'ext' => 
+[
+'Ext',
+'Extender',
+],
+'gc' => 
+[
+'gc',
+'General_Category',
+'Category',
+],
+'gcb' => 
+[
+'GCB',
+'Grapheme_Cluster_Break',
+'_Perl_GCB',
+],
+'grbase' => 
+[
+'Gr_Base',
+'Grapheme_Base',
+],
+'grext' => 
+[
+'Gr_Ext',
+'Grapheme_Extend',
+],
+'hex' => 
+[
+'Hex',
+'Hex_Digit',
+],
+'hst' => 
+[
+'hst',
+'Hangul_Syllable_Type',
+],
+'hyphen' => 
+[
+'Hyphen',
+'Hyphen',
+],
+'idc' => 
+[
+'IDC',
+'ID_Continue',
+],
+'ideo' => 
+[
+'Ideo',
+'Ideographic',
+],
+'ids' => 
+[
+'IDS',
+'ID_Start',
+],
+'idsb' => 
+[
+'IDSB',
+'IDS_Binary_Operator',
+],
+'idst' => 
+[
+'IDST',
+'IDS_Trinary_Operator',
+],
+'in' => 
+[
+'In',
+'Present_In',
+],
+'inpc' => 
+[
+'InPC',
+'Indic_Positional_Category',
+],
+'insc' => 
+[
+'InSC',
+'Indic_Syllabic_Category',
+],
+'isc' => 
+[
+'isc',
+'ISO_Comment',
+],
+'jg' => 
+[
+'jg',
+'Joining_Group',
+],
+'joinc' => 
+[
+'Join_C',
+'Join_Control',
+],
+'jt' => 
+[
+'jt',
+'Joining_Type',
+],
+'lb' => 
+[
+'lb',
+'Line_Break',
+],
+'lc' => 
+[
+'lc',
+'Lowercase_Mapping',
+],
+'loe' => 
+[
+'LOE',
+'Logical_Order_Exception',
+],
+'lower' => 
+[
+'Lower',
+'Lowercase',
+],
+'math' => 
+[
+'Math',
+'Math',
+],
+'na' => 
+[
+'na',
+'Name',
+],
+'na1' => 
+[
+'na1',
+'Unicode_1_Name',
+],
+'namealias' => 
+[
+'Name_Alias',
+'Name_Alias',
+'_Perl_Name_Alias',
+],
+'nchar' => 
+[
+'NChar',
+'Noncharacter_Code_Point',
+],
+'nfcqc' => 
+[
+'NFC_QC',
+'NFC_Quick_Check',
+],
+'nfdqc' => 
+[
+'NFD_QC',
+'NFD_Quick_Check',
+],
+'nfkccf' => 
+[
+'NFKC_CF',
+'NFKC_Casefold',
+],
+'nfkcqc' => 
+[
+'NFKC_QC',
+'NFKC_Quick_Check',
+],
+'nfkdqc' => 
+[
+'NFKD_QC',
+'NFKD_Quick_Check',
+],
+'nt' => 
+[
+'nt',
+'Numeric_Type',
+],
+'nv' => 
+[
+'nv',
+'Numeric_Value',
+],
+'patsyn' => 
+[
+'Pat_Syn',
+'Pattern_Syntax',
+],
+'patws' => 
+[
+'Pat_WS',
+'Pattern_White_Space',
+],
+'pcm' => 
+[
+'PCM',
+'Prepended_Concatenation_Mark',
+],
+'perldecimaldigit' => 
+[
+'Perl_Decimal_Digit',
+'Perl_Decimal_Digit',
+],
+'qmark' => 
+[
+'QMark',
+'Quotation_Mark',
+],
+'radical' => 
+[
+'Radical',
+'Radical',
+],
+'ri' => 
+[
+'RI',
+'Regional_Indicator',
+],
+'sb' => 
+[
+'SB',
+'Sentence_Break',
+'_Perl_SB',
+],
+'sc' => 
+[
+'sc',
+'Script',
+],
+'scf' => 
+[
+'scf',
+'Simple_Case_Folding',
+'Sfc',
+],
+'scx' => 
+[
+'scx',
+'Script_Extensions',
+],
+'sd' => 
+[
+'SD',
+'Soft_Dotted',
+],
+'slc' => 
+[
+'slc',
+'Simple_Lowercase_Mapping',
+],
+'stc' => 
+[
+'stc',
+'Simple_Titlecase_Mapping',
+],
+'sterm' => 
+[
+'STerm',
+'Sentence_Terminal',
+],
+'suc' => 
+[
+'suc',
+'Simple_Uppercase_Mapping',
+],
+'tc' => 
+[
+'tc',
+'Titlecase_Mapping',
+],
+'term' => 
+[
+'Term',
+'Terminal_Punctuation',
+],
+'uc' => 
+[
+'uc',
+'Uppercase_Mapping',
+],
+'uideo' => 
+[
+'UIdeo',
+'Unified_Ideograph',
+],
+'upper' => 
+[
+'Upper',
+'Uppercase',
+],
+'vo' => 
+[
+'vo',
+'Vertical_Orientation',
+],
+'vs' => 
+[
+'VS',
+'Variation_Selector',
+],
+'wb' => 
+[
+'WB',
+'Word_Break',
+'_Perl_WB',
+],
+'wspace' => 
+[
+'WSpace',
+'White_Space',
+'Space',
+],
+'xidc' => 
+[
+'XIDC',
+'XID_Continue',
+],
+'xids' => 
+[
+'XIDS',
+'XID_Start',
+],
+);
+
+# Keys of top level are standard property name; values are keys to another
+# hash,  Each one is one of the property's values, in standard form.  The
+# values are that prop-val's aliases.  If only one specified, the short and
+# long alias are identical.
+%Unicode::UCD::prop_value_aliases = (
+'age' => 
+{
+'1.1' => 
+[
+'1.1',
+'V1_1',
+],
+'10.0' => 
+[
+'10.0',
+'V10_0',
+],
+'11.0' => 
+[
+'11.0',
+'V11_0',
+],
+'12.0' => 
+[
+'12.0',
+'V12_0',
+],
+'12.1' => 
+[
+'12.1',
+'V12_1',
+],
+'2.0' => 
+[
+'2.0',
+'V2_0',
+],
+'2.1' => 
+[
+'2.1',
+'V2_1',
+],
+'3.0' => 
+[
+'3.0',
+'V3_0',
+],
+'3.1' => 
+[
+'3.1',
+'V3_1',
+],
+'3.2' => 
+[
+'3.2',
+'V3_2',
+],
+'4.0' => 
+[
+'4.0',
+'V4_0',
+],
+'4.1' => 
+[
+'4.1',
+'V4_1',
+],
+'5.0' => 
+[
+'5.0',
+'V5_0',
+],
+'5.1' => 
+[
+'5.1',
+'V5_1',
+],
+'5.2' => 
+[
+'5.2',
+'V5_2',
+],
+'6.0' => 
+[
+'6.0',
+'V6_0',
+],
+'6.1' => 
+[
+'6.1',
+'V6_1',
+],
+'6.2' => 
+[
+'6.2',
+'V6_2',
+],
+'6.3' => 
+[
+'6.3',
+'V6_3',
+],
+'7.0' => 
+[
+'7.0',
+'V7_0',
+],
+'8.0' => 
+[
+'8.0',
+'V8_0',
+],
+'9.0' => 
+[
+'9.0',
+'V9_0',
+],
+'na' => 
+[
+'NA',
+'Unassigned',
+],
+},
+'ahex' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'alpha' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'bc' => 
+{
+'al' => 
+[
+'AL',
+'Arabic_Letter',
+],
+'an' => 
+[
+'AN',
+'Arabic_Number',
+],
+'b' => 
+[
+'B',
+'Paragraph_Separator',
+],
+'bn' => 
+[
+'BN',
+'Boundary_Neutral',
+],
+'cs' => 
+[
+'CS',
+'Common_Separator',
+],
+'en' => 
+[
+'EN',
+'European_Number',
+],
+'es' => 
+[
+'ES',
+'European_Separator',
+],
+'et' => 
+[
+'ET',
+'European_Terminator',
+],
+'fsi' => 
+[
+'FSI',
+'First_Strong_Isolate',
+],
+'l' => 
+[
+'L',
+'Left_To_Right',
+],
+'lre' => 
+[
+'LRE',
+'Left_To_Right_Embedding',
+],
+'lri' => 
+[
+'LRI',
+'Left_To_Right_Isolate',
+],
+'lro' => 
+[
+'LRO',
+'Left_To_Right_Override',
+],
+'nsm' => 
+[
+'NSM',
+'Nonspacing_Mark',
+],
+'on' => 
+[
+'ON',
+'Other_Neutral',
+],
+'pdf' => 
+[
+'PDF',
+'Pop_Directional_Format',
+],
+'pdi' => 
+[
+'PDI',
+'Pop_Directional_Isolate',
+],
+'r' => 
+[
+'R',
+'Right_To_Left',
+],
+'rle' => 
+[
+'RLE',
+'Right_To_Left_Embedding',
+],
+'rli' => 
+[
+'RLI',
+'Right_To_Left_Isolate',
+],
+'rlo' => 
+[
+'RLO',
+'Right_To_Left_Override',
+],
+'s' => 
+[
+'S',
+'Segment_Separator',
+],
+'ws' => 
+[
+'WS',
+'White_Space',
+],
+},
+'bidic' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'bidim' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'blk' => 
+{
+'adlam' => 
+[
+'Adlam',
+],
+'aegeannumbers' => 
+[
+'Aegean_Numbers',
+],
+'ahom' => 
+[
+'Ahom',
+],
+'alchemical' => 
+[
+'Alchemical',
+'Alchemical_Symbols',
+],
+'alphabeticpf' => 
+[
+'Alphabetic_PF',
+'Alphabetic_Presentation_Forms',
+],
+'anatolianhieroglyphs' => 
+[
+'Anatolian_Hieroglyphs',
+],
+'ancientgreekmusic' => 
+[
+'Ancient_Greek_Music',
+'Ancient_Greek_Musical_Notation',
+],
+'ancientgreeknumbers' => 
+[
+'Ancient_Greek_Numbers',
+],
+'ancientsymbols' => 
+[
+'Ancient_Symbols',
+],
+'arabic' => 
+[
+'Arabic',
+],
+'arabicexta' => 
+[
+'Arabic_Ext_A',
+'Arabic_Extended_A',
+],
+'arabicmath' => 
+[
+'Arabic_Math',
+'Arabic_Mathematical_Alphabetic_Symbols',
+],
+'arabicpfa' => 
+[
+'Arabic_PF_A',
+'Arabic_Presentation_Forms_A',
+],
+'arabicpfb' => 
+[
+'Arabic_PF_B',
+'Arabic_Presentation_Forms_B',
+],
+'arabicsup' => 
+[
+'Arabic_Sup',
+'Arabic_Supplement',
+],
+'armenian' => 
+[
+'Armenian',
+],
+'arrows' => 
+[
+'Arrows',
+],
+'ascii' => 
+[
+'ASCII',
+'Basic_Latin',
+],
+'avestan' => 
+[
+'Avestan',
+],
+'balinese' => 
+[
+'Balinese',
+],
+'bamum' => 
+[
+'Bamum',
+],
+'bamumsup' => 
+[
+'Bamum_Sup',
+'Bamum_Supplement',
+],
+'bassavah' => 
+[
+'Bassa_Vah',
+],
+'batak' => 
+[
+'Batak',
+],
+'bengali' => 
+[
+'Bengali',
+],
+'bhaiksuki' => 
+[
+'Bhaiksuki',
+],
+'blockelements' => 
+[
+'Block_Elements',
+],
+'bopomofo' => 
+[
+'Bopomofo',
+],
+'bopomofoext' => 
+[
+'Bopomofo_Ext',
+'Bopomofo_Extended',
+],
+'boxdrawing' => 
+[
+'Box_Drawing',
+],
+'brahmi' => 
+[
+'Brahmi',
+],
+'braille' => 
+[
+'Braille',
+'Braille_Patterns',
+],
+'buginese' => 
+[
+'Buginese',
+],
+'buhid' => 
+[
+'Buhid',
+],
+'byzantinemusic' => 
+[
+'Byzantine_Music',
+'Byzantine_Musical_Symbols',
+],
+'carian' => 
+[
+'Carian',
+],
+'caucasianalbanian' => 
+[
+'Caucasian_Albanian',
+],
+'chakma' => 
+[
+'Chakma',
+],
+'cham' => 
+[
+'Cham',
+],
+'cherokee' => 
+[
+'Cherokee',
+],
+'cherokeesup' => 
+[
+'Cherokee_Sup',
+'Cherokee_Supplement',
+],
+'chesssymbols' => 
+[
+'Chess_Symbols',
+],
+'cjk' => 
+[
+'CJK',
+'CJK_Unified_Ideographs',
+],
+'cjkcompat' => 
+[
+'CJK_Compat',
+'CJK_Compatibility',
+],
+'cjkcompatforms' => 
+[
+'CJK_Compat_Forms',
+'CJK_Compatibility_Forms',
+],
+'cjkcompatideographs' => 
+[
+'CJK_Compat_Ideographs',
+'CJK_Compatibility_Ideographs',
+],
+'cjkcompatideographssup' => 
+[
+'CJK_Compat_Ideographs_Sup',
+'CJK_Compatibility_Ideographs_Supplement',
+],
+'cjkexta' => 
+[
+'CJK_Ext_A',
+'CJK_Unified_Ideographs_Extension_A',
+],
+'cjkextb' => 
+[
+'CJK_Ext_B',
+'CJK_Unified_Ideographs_Extension_B',
+],
+'cjkextc' => 
+[
+'CJK_Ext_C',
+'CJK_Unified_Ideographs_Extension_C',
+],
+'cjkextd' => 
+[
+'CJK_Ext_D',
+'CJK_Unified_Ideographs_Extension_D',
+],
+'cjkexte' => 
+[
+'CJK_Ext_E',
+'CJK_Unified_Ideographs_Extension_E',
+],
+'cjkextf' => 
+[
+'CJK_Ext_F',
+'CJK_Unified_Ideographs_Extension_F',
+],
+'cjkradicalssup' => 
+[
+'CJK_Radicals_Sup',
+'CJK_Radicals_Supplement',
+],
+'cjkstrokes' => 
+[
+'CJK_Strokes',
+],
+'cjksymbols' => 
+[
+'CJK_Symbols',
+'CJK_Symbols_And_Punctuation',
+],
+'compatjamo' => 
+[
+'Compat_Jamo',
+'Hangul_Compatibility_Jamo',
+],
+'controlpictures' => 
+[
+'Control_Pictures',
+],
+'coptic' => 
+[
+'Coptic',
+],
+'copticepactnumbers' => 
+[
+'Coptic_Epact_Numbers',
+],
+'countingrod' => 
+[
+'Counting_Rod',
+'Counting_Rod_Numerals',
+],
+'cuneiform' => 
+[
+'Cuneiform',
+],
+'cuneiformnumbers' => 
+[
+'Cuneiform_Numbers',
+'Cuneiform_Numbers_And_Punctuation',
+],
+'currencysymbols' => 
+[
+'Currency_Symbols',
+],
+'cypriotsyllabary' => 
+[
+'Cypriot_Syllabary',
+],
+'cyrillic' => 
+[
+'Cyrillic',
+],
+'cyrillicexta' => 
+[
+'Cyrillic_Ext_A',
+'Cyrillic_Extended_A',
+],
+'cyrillicextb' => 
+[
+'Cyrillic_Ext_B',
+'Cyrillic_Extended_B',
+],
+'cyrillicextc' => 
+[
+'Cyrillic_Ext_C',
+'Cyrillic_Extended_C',
+],
+'cyrillicsup' => 
+[
+'Cyrillic_Sup',
+'Cyrillic_Supplement',
+'Cyrillic_Supplementary',
+],
+'deseret' => 
+[
+'Deseret',
+],
+'devanagari' => 
+[
+'Devanagari',
+],
+'devanagariext' => 
+[
+'Devanagari_Ext',
+'Devanagari_Extended',
+],
+'diacriticals' => 
+[
+'Diacriticals',
+'Combining_Diacritical_Marks',
+],
+'diacriticalsext' => 
+[
+'Diacriticals_Ext',
+'Combining_Diacritical_Marks_Extended',
+],
+'diacriticalsforsymbols' => 
+[
+'Diacriticals_For_Symbols',
+'Combining_Diacritical_Marks_For_Symbols',
+'Combining_Marks_For_Symbols',
+],
+'diacriticalssup' => 
+[
+'Diacriticals_Sup',
+'Combining_Diacritical_Marks_Supplement',
+],
+'dingbats' => 
+[
+'Dingbats',
+],
+'dogra' => 
+[
+'Dogra',
+],
+'domino' => 
+[
+'Domino',
+'Domino_Tiles',
+],
+'duployan' => 
+[
+'Duployan',
+],
+'earlydynasticcuneiform' => 
+[
+'Early_Dynastic_Cuneiform',
+],
+'egyptianhieroglyphformatcontrols' => 
+[
+'Egyptian_Hieroglyph_Format_Controls',
+],
+'egyptianhieroglyphs' => 
+[
+'Egyptian_Hieroglyphs',
+],
+'elbasan' => 
+[
+'Elbasan',
+],
+'elymaic' => 
+[
+'Elymaic',
+],
+'emoticons' => 
+[
+'Emoticons',
+],
+'enclosedalphanum' => 
+[
+'Enclosed_Alphanum',
+'Enclosed_Alphanumerics',
+],
+'enclosedalphanumsup' => 
+[
+'Enclosed_Alphanum_Sup',
+'Enclosed_Alphanumeric_Supplement',
+],
+'enclosedcjk' => 
+[
+'Enclosed_CJK',
+'Enclosed_CJK_Letters_And_Months',
+],
+'enclosedideographicsup' => 
+[
+'Enclosed_Ideographic_Sup',
+'Enclosed_Ideographic_Supplement',
+],
+'ethiopic' => 
+[
+'Ethiopic',
+],
+'ethiopicext' => 
+[
+'Ethiopic_Ext',
+'Ethiopic_Extended',
+],
+'ethiopicexta' => 
+[
+'Ethiopic_Ext_A',
+'Ethiopic_Extended_A',
+],
+'ethiopicsup' => 
+[
+'Ethiopic_Sup',
+'Ethiopic_Supplement',
+],
+'geometricshapes' => 
+[
+'Geometric_Shapes',
+],
+'geometricshapesext' => 
+[
+'Geometric_Shapes_Ext',
+'Geometric_Shapes_Extended',
+],
+'georgian' => 
+[
+'Georgian',
+],
+'georgianext' => 
+[
+'Georgian_Ext',
+'Georgian_Extended',
+],
+'georgiansup' => 
+[
+'Georgian_Sup',
+'Georgian_Supplement',
+],
+'glagolitic' => 
+[
+'Glagolitic',
+],
+'glagoliticsup' => 
+[
+'Glagolitic_Sup',
+'Glagolitic_Supplement',
+],
+'gothic' => 
+[
+'Gothic',
+],
+'grantha' => 
+[
+'Grantha',
+],
+'greek' => 
+[
+'Greek',
+'Greek_And_Coptic',
+],
+'greekext' => 
+[
+'Greek_Ext',
+'Greek_Extended',
+],
+'gujarati' => 
+[
+'Gujarati',
+],
+'gunjalagondi' => 
+[
+'Gunjala_Gondi',
+],
+'gurmukhi' => 
+[
+'Gurmukhi',
+],
+'halfandfullforms' => 
+[
+'Half_And_Full_Forms',
+'Halfwidth_And_Fullwidth_Forms',
+],
+'halfmarks' => 
+[
+'Half_Marks',
+'Combining_Half_Marks',
+],
+'hangul' => 
+[
+'Hangul',
+'Hangul_Syllables',
+],
+'hanifirohingya' => 
+[
+'Hanifi_Rohingya',
+],
+'hanunoo' => 
+[
+'Hanunoo',
+],
+'hatran' => 
+[
+'Hatran',
+],
+'hebrew' => 
+[
+'Hebrew',
+],
+'highpusurrogates' => 
+[
+'High_PU_Surrogates',
+'High_Private_Use_Surrogates',
+],
+'highsurrogates' => 
+[
+'High_Surrogates',
+],
+'hiragana' => 
+[
+'Hiragana',
+],
+'idc' => 
+[
+'IDC',
+'Ideographic_Description_Characters',
+],
+'ideographicsymbols' => 
+[
+'Ideographic_Symbols',
+'Ideographic_Symbols_And_Punctuation',
+],
+'imperialaramaic' => 
+[
+'Imperial_Aramaic',
+],
+'indicnumberforms' => 
+[
+'Indic_Number_Forms',
+'Common_Indic_Number_Forms',
+],
+'indicsiyaqnumbers' => 
+[
+'Indic_Siyaq_Numbers',
+],
+'inscriptionalpahlavi' => 
+[
+'Inscriptional_Pahlavi',
+],
+'inscriptionalparthian' => 
+[
+'Inscriptional_Parthian',
+],
+'ipaext' => 
+[
+'IPA_Ext',
+'IPA_Extensions',
+],
+'jamo' => 
+[
+'Jamo',
+'Hangul_Jamo',
+],
+'jamoexta' => 
+[
+'Jamo_Ext_A',
+'Hangul_Jamo_Extended_A',
+],
+'jamoextb' => 
+[
+'Jamo_Ext_B',
+'Hangul_Jamo_Extended_B',
+],
+'javanese' => 
+[
+'Javanese',
+],
+'kaithi' => 
+[
+'Kaithi',
+],
+'kanaexta' => 
+[
+'Kana_Ext_A',
+'Kana_Extended_A',
+],
+'kanasup' => 
+[
+'Kana_Sup',
+'Kana_Supplement',
+],
+'kanbun' => 
+[
+'Kanbun',
+],
+'kangxi' => 
+[
+'Kangxi',
+'Kangxi_Radicals',
+],
+'kannada' => 
+[
+'Kannada',
+],
+'katakana' => 
+[
+'Katakana',
+],
+'katakanaext' => 
+[
+'Katakana_Ext',
+'Katakana_Phonetic_Extensions',
+],
+'kayahli' => 
+[
+'Kayah_Li',
+],
+'kharoshthi' => 
+[
+'Kharoshthi',
+],
+'khmer' => 
+[
+'Khmer',
+],
+'khmersymbols' => 
+[
+'Khmer_Symbols',
+],
+'khojki' => 
+[
+'Khojki',
+],
+'khudawadi' => 
+[
+'Khudawadi',
+],
+'lao' => 
+[
+'Lao',
+],
+'latin1sup' => 
+[
+'Latin_1_Sup',
+'Latin_1_Supplement',
+'Latin_1',
+],
+'latinexta' => 
+[
+'Latin_Ext_A',
+'Latin_Extended_A',
+],
+'latinextadditional' => 
+[
+'Latin_Ext_Additional',
+'Latin_Extended_Additional',
+],
+'latinextb' => 
+[
+'Latin_Ext_B',
+'Latin_Extended_B',
+],
+'latinextc' => 
+[
+'Latin_Ext_C',
+'Latin_Extended_C',
+],
+'latinextd' => 
+[
+'Latin_Ext_D',
+'Latin_Extended_D',
+],
+'latinexte' => 
+[
+'Latin_Ext_E',
+'Latin_Extended_E',
+],
+'lepcha' => 
+[
+'Lepcha',
+],
+'letterlikesymbols' => 
+[
+'Letterlike_Symbols',
+],
+'limbu' => 
+[
+'Limbu',
+],
+'lineara' => 
+[
+'Linear_A',
+],
+'linearbideograms' => 
+[
+'Linear_B_Ideograms',
+],
+'linearbsyllabary' => 
+[
+'Linear_B_Syllabary',
+],
+'lisu' => 
+[
+'Lisu',
+],
+'lowsurrogates' => 
+[
+'Low_Surrogates',
+],
+'lycian' => 
+[
+'Lycian',
+],
+'lydian' => 
+[
+'Lydian',
+],
+'mahajani' => 
+[
+'Mahajani',
+],
+'mahjong' => 
+[
+'Mahjong',
+'Mahjong_Tiles',
+],
+'makasar' => 
+[
+'Makasar',
+],
+'malayalam' => 
+[
+'Malayalam',
+],
+'mandaic' => 
+[
+'Mandaic',
+],
+'manichaean' => 
+[
+'Manichaean',
+],
+'marchen' => 
+[
+'Marchen',
+],
+'masaramgondi' => 
+[
+'Masaram_Gondi',
+],
+'mathalphanum' => 
+[
+'Math_Alphanum',
+'Mathematical_Alphanumeric_Symbols',
+],
+'mathoperators' => 
+[
+'Math_Operators',
+'Mathematical_Operators',
+],
+'mayannumerals' => 
+[
+'Mayan_Numerals',
+],
+'medefaidrin' => 
+[
+'Medefaidrin',
+],
+'meeteimayek' => 
+[
+'Meetei_Mayek',
+],
+'meeteimayekext' => 
+[
+'Meetei_Mayek_Ext',
+'Meetei_Mayek_Extensions',
+],
+'mendekikakui' => 
+[
+'Mende_Kikakui',
+],
+'meroiticcursive' => 
+[
+'Meroitic_Cursive',
+],
+'meroitichieroglyphs' => 
+[
+'Meroitic_Hieroglyphs',
+],
+'miao' => 
+[
+'Miao',
+],
+'miscarrows' => 
+[
+'Misc_Arrows',
+'Miscellaneous_Symbols_And_Arrows',
+],
+'miscmathsymbolsa' => 
+[
+'Misc_Math_Symbols_A',
+'Miscellaneous_Mathematical_Symbols_A',
+],
+'miscmathsymbolsb' => 
+[
+'Misc_Math_Symbols_B',
+'Miscellaneous_Mathematical_Symbols_B',
+],
+'miscpictographs' => 
+[
+'Misc_Pictographs',
+'Miscellaneous_Symbols_And_Pictographs',
+],
+'miscsymbols' => 
+[
+'Misc_Symbols',
+'Miscellaneous_Symbols',
+],
+'misctechnical' => 
+[
+'Misc_Technical',
+'Miscellaneous_Technical',
+],
+'modi' => 
+[
+'Modi',
+],
+'modifierletters' => 
+[
+'Modifier_Letters',
+'Spacing_Modifier_Letters',
+],
+'modifiertoneletters' => 
+[
+'Modifier_Tone_Letters',
+],
+'mongolian' => 
+[
+'Mongolian',
+],
+'mongoliansup' => 
+[
+'Mongolian_Sup',
+'Mongolian_Supplement',
+],
+'mro' => 
+[
+'Mro',
+],
+'multani' => 
+[
+'Multani',
+],
+'music' => 
+[
+'Music',
+'Musical_Symbols',
+],
+'myanmar' => 
+[
+'Myanmar',
+],
+'myanmarexta' => 
+[
+'Myanmar_Ext_A',
+'Myanmar_Extended_A',
+],
+'myanmarextb' => 
+[
+'Myanmar_Ext_B',
+'Myanmar_Extended_B',
+],
+'nabataean' => 
+[
+'Nabataean',
+],
+'nandinagari' => 
+[
+'Nandinagari',
+],
+'nb' => 
+[
+'NB',
+'No_Block',
+],
+'newa' => 
+[
+'Newa',
+],
+'newtailue' => 
+[
+'New_Tai_Lue',
+],
+'nko' => 
+[
+'NKo',
+],
+'numberforms' => 
+[
+'Number_Forms',
+],
+'nushu' => 
+[
+'Nushu',
+],
+'nyiakengpuachuehmong' => 
+[
+'Nyiakeng_Puachue_Hmong',
+],
+'ocr' => 
+[
+'OCR',
+'Optical_Character_Recognition',
+],
+'ogham' => 
+[
+'Ogham',
+],
+'olchiki' => 
+[
+'Ol_Chiki',
+],
+'oldhungarian' => 
+[
+'Old_Hungarian',
+],
+'olditalic' => 
+[
+'Old_Italic',
+],
+'oldnortharabian' => 
+[
+'Old_North_Arabian',
+],
+'oldpermic' => 
+[
+'Old_Permic',
+],
+'oldpersian' => 
+[
+'Old_Persian',
+],
+'oldsogdian' => 
+[
+'Old_Sogdian',
+],
+'oldsoutharabian' => 
+[
+'Old_South_Arabian',
+],
+'oldturkic' => 
+[
+'Old_Turkic',
+],
+'oriya' => 
+[
+'Oriya',
+],
+'ornamentaldingbats' => 
+[
+'Ornamental_Dingbats',
+],
+'osage' => 
+[
+'Osage',
+],
+'osmanya' => 
+[
+'Osmanya',
+],
+'ottomansiyaqnumbers' => 
+[
+'Ottoman_Siyaq_Numbers',
+],
+'pahawhhmong' => 
+[
+'Pahawh_Hmong',
+],
+'palmyrene' => 
+[
+'Palmyrene',
+],
+'paucinhau' => 
+[
+'Pau_Cin_Hau',
+],
+'phagspa' => 
+[
+'Phags_Pa',
+],
+'phaistos' => 
+[
+'Phaistos',
+'Phaistos_Disc',
+],
+'phoenician' => 
+[
+'Phoenician',
+],
+'phoneticext' => 
+[
+'Phonetic_Ext',
+'Phonetic_Extensions',
+],
+'phoneticextsup' => 
+[
+'Phonetic_Ext_Sup',
+'Phonetic_Extensions_Supplement',
+],
+'playingcards' => 
+[
+'Playing_Cards',
+],
+'psalterpahlavi' => 
+[
+'Psalter_Pahlavi',
+],
+'pua' => 
+[
+'PUA',
+'Private_Use_Area',
+'Private_Use',
+],
+'punctuation' => 
+[
+'Punctuation',
+'General_Punctuation',
+],
+'rejang' => 
+[
+'Rejang',
+],
+'rumi' => 
+[
+'Rumi',
+'Rumi_Numeral_Symbols',
+],
+'runic' => 
+[
+'Runic',
+],
+'samaritan' => 
+[
+'Samaritan',
+],
+'saurashtra' => 
+[
+'Saurashtra',
+],
+'sharada' => 
+[
+'Sharada',
+],
+'shavian' => 
+[
+'Shavian',
+],
+'shorthandformatcontrols' => 
+[
+'Shorthand_Format_Controls',
+],
+'siddham' => 
+[
+'Siddham',
+],
+'sinhala' => 
+[
+'Sinhala',
+],
+'sinhalaarchaicnumbers' => 
+[
+'Sinhala_Archaic_Numbers',
+],
+'smallforms' => 
+[
+'Small_Forms',
+'Small_Form_Variants',
+],
+'smallkanaext' => 
+[
+'Small_Kana_Ext',
+'Small_Kana_Extension',
+],
+'sogdian' => 
+[
+'Sogdian',
+],
+'sorasompeng' => 
+[
+'Sora_Sompeng',
+],
+'soyombo' => 
+[
+'Soyombo',
+],
+'specials' => 
+[
+'Specials',
+],
+'sundanese' => 
+[
+'Sundanese',
+],
+'sundanesesup' => 
+[
+'Sundanese_Sup',
+'Sundanese_Supplement',
+],
+'suparrowsa' => 
+[
+'Sup_Arrows_A',
+'Supplemental_Arrows_A',
+],
+'suparrowsb' => 
+[
+'Sup_Arrows_B',
+'Supplemental_Arrows_B',
+],
+'suparrowsc' => 
+[
+'Sup_Arrows_C',
+'Supplemental_Arrows_C',
+],
+'superandsub' => 
+[
+'Super_And_Sub',
+'Superscripts_And_Subscripts',
+],
+'supmathoperators' => 
+[
+'Sup_Math_Operators',
+'Supplemental_Mathematical_Operators',
+],
+'suppuaa' => 
+[
+'Sup_PUA_A',
+'Supplementary_Private_Use_Area_A',
+],
+'suppuab' => 
+[
+'Sup_PUA_B',
+'Supplementary_Private_Use_Area_B',
+],
+'suppunctuation' => 
+[
+'Sup_Punctuation',
+'Supplemental_Punctuation',
+],
+'supsymbolsandpictographs' => 
+[
+'Sup_Symbols_And_Pictographs',
+'Supplemental_Symbols_And_Pictographs',
+],
+'suttonsignwriting' => 
+[
+'Sutton_SignWriting',
+],
+'sylotinagri' => 
+[
+'Syloti_Nagri',
+],
+'symbolsandpictographsexta' => 
+[
+'Symbols_And_Pictographs_Ext_A',
+'Symbols_And_Pictographs_Extended_A',
+],
+'syriac' => 
+[
+'Syriac',
+],
+'syriacsup' => 
+[
+'Syriac_Sup',
+'Syriac_Supplement',
+],
+'tagalog' => 
+[
+'Tagalog',
+],
+'tagbanwa' => 
+[
+'Tagbanwa',
+],
+'tags' => 
+[
+'Tags',
+],
+'taile' => 
+[
+'Tai_Le',
+],
+'taitham' => 
+[
+'Tai_Tham',
+],
+'taiviet' => 
+[
+'Tai_Viet',
+],
+'taixuanjing' => 
+[
+'Tai_Xuan_Jing',
+'Tai_Xuan_Jing_Symbols',
+],
+'takri' => 
+[
+'Takri',
+],
+'tamil' => 
+[
+'Tamil',
+],
+'tamilsup' => 
+[
+'Tamil_Sup',
+'Tamil_Supplement',
+],
+'tangut' => 
+[
+'Tangut',
+],
+'tangutcomponents' => 
+[
+'Tangut_Components',
+],
+'telugu' => 
+[
+'Telugu',
+],
+'thaana' => 
+[
+'Thaana',
+],
+'thai' => 
+[
+'Thai',
+],
+'tibetan' => 
+[
+'Tibetan',
+],
+'tifinagh' => 
+[
+'Tifinagh',
+],
+'tirhuta' => 
+[
+'Tirhuta',
+],
+'transportandmap' => 
+[
+'Transport_And_Map',
+'Transport_And_Map_Symbols',
+],
+'ucas' => 
+[
+'UCAS',
+'Unified_Canadian_Aboriginal_Syllabics',
+'Canadian_Syllabics',
+],
+'ucasext' => 
+[
+'UCAS_Ext',
+'Unified_Canadian_Aboriginal_Syllabics_Extended',
+],
+'ugaritic' => 
+[
+'Ugaritic',
+],
+'vai' => 
+[
+'Vai',
+],
+'vedicext' => 
+[
+'Vedic_Ext',
+'Vedic_Extensions',
+],
+'verticalforms' => 
+[
+'Vertical_Forms',
+],
+'vs' => 
+[
+'VS',
+'Variation_Selectors',
+],
+'vssup' => 
+[
+'VS_Sup',
+'Variation_Selectors_Supplement',
+],
+'wancho' => 
+[
+'Wancho',
+],
+'warangciti' => 
+[
+'Warang_Citi',
+],
+'yijing' => 
+[
+'Yijing',
+'Yijing_Hexagram_Symbols',
+],
+'yiradicals' => 
+[
+'Yi_Radicals',
+],
+'yisyllables' => 
+[
+'Yi_Syllables',
+],
+'zanabazarsquare' => 
+[
+'Zanabazar_Square',
+],
+},
+'bpt' => 
+{
+'c' => 
+[
+'c',
+'Close',
+],
+'n' => 
+[
+'n',
+'None',
+],
+'o' => 
+[
+'o',
+'Open',
+],
+},
+'cased' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'ccc' => 
+{
+'a' => 
+[
+'A',
+'Above',
+230,
+],
+'al' => 
+[
+'AL',
+'Above_Left',
+228,
+],
+'ar' => 
+[
+'AR',
+'Above_Right',
+232,
+],
+'ata' => 
+[
+'ATA',
+'Attached_Above',
+214,
+],
+'atar' => 
+[
+'ATAR',
+'Attached_Above_Right',
+216,
+],
+'atb' => 
+[
+'ATB',
+'Attached_Below',
+202,
+],
+'atbl' => 
+[
+'ATBL',
+'Attached_Below_Left',
+200,
+],
+'b' => 
+[
+'B',
+'Below',
+220,
+],
+'bl' => 
+[
+'BL',
+'Below_Left',
+218,
+],
+'br' => 
+[
+'BR',
+'Below_Right',
+222,
+],
+'ccc10' => 
+[
+'CCC10',
+'CCC10',
+10,
+],
+'ccc103' => 
+[
+'CCC103',
+'CCC103',
+103,
+],
+'ccc107' => 
+[
+'CCC107',
+'CCC107',
+107,
+],
+'ccc11' => 
+[
+'CCC11',
+'CCC11',
+11,
+],
+'ccc118' => 
+[
+'CCC118',
+'CCC118',
+118,
+],
+'ccc12' => 
+[
+'CCC12',
+'CCC12',
+12,
+],
+'ccc122' => 
+[
+'CCC122',
+'CCC122',
+122,
+],
+'ccc129' => 
+[
+'CCC129',
+'CCC129',
+129,
+],
+'ccc13' => 
+[
+'CCC13',
+'CCC13',
+13,
+],
+'ccc130' => 
+[
+'CCC130',
+'CCC130',
+130,
+],
+'ccc132' => 
+[
+'CCC132',
+'CCC132',
+132,
+],
+'ccc133' => 
+[
+'CCC133',
+'CCC133',
+133,
+],
+'ccc14' => 
+[
+'CCC14',
+'CCC14',
+14,
+],
+'ccc15' => 
+[
+'CCC15',
+'CCC15',
+15,
+],
+'ccc16' => 
+[
+'CCC16',
+'CCC16',
+16,
+],
+'ccc17' => 
+[
+'CCC17',
+'CCC17',
+17,
+],
+'ccc18' => 
+[
+'CCC18',
+'CCC18',
+18,
+],
+'ccc19' => 
+[
+'CCC19',
+'CCC19',
+19,
+],
+'ccc20' => 
+[
+'CCC20',
+'CCC20',
+20,
+],
+'ccc21' => 
+[
+'CCC21',
+'CCC21',
+21,
+],
+'ccc22' => 
+[
+'CCC22',
+'CCC22',
+22,
+],
+'ccc23' => 
+[
+'CCC23',
+'CCC23',
+23,
+],
+'ccc24' => 
+[
+'CCC24',
+'CCC24',
+24,
+],
+'ccc25' => 
+[
+'CCC25',
+'CCC25',
+25,
+],
+'ccc26' => 
+[
+'CCC26',
+'CCC26',
+26,
+],
+'ccc27' => 
+[
+'CCC27',
+'CCC27',
+27,
+],
+'ccc28' => 
+[
+'CCC28',
+'CCC28',
+28,
+],
+'ccc29' => 
+[
+'CCC29',
+'CCC29',
+29,
+],
+'ccc30' => 
+[
+'CCC30',
+'CCC30',
+30,
+],
+'ccc31' => 
+[
+'CCC31',
+'CCC31',
+31,
+],
+'ccc32' => 
+[
+'CCC32',
+'CCC32',
+32,
+],
+'ccc33' => 
+[
+'CCC33',
+'CCC33',
+33,
+],
+'ccc34' => 
+[
+'CCC34',
+'CCC34',
+34,
+],
+'ccc35' => 
+[
+'CCC35',
+'CCC35',
+35,
+],
+'ccc36' => 
+[
+'CCC36',
+'CCC36',
+36,
+],
+'ccc84' => 
+[
+'CCC84',
+'CCC84',
+84,
+],
+'ccc91' => 
+[
+'CCC91',
+'CCC91',
+91,
+],
+'da' => 
+[
+'DA',
+'Double_Above',
+234,
+],
+'db' => 
+[
+'DB',
+'Double_Below',
+233,
+],
+'is' => 
+[
+'IS',
+'Iota_Subscript',
+240,
+],
+'kv' => 
+[
+'KV',
+'Kana_Voicing',
+8,
+],
+'l' => 
+[
+'L',
+'Left',
+224,
+],
+'nk' => 
+[
+'NK',
+'Nukta',
+7,
+],
+'nr' => 
+[
+'NR',
+'Not_Reordered',
+0,
+],
+'ov' => 
+[
+'OV',
+'Overlay',
+1,
+],
+'r' => 
+[
+'R',
+'Right',
+226,
+],
+'vr' => 
+[
+'VR',
+'Virama',
+9,
+],
+},
+'ce' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'ci' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'compex' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'cwcf' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'cwcm' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'cwkcf' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'cwl' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'cwt' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'cwu' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'dash' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'dep' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'di' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'dia' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'dt' => 
+{
+'can' => 
+[
+'Can',
+'Canonical',
+],
+'com' => 
+[
+'Com',
+'Compat',
+],
+'enc' => 
+[
+'Enc',
+'Circle',
+],
+'fin' => 
+[
+'Fin',
+'Final',
+],
+'font' => 
+[
+'Font',
+],
+'fra' => 
+[
+'Fra',
+'Fraction',
+],
+'init' => 
+[
+'Init',
+'Initial',
+],
+'iso' => 
+[
+'Iso',
+'Isolated',
+],
+'med' => 
+[
+'Med',
+'Medial',
+],
+'nar' => 
+[
+'Nar',
+'Narrow',
+],
+'nb' => 
+[
+'Nb',
+'Nobreak',
+],
+'noncanon' => 
+[
+'Non_Canon',
+'Non_Canonical',
+],
+'none' => 
+[
+'None',
+],
+'sml' => 
+[
+'Sml',
+'Small',
+],
+'sqr' => 
+[
+'Sqr',
+'Square',
+],
+'sub' => 
+[
+'Sub',
+],
+'sup' => 
+[
+'Sup',
+'Super',
+],
+'vert' => 
+[
+'Vert',
+'Vertical',
+],
+'wide' => 
+[
+'Wide',
+],
+},
+'ea' => 
+{
+'a' => 
+[
+'A',
+'Ambiguous',
+],
+'f' => 
+[
+'F',
+'Fullwidth',
+],
+'h' => 
+[
+'H',
+'Halfwidth',
+],
+'n' => 
+[
+'N',
+'Neutral',
+],
+'na' => 
+[
+'Na',
+'Narrow',
+],
+'w' => 
+[
+'W',
+'Wide',
+],
+},
+'ext' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'gc' => 
+{
+'c' => 
+[
+'C',
+'Other',
+],
+'cc' => 
+[
+'Cc',
+'Control',
+'Cntrl',
+],
+'cf' => 
+[
+'Cf',
+'Format',
+],
+'cn' => 
+[
+'Cn',
+'Unassigned',
+],
+'co' => 
+[
+'Co',
+'Private_Use',
+],
+'cs' => 
+[
+'Cs',
+'Surrogate',
+],
+'l' => 
+[
+'L',
+'Letter',
+],
+'lc' => 
+[
+'LC',
+'Cased_Letter',
+],
+'ll' => 
+[
+'Ll',
+'Lowercase_Letter',
+],
+'lm' => 
+[
+'Lm',
+'Modifier_Letter',
+],
+'lo' => 
+[
+'Lo',
+'Other_Letter',
+],
+'lt' => 
+[
+'Lt',
+'Titlecase_Letter',
+],
+'lu' => 
+[
+'Lu',
+'Uppercase_Letter',
+],
+'m' => 
+[
+'M',
+'Mark',
+'Combining_Mark',
+],
+'mc' => 
+[
+'Mc',
+'Spacing_Mark',
+],
+'me' => 
+[
+'Me',
+'Enclosing_Mark',
+],
+'mn' => 
+[
+'Mn',
+'Nonspacing_Mark',
+],
+'n' => 
+[
+'N',
+'Number',
+],
+'nd' => 
+[
+'Nd',
+'Decimal_Number',
+'Digit',
+],
+'nl' => 
+[
+'Nl',
+'Letter_Number',
+],
+'no' => 
+[
+'No',
+'Other_Number',
+],
+'p' => 
+[
+'P',
+'Punctuation',
+'Punct',
+],
+'pc' => 
+[
+'Pc',
+'Connector_Punctuation',
+],
+'pd' => 
+[
+'Pd',
+'Dash_Punctuation',
+],
+'pe' => 
+[
+'Pe',
+'Close_Punctuation',
+],
+'pf' => 
+[
+'Pf',
+'Final_Punctuation',
+],
+'pi' => 
+[
+'Pi',
+'Initial_Punctuation',
+],
+'po' => 
+[
+'Po',
+'Other_Punctuation',
+],
+'ps' => 
+[
+'Ps',
+'Open_Punctuation',
+],
+'s' => 
+[
+'S',
+'Symbol',
+],
+'sc' => 
+[
+'Sc',
+'Currency_Symbol',
+],
+'sk' => 
+[
+'Sk',
+'Modifier_Symbol',
+],
+'sm' => 
+[
+'Sm',
+'Math_Symbol',
+],
+'so' => 
+[
+'So',
+'Other_Symbol',
+],
+'z' => 
+[
+'Z',
+'Separator',
+],
+'zl' => 
+[
+'Zl',
+'Line_Separator',
+],
+'zp' => 
+[
+'Zp',
+'Paragraph_Separator',
+],
+'zs' => 
+[
+'Zs',
+'Space_Separator',
+],
+},
+'gcb' => 
+{
+'cn' => 
+[
+'CN',
+'Control',
+],
+'cr' => 
+[
+'CR',
+],
+'eb' => 
+[
+'EB',
+'E_Base',
+],
+'ebg' => 
+[
+'EBG',
+'E_Base_GAZ',
+],
+'em' => 
+[
+'EM',
+'E_Modifier',
+],
+'ex' => 
+[
+'EX',
+'Extend',
+],
+'gaz' => 
+[
+'GAZ',
+'Glue_After_Zwj',
+],
+'l' => 
+[
+'L',
+],
+'lf' => 
+[
+'LF',
+],
+'lv' => 
+[
+'LV',
+],
+'lvt' => 
+[
+'LVT',
+],
+'pp' => 
+[
+'PP',
+'Prepend',
+],
+'ri' => 
+[
+'RI',
+'Regional_Indicator',
+],
+'sm' => 
+[
+'SM',
+'SpacingMark',
+],
+'t' => 
+[
+'T',
+],
+'v' => 
+[
+'V',
+],
+'xx' => 
+[
+'XX',
+'Other',
+],
+'zwj' => 
+[
+'ZWJ',
+],
+},
+'grbase' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'grext' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'hex' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'hst' => 
+{
+'l' => 
+[
+'L',
+'Leading_Jamo',
+],
+'lv' => 
+[
+'LV',
+'LV_Syllable',
+],
+'lvt' => 
+[
+'LVT',
+'LVT_Syllable',
+],
+'na' => 
+[
+'NA',
+'Not_Applicable',
+],
+'t' => 
+[
+'T',
+'Trailing_Jamo',
+],
+'v' => 
+[
+'V',
+'Vowel_Jamo',
+],
+},
+'hyphen' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'idc' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'ideo' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'ids' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'idsb' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'idst' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'in' => 
+{
+'1.1' => 
+[
+'1.1',
+],
+'10.0' => 
+[
+'10.0',
+'10.0',
+'V10_0',
+],
+'11.0' => 
+[
+'11.0',
+'11.0',
+'V11_0',
+],
+'12.0' => 
+[
+'12.0',
+'12.0',
+'V12_0',
+],
+'12.1' => 
+[
+'12.1',
+'12.1',
+'V12_1',
+],
+'2.0' => 
+[
+'2.0',
+'2.0',
+'V2_0',
+],
+'2.1' => 
+[
+'2.1',
+'2.1',
+'V2_1',
+],
+'3.0' => 
+[
+'3.0',
+'3.0',
+'V3_0',
+],
+'3.1' => 
+[
+'3.1',
+'3.1',
+'V3_1',
+],
+'3.2' => 
+[
+'3.2',
+'3.2',
+'V3_2',
+],
+'4.0' => 
+[
+'4.0',
+'4.0',
+'V4_0',
+],
+'4.1' => 
+[
+'4.1',
+'4.1',
+'V4_1',
+],
+'5.0' => 
+[
+'5.0',
+'5.0',
+'V5_0',
+],
+'5.1' => 
+[
+'5.1',
+'5.1',
+'V5_1',
+],
+'5.2' => 
+[
+'5.2',
+'5.2',
+'V5_2',
+],
+'6.0' => 
+[
+'6.0',
+'6.0',
+'V6_0',
+],
+'6.1' => 
+[
+'6.1',
+'6.1',
+'V6_1',
+],
+'6.2' => 
+[
+'6.2',
+'6.2',
+'V6_2',
+],
+'6.3' => 
+[
+'6.3',
+'6.3',
+'V6_3',
+],
+'7.0' => 
+[
+'7.0',
+'7.0',
+'V7_0',
+],
+'8.0' => 
+[
+'8.0',
+'8.0',
+'V8_0',
+],
+'9.0' => 
+[
+'9.0',
+'9.0',
+'V9_0',
+],
+'unassigned' => 
+[
+'Unassigned',
+],
+},
+'inpc' => 
+{
+'bottom' => 
+[
+'Bottom',
+],
+'bottomandleft' => 
+[
+'Bottom_And_Left',
+],
+'bottomandright' => 
+[
+'Bottom_And_Right',
+],
+'left' => 
+[
+'Left',
+],
+'leftandright' => 
+[
+'Left_And_Right',
+],
+'na' => 
+[
+'NA',
+],
+'overstruck' => 
+[
+'Overstruck',
+],
+'right' => 
+[
+'Right',
+],
+'top' => 
+[
+'Top',
+],
+'topandbottom' => 
+[
+'Top_And_Bottom',
+],
+'topandbottomandright' => 
+[
+'Top_And_Bottom_And_Right',
+],
+'topandleft' => 
+[
+'Top_And_Left',
+],
+'topandleftandright' => 
+[
+'Top_And_Left_And_Right',
+],
+'topandright' => 
+[
+'Top_And_Right',
+],
+'visualorderleft' => 
+[
+'Visual_Order_Left',
+],
+},
+'insc' => 
+{
+'avagraha' => 
+[
+'Avagraha',
+],
+'bindu' => 
+[
+'Bindu',
+],
+'brahmijoiningnumber' => 
+[
+'Brahmi_Joining_Number',
+],
+'cantillationmark' => 
+[
+'Cantillation_Mark',
+],
+'consonant' => 
+[
+'Consonant',
+],
+'consonantdead' => 
+[
+'Consonant_Dead',
+],
+'consonantfinal' => 
+[
+'Consonant_Final',
+],
+'consonantheadletter' => 
+[
+'Consonant_Head_Letter',
+],
+'consonantinitialpostfixed' => 
+[
+'Consonant_Initial_Postfixed',
+],
+'consonantkiller' => 
+[
+'Consonant_Killer',
+],
+'consonantmedial' => 
+[
+'Consonant_Medial',
+],
+'consonantplaceholder' => 
+[
+'Consonant_Placeholder',
+],
+'consonantprecedingrepha' => 
+[
+'Consonant_Preceding_Repha',
+],
+'consonantprefixed' => 
+[
+'Consonant_Prefixed',
+],
+'consonantsubjoined' => 
+[
+'Consonant_Subjoined',
+],
+'consonantsucceedingrepha' => 
+[
+'Consonant_Succeeding_Repha',
+],
+'consonantwithstacker' => 
+[
+'Consonant_With_Stacker',
+],
+'geminationmark' => 
+[
+'Gemination_Mark',
+],
+'invisiblestacker' => 
+[
+'Invisible_Stacker',
+],
+'joiner' => 
+[
+'Joiner',
+],
+'modifyingletter' => 
+[
+'Modifying_Letter',
+],
+'nonjoiner' => 
+[
+'Non_Joiner',
+],
+'nukta' => 
+[
+'Nukta',
+],
+'number' => 
+[
+'Number',
+],
+'numberjoiner' => 
+[
+'Number_Joiner',
+],
+'other' => 
+[
+'Other',
+],
+'purekiller' => 
+[
+'Pure_Killer',
+],
+'registershifter' => 
+[
+'Register_Shifter',
+],
+'syllablemodifier' => 
+[
+'Syllable_Modifier',
+],
+'toneletter' => 
+[
+'Tone_Letter',
+],
+'tonemark' => 
+[
+'Tone_Mark',
+],
+'virama' => 
+[
+'Virama',
+],
+'visarga' => 
+[
+'Visarga',
+],
+'vowel' => 
+[
+'Vowel',
+],
+'voweldependent' => 
+[
+'Vowel_Dependent',
+],
+'vowelindependent' => 
+[
+'Vowel_Independent',
+],
+},
+'jg' => 
+{
+'africanfeh' => 
+[
+'African_Feh',
+],
+'africannoon' => 
+[
+'African_Noon',
+],
+'africanqaf' => 
+[
+'African_Qaf',
+],
+'ain' => 
+[
+'Ain',
+],
+'alaph' => 
+[
+'Alaph',
+],
+'alef' => 
+[
+'Alef',
+],
+'beh' => 
+[
+'Beh',
+],
+'beth' => 
+[
+'Beth',
+],
+'burushaskiyehbarree' => 
+[
+'Burushaski_Yeh_Barree',
+],
+'dal' => 
+[
+'Dal',
+],
+'dalathrish' => 
+[
+'Dalath_Rish',
+],
+'e' => 
+[
+'E',
+],
+'farsiyeh' => 
+[
+'Farsi_Yeh',
+],
+'fe' => 
+[
+'Fe',
+],
+'feh' => 
+[
+'Feh',
+],
+'finalsemkath' => 
+[
+'Final_Semkath',
+],
+'gaf' => 
+[
+'Gaf',
+],
+'gamal' => 
+[
+'Gamal',
+],
+'hah' => 
+[
+'Hah',
+],
+'hanifirohingyakinnaya' => 
+[
+'Hanifi_Rohingya_Kinna_Ya',
+],
+'hanifirohingyapa' => 
+[
+'Hanifi_Rohingya_Pa',
+],
+'he' => 
+[
+'He',
+],
+'heh' => 
+[
+'Heh',
+],
+'hehgoal' => 
+[
+'Heh_Goal',
+],
+'heth' => 
+[
+'Heth',
+],
+'kaf' => 
+[
+'Kaf',
+],
+'kaph' => 
+[
+'Kaph',
+],
+'khaph' => 
+[
+'Khaph',
+],
+'knottedheh' => 
+[
+'Knotted_Heh',
+],
+'lam' => 
+[
+'Lam',
+],
+'lamadh' => 
+[
+'Lamadh',
+],
+'malayalambha' => 
+[
+'Malayalam_Bha',
+],
+'malayalamja' => 
+[
+'Malayalam_Ja',
+],
+'malayalamlla' => 
+[
+'Malayalam_Lla',
+],
+'malayalamllla' => 
+[
+'Malayalam_Llla',
+],
+'malayalamnga' => 
+[
+'Malayalam_Nga',
+],
+'malayalamnna' => 
+[
+'Malayalam_Nna',
+],
+'malayalamnnna' => 
+[
+'Malayalam_Nnna',
+],
+'malayalamnya' => 
+[
+'Malayalam_Nya',
+],
+'malayalamra' => 
+[
+'Malayalam_Ra',
+],
+'malayalamssa' => 
+[
+'Malayalam_Ssa',
+],
+'malayalamtta' => 
+[
+'Malayalam_Tta',
+],
+'manichaeanaleph' => 
+[
+'Manichaean_Aleph',
+],
+'manichaeanayin' => 
+[
+'Manichaean_Ayin',
+],
+'manichaeanbeth' => 
+[
+'Manichaean_Beth',
+],
+'manichaeandaleth' => 
+[
+'Manichaean_Daleth',
+],
+'manichaeandhamedh' => 
+[
+'Manichaean_Dhamedh',
+],
+'manichaeanfive' => 
+[
+'Manichaean_Five',
+],
+'manichaeangimel' => 
+[
+'Manichaean_Gimel',
+],
+'manichaeanheth' => 
+[
+'Manichaean_Heth',
+],
+'manichaeanhundred' => 
+[
+'Manichaean_Hundred',
+],
+'manichaeankaph' => 
+[
+'Manichaean_Kaph',
+],
+'manichaeanlamedh' => 
+[
+'Manichaean_Lamedh',
+],
+'manichaeanmem' => 
+[
+'Manichaean_Mem',
+],
+'manichaeannun' => 
+[
+'Manichaean_Nun',
+],
+'manichaeanone' => 
+[
+'Manichaean_One',
+],
+'manichaeanpe' => 
+[
+'Manichaean_Pe',
+],
+'manichaeanqoph' => 
+[
+'Manichaean_Qoph',
+],
+'manichaeanresh' => 
+[
+'Manichaean_Resh',
+],
+'manichaeansadhe' => 
+[
+'Manichaean_Sadhe',
+],
+'manichaeansamekh' => 
+[
+'Manichaean_Samekh',
+],
+'manichaeantaw' => 
+[
+'Manichaean_Taw',
+],
+'manichaeanten' => 
+[
+'Manichaean_Ten',
+],
+'manichaeanteth' => 
+[
+'Manichaean_Teth',
+],
+'manichaeanthamedh' => 
+[
+'Manichaean_Thamedh',
+],
+'manichaeantwenty' => 
+[
+'Manichaean_Twenty',
+],
+'manichaeanwaw' => 
+[
+'Manichaean_Waw',
+],
+'manichaeanyodh' => 
+[
+'Manichaean_Yodh',
+],
+'manichaeanzayin' => 
+[
+'Manichaean_Zayin',
+],
+'meem' => 
+[
+'Meem',
+],
+'mim' => 
+[
+'Mim',
+],
+'nojoininggroup' => 
+[
+'No_Joining_Group',
+],
+'noon' => 
+[
+'Noon',
+],
+'nun' => 
+[
+'Nun',
+],
+'nya' => 
+[
+'Nya',
+],
+'pe' => 
+[
+'Pe',
+],
+'qaf' => 
+[
+'Qaf',
+],
+'qaph' => 
+[
+'Qaph',
+],
+'reh' => 
+[
+'Reh',
+],
+'reversedpe' => 
+[
+'Reversed_Pe',
+],
+'rohingyayeh' => 
+[
+'Rohingya_Yeh',
+],
+'sad' => 
+[
+'Sad',
+],
+'sadhe' => 
+[
+'Sadhe',
+],
+'seen' => 
+[
+'Seen',
+],
+'semkath' => 
+[
+'Semkath',
+],
+'shin' => 
+[
+'Shin',
+],
+'straightwaw' => 
+[
+'Straight_Waw',
+],
+'swashkaf' => 
+[
+'Swash_Kaf',
+],
+'syriacwaw' => 
+[
+'Syriac_Waw',
+],
+'tah' => 
+[
+'Tah',
+],
+'taw' => 
+[
+'Taw',
+],
+'tehmarbuta' => 
+[
+'Teh_Marbuta',
+],
+'tehmarbutagoal' => 
+[
+'Teh_Marbuta_Goal',
+'Hamza_On_Heh_Goal',
+],
+'teth' => 
+[
+'Teth',
+],
+'waw' => 
+[
+'Waw',
+],
+'yeh' => 
+[
+'Yeh',
+],
+'yehbarree' => 
+[
+'Yeh_Barree',
+],
+'yehwithtail' => 
+[
+'Yeh_With_Tail',
+],
+'yudh' => 
+[
+'Yudh',
+],
+'yudhhe' => 
+[
+'Yudh_He',
+],
+'zain' => 
+[
+'Zain',
+],
+'zhain' => 
+[
+'Zhain',
+],
+},
+'joinc' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'jt' => 
+{
+'c' => 
+[
+'C',
+'Join_Causing',
+],
+'d' => 
+[
+'D',
+'Dual_Joining',
+],
+'l' => 
+[
+'L',
+'Left_Joining',
+],
+'r' => 
+[
+'R',
+'Right_Joining',
+],
+'t' => 
+[
+'T',
+'Transparent',
+],
+'u' => 
+[
+'U',
+'Non_Joining',
+],
+},
+'lb' => 
+{
+'ai' => 
+[
+'AI',
+'Ambiguous',
+],
+'al' => 
+[
+'AL',
+'Alphabetic',
+],
+'b2' => 
+[
+'B2',
+'Break_Both',
+],
+'ba' => 
+[
+'BA',
+'Break_After',
+],
+'bb' => 
+[
+'BB',
+'Break_Before',
+],
+'bk' => 
+[
+'BK',
+'Mandatory_Break',
+],
+'cb' => 
+[
+'CB',
+'Contingent_Break',
+],
+'cj' => 
+[
+'CJ',
+'Conditional_Japanese_Starter',
+],
+'cl' => 
+[
+'CL',
+'Close_Punctuation',
+],
+'cm' => 
+[
+'CM',
+'Combining_Mark',
+],
+'cp' => 
+[
+'CP',
+'Close_Parenthesis',
+],
+'cr' => 
+[
+'CR',
+'Carriage_Return',
+],
+'eb' => 
+[
+'EB',
+'E_Base',
+],
+'em' => 
+[
+'EM',
+'E_Modifier',
+],
+'ex' => 
+[
+'EX',
+'Exclamation',
+],
+'gl' => 
+[
+'GL',
+'Glue',
+],
+'h2' => 
+[
+'H2',
+],
+'h3' => 
+[
+'H3',
+],
+'hl' => 
+[
+'HL',
+'Hebrew_Letter',
+],
+'hy' => 
+[
+'HY',
+'Hyphen',
+],
+'id' => 
+[
+'ID',
+'Ideographic',
+],
+'in' => 
+[
+'IN',
+'Inseparable',
+'Inseperable',
+],
+'is' => 
+[
+'IS',
+'Infix_Numeric',
+],
+'jl' => 
+[
+'JL',
+],
+'jt' => 
+[
+'JT',
+],
+'jv' => 
+[
+'JV',
+],
+'lf' => 
+[
+'LF',
+'Line_Feed',
+],
+'nl' => 
+[
+'NL',
+'Next_Line',
+],
+'ns' => 
+[
+'NS',
+'Nonstarter',
+],
+'nu' => 
+[
+'NU',
+'Numeric',
+],
+'op' => 
+[
+'OP',
+'Open_Punctuation',
+],
+'po' => 
+[
+'PO',
+'Postfix_Numeric',
+],
+'pr' => 
+[
+'PR',
+'Prefix_Numeric',
+],
+'qu' => 
+[
+'QU',
+'Quotation',
+],
+'ri' => 
+[
+'RI',
+'Regional_Indicator',
+],
+'sa' => 
+[
+'SA',
+'Complex_Context',
+],
+'sg' => 
+[
+'SG',
+'Surrogate',
+],
+'sp' => 
+[
+'SP',
+'Space',
+],
+'sy' => 
+[
+'SY',
+'Break_Symbols',
+],
+'wj' => 
+[
+'WJ',
+'Word_Joiner',
+],
+'xx' => 
+[
+'XX',
+'Unknown',
+],
+'zw' => 
+[
+'ZW',
+'ZWSpace',
+],
+'zwj' => 
+[
+'ZWJ',
+],
+},
+'loe' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'lower' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'math' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'nchar' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'nfcqc' => 
+{
+'m' => 
+[
+'M',
+'Maybe',
+],
+'n' => 
+[
+'N',
+'No',
+],
+'y' => 
+[
+'Y',
+'Yes',
+],
+},
+'nfdqc' => 
+{
+'n' => 
+[
+'N',
+'No',
+],
+'y' => 
+[
+'Y',
+'Yes',
+],
+},
+'nfkcqc' => 
+{
+'m' => 
+[
+'M',
+'Maybe',
+],
+'n' => 
+[
+'N',
+'No',
+],
+'y' => 
+[
+'Y',
+'Yes',
+],
+},
+'nfkdqc' => 
+{
+'n' => 
+[
+'N',
+'No',
+],
+'y' => 
+[
+'Y',
+'Yes',
+],
+},
+'nt' => 
+{
+'de' => 
+[
+'De',
+'Decimal',
+],
+'di' => 
+[
+'Di',
+'Digit',
+],
+'none' => 
+[
+'None',
+],
+'nu' => 
+[
+'Nu',
+'Numeric',
+],
+},
+'nv' => 
+{
+'-1/2' => 
+[
+'-1/2',
+],
+0 => 
+[
+0,
+],
+1 => 
+[
+1,
+],
+'1/10' => 
+[
+'1/10',
+],
+'1/12' => 
+[
+'1/12',
+],
+'1/16' => 
+[
+'1/16',
+],
+'1/160' => 
+[
+'1/160',
+],
+'1/2' => 
+[
+'1/2',
+],
+'1/20' => 
+[
+'1/20',
+],
+'1/3' => 
+[
+'1/3',
+],
+'1/32' => 
+[
+'1/32',
+],
+'1/320' => 
+[
+'1/320',
+],
+'1/4' => 
+[
+'1/4',
+],
+'1/40' => 
+[
+'1/40',
+],
+'1/5' => 
+[
+'1/5',
+],
+'1/6' => 
+[
+'1/6',
+],
+'1/64' => 
+[
+'1/64',
+],
+'1/7' => 
+[
+'1/7',
+],
+'1/8' => 
+[
+'1/8',
+],
+'1/80' => 
+[
+'1/80',
+],
+'1/9' => 
+[
+'1/9',
+],
+10 => 
+[
+10,
+],
+100 => 
+[
+100,
+],
+1000 => 
+[
+1000,
+],
+10000 => 
+[
+10000,
+],
+100000 => 
+[
+100000,
+],
+1000000 => 
+[
+1000000,
+],
+10000000 => 
+[
+10000000,
+],
+100000000 => 
+[
+100000000,
+],
+10000000000 => 
+[
+10000000000,
+],
+1000000000000 => 
+[
+1000000000000,
+],
+11 => 
+[
+11,
+],
+'11/12' => 
+[
+'11/12',
+],
+'11/2' => 
+[
+'11/2',
+],
+12 => 
+[
+12,
+],
+13 => 
+[
+13,
+],
+'13/2' => 
+[
+'13/2',
+],
+14 => 
+[
+14,
+],
+15 => 
+[
+15,
+],
+'15/2' => 
+[
+'15/2',
+],
+16 => 
+[
+16,
+],
+17 => 
+[
+17,
+],
+'17/2' => 
+[
+'17/2',
+],
+18 => 
+[
+18,
+],
+19 => 
+[
+19,
+],
+2 => 
+[
+2,
+],
+'2/3' => 
+[
+'2/3',
+],
+'2/5' => 
+[
+'2/5',
+],
+20 => 
+[
+20,
+],
+200 => 
+[
+200,
+],
+2000 => 
+[
+2000,
+],
+20000 => 
+[
+20000,
+],
+200000 => 
+[
+200000,
+],
+20000000 => 
+[
+20000000,
+],
+21 => 
+[
+21,
+],
+216000 => 
+[
+216000,
+],
+22 => 
+[
+22,
+],
+23 => 
+[
+23,
+],
+24 => 
+[
+24,
+],
+25 => 
+[
+25,
+],
+26 => 
+[
+26,
+],
+27 => 
+[
+27,
+],
+28 => 
+[
+28,
+],
+29 => 
+[
+29,
+],
+3 => 
+[
+3,
+],
+'3/16' => 
+[
+'3/16',
+],
+'3/2' => 
+[
+'3/2',
+],
+'3/20' => 
+[
+'3/20',
+],
+'3/4' => 
+[
+'3/4',
+],
+'3/5' => 
+[
+'3/5',
+],
+'3/64' => 
+[
+'3/64',
+],
+'3/8' => 
+[
+'3/8',
+],
+'3/80' => 
+[
+'3/80',
+],
+30 => 
+[
+30,
+],
+300 => 
+[
+300,
+],
+3000 => 
+[
+3000,
+],
+30000 => 
+[
+30000,
+],
+300000 => 
+[
+300000,
+],
+31 => 
+[
+31,
+],
+32 => 
+[
+32,
+],
+33 => 
+[
+33,
+],
+34 => 
+[
+34,
+],
+35 => 
+[
+35,
+],
+36 => 
+[
+36,
+],
+37 => 
+[
+37,
+],
+38 => 
+[
+38,
+],
+39 => 
+[
+39,
+],
+4 => 
+[
+4,
+],
+'4/5' => 
+[
+'4/5',
+],
+40 => 
+[
+40,
+],
+400 => 
+[
+400,
+],
+4000 => 
+[
+4000,
+],
+40000 => 
+[
+40000,
+],
+400000 => 
+[
+400000,
+],
+41 => 
+[
+41,
+],
+42 => 
+[
+42,
+],
+43 => 
+[
+43,
+],
+432000 => 
+[
+432000,
+],
+44 => 
+[
+44,
+],
+45 => 
+[
+45,
+],
+46 => 
+[
+46,
+],
+47 => 
+[
+47,
+],
+48 => 
+[
+48,
+],
+49 => 
+[
+49,
+],
+5 => 
+[
+5,
+],
+'5/12' => 
+[
+'5/12',
+],
+'5/2' => 
+[
+'5/2',
+],
+'5/6' => 
+[
+'5/6',
+],
+'5/8' => 
+[
+'5/8',
+],
+50 => 
+[
+50,
+],
+500 => 
+[
+500,
+],
+5000 => 
+[
+5000,
+],
+50000 => 
+[
+50000,
+],
+500000 => 
+[
+500000,
+],
+6 => 
+[
+6,
+],
+60 => 
+[
+60,
+],
+600 => 
+[
+600,
+],
+6000 => 
+[
+6000,
+],
+60000 => 
+[
+60000,
+],
+600000 => 
+[
+600000,
+],
+7 => 
+[
+7,
+],
+'7/12' => 
+[
+'7/12',
+],
+'7/2' => 
+[
+'7/2',
+],
+'7/8' => 
+[
+'7/8',
+],
+70 => 
+[
+70,
+],
+700 => 
+[
+700,
+],
+7000 => 
+[
+7000,
+],
+70000 => 
+[
+70000,
+],
+700000 => 
+[
+700000,
+],
+8 => 
+[
+8,
+],
+80 => 
+[
+80,
+],
+800 => 
+[
+800,
+],
+8000 => 
+[
+8000,
+],
+80000 => 
+[
+80000,
+],
+800000 => 
+[
+800000,
+],
+9 => 
+[
+9,
+],
+'9/2' => 
+[
+'9/2',
+],
+90 => 
+[
+90,
+],
+900 => 
+[
+900,
+],
+9000 => 
+[
+9000,
+],
+90000 => 
+[
+90000,
+],
+900000 => 
+[
+900000,
+],
+'nan' => 
+[
+'NaN',
+],
+},
+'patsyn' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'patws' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'pcm' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'qmark' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'radical' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'ri' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'sb' => 
+{
+'at' => 
+[
+'AT',
+'ATerm',
+],
+'cl' => 
+[
+'CL',
+'Close',
+],
+'cr' => 
+[
+'CR',
+],
+'ex' => 
+[
+'EX',
+'Extend',
+],
+'fo' => 
+[
+'FO',
+'Format',
+],
+'le' => 
+[
+'LE',
+'OLetter',
+],
+'lf' => 
+[
+'LF',
+],
+'lo' => 
+[
+'LO',
+'Lower',
+],
+'nu' => 
+[
+'NU',
+'Numeric',
+],
+'sc' => 
+[
+'SC',
+'SContinue',
+],
+'se' => 
+[
+'SE',
+'Sep',
+],
+'sp' => 
+[
+'SP',
+'Sp',
+],
+'st' => 
+[
+'ST',
+'STerm',
+],
+'up' => 
+[
+'UP',
+'Upper',
+],
+'xx' => 
+[
+'XX',
+'Other',
+],
+},
+'sc' => 
+{
+'adlm' => 
+[
+'Adlm',
+'Adlam',
+],
+'aghb' => 
+[
+'Aghb',
+'Caucasian_Albanian',
+],
+'ahom' => 
+[
+'Ahom',
+],
+'arab' => 
+[
+'Arab',
+'Arabic',
+],
+'armi' => 
+[
+'Armi',
+'Imperial_Aramaic',
+],
+'armn' => 
+[
+'Armn',
+'Armenian',
+],
+'avst' => 
+[
+'Avst',
+'Avestan',
+],
+'bali' => 
+[
+'Bali',
+'Balinese',
+],
+'bamu' => 
+[
+'Bamu',
+'Bamum',
+],
+'bass' => 
+[
+'Bass',
+'Bassa_Vah',
+],
+'batk' => 
+[
+'Batk',
+'Batak',
+],
+'beng' => 
+[
+'Beng',
+'Bengali',
+],
+'bhks' => 
+[
+'Bhks',
+'Bhaiksuki',
+],
+'bopo' => 
+[
+'Bopo',
+'Bopomofo',
+],
+'brah' => 
+[
+'Brah',
+'Brahmi',
+],
+'brai' => 
+[
+'Brai',
+'Braille',
+],
+'bugi' => 
+[
+'Bugi',
+'Buginese',
+],
+'buhd' => 
+[
+'Buhd',
+'Buhid',
+],
+'cakm' => 
+[
+'Cakm',
+'Chakma',
+],
+'cans' => 
+[
+'Cans',
+'Canadian_Aboriginal',
+],
+'cari' => 
+[
+'Cari',
+'Carian',
+],
+'cham' => 
+[
+'Cham',
+],
+'cher' => 
+[
+'Cher',
+'Cherokee',
+],
+'copt' => 
+[
+'Copt',
+'Coptic',
+'Qaac',
+],
+'cprt' => 
+[
+'Cprt',
+'Cypriot',
+],
+'cyrl' => 
+[
+'Cyrl',
+'Cyrillic',
+],
+'deva' => 
+[
+'Deva',
+'Devanagari',
+],
+'dogr' => 
+[
+'Dogr',
+'Dogra',
+],
+'dsrt' => 
+[
+'Dsrt',
+'Deseret',
+],
+'dupl' => 
+[
+'Dupl',
+'Duployan',
+],
+'egyp' => 
+[
+'Egyp',
+'Egyptian_Hieroglyphs',
+],
+'elba' => 
+[
+'Elba',
+'Elbasan',
+],
+'elym' => 
+[
+'Elym',
+'Elymaic',
+],
+'ethi' => 
+[
+'Ethi',
+'Ethiopic',
+],
+'geor' => 
+[
+'Geor',
+'Georgian',
+],
+'glag' => 
+[
+'Glag',
+'Glagolitic',
+],
+'gong' => 
+[
+'Gong',
+'Gunjala_Gondi',
+],
+'gonm' => 
+[
+'Gonm',
+'Masaram_Gondi',
+],
+'goth' => 
+[
+'Goth',
+'Gothic',
+],
+'gran' => 
+[
+'Gran',
+'Grantha',
+],
+'grek' => 
+[
+'Grek',
+'Greek',
+],
+'gujr' => 
+[
+'Gujr',
+'Gujarati',
+],
+'guru' => 
+[
+'Guru',
+'Gurmukhi',
+],
+'hang' => 
+[
+'Hang',
+'Hangul',
+],
+'hani' => 
+[
+'Hani',
+'Han',
+],
+'hano' => 
+[
+'Hano',
+'Hanunoo',
+],
+'hatr' => 
+[
+'Hatr',
+'Hatran',
+],
+'hebr' => 
+[
+'Hebr',
+'Hebrew',
+],
+'hira' => 
+[
+'Hira',
+'Hiragana',
+],
+'hluw' => 
+[
+'Hluw',
+'Anatolian_Hieroglyphs',
+],
+'hmng' => 
+[
+'Hmng',
+'Pahawh_Hmong',
+],
+'hmnp' => 
+[
+'Hmnp',
+'Nyiakeng_Puachue_Hmong',
+],
+'hrkt' => 
+[
+'Hrkt',
+'Katakana_Or_Hiragana',
+],
+'hung' => 
+[
+'Hung',
+'Old_Hungarian',
+],
+'ital' => 
+[
+'Ital',
+'Old_Italic',
+],
+'java' => 
+[
+'Java',
+'Javanese',
+],
+'kali' => 
+[
+'Kali',
+'Kayah_Li',
+],
+'kana' => 
+[
+'Kana',
+'Katakana',
+],
+'khar' => 
+[
+'Khar',
+'Kharoshthi',
+],
+'khmr' => 
+[
+'Khmr',
+'Khmer',
+],
+'khoj' => 
+[
+'Khoj',
+'Khojki',
+],
+'knda' => 
+[
+'Knda',
+'Kannada',
+],
+'kthi' => 
+[
+'Kthi',
+'Kaithi',
+],
+'lana' => 
+[
+'Lana',
+'Tai_Tham',
+],
+'laoo' => 
+[
+'Laoo',
+'Lao',
+],
+'latn' => 
+[
+'Latn',
+'Latin',
+],
+'lepc' => 
+[
+'Lepc',
+'Lepcha',
+],
+'limb' => 
+[
+'Limb',
+'Limbu',
+],
+'lina' => 
+[
+'Lina',
+'Linear_A',
+],
+'linb' => 
+[
+'Linb',
+'Linear_B',
+],
+'lisu' => 
+[
+'Lisu',
+],
+'lyci' => 
+[
+'Lyci',
+'Lycian',
+],
+'lydi' => 
+[
+'Lydi',
+'Lydian',
+],
+'mahj' => 
+[
+'Mahj',
+'Mahajani',
+],
+'maka' => 
+[
+'Maka',
+'Makasar',
+],
+'mand' => 
+[
+'Mand',
+'Mandaic',
+],
+'mani' => 
+[
+'Mani',
+'Manichaean',
+],
+'marc' => 
+[
+'Marc',
+'Marchen',
+],
+'medf' => 
+[
+'Medf',
+'Medefaidrin',
+],
+'mend' => 
+[
+'Mend',
+'Mende_Kikakui',
+],
+'merc' => 
+[
+'Merc',
+'Meroitic_Cursive',
+],
+'mero' => 
+[
+'Mero',
+'Meroitic_Hieroglyphs',
+],
+'mlym' => 
+[
+'Mlym',
+'Malayalam',
+],
+'modi' => 
+[
+'Modi',
+],
+'mong' => 
+[
+'Mong',
+'Mongolian',
+],
+'mroo' => 
+[
+'Mroo',
+'Mro',
+],
+'mtei' => 
+[
+'Mtei',
+'Meetei_Mayek',
+],
+'mult' => 
+[
+'Mult',
+'Multani',
+],
+'mymr' => 
+[
+'Mymr',
+'Myanmar',
+],
+'nand' => 
+[
+'Nand',
+'Nandinagari',
+],
+'narb' => 
+[
+'Narb',
+'Old_North_Arabian',
+],
+'nbat' => 
+[
+'Nbat',
+'Nabataean',
+],
+'newa' => 
+[
+'Newa',
+],
+'nkoo' => 
+[
+'Nkoo',
+'Nko',
+],
+'nshu' => 
+[
+'Nshu',
+'Nushu',
+],
+'ogam' => 
+[
+'Ogam',
+'Ogham',
+],
+'olck' => 
+[
+'Olck',
+'Ol_Chiki',
+],
+'orkh' => 
+[
+'Orkh',
+'Old_Turkic',
+],
+'orya' => 
+[
+'Orya',
+'Oriya',
+],
+'osge' => 
+[
+'Osge',
+'Osage',
+],
+'osma' => 
+[
+'Osma',
+'Osmanya',
+],
+'palm' => 
+[
+'Palm',
+'Palmyrene',
+],
+'pauc' => 
+[
+'Pauc',
+'Pau_Cin_Hau',
+],
+'perm' => 
+[
+'Perm',
+'Old_Permic',
+],
+'phag' => 
+[
+'Phag',
+'Phags_Pa',
+],
+'phli' => 
+[
+'Phli',
+'Inscriptional_Pahlavi',
+],
+'phlp' => 
+[
+'Phlp',
+'Psalter_Pahlavi',
+],
+'phnx' => 
+[
+'Phnx',
+'Phoenician',
+],
+'plrd' => 
+[
+'Plrd',
+'Miao',
+],
+'prti' => 
+[
+'Prti',
+'Inscriptional_Parthian',
+],
+'rjng' => 
+[
+'Rjng',
+'Rejang',
+],
+'rohg' => 
+[
+'Rohg',
+'Hanifi_Rohingya',
+],
+'runr' => 
+[
+'Runr',
+'Runic',
+],
+'samr' => 
+[
+'Samr',
+'Samaritan',
+],
+'sarb' => 
+[
+'Sarb',
+'Old_South_Arabian',
+],
+'saur' => 
+[
+'Saur',
+'Saurashtra',
+],
+'sgnw' => 
+[
+'Sgnw',
+'SignWriting',
+],
+'shaw' => 
+[
+'Shaw',
+'Shavian',
+],
+'shrd' => 
+[
+'Shrd',
+'Sharada',
+],
+'sidd' => 
+[
+'Sidd',
+'Siddham',
+],
+'sind' => 
+[
+'Sind',
+'Khudawadi',
+],
+'sinh' => 
+[
+'Sinh',
+'Sinhala',
+],
+'sogd' => 
+[
+'Sogd',
+'Sogdian',
+],
+'sogo' => 
+[
+'Sogo',
+'Old_Sogdian',
+],
+'sora' => 
+[
+'Sora',
+'Sora_Sompeng',
+],
+'soyo' => 
+[
+'Soyo',
+'Soyombo',
+],
+'sund' => 
+[
+'Sund',
+'Sundanese',
+],
+'sylo' => 
+[
+'Sylo',
+'Syloti_Nagri',
+],
+'syrc' => 
+[
+'Syrc',
+'Syriac',
+],
+'tagb' => 
+[
+'Tagb',
+'Tagbanwa',
+],
+'takr' => 
+[
+'Takr',
+'Takri',
+],
+'tale' => 
+[
+'Tale',
+'Tai_Le',
+],
+'talu' => 
+[
+'Talu',
+'New_Tai_Lue',
+],
+'taml' => 
+[
+'Taml',
+'Tamil',
+],
+'tang' => 
+[
+'Tang',
+'Tangut',
+],
+'tavt' => 
+[
+'Tavt',
+'Tai_Viet',
+],
+'telu' => 
+[
+'Telu',
+'Telugu',
+],
+'tfng' => 
+[
+'Tfng',
+'Tifinagh',
+],
+'tglg' => 
+[
+'Tglg',
+'Tagalog',
+],
+'thaa' => 
+[
+'Thaa',
+'Thaana',
+],
+'thai' => 
+[
+'Thai',
+],
+'tibt' => 
+[
+'Tibt',
+'Tibetan',
+],
+'tirh' => 
+[
+'Tirh',
+'Tirhuta',
+],
+'ugar' => 
+[
+'Ugar',
+'Ugaritic',
+],
+'vaii' => 
+[
+'Vaii',
+'Vai',
+],
+'wara' => 
+[
+'Wara',
+'Warang_Citi',
+],
+'wcho' => 
+[
+'Wcho',
+'Wancho',
+],
+'xpeo' => 
+[
+'Xpeo',
+'Old_Persian',
+],
+'xsux' => 
+[
+'Xsux',
+'Cuneiform',
+],
+'yiii' => 
+[
+'Yiii',
+'Yi',
+],
+'zanb' => 
+[
+'Zanb',
+'Zanabazar_Square',
+],
+'zinh' => 
+[
+'Zinh',
+'Inherited',
+'Qaai',
+],
+'zyyy' => 
+[
+'Zyyy',
+'Common',
+],
+'zzzz' => 
+[
+'Zzzz',
+'Unknown',
+],
+},
+'scx' => 
+{
+'adlm' => 
+[
+'Adlm',
+'Adlam',
+],
+'aghb' => 
+[
+'Aghb',
+'Caucasian_Albanian',
+],
+'ahom' => 
+[
+'Ahom',
+],
+'arab' => 
+[
+'Arab',
+'Arabic',
+],
+'armi' => 
+[
+'Armi',
+'Imperial_Aramaic',
+],
+'armn' => 
+[
+'Armn',
+'Armenian',
+],
+'avst' => 
+[
+'Avst',
+'Avestan',
+],
+'bali' => 
+[
+'Bali',
+'Balinese',
+],
+'bamu' => 
+[
+'Bamu',
+'Bamum',
+],
+'bass' => 
+[
+'Bass',
+'Bassa_Vah',
+],
+'batk' => 
+[
+'Batk',
+'Batak',
+],
+'beng' => 
+[
+'Beng',
+'Bengali',
+],
+'bhks' => 
+[
+'Bhks',
+'Bhaiksuki',
+],
+'bopo' => 
+[
+'Bopo',
+'Bopomofo',
+],
+'brah' => 
+[
+'Brah',
+'Brahmi',
+],
+'brai' => 
+[
+'Brai',
+'Braille',
+],
+'bugi' => 
+[
+'Bugi',
+'Buginese',
+],
+'buhd' => 
+[
+'Buhd',
+'Buhid',
+],
+'cakm' => 
+[
+'Cakm',
+'Chakma',
+],
+'cans' => 
+[
+'Cans',
+'Canadian_Aboriginal',
+],
+'cari' => 
+[
+'Cari',
+'Carian',
+],
+'cham' => 
+[
+'Cham',
+],
+'cher' => 
+[
+'Cher',
+'Cherokee',
+],
+'copt' => 
+[
+'Copt',
+'Coptic',
+'Qaac',
+],
+'cprt' => 
+[
+'Cprt',
+'Cypriot',
+],
+'cyrl' => 
+[
+'Cyrl',
+'Cyrillic',
+],
+'deva' => 
+[
+'Deva',
+'Devanagari',
+],
+'dogr' => 
+[
+'Dogr',
+'Dogra',
+],
+'dsrt' => 
+[
+'Dsrt',
+'Deseret',
+],
+'dupl' => 
+[
+'Dupl',
+'Duployan',
+],
+'egyp' => 
+[
+'Egyp',
+'Egyptian_Hieroglyphs',
+],
+'elba' => 
+[
+'Elba',
+'Elbasan',
+],
+'elym' => 
+[
+'Elym',
+'Elymaic',
+],
+'ethi' => 
+[
+'Ethi',
+'Ethiopic',
+],
+'geor' => 
+[
+'Geor',
+'Georgian',
+],
+'glag' => 
+[
+'Glag',
+'Glagolitic',
+],
+'gong' => 
+[
+'Gong',
+'Gunjala_Gondi',
+],
+'gonm' => 
+[
+'Gonm',
+'Masaram_Gondi',
+],
+'goth' => 
+[
+'Goth',
+'Gothic',
+],
+'gran' => 
+[
+'Gran',
+'Grantha',
+],
+'grek' => 
+[
+'Grek',
+'Greek',
+],
+'gujr' => 
+[
+'Gujr',
+'Gujarati',
+],
+'guru' => 
+[
+'Guru',
+'Gurmukhi',
+],
+'hang' => 
+[
+'Hang',
+'Hangul',
+],
+'hani' => 
+[
+'Hani',
+'Han',
+],
+'hano' => 
+[
+'Hano',
+'Hanunoo',
+],
+'hatr' => 
+[
+'Hatr',
+'Hatran',
+],
+'hebr' => 
+[
+'Hebr',
+'Hebrew',
+],
+'hira' => 
+[
+'Hira',
+'Hiragana',
+],
+'hluw' => 
+[
+'Hluw',
+'Anatolian_Hieroglyphs',
+],
+'hmng' => 
+[
+'Hmng',
+'Pahawh_Hmong',
+],
+'hmnp' => 
+[
+'Hmnp',
+'Nyiakeng_Puachue_Hmong',
+],
+'hrkt' => 
+[
+'Hrkt',
+'Katakana_Or_Hiragana',
+],
+'hung' => 
+[
+'Hung',
+'Old_Hungarian',
+],
+'ital' => 
+[
+'Ital',
+'Old_Italic',
+],
+'java' => 
+[
+'Java',
+'Javanese',
+],
+'kali' => 
+[
+'Kali',
+'Kayah_Li',
+],
+'kana' => 
+[
+'Kana',
+'Katakana',
+],
+'khar' => 
+[
+'Khar',
+'Kharoshthi',
+],
+'khmr' => 
+[
+'Khmr',
+'Khmer',
+],
+'khoj' => 
+[
+'Khoj',
+'Khojki',
+],
+'knda' => 
+[
+'Knda',
+'Kannada',
+],
+'kthi' => 
+[
+'Kthi',
+'Kaithi',
+],
+'lana' => 
+[
+'Lana',
+'Tai_Tham',
+],
+'laoo' => 
+[
+'Laoo',
+'Lao',
+],
+'latn' => 
+[
+'Latn',
+'Latin',
+],
+'lepc' => 
+[
+'Lepc',
+'Lepcha',
+],
+'limb' => 
+[
+'Limb',
+'Limbu',
+],
+'lina' => 
+[
+'Lina',
+'Linear_A',
+],
+'linb' => 
+[
+'Linb',
+'Linear_B',
+],
+'lisu' => 
+[
+'Lisu',
+],
+'lyci' => 
+[
+'Lyci',
+'Lycian',
+],
+'lydi' => 
+[
+'Lydi',
+'Lydian',
+],
+'mahj' => 
+[
+'Mahj',
+'Mahajani',
+],
+'maka' => 
+[
+'Maka',
+'Makasar',
+],
+'mand' => 
+[
+'Mand',
+'Mandaic',
+],
+'mani' => 
+[
+'Mani',
+'Manichaean',
+],
+'marc' => 
+[
+'Marc',
+'Marchen',
+],
+'medf' => 
+[
+'Medf',
+'Medefaidrin',
+],
+'mend' => 
+[
+'Mend',
+'Mende_Kikakui',
+],
+'merc' => 
+[
+'Merc',
+'Meroitic_Cursive',
+],
+'mero' => 
+[
+'Mero',
+'Meroitic_Hieroglyphs',
+],
+'mlym' => 
+[
+'Mlym',
+'Malayalam',
+],
+'modi' => 
+[
+'Modi',
+],
+'mong' => 
+[
+'Mong',
+'Mongolian',
+],
+'mroo' => 
+[
+'Mroo',
+'Mro',
+],
+'mtei' => 
+[
+'Mtei',
+'Meetei_Mayek',
+],
+'mult' => 
+[
+'Mult',
+'Multani',
+],
+'mymr' => 
+[
+'Mymr',
+'Myanmar',
+],
+'nand' => 
+[
+'Nand',
+'Nandinagari',
+],
+'narb' => 
+[
+'Narb',
+'Old_North_Arabian',
+],
+'nbat' => 
+[
+'Nbat',
+'Nabataean',
+],
+'newa' => 
+[
+'Newa',
+],
+'nkoo' => 
+[
+'Nkoo',
+'Nko',
+],
+'nshu' => 
+[
+'Nshu',
+'Nushu',
+],
+'ogam' => 
+[
+'Ogam',
+'Ogham',
+],
+'olck' => 
+[
+'Olck',
+'Ol_Chiki',
+],
+'orkh' => 
+[
+'Orkh',
+'Old_Turkic',
+],
+'orya' => 
+[
+'Orya',
+'Oriya',
+],
+'osge' => 
+[
+'Osge',
+'Osage',
+],
+'osma' => 
+[
+'Osma',
+'Osmanya',
+],
+'palm' => 
+[
+'Palm',
+'Palmyrene',
+],
+'pauc' => 
+[
+'Pauc',
+'Pau_Cin_Hau',
+],
+'perm' => 
+[
+'Perm',
+'Old_Permic',
+],
+'phag' => 
+[
+'Phag',
+'Phags_Pa',
+],
+'phli' => 
+[
+'Phli',
+'Inscriptional_Pahlavi',
+],
+'phlp' => 
+[
+'Phlp',
+'Psalter_Pahlavi',
+],
+'phnx' => 
+[
+'Phnx',
+'Phoenician',
+],
+'plrd' => 
+[
+'Plrd',
+'Miao',
+],
+'prti' => 
+[
+'Prti',
+'Inscriptional_Parthian',
+],
+'rjng' => 
+[
+'Rjng',
+'Rejang',
+],
+'rohg' => 
+[
+'Rohg',
+'Hanifi_Rohingya',
+],
+'runr' => 
+[
+'Runr',
+'Runic',
+],
+'samr' => 
+[
+'Samr',
+'Samaritan',
+],
+'sarb' => 
+[
+'Sarb',
+'Old_South_Arabian',
+],
+'saur' => 
+[
+'Saur',
+'Saurashtra',
+],
+'sgnw' => 
+[
+'Sgnw',
+'SignWriting',
+],
+'shaw' => 
+[
+'Shaw',
+'Shavian',
+],
+'shrd' => 
+[
+'Shrd',
+'Sharada',
+],
+'sidd' => 
+[
+'Sidd',
+'Siddham',
+],
+'sind' => 
+[
+'Sind',
+'Khudawadi',
+],
+'sinh' => 
+[
+'Sinh',
+'Sinhala',
+],
+'sogd' => 
+[
+'Sogd',
+'Sogdian',
+],
+'sogo' => 
+[
+'Sogo',
+'Old_Sogdian',
+],
+'sora' => 
+[
+'Sora',
+'Sora_Sompeng',
+],
+'soyo' => 
+[
+'Soyo',
+'Soyombo',
+],
+'sund' => 
+[
+'Sund',
+'Sundanese',
+],
+'sylo' => 
+[
+'Sylo',
+'Syloti_Nagri',
+],
+'syrc' => 
+[
+'Syrc',
+'Syriac',
+],
+'tagb' => 
+[
+'Tagb',
+'Tagbanwa',
+],
+'takr' => 
+[
+'Takr',
+'Takri',
+],
+'tale' => 
+[
+'Tale',
+'Tai_Le',
+],
+'talu' => 
+[
+'Talu',
+'New_Tai_Lue',
+],
+'taml' => 
+[
+'Taml',
+'Tamil',
+],
+'tang' => 
+[
+'Tang',
+'Tangut',
+],
+'tavt' => 
+[
+'Tavt',
+'Tai_Viet',
+],
+'telu' => 
+[
+'Telu',
+'Telugu',
+],
+'tfng' => 
+[
+'Tfng',
+'Tifinagh',
+],
+'tglg' => 
+[
+'Tglg',
+'Tagalog',
+],
+'thaa' => 
+[
+'Thaa',
+'Thaana',
+],
+'thai' => 
+[
+'Thai',
+],
+'tibt' => 
+[
+'Tibt',
+'Tibetan',
+],
+'tirh' => 
+[
+'Tirh',
+'Tirhuta',
+],
+'ugar' => 
+[
+'Ugar',
+'Ugaritic',
+],
+'vaii' => 
+[
+'Vaii',
+'Vai',
+],
+'wara' => 
+[
+'Wara',
+'Warang_Citi',
+],
+'wcho' => 
+[
+'Wcho',
+'Wancho',
+],
+'xpeo' => 
+[
+'Xpeo',
+'Old_Persian',
+],
+'xsux' => 
+[
+'Xsux',
+'Cuneiform',
+],
+'yiii' => 
+[
+'Yiii',
+'Yi',
+],
+'zanb' => 
+[
+'Zanb',
+'Zanabazar_Square',
+],
+'zinh' => 
+[
+'Zinh',
+'Inherited',
+'Qaai',
+],
+'zyyy' => 
+[
+'Zyyy',
+'Common',
+],
+'zzzz' => 
+[
+'Zzzz',
+'Unknown',
+],
+},
+'sd' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'sterm' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'term' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'uideo' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'upper' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'vo' => 
+{
+'r' => 
+[
+'R',
+'Rotated',
+],
+'tr' => 
+[
+'Tr',
+'Transformed_Rotated',
+],
+'tu' => 
+[
+'Tu',
+'Transformed_Upright',
+],
+'u' => 
+[
+'U',
+'Upright',
+],
+},
+'vs' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'wb' => 
+{
+'cr' => 
+[
+'CR',
+],
+'dq' => 
+[
+'DQ',
+'Double_Quote',
+],
+'eb' => 
+[
+'EB',
+'E_Base',
+],
+'ebg' => 
+[
+'EBG',
+'E_Base_GAZ',
+],
+'em' => 
+[
+'EM',
+'E_Modifier',
+],
+'ex' => 
+[
+'EX',
+'ExtendNumLet',
+],
+'extend' => 
+[
+'Extend',
+],
+'fo' => 
+[
+'FO',
+'Format',
+],
+'gaz' => 
+[
+'GAZ',
+'Glue_After_Zwj',
+],
+'hl' => 
+[
+'HL',
+'Hebrew_Letter',
+],
+'ka' => 
+[
+'KA',
+'Katakana',
+],
+'le' => 
+[
+'LE',
+'ALetter',
+],
+'lf' => 
+[
+'LF',
+],
+'mb' => 
+[
+'MB',
+'MidNumLet',
+],
+'ml' => 
+[
+'ML',
+'MidLetter',
+],
+'mn' => 
+[
+'MN',
+'MidNum',
+],
+'nl' => 
+[
+'NL',
+'Newline',
+],
+'nu' => 
+[
+'NU',
+'Numeric',
+],
+'ri' => 
+[
+'RI',
+'Regional_Indicator',
+],
+'sq' => 
+[
+'SQ',
+'Single_Quote',
+],
+'wsegspace' => 
+[
+'WSegSpace',
+],
+'xx' => 
+[
+'XX',
+'Other',
+],
+'zwj' => 
+[
+'ZWJ',
+],
+},
+'wspace' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'xidc' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+'xids' => 
+{
+'n' => 
+[
+'N',
+'No',
+'F',
+'False',
+],
+'y' => 
+[
+'Y',
+'Yes',
+'T',
+'True',
+],
+},
+);
+
+# Ordered (by code point ordinal) list of the ranges of code points whose
+# names are algorithmically determined.  Each range entry is an anonymous hash
+# of the start and end points and a template for the names within it.
+@Unicode::UCD::algorithmic_named_code_points = (
+
+{
+'high' => 19893,
+'low' => 13312,
+'name' => 'CJK UNIFIED IDEOGRAPH-<code point>',
+},
+{
+'high' => 40943,
+'low' => 19968,
+'name' => 'CJK UNIFIED IDEOGRAPH-<code point>',
+},
+{
+'high' => 55203,
+'low' => 44032,
+'name' => '<hangul syllable>',
+},
+{
+'high' => 64109,
+'low' => 63744,
+'name' => 'CJK COMPATIBILITY IDEOGRAPH-<code point>',
+},
+{
+'high' => 64217,
+'low' => 64112,
+'name' => 'CJK COMPATIBILITY IDEOGRAPH-<code point>',
+},
+{
+'high' => 100343,
+'low' => 94208,
+'name' => 'TANGUT IDEOGRAPH-<code point>',
+},
+{
+'high' => 111355,
+'low' => 110960,
+'name' => 'NUSHU CHARACTER-<code point>',
+},
+{
+'high' => 173782,
+'low' => 131072,
+'name' => 'CJK UNIFIED IDEOGRAPH-<code point>',
+},
+{
+'high' => 177972,
+'low' => 173824,
+'name' => 'CJK UNIFIED IDEOGRAPH-<code point>',
+},
+{
+'high' => 178205,
+'low' => 177984,
+'name' => 'CJK UNIFIED IDEOGRAPH-<code point>',
+},
+{
+'high' => 183969,
+'low' => 178208,
+'name' => 'CJK UNIFIED IDEOGRAPH-<code point>',
+},
+{
+'high' => 191456,
+'low' => 183984,
+'name' => 'CJK UNIFIED IDEOGRAPH-<code point>',
+},
+{
+'high' => 195101,
+'low' => 194560,
+'name' => 'CJK COMPATIBILITY IDEOGRAPH-<code point>',
+},
+,
+);
+
+# The properties that as-is have two meanings, and which must be disambiguated
+%Unicode::UCD::ambiguous_names = (
+'cf' => 1,
+'isc' => 1,
+'lc' => 1,
+'sc' => 1,
+);
+
+# Keys are the prop-val combinations which are the default values for the
+# given property, expressed in standard loose form
+%Unicode::UCD::loose_defaults = (
+'age=na' => 1,
+'age=unassigned' => 1,
+'ahex=f' => 1,
+'ahex=false' => 1,
+'ahex=n' => 1,
+'ahex=no' => 1,
+'alpha=f' => 1,
+'alpha=false' => 1,
+'alpha=n' => 1,
+'alpha=no' => 1,
+'bc=l' => 1,
+'bc=lefttoright' => 1,
+'bidic=f' => 1,
+'bidic=false' => 1,
+'bidic=n' => 1,
+'bidic=no' => 1,
+'bidim=f' => 1,
+'bidim=false' => 1,
+'bidim=n' => 1,
+'bidim=no' => 1,
+'blk=nb' => 1,
+'blk=noblock' => 1,
+'bpt=n' => 1,
+'bpt=none' => 1,
+'cased=f' => 1,
+'cased=false' => 1,
+'cased=n' => 1,
+'cased=no' => 1,
+'ccc=0' => 1,
+'ccc=notreordered' => 1,
+'ccc=nr' => 1,
+'ce=f' => 1,
+'ce=false' => 1,
+'ce=n' => 1,
+'ce=no' => 1,
+'ci=f' => 1,
+'ci=false' => 1,
+'ci=n' => 1,
+'ci=no' => 1,
+'cn' => 1,
+'compex=f' => 1,
+'compex=false' => 1,
+'compex=n' => 1,
+'compex=no' => 1,
+'cwcf=f' => 1,
+'cwcf=false' => 1,
+'cwcf=n' => 1,
+'cwcf=no' => 1,
+'cwcm=f' => 1,
+'cwcm=false' => 1,
+'cwcm=n' => 1,
+'cwcm=no' => 1,
+'cwkcf=f' => 1,
+'cwkcf=false' => 1,
+'cwkcf=n' => 1,
+'cwkcf=no' => 1,
+'cwl=f' => 1,
+'cwl=false' => 1,
+'cwl=n' => 1,
+'cwl=no' => 1,
+'cwt=f' => 1,
+'cwt=false' => 1,
+'cwt=n' => 1,
+'cwt=no' => 1,
+'cwu=f' => 1,
+'cwu=false' => 1,
+'cwu=n' => 1,
+'cwu=no' => 1,
+'dash=f' => 1,
+'dash=false' => 1,
+'dash=n' => 1,
+'dash=no' => 1,
+'dep=f' => 1,
+'dep=false' => 1,
+'dep=n' => 1,
+'dep=no' => 1,
+'di=f' => 1,
+'di=false' => 1,
+'di=n' => 1,
+'di=no' => 1,
+'dia=f' => 1,
+'dia=false' => 1,
+'dia=n' => 1,
+'dia=no' => 1,
+'dt=none' => 1,
+'ea=n' => 1,
+'ea=neutral' => 1,
+'ext=f' => 1,
+'ext=false' => 1,
+'ext=n' => 1,
+'ext=no' => 1,
+'gc=cn' => 1,
+'gc=unassigned' => 1,
+'gcb=other' => 1,
+'gcb=xx' => 1,
+'grbase=f' => 1,
+'grbase=false' => 1,
+'grbase=n' => 1,
+'grbase=no' => 1,
+'grext=f' => 1,
+'grext=false' => 1,
+'grext=n' => 1,
+'grext=no' => 1,
+'hex=f' => 1,
+'hex=false' => 1,
+'hex=n' => 1,
+'hex=no' => 1,
+'hst=na' => 1,
+'hst=notapplicable' => 1,
+'hyphen=f' => 1,
+'hyphen=false' => 1,
+'hyphen=n' => 1,
+'hyphen=no' => 1,
+'idc=f' => 1,
+'idc=false' => 1,
+'idc=n' => 1,
+'idc=no' => 1,
+'ideo=f' => 1,
+'ideo=false' => 1,
+'ideo=n' => 1,
+'ideo=no' => 1,
+'ids=f' => 1,
+'ids=false' => 1,
+'ids=n' => 1,
+'ids=no' => 1,
+'idsb=f' => 1,
+'idsb=false' => 1,
+'idsb=n' => 1,
+'idsb=no' => 1,
+'idst=f' => 1,
+'idst=false' => 1,
+'idst=n' => 1,
+'idst=no' => 1,
+'in=unassigned' => 1,
+'innb' => 1,
+'innoblock' => 1,
+'inpc=na' => 1,
+'insc=other' => 1,
+'iscn' => 1,
+'isnb' => 1,
+'isnoblock' => 1,
+'isunassigned' => 1,
+'isunknown' => 1,
+'iszzzz' => 1,
+'jg=nojoininggroup' => 1,
+'joinc=f' => 1,
+'joinc=false' => 1,
+'joinc=n' => 1,
+'joinc=no' => 1,
+'jt=nonjoining' => 1,
+'jt=u' => 1,
+'lb=unknown' => 1,
+'lb=xx' => 1,
+'loe=f' => 1,
+'loe=false' => 1,
+'loe=n' => 1,
+'loe=no' => 1,
+'lower=f' => 1,
+'lower=false' => 1,
+'lower=n' => 1,
+'lower=no' => 1,
+'math=f' => 1,
+'math=false' => 1,
+'math=n' => 1,
+'math=no' => 1,
+'nb' => 1,
+'nchar=f' => 1,
+'nchar=false' => 1,
+'nchar=n' => 1,
+'nchar=no' => 1,
+'nfcqc=y' => 1,
+'nfcqc=yes' => 1,
+'nfdqc=y' => 1,
+'nfdqc=yes' => 1,
+'nfkcqc=y' => 1,
+'nfkcqc=yes' => 1,
+'nfkdqc=y' => 1,
+'nfkdqc=yes' => 1,
+'noblock' => 1,
+'nt=none' => 1,
+'nv=nan' => 1,
+'patsyn=f' => 1,
+'patsyn=false' => 1,
+'patsyn=n' => 1,
+'patsyn=no' => 1,
+'patws=f' => 1,
+'patws=false' => 1,
+'patws=n' => 1,
+'patws=no' => 1,
+'pcm=f' => 1,
+'pcm=false' => 1,
+'pcm=n' => 1,
+'pcm=no' => 1,
+'qmark=f' => 1,
+'qmark=false' => 1,
+'qmark=n' => 1,
+'qmark=no' => 1,
+'radical=f' => 1,
+'radical=false' => 1,
+'radical=n' => 1,
+'radical=no' => 1,
+'ri=f' => 1,
+'ri=false' => 1,
+'ri=n' => 1,
+'ri=no' => 1,
+'sb=other' => 1,
+'sb=xx' => 1,
+'sc=unknown' => 1,
+'sc=zzzz' => 1,
+'scx=unknown' => 1,
+'scx=zzzz' => 1,
+'sd=f' => 1,
+'sd=false' => 1,
+'sd=n' => 1,
+'sd=no' => 1,
+'sterm=f' => 1,
+'sterm=false' => 1,
+'sterm=n' => 1,
+'sterm=no' => 1,
+'term=f' => 1,
+'term=false' => 1,
+'term=n' => 1,
+'term=no' => 1,
+'uideo=f' => 1,
+'uideo=false' => 1,
+'uideo=n' => 1,
+'uideo=no' => 1,
+'unassigned' => 1,
+'unknown' => 1,
+'upper=f' => 1,
+'upper=false' => 1,
+'upper=n' => 1,
+'upper=no' => 1,
+'vo=r' => 1,
+'vo=rotated' => 1,
+'vs=f' => 1,
+'vs=false' => 1,
+'vs=n' => 1,
+'vs=no' => 1,
+'wb=other' => 1,
+'wb=xx' => 1,
+'wspace=f' => 1,
+'wspace=false' => 1,
+'wspace=n' => 1,
+'wspace=no' => 1,
+'xidc=f' => 1,
+'xidc=false' => 1,
+'xidc=n' => 1,
+'xidc=no' => 1,
+'xids=f' => 1,
+'xids=false' => 1,
+'xids=n' => 1,
+'xids=no' => 1,
+'zzzz' => 1,
+);
+
+# The properties that are combinations, in that they have both a map table and
+# a match table.  This is actually for UCD.t, so it knows how to test for
+# these.
+%Unicode::UCD::combination_property = (
+
+);
+
+# All combinations of names that are suppressed.
+# This is actually for UCD.t, so it knows which properties shouldn't have
+# entries.  If it got any bigger, would probably want to put it in its own
+# file to use memory only when it was needed, in testing.
+@Unicode::UCD::suppressed_properties = (
+
+'cjkaccountingnumeric',
+'cjkcompatibilityvariant',
+'cjkiicore',
+'cjkirggsource',
+'cjkirghsource',
+'cjkirgjsource',
+'cjkirgkpsource',
+'cjkirgksource',
+'cjkirgmsource',
+'cjkirgtsource',
+'cjkirgusource',
+'cjkirgvsource',
+'cjkothernumeric',
+'cjkprimarynumeric',
+'cjkrsunicode',
+'expandsonnfc',
+'expandsonnfd',
+'expandsonnfkc',
+'expandsonnfkd',
+'extendedpictographic',
+'fcnfkc',
+'fcnfkcclosure',
+'graphemelink',
+'grlink',
+'jamoshortname',
+'jsn',
+'kaccountingnumeric',
+'kcompatibilityvariant',
+'kiicore',
+'kirggsource',
+'kirghsource',
+'kirgjsource',
+'kirgkpsource',
+'kirgksource',
+'kirgmsource',
+'kirgtsource',
+'kirgusource',
+'kirgvsource',
+'kothernumeric',
+'kprimarynumeric',
+'krsunicode',
+'oalpha',
+'odi',
+'ogrext',
+'oidc',
+'oids',
+'olower',
+'omath',
+'otheralphabetic',
+'otherdefaultignorablecodepoint',
+'othergraphemeextend',
+'otheridcontinue',
+'otheridstart',
+'otherlowercase',
+'othermath',
+'otheruppercase',
+'oupper',
+'sc=hrkt',
+'sc=katakanaorhiragana',
+'script=hrkt',
+'script=katakanaorhiragana',
+'scriptextensions=hrkt',
+'scriptextensions=katakanaorhiragana',
+'scx=hrkt',
+'scx=katakanaorhiragana',
+'unicoderadicalstroke',
+'urs',
+'xonfc',
+'xonfd',
+'xonfkc',
+'xonfkd',
+'xpg',
+,
+);
+
+1;
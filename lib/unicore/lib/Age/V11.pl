@@ -0,0 +1,590 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V576
+0
+502
+506
+536
+592
+681
+688
+735
+736
+746
+768
+838
+864
+866
+884
+886
+890
+891
+894
+895
+900
+907
+908
+909
+910
+930
+931
+975
+976
+983
+986
+987
+988
+989
+990
+991
+992
+993
+994
+1012
+1025
+1037
+1038
+1104
+1105
+1117
+1118
+1159
+1168
+1221
+1223
+1225
+1227
+1229
+1232
+1260
+1262
+1270
+1272
+1274
+1329
+1367
+1369
+1376
+1377
+1416
+1417
+1418
+1456
+1466
+1467
+1476
+1488
+1515
+1520
+1525
+1548
+1549
+1563
+1564
+1567
+1568
+1569
+1595
+1600
+1619
+1632
+1646
+1648
+1720
+1722
+1727
+1728
+1743
+1744
+1774
+1776
+1786
+2305
+2308
+2309
+2362
+2364
+2382
+2384
+2389
+2392
+2417
+2433
+2436
+2437
+2445
+2447
+2449
+2451
+2473
+2474
+2481
+2482
+2483
+2486
+2490
+2492
+2493
+2494
+2501
+2503
+2505
+2507
+2510
+2519
+2520
+2524
+2526
+2527
+2532
+2534
+2555
+2562
+2563
+2565
+2571
+2575
+2577
+2579
+2601
+2602
+2609
+2610
+2612
+2613
+2615
+2616
+2618
+2620
+2621
+2622
+2627
+2631
+2633
+2635
+2638
+2649
+2653
+2654
+2655
+2662
+2677
+2689
+2692
+2693
+2700
+2701
+2702
+2703
+2706
+2707
+2729
+2730
+2737
+2738
+2740
+2741
+2746
+2748
+2758
+2759
+2762
+2763
+2766
+2768
+2769
+2784
+2785
+2790
+2800
+2817
+2820
+2821
+2829
+2831
+2833
+2835
+2857
+2858
+2865
+2866
+2868
+2870
+2874
+2876
+2884
+2887
+2889
+2891
+2894
+2902
+2904
+2908
+2910
+2911
+2914
+2918
+2929
+2946
+2948
+2949
+2955
+2958
+2961
+2962
+2966
+2969
+2971
+2972
+2973
+2974
+2976
+2979
+2981
+2984
+2987
+2990
+2998
+2999
+3002
+3006
+3011
+3014
+3017
+3018
+3022
+3031
+3032
+3047
+3059
+3073
+3076
+3077
+3085
+3086
+3089
+3090
+3113
+3114
+3124
+3125
+3130
+3134
+3141
+3142
+3145
+3146
+3150
+3157
+3159
+3168
+3170
+3174
+3184
+3202
+3204
+3205
+3213
+3214
+3217
+3218
+3241
+3242
+3252
+3253
+3258
+3262
+3269
+3270
+3273
+3274
+3278
+3285
+3287
+3294
+3295
+3296
+3298
+3302
+3312
+3330
+3332
+3333
+3341
+3342
+3345
+3346
+3369
+3370
+3386
+3390
+3396
+3398
+3401
+3402
+3406
+3415
+3416
+3424
+3426
+3430
+3440
+3585
+3643
+3647
+3676
+3713
+3715
+3716
+3717
+3719
+3721
+3722
+3723
+3725
+3726
+3732
+3736
+3737
+3744
+3745
+3748
+3749
+3750
+3751
+3752
+3754
+3756
+3757
+3770
+3771
+3774
+3776
+3781
+3782
+3783
+3784
+3790
+3792
+3802
+3804
+3806
+4256
+4294
+4304
+4343
+4347
+4348
+4352
+4442
+4447
+4515
+4520
+4602
+7680
+7835
+7840
+7930
+7936
+7958
+7960
+7966
+7968
+8006
+8008
+8014
+8016
+8024
+8025
+8026
+8027
+8028
+8029
+8030
+8031
+8062
+8064
+8117
+8118
+8133
+8134
+8148
+8150
+8156
+8157
+8176
+8178
+8181
+8182
+8191
+8192
+8239
+8240
+8263
+8298
+8305
+8308
+8335
+8352
+8363
+8400
+8418
+8448
+8505
+8531
+8579
+8592
+8683
+8704
+8946
+8960
+8961
+8962
+9083
+9216
+9253
+9280
+9291
+9312
+9451
+9472
+9622
+9632
+9712
+9728
+9748
+9754
+9840
+9985
+9989
+9990
+9994
+9996
+10024
+10025
+10060
+10061
+10062
+10063
+10067
+10070
+10071
+10072
+10079
+10081
+10088
+10102
+10133
+10136
+10160
+10161
+10175
+12288
+12344
+12351
+12352
+12353
+12437
+12441
+12447
+12449
+12543
+12549
+12589
+12593
+12687
+12688
+12704
+12800
+12829
+12832
+12868
+12896
+12924
+12927
+12977
+12992
+13004
+13008
+13055
+13056
+13175
+13179
+13278
+13280
+13311
+19968
+40870
+57344
+64046
+64256
+64263
+64275
+64280
+64286
+64311
+64312
+64317
+64318
+64319
+64320
+64322
+64323
+64325
+64326
+64434
+64467
+64832
+64848
+64912
+64914
+64968
+65008
+65020
+65056
+65060
+65072
+65093
+65097
+65107
+65108
+65127
+65128
+65132
+65136
+65139
+65140
+65141
+65142
+65277
+65279
+65280
+65281
+65375
+65377
+65471
+65474
+65480
+65482
+65488
+65490
+65496
+65498
+65501
+65504
+65511
+65512
+65519
+65533
+65536
+END
@@ -0,0 +1,132 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V118
+1376
+1377
+1416
+1417
+1519
+1520
+2045
+2048
+2259
+2260
+2558
+2559
+2678
+2679
+3076
+3077
+3204
+3205
+6264
+6265
+7312
+7355
+7357
+7360
+11194
+11197
+11219
+11244
+11248
+11263
+11850
+11855
+12591
+12592
+40939
+40944
+42927
+42928
+42936
+42938
+43262
+43264
+68148
+68150
+68168
+68169
+68864
+68904
+68912
+68922
+69376
+69416
+69424
+69466
+69837
+69838
+69956
+69959
+70459
+70460
+70750
+70751
+71450
+71451
+71680
+71740
+72349
+72350
+73056
+73062
+73063
+73065
+73066
+73103
+73104
+73106
+73107
+73113
+73120
+73130
+73440
+73465
+93760
+93851
+100333
+100338
+119520
+119540
+119666
+119673
+126065
+126133
+127279
+127280
+128761
+128762
+128981
+128985
+129357
+129360
+129388
+129393
+129395
+129399
+129402
+129403
+129404
+129408
+129432
+129443
+129456
+129466
+129473
+129475
+129511
+129536
+129632
+129646
+END
@@ -0,0 +1,134 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V120
+3191
+3192
+3718
+3719
+3721
+3722
+3724
+3725
+3726
+3732
+3736
+3737
+3744
+3745
+3752
+3754
+3756
+3757
+3770
+3771
+7418
+7419
+11209
+11210
+11263
+11264
+11855
+11856
+42938
+42944
+42946
+42951
+43878
+43880
+69600
+69623
+70751
+70752
+71352
+71353
+72096
+72104
+72106
+72152
+72154
+72165
+72324
+72326
+73664
+73714
+73727
+73728
+78896
+78905
+94021
+94027
+94031
+94032
+94079
+94088
+94178
+94180
+100338
+100344
+110928
+110931
+110948
+110952
+123136
+123181
+123184
+123198
+123200
+123210
+123214
+123216
+123584
+123642
+123647
+123648
+125259
+125260
+126209
+126270
+127340
+127341
+128725
+128726
+128762
+128763
+128992
+129004
+129293
+129296
+129343
+129344
+129393
+129394
+129403
+129404
+129445
+129451
+129454
+129456
+129466
+129472
+129475
+129483
+129485
+129488
+129536
+129620
+129648
+129652
+129656
+129659
+129664
+129667
+129680
+129686
+END
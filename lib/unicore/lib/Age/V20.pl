@@ -0,0 +1,72 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V58
+1425
+1442
+1443
+1456
+1476
+1477
+3840
+3912
+3913
+3946
+3953
+3980
+3984
+3990
+3991
+3992
+3993
+4014
+4017
+4024
+4025
+4026
+7835
+7836
+8363
+8364
+44032
+55204
+55296
+57344
+131070
+131072
+196606
+196608
+262142
+262144
+327678
+327680
+393214
+393216
+458750
+458752
+524286
+524288
+589822
+589824
+655358
+655360
+720894
+720896
+786430
+786432
+851966
+851968
+917502
+917504
+983038
+1114112
+END
@@ -0,0 +1,256 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V242
+502
+506
+536
+544
+546
+564
+681
+686
+735
+736
+746
+751
+838
+847
+866
+867
+983
+984
+987
+988
+989
+990
+991
+992
+993
+994
+1024
+1025
+1037
+1038
+1104
+1105
+1117
+1118
+1160
+1162
+1164
+1168
+1260
+1262
+1418
+1419
+1619
+1622
+1720
+1722
+1727
+1728
+1743
+1744
+1786
+1791
+1792
+1806
+1807
+1837
+1840
+1867
+1920
+1969
+3458
+3460
+3461
+3479
+3482
+3506
+3507
+3516
+3517
+3518
+3520
+3527
+3530
+3531
+3535
+3541
+3542
+3543
+3544
+3552
+3570
+3573
+3946
+3947
+3990
+3991
+4014
+4017
+4024
+4025
+4026
+4029
+4030
+4045
+4047
+4048
+4096
+4130
+4131
+4136
+4137
+4139
+4140
+4147
+4150
+4154
+4160
+4186
+4608
+4615
+4616
+4679
+4680
+4681
+4682
+4686
+4688
+4695
+4696
+4697
+4698
+4702
+4704
+4743
+4744
+4745
+4746
+4750
+4752
+4783
+4784
+4785
+4786
+4790
+4792
+4799
+4800
+4801
+4802
+4806
+4808
+4815
+4816
+4823
+4824
+4847
+4848
+4879
+4880
+4881
+4882
+4886
+4888
+4895
+4896
+4935
+4936
+4955
+4961
+4989
+5024
+5109
+5121
+5751
+5760
+5789
+5792
+5873
+6016
+6109
+6112
+6122
+6144
+6159
+6160
+6170
+6176
+6264
+6272
+6314
+8239
+8240
+8264
+8270
+8365
+8368
+8418
+8420
+8505
+8507
+8579
+8580
+8683
+8692
+8961
+8962
+9083
+9084
+9085
+9115
+9253
+9255
+9712
+9720
+9753
+9754
+9840
+9842
+10240
+10496
+11904
+11930
+11931
+12020
+12032
+12246
+12272
+12284
+12344
+12347
+12350
+12351
+12704
+12728
+13312
+19894
+40960
+42125
+42128
+42146
+42148
+42164
+42165
+42177
+42178
+42181
+42182
+42183
+64285
+64286
+65529
+65532
+END
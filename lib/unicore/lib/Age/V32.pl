@@ -0,0 +1,132 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V118
+544
+545
+847
+848
+867
+880
+984
+986
+1014
+1015
+1162
+1164
+1221
+1223
+1225
+1227
+1229
+1231
+1280
+1296
+1646
+1648
+1969
+1970
+4343
+4345
+5888
+5901
+5902
+5909
+5920
+5943
+5952
+5972
+5984
+5997
+5998
+6001
+6002
+6004
+8263
+8264
+8270
+8275
+8279
+8280
+8287
+8292
+8305
+8306
+8368
+8370
+8420
+8427
+8509
+8524
+8692
+8704
+8946
+8960
+9084
+9085
+9115
+9167
+9451
+9471
+9622
+9632
+9720
+9728
+9750
+9752
+9842
+9854
+9856
+9866
+10088
+10102
+10192
+10220
+10224
+10240
+10496
+11008
+12347
+12350
+12437
+12439
+12447
+12449
+12543
+12544
+12784
+12800
+12881
+12896
+12977
+12992
+42146
+42148
+42164
+42165
+42177
+42178
+42181
+42182
+64048
+64107
+65020
+65021
+65024
+65040
+65093
+65095
+65139
+65140
+65375
+65377
+END
@@ -0,0 +1,168 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V154
+545
+546
+564
+567
+686
+688
+751
+768
+848
+856
+861
+864
+1015
+1020
+1536
+1540
+1549
+1558
+1622
+1625
+1774
+1776
+1791
+1792
+1837
+1840
+1869
+1872
+2308
+2309
+2493
+2494
+2561
+2562
+2563
+2564
+2700
+2701
+2785
+2788
+2801
+2802
+2869
+2870
+2929
+2930
+3059
+3067
+3260
+3262
+6109
+6110
+6128
+6138
+6400
+6429
+6432
+6444
+6448
+6460
+6464
+6465
+6468
+6510
+6512
+6517
+6624
+6656
+7424
+7532
+8275
+8277
+8507
+8508
+9167
+9169
+9471
+9472
+9748
+9750
+9866
+9874
+9888
+9890
+11008
+11022
+12829
+12831
+12880
+12881
+12924
+12926
+13004
+13008
+13175
+13179
+13278
+13280
+13311
+13312
+19904
+19968
+65021
+65022
+65095
+65097
+65536
+65548
+65549
+65575
+65576
+65595
+65596
+65598
+65599
+65614
+65616
+65630
+65664
+65787
+65792
+65795
+65799
+65844
+65847
+65856
+66432
+66462
+66463
+66464
+66598
+66600
+66638
+66718
+66720
+66730
+67584
+67590
+67592
+67593
+67594
+67638
+67639
+67641
+67644
+67645
+67647
+67648
+119552
+119639
+120001
+120002
+917760
+918000
+END
@@ -0,0 +1,186 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V172
+567
+578
+856
+861
+1020
+1024
+1270
+1272
+1442
+1443
+1477
+1480
+1547
+1548
+1566
+1567
+1625
+1631
+1872
+1902
+2429
+2430
+2510
+2511
+2998
+2999
+3046
+3047
+4048
+4050
+4345
+4347
+4348
+4349
+4615
+4616
+4679
+4680
+4743
+4744
+4783
+4784
+4815
+4816
+4847
+4848
+4879
+4880
+4895
+4896
+4935
+4936
+4959
+4961
+4992
+5018
+6528
+6570
+6576
+6602
+6608
+6618
+6622
+6624
+6656
+6684
+6686
+6688
+7532
+7620
+8277
+8279
+8280
+8287
+8336
+8341
+8370
+8374
+8427
+8428
+8508
+8509
+8524
+8525
+9169
+9180
+9752
+9753
+9854
+9856
+9874
+9885
+9890
+9906
+10176
+10183
+11022
+11028
+11264
+11311
+11312
+11359
+11392
+11499
+11513
+11558
+11568
+11622
+11631
+11632
+11648
+11671
+11680
+11687
+11688
+11695
+11696
+11703
+11704
+11711
+11712
+11719
+11720
+11727
+11728
+11735
+11736
+11743
+11776
+11800
+11804
+11806
+12736
+12752
+12926
+12927
+40870
+40892
+42752
+42775
+43008
+43052
+64112
+64218
+65040
+65050
+65856
+65931
+66464
+66500
+66504
+66518
+68096
+68100
+68101
+68103
+68108
+68116
+68117
+68120
+68121
+68148
+68152
+68155
+68159
+68168
+68176
+68185
+119296
+119366
+120484
+120486
+END
@@ -0,0 +1,192 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V178
+880
+884
+886
+888
+975
+976
+1159
+1160
+1300
+1316
+1542
+1547
+1558
+1563
+1595
+1600
+1902
+1920
+2417
+2419
+2641
+2642
+2677
+2678
+2884
+2885
+2914
+2916
+3024
+3025
+3133
+3134
+3160
+3162
+3170
+3172
+3192
+3200
+3389
+3390
+3396
+3397
+3426
+3428
+3440
+3446
+3449
+3456
+3947
+3949
+4046
+4047
+4050
+4053
+4130
+4131
+4136
+4137
+4139
+4140
+4147
+4150
+4154
+4160
+4186
+4250
+4254
+4256
+6314
+6315
+7040
+7083
+7086
+7098
+7168
+7224
+7227
+7242
+7245
+7296
+7627
+7655
+7836
+7840
+7930
+7936
+8292
+8293
+8432
+8433
+8527
+8528
+8581
+8585
+9885
+9886
+9907
+9917
+9920
+9924
+10188
+10189
+10220
+10224
+11035
+11040
+11044
+11085
+11088
+11093
+11373
+11376
+11377
+11380
+11384
+11390
+11744
+11776
+11800
+11804
+11806
+11825
+12589
+12590
+12752
+12772
+40892
+40900
+42240
+42540
+42560
+42592
+42594
+42612
+42620
+42648
+42779
+42784
+42786
+42893
+43003
+43008
+43136
+43205
+43214
+43226
+43264
+43348
+43359
+43360
+43520
+43575
+43584
+43598
+43600
+43610
+43612
+43616
+65060
+65063
+65936
+65948
+66000
+66046
+66176
+66205
+66208
+66257
+67872
+67898
+67903
+67904
+119081
+119082
+126976
+127020
+127024
+127124
+END
@@ -0,0 +1,194 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V180
+1316
+1318
+2048
+2094
+2096
+2111
+2304
+2305
+2382
+2383
+2389
+2390
+2425
+2427
+2555
+2556
+4053
+4057
+4250
+4254
+4442
+4447
+4515
+4520
+4602
+4608
+5120
+5121
+5751
+5760
+6320
+6390
+6570
+6572
+6618
+6619
+6688
+6751
+6752
+6781
+6783
+6794
+6800
+6810
+6816
+6830
+7376
+7411
+7677
+7678
+8374
+8377
+8528
+8531
+8585
+8586
+9192
+9193
+9886
+9888
+9917
+9920
+9924
+9934
+9935
+9954
+9955
+9956
+9960
+9984
+10071
+10072
+11093
+11098
+11376
+11377
+11390
+11392
+11499
+11506
+11825
+11826
+12868
+12880
+40900
+40908
+42192
+42240
+42656
+42744
+43056
+43066
+43232
+43260
+43360
+43389
+43392
+43470
+43471
+43482
+43486
+43488
+43616
+43644
+43648
+43715
+43739
+43744
+43968
+44014
+44016
+44026
+55216
+55239
+55243
+55292
+64107
+64110
+67648
+67670
+67671
+67680
+67866
+67868
+68192
+68224
+68352
+68406
+68409
+68438
+68440
+68467
+68472
+68480
+68608
+68681
+69216
+69247
+69760
+69826
+77824
+78895
+127232
+127243
+127248
+127279
+127281
+127282
+127293
+127294
+127295
+127296
+127298
+127299
+127302
+127303
+127306
+127311
+127319
+127320
+127327
+127328
+127353
+127354
+127355
+127357
+127359
+127360
+127370
+127374
+127376
+127377
+127488
+127489
+127504
+127538
+127552
+127561
+173824
+177973
+END
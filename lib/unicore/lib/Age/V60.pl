@@ -0,0 +1,226 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V212
+1318
+1320
+1568
+1569
+1631
+1632
+2112
+2140
+2142
+2143
+2362
+2364
+2383
+2384
+2390
+2392
+2419
+2424
+2930
+2936
+3369
+3370
+3386
+3387
+3406
+3407
+3980
+3984
+4057
+4059
+4957
+4959
+7104
+7156
+7164
+7168
+7676
+7677
+8341
+8349
+8377
+8378
+9193
+9204
+9934
+9935
+9954
+9955
+9956
+9960
+9989
+9990
+9994
+9996
+10024
+10025
+10060
+10061
+10062
+10063
+10067
+10070
+10079
+10081
+10133
+10136
+10160
+10161
+10175
+10176
+10190
+10192
+11632
+11633
+11647
+11648
+12728
+12731
+42592
+42594
+42893
+42895
+42896
+42898
+42912
+42922
+43002
+43003
+43777
+43783
+43785
+43791
+43793
+43799
+43808
+43815
+43816
+43823
+64434
+64450
+69632
+69710
+69714
+69744
+92160
+92729
+110592
+110594
+127136
+127151
+127153
+127167
+127169
+127184
+127185
+127200
+127280
+127281
+127282
+127293
+127294
+127295
+127296
+127298
+127299
+127302
+127303
+127306
+127311
+127319
+127320
+127327
+127328
+127338
+127344
+127353
+127354
+127355
+127357
+127359
+127360
+127370
+127374
+127376
+127377
+127387
+127462
+127488
+127489
+127491
+127538
+127547
+127568
+127570
+127744
+127777
+127792
+127798
+127799
+127869
+127872
+127892
+127904
+127941
+127942
+127947
+127968
+127985
+128000
+128063
+128064
+128065
+128066
+128248
+128249
+128253
+128256
+128318
+128336
+128360
+128507
+128512
+128513
+128529
+128530
+128533
+128534
+128535
+128536
+128537
+128538
+128539
+128540
+128543
+128544
+128550
+128552
+128556
+128557
+128558
+128560
+128564
+128565
+128577
+128581
+128592
+128640
+128710
+128768
+128884
+177984
+178206
+END
@@ -0,0 +1,192 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V178
+1423
+1424
+1540
+1541
+2208
+2209
+2210
+2221
+2276
+2303
+2800
+2801
+3806
+3808
+4295
+4296
+4301
+4302
+4349
+4352
+7083
+7086
+7098
+7104
+7360
+7368
+7411
+7415
+10187
+10188
+10189
+10190
+11506
+11508
+11559
+11560
+11565
+11566
+11622
+11624
+11826
+11836
+40908
+40909
+42612
+42620
+42655
+42656
+42898
+42900
+42922
+42923
+43000
+43002
+43744
+43767
+64046
+64048
+67968
+68024
+68030
+68032
+69840
+69865
+69872
+69882
+69888
+69941
+69942
+69956
+70016
+70089
+70096
+70106
+71296
+71352
+71360
+71370
+93952
+94021
+94032
+94079
+94095
+94112
+126464
+126468
+126469
+126496
+126497
+126499
+126500
+126501
+126503
+126504
+126505
+126515
+126516
+126520
+126521
+126522
+126523
+126524
+126530
+126531
+126535
+126536
+126537
+126538
+126539
+126540
+126541
+126544
+126545
+126547
+126548
+126549
+126551
+126552
+126553
+126554
+126555
+126556
+126557
+126558
+126559
+126560
+126561
+126563
+126564
+126565
+126567
+126571
+126572
+126579
+126580
+126584
+126585
+126589
+126590
+126591
+126592
+126602
+126603
+126620
+126625
+126628
+126629
+126634
+126635
+126652
+126704
+126706
+127338
+127340
+128320
+128324
+128512
+128513
+128529
+128530
+128533
+128534
+128535
+128536
+128537
+128538
+128539
+128540
+128543
+128544
+128550
+128552
+128556
+128557
+128558
+128560
+128564
+128565
+END
@@ -0,0 +1,132 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V118
+2227
+2229
+2275
+2276
+2809
+2810
+3162
+3163
+3423
+3424
+5109
+5110
+5112
+5118
+8382
+8383
+8586
+8588
+11244
+11248
+40909
+40918
+42654
+42655
+42895
+42896
+42930
+42936
+43260
+43262
+43872
+43876
+43888
+43968
+65070
+65072
+67808
+67827
+67828
+67830
+67835
+67840
+68028
+68030
+68032
+68048
+68050
+68096
+68736
+68787
+68800
+68851
+68858
+68864
+70089
+70093
+70107
+70112
+70272
+70279
+70280
+70281
+70282
+70286
+70287
+70302
+70303
+70314
+70400
+70401
+70480
+70481
+71114
+71134
+71424
+71450
+71453
+71468
+71472
+71488
+74649
+74650
+74880
+75076
+82944
+83527
+119262
+119273
+120832
+121484
+121499
+121504
+121505
+121520
+127789
+127792
+127870
+127872
+127951
+127956
+127992
+128000
+128255
+128256
+128331
+128336
+128579
+128581
+128720
+128721
+129296
+129305
+129408
+129413
+129472
+129473
+178208
+183970
+END
@@ -0,0 +1,118 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V104
+2230
+2238
+2260
+2275
+3200
+3201
+3407
+3408
+3412
+3415
+3416
+3423
+3446
+3449
+7296
+7305
+7675
+7676
+9211
+9215
+11843
+11845
+42926
+42927
+43205
+43206
+65933
+65935
+66736
+66772
+66776
+66812
+70206
+70207
+70656
+70746
+70747
+70748
+70749
+70750
+71264
+71277
+72704
+72713
+72714
+72759
+72760
+72774
+72784
+72813
+72816
+72848
+72850
+72872
+72873
+72887
+94176
+94177
+94208
+100333
+100352
+101107
+122880
+122887
+122888
+122905
+122907
+122914
+122915
+122917
+122918
+122923
+125184
+125259
+125264
+125274
+125278
+125280
+127387
+127405
+127547
+127548
+128378
+128379
+128420
+128421
+128721
+128723
+128756
+128759
+129305
+129311
+129312
+129320
+129328
+129329
+129331
+129343
+129344
+129356
+129360
+129375
+129413
+129426
+END
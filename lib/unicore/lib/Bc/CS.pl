@@ -0,0 +1,40 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V26
+44
+45
+46
+48
+58
+59
+160
+161
+1548
+1549
+8239
+8240
+8260
+8261
+65104
+65105
+65106
+65107
+65109
+65110
+65292
+65293
+65294
+65296
+65306
+65307
+END
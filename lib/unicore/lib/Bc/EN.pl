@@ -0,0 +1,38 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V24
+48
+58
+178
+180
+185
+186
+1776
+1786
+8304
+8305
+8308
+8314
+8320
+8330
+9352
+9372
+65296
+65306
+66273
+66300
+120782
+120832
+127232
+127243
+END
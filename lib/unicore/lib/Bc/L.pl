@@ -0,0 +1,917 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V903
+65
+91
+97
+123
+170
+171
+181
+182
+186
+187
+192
+215
+216
+247
+248
+697
+699
+706
+720
+722
+736
+741
+750
+751
+880
+884
+886
+894
+895
+900
+902
+903
+904
+1014
+1015
+1155
+1162
+1418
+1419
+1421
+2307
+2362
+2363
+2364
+2365
+2369
+2377
+2381
+2382
+2385
+2392
+2402
+2404
+2433
+2434
+2492
+2493
+2497
+2501
+2509
+2510
+2530
+2532
+2546
+2548
+2555
+2556
+2558
+2559
+2561
+2563
+2620
+2621
+2625
+2627
+2631
+2633
+2635
+2638
+2641
+2642
+2672
+2674
+2677
+2678
+2689
+2691
+2748
+2749
+2753
+2758
+2759
+2761
+2765
+2766
+2786
+2788
+2801
+2802
+2810
+2816
+2817
+2818
+2876
+2877
+2879
+2880
+2881
+2885
+2893
+2894
+2902
+2903
+2914
+2916
+2946
+2947
+3008
+3009
+3021
+3022
+3059
+3067
+3072
+3073
+3076
+3077
+3134
+3137
+3142
+3145
+3146
+3150
+3157
+3159
+3170
+3172
+3192
+3199
+3201
+3202
+3260
+3261
+3276
+3278
+3298
+3300
+3328
+3330
+3387
+3389
+3393
+3397
+3405
+3406
+3426
+3428
+3530
+3531
+3538
+3541
+3542
+3543
+3633
+3634
+3636
+3643
+3647
+3648
+3655
+3663
+3761
+3762
+3764
+3773
+3784
+3790
+3864
+3866
+3893
+3894
+3895
+3896
+3897
+3902
+3953
+3967
+3968
+3973
+3974
+3976
+3981
+3992
+3993
+4029
+4038
+4039
+4141
+4145
+4146
+4152
+4153
+4155
+4157
+4159
+4184
+4186
+4190
+4193
+4209
+4213
+4226
+4227
+4229
+4231
+4237
+4238
+4253
+4254
+4957
+4960
+5008
+5018
+5120
+5121
+5760
+5761
+5787
+5789
+5906
+5909
+5938
+5941
+5970
+5972
+6002
+6004
+6068
+6070
+6071
+6078
+6086
+6087
+6089
+6100
+6107
+6108
+6109
+6110
+6128
+6138
+6144
+6159
+6277
+6279
+6313
+6314
+6432
+6435
+6439
+6441
+6450
+6451
+6457
+6460
+6464
+6465
+6468
+6470
+6622
+6656
+6679
+6681
+6683
+6684
+6742
+6743
+6744
+6751
+6752
+6753
+6754
+6755
+6757
+6765
+6771
+6781
+6783
+6784
+6832
+6847
+6912
+6916
+6964
+6965
+6966
+6971
+6972
+6973
+6978
+6979
+7019
+7028
+7040
+7042
+7074
+7078
+7080
+7082
+7083
+7086
+7142
+7143
+7144
+7146
+7149
+7150
+7151
+7154
+7212
+7220
+7222
+7224
+7376
+7379
+7380
+7393
+7394
+7401
+7405
+7406
+7412
+7413
+7416
+7418
+7616
+7674
+7675
+7680
+8125
+8126
+8127
+8130
+8141
+8144
+8157
+8160
+8173
+8176
+8189
+8191
+8192
+8206
+8207
+8305
+8308
+8319
+8320
+8335
+8352
+8433
+8448
+8450
+8451
+8455
+8456
+8458
+8468
+8469
+8470
+8473
+8478
+8484
+8485
+8486
+8487
+8488
+8489
+8490
+8494
+8495
+8506
+8508
+8512
+8517
+8522
+8526
+8528
+8544
+8585
+8588
+8592
+9014
+9083
+9109
+9110
+9255
+9280
+9291
+9312
+9372
+9450
+9900
+9901
+10240
+10496
+11124
+11126
+11158
+11160
+11264
+11493
+11499
+11503
+11506
+11513
+11520
+11647
+11648
+11744
+11856
+11904
+11930
+11931
+12020
+12032
+12246
+12272
+12284
+12288
+12293
+12296
+12321
+12330
+12334
+12336
+12337
+12342
+12344
+12349
+12352
+12441
+12445
+12448
+12449
+12539
+12540
+12736
+12772
+12829
+12831
+12880
+12896
+12924
+12927
+12977
+12992
+13004
+13008
+13175
+13179
+13278
+13280
+13311
+13312
+19904
+19968
+42128
+42183
+42509
+42512
+42607
+42624
+42654
+42656
+42736
+42738
+42752
+42786
+42888
+42889
+43010
+43011
+43014
+43015
+43019
+43020
+43045
+43047
+43048
+43052
+43064
+43066
+43124
+43128
+43204
+43206
+43232
+43250
+43263
+43264
+43302
+43310
+43335
+43346
+43392
+43395
+43443
+43444
+43446
+43450
+43452
+43454
+43493
+43494
+43561
+43567
+43569
+43571
+43573
+43575
+43587
+43588
+43596
+43597
+43644
+43645
+43696
+43697
+43698
+43701
+43703
+43705
+43710
+43712
+43713
+43714
+43756
+43758
+43766
+43767
+44005
+44006
+44008
+44009
+44013
+44014
+64285
+65050
+65056
+65107
+65108
+65127
+65128
+65132
+65136
+65280
+65281
+65313
+65339
+65345
+65371
+65382
+65504
+65511
+65512
+65519
+65520
+65536
+65793
+65794
+65856
+65933
+65936
+65948
+65952
+65953
+66045
+66046
+66272
+66300
+66422
+66427
+67584
+69632
+69633
+69634
+69688
+69703
+69714
+69734
+69759
+69762
+69811
+69815
+69817
+69819
+69888
+69891
+69927
+69932
+69933
+69941
+70003
+70004
+70016
+70018
+70070
+70079
+70089
+70093
+70191
+70194
+70196
+70197
+70198
+70200
+70206
+70207
+70367
+70368
+70371
+70379
+70400
+70402
+70459
+70461
+70464
+70465
+70502
+70509
+70512
+70517
+70712
+70720
+70722
+70725
+70726
+70727
+70750
+70751
+70835
+70841
+70842
+70843
+70847
+70849
+70850
+70852
+71090
+71094
+71100
+71102
+71103
+71105
+71132
+71134
+71219
+71227
+71229
+71230
+71231
+71233
+71264
+71277
+71339
+71340
+71341
+71342
+71344
+71350
+71351
+71352
+71453
+71456
+71458
+71462
+71463
+71468
+71727
+71736
+71737
+71739
+72148
+72152
+72154
+72156
+72160
+72161
+72193
+72199
+72201
+72203
+72243
+72249
+72251
+72255
+72263
+72264
+72273
+72279
+72281
+72284
+72330
+72343
+72344
+72346
+72752
+72759
+72760
+72766
+72850
+72872
+72874
+72881
+72882
+72884
+72885
+72887
+73009
+73015
+73018
+73019
+73020
+73022
+73023
+73030
+73031
+73032
+73104
+73106
+73109
+73110
+73111
+73112
+73459
+73461
+73685
+73714
+92912
+92917
+92976
+92983
+94031
+94032
+94095
+94099
+94178
+94179
+113821
+113823
+113824
+113828
+119143
+119146
+119155
+119171
+119173
+119180
+119210
+119214
+119296
+119366
+119552
+119639
+120539
+120540
+120597
+120598
+120655
+120656
+120713
+120714
+120771
+120772
+120782
+120832
+121344
+121399
+121403
+121453
+121461
+121462
+121476
+121477
+121499
+121504
+121505
+121520
+122880
+122887
+122888
+122905
+122907
+122914
+122915
+122917
+122918
+122923
+123184
+123191
+123628
+123632
+123647
+123648
+124928
+127020
+127024
+127124
+127136
+127151
+127153
+127168
+127169
+127184
+127185
+127222
+127232
+127245
+127279
+127280
+127338
+127341
+127584
+127590
+127744
+128726
+128736
+128749
+128752
+128763
+128768
+128884
+128896
+128985
+128992
+129004
+129024
+129036
+129040
+129096
+129104
+129114
+129120
+129160
+129168
+129198
+129280
+129292
+129293
+129394
+129395
+129399
+129402
+129443
+129445
+129451
+129454
+129483
+129485
+129620
+129632
+129646
+129648
+129652
+129656
+129659
+129664
+129667
+129680
+129686
+131070
+131072
+196606
+196608
+262142
+262144
+327678
+327680
+393214
+393216
+458750
+458752
+524286
+524288
+589822
+589824
+655358
+655360
+720894
+720896
+786430
+786432
+851966
+851968
+917502
+921600
+983038
+983040
+1048574
+1048576
+1114110
+1114112
+END
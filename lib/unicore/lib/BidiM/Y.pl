@@ -0,0 +1,240 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V226
+40
+42
+60
+61
+62
+63
+91
+92
+93
+94
+123
+124
+125
+126
+171
+172
+187
+188
+3898
+3902
+5787
+5789
+8249
+8251
+8261
+8263
+8317
+8319
+8333
+8335
+8512
+8513
+8705
+8709
+8712
+8718
+8721
+8722
+8725
+8727
+8730
+8734
+8735
+8739
+8740
+8741
+8742
+8743
+8747
+8756
+8761
+8762
+8763
+8781
+8786
+8790
+8799
+8801
+8802
+8803
+8804
+8812
+8814
+8845
+8847
+8851
+8856
+8857
+8866
+8868
+8870
+8889
+8894
+8896
+8905
+8910
+8912
+8914
+8918
+8942
+8944
+8960
+8968
+8972
+8992
+8994
+9001
+9003
+10088
+10102
+10176
+10177
+10179
+10183
+10184
+10186
+10187
+10190
+10195
+10199
+10204
+10207
+10210
+10224
+10627
+10649
+10651
+10657
+10658
+10672
+10680
+10681
+10688
+10694
+10697
+10698
+10702
+10707
+10708
+10710
+10712
+10717
+10721
+10722
+10723
+10726
+10728
+10730
+10740
+10746
+10748
+10750
+10762
+10781
+10782
+10786
+10788
+10789
+10790
+10791
+10793
+10794
+10795
+10799
+10804
+10806
+10812
+10815
+10839
+10841
+10852
+10854
+10858
+10862
+10863
+10865
+10867
+10869
+10873
+10916
+10918
+10926
+10927
+10967
+10972
+10973
+10974
+10975
+10978
+10983
+10988
+10991
+10995
+10996
+10999
+11004
+11005
+11006
+11262
+11263
+11778
+11782
+11785
+11787
+11788
+11790
+11804
+11806
+11808
+11818
+12296
+12306
+12308
+12316
+65113
+65119
+65124
+65126
+65288
+65290
+65308
+65309
+65310
+65311
+65339
+65340
+65341
+65342
+65371
+65372
+65373
+65374
+65375
+65377
+65378
+65380
+120539
+120540
+120597
+120598
+120655
+120656
+120713
+120714
+120771
+120772
+END
@@ -0,0 +1,121 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V107
+2160
+2208
+12256
+12272
+66048
+66176
+66528
+66560
+66928
+67072
+67456
+67584
+67760
+67808
+67904
+67968
+68256
+68288
+68528
+68608
+68688
+68736
+68928
+69216
+69248
+69376
+69488
+69600
+70224
+70272
+70528
+70656
+70880
+71040
+71376
+71424
+71488
+71680
+71760
+71840
+71936
+72096
+72368
+72384
+72448
+72704
+72896
+72960
+73136
+73440
+73472
+73664
+75088
+77824
+78912
+82944
+83584
+92160
+92784
+92880
+93072
+93760
+93856
+93952
+94112
+94176
+101120
+110592
+111360
+113664
+113840
+118784
+119376
+119520
+119680
+119808
+121520
+122880
+122928
+123136
+123216
+123584
+123648
+124928
+125152
+125184
+125280
+126064
+126144
+126208
+126288
+126464
+126720
+126976
+129792
+131072
+173792
+173824
+191472
+194560
+195104
+917504
+917632
+917760
+918000
+983040
+1114112
+END
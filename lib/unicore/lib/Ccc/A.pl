@@ -0,0 +1,248 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V234
+768
+789
+829
+837
+838
+839
+842
+845
+848
+851
+855
+856
+859
+860
+867
+880
+1155
+1160
+1426
+1430
+1431
+1434
+1436
+1442
+1448
+1450
+1451
+1453
+1455
+1456
+1476
+1477
+1552
+1560
+1619
+1621
+1623
+1628
+1629
+1631
+1750
+1757
+1759
+1763
+1764
+1765
+1767
+1769
+1771
+1773
+1840
+1841
+1842
+1844
+1845
+1847
+1850
+1851
+1853
+1854
+1855
+1858
+1859
+1860
+1861
+1862
+1863
+1864
+1865
+1867
+2027
+2034
+2035
+2036
+2070
+2074
+2075
+2084
+2085
+2088
+2089
+2094
+2260
+2274
+2276
+2278
+2279
+2281
+2282
+2285
+2291
+2294
+2295
+2297
+2299
+2304
+2385
+2386
+2387
+2389
+2558
+2559
+3970
+3972
+3974
+3976
+4957
+4960
+6109
+6110
+6458
+6459
+6679
+6680
+6773
+6781
+6832
+6837
+6843
+6845
+7019
+7020
+7021
+7028
+7376
+7379
+7386
+7388
+7392
+7393
+7412
+7413
+7416
+7418
+7616
+7618
+7619
+7626
+7627
+7629
+7633
+7670
+7675
+7676
+7678
+7679
+8400
+8402
+8404
+8408
+8411
+8413
+8417
+8418
+8423
+8424
+8425
+8426
+8432
+8433
+11503
+11506
+11744
+11776
+42607
+42608
+42612
+42622
+42654
+42656
+42736
+42738
+43232
+43250
+43696
+43697
+43698
+43700
+43703
+43705
+43710
+43712
+43713
+43714
+65056
+65063
+65070
+65072
+66422
+66427
+68111
+68112
+68152
+68153
+68325
+68326
+68900
+68904
+69448
+69451
+69452
+69453
+69888
+69891
+70502
+70509
+70512
+70517
+70750
+70751
+92976
+92983
+119173
+119178
+119210
+119214
+119362
+119365
+122880
+122887
+122888
+122905
+122907
+122914
+122915
+122917
+122918
+122923
+123184
+123191
+123628
+123632
+125252
+125258
+END
@@ -0,0 +1,168 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V154
+790
+794
+796
+801
+803
+807
+809
+820
+825
+829
+839
+842
+845
+847
+851
+855
+857
+859
+1425
+1426
+1430
+1431
+1435
+1436
+1442
+1448
+1450
+1451
+1477
+1478
+1621
+1623
+1628
+1629
+1631
+1632
+1763
+1764
+1770
+1771
+1773
+1774
+1841
+1842
+1844
+1845
+1847
+1850
+1851
+1853
+1854
+1855
+1858
+1859
+1860
+1861
+1862
+1863
+1864
+1865
+2034
+2035
+2045
+2046
+2137
+2140
+2259
+2260
+2275
+2276
+2278
+2279
+2281
+2282
+2285
+2288
+2294
+2295
+2297
+2299
+2386
+2387
+3864
+3866
+3893
+3894
+3895
+3896
+4038
+4039
+4237
+4238
+6459
+6460
+6680
+6681
+6783
+6784
+6837
+6843
+6845
+6846
+7020
+7021
+7381
+7386
+7388
+7392
+7405
+7406
+7618
+7619
+7626
+7627
+7631
+7632
+7673
+7674
+7677
+7678
+7679
+7680
+8424
+8425
+8428
+8432
+43307
+43310
+43700
+43701
+65063
+65070
+66045
+66046
+66272
+66273
+68109
+68110
+68154
+68155
+68326
+68327
+69446
+69448
+69451
+69452
+69453
+69457
+119163
+119171
+119178
+119180
+125136
+125143
+END
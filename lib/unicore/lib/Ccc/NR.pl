@@ -0,0 +1,371 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V357
+0
+768
+847
+848
+880
+1155
+1160
+1425
+1470
+1471
+1472
+1473
+1475
+1476
+1478
+1479
+1480
+1552
+1563
+1611
+1632
+1648
+1649
+1750
+1757
+1759
+1765
+1767
+1769
+1770
+1774
+1809
+1810
+1840
+1867
+2027
+2036
+2045
+2046
+2070
+2074
+2075
+2084
+2085
+2088
+2089
+2094
+2137
+2140
+2259
+2274
+2275
+2304
+2364
+2365
+2381
+2382
+2385
+2389
+2492
+2493
+2509
+2510
+2558
+2559
+2620
+2621
+2637
+2638
+2748
+2749
+2765
+2766
+2876
+2877
+2893
+2894
+3021
+3022
+3149
+3150
+3157
+3159
+3260
+3261
+3277
+3278
+3387
+3389
+3405
+3406
+3530
+3531
+3640
+3643
+3656
+3660
+3768
+3771
+3784
+3788
+3864
+3866
+3893
+3894
+3895
+3896
+3897
+3898
+3953
+3955
+3956
+3957
+3962
+3966
+3968
+3969
+3970
+3973
+3974
+3976
+4038
+4039
+4151
+4152
+4153
+4155
+4237
+4238
+4957
+4960
+5908
+5909
+5940
+5941
+6098
+6099
+6109
+6110
+6313
+6314
+6457
+6460
+6679
+6681
+6752
+6753
+6773
+6781
+6783
+6784
+6832
+6846
+6964
+6965
+6980
+6981
+7019
+7028
+7082
+7084
+7142
+7143
+7154
+7156
+7223
+7224
+7376
+7379
+7380
+7393
+7394
+7401
+7405
+7406
+7412
+7413
+7416
+7418
+7616
+7674
+7675
+7680
+8400
+8413
+8417
+8418
+8421
+8433
+11503
+11506
+11647
+11648
+11744
+11776
+12330
+12336
+12441
+12443
+42607
+42608
+42612
+42622
+42654
+42656
+42736
+42738
+43014
+43015
+43204
+43205
+43232
+43250
+43307
+43310
+43347
+43348
+43443
+43444
+43456
+43457
+43696
+43697
+43698
+43701
+43703
+43705
+43710
+43712
+43713
+43714
+43766
+43767
+44013
+44014
+64286
+64287
+65056
+65072
+66045
+66046
+66272
+66273
+66422
+66427
+68109
+68110
+68111
+68112
+68152
+68155
+68159
+68160
+68325
+68327
+68900
+68904
+69446
+69457
+69702
+69703
+69759
+69760
+69817
+69819
+69888
+69891
+69939
+69941
+70003
+70004
+70080
+70081
+70090
+70091
+70197
+70199
+70377
+70379
+70459
+70461
+70477
+70478
+70502
+70509
+70512
+70517
+70722
+70723
+70726
+70727
+70750
+70751
+70850
+70852
+71103
+71105
+71231
+71232
+71350
+71352
+71467
+71468
+71737
+71739
+72160
+72161
+72244
+72245
+72263
+72264
+72345
+72346
+72767
+72768
+73026
+73027
+73028
+73030
+73111
+73112
+92912
+92917
+92976
+92983
+113822
+113823
+119141
+119146
+119149
+119155
+119163
+119171
+119173
+119180
+119210
+119214
+119362
+119365
+122880
+122887
+122888
+122905
+122907
+122914
+122915
+122917
+122918
+122923
+123184
+123191
+123628
+123632
+125136
+125143
+125252
+125259
+END
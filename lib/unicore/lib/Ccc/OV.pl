@@ -0,0 +1,36 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V22
+820
+825
+7380
+7381
+7394
+7401
+8402
+8404
+8408
+8411
+8421
+8423
+8426
+8428
+68153
+68154
+92912
+92917
+113822
+113823
+119143
+119146
+END
@@ -0,0 +1,160 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V146
+832
+834
+835
+837
+884
+885
+894
+895
+903
+904
+2392
+2400
+2524
+2526
+2527
+2528
+2611
+2612
+2614
+2615
+2649
+2652
+2654
+2655
+2908
+2910
+3907
+3908
+3917
+3918
+3922
+3923
+3927
+3928
+3932
+3933
+3945
+3946
+3955
+3956
+3957
+3959
+3960
+3961
+3969
+3970
+3987
+3988
+3997
+3998
+4002
+4003
+4007
+4008
+4012
+4013
+4025
+4026
+8049
+8050
+8051
+8052
+8053
+8054
+8055
+8056
+8057
+8058
+8059
+8060
+8061
+8062
+8123
+8124
+8126
+8127
+8137
+8138
+8139
+8140
+8147
+8148
+8155
+8156
+8163
+8164
+8171
+8172
+8174
+8176
+8185
+8186
+8187
+8188
+8189
+8190
+8192
+8194
+8486
+8487
+8490
+8492
+9001
+9003
+10972
+10973
+63744
+64014
+64016
+64017
+64018
+64019
+64021
+64031
+64032
+64033
+64034
+64035
+64037
+64039
+64042
+64110
+64112
+64218
+64285
+64286
+64287
+64288
+64298
+64311
+64312
+64317
+64318
+64319
+64320
+64322
+64323
+64325
+64326
+64335
+119134
+119141
+119227
+119233
+194560
+195102
+END
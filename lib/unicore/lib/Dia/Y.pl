@@ -0,0 +1,356 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V342
+94
+95
+96
+97
+168
+169
+175
+176
+180
+181
+183
+185
+688
+847
+848
+856
+861
+867
+884
+886
+890
+891
+900
+902
+1155
+1160
+1369
+1370
+1425
+1442
+1443
+1470
+1471
+1472
+1473
+1475
+1476
+1477
+1611
+1619
+1623
+1625
+1759
+1761
+1765
+1767
+1770
+1773
+1840
+1867
+1958
+1969
+2027
+2038
+2072
+2074
+2275
+2303
+2364
+2365
+2381
+2382
+2385
+2389
+2417
+2418
+2492
+2493
+2509
+2510
+2620
+2621
+2637
+2638
+2748
+2749
+2765
+2766
+2813
+2816
+2876
+2877
+2893
+2894
+3021
+3022
+3149
+3150
+3260
+3261
+3277
+3278
+3387
+3389
+3405
+3406
+3530
+3531
+3655
+3661
+3662
+3663
+3770
+3771
+3784
+3789
+3864
+3866
+3893
+3894
+3895
+3896
+3897
+3898
+3902
+3904
+3970
+3973
+3974
+3976
+4038
+4039
+4151
+4152
+4153
+4155
+4195
+4197
+4201
+4206
+4231
+4238
+4239
+4240
+4250
+4252
+4957
+4960
+6089
+6100
+6109
+6110
+6457
+6460
+6773
+6781
+6783
+6784
+6832
+6846
+6964
+6965
+6980
+6981
+7019
+7028
+7082
+7084
+7222
+7224
+7288
+7294
+7376
+7401
+7405
+7406
+7412
+7413
+7415
+7418
+7468
+7531
+7620
+7632
+7669
+7674
+7677
+7680
+8125
+8126
+8127
+8130
+8141
+8144
+8157
+8160
+8173
+8176
+8189
+8191
+11503
+11506
+11823
+11824
+12330
+12336
+12441
+12445
+12540
+12541
+42607
+42608
+42620
+42622
+42623
+42624
+42652
+42654
+42736
+42738
+42752
+42786
+42888
+42891
+43000
+43002
+43204
+43205
+43232
+43250
+43307
+43311
+43347
+43348
+43443
+43444
+43456
+43457
+43493
+43494
+43643
+43646
+43711
+43715
+43766
+43767
+43867
+43872
+44012
+44014
+64286
+64287
+65056
+65072
+65342
+65343
+65344
+65345
+65392
+65393
+65438
+65440
+65507
+65508
+66272
+66273
+68325
+68327
+68898
+68904
+69446
+69457
+69817
+69819
+69939
+69941
+70003
+70004
+70080
+70081
+70090
+70093
+70197
+70199
+70377
+70379
+70460
+70461
+70477
+70478
+70502
+70509
+70512
+70517
+70722
+70723
+70726
+70727
+70850
+70852
+71103
+71105
+71231
+71232
+71350
+71352
+71467
+71468
+71737
+71739
+72160
+72161
+72244
+72245
+72263
+72264
+72345
+72346
+72767
+72768
+73026
+73027
+73028
+73030
+73111
+73112
+92912
+92917
+92976
+92983
+94095
+94112
+119143
+119146
+119149
+119155
+119163
+119171
+119173
+119180
+119210
+119214
+123184
+123191
+123628
+123632
+125136
+125143
+125252
+125255
+125256
+125259
+END
@@ -0,0 +1,162 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V148
+168
+169
+175
+176
+180
+182
+184
+185
+306
+308
+319
+321
+329
+330
+383
+384
+452
+461
+497
+500
+728
+734
+890
+891
+900
+901
+976
+979
+981
+983
+1008
+1011
+1012
+1014
+1017
+1018
+1415
+1416
+1653
+1657
+3635
+3636
+3763
+3764
+3804
+3806
+3959
+3960
+3961
+3962
+7834
+7835
+8125
+8126
+8127
+8129
+8190
+8191
+8194
+8199
+8200
+8203
+8215
+8216
+8228
+8231
+8243
+8245
+8246
+8248
+8252
+8253
+8254
+8255
+8263
+8266
+8279
+8280
+8287
+8288
+8360
+8361
+8448
+8450
+8451
+8452
+8453
+8456
+8457
+8458
+8470
+8471
+8481
+8482
+8501
+8505
+8507
+8508
+8544
+8576
+8748
+8750
+8751
+8753
+9332
+9398
+10764
+10765
+10868
+10871
+11935
+11936
+12019
+12020
+12032
+12246
+12342
+12343
+12344
+12347
+12443
+12445
+12593
+12687
+12800
+12831
+12832
+12868
+12992
+13004
+13144
+13169
+13280
+13311
+64256
+64263
+64275
+64280
+64335
+64336
+65097
+65104
+127232
+127243
+127248
+127275
+127552
+127561
+END
@@ -0,0 +1,240 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V226
+64337
+64338
+64339
+64340
+64343
+64344
+64347
+64348
+64351
+64352
+64355
+64356
+64359
+64360
+64363
+64364
+64367
+64368
+64371
+64372
+64375
+64376
+64379
+64380
+64383
+64384
+64387
+64388
+64389
+64390
+64391
+64392
+64393
+64394
+64395
+64396
+64397
+64398
+64399
+64400
+64403
+64404
+64407
+64408
+64411
+64412
+64415
+64416
+64417
+64418
+64421
+64422
+64423
+64424
+64427
+64428
+64431
+64432
+64433
+64434
+64468
+64469
+64472
+64473
+64474
+64475
+64476
+64477
+64479
+64480
+64481
+64482
+64483
+64484
+64485
+64486
+64491
+64492
+64493
+64494
+64495
+64496
+64497
+64498
+64499
+64500
+64501
+64502
+64503
+64504
+64506
+64507
+64509
+64510
+64612
+64663
+64785
+64813
+64828
+64829
+64849
+64850
+64856
+64857
+64858
+64860
+64862
+64864
+64866
+64867
+64868
+64869
+64870
+64872
+64873
+64875
+64876
+64877
+64878
+64880
+64881
+64882
+64884
+64887
+64888
+64893
+64894
+64899
+64900
+64902
+64903
+64904
+64907
+64908
+64918
+64920
+64921
+64925
+64926
+64948
+64950
+64952
+64953
+64954
+64955
+64963
+64966
+64968
+65154
+65155
+65156
+65157
+65158
+65159
+65160
+65161
+65162
+65163
+65166
+65167
+65168
+65169
+65172
+65173
+65174
+65175
+65178
+65179
+65182
+65183
+65186
+65187
+65190
+65191
+65194
+65195
+65196
+65197
+65198
+65199
+65200
+65201
+65202
+65203
+65206
+65207
+65210
+65211
+65214
+65215
+65218
+65219
+65222
+65223
+65226
+65227
+65230
+65231
+65234
+65235
+65238
+65239
+65242
+65243
+65246
+65247
+65250
+65251
+65254
+65255
+65258
+65259
+65262
+65263
+65264
+65265
+65266
+65267
+65270
+65271
+65272
+65273
+65274
+65275
+65276
+65277
+END
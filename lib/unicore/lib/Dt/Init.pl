@@ -0,0 +1,164 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V150
+64340
+64341
+64344
+64345
+64348
+64349
+64352
+64353
+64356
+64357
+64360
+64361
+64364
+64365
+64368
+64369
+64372
+64373
+64376
+64377
+64380
+64381
+64384
+64385
+64400
+64401
+64404
+64405
+64408
+64409
+64412
+64413
+64418
+64419
+64424
+64425
+64428
+64429
+64469
+64470
+64486
+64487
+64488
+64489
+64504
+64505
+64507
+64508
+64510
+64511
+64663
+64735
+64813
+64820
+64848
+64849
+64850
+64856
+64857
+64858
+64860
+64862
+64864
+64866
+64867
+64868
+64869
+64870
+64872
+64873
+64875
+64876
+64877
+64878
+64880
+64881
+64882
+64884
+64887
+64888
+64893
+64894
+64899
+64900
+64902
+64903
+64904
+64907
+64908
+64912
+64914
+64918
+64920
+64921
+64925
+64926
+64948
+64950
+64952
+64953
+64954
+64955
+64963
+64966
+65163
+65164
+65169
+65170
+65175
+65176
+65179
+65180
+65183
+65184
+65187
+65188
+65191
+65192
+65203
+65204
+65207
+65208
+65211
+65212
+65215
+65216
+65219
+65220
+65223
+65224
+65227
+65228
+65231
+65232
+65235
+65236
+65239
+65240
+65243
+65244
+65247
+65248
+65251
+65252
+65255
+65256
+65259
+65260
+65267
+65268
+END
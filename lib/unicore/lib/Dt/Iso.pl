@@ -0,0 +1,210 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V196
+64336
+64337
+64338
+64339
+64342
+64343
+64346
+64347
+64350
+64351
+64354
+64355
+64358
+64359
+64362
+64363
+64366
+64367
+64370
+64371
+64374
+64375
+64378
+64379
+64382
+64383
+64386
+64387
+64388
+64389
+64390
+64391
+64392
+64393
+64394
+64395
+64396
+64397
+64398
+64399
+64402
+64403
+64406
+64407
+64410
+64411
+64414
+64415
+64416
+64417
+64420
+64421
+64422
+64423
+64426
+64427
+64430
+64431
+64432
+64433
+64467
+64468
+64471
+64472
+64473
+64474
+64475
+64476
+64477
+64479
+64480
+64481
+64482
+64483
+64484
+64485
+64490
+64491
+64492
+64493
+64494
+64495
+64496
+64497
+64498
+64499
+64500
+64501
+64502
+64503
+64505
+64506
+64508
+64509
+64512
+64612
+64757
+64785
+64829
+64830
+65008
+65021
+65136
+65137
+65138
+65139
+65140
+65141
+65142
+65143
+65144
+65145
+65146
+65147
+65148
+65149
+65150
+65151
+65152
+65154
+65155
+65156
+65157
+65158
+65159
+65160
+65161
+65162
+65165
+65166
+65167
+65168
+65171
+65172
+65173
+65174
+65177
+65178
+65181
+65182
+65185
+65186
+65189
+65190
+65193
+65194
+65195
+65196
+65197
+65198
+65199
+65200
+65201
+65202
+65205
+65206
+65209
+65210
+65213
+65214
+65217
+65218
+65221
+65222
+65225
+65226
+65229
+65230
+65233
+65234
+65237
+65238
+65241
+65242
+65245
+65246
+65249
+65250
+65253
+65254
+65257
+65258
+65261
+65262
+65263
+65264
+65265
+65266
+65269
+65270
+65271
+65272
+65273
+65274
+65275
+65276
+END
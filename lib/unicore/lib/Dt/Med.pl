@@ -0,0 +1,122 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V108
+64341
+64342
+64345
+64346
+64349
+64350
+64353
+64354
+64357
+64358
+64361
+64362
+64365
+64366
+64369
+64370
+64373
+64374
+64377
+64378
+64381
+64382
+64385
+64386
+64401
+64402
+64405
+64406
+64409
+64410
+64413
+64414
+64419
+64420
+64425
+64426
+64429
+64430
+64470
+64471
+64487
+64488
+64489
+64490
+64511
+64512
+64735
+64757
+64820
+64828
+65137
+65138
+65143
+65144
+65145
+65146
+65147
+65148
+65149
+65150
+65151
+65152
+65164
+65165
+65170
+65171
+65176
+65177
+65180
+65181
+65184
+65185
+65188
+65189
+65192
+65193
+65204
+65205
+65208
+65209
+65212
+65213
+65216
+65217
+65220
+65221
+65224
+65225
+65228
+65229
+65232
+65233
+65236
+65237
+65240
+65241
+65244
+65245
+65248
+65249
+65252
+65253
+65256
+65257
+65260
+65261
+65268
+65269
+END
@@ -0,0 +1,372 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V358
+161
+162
+164
+165
+167
+169
+170
+171
+173
+175
+176
+181
+182
+187
+188
+192
+198
+199
+208
+209
+215
+217
+222
+226
+230
+231
+232
+235
+236
+238
+240
+241
+242
+244
+247
+251
+252
+253
+254
+255
+257
+258
+273
+274
+275
+276
+283
+284
+294
+296
+299
+300
+305
+308
+312
+313
+319
+323
+324
+325
+328
+332
+333
+334
+338
+340
+358
+360
+363
+364
+462
+463
+464
+465
+466
+467
+468
+469
+470
+471
+472
+473
+474
+475
+476
+477
+593
+594
+609
+610
+708
+709
+711
+712
+713
+716
+717
+718
+720
+721
+728
+732
+733
+734
+735
+736
+768
+880
+913
+930
+931
+938
+945
+962
+963
+970
+1025
+1026
+1040
+1104
+1105
+1106
+8208
+8209
+8211
+8215
+8216
+8218
+8220
+8222
+8224
+8227
+8228
+8232
+8240
+8241
+8242
+8244
+8245
+8246
+8251
+8252
+8254
+8255
+8308
+8309
+8319
+8320
+8321
+8325
+8364
+8365
+8451
+8452
+8453
+8454
+8457
+8458
+8467
+8468
+8470
+8471
+8481
+8483
+8486
+8487
+8491
+8492
+8531
+8533
+8539
+8543
+8544
+8556
+8560
+8570
+8585
+8586
+8592
+8602
+8632
+8634
+8658
+8659
+8660
+8661
+8679
+8680
+8704
+8705
+8706
+8708
+8711
+8713
+8715
+8716
+8719
+8720
+8721
+8722
+8725
+8726
+8730
+8731
+8733
+8737
+8739
+8740
+8741
+8742
+8743
+8749
+8750
+8751
+8756
+8760
+8764
+8766
+8776
+8777
+8780
+8781
+8786
+8787
+8800
+8802
+8804
+8808
+8810
+8812
+8814
+8816
+8834
+8836
+8838
+8840
+8853
+8854
+8857
+8858
+8869
+8870
+8895
+8896
+8978
+8979
+9312
+9450
+9451
+9548
+9552
+9588
+9600
+9616
+9618
+9622
+9632
+9634
+9635
+9642
+9650
+9652
+9654
+9656
+9660
+9662
+9664
+9666
+9670
+9673
+9675
+9676
+9678
+9682
+9698
+9702
+9711
+9712
+9733
+9735
+9737
+9738
+9742
+9744
+9756
+9757
+9758
+9759
+9792
+9793
+9794
+9795
+9824
+9826
+9827
+9830
+9831
+9835
+9836
+9838
+9839
+9840
+9886
+9888
+9919
+9920
+9926
+9934
+9935
+9940
+9941
+9954
+9955
+9956
+9960
+9962
+9963
+9970
+9972
+9973
+9974
+9978
+9979
+9981
+9982
+9984
+10045
+10046
+10102
+10112
+11094
+11098
+12872
+12880
+57344
+63744
+65024
+65040
+65533
+65534
+127232
+127243
+127248
+127278
+127280
+127338
+127344
+127374
+127375
+127377
+127387
+127405
+917760
+918000
+983040
+1048574
+1048576
+1114110
+END
@@ -0,0 +1,134 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V120
+688
+706
+710
+722
+736
+741
+748
+749
+750
+751
+884
+885
+890
+891
+1369
+1370
+1600
+1601
+1765
+1767
+2036
+2038
+2042
+2043
+2074
+2075
+2084
+2085
+2088
+2089
+2417
+2418
+3654
+3655
+3782
+3783
+4348
+4349
+6103
+6104
+6211
+6212
+6823
+6824
+7288
+7294
+7468
+7531
+7544
+7545
+7579
+7616
+8305
+8306
+8319
+8320
+8336
+8349
+11388
+11390
+11631
+11632
+11823
+11824
+12293
+12294
+12337
+12342
+12347
+12348
+12445
+12447
+12540
+12543
+40981
+40982
+42232
+42238
+42508
+42509
+42623
+42624
+42652
+42654
+42775
+42784
+42864
+42865
+42888
+42889
+43000
+43002
+43471
+43472
+43494
+43495
+43632
+43633
+43741
+43742
+43763
+43765
+43868
+43872
+65392
+65393
+65438
+65440
+92992
+92996
+94099
+94112
+94176
+94178
+94179
+94180
+123191
+123198
+125259
+125260
+END
@@ -0,0 +1,350 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V336
+2307
+2308
+2363
+2364
+2366
+2369
+2377
+2381
+2382
+2384
+2434
+2436
+2494
+2497
+2503
+2505
+2507
+2509
+2519
+2520
+2563
+2564
+2622
+2625
+2691
+2692
+2750
+2753
+2761
+2762
+2763
+2765
+2818
+2820
+2878
+2879
+2880
+2881
+2887
+2889
+2891
+2893
+2903
+2904
+3006
+3008
+3009
+3011
+3014
+3017
+3018
+3021
+3031
+3032
+3073
+3076
+3137
+3141
+3202
+3204
+3262
+3263
+3264
+3269
+3271
+3273
+3274
+3276
+3285
+3287
+3330
+3332
+3390
+3393
+3398
+3401
+3402
+3405
+3415
+3416
+3458
+3460
+3535
+3538
+3544
+3552
+3570
+3572
+3902
+3904
+3967
+3968
+4139
+4141
+4145
+4146
+4152
+4153
+4155
+4157
+4182
+4184
+4194
+4197
+4199
+4206
+4227
+4229
+4231
+4237
+4239
+4240
+4250
+4253
+6070
+6071
+6078
+6086
+6087
+6089
+6435
+6439
+6441
+6444
+6448
+6450
+6451
+6457
+6681
+6683
+6741
+6742
+6743
+6744
+6753
+6754
+6755
+6757
+6765
+6771
+6916
+6917
+6965
+6966
+6971
+6972
+6973
+6978
+6979
+6981
+7042
+7043
+7073
+7074
+7078
+7080
+7082
+7083
+7143
+7144
+7146
+7149
+7150
+7151
+7154
+7156
+7204
+7212
+7220
+7222
+7393
+7394
+7415
+7416
+12334
+12336
+43043
+43045
+43047
+43048
+43136
+43138
+43188
+43204
+43346
+43348
+43395
+43396
+43444
+43446
+43450
+43452
+43454
+43457
+43567
+43569
+43571
+43573
+43597
+43598
+43643
+43644
+43645
+43646
+43755
+43756
+43758
+43760
+43765
+43766
+44003
+44005
+44006
+44008
+44009
+44011
+44012
+44013
+69632
+69633
+69634
+69635
+69762
+69763
+69808
+69811
+69815
+69817
+69932
+69933
+69957
+69959
+70018
+70019
+70067
+70070
+70079
+70081
+70188
+70191
+70194
+70196
+70197
+70198
+70368
+70371
+70402
+70404
+70462
+70464
+70465
+70469
+70471
+70473
+70475
+70478
+70487
+70488
+70498
+70500
+70709
+70712
+70720
+70722
+70725
+70726
+70832
+70835
+70841
+70842
+70843
+70847
+70849
+70850
+71087
+71090
+71096
+71100
+71102
+71103
+71216
+71219
+71227
+71229
+71230
+71231
+71340
+71341
+71342
+71344
+71350
+71351
+71456
+71458
+71462
+71463
+71724
+71727
+71736
+71737
+72145
+72148
+72156
+72160
+72164
+72165
+72249
+72250
+72279
+72281
+72343
+72344
+72751
+72752
+72766
+72767
+72873
+72874
+72881
+72882
+72884
+72885
+73098
+73103
+73107
+73109
+73110
+73111
+73461
+73463
+94033
+94088
+119141
+119143
+119149
+119155
+END
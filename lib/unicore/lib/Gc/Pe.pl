@@ -0,0 +1,158 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V144
+41
+42
+93
+94
+125
+126
+3899
+3900
+3901
+3902
+5788
+5789
+8262
+8263
+8318
+8319
+8334
+8335
+8969
+8970
+8971
+8972
+9002
+9003
+10089
+10090
+10091
+10092
+10093
+10094
+10095
+10096
+10097
+10098
+10099
+10100
+10101
+10102
+10182
+10183
+10215
+10216
+10217
+10218
+10219
+10220
+10221
+10222
+10223
+10224
+10628
+10629
+10630
+10631
+10632
+10633
+10634
+10635
+10636
+10637
+10638
+10639
+10640
+10641
+10642
+10643
+10644
+10645
+10646
+10647
+10648
+10649
+10713
+10714
+10715
+10716
+10749
+10750
+11811
+11812
+11813
+11814
+11815
+11816
+11817
+11818
+12297
+12298
+12299
+12300
+12301
+12302
+12303
+12304
+12305
+12306
+12309
+12310
+12311
+12312
+12313
+12314
+12315
+12316
+12318
+12320
+64830
+64831
+65048
+65049
+65078
+65079
+65080
+65081
+65082
+65083
+65084
+65085
+65086
+65087
+65088
+65089
+65090
+65091
+65092
+65093
+65096
+65097
+65114
+65115
+65116
+65117
+65118
+65119
+65289
+65290
+65341
+65342
+65373
+65374
+65376
+65377
+65379
+65380
+END
@@ -0,0 +1,34 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V20
+187
+188
+8217
+8218
+8221
+8222
+8250
+8251
+11779
+11780
+11781
+11782
+11786
+11787
+11789
+11790
+11805
+11806
+11809
+11810
+END
@@ -0,0 +1,36 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V22
+171
+172
+8216
+8217
+8219
+8221
+8223
+8224
+8249
+8250
+11778
+11779
+11780
+11781
+11785
+11786
+11788
+11789
+11804
+11805
+11808
+11809
+END
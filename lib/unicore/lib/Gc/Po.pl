@@ -0,0 +1,372 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V358
+33
+36
+37
+40
+42
+43
+44
+45
+46
+48
+58
+60
+63
+65
+92
+93
+161
+162
+167
+168
+182
+184
+191
+192
+894
+895
+903
+904
+1370
+1376
+1417
+1418
+1472
+1473
+1475
+1476
+1478
+1479
+1523
+1525
+1545
+1547
+1548
+1550
+1563
+1564
+1566
+1568
+1642
+1646
+1748
+1749
+1792
+1806
+2039
+2042
+2096
+2111
+2142
+2143
+2404
+2406
+2416
+2417
+2557
+2558
+2678
+2679
+2800
+2801
+3191
+3192
+3204
+3205
+3572
+3573
+3663
+3664
+3674
+3676
+3844
+3859
+3860
+3861
+3973
+3974
+4048
+4053
+4057
+4059
+4170
+4176
+4347
+4348
+4960
+4969
+5742
+5743
+5867
+5870
+5941
+5943
+6100
+6103
+6104
+6107
+6144
+6150
+6151
+6155
+6468
+6470
+6686
+6688
+6816
+6823
+6824
+6830
+7002
+7009
+7164
+7168
+7227
+7232
+7294
+7296
+7360
+7368
+7379
+7380
+8214
+8216
+8224
+8232
+8240
+8249
+8251
+8255
+8257
+8260
+8263
+8274
+8275
+8276
+8277
+8287
+11513
+11517
+11518
+11520
+11632
+11633
+11776
+11778
+11782
+11785
+11787
+11788
+11790
+11799
+11800
+11802
+11803
+11804
+11806
+11808
+11818
+11823
+11824
+11834
+11836
+11840
+11841
+11842
+11843
+11856
+12289
+12292
+12349
+12350
+12539
+12540
+42238
+42240
+42509
+42512
+42611
+42612
+42622
+42623
+42738
+42744
+43124
+43128
+43214
+43216
+43256
+43259
+43260
+43261
+43310
+43312
+43359
+43360
+43457
+43470
+43486
+43488
+43612
+43616
+43742
+43744
+43760
+43762
+44011
+44012
+65040
+65047
+65049
+65050
+65072
+65073
+65093
+65095
+65097
+65101
+65104
+65107
+65108
+65112
+65119
+65122
+65128
+65129
+65130
+65132
+65281
+65284
+65285
+65288
+65290
+65291
+65292
+65293
+65294
+65296
+65306
+65308
+65311
+65313
+65340
+65341
+65377
+65378
+65380
+65382
+65792
+65795
+66463
+66464
+66512
+66513
+66927
+66928
+67671
+67672
+67871
+67872
+67903
+67904
+68176
+68185
+68223
+68224
+68336
+68343
+68409
+68416
+68505
+68509
+69461
+69466
+69703
+69710
+69819
+69821
+69822
+69826
+69952
+69956
+70004
+70006
+70085
+70089
+70093
+70094
+70107
+70108
+70109
+70112
+70200
+70206
+70313
+70314
+70731
+70736
+70747
+70748
+70749
+70750
+70854
+70855
+71105
+71128
+71233
+71236
+71264
+71277
+71484
+71487
+71739
+71740
+72162
+72163
+72255
+72263
+72346
+72349
+72350
+72355
+72769
+72774
+72816
+72818
+73463
+73465
+73727
+73728
+74864
+74869
+92782
+92784
+92917
+92918
+92983
+92988
+92996
+92997
+93847
+93851
+94178
+94179
+113823
+113824
+121479
+121484
+125278
+125280
+END
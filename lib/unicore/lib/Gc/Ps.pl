@@ -0,0 +1,164 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V150
+40
+41
+91
+92
+123
+124
+3898
+3899
+3900
+3901
+5787
+5788
+8218
+8219
+8222
+8223
+8261
+8262
+8317
+8318
+8333
+8334
+8968
+8969
+8970
+8971
+9001
+9002
+10088
+10089
+10090
+10091
+10092
+10093
+10094
+10095
+10096
+10097
+10098
+10099
+10100
+10101
+10181
+10182
+10214
+10215
+10216
+10217
+10218
+10219
+10220
+10221
+10222
+10223
+10627
+10628
+10629
+10630
+10631
+10632
+10633
+10634
+10635
+10636
+10637
+10638
+10639
+10640
+10641
+10642
+10643
+10644
+10645
+10646
+10647
+10648
+10712
+10713
+10714
+10715
+10748
+10749
+11810
+11811
+11812
+11813
+11814
+11815
+11816
+11817
+11842
+11843
+12296
+12297
+12298
+12299
+12300
+12301
+12302
+12303
+12304
+12305
+12308
+12309
+12310
+12311
+12312
+12313
+12314
+12315
+12317
+12318
+64831
+64832
+65047
+65048
+65077
+65078
+65079
+65080
+65081
+65082
+65083
+65084
+65085
+65086
+65087
+65088
+65089
+65090
+65091
+65092
+65095
+65096
+65113
+65114
+65115
+65116
+65117
+65118
+65288
+65289
+65339
+65340
+65371
+65372
+65375
+65376
+65378
+65379
+END
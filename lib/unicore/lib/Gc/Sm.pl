@@ -0,0 +1,142 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V128
+43
+44
+60
+63
+124
+125
+126
+127
+172
+173
+177
+178
+215
+216
+247
+248
+1014
+1015
+1542
+1545
+8260
+8261
+8274
+8275
+8314
+8317
+8330
+8333
+8472
+8473
+8512
+8517
+8523
+8524
+8592
+8597
+8602
+8604
+8608
+8609
+8611
+8612
+8614
+8615
+8622
+8623
+8654
+8656
+8658
+8659
+8660
+8661
+8692
+8960
+8992
+8994
+9084
+9085
+9115
+9140
+9180
+9186
+9655
+9656
+9665
+9666
+9720
+9728
+9839
+9840
+10176
+10181
+10183
+10214
+10224
+10240
+10496
+10627
+10649
+10712
+10716
+10748
+10750
+11008
+11056
+11077
+11079
+11085
+64297
+64298
+65122
+65123
+65124
+65127
+65291
+65292
+65308
+65311
+65372
+65373
+65374
+65375
+65506
+65507
+65513
+65517
+120513
+120514
+120539
+120540
+120571
+120572
+120597
+120598
+120629
+120630
+120655
+120656
+120687
+120688
+120713
+120714
+120745
+120746
+120771
+120772
+126704
+126706
+END
@@ -0,0 +1,1004 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V990
+0
+888
+890
+895
+900
+907
+908
+909
+910
+930
+931
+1318
+1329
+1367
+1369
+1376
+1377
+1416
+1417
+1419
+1425
+1480
+1488
+1515
+1520
+1525
+1536
+1540
+1542
+1564
+1566
+1568
+1569
+1631
+1632
+1806
+1807
+1867
+1869
+1970
+1984
+2043
+2048
+2094
+2096
+2111
+2304
+2362
+2364
+2383
+2384
+2390
+2392
+2419
+2425
+2432
+2433
+2436
+2437
+2445
+2447
+2449
+2451
+2473
+2474
+2481
+2482
+2483
+2486
+2490
+2492
+2501
+2503
+2505
+2507
+2511
+2519
+2520
+2524
+2526
+2527
+2532
+2534
+2556
+2561
+2564
+2565
+2571
+2575
+2577
+2579
+2601
+2602
+2609
+2610
+2612
+2613
+2615
+2616
+2618
+2620
+2621
+2622
+2627
+2631
+2633
+2635
+2638
+2641
+2642
+2649
+2653
+2654
+2655
+2662
+2678
+2689
+2692
+2693
+2702
+2703
+2706
+2707
+2729
+2730
+2737
+2738
+2740
+2741
+2746
+2748
+2758
+2759
+2762
+2763
+2766
+2768
+2769
+2784
+2788
+2790
+2800
+2801
+2802
+2817
+2820
+2821
+2829
+2831
+2833
+2835
+2857
+2858
+2865
+2866
+2868
+2869
+2874
+2876
+2885
+2887
+2889
+2891
+2894
+2902
+2904
+2908
+2910
+2911
+2916
+2918
+2930
+2946
+2948
+2949
+2955
+2958
+2961
+2962
+2966
+2969
+2971
+2972
+2973
+2974
+2976
+2979
+2981
+2984
+2987
+2990
+3002
+3006
+3011
+3014
+3017
+3018
+3022
+3024
+3025
+3031
+3032
+3046
+3067
+3073
+3076
+3077
+3085
+3086
+3089
+3090
+3113
+3114
+3124
+3125
+3130
+3133
+3141
+3142
+3145
+3146
+3150
+3157
+3159
+3160
+3162
+3168
+3172
+3174
+3184
+3192
+3200
+3202
+3204
+3205
+3213
+3214
+3217
+3218
+3241
+3242
+3252
+3253
+3258
+3260
+3269
+3270
+3273
+3274
+3278
+3285
+3287
+3294
+3295
+3296
+3300
+3302
+3312
+3313
+3315
+3330
+3332
+3333
+3341
+3342
+3345
+3346
+3369
+3370
+3386
+3389
+3397
+3398
+3401
+3402
+3406
+3415
+3416
+3424
+3428
+3430
+3446
+3449
+3456
+3458
+3460
+3461
+3479
+3482
+3506
+3507
+3516
+3517
+3518
+3520
+3527
+3530
+3531
+3535
+3541
+3542
+3543
+3544
+3552
+3570
+3573
+3585
+3643
+3647
+3676
+3713
+3715
+3716
+3717
+3719
+3721
+3722
+3723
+3725
+3726
+3732
+3736
+3737
+3744
+3745
+3748
+3749
+3750
+3751
+3752
+3754
+3756
+3757
+3770
+3771
+3774
+3776
+3781
+3782
+3783
+3784
+3790
+3792
+3802
+3804
+3806
+3840
+3912
+3913
+3949
+3953
+3980
+3984
+3992
+3993
+4029
+4030
+4045
+4046
+4057
+4096
+4294
+4304
+4349
+4352
+4681
+4682
+4686
+4688
+4695
+4696
+4697
+4698
+4702
+4704
+4745
+4746
+4750
+4752
+4785
+4786
+4790
+4792
+4799
+4800
+4801
+4802
+4806
+4808
+4823
+4824
+4881
+4882
+4886
+4888
+4955
+4959
+4989
+4992
+5018
+5024
+5109
+5120
+5789
+5792
+5873
+5888
+5901
+5902
+5909
+5920
+5943
+5952
+5972
+5984
+5997
+5998
+6001
+6002
+6004
+6016
+6110
+6112
+6122
+6128
+6138
+6144
+6159
+6160
+6170
+6176
+6264
+6272
+6315
+6320
+6390
+6400
+6429
+6432
+6444
+6448
+6460
+6464
+6465
+6468
+6510
+6512
+6517
+6528
+6572
+6576
+6602
+6608
+6619
+6622
+6684
+6686
+6751
+6752
+6781
+6783
+6794
+6800
+6810
+6816
+6830
+6912
+6988
+6992
+7037
+7040
+7083
+7086
+7098
+7168
+7224
+7227
+7242
+7245
+7296
+7376
+7411
+7424
+7655
+7677
+7958
+7960
+7966
+7968
+8006
+8008
+8014
+8016
+8024
+8025
+8026
+8027
+8028
+8029
+8030
+8031
+8062
+8064
+8117
+8118
+8133
+8134
+8148
+8150
+8156
+8157
+8176
+8178
+8181
+8182
+8191
+8192
+8293
+8298
+8306
+8308
+8335
+8336
+8341
+8352
+8377
+8400
+8433
+8448
+8586
+8592
+9193
+9216
+9255
+9280
+9291
+9312
+9934
+9935
+9954
+9955
+9956
+9960
+9984
+9985
+9989
+9990
+9994
+9996
+10024
+10025
+10060
+10061
+10062
+10063
+10067
+10070
+10079
+10081
+10133
+10136
+10160
+10161
+10175
+10176
+10187
+10188
+10189
+10192
+11085
+11088
+11098
+11264
+11311
+11312
+11359
+11360
+11506
+11513
+11558
+11568
+11622
+11631
+11632
+11648
+11671
+11680
+11687
+11688
+11695
+11696
+11703
+11704
+11711
+11712
+11719
+11720
+11727
+11728
+11735
+11736
+11743
+11744
+11826
+11904
+11930
+11931
+12020
+12032
+12246
+12272
+12284
+12288
+12352
+12353
+12439
+12441
+12544
+12549
+12590
+12593
+12687
+12688
+12728
+12736
+12772
+12784
+12831
+12832
+13055
+13056
+19894
+19904
+40908
+40960
+42125
+42128
+42183
+42192
+42540
+42560
+42592
+42594
+42612
+42620
+42648
+42656
+42744
+42752
+42893
+43003
+43052
+43056
+43066
+43072
+43128
+43136
+43205
+43214
+43226
+43232
+43260
+43264
+43348
+43359
+43389
+43392
+43470
+43471
+43482
+43486
+43488
+43520
+43575
+43584
+43598
+43600
+43610
+43612
+43644
+43648
+43715
+43739
+43744
+43968
+44014
+44016
+44026
+44032
+55204
+55216
+55239
+55243
+55292
+55296
+64046
+64048
+64110
+64112
+64218
+64256
+64263
+64275
+64280
+64285
+64311
+64312
+64317
+64318
+64319
+64320
+64322
+64323
+64325
+64326
+64434
+64467
+64832
+64848
+64912
+64914
+64968
+64976
+65022
+65024
+65050
+65056
+65063
+65072
+65107
+65108
+65127
+65128
+65132
+65136
+65141
+65142
+65277
+65279
+65280
+65281
+65471
+65474
+65480
+65482
+65488
+65490
+65496
+65498
+65501
+65504
+65511
+65512
+65519
+65529
+65548
+65549
+65575
+65576
+65595
+65596
+65598
+65599
+65614
+65616
+65630
+65664
+65787
+65792
+65795
+65799
+65844
+65847
+65931
+65936
+65948
+66000
+66046
+66176
+66205
+66208
+66257
+66304
+66335
+66336
+66340
+66352
+66379
+66432
+66462
+66463
+66500
+66504
+66518
+66560
+66718
+66720
+66730
+67584
+67590
+67592
+67593
+67594
+67638
+67639
+67641
+67644
+67645
+67647
+67670
+67671
+67680
+67840
+67868
+67871
+67898
+67903
+67904
+68096
+68100
+68101
+68103
+68108
+68116
+68117
+68120
+68121
+68148
+68152
+68155
+68159
+68168
+68176
+68185
+68192
+68224
+68352
+68406
+68409
+68438
+68440
+68467
+68472
+68480
+68608
+68681
+69216
+69247
+69760
+69826
+73728
+74607
+74752
+74851
+74864
+74868
+77824
+78895
+118784
+119030
+119040
+119079
+119081
+119262
+119296
+119366
+119552
+119639
+119648
+119666
+119808
+119893
+119894
+119965
+119966
+119968
+119970
+119971
+119973
+119975
+119977
+119981
+119982
+119994
+119995
+119996
+119997
+120004
+120005
+120070
+120071
+120075
+120077
+120085
+120086
+120093
+120094
+120122
+120123
+120127
+120128
+120133
+120134
+120135
+120138
+120145
+120146
+120486
+120488
+120780
+120782
+120832
+126976
+127020
+127024
+127124
+127232
+127243
+127248
+127279
+127281
+127282
+127293
+127294
+127295
+127296
+127298
+127299
+127302
+127303
+127306
+127311
+127319
+127320
+127327
+127328
+127353
+127354
+127355
+127357
+127359
+127360
+127370
+127374
+127376
+127377
+127488
+127489
+127504
+127538
+127552
+127561
+131070
+173783
+173824
+177973
+194560
+195102
+196606
+196608
+262142
+262144
+327678
+327680
+393214
+393216
+458750
+458752
+524286
+524288
+589822
+589824
+655358
+655360
+720894
+720896
+786430
+786432
+851966
+851968
+917502
+917504
+917505
+917506
+917536
+917632
+917760
+918000
+983038
+1114112
+END
@@ -0,0 +1,296 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V282
+2364
+2365
+2369
+2373
+2381
+2382
+2386
+2387
+2390
+2392
+2402
+2404
+2492
+2493
+2497
+2501
+2509
+2510
+2530
+2532
+2620
+2621
+2625
+2627
+2637
+2638
+2641
+2642
+2677
+2678
+2748
+2749
+2753
+2757
+2765
+2766
+2786
+2788
+2876
+2877
+2881
+2885
+2893
+2894
+2914
+2916
+3158
+3159
+3170
+3172
+3260
+3261
+3298
+3300
+3395
+3397
+3426
+3428
+3540
+3541
+3542
+3543
+3640
+3643
+3768
+3771
+3772
+3773
+3864
+3866
+3893
+3894
+3895
+3896
+3953
+3954
+3956
+3958
+3972
+3973
+3981
+3992
+3993
+4029
+4038
+4039
+4143
+4145
+4151
+4152
+4157
+4159
+4184
+4186
+4190
+4193
+4226
+4227
+4237
+4238
+5907
+5909
+5939
+5941
+5971
+5972
+6003
+6004
+6075
+6078
+6434
+6435
+6450
+6451
+6457
+6458
+6459
+6460
+6680
+6681
+6742
+6743
+6747
+6751
+6761
+6763
+6764
+6765
+6783
+6784
+6968
+6971
+7020
+7021
+7074
+7076
+7077
+7078
+7084
+7086
+7212
+7213
+7223
+7224
+7381
+7386
+7388
+7392
+7405
+7406
+43045
+43046
+43204
+43205
+43307
+43310
+43335
+43338
+43339
+43343
+43448
+43450
+43453
+43454
+43565
+43566
+43570
+43571
+43573
+43575
+43700
+43701
+43756
+43757
+44008
+44009
+44013
+44014
+68098
+68100
+68108
+68111
+68153
+68155
+69692
+69698
+69811
+69813
+69817
+69819
+69930
+69932
+69937
+69939
+70003
+70004
+70070
+70076
+70089
+70091
+70092
+70093
+70191
+70192
+70371
+70373
+70377
+70379
+70459
+70461
+70712
+70718
+70722
+70723
+70726
+70727
+70835
+70841
+70850
+70852
+71090
+71094
+71103
+71105
+71132
+71134
+71219
+71225
+71231
+71232
+71344
+71346
+71351
+71352
+71453
+71454
+71460
+71462
+71464
+71465
+71727
+71731
+71737
+71739
+72148
+72152
+72160
+72161
+72194
+72196
+72202
+72203
+72243
+72245
+72251
+72255
+72274
+72276
+72281
+72284
+72330
+72342
+72754
+72759
+72767
+72768
+72850
+72872
+72874
+72881
+72882
+72883
+73014
+73015
+73026
+73027
+73028
+73029
+73031
+73032
+73460
+73461
+END
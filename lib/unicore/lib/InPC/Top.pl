@@ -0,0 +1,384 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V370
+2304
+2307
+2362
+2363
+2373
+2377
+2385
+2386
+2387
+2390
+2433
+2434
+2558
+2559
+2561
+2563
+2631
+2633
+2635
+2637
+2672
+2674
+2689
+2691
+2757
+2758
+2759
+2761
+2810
+2816
+2817
+2818
+2879
+2880
+2902
+2903
+2946
+2947
+3008
+3009
+3021
+3022
+3072
+3073
+3076
+3077
+3134
+3137
+3142
+3144
+3146
+3150
+3157
+3158
+3201
+3202
+3263
+3264
+3270
+3271
+3276
+3278
+3328
+3330
+3387
+3389
+3405
+3406
+3530
+3531
+3538
+3540
+3633
+3634
+3636
+3640
+3655
+3663
+3761
+3762
+3764
+3768
+3771
+3772
+3784
+3790
+3897
+3898
+3954
+3955
+3962
+3967
+3968
+3969
+3970
+3972
+3974
+3976
+4141
+4143
+4146
+4151
+4154
+4155
+4209
+4213
+4229
+4231
+4253
+4254
+5906
+5907
+5938
+5939
+5970
+5971
+6002
+6003
+6071
+6075
+6086
+6087
+6089
+6098
+6099
+6100
+6109
+6110
+6432
+6434
+6439
+6441
+6458
+6459
+6679
+6680
+6683
+6684
+6744
+6747
+6754
+6755
+6757
+6761
+6763
+6764
+6771
+6781
+6912
+6916
+6964
+6965
+6966
+6968
+6978
+6979
+7019
+7020
+7021
+7028
+7040
+7042
+7076
+7077
+7080
+7082
+7142
+7143
+7144
+7146
+7149
+7150
+7151
+7154
+7213
+7220
+7222
+7223
+7376
+7379
+7386
+7388
+7392
+7393
+7412
+7413
+7675
+7676
+8432
+8433
+43010
+43011
+43014
+43015
+43019
+43020
+43046
+43047
+43205
+43206
+43232
+43250
+43263
+43264
+43338
+43339
+43343
+43346
+43392
+43395
+43443
+43444
+43446
+43448
+43452
+43453
+43493
+43494
+43561
+43565
+43566
+43567
+43569
+43570
+43587
+43588
+43596
+43597
+43644
+43645
+43696
+43697
+43698
+43700
+43703
+43705
+43710
+43712
+43713
+43714
+43757
+43758
+44005
+44006
+68101
+68102
+68111
+68112
+68152
+68153
+69633
+69634
+69688
+69692
+69698
+69703
+69760
+69762
+69813
+69815
+69888
+69891
+69927
+69930
+69933
+69934
+69936
+69937
+69940
+69941
+70016
+70018
+70076
+70079
+70091
+70092
+70192
+70194
+70196
+70197
+70198
+70200
+70206
+70207
+70367
+70368
+70373
+70377
+70400
+70402
+70464
+70465
+70502
+70509
+70512
+70517
+70718
+70720
+70723
+70725
+70750
+70751
+70842
+70843
+70847
+70849
+71100
+71102
+71225
+71227
+71229
+71230
+71232
+71233
+71339
+71340
+71341
+71342
+71346
+71350
+71455
+71456
+71458
+71460
+71463
+71464
+71465
+71468
+71731
+71736
+72154
+72156
+72193
+72194
+72196
+72202
+72245
+72249
+72273
+72274
+72276
+72279
+72342
+72343
+72344
+72345
+72752
+72754
+72760
+72766
+72883
+72884
+72885
+72887
+73009
+73014
+73018
+73019
+73020
+73022
+73023
+73026
+73027
+73028
+73104
+73106
+73109
+73110
+73459
+73460
+END
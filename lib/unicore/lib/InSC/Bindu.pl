@@ -0,0 +1,120 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V106
+2304
+2307
+2433
+2435
+2556
+2557
+2561
+2563
+2672
+2673
+2689
+2691
+2817
+2819
+2946
+2947
+3072
+3075
+3076
+3077
+3200
+3203
+3328
+3331
+3458
+3459
+3661
+3662
+3789
+3790
+3966
+3967
+3970
+3972
+4150
+4151
+6086
+6087
+6450
+6451
+6772
+6773
+6912
+6915
+7040
+7041
+7220
+7222
+43019
+43020
+43123
+43124
+43136
+43137
+43205
+43206
+43250
+43252
+43392
+43394
+68110
+68111
+69632
+69634
+69760
+69762
+69888
+69890
+70016
+70018
+70196
+70197
+70367
+70368
+70400
+70403
+70494
+70496
+70723
+70725
+70751
+70752
+70847
+70849
+71100
+71102
+71229
+71230
+71339
+71340
+71735
+71736
+72158
+72159
+72245
+72249
+72342
+72343
+72764
+72766
+72885
+72887
+73024
+73025
+73109
+73110
+END
@@ -0,0 +1,38 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V24
+2385
+2387
+2641
+2642
+2810
+2813
+7376
+7379
+7380
+7394
+7412
+7413
+7415
+7418
+8432
+8433
+43232
+43250
+70206
+70207
+70502
+70509
+70512
+70517
+END
@@ -0,0 +1,36 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V22
+6448
+6450
+6451
+6458
+6593
+6600
+6744
+6746
+7102
+7104
+7152
+7154
+7213
+7220
+43343
+43347
+43584
+43598
+43995
+44003
+72330
+72342
+END
@@ -0,0 +1,38 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V24
+3981
+3992
+3993
+4029
+6441
+6444
+6743
+6744
+6747
+6751
+7073
+7076
+7084
+7086
+7204
+7206
+43111
+43113
+43121
+43122
+72850
+72872
+72873
+72880
+END
@@ -0,0 +1,44 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V30
+45
+46
+160
+161
+215
+216
+2432
+2433
+2674
+2676
+4171
+4172
+4174
+4175
+6400
+6401
+7418
+7419
+8208
+8213
+9676
+9677
+43636
+43639
+72255
+72256
+72261
+72262
+73458
+73459
+END
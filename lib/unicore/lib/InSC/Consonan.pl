@@ -0,0 +1,312 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V298
+2325
+2362
+2392
+2400
+2424
+2432
+2453
+2473
+2474
+2481
+2482
+2483
+2486
+2490
+2524
+2526
+2527
+2528
+2544
+2546
+2581
+2601
+2602
+2609
+2610
+2612
+2613
+2615
+2616
+2618
+2649
+2653
+2654
+2655
+2709
+2729
+2730
+2737
+2738
+2740
+2741
+2746
+2809
+2810
+2837
+2857
+2858
+2865
+2866
+2868
+2869
+2874
+2908
+2910
+2911
+2912
+2929
+2930
+2965
+2966
+2969
+2971
+2972
+2973
+2974
+2976
+2979
+2981
+2984
+2987
+2990
+3002
+3093
+3113
+3114
+3130
+3160
+3163
+3221
+3241
+3242
+3252
+3253
+3258
+3294
+3295
+3349
+3387
+3482
+3506
+3507
+3516
+3517
+3518
+3520
+3527
+3585
+3631
+3713
+3715
+3716
+3717
+3718
+3723
+3724
+3748
+3749
+3750
+3751
+3759
+3804
+3808
+3904
+3912
+3913
+3949
+4096
+4129
+4159
+4160
+4176
+4178
+4186
+4190
+4193
+4194
+4197
+4199
+4206
+4209
+4213
+4226
+4238
+4239
+5891
+5901
+5902
+5906
+5923
+5938
+5955
+5970
+5987
+5997
+5998
+6001
+6016
+6051
+6401
+6431
+6480
+6499
+6528
+6572
+6656
+6679
+6688
+6733
+6739
+6741
+6931
+6964
+6981
+6988
+7050
+7073
+7086
+7088
+7099
+7102
+7104
+7140
+7168
+7204
+7245
+7248
+43015
+43019
+43020
+43043
+43072
+43102
+43106
+43110
+43113
+43121
+43122
+43123
+43154
+43188
+43274
+43298
+43312
+43335
+43401
+43404
+43407
+43443
+43488
+43493
+43495
+43504
+43514
+43519
+43526
+43561
+43616
+43632
+43633
+43636
+43642
+43643
+43646
+43696
+43746
+43755
+43968
+43982
+43984
+43985
+43986
+43995
+68096
+68097
+68112
+68116
+68117
+68120
+68121
+68150
+69651
+69688
+69773
+69808
+69895
+69927
+69956
+69957
+69973
+70003
+70033
+70067
+70152
+70162
+70163
+70188
+70276
+70279
+70280
+70281
+70282
+70286
+70287
+70302
+70303
+70313
+70330
+70367
+70421
+70441
+70442
+70449
+70450
+70452
+70453
+70458
+70670
+70709
+70799
+70832
+71054
+71087
+71182
+71216
+71306
+71339
+71352
+71353
+71424
+71451
+71690
+71724
+72110
+72145
+72203
+72243
+72284
+72324
+72718
+72751
+72818
+72848
+72972
+73009
+73068
+73098
+73440
+73458
+END
@@ -0,0 +1,102 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V88
+48
+58
+2406
+2416
+2534
+2544
+2662
+2672
+2790
+2800
+2918
+2928
+3046
+3056
+3174
+3184
+3302
+3312
+3430
+3440
+3558
+3568
+3664
+3674
+3792
+3802
+3872
+3892
+4160
+4170
+4240
+4250
+6112
+6122
+6470
+6480
+6608
+6619
+6784
+6794
+6800
+6810
+6992
+7002
+7088
+7098
+7232
+7242
+43216
+43226
+43264
+43274
+43472
+43482
+43504
+43514
+43600
+43610
+44016
+44026
+68160
+68169
+69734
+69744
+69942
+69952
+70096
+70106
+70113
+70133
+70384
+70394
+70736
+70746
+70864
+70874
+71248
+71258
+71360
+71370
+71472
+71484
+72784
+72813
+73040
+73050
+73120
+73130
+END
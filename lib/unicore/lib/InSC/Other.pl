@@ -0,0 +1,641 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V627
+0
+45
+46
+48
+58
+160
+161
+178
+180
+215
+216
+2304
+2384
+2385
+2387
+2389
+2404
+2406
+2416
+2418
+2436
+2437
+2445
+2447
+2449
+2451
+2473
+2474
+2481
+2482
+2483
+2486
+2490
+2492
+2501
+2503
+2505
+2507
+2511
+2519
+2520
+2524
+2526
+2527
+2532
+2534
+2546
+2556
+2557
+2558
+2559
+2561
+2564
+2565
+2571
+2575
+2577
+2579
+2601
+2602
+2609
+2610
+2612
+2613
+2615
+2616
+2618
+2620
+2621
+2622
+2627
+2631
+2633
+2635
+2638
+2641
+2642
+2649
+2653
+2654
+2655
+2662
+2676
+2677
+2678
+2689
+2692
+2693
+2702
+2703
+2706
+2707
+2729
+2730
+2737
+2738
+2740
+2741
+2746
+2748
+2758
+2759
+2762
+2763
+2766
+2784
+2788
+2790
+2800
+2809
+2816
+2817
+2820
+2821
+2829
+2831
+2833
+2835
+2857
+2858
+2865
+2866
+2868
+2869
+2874
+2876
+2885
+2887
+2889
+2891
+2894
+2902
+2904
+2908
+2910
+2911
+2916
+2918
+2928
+2929
+2930
+2946
+2948
+2949
+2955
+2958
+2961
+2962
+2966
+2969
+2971
+2972
+2973
+2974
+2976
+2979
+2981
+2984
+2987
+2990
+3002
+3006
+3011
+3014
+3017
+3018
+3022
+3031
+3032
+3046
+3056
+3072
+3085
+3086
+3089
+3090
+3113
+3114
+3130
+3133
+3141
+3142
+3145
+3146
+3150
+3157
+3159
+3160
+3163
+3168
+3172
+3174
+3184
+3200
+3204
+3205
+3213
+3214
+3217
+3218
+3241
+3242
+3252
+3253
+3258
+3260
+3269
+3270
+3273
+3274
+3278
+3285
+3287
+3294
+3295
+3296
+3300
+3302
+3312
+3313
+3315
+3328
+3332
+3333
+3341
+3342
+3345
+3346
+3397
+3398
+3401
+3402
+3407
+3412
+3416
+3423
+3428
+3430
+3440
+3450
+3456
+3458
+3460
+3461
+3479
+3482
+3506
+3507
+3516
+3517
+3518
+3520
+3527
+3530
+3531
+3535
+3541
+3542
+3543
+3544
+3552
+3558
+3568
+3570
+3572
+3585
+3631
+3632
+3643
+3648
+3654
+3655
+3663
+3664
+3674
+3713
+3715
+3716
+3717
+3718
+3723
+3724
+3748
+3749
+3750
+3751
+3759
+3760
+3774
+3776
+3781
+3784
+3788
+3789
+3790
+3792
+3802
+3804
+3808
+3872
+3892
+3893
+3894
+3895
+3896
+3897
+3898
+3904
+3912
+3913
+3949
+3953
+3974
+3976
+3992
+3993
+4029
+4038
+4039
+4096
+4170
+4171
+4172
+4174
+4175
+4176
+4254
+5888
+5901
+5902
+5909
+5920
+5941
+5952
+5972
+5984
+5997
+5998
+6001
+6002
+6004
+6016
+6068
+6070
+6100
+6108
+6110
+6112
+6122
+6400
+6431
+6432
+6444
+6448
+6460
+6470
+6510
+6512
+6517
+6528
+6572
+6576
+6602
+6608
+6619
+6656
+6684
+6688
+6751
+6752
+6781
+6783
+6794
+6800
+6810
+6912
+6988
+6992
+7002
+7040
+7156
+7168
+7224
+7232
+7242
+7245
+7248
+7376
+7379
+7380
+7394
+7410
+7419
+7675
+7676
+8204
+8206
+8208
+8213
+8308
+8309
+8322
+8325
+8432
+8433
+9676
+9677
+43008
+43048
+43072
+43124
+43136
+43206
+43216
+43226
+43232
+43252
+43262
+43310
+43312
+43348
+43392
+43457
+43472
+43482
+43488
+43494
+43495
+43519
+43520
+43575
+43584
+43598
+43600
+43610
+43616
+43632
+43633
+43639
+43642
+43715
+43744
+43760
+43765
+43767
+43968
+44011
+44012
+44014
+44016
+44026
+68096
+68100
+68101
+68103
+68108
+68116
+68117
+68120
+68121
+68150
+68152
+68155
+68159
+68169
+69632
+69703
+69714
+69744
+69759
+69819
+69888
+69941
+69942
+69952
+69956
+69959
+69968
+70004
+70016
+70084
+70089
+70093
+70096
+70106
+70113
+70133
+70144
+70162
+70163
+70200
+70206
+70207
+70272
+70279
+70280
+70281
+70282
+70286
+70287
+70302
+70303
+70313
+70320
+70379
+70384
+70394
+70400
+70404
+70405
+70413
+70415
+70417
+70419
+70441
+70442
+70449
+70450
+70452
+70453
+70458
+70459
+70469
+70471
+70473
+70475
+70478
+70487
+70488
+70494
+70500
+70502
+70509
+70512
+70517
+70656
+70728
+70736
+70746
+70750
+70752
+70785
+70853
+70864
+70874
+71040
+71094
+71096
+71105
+71128
+71134
+71168
+71233
+71248
+71258
+71296
+71353
+71360
+71370
+71424
+71451
+71453
+71468
+71472
+71484
+71680
+71739
+72096
+72104
+72106
+72152
+72154
+72162
+72164
+72165
+72192
+72256
+72261
+72262
+72263
+72264
+72272
+72346
+72349
+72350
+72704
+72713
+72714
+72759
+72760
+72769
+72784
+72813
+72818
+72848
+72850
+72872
+72873
+72887
+72960
+72967
+72968
+72970
+72971
+73015
+73018
+73019
+73020
+73022
+73023
+73032
+73040
+73050
+73056
+73062
+73063
+73065
+73066
+73103
+73104
+73106
+73107
+73112
+73120
+73130
+73440
+73463
+END
@@ -0,0 +1,84 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V70
+2307
+2308
+2435
+2436
+2563
+2564
+2691
+2692
+2819
+2820
+3075
+3076
+3203
+3204
+3331
+3332
+3459
+3460
+3967
+3968
+4152
+4153
+6087
+6088
+6916
+6917
+7042
+7043
+43137
+43138
+43395
+43396
+43765
+43766
+68111
+68112
+69634
+69635
+69762
+69763
+69890
+69891
+70018
+70019
+70403
+70404
+70725
+70726
+70849
+70850
+71102
+71103
+71230
+71231
+71340
+71341
+71736
+71737
+72159
+72160
+72249
+72250
+72343
+72344
+72766
+72767
+73025
+73026
+73110
+73111
+END
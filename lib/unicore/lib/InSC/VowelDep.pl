@@ -0,0 +1,272 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V258
+2362
+2364
+2366
+2381
+2382
+2384
+2389
+2392
+2402
+2404
+2494
+2501
+2503
+2505
+2507
+2509
+2519
+2520
+2530
+2532
+2622
+2627
+2631
+2633
+2635
+2637
+2750
+2758
+2759
+2762
+2763
+2765
+2786
+2788
+2878
+2885
+2887
+2889
+2891
+2893
+2902
+2904
+2914
+2916
+3006
+3011
+3014
+3017
+3018
+3021
+3031
+3032
+3134
+3141
+3142
+3145
+3146
+3149
+3157
+3159
+3170
+3172
+3262
+3269
+3270
+3273
+3274
+3277
+3285
+3287
+3298
+3300
+3390
+3397
+3398
+3401
+3402
+3405
+3415
+3416
+3426
+3428
+3535
+3541
+3542
+3543
+3544
+3552
+3570
+3572
+3632
+3642
+3648
+3654
+3655
+3656
+3760
+3770
+3771
+3772
+3776
+3781
+3953
+3966
+3968
+3970
+4139
+4150
+4182
+4186
+4194
+4195
+4199
+4201
+4209
+4213
+4227
+4231
+4252
+4254
+5906
+5908
+5938
+5940
+5970
+5972
+6002
+6004
+6070
+6086
+6088
+6089
+6432
+6441
+6458
+6459
+6576
+6593
+6679
+6684
+6753
+6772
+6965
+6980
+7076
+7082
+7143
+7152
+7206
+7213
+43010
+43011
+43043
+43048
+43189
+43204
+43263
+43264
+43335
+43343
+43444
+43453
+43493
+43494
+43561
+43571
+43696
+43711
+43755
+43760
+44003
+44011
+68097
+68100
+68101
+68103
+68108
+68110
+69688
+69702
+69808
+69817
+69927
+69939
+69957
+69959
+70067
+70080
+70091
+70093
+70188
+70196
+70368
+70377
+70462
+70469
+70471
+70473
+70475
+70477
+70487
+70488
+70498
+70500
+70709
+70722
+70832
+70847
+71087
+71094
+71096
+71100
+71132
+71134
+71216
+71229
+71232
+71233
+71341
+71350
+71456
+71467
+71724
+71735
+72145
+72152
+72154
+72158
+72164
+72165
+72193
+72203
+72273
+72284
+72751
+72759
+72760
+72764
+72880
+72885
+73009
+73015
+73018
+73019
+73020
+73022
+73023
+73024
+73027
+73028
+73098
+73103
+73104
+73106
+73107
+73109
+73459
+73463
+END
@@ -0,0 +1,184 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V170
+2308
+2325
+2400
+2402
+2418
+2424
+2437
+2445
+2447
+2449
+2451
+2453
+2528
+2530
+2565
+2571
+2575
+2577
+2579
+2581
+2693
+2702
+2703
+2706
+2707
+2709
+2784
+2786
+2821
+2829
+2831
+2833
+2835
+2837
+2912
+2914
+2949
+2955
+2958
+2961
+2962
+2965
+3077
+3085
+3086
+3089
+3090
+3093
+3168
+3170
+3205
+3213
+3214
+3217
+3218
+3221
+3296
+3298
+3333
+3341
+3342
+3345
+3346
+3349
+3423
+3426
+3461
+3479
+4129
+4139
+4178
+4182
+5888
+5891
+5920
+5923
+5952
+5955
+5984
+5987
+6051
+6068
+6733
+6739
+6917
+6931
+7043
+7050
+7140
+7142
+43008
+43010
+43011
+43014
+43138
+43154
+43262
+43263
+43396
+43401
+43404
+43407
+43520
+43526
+43744
+43746
+43982
+43984
+43985
+43986
+69637
+69651
+69763
+69773
+69891
+69895
+70019
+70033
+70144
+70152
+70272
+70276
+70320
+70330
+70405
+70413
+70415
+70417
+70419
+70421
+70496
+70498
+70656
+70670
+70785
+70799
+71040
+71054
+71128
+71132
+71168
+71182
+71296
+71306
+71680
+71690
+72096
+72104
+72106
+72110
+72192
+72193
+72272
+72273
+72704
+72713
+72714
+72718
+72960
+72967
+72968
+72970
+72971
+72972
+73056
+73062
+73063
+73065
+73066
+73068
+END
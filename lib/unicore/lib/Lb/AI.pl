@@ -0,0 +1,232 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V218
+167
+169
+170
+171
+178
+180
+182
+187
+188
+191
+215
+216
+247
+248
+711
+712
+713
+716
+717
+718
+720
+721
+728
+732
+733
+734
+8213
+8215
+8224
+8226
+8251
+8252
+8308
+8309
+8319
+8320
+8321
+8325
+8453
+8454
+8467
+8468
+8481
+8483
+8491
+8492
+8532
+8534
+8539
+8540
+8542
+8543
+8544
+8556
+8560
+8570
+8585
+8586
+8592
+8602
+8658
+8659
+8660
+8661
+8704
+8705
+8706
+8708
+8711
+8713
+8715
+8716
+8719
+8720
+8721
+8722
+8725
+8726
+8730
+8731
+8733
+8737
+8739
+8740
+8741
+8742
+8743
+8749
+8750
+8751
+8756
+8760
+8764
+8766
+8776
+8777
+8780
+8781
+8786
+8787
+8800
+8802
+8804
+8808
+8810
+8812
+8814
+8816
+8834
+8836
+8838
+8840
+8853
+8854
+8857
+8858
+8869
+8870
+8895
+8896
+8978
+8979
+9312
+9471
+9472
+9548
+9552
+9589
+9600
+9616
+9618
+9622
+9632
+9634
+9635
+9642
+9650
+9652
+9654
+9656
+9660
+9662
+9664
+9666
+9670
+9673
+9675
+9676
+9678
+9682
+9698
+9702
+9711
+9712
+9733
+9735
+9737
+9738
+9742
+9744
+9750
+9752
+9792
+9793
+9794
+9795
+9824
+9826
+9827
+9830
+9831
+9832
+9833
+9835
+9836
+9838
+9839
+9840
+9886
+9888
+9929
+9933
+9938
+9939
+9941
+9944
+9946
+9948
+9949
+9951
+9955
+9956
+9960
+9962
+9963
+9969
+9974
+9975
+9979
+9981
+10071
+10072
+10102
+10132
+11093
+11098
+12872
+12880
+65533
+65534
+127232
+127245
+127248
+127278
+127280
+127338
+127344
+127405
+END
@@ -0,0 +1,1524 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V1510
+35
+36
+38
+39
+42
+43
+60
+63
+64
+91
+94
+123
+126
+127
+166
+167
+169
+170
+172
+173
+174
+176
+181
+182
+192
+215
+216
+247
+248
+711
+718
+720
+721
+728
+732
+733
+734
+735
+736
+768
+880
+888
+890
+894
+895
+896
+900
+907
+908
+909
+910
+930
+931
+1155
+1162
+1328
+1329
+1367
+1369
+1417
+1421
+1423
+1472
+1473
+1475
+1476
+1523
+1525
+1536
+1545
+1550
+1552
+1568
+1611
+1645
+1648
+1649
+1748
+1749
+1750
+1757
+1759
+1765
+1767
+1769
+1770
+1774
+1776
+1786
+1806
+1807
+1809
+1810
+1840
+1869
+1958
+1969
+1970
+1994
+2027
+2036
+2040
+2042
+2043
+2048
+2070
+2074
+2075
+2084
+2085
+2088
+2089
+2096
+2111
+2112
+2137
+2142
+2143
+2144
+2155
+2208
+2229
+2230
+2238
+2274
+2275
+2308
+2362
+2365
+2366
+2384
+2385
+2392
+2402
+2416
+2433
+2437
+2445
+2447
+2449
+2451
+2473
+2474
+2481
+2482
+2483
+2486
+2490
+2493
+2494
+2510
+2511
+2524
+2526
+2527
+2530
+2544
+2546
+2548
+2553
+2554
+2555
+2556
+2558
+2565
+2571
+2575
+2577
+2579
+2601
+2602
+2609
+2610
+2612
+2613
+2615
+2616
+2618
+2649
+2653
+2654
+2655
+2674
+2677
+2678
+2679
+2693
+2702
+2703
+2706
+2707
+2729
+2730
+2737
+2738
+2740
+2741
+2746
+2749
+2750
+2768
+2769
+2784
+2786
+2800
+2801
+2809
+2810
+2821
+2829
+2831
+2833
+2835
+2857
+2858
+2865
+2866
+2868
+2869
+2874
+2877
+2878
+2908
+2910
+2911
+2914
+2928
+2936
+2947
+2948
+2949
+2955
+2958
+2961
+2962
+2966
+2969
+2971
+2972
+2973
+2974
+2976
+2979
+2981
+2984
+2987
+2990
+3002
+3024
+3025
+3056
+3065
+3066
+3067
+3077
+3085
+3086
+3089
+3090
+3113
+3114
+3130
+3133
+3134
+3160
+3163
+3168
+3170
+3192
+3201
+3205
+3213
+3214
+3217
+3218
+3241
+3242
+3252
+3253
+3258
+3261
+3262
+3294
+3295
+3296
+3298
+3313
+3315
+3333
+3341
+3342
+3345
+3346
+3387
+3389
+3390
+3406
+3408
+3412
+3415
+3416
+3426
+3440
+3449
+3450
+3456
+3461
+3479
+3482
+3506
+3507
+3516
+3517
+3518
+3520
+3527
+3572
+3573
+3663
+3664
+3840
+3841
+3845
+3846
+3859
+3860
+3861
+3864
+3866
+3872
+3882
+3892
+3894
+3895
+3896
+3897
+3904
+3912
+3913
+3949
+3976
+3981
+4032
+4038
+4039
+4045
+4046
+4048
+4052
+4057
+4172
+4176
+4256
+4294
+4295
+4296
+4301
+4302
+4304
+4352
+4608
+4681
+4682
+4686
+4688
+4695
+4696
+4697
+4698
+4702
+4704
+4745
+4746
+4750
+4752
+4785
+4786
+4790
+4792
+4799
+4800
+4801
+4802
+4806
+4808
+4823
+4824
+4881
+4882
+4886
+4888
+4955
+4960
+4961
+4962
+4989
+4992
+5018
+5024
+5110
+5112
+5118
+5121
+5760
+5761
+5787
+5792
+5867
+5870
+5881
+5888
+5901
+5902
+5906
+5920
+5938
+5952
+5970
+5984
+5997
+5998
+6001
+6105
+6106
+6128
+6138
+6144
+6146
+6151
+6152
+6154
+6155
+6176
+6265
+6272
+6277
+6279
+6313
+6314
+6315
+6320
+6390
+6400
+6431
+6464
+6465
+6624
+6679
+6686
+6688
+6917
+6964
+6981
+6988
+7004
+7005
+7009
+7019
+7028
+7037
+7043
+7073
+7086
+7088
+7098
+7142
+7164
+7204
+7245
+7248
+7258
+7294
+7296
+7305
+7312
+7355
+7357
+7368
+7379
+7380
+7401
+7405
+7406
+7412
+7413
+7415
+7418
+7419
+7424
+7616
+7680
+7958
+7960
+7966
+7968
+8006
+8008
+8014
+8016
+8024
+8025
+8026
+8027
+8028
+8029
+8030
+8031
+8062
+8064
+8117
+8118
+8133
+8134
+8148
+8150
+8156
+8157
+8176
+8178
+8181
+8182
+8189
+8190
+8191
+8215
+8216
+8226
+8228
+8248
+8249
+8254
+8260
+8266
+8278
+8279
+8280
+8284
+8285
+8289
+8293
+8304
+8306
+8309
+8317
+8320
+8321
+8325
+8333
+8336
+8349
+8448
+8451
+8452
+8453
+8454
+8457
+8458
+8467
+8468
+8470
+8471
+8481
+8483
+8491
+8492
+8532
+8534
+8539
+8540
+8542
+8543
+8544
+8556
+8560
+8570
+8585
+8586
+8588
+8602
+8658
+8659
+8660
+8661
+8704
+8705
+8706
+8708
+8711
+8713
+8715
+8716
+8719
+8720
+8721
+8724
+8725
+8726
+8730
+8731
+8733
+8737
+8739
+8740
+8741
+8742
+8743
+8749
+8750
+8751
+8756
+8760
+8764
+8766
+8776
+8777
+8780
+8781
+8786
+8787
+8800
+8802
+8804
+8808
+8810
+8812
+8814
+8816
+8834
+8836
+8838
+8840
+8853
+8854
+8857
+8858
+8869
+8870
+8895
+8896
+8943
+8944
+8968
+8972
+8978
+8979
+8986
+8988
+9001
+9003
+9200
+9204
+9255
+9280
+9291
+9471
+9472
+9548
+9552
+9589
+9600
+9616
+9618
+9622
+9632
+9634
+9635
+9642
+9650
+9652
+9654
+9656
+9660
+9662
+9664
+9666
+9670
+9673
+9675
+9676
+9678
+9682
+9698
+9702
+9711
+9712
+9728
+9732
+9733
+9735
+9737
+9738
+9742
+9744
+9748
+9753
+9754
+9760
+9785
+9788
+9792
+9793
+9794
+9795
+9824
+9826
+9827
+9830
+9831
+9835
+9836
+9838
+9839
+9840
+9855
+9856
+9886
+9888
+9917
+9934
+9935
+9954
+9955
+9956
+9960
+9989
+9992
+9998
+10071
+10072
+10075
+10081
+10082
+10085
+10088
+10132
+10181
+10183
+10214
+10224
+10627
+10649
+10712
+10716
+10748
+10750
+11093
+11098
+11124
+11126
+11158
+11160
+11311
+11312
+11359
+11360
+11503
+11506
+11508
+11517
+11518
+11520
+11558
+11559
+11560
+11565
+11566
+11568
+11624
+11631
+11632
+11648
+11671
+11680
+11687
+11688
+11695
+11696
+11703
+11704
+11711
+11712
+11719
+11720
+11727
+11728
+11735
+11736
+11743
+11798
+11799
+11802
+11804
+11806
+11808
+11823
+11824
+11826
+11827
+11829
+11834
+11839
+11840
+11851
+11852
+11853
+11854
+19904
+19968
+42192
+42238
+42240
+42509
+42512
+42528
+42538
+42540
+42560
+42607
+42611
+42612
+42622
+42654
+42656
+42736
+42738
+42739
+42752
+42944
+42946
+42951
+42999
+43010
+43011
+43014
+43015
+43019
+43020
+43043
+43048
+43052
+43056
+43064
+43065
+43066
+43072
+43124
+43138
+43188
+43250
+43260
+43261
+43263
+43274
+43302
+43312
+43335
+43359
+43360
+43396
+43443
+43457
+43463
+43466
+43470
+43471
+43472
+43486
+43488
+43520
+43561
+43584
+43587
+43588
+43596
+43612
+43613
+43744
+43755
+43762
+43765
+43777
+43783
+43785
+43791
+43793
+43799
+43808
+43815
+43816
+43823
+43824
+43880
+43888
+44003
+64256
+64263
+64275
+64280
+64297
+64298
+64336
+64450
+64467
+64830
+64848
+64912
+64914
+64968
+65008
+65020
+65021
+65022
+65136
+65141
+65142
+65277
+65512
+65519
+65536
+65548
+65549
+65575
+65576
+65595
+65596
+65598
+65599
+65614
+65616
+65630
+65664
+65787
+65799
+65844
+65847
+65935
+65936
+65948
+65952
+65953
+66000
+66045
+66176
+66205
+66208
+66257
+66273
+66300
+66304
+66340
+66349
+66379
+66384
+66422
+66432
+66462
+66464
+66500
+66504
+66512
+66513
+66518
+66560
+66718
+66736
+66772
+66776
+66812
+66816
+66856
+66864
+66916
+66927
+66928
+67072
+67383
+67392
+67414
+67424
+67432
+67584
+67590
+67592
+67593
+67594
+67638
+67639
+67641
+67644
+67645
+67647
+67670
+67672
+67743
+67751
+67760
+67808
+67827
+67828
+67830
+67835
+67868
+67872
+67898
+67903
+67904
+67968
+68024
+68028
+68048
+68050
+68097
+68112
+68116
+68117
+68120
+68121
+68150
+68160
+68169
+68184
+68185
+68192
+68256
+68288
+68325
+68331
+68336
+68352
+68406
+68416
+68438
+68440
+68467
+68472
+68498
+68505
+68509
+68521
+68528
+68608
+68681
+68736
+68787
+68800
+68851
+68858
+68900
+69216
+69247
+69376
+69416
+69424
+69446
+69457
+69466
+69600
+69623
+69635
+69688
+69705
+69710
+69714
+69734
+69763
+69808
+69819
+69822
+69837
+69838
+69840
+69865
+69891
+69927
+69956
+69957
+69968
+70003
+70004
+70005
+70006
+70007
+70019
+70067
+70081
+70085
+70087
+70088
+70093
+70094
+70106
+70107
+70108
+70109
+70113
+70133
+70144
+70162
+70163
+70188
+70202
+70203
+70205
+70206
+70272
+70279
+70280
+70281
+70282
+70286
+70287
+70302
+70303
+70313
+70320
+70367
+70405
+70413
+70415
+70417
+70419
+70441
+70442
+70449
+70450
+70452
+70453
+70458
+70461
+70462
+70480
+70481
+70493
+70498
+70656
+70709
+70727
+70731
+70735
+70736
+70749
+70750
+70751
+70752
+70784
+70832
+70852
+70856
+71040
+71087
+71110
+71113
+71128
+71132
+71168
+71216
+71235
+71237
+71296
+71339
+71352
+71353
+71680
+71724
+71739
+71740
+71840
+71904
+71914
+71923
+71935
+71936
+72096
+72104
+72106
+72145
+72161
+72162
+72163
+72164
+72192
+72193
+72203
+72243
+72250
+72251
+72256
+72257
+72262
+72263
+72272
+72273
+72284
+72330
+72349
+72350
+72384
+72441
+72704
+72713
+72714
+72751
+72768
+72769
+72794
+72813
+72818
+72848
+72960
+72967
+72968
+72970
+72971
+73009
+73030
+73031
+73056
+73062
+73063
+73065
+73066
+73098
+73112
+73113
+73440
+73459
+73463
+73465
+73664
+73693
+73697
+73714
+73728
+74650
+74752
+74863
+74880
+75076
+77824
+78424
+78430
+78466
+78467
+78470
+78474
+78713
+78716
+78895
+82944
+83406
+83408
+83527
+92160
+92729
+92736
+92767
+92880
+92910
+92928
+92976
+92986
+92996
+92997
+92998
+93019
+93026
+93027
+93048
+93053
+93072
+93760
+93847
+93849
+93851
+93952
+94027
+94032
+94033
+94099
+94112
+113664
+113771
+113776
+113789
+113792
+113801
+113808
+113818
+113820
+113821
+118784
+119030
+119040
+119079
+119081
+119141
+119146
+119149
+119171
+119173
+119180
+119210
+119214
+119273
+119296
+119362
+119365
+119366
+119520
+119540
+119552
+119639
+119648
+119673
+119808
+119893
+119894
+119965
+119966
+119968
+119970
+119971
+119973
+119975
+119977
+119981
+119982
+119994
+119995
+119996
+119997
+120004
+120005
+120070
+120071
+120075
+120077
+120085
+120086
+120093
+120094
+120122
+120123
+120127
+120128
+120133
+120134
+120135
+120138
+120145
+120146
+120486
+120488
+120780
+120832
+121344
+121399
+121403
+121453
+121461
+121462
+121476
+121477
+121479
+121483
+121484
+123136
+123181
+123191
+123198
+123214
+123216
+123584
+123628
+124928
+125125
+125127
+125136
+125184
+125252
+125259
+125260
+126065
+126124
+126125
+126128
+126129
+126133
+126209
+126270
+126464
+126468
+126469
+126496
+126497
+126499
+126500
+126501
+126503
+126504
+126505
+126515
+126516
+126520
+126521
+126522
+126523
+126524
+126530
+126531
+126535
+126536
+126537
+126538
+126539
+126540
+126541
+126544
+126545
+126547
+126548
+126549
+126551
+126552
+126553
+126554
+126555
+126556
+126557
+126558
+126559
+126560
+126561
+126563
+126564
+126565
+126567
+126571
+126572
+126579
+126580
+126584
+126585
+126589
+126590
+126591
+126592
+126602
+126603
+126620
+126625
+126628
+126629
+126634
+126635
+126652
+126704
+126706
+127278
+127280
+127338
+127341
+127900
+127902
+127925
+127927
+127932
+127933
+128160
+128161
+128162
+128163
+128164
+128165
+128175
+128176
+128177
+128179
+128256
+128263
+128279
+128293
+128306
+128330
+128468
+128476
+128500
+128506
+128592
+128630
+128636
+128640
+128768
+128884
+128896
+128981
+129024
+129036
+129040
+129096
+129104
+129114
+129120
+129160
+129168
+129198
+129280
+129292
+129536
+129620
+END
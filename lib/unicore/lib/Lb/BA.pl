@@ -0,0 +1,206 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V192
+9
+10
+124
+125
+173
+174
+1418
+1419
+1470
+1471
+2404
+2406
+3674
+3676
+3851
+3852
+3892
+3893
+3967
+3968
+3973
+3974
+4030
+4032
+4050
+4051
+4170
+4172
+4961
+4962
+5120
+5121
+5760
+5761
+5867
+5870
+5941
+5943
+6100
+6102
+6104
+6105
+6106
+6107
+6148
+6150
+7002
+7004
+7005
+7009
+7227
+7232
+7294
+7296
+8192
+8199
+8200
+8203
+8208
+8209
+8210
+8212
+8231
+8232
+8278
+8279
+8280
+8284
+8285
+8288
+11514
+11517
+11519
+11520
+11632
+11633
+11790
+11798
+11799
+11800
+11801
+11802
+11818
+11822
+11824
+11826
+11827
+11829
+11836
+11839
+11840
+11842
+11843
+11851
+11852
+11853
+11854
+11856
+12288
+12289
+42238
+42240
+42509
+42510
+42511
+42512
+42739
+42744
+43214
+43216
+43310
+43312
+43463
+43466
+43613
+43616
+43760
+43762
+44011
+44012
+65792
+65795
+66463
+66464
+66512
+66513
+67671
+67672
+67871
+67872
+68176
+68184
+68336
+68342
+68409
+68416
+69703
+69705
+69822
+69826
+69952
+69956
+70085
+70087
+70088
+70089
+70109
+70112
+70200
+70202
+70203
+70205
+70313
+70314
+70731
+70735
+70747
+70748
+71106
+71108
+71113
+71128
+71233
+71235
+71484
+71487
+72257
+72261
+72346
+72349
+72353
+72355
+72769
+72774
+73727
+73728
+74864
+74869
+92782
+92784
+92917
+92918
+92983
+92986
+92996
+92997
+93847
+93849
+113823
+113824
+121479
+121483
+END
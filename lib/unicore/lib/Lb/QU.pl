@@ -0,0 +1,40 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V26
+34
+35
+39
+40
+171
+172
+187
+188
+8216
+8218
+8219
+8222
+8223
+8224
+8249
+8251
+10075
+10081
+11776
+11790
+11804
+11806
+11808
+11810
+128630
+128633
+END
@@ -0,0 +1,237 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V223
+0
+768
+773
+774
+781
+783
+784
+785
+786
+787
+789
+795
+796
+803
+809
+813
+815
+816
+818
+824
+825
+832
+838
+884
+885
+894
+895
+903
+904
+1619
+1622
+2364
+2365
+2392
+2400
+2494
+2495
+2519
+2520
+2524
+2526
+2527
+2528
+2611
+2612
+2614
+2615
+2649
+2652
+2654
+2655
+2878
+2879
+2902
+2904
+2908
+2910
+3006
+3007
+3031
+3032
+3158
+3159
+3266
+3267
+3285
+3287
+3390
+3391
+3415
+3416
+3530
+3531
+3535
+3536
+3551
+3552
+3907
+3908
+3917
+3918
+3922
+3923
+3927
+3928
+3932
+3933
+3945
+3946
+3955
+3956
+3957
+3959
+3960
+3961
+3969
+3970
+3987
+3988
+3997
+3998
+4002
+4003
+4007
+4008
+4012
+4013
+4025
+4026
+4142
+4143
+4449
+4470
+4520
+4547
+6965
+6966
+8049
+8050
+8051
+8052
+8053
+8054
+8055
+8056
+8057
+8058
+8059
+8060
+8061
+8062
+8123
+8124
+8126
+8127
+8137
+8138
+8139
+8140
+8147
+8148
+8155
+8156
+8163
+8164
+8171
+8172
+8174
+8176
+8185
+8186
+8187
+8188
+8189
+8190
+8192
+8194
+8486
+8487
+8490
+8492
+9001
+9003
+10972
+10973
+12441
+12443
+63744
+64014
+64016
+64017
+64018
+64019
+64021
+64031
+64032
+64033
+64034
+64035
+64037
+64039
+64042
+64110
+64112
+64218
+64285
+64286
+64287
+64288
+64298
+64311
+64312
+64317
+64318
+64319
+64320
+64322
+64323
+64325
+64326
+64335
+69818
+69819
+69927
+69928
+70462
+70463
+70487
+70488
+70832
+70833
+70842
+70843
+70845
+70846
+71087
+71088
+119134
+119141
+119227
+119233
+194560
+195102
+END
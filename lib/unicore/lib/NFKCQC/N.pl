@@ -0,0 +1,510 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V496
+160
+161
+168
+169
+170
+171
+175
+176
+178
+182
+184
+187
+188
+191
+306
+308
+319
+321
+329
+330
+383
+384
+452
+461
+497
+500
+688
+697
+728
+734
+736
+741
+832
+834
+835
+837
+884
+885
+890
+891
+894
+895
+900
+902
+903
+904
+976
+983
+1008
+1011
+1012
+1014
+1017
+1018
+1415
+1416
+1653
+1657
+2392
+2400
+2524
+2526
+2527
+2528
+2611
+2612
+2614
+2615
+2649
+2652
+2654
+2655
+2908
+2910
+3635
+3636
+3763
+3764
+3804
+3806
+3852
+3853
+3907
+3908
+3917
+3918
+3922
+3923
+3927
+3928
+3932
+3933
+3945
+3946
+3955
+3956
+3957
+3962
+3969
+3970
+3987
+3988
+3997
+3998
+4002
+4003
+4007
+4008
+4012
+4013
+4025
+4026
+4348
+4349
+7468
+7471
+7472
+7483
+7484
+7502
+7503
+7531
+7544
+7545
+7579
+7616
+7834
+7836
+8049
+8050
+8051
+8052
+8053
+8054
+8055
+8056
+8057
+8058
+8059
+8060
+8061
+8062
+8123
+8124
+8125
+8130
+8137
+8138
+8139
+8140
+8141
+8144
+8147
+8148
+8155
+8156
+8157
+8160
+8163
+8164
+8171
+8172
+8173
+8176
+8185
+8186
+8187
+8188
+8189
+8191
+8192
+8203
+8209
+8210
+8215
+8216
+8228
+8231
+8239
+8240
+8243
+8245
+8246
+8248
+8252
+8253
+8254
+8255
+8263
+8266
+8279
+8280
+8287
+8288
+8304
+8306
+8308
+8335
+8336
+8349
+8360
+8361
+8448
+8452
+8453
+8456
+8457
+8468
+8469
+8471
+8473
+8478
+8480
+8483
+8484
+8485
+8486
+8487
+8488
+8489
+8490
+8494
+8495
+8498
+8499
+8506
+8507
+8513
+8517
+8522
+8528
+8576
+8585
+8586
+8748
+8750
+8751
+8753
+9001
+9003
+9312
+9451
+10764
+10765
+10868
+10871
+10972
+10973
+11388
+11390
+11631
+11632
+11935
+11936
+12019
+12020
+12032
+12246
+12288
+12289
+12342
+12343
+12344
+12347
+12443
+12445
+12447
+12448
+12543
+12544
+12593
+12687
+12690
+12704
+12800
+12831
+12832
+12872
+12880
+12927
+12928
+13312
+42652
+42654
+42864
+42865
+43000
+43002
+43868
+43872
+63744
+64014
+64016
+64017
+64018
+64019
+64021
+64031
+64032
+64033
+64034
+64035
+64037
+64039
+64042
+64110
+64112
+64218
+64256
+64263
+64275
+64280
+64285
+64286
+64287
+64311
+64312
+64317
+64318
+64319
+64320
+64322
+64323
+64325
+64326
+64434
+64467
+64830
+64848
+64912
+64914
+64968
+65008
+65021
+65040
+65050
+65072
+65093
+65095
+65107
+65108
+65127
+65128
+65132
+65136
+65139
+65140
+65141
+65142
+65277
+65281
+65471
+65474
+65480
+65482
+65488
+65490
+65496
+65498
+65501
+65504
+65511
+65512
+65519
+119134
+119141
+119227
+119233
+119808
+119893
+119894
+119965
+119966
+119968
+119970
+119971
+119973
+119975
+119977
+119981
+119982
+119994
+119995
+119996
+119997
+120004
+120005
+120070
+120071
+120075
+120077
+120085
+120086
+120093
+120094
+120122
+120123
+120127
+120128
+120133
+120134
+120135
+120138
+120145
+120146
+120486
+120488
+120780
+120782
+120832
+126464
+126468
+126469
+126496
+126497
+126499
+126500
+126501
+126503
+126504
+126505
+126515
+126516
+126520
+126521
+126522
+126523
+126524
+126530
+126531
+126535
+126536
+126537
+126538
+126539
+126540
+126541
+126544
+126545
+126547
+126548
+126549
+126551
+126552
+126553
+126554
+126555
+126556
+126557
+126558
+126559
+126560
+126561
+126563
+126564
+126565
+126567
+126571
+126572
+126579
+126580
+126584
+126585
+126589
+126590
+126591
+126592
+126602
+126603
+126620
+126625
+126628
+126629
+126634
+126635
+126652
+127232
+127243
+127248
+127279
+127280
+127312
+127338
+127341
+127376
+127377
+127488
+127491
+127504
+127548
+127552
+127561
+127568
+127570
+194560
+195102
+END
@@ -0,0 +1,792 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V778
+160
+161
+168
+169
+170
+171
+175
+176
+178
+182
+184
+187
+188
+191
+192
+198
+199
+208
+209
+215
+217
+222
+224
+230
+231
+240
+241
+247
+249
+254
+255
+272
+274
+294
+296
+305
+306
+312
+313
+321
+323
+330
+332
+338
+340
+358
+360
+384
+416
+418
+431
+433
+452
+477
+478
+484
+486
+502
+504
+540
+542
+544
+550
+564
+688
+697
+728
+734
+736
+741
+832
+834
+835
+837
+884
+885
+890
+891
+894
+895
+900
+907
+908
+909
+910
+913
+938
+945
+970
+975
+976
+983
+1008
+1011
+1012
+1014
+1017
+1018
+1024
+1026
+1027
+1028
+1031
+1032
+1036
+1039
+1049
+1050
+1081
+1082
+1104
+1106
+1107
+1108
+1111
+1112
+1116
+1119
+1142
+1144
+1217
+1219
+1232
+1236
+1238
+1240
+1242
+1248
+1250
+1256
+1258
+1270
+1272
+1274
+1415
+1416
+1570
+1575
+1653
+1657
+1728
+1729
+1730
+1731
+1747
+1748
+2345
+2346
+2353
+2354
+2356
+2357
+2392
+2400
+2507
+2509
+2524
+2526
+2527
+2528
+2611
+2612
+2614
+2615
+2649
+2652
+2654
+2655
+2888
+2889
+2891
+2893
+2908
+2910
+2964
+2965
+3018
+3021
+3144
+3145
+3264
+3265
+3271
+3273
+3274
+3276
+3402
+3405
+3546
+3547
+3548
+3551
+3635
+3636
+3763
+3764
+3804
+3806
+3852
+3853
+3907
+3908
+3917
+3918
+3922
+3923
+3927
+3928
+3932
+3933
+3945
+3946
+3955
+3956
+3957
+3962
+3969
+3970
+3987
+3988
+3997
+3998
+4002
+4003
+4007
+4008
+4012
+4013
+4025
+4026
+4134
+4135
+4348
+4349
+6918
+6919
+6920
+6921
+6922
+6923
+6924
+6925
+6926
+6927
+6930
+6931
+6971
+6972
+6973
+6974
+6976
+6978
+6979
+6980
+7468
+7471
+7472
+7483
+7484
+7502
+7503
+7531
+7544
+7545
+7579
+7616
+7680
+7836
+7840
+7930
+7936
+7958
+7960
+7966
+7968
+8006
+8008
+8014
+8016
+8024
+8025
+8026
+8027
+8028
+8029
+8030
+8031
+8062
+8064
+8117
+8118
+8133
+8134
+8148
+8150
+8156
+8157
+8176
+8178
+8181
+8182
+8191
+8192
+8203
+8209
+8210
+8215
+8216
+8228
+8231
+8239
+8240
+8243
+8245
+8246
+8248
+8252
+8253
+8254
+8255
+8263
+8266
+8279
+8280
+8287
+8288
+8304
+8306
+8308
+8335
+8336
+8349
+8360
+8361
+8448
+8452
+8453
+8456
+8457
+8468
+8469
+8471
+8473
+8478
+8480
+8483
+8484
+8485
+8486
+8487
+8488
+8489
+8490
+8494
+8495
+8498
+8499
+8506
+8507
+8513
+8517
+8522
+8528
+8576
+8585
+8586
+8602
+8604
+8622
+8623
+8653
+8656
+8708
+8709
+8713
+8714
+8716
+8717
+8740
+8741
+8742
+8743
+8748
+8750
+8751
+8753
+8769
+8770
+8772
+8773
+8775
+8776
+8777
+8778
+8800
+8801
+8802
+8803
+8813
+8818
+8820
+8822
+8824
+8826
+8832
+8834
+8836
+8838
+8840
+8842
+8876
+8880
+8928
+8932
+8938
+8942
+9001
+9003
+9312
+9451
+10764
+10765
+10868
+10871
+10972
+10973
+11388
+11390
+11631
+11632
+11935
+11936
+12019
+12020
+12032
+12246
+12288
+12289
+12342
+12343
+12344
+12347
+12364
+12365
+12366
+12367
+12368
+12369
+12370
+12371
+12372
+12373
+12374
+12375
+12376
+12377
+12378
+12379
+12380
+12381
+12382
+12383
+12384
+12385
+12386
+12387
+12389
+12390
+12391
+12392
+12393
+12394
+12400
+12402
+12403
+12405
+12406
+12408
+12409
+12411
+12412
+12414
+12436
+12437
+12443
+12445
+12446
+12448
+12460
+12461
+12462
+12463
+12464
+12465
+12466
+12467
+12468
+12469
+12470
+12471
+12472
+12473
+12474
+12475
+12476
+12477
+12478
+12479
+12480
+12481
+12482
+12483
+12485
+12486
+12487
+12488
+12489
+12490
+12496
+12498
+12499
+12501
+12502
+12504
+12505
+12507
+12508
+12510
+12532
+12533
+12535
+12539
+12542
+12544
+12593
+12687
+12690
+12704
+12800
+12831
+12832
+12872
+12880
+12927
+12928
+13312
+42652
+42654
+42864
+42865
+43000
+43002
+43868
+43872
+44032
+55204
+63744
+64014
+64016
+64017
+64018
+64019
+64021
+64031
+64032
+64033
+64034
+64035
+64037
+64039
+64042
+64110
+64112
+64218
+64256
+64263
+64275
+64280
+64285
+64286
+64287
+64311
+64312
+64317
+64318
+64319
+64320
+64322
+64323
+64325
+64326
+64434
+64467
+64830
+64848
+64912
+64914
+64968
+65008
+65021
+65040
+65050
+65072
+65093
+65095
+65107
+65108
+65127
+65128
+65132
+65136
+65139
+65140
+65141
+65142
+65277
+65281
+65471
+65474
+65480
+65482
+65488
+65490
+65496
+65498
+65501
+65504
+65511
+65512
+65519
+69786
+69787
+69788
+69789
+69803
+69804
+69934
+69936
+70475
+70477
+70843
+70845
+70846
+70847
+71098
+71100
+119134
+119141
+119227
+119233
+119808
+119893
+119894
+119965
+119966
+119968
+119970
+119971
+119973
+119975
+119977
+119981
+119982
+119994
+119995
+119996
+119997
+120004
+120005
+120070
+120071
+120075
+120077
+120085
+120086
+120093
+120094
+120122
+120123
+120127
+120128
+120133
+120134
+120135
+120138
+120145
+120146
+120486
+120488
+120780
+120782
+120832
+126464
+126468
+126469
+126496
+126497
+126499
+126500
+126501
+126503
+126504
+126505
+126515
+126516
+126520
+126521
+126522
+126523
+126524
+126530
+126531
+126535
+126536
+126537
+126538
+126539
+126540
+126541
+126544
+126545
+126547
+126548
+126549
+126551
+126552
+126553
+126554
+126555
+126556
+126557
+126558
+126559
+126560
+126561
+126563
+126564
+126565
+126567
+126571
+126572
+126579
+126580
+126584
+126585
+126589
+126590
+126591
+126592
+126602
+126603
+126620
+126625
+126628
+126629
+126634
+126635
+126652
+127232
+127243
+127248
+127279
+127280
+127312
+127338
+127341
+127376
+127377
+127488
+127491
+127504
+127548
+127552
+127561
+127568
+127570
+194560
+195102
+END
@@ -0,0 +1,172 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V158
+48
+49
+1632
+1633
+1776
+1777
+1984
+1985
+2406
+2407
+2534
+2535
+2662
+2663
+2790
+2791
+2918
+2919
+3046
+3047
+3174
+3175
+3192
+3193
+3302
+3303
+3430
+3431
+3558
+3559
+3664
+3665
+3792
+3793
+3872
+3873
+4160
+4161
+4240
+4241
+6112
+6113
+6128
+6129
+6160
+6161
+6470
+6471
+6608
+6609
+6784
+6785
+6800
+6801
+6992
+6993
+7088
+7089
+7232
+7233
+7248
+7249
+8304
+8305
+8320
+8321
+8585
+8586
+9450
+9451
+9471
+9472
+12295
+12296
+38646
+38647
+42528
+42529
+42735
+42736
+43216
+43217
+43264
+43265
+43472
+43473
+43504
+43505
+43600
+43601
+44016
+44017
+63922
+63923
+65296
+65297
+65930
+65931
+66720
+66721
+68912
+68913
+69734
+69735
+69872
+69873
+69942
+69943
+70096
+70097
+70384
+70385
+70736
+70737
+70864
+70865
+71248
+71249
+71360
+71361
+71472
+71473
+71904
+71905
+72784
+72785
+73040
+73041
+73120
+73121
+92768
+92769
+93008
+93009
+93824
+93825
+119520
+119521
+120782
+120783
+120792
+120793
+120802
+120803
+120812
+120813
+120822
+120823
+123200
+123201
+123632
+123633
+125264
+125265
+127232
+127234
+127243
+127245
+END
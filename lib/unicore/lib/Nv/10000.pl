@@ -0,0 +1,40 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V26
+4988
+4989
+8578
+8579
+19975
+19976
+33836
+33837
+65835
+65836
+65877
+65878
+67679
+67680
+68068
+68069
+93021
+93022
+126101
+126102
+126131
+126132
+126245
+126246
+126267
+126268
+END
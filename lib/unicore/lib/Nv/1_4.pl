@@ -0,0 +1,40 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V26
+188
+189
+2551
+2552
+2930
+2931
+3443
+3444
+43056
+43057
+65856
+65857
+65931
+65932
+68088
+68089
+69244
+69245
+73680
+73681
+74848
+74849
+74850
+74852
+126125
+126126
+END
@@ -0,0 +1,260 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V246
+52
+53
+1636
+1637
+1780
+1781
+1988
+1989
+2410
+2411
+2538
+2539
+2666
+2667
+2794
+2795
+2922
+2923
+3050
+3051
+3178
+3179
+3306
+3307
+3434
+3435
+3562
+3563
+3668
+3669
+3796
+3797
+3876
+3877
+4164
+4165
+4244
+4245
+4972
+4973
+6116
+6117
+6132
+6133
+6164
+6165
+6474
+6475
+6612
+6613
+6788
+6789
+6804
+6805
+6996
+6997
+7092
+7093
+7236
+7237
+7252
+7253
+8308
+8309
+8324
+8325
+8547
+8548
+8563
+8564
+9315
+9316
+9335
+9336
+9355
+9356
+9464
+9465
+10105
+10106
+10115
+10116
+10125
+10126
+12324
+12325
+12693
+12694
+12835
+12836
+12931
+12932
+20118
+20119
+22235
+22236
+32902
+32903
+42532
+42533
+42729
+42730
+43220
+43221
+43268
+43269
+43476
+43477
+43508
+43509
+43604
+43605
+44020
+44021
+65300
+65301
+65802
+65803
+66276
+66277
+66724
+66725
+67708
+67709
+67754
+67756
+68035
+68036
+68163
+68164
+68443
+68444
+68475
+68476
+68524
+68525
+68916
+68917
+69219
+69220
+69408
+69409
+69717
+69718
+69738
+69739
+69876
+69877
+69946
+69947
+70100
+70101
+70116
+70117
+70388
+70389
+70740
+70741
+70868
+70869
+71252
+71253
+71364
+71365
+71476
+71477
+71908
+71909
+72788
+72789
+72797
+72798
+73044
+73045
+73124
+73125
+74754
+74755
+74761
+74762
+74767
+74768
+74776
+74777
+74785
+74786
+74790
+74791
+74800
+74801
+74808
+74809
+74812
+74816
+74828
+74829
+74834
+74836
+74857
+74858
+92772
+92773
+93012
+93013
+93828
+93829
+119524
+119525
+119651
+119652
+119669
+119670
+120786
+120787
+120796
+120797
+120806
+120807
+120816
+120817
+120826
+120827
+123204
+123205
+123636
+123637
+125130
+125131
+125268
+125269
+126068
+126069
+126118
+126119
+126212
+126213
+126257
+126258
+127237
+127238
+131172
+131173
+131298
+131299
+156269
+156270
+END
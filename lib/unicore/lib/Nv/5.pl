@@ -0,0 +1,266 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V252
+53
+54
+1637
+1638
+1781
+1782
+1989
+1990
+2411
+2412
+2539
+2540
+2667
+2668
+2795
+2796
+2923
+2924
+3051
+3052
+3179
+3180
+3307
+3308
+3435
+3436
+3563
+3564
+3669
+3670
+3797
+3798
+3877
+3878
+4165
+4166
+4245
+4246
+4973
+4974
+6117
+6118
+6133
+6134
+6165
+6166
+6475
+6476
+6613
+6614
+6789
+6790
+6805
+6806
+6997
+6998
+7093
+7094
+7237
+7238
+7253
+7254
+8309
+8310
+8325
+8326
+8548
+8549
+8564
+8565
+9316
+9317
+9336
+9337
+9356
+9357
+9465
+9466
+10106
+10107
+10116
+10117
+10126
+10127
+12325
+12326
+12836
+12837
+12932
+12933
+13317
+13318
+14378
+14379
+20116
+20117
+20237
+20238
+42533
+42534
+42730
+42731
+43221
+43222
+43269
+43270
+43477
+43478
+43509
+43510
+43605
+43606
+44021
+44022
+65301
+65302
+65803
+65804
+65859
+65860
+65864
+65865
+65871
+65872
+65887
+65888
+65907
+65908
+66277
+66278
+66337
+66338
+66725
+66726
+67709
+67710
+67756
+67757
+67836
+67837
+68036
+68037
+68332
+68333
+68859
+68860
+68917
+68918
+69220
+69221
+69409
+69410
+69718
+69719
+69739
+69740
+69877
+69878
+69947
+69948
+70101
+70102
+70117
+70118
+70389
+70390
+70741
+70742
+70869
+70870
+71253
+71254
+71365
+71366
+71477
+71478
+71909
+71910
+72789
+72790
+72798
+72799
+73045
+73046
+73125
+73126
+74755
+74756
+74762
+74763
+74768
+74769
+74777
+74778
+74786
+74787
+74791
+74792
+74801
+74802
+74809
+74810
+74829
+74830
+74836
+74838
+74858
+74859
+92773
+92774
+93013
+93014
+93829
+93830
+119525
+119526
+119652
+119653
+119670
+119671
+119672
+119673
+120787
+120788
+120797
+120798
+120807
+120808
+120817
+120818
+120827
+120828
+123205
+123206
+123637
+123638
+125131
+125132
+125269
+125270
+126069
+126070
+126119
+126120
+126213
+126214
+126258
+126259
+127238
+127239
+131361
+131362
+END
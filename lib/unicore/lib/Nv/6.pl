@@ -0,0 +1,236 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V222
+54
+55
+1638
+1639
+1782
+1783
+1990
+1991
+2412
+2413
+2540
+2541
+2668
+2669
+2796
+2797
+2924
+2925
+3052
+3053
+3180
+3181
+3308
+3309
+3436
+3437
+3564
+3565
+3670
+3671
+3798
+3799
+3878
+3879
+4166
+4167
+4246
+4247
+4974
+4975
+6118
+6119
+6134
+6135
+6166
+6167
+6476
+6477
+6614
+6615
+6790
+6791
+6806
+6807
+6998
+6999
+7094
+7095
+7238
+7239
+7254
+7255
+8310
+8311
+8326
+8327
+8549
+8550
+8565
+8566
+8581
+8582
+9317
+9318
+9337
+9338
+9357
+9358
+9466
+9467
+10107
+10108
+10117
+10118
+10127
+10128
+12326
+12327
+12837
+12838
+12933
+12934
+20845
+20846
+38470
+38471
+38520
+38521
+42534
+42535
+42731
+42732
+43222
+43223
+43270
+43271
+43478
+43479
+43510
+43511
+43606
+43607
+44022
+44023
+63953
+63954
+63955
+63956
+65302
+65303
+65804
+65805
+66278
+66279
+66726
+66727
+68037
+68038
+68918
+68919
+69221
+69222
+69719
+69720
+69740
+69741
+69878
+69879
+69948
+69949
+70102
+70103
+70118
+70119
+70390
+70391
+70742
+70743
+70870
+70871
+71254
+71255
+71366
+71367
+71478
+71479
+71910
+71911
+72790
+72791
+72799
+72800
+73046
+73047
+73126
+73127
+74756
+74757
+74763
+74764
+74769
+74770
+74778
+74779
+74792
+74793
+74816
+74817
+74830
+74831
+74859
+74860
+92774
+92775
+93014
+93015
+93830
+93831
+119526
+119527
+119653
+119654
+120788
+120789
+120798
+120799
+120808
+120809
+120818
+120819
+120828
+120829
+123206
+123207
+123638
+123639
+125132
+125133
+125270
+125271
+126070
+126071
+126120
+126121
+126214
+126215
+126259
+126260
+127239
+127240
+133866
+133867
+END
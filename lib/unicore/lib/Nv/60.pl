@@ -0,0 +1,40 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V26
+4983
+4984
+12877
+12878
+65813
+65814
+66287
+66288
+68046
+68047
+69230
+69231
+69728
+69729
+70127
+70128
+71919
+71920
+72808
+72809
+119662
+119663
+126079
+126080
+126223
+126224
+END
@@ -0,0 +1,230 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V216
+55
+56
+1639
+1640
+1783
+1784
+1991
+1992
+2413
+2414
+2541
+2542
+2669
+2670
+2797
+2798
+2925
+2926
+3053
+3054
+3181
+3182
+3309
+3310
+3437
+3438
+3565
+3566
+3671
+3672
+3799
+3800
+3879
+3880
+4167
+4168
+4247
+4248
+4975
+4976
+6119
+6120
+6135
+6136
+6167
+6168
+6477
+6478
+6615
+6616
+6791
+6792
+6807
+6808
+6999
+7000
+7095
+7096
+7239
+7240
+7255
+7256
+8311
+8312
+8327
+8328
+8550
+8551
+8566
+8567
+9318
+9319
+9338
+9339
+9358
+9359
+9467
+9468
+10108
+10109
+10118
+10119
+10128
+10129
+12327
+12328
+12838
+12839
+12934
+12935
+15181
+15182
+19971
+19972
+26578
+26579
+28422
+28423
+42535
+42536
+42732
+42733
+43223
+43224
+43271
+43272
+43479
+43480
+43511
+43512
+43607
+43608
+44023
+44024
+65303
+65304
+65805
+65806
+66279
+66280
+66727
+66728
+68038
+68039
+68919
+68920
+69222
+69223
+69720
+69721
+69741
+69742
+69879
+69880
+69949
+69950
+70103
+70104
+70119
+70120
+70391
+70392
+70743
+70744
+70871
+70872
+71255
+71256
+71367
+71368
+71479
+71480
+71911
+71912
+72791
+72792
+72800
+72801
+73047
+73048
+73127
+73128
+74757
+74758
+74764
+74765
+74770
+74771
+74779
+74780
+74793
+74794
+74817
+74820
+74860
+74861
+92775
+92776
+93015
+93016
+93831
+93832
+119527
+119528
+119654
+119655
+120789
+120790
+120799
+120800
+120809
+120810
+120819
+120820
+120829
+120830
+123207
+123208
+123639
+123640
+125133
+125134
+125271
+125272
+126071
+126072
+126121
+126122
+126215
+126216
+126260
+126261
+127240
+127241
+131073
+131074
+END
@@ -0,0 +1,40 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V26
+4984
+4985
+12878
+12879
+65814
+65815
+66288
+66289
+68047
+68048
+69231
+69232
+69729
+69730
+70128
+70129
+71920
+71921
+72809
+72810
+119663
+119664
+126080
+126081
+126224
+126225
+END
@@ -0,0 +1,224 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V210
+56
+57
+1640
+1641
+1784
+1785
+1992
+1993
+2414
+2415
+2542
+2543
+2670
+2671
+2798
+2799
+2926
+2927
+3054
+3055
+3182
+3183
+3310
+3311
+3438
+3439
+3566
+3567
+3672
+3673
+3800
+3801
+3880
+3881
+4168
+4169
+4248
+4249
+4976
+4977
+6120
+6121
+6136
+6137
+6168
+6169
+6478
+6479
+6616
+6617
+6792
+6793
+6808
+6809
+7000
+7001
+7096
+7097
+7240
+7241
+7256
+7257
+8312
+8313
+8328
+8329
+8551
+8552
+8567
+8568
+9319
+9320
+9339
+9340
+9359
+9360
+9468
+9469
+10109
+10110
+10119
+10120
+10129
+10130
+12328
+12329
+12839
+12840
+12935
+12936
+20843
+20844
+25420
+25421
+42536
+42537
+42733
+42734
+43224
+43225
+43272
+43273
+43480
+43481
+43512
+43513
+43608
+43609
+44024
+44025
+65304
+65305
+65806
+65807
+66280
+66281
+66728
+66729
+68039
+68040
+68920
+68921
+69223
+69224
+69721
+69722
+69742
+69743
+69880
+69881
+69950
+69951
+70104
+70105
+70120
+70121
+70392
+70393
+70744
+70745
+70872
+70873
+71256
+71257
+71368
+71369
+71480
+71481
+71912
+71913
+72792
+72793
+72801
+72802
+73048
+73049
+73128
+73129
+74758
+74759
+74765
+74766
+74771
+74772
+74780
+74781
+74794
+74795
+74820
+74822
+74861
+74862
+92776
+92777
+93016
+93017
+93832
+93833
+119528
+119529
+119655
+119656
+120790
+120791
+120800
+120801
+120810
+120811
+120820
+120821
+120830
+120831
+123208
+123209
+123640
+123641
+125134
+125135
+125272
+125273
+126072
+126073
+126122
+126123
+126216
+126217
+126261
+126262
+127241
+127242
+END
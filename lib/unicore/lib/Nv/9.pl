@@ -0,0 +1,228 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V214
+57
+58
+1641
+1642
+1785
+1786
+1993
+1994
+2415
+2416
+2543
+2544
+2671
+2672
+2799
+2800
+2927
+2928
+3055
+3056
+3183
+3184
+3311
+3312
+3439
+3440
+3567
+3568
+3673
+3674
+3801
+3802
+3881
+3882
+4169
+4170
+4249
+4250
+4977
+4978
+6121
+6122
+6137
+6138
+6169
+6170
+6479
+6480
+6617
+6618
+6793
+6794
+6809
+6810
+7001
+7002
+7097
+7098
+7241
+7242
+7257
+7258
+8313
+8314
+8329
+8330
+8552
+8553
+8568
+8569
+9320
+9321
+9340
+9341
+9360
+9361
+9469
+9470
+10110
+10111
+10120
+10121
+10130
+10131
+12329
+12330
+12840
+12841
+12936
+12937
+20061
+20062
+24318
+24319
+29590
+29591
+42537
+42538
+42734
+42735
+43225
+43226
+43273
+43274
+43481
+43482
+43513
+43514
+43609
+43610
+44025
+44026
+65305
+65306
+65807
+65808
+66281
+66282
+66729
+66730
+68040
+68041
+68921
+68922
+69224
+69225
+69722
+69723
+69743
+69744
+69881
+69882
+69951
+69952
+70105
+70106
+70121
+70122
+70393
+70394
+70745
+70746
+70873
+70874
+71257
+71258
+71369
+71370
+71481
+71482
+71913
+71914
+72793
+72794
+72802
+72803
+73049
+73050
+73129
+73130
+74759
+74760
+74766
+74767
+74772
+74773
+74781
+74782
+74795
+74796
+74822
+74826
+74862
+74863
+92777
+92778
+93017
+93018
+93833
+93834
+119529
+119530
+119656
+119657
+120791
+120792
+120801
+120802
+120811
+120812
+120821
+120822
+120831
+120832
+123209
+123210
+123641
+123642
+125135
+125136
+125273
+125274
+126073
+126074
+126123
+126124
+126217
+126218
+126262
+126263
+127242
+127243
+194704
+194705
+END
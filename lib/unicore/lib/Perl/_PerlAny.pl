@@ -0,0 +1,280 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V266
+65
+91
+97
+123
+181
+182
+192
+215
+216
+247
+248
+305
+306
+312
+313
+397
+398
+411
+412
+426
+428
+442
+444
+446
+447
+448
+452
+545
+546
+564
+570
+597
+598
+600
+601
+602
+603
+605
+608
+610
+611
+612
+613
+615
+616
+621
+623
+624
+625
+627
+629
+630
+637
+638
+640
+641
+642
+644
+647
+653
+658
+659
+669
+671
+700
+701
+702
+703
+768
+770
+775
+777
+778
+779
+780
+781
+787
+788
+817
+818
+834
+835
+837
+838
+880
+884
+886
+888
+891
+894
+895
+896
+902
+903
+904
+907
+908
+909
+910
+930
+931
+978
+981
+1014
+1015
+1020
+1021
+1154
+1162
+1328
+1329
+1367
+1377
+1416
+4256
+4294
+4295
+4296
+4301
+4302
+4304
+4347
+4349
+4352
+5024
+5110
+5112
+5118
+7296
+7305
+7312
+7355
+7357
+7360
+7545
+7546
+7549
+7550
+7566
+7567
+7680
+7836
+7838
+7839
+7840
+7958
+7960
+7966
+7968
+8006
+8008
+8014
+8016
+8024
+8025
+8026
+8027
+8028
+8029
+8030
+8031
+8062
+8064
+8117
+8118
+8125
+8126
+8127
+8130
+8133
+8134
+8141
+8144
+8148
+8150
+8156
+8160
+8173
+8178
+8181
+8182
+8189
+8486
+8487
+8490
+8492
+8498
+8499
+8526
+8527
+8544
+8576
+8579
+8581
+9398
+9450
+11264
+11311
+11312
+11359
+11360
+11377
+11378
+11380
+11381
+11383
+11390
+11492
+11499
+11503
+11506
+11508
+11520
+11558
+11559
+11560
+11565
+11566
+42560
+42606
+42624
+42652
+42786
+42800
+42802
+42864
+42873
+42888
+42891
+42894
+42896
+42901
+42902
+42927
+42928
+42944
+42946
+42951
+43859
+43860
+43888
+43968
+64256
+64263
+64275
+64280
+65313
+65339
+65345
+65371
+66560
+66640
+66736
+66772
+66776
+66812
+68736
+68787
+68800
+68851
+71840
+71904
+93760
+93824
+125184
+125252
+END
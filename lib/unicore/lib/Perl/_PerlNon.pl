@@ -0,0 +1,52 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V38
+102
+103
+105
+106
+108
+109
+110
+111
+115
+117
+702
+703
+768
+770
+775
+777
+778
+779
+780
+781
+787
+788
+817
+818
+834
+835
+953
+954
+1381
+1382
+1387
+1388
+1389
+1390
+1398
+1399
+1410
+1411
+END
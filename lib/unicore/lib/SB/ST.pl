@@ -0,0 +1,156 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V142
+33
+34
+63
+64
+1417
+1418
+1566
+1568
+1748
+1749
+1792
+1795
+2041
+2042
+2103
+2104
+2105
+2106
+2109
+2111
+2404
+2406
+4170
+4172
+4962
+4963
+4967
+4969
+5742
+5743
+5941
+5943
+6147
+6148
+6153
+6154
+6468
+6470
+6824
+6828
+7002
+7004
+7006
+7008
+7227
+7229
+7294
+7296
+8252
+8254
+8263
+8266
+11822
+11823
+11836
+11837
+12290
+12291
+42239
+42240
+42510
+42512
+42739
+42740
+42743
+42744
+43126
+43128
+43214
+43216
+43311
+43312
+43464
+43466
+43613
+43616
+43760
+43762
+44011
+44012
+65110
+65112
+65281
+65282
+65311
+65312
+65377
+65378
+68182
+68184
+69461
+69466
+69703
+69705
+69822
+69826
+69953
+69956
+70085
+70087
+70093
+70094
+70110
+70112
+70200
+70202
+70203
+70205
+70313
+70314
+70731
+70733
+71106
+71108
+71113
+71128
+71233
+71235
+71484
+71487
+72258
+72260
+72347
+72349
+72769
+72771
+73463
+73465
+92782
+92784
+92917
+92918
+92983
+92985
+92996
+92997
+93848
+93849
+113823
+113824
+121480
+121481
+END
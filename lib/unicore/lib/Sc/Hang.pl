@@ -0,0 +1,42 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V28
+4352
+4608
+12334
+12336
+12593
+12687
+12800
+12831
+12896
+12927
+43360
+43389
+44032
+55204
+55216
+55239
+55243
+55292
+65440
+65471
+65474
+65480
+65482
+65488
+65490
+65496
+65498
+65501
+END
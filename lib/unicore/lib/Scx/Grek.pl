@@ -0,0 +1,90 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V76
+834
+835
+837
+838
+880
+884
+885
+888
+890
+894
+895
+896
+900
+901
+902
+903
+904
+907
+908
+909
+910
+930
+931
+994
+1008
+1024
+7462
+7467
+7517
+7522
+7526
+7531
+7615
+7618
+7936
+7958
+7960
+7966
+7968
+8006
+8008
+8014
+8016
+8024
+8025
+8026
+8027
+8028
+8029
+8030
+8031
+8062
+8064
+8117
+8118
+8133
+8134
+8148
+8150
+8156
+8157
+8176
+8178
+8181
+8182
+8191
+8486
+8487
+43877
+43878
+65856
+65935
+65952
+65953
+119296
+119366
+END
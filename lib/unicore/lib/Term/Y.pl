@@ -0,0 +1,218 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V204
+33
+34
+44
+45
+46
+47
+58
+60
+63
+64
+894
+895
+903
+904
+1417
+1418
+1475
+1476
+1548
+1549
+1563
+1564
+1566
+1568
+1748
+1749
+1792
+1803
+1804
+1805
+2040
+2042
+2096
+2111
+2142
+2143
+2404
+2406
+3674
+3676
+3848
+3849
+3853
+3859
+4170
+4172
+4961
+4969
+5742
+5743
+5867
+5870
+5941
+5943
+6100
+6103
+6106
+6107
+6146
+6150
+6152
+6154
+6468
+6470
+6824
+6828
+7002
+7004
+7005
+7008
+7227
+7232
+7294
+7296
+8252
+8254
+8263
+8266
+11822
+11823
+11836
+11837
+11841
+11842
+11852
+11853
+11854
+11856
+12289
+12291
+42238
+42240
+42509
+42512
+42739
+42744
+43126
+43128
+43214
+43216
+43311
+43312
+43463
+43466
+43613
+43616
+43743
+43744
+43760
+43762
+44011
+44012
+65104
+65107
+65108
+65112
+65281
+65282
+65292
+65293
+65294
+65295
+65306
+65308
+65311
+65312
+65377
+65378
+65380
+65381
+66463
+66464
+66512
+66513
+67671
+67672
+67871
+67872
+68182
+68184
+68336
+68342
+68410
+68416
+68505
+68509
+69461
+69466
+69703
+69710
+69822
+69826
+69953
+69956
+70085
+70087
+70093
+70094
+70110
+70112
+70200
+70205
+70313
+70314
+70731
+70734
+70747
+70748
+71106
+71110
+71113
+71128
+71233
+71235
+71484
+71487
+72258
+72260
+72347
+72349
+72353
+72355
+72769
+72772
+72817
+72818
+73463
+73465
+74864
+74869
+92782
+92784
+92917
+92918
+92983
+92986
+92996
+92997
+93847
+93849
+113823
+113824
+121479
+121483
+END
@@ -0,0 +1,264 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V250
+167
+168
+169
+170
+174
+175
+177
+178
+188
+191
+215
+216
+247
+248
+746
+748
+4352
+4608
+5121
+5760
+6320
+6400
+8214
+8215
+8224
+8226
+8240
+8242
+8251
+8253
+8258
+8259
+8263
+8266
+8273
+8274
+8293
+8294
+8413
+8417
+8418
+8421
+8448
+8450
+8451
+8458
+8463
+8464
+8467
+8469
+8470
+8472
+8478
+8484
+8485
+8486
+8487
+8488
+8489
+8490
+8494
+8495
+8501
+8512
+8517
+8523
+8524
+8526
+8527
+8586
+8588
+8592
+8734
+8735
+8756
+8758
+8960
+8968
+8972
+8992
+8996
+9001
+9003
+9004
+9085
+9115
+9150
+9166
+9167
+9168
+9169
+9180
+9186
+9251
+9252
+9472
+9632
+9754
+9760
+10088
+10102
+10132
+11026
+11056
+11088
+11098
+11192
+11218
+11219
+11244
+11248
+11264
+11904
+12289
+12291
+12296
+12306
+12308
+12320
+12336
+12337
+12353
+12354
+12355
+12356
+12357
+12358
+12359
+12360
+12361
+12362
+12387
+12388
+12419
+12420
+12421
+12422
+12423
+12424
+12430
+12431
+12437
+12439
+12443
+12445
+12448
+12450
+12451
+12452
+12453
+12454
+12455
+12456
+12457
+12458
+12483
+12484
+12515
+12516
+12517
+12518
+12519
+12520
+12526
+12527
+12533
+12535
+12540
+12541
+12583
+12584
+12784
+12800
+13055
+13144
+13179
+13184
+42192
+43360
+43392
+44032
+55296
+57344
+64256
+65040
+65056
+65072
+65097
+65107
+65112
+65119
+65123
+65127
+65136
+65282
+65288
+65290
+65292
+65295
+65306
+65312
+65339
+65340
+65341
+65342
+65343
+65344
+65371
+65504
+65507
+65508
+65512
+65520
+65529
+65532
+65534
+67968
+68000
+71040
+71168
+72192
+72368
+77824
+78912
+82944
+83584
+94176
+101120
+110592
+111360
+118784
+119296
+119520
+119680
+120832
+121520
+126976
+127488
+127490
+129024
+129280
+129696
+131072
+196606
+196608
+262142
+983040
+1048574
+1048576
+1114110
+END
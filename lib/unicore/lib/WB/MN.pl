@@ -0,0 +1,42 @@
+# !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+# This file is machine-generated by lib/unicore/mktables from the Unicode
+# database, Version 12.1.0.  Any changes made here will be lost!
+
+# !!!!!!!   INTERNAL PERL USE ONLY   !!!!!!!
+# This file is for internal use by core Perl only.  The format and even the
+# name or existence of this file are subject to change without notice.  Don't
+# use it directly.  Use Unicode::UCD to access the Unicode character data
+# base.
+
+
+return <<'END';
+V28
+44
+45
+59
+60
+894
+895
+1417
+1418
+1548
+1550
+1644
+1645
+2040
+2041
+8260
+8261
+65040
+65041
+65044
+65045
+65104
+65105
+65108
+65109
+65292
+65293
+65307
+65308
+END
@@ -680,4 +680,63 @@ eval "package \x{100};\n" . <<'END'
 END
 or die $@;
 
+{
+    # utf8::valid and length check 16 and 32 byte blocks at once, so
+    # move characters and errors across the block boundaries
+    no warnings 'utf8';
+    my ($ok_valid, $ok_len, $ok_bad) = (1, 1, 1);
+    for my $char ("\x{e9}", "\x{20ac}", "\x{1f600}", "\x{d800}", "\x{fffe}",
+                  "\x{110000}") {
+        my $bytes = $char;
+        utf8::encode($bytes);
+        for my $pre (0 .. 70) {
+            my $s = ("a" x $pre) . $char . ("b" x (70 - $pre)) . $char;
+            my $b = $s;
+            utf8::encode($b);
+            $ok_valid = 0 unless utf8::valid($s) && utf8::decode($b);
+            $ok_len = 0 unless length($s) == 72 && length($b) == 72;
+            for my $cut (1 .. length($bytes) - 1) {
+                my $t = ("a" x $pre) . substr($bytes, 0, $cut)
+                      . ("b" x (70 - $pre)) . $bytes;
+                $ok_bad = 0 if utf8::decode($t);
+            }
+        }
+    }
+    ok($ok_valid, "utf8::valid and decode at all block offsets");
+    ok($ok_len, "length at all block offsets");
+    ok($ok_bad, "truncated characters found at all block offsets");
+}
+
+{
+    # utf8::upgrade, downgrade and concatenation convert 16 bytes at a
+    # time, so move the variants across the block boundaries
+    my ($ok_up, $ok_down, $ok_cat, $ok_wide) = (1, 1, 1, 1);
+    for my $len (0 .. 70) {
+        for my $pre (0 .. $len) {
+            my $s = ("a" x $pre) . ("\xe9\xff" x (($len - $pre) / 2))
+                  . ("b" x $len) . "\x80";
+            my $u = $s;
+            utf8::upgrade($u);
+            my $want = $s;
+            $want =~ s/([\x80-\xff])/chr(0xc0 | ord($1) >> 6)
+                                    . chr(0x80 | ord($1) & 0x3f)/ge;
+            $ok_up = 0 unless $u eq $s
+                && do { use bytes; $u eq $want };
+            my $d = $u;
+            $ok_down = 0 unless utf8::downgrade($d, 1) && $d eq $s
+                && !utf8::is_utf8($d);
+            my $c = "\x{100}";
+            $c .= $s;
+            $ok_cat = 0 unless $c eq "\x{100}$s" && substr($c, 1) eq $s;
+            my $w = $u;
+            substr($w, $pre, 0, "\x{100}");
+            $ok_wide = 0 if utf8::downgrade($w, 1) || substr($w, $pre, 1) ne "\x{100}";
+        }
+    }
+    ok($ok_up, "utf8::upgrade at all block offsets");
+    ok($ok_down, "utf8::downgrade at all block offsets");
+    ok($ok_cat, "appending bytes to utf8 at all block offsets");
+    ok($ok_wide, "utf8::downgrade of wide characters at all block offsets");
+}
+
 done_testing();
@@ -133,6 +133,9 @@ if ($define{USE_ITHREADS} && $ARGS{PLATFORM} ne 'win32' && $ARGS{PLATFORM} ne 'n
     $define{USE_REENTRANT_API} = 1;
 }
 
+# hv.h
+delete $define{PERL_GLOBAL_STRTAB} unless $define{USE_ITHREADS};
+
 if (! $define{NO_LOCALE}) {
     if ( ! $define{NO_POSIX_2008_LOCALE}
         && $define{HAS_NEWLOCALE}
@@ -300,7 +303,6 @@ unless ($define{'DEBUGGING'}) {
                     Perl__setlocale_debug_string
 		    Perl_set_padlist
 		    Perl_hv_assert
-		    PL_max_cowrefcnt
 		    PL_max_refcnt
 		    PL_max_refcnt_sv
                     PL_count_null_ops
@@ -623,6 +625,17 @@ unless ($define{USE_LOCALE_NUMERIC}) {
 			 );
 }
 
+unless ($define{PERL_HASH_FUNC_SELECT}) {
+    ++$skip{$_} foreach qw(
+		    PL_hash_func
+		    PL_hash_func_name
+			 );
+}
+
+unless ($define{PERL_GLOBAL_STRTAB}) {
+    ++$skip{PL_strtab_stripes};
+}
+
 unless ($define{'USE_C_BACKTRACE'}) {
     ++$skip{Perl_get_c_backtrace_dump};
     ++$skip{Perl_dump_c_backtrace};
@@ -1499,6 +1499,158 @@ S_my_atof_infnan(pTHX_ const char* s, bool negative, const char* send, NV* value
 
 #endif /* if defined(NV_INF) || defined(NV_NAN) */
 
+#if defined(Perl_strtod) && defined(PERL_FAST_NUMCONV)
+
+/* 5**k for 0 <= k <= 27, the largest power of five fitting a U64 */
+static const U64 pow5_u64[28] = {
+    UINT64_C(1), UINT64_C(5), UINT64_C(25), UINT64_C(125), UINT64_C(625),
+    UINT64_C(3125), UINT64_C(15625), UINT64_C(78125), UINT64_C(390625),
+    UINT64_C(1953125), UINT64_C(9765625), UINT64_C(48828125),
+    UINT64_C(244140625), UINT64_C(1220703125), UINT64_C(6103515625),
+    UINT64_C(30517578125), UINT64_C(152587890625), UINT64_C(762939453125),
+    UINT64_C(3814697265625), UINT64_C(19073486328125),
+    UINT64_C(95367431640625), UINT64_C(476837158203125),
+    UINT64_C(2384185791015625), UINT64_C(11920928955078125),
+    UINT64_C(59604644775390625), UINT64_C(298023223876953125),
+    UINT64_C(1490116119384765625), UINT64_C(7450580596923828125)
+};
+
+#  if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+/* 10**k for 0 <= k <= 22, all exact in a double */
+static const NV pow10_nv[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+#  endif
+
+#  ifdef USE_LOCALE_NUMERIC
+/* Whether S_strtod() parses with a '.' radix in the current scope */
+#    define STRTOD_RADIX_IS_DOT                                         \
+        (! IN_LC(LC_NUMERIC) || PL_numeric_underlying_is_standard       \
+                             || PL_numeric_standard > 1)
+#  else
+#    define STRTOD_RADIX_IS_DOT 1
+#  endif
+
+/* Helper for my_atof3.  Converts the unsigned decimal number at the start
+ * of [s, send) to the nearest NV, as strtod() does, and returns a pointer
+ * past it.  Returns NULL, leaving the number to strtod(), if there are no
+ * digits, it is hexadecimal, it has more than 19 significant digits or its
+ * decimal exponent is outside -27..27.
+ *
+ * The number is then w * 10**e with w < 2**64, and w * 5**|e| fits in 128
+ * bits, so the nearest double is found exactly with integer arithmetic: a
+ * multiplication for e >= 0, or a division keeping the remainder as sticky
+ * bit for e < 0, followed by rounding half-to-even to 53 bits.  Numbers
+ * whose parts are exact doubles take Clinger's shortcut of a single
+ * correctly rounded floating point operation instead. */
+STATIC const char *
+S_decimal_2nv(const char *s, const char *const send, NV *value)
+{
+    const char *p = s;
+    U64 w = 0, mant;
+    int nd = 0;         /* significant digits in w */
+    int e = 0, bexp, len;
+    bool seen = FALSE, sticky = FALSE;
+    unsigned __int128 n;
+    union { NV nv; U64 u; } bits;
+
+    if (send - p > 1 && p[0] == '0' && isALPHA_FOLD_EQ(p[1], 'x'))
+        return NULL;
+    for (; p < send && isDIGIT(*p); p++) {
+        seen = TRUE;
+        if (w || *p != '0') {
+            if (++nd > 19)
+                return NULL;
+            w = w * 10 + (*p - '0');
+        }
+    }
+    if (p < send && *p == '.') {
+        for (p++; p < send && isDIGIT(*p); p++) {
+            seen = TRUE;
+            if (w || *p != '0') {
+                if (++nd > 19)
+                    return NULL;
+                w = w * 10 + (*p - '0');
+            }
+            e--;
+        }
+    }
+    if (!seen)
+        return NULL;
+    /* like strtod(), an 'e' without digits is not part of the number */
+    if (p < send && isALPHA_FOLD_EQ(*p, 'e')) {
+        const char *q = p + 1;
+        bool eneg = FALSE;
+        int x = 0;
+        if (q < send && (*q == '+' || *q == '-'))
+            eneg = *q++ == '-';
+        if (q < send && isDIGIT(*q)) {
+            for (; q < send && isDIGIT(*q); q++)
+                if (x < 100000)
+                    x = x * 10 + (*q - '0');
+            e += eneg ? -x : x;
+            p = q;
+        }
+    }
+
+    if (!w) {
+        *value = 0.0;
+        return p;
+    }
+    if (e < -27 || e > 27)
+        return NULL;
+#  if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    if (w <= (UINT64_C(1) << 53) && e >= -22 && e <= 22) {
+        *value = e >= 0 ? (NV)w * pow10_nv[e] : (NV)w / pow10_nv[-e];
+        return p;
+    }
+#  endif
+
+    if (e >= 0) {
+        /* w * 10**e == w * 5**e * 2**e */
+        n = (unsigned __int128)w * pow5_u64[e];
+        bexp = e;
+    }
+    else {
+        /* w * 10**e == w / 5**-e * 2**e; shift w to the top of 127 bits
+         * first so that the quotient keeps at least 64 significant bits */
+        const int up = 63 + __builtin_clzll(w);
+        const unsigned __int128 num = (unsigned __int128)w << up;
+        n = num / pow5_u64[-e];
+        sticky = num != n * pow5_u64[-e];
+        bexp = e - up;
+    }
+
+    len = (U64)(n >> 64)
+        ? 128 - __builtin_clzll((U64)(n >> 64))
+        : 64 - __builtin_clzll((U64)n);
+    if (len <= 53) {
+        mant = (U64)n << (53 - len);
+        bexp -= 53 - len;
+    }
+    else {
+        const int sh = len - 53;
+        const unsigned __int128 half = (unsigned __int128)1 << (sh - 1);
+        const unsigned __int128 rem = n & ((half << 1) - 1);
+        mant = (U64)(n >> sh);
+        bexp += sh;
+        if (rem > half || (rem == half && (sticky || (mant & 1)))) {
+            if (++mant == UINT64_C(1) << 53) {
+                mant >>= 1;
+                bexp++;
+            }
+        }
+    }
+    /* mant * 2**bexp with 2**52 <= mant < 2**53, always a normal double */
+    bits.u = ((U64)(bexp + 52 + 1023) << 52)
+           | (mant & ((UINT64_C(1) << 52) - 1));
+    *value = bits.nv;
+    return p;
+}
+
+#endif /* Perl_strtod && PERL_FAST_NUMCONV */
+
 char*
 Perl_my_atof2(pTHX_ const char* orig, NV* value)
 {
@@ -1555,6 +1707,15 @@ Perl_my_atof3(pTHX_ const char* orig, NV* value, const STRLEN len)
         if ((endp = S_my_atof_infnan(aTHX_ s, negative, send, value)))
             return endp;
 
+#  ifdef PERL_FAST_NUMCONV
+        if (STRTOD_RADIX_IS_DOT
+            && (endp = (char *)S_decimal_2nv(s, send, &result[2])))
+        {
+            *value = negative ? -result[2] : result[2];
+            return endp;
+        }
+#  endif
+
         /* If the length is passed in, the input string isn't NUL-terminated,
          * and in it turns out the function below assumes it is; therefore we
          * create a copy and NUL-terminate that */
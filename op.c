@@ -1296,6 +1296,13 @@ Perl_op_clear(pTHX_ OP *o)
     case OP_ENTEREVAL:	/* Was holding hints. */
 	o->op_targ = 0;
 	break;
+#ifdef PERL_JIT
+    case OP_UNSTACK:	/* Was counting for the JIT. */
+	if (o->op_ppaddr != Perl_pp_unstack && PL_jit_code)
+	    jit_free(o);
+	o->op_targ = 0;
+	break;
+#endif
     default:
 	if (!(o->op_flags & OPf_REF)
 	    || (PL_check[o->op_type] != Perl_ck_ftst))
@@ -3923,16 +3930,17 @@ S_maybe_multiconcat(pTHX_ OP *o)
 /*
 =for apidoc cv_check_inline
 
-Examine an optree to determine whether it's in-lineable.
-In contrast to op_const_sv allow short op sequences which are not
-constant folded.
-Max 10 ops, no new pad (?), no intermediate return, no recursion, ...
-no call-by-ref: $_[i] aelemfast(*_) or aelem rv2av or multideref($_[$x])
-TODO later: call-by-ref, new lexicals. walk by sib not next (skipping other).
+Examine a sub to determine whether calls to it can be inlined by
+L</cv_do_inline>. In contrast to op_const_sv allow short op sequences
+which are not constant folded.
 
-cv_inline needs to translate the args, change return to jumps.
+The sub must have a signature (or a fake signature from C<my(...) = @_>)
+with only mandatory untyped scalar params, and a body of a single
+expression of max. C<PERL_MAX_INLINE_OPS> pure ops on these params and
+constants, or a single C<multideref> on a param, i.e. an accessor like
+C<< $self->{field} >>.
+No lvalue subs, no methods (dynamic dispatch), no closures.
 
-$lhs = call(...); => $lhs = do {...inlined...};
 =cut
 */
 
@@ -3942,89 +3950,219 @@ $lhs = call(...); => $lhs = do {...inlined...};
 
 #ifdef PERL_INLINE_SUBS
 
+/* Check or fixup the aux items of a multideref op in an inlinable body.
+   Only param derefs with const or param indices are allowed.
+   With base, the items are a copy for the caller: move the params
+   to the caller pad temps at base and take a ref of the const keys. */
+
 static bool
-S_cv_check_inline(pTHX_ const OP *o, CV *compcv)
+S_inline_mderef(pTHX_ UNOP_AUX_item *items, CV *cv, PADOFFSET pad_ix,
+                U8 nargs, PADOFFSET base)
 {
-    const OP *firstop = o;
-    unsigned short i = 0;
-    PADLIST *padlist;
-    PERL_ARGS_ASSERT_CV_CHECK_INLINE;
-
-    /* XXX we do not fixup targs yet */
-    if ((padlist = CvPADLIST(compcv)) && PadlistMAX(padlist) > 1)
-        return FALSE;
-
-    for (; o; o = o->op_next) {
-	const OPCODE type = o->op_type;
-        i++;
+    UV actions = items->uv;
 
-        if (i > PERL_MAX_INLINE_OPS) return FALSE;
-	else if (OP_IS_COP(type)
-              || type == OP_NULL      || type == OP_LINESEQ
-              || type == OP_PUSHMARK)
-            continue;
-	else if (type == OP_RETURN || type == OP_GOTO
-              || type == OP_CALLER || type == OP_WARN
-              || type == OP_DIE    || type == OP_RESET
-              || type == OP_RUNCV  || type == OP_PADRANGE)
-	    return FALSE;
-        /* PERL_GLOBAL_STRUCT_INIT is only defined inside util.c:Perl_init_global_struct */
-#if defined(USE_CPERL) && !defined(PERL_GLOBAL_STRUCT_INIT)
-	if (type == OP_SIGNATURE) /* not yet. fast, but need to fixup targs */
-	    return FALSE;
+    PERL_ARGS_ASSERT_INLINE_MDEREF;
+#ifndef USE_ITHREADS
+    PERL_UNUSED_ARG(cv);
 #endif
-	else if (type == OP_LEAVESUB)
-	    break;
-#if 0
-        /* skip on call-by-ref semantics: $_[n] */
-        else if (type == OP_AELEMFAST) {
-            if (strEQ(GvNAME(cGVOPo_gv), "_")) {
-                DEBUG_k(Perl_deb(aTHX_ "check_inline: skip call-by-ref aelemfast($_[])\n"));
+    while (1) {
+        const bool is_hash = (actions & MDEREF_ACTION_MASK)
+                                 >= MDEREF_HV_pop_rv2hv_helem;
+        switch (actions & MDEREF_ACTION_MASK) {
+        case MDEREF_reload:
+            actions = (++items)->uv;
+            continue;
+        case MDEREF_AV_padsv_vivify_rv2av_aelem:
+        case MDEREF_HV_padsv_vivify_rv2hv_helem:
+            items++;
+            if (items->pad_offset < pad_ix
+                || items->pad_offset >= pad_ix + nargs)
                 return FALSE;
-            }
+            if (base)
+                items->pad_offset += base - pad_ix;
+            break;
+        case MDEREF_AV_vivify_rv2av_aelem:
+        case MDEREF_HV_vivify_rv2hv_helem:
+            break;
+        default:
+            return FALSE;
         }
-        else if (type == OP_MULTIDEREF) {
-            UNOP_AUX_item *items = cUNOP_AUXo->op_aux;
-            UV actions = items->uv;
+        switch (actions & (MDEREF_INDEX_MASK|MDEREF_INDEX_uoob)) {
+        case MDEREF_INDEX_const:
             items++;
-            if ((actions & MDEREF_ACTION_MASK) == MDEREF_AV_gvav_aelem) {
-                GV *gv = (GV*)UNOP_AUX_item_sv(items);
-                if (GvNAMELEN(gv) == 1 && *GvNAME(gv) == '_') {
-                    DEBUG_k(Perl_deb(aTHX_ "check_inline: skip call-by-ref multideref($_[])\n"));
-                    return FALSE;
-                }
-            }
-            else if ((actions & MDEREF_ACTION_MASK) == MDEREF_AV_padav_aelem) {
-                PADOFFSET off = items->pad_offset;
-                PADLIST * const padlist = CvPADLIST(compcv);
-                PADNAME * pad = padnamelist_fetch(PadlistNAMES(padlist), off);
-                if (PadnameLEN(pad) == 1 && *PadnamePV(pad) == '_') {
-                    DEBUG_k(Perl_deb(aTHX_ "check_inline: skip call-by-ref multideref($_[])\n"));
-                    return FALSE;
-                }
-            }
-        }
+            if (is_hash && base) {
+#ifdef USE_ITHREADS
+                SV *keysv = SvREFCNT_inc_NN(
+                    PadARRAY(PadlistARRAY(CvPADLIST(cv))[1])[items->pad_offset]);
+                op_relocate_sv(&keysv, &items->pad_offset);
+#else
+                SvREFCNT_inc_simple_void_NN(items->sv);
 #endif
-        /* TODO: maybe skip or fix passing @_ to another sub, i.e. warnings::enabled */
-        /* pushmark .. gv(_) rv2av .. entersub. allow my() = @_ */
-
-        /* recursive call */
-	else if (type == OP_GV && OP_TYPE_IS(o->op_next, OP_ENTERSUB)) {
-            GV* gv = cGVOPo_gv;
-            CV *cv = NULL;
-            if (SvTYPE(gv) == SVt_PVGV && (cv = GvCV(gv))
-                && SvTYPE(cv) == SVt_PVCV) {
-                ;
-            } else if (SvROK(gv) && (cv = (CV*)SvRV((SV*)gv))
-                       && SvTYPE(cv) == SVt_PVCV) {
-                ;
             }
-            if (cv && CvSTART(cv) == firstop) {
-                DEBUG_k(Perl_deb(aTHX_ "check_inline: skip recursion\n"));
+            break;
+        case MDEREF_INDEX_padsv:
+            items++;
+            if (items->pad_offset < pad_ix
+                || items->pad_offset >= pad_ix + nargs)
                 return FALSE;
-            }
-	}
+            if (base)
+                items->pad_offset += base - pad_ix;
+            break;
+        default:
+            return FALSE;
+        }
+        if (actions & MDEREF_FLAG_last)
+            return TRUE;
+        actions >>= MDEREF_SHIFT;
     }
+}
+
+/* Check the body expression of an inlinable sub, counting the ops.
+   The root may be a multideref, but no plain param, as the pad temps
+   holding the params are cleared when leaving the inlined body. */
+
+static bool
+S_inline_check_body(pTHX_ const OP *o, CV *cv, PADOFFSET pad_ix,
+                    U8 nargs, bool root, int *count)
+{
+    const OPCODE type = o->op_type;
+    const OP *kid;
+    int nkids;
+
+    PERL_ARGS_ASSERT_INLINE_CHECK_BODY;
+    if (++*count > PERL_MAX_INLINE_OPS)
+        return FALSE;
+    switch (type) {
+    case OP_NULL:
+        /* only the first kid is run, e.g. ex-helem(multideref ex-padsv) */
+        if (!OpKIDS(o) || !(kid = OpFIRST(o)))
+            return FALSE;
+        for (kid = OpSIBLING(kid); kid; kid = OpSIBLING(kid))
+            if (!IS_NULL_OP(kid) || OpKIDS(kid))
+                return FALSE;
+        return inline_check_body(OpFIRST(o), cv, pad_ix, nargs, root, count);
+    case OP_PADSV:
+        return !root
+            && o->op_targ >= pad_ix && o->op_targ < pad_ix + nargs
+            && !(o->op_flags & (OPf_MOD|OPf_REF))
+            && !(o->op_private & (OPpLVAL_INTRO|OPpDEREF|OPpPAD_STATE));
+    case OP_CONST:
+    {
+        const SV * const sv = cSVOPo_sv;
+        return sv && !SvROK(sv) && !SvMAGICAL(sv);
+    }
+    case OP_MULTIDEREF:
+        /* the kids are only the nulled ops of the original derefs */
+        for (kid = OpKIDS(o) ? OpFIRST(o) : NULL; kid; kid = OpSIBLING(kid))
+            if (!IS_NULL_OP(kid) || OpKIDS(kid))
+                return FALSE;
+        return root
+            && !(o->op_flags & (OPf_MOD|OPf_REF))
+            && !(o->op_private & (OPpMULTIDEREF_EXISTS|OPpMULTIDEREF_DELETE
+                                 |OPpLVAL_DEFER|OPpLVAL_INTRO|OPpMAYBE_LVSUB))
+            && inline_mderef(cUNOP_AUXo->op_aux, cv, pad_ix, nargs, 0);
+    default:
+        break;
+    }
+    if (!(PL_opargs[type] & OA_PURE) || !OpKIDS(o)
+        || (o->op_flags & (OPf_STACKED|OPf_MOD|OPf_REF))
+        || ((PL_opargs[type] & OA_TARGLEX) && (o->op_private & OPpTARGET_MY)))
+        return FALSE;
+    switch (PL_opargs[type] & OA_CLASS_MASK) {
+    case OA_UNOP:
+    case OA_BASEOP_OR_UNOP:
+        nkids = 1;
+        break;
+    case OA_BINOP:
+        nkids = 2;
+        break;
+    default:
+        return FALSE;
+    }
+    for (kid = OpFIRST(o); kid; kid = OpSIBLING(kid)) {
+        if (!nkids--
+            || !inline_check_body(kid, cv, pad_ix, nargs, FALSE, count))
+            return FALSE;
+    }
+    return !nkids;
+}
+
+static bool
+S_cv_check_inline(pTHX_ const OP *o, CV *compcv)
+{
+    const UNOP_AUX_item *items;
+    const OP *kid;
+    PADNAME **names;
+    UV params, actions, data;
+    PADOFFSET pad_ix;
+    U8 nargs, i;
+    int count = 0;
+
+    PERL_ARGS_ASSERT_CV_CHECK_INLINE;
+    if (CvLVALUE(compcv) || CvMETHOD(compcv) || CvCLONE(compcv)
+        || CvISXSUB(compcv) || ISNT_TYPE(o, SIGNATURE)
+        || !OP_TYPE_IS(CvROOT(compcv), OP_LEAVESUB))
+        return FALSE;
+
+    /* only mandatory scalar params: padintro, arg..., end */
+    items   = cUNOP_AUXo->op_aux;
+    params  = items[0].uv;
+    actions = items[1].uv;
+    if ((actions & SIGNATURE_MASK) != SIGNATURE_padintro)
+        return FALSE;
+    data   = items[2].uv;
+    pad_ix = data >> OPpPADRANGE_COUNTSHIFT;
+    if (!(data & OPpPADRANGE_COUNTMASK)
+        || (data & OPpPADRANGE_COUNTMASK) > OPpINLINE_ARGSMASK)
+        return FALSE;
+    nargs  = (U8)(data & OPpPADRANGE_COUNTMASK);
+    if (o->op_private & OPpSIGNATURE_FAKE
+        ? params != (nargs | (1 << 15))
+        : params != ((UV)nargs << 16))
+        return FALSE;
+    items += 2;
+    actions >>= SIGNATURE_SHIFT;
+    i = 0;
+    while ((actions & SIGNATURE_MASK) != SIGNATURE_end) {
+        if ((actions & SIGNATURE_MASK) == SIGNATURE_reload)
+            actions = (++items)->uv;
+        else if ((actions & SIGNATURE_MASK) == SIGNATURE_arg) {
+            actions >>= SIGNATURE_SHIFT;
+            i++;
+        }
+        else
+            return FALSE;
+    }
+    if (i != nargs)
+        return FALSE;
+    names = PadlistNAMESARRAY(CvPADLIST(compcv));
+    for (i = 0; i < nargs; i++) {
+        const PADNAME * const pn = names[pad_ix + i];
+        if (!pn || !PadnamePV(pn) || *PadnamePV(pn) != '$'
+            || PadnameTYPE(pn))
+            return FALSE;
+    }
+
+    /* leavesub(lineseq([nextstate] signature nextstate body)) */
+    kid = OpFIRST(CvROOT(compcv));
+    if (!OP_TYPE_IS(kid, OP_LINESEQ) || !OP_TYPE_IS(o->op_next, OP_NEXTSTATE))
+        return FALSE;
+    for (kid = OpFIRST(kid); kid && (IS_TYPE(kid, NEXTSTATE)
+             || (IS_NULL_OP(kid) && kid->op_targ == OP_NEXTSTATE));
+         kid = OpSIBLING(kid))
+        ;
+    if (kid != o || OpSIBLING(kid) != o->op_next
+        || !(kid = OpSIBLING(o->op_next)) || OpHAS_SIBLING(kid))
+        return FALSE;
+    if (IS_TYPE(kid, RETURN)) {
+        kid = OpSIBLING(OpFIRST(kid));
+        if (!kid || OpHAS_SIBLING(kid))
+            return FALSE;
+    }
+    if (!inline_check_body(kid, compcv, pad_ix, nargs, TRUE, &count))
+        return FALSE;
+    DEBUG_k(Perl_deb(aTHX_ "check_inline: %" SVf " is inlinable, %d ops\n",
+                     SVfARG(cv_name(compcv, NULL, CV_NAME_NOMAIN)), count));
     return TRUE;
 }
 #endif
@@ -4687,15 +4825,7 @@ S_finalize_op(pTHX_ OP* o)
                  * (which is a list op. So pretend it wasn't a listop */
                 if (type == OP_GLOB)
                     type = OP_NULL;
-#ifdef PERL_INLINE_SUBS
-                else if (type == OP_FREED)
-                    return; /* do not follow null'ed freed kids. yes it lives and it follows */
-#endif
             }
-#ifdef PERL_INLINE_SUBS
-            else if (type == OP_FREED)
-                return; /* freed kids neither (the ops between gv and entersub) */
-#endif
 
             family = PL_opargs[type] & OA_CLASS_MASK;
 
@@ -11730,373 +11860,236 @@ Perl_op_clone_optree(pTHX_ OP* o, bool init) {
 
 #ifdef PERL_INLINE_SUBS
 
-/* clones the underlying data, not the op.
- * TODO: finish
- */
-static OP*
-S_op_clone_sv(pTHX_ OP* o) {
+/* Clone an op of a checked inlinable sub body into the caller.
+   Nulls are skipped, the params are moved to the pad temps at base,
+   and targets are allocated in the caller pad. The exec order is
+   linked via *nextp. */
+
+static OP *
+S_inline_clone(pTHX_ const OP *o, CV *cv, PADOFFSET pad_ix, U8 nargs,
+               PADOFFSET base, OP ***nextp)
+{
     const OPCODE type = o->op_type;
-    PERL_ARGS_ASSERT_OP_CLONE_SV;
+    OP *clone;
+
+    PERL_ARGS_ASSERT_INLINE_CLONE;
+    if (type == OP_NULL)
+        return inline_clone(OpFIRST(o), cv, pad_ix, nargs, base, nextp);
+
     switch (type) {
-    case OP_GV:
-    case OP_GVSV:
-        cSVOPo->op_sv = sv_mortalcopy(cSVOPo->op_sv); break;
-    case OP_PADSV: /* allow new pad or convert to gv? */
-        /*assert(0 && !"op_clone_sv pad");*/
-    default:
-        /*assert(0 && !"op_clone_sv");*/
+    case OP_PADSV:
+        NewOp(1101, clone, 1, OP);
+        clone->op_targ = base + (o->op_targ - pad_ix);
+        break;
+    case OP_CONST:
+    {
+        SVOP *svop;
+        NewOp(1101, svop, 1, SVOP);
+        /* with threads the const is moved to the pad by finalize_op */
+        svop->op_sv = SvREFCNT_inc_NN(cSVOPx(o)->op_sv
+            ? cSVOPx(o)->op_sv
+            : PadARRAY(PadlistARRAY(CvPADLIST(cv))[1])[o->op_targ]);
+        clone = (OP*)svop;
         break;
     }
-    return o;
+    case OP_MULTIDEREF:
+    {
+        const UNOP_AUX_item * const items = cUNOP_AUXx(o)->op_aux;
+        const UV size = items[-1].uv;
+        UNOP_AUX_item *aux = (UNOP_AUX_item*)PerlMemShared_malloc(
+                                 sizeof(UNOP_AUX_item) * (size + 1));
+        UNOP_AUX *aop;
+        Copy(items - 1, aux, size + 1, UNOP_AUX_item);
+        NewOp(1101, aop, 1, UNOP_AUX);
+        aop->op_aux = aux + 1;
+        inline_mderef(aop->op_aux, cv, pad_ix, nargs, base);
+        clone = (OP*)aop;
+        break;
+    }
+    default:
+    {
+        const OP *okid;
+        OP *kid, *prev = NULL;
+        if ((PL_opargs[type] & OA_CLASS_MASK) == OA_BINOP) {
+            BINOP *binop;
+            NewOp(1101, binop, 1, BINOP);
+            clone = (OP*)binop;
+        }
+        else {
+            UNOP *unop;
+            NewOp(1101, unop, 1, UNOP);
+            clone = (OP*)unop;
+        }
+        if (o->op_targ)
+            clone->op_targ = pad_alloc(type, SVs_PADTMP);
+        for (okid = OpFIRST(o); okid; okid = OpSIBLING(okid)) {
+            kid = inline_clone(okid, cv, pad_ix, nargs, base, nextp);
+            if (prev)
+                OpMORESIB_set(prev, kid);
+            else
+                cUNOPx(clone)->op_first = kid;
+            prev = kid;
+        }
+        OpLASTSIB_set(prev, clone);
+        if ((PL_opargs[type] & OA_CLASS_MASK) == OA_BINOP)
+            cBINOPx(clone)->op_last = prev;
+    }
+    }
+    OpTYPE_set(clone, type);
+    clone->op_flags       = o->op_flags;
+    clone->op_private     = o->op_private;
+    clone->op_rettype     = o->op_rettype;
+    clone->op_typechecked = o->op_typechecked;
+    clone->op_folded      = o->op_folded;
+    if (type == OP_MULTIDEREF)
+        clone->op_flags &= ~OPf_KIDS; /* the nulled kids are not cloned */
+    **nextp = clone;
+    *nextp  = &clone->op_next;
+    return clone;
 }
 
 /*
 =for apidoc cv_do_inline
 
-Needs to translate the args to local pads.
-  o:    entersub
-  cvop: leavesub
-Splice inlined leavesub block, replacing pushmark .. entersub.
-METHOD should not arrive here, neither $obj->method.
+Called by rpeep for an entersub op C<o>, after its gv op C<oldop>.
+If the called sub is inlinable (see L</cv_check_inline>), and the call
+has no C<no inline> in effect, splice a guarded copy of its body into
+the caller:
 
-handle args: shift, = @_ or just accept SIGNATURED subs with PERL_FAKE_SIGNATURE.
-with a OP_SIGNATURE it is easier. without need to populate @_.
-if arg is call-by-value make a copy.
-adjust or add targs,
-with local or eval{} or caller, entersub,  ... need to add ENTER/LEAVE,
-skip ENTER/LEAVE if certain ops are absent.
+    enterinline[base, nargs] -> body -> leaveinline -> next
+        entersub                (op_other, the original call)
+        const                   (padlist id of the inlined sub)
+        inlined body
+        leaveinline
 
-$lhs = call(...); => $lhs = do {...inlined...};
+At run-time C<enterinline> checks that the sub is still the inlined one
+and that the args are plain values, copies them into the pad temps at
+base, and runs the body with C<PL_curcop> set to the cop of the sub, so
+that warnings and errors report the same lines as a normal call.
+Otherwise the original entersub is called.
+
+Returns the new C<enterinline> op or NULL.
 
-Converted to a simplier ck step, without linked op_next ptrs. Not in rpeep anymore.
-Only activated with PERL_INLINE_SUBS
 =cut
 */
 
-static OP*
-S_cv_do_inline(pTHX_ OP* parent, OP *o, OP *cvop, CV *cv)
-{
-    OP *subop = (OP*)o;
-    OP *firstop, *o2, *arg;
-    OP *list = NULL;
-    int args = 0;
-    int i, j;
-    OP* inargs[6];
-    bool with_enter_leave = FALSE;
-    bool optim_args = TRUE;
-    bool is_method = CvMETHOD(cv);
-    PERL_ARGS_ASSERT_CV_DO_INLINE;
-    PERL_UNUSED_ARG(parent); /* later for splice, loops */
-    assert(IS_TYPE(o, ENTERSUB));
+static OP *
+S_cv_do_inline(pTHX_ OP *o, OP *oldop)
+{
+    OP *cvop, *gvop, *kid, *parent, *prev, *body, *enter, *leave, *idop;
+    OP **nextp;
+    LOGOP *logop;
+    const OP *cop = NULL;
+    SV *sv;
+    CV *cv;
+    PADNAME **names;
+    UV data;
+    PADOFFSET pad_ix, base = 0;
+    U8 nargs, i;
 
-    DEBUG_k(Perl_deb(aTHX_ "inline %s %" SVf "\n",
-                     is_method ? "method" : "sub",
-                     SVfARG(cv_name(cv,NULL,CV_NAME_NOMAIN))));
-    /* handle optional args:
-          pushmark args* gv null* entersub body leavesub NULL
-       => pushmark gv rv2av args* push enter? body leave?
-       TODO: dependent on the body the push args list can be optimized away.
-    */
-    arg = OpFIRST(o);
-    if (!OpHAS_SIBLING(arg))
-	arg = OpFIRST(arg);
-    arg = OpSIBLING(arg);
-    if (OP_TYPE_IS_OR_WAS(arg, OP_RV2CV))
-        arg = OpSIBLING(arg);
-    if (arg) { /* has args */
-        OP *defav;
-        /* @_ in pad or global. @_ is at PAD_SVl(0) in a sub */
-        const PADOFFSET offset = pad_findmy_pvs("@_", 0);
-        if (offset == NOT_IN_PAD || PAD_COMPNAME_FLAGS_isOUR(offset)) {
-            if (!GvAV(PL_defgv)) gv_AVadd(PL_defgv);
-            o = newGVOP(OP_GV, OPf_WANT_SCALAR, PL_defgv);
-            defav = newUNOP(OP_RV2AV, OPf_MOD|OPf_REF|OPf_KIDS|OPf_WANT_LIST, o);
-            /*defav->op_targ = 0;*/
-        }
-        else {
-            defav = newOP(OP_PADAV, 0);
-            defav->op_targ = offset;
-            OpMORESIB_set(defav, arg);
-        }
-        o = arg;
-        inargs[args] = o;
-        args++;
-        o2 = o;
-        for (o = OpSIBLING(arg); o && OpHAS_SIBLING(o); o = OpSIBLING(o)) {
-            if (args > 5) {
-                CvINLINABLE_off(cv); /* do not try again */
-                DEBUG_k(Perl_deb(aTHX_ "skip inlining sub, too many args\n"));
-                return NULL;
-            }
-            inargs[args] = o;
-            args++;
-            o2 = o;
-            /*o->op_flags &= ~OPf_MOD;*/ /* warn about it? convert to call-by-ref? */
-        }
-        /* TODO if args == 1 or 2 try to optimize it directly into the cv */
-        list = newLISTOP(OP_LIST, 0, defav, o2);
-        /*op_null(o->op_next);*/  /* the gv */
-        OpLASTSIB_set(subop, list); /* the last arg */
-        list = op_convert_list(OP_PUSH, 0, list);
-        /*OpLASTSIB_set(o2, list);*/ /* link list parent */
-        /*o->op_next = list;*/
-        cvop->op_flags &= ~OPf_KIDS; /* keep em */
-        op_null(cvop);
-#if 0
-        o = OpFIRST(list);
-        OpMORESIB_set(o, defav);
-        if (IS_TYPE(defav, RV2AV)) {
-            /*o->op_next = OpFIRST(defav);*/
-            OpLASTSIB_set(OpFIRST(defav), defav);
-            OpLAST(list) = OpSIBLING(defav);
-            OpLASTSIB_set(OpSIBLING(defav), list);
-        /*} else {
-              firstop->op_next = defav;*/
-        }
-#endif
-        finalize_op(list); /* wrong parent */
-        /*o->op_next = list;*/
-    }
-    /* splice and fixup body, handle nextstate, skip and free the gv. */
-    /* we need to clone the optree, as we most likely change the state and args.
-       Note: cv_clone is useless for us. It clones the pad, but not
-       the ops. We need to keep the pads, but clone the ops. */
-    o = op_clone_optree(CvROOT(cv), TRUE);
-    if (!o || !OpKIDS(o))
+    PERL_ARGS_ASSERT_CV_DO_INLINE;
+    if (PL_perldb || !OpSTACKED(o)
+        || (o->op_private & (OPpENTERSUB_DB|OPpDEREF))
+        || (o->op_private & OPpENTERSUB_LVAL_MASK) == OPpLVAL_INTRO)
         return NULL;
-    firstop = o; /* that's the LEAVESUB, will be converted into a LEAVE or skipped */
-    assert(IS_TYPE(firstop, LEAVESUB));
-    /* scan the new body - to be inlined - if enter/leave is needed,
-     * if it's too large, and convert all nextstate to setstate+keepstate's.
-     * forgot about the seen_logop.
-     */
-    for (i=0, j=0, o=OpFIRST(o); o; o = OpKIDS(o) ? OpFIRST(o) : OpSIBLING(o)) {
-        bool seen_logop = FALSE;
-        OP *prev;
-        const OPCODE type = o->op_type;
-        i++;
-        if (i > PERL_MAX_INLINE_OPS) {
-            OP* tmp;
-            CvINLINABLE_off(cv);      /* do not try again */
-            for (tmp=o; tmp; o=tmp) { /* free the clones */
-                tmp = o->op_next; op_free(o);
-            }
-            DEBUG_k(Perl_deb(aTHX_ "inline: skip inlining sub, too large body\n"));
-            return NULL;
-        }
-        /* ctl ops need a block */
-        if (IS_SUB_TYPE(type)
-            || type == OP_UNSTACK
-            || type >= OP_ENTER
-            || (type >= OP_CALLER && type <= OP_RESET)
-            || (type >= OP_SORT && type <= OP_FLOP))
-            with_enter_leave = TRUE;
-        /* nextstate resets SP to the level of upper block.
-           Since the inlines call maybe a rhs, the SP is different. So we
-           need to save and restore it seperately. */
-        if (type == OP_NEXTSTATE) {
-            static bool firststate = TRUE;
-            if (firststate) {
-                /* record the SP in curcop, ignore blk.oldsp */
-                OpTYPE_set(o, OP_SETSTATE);
-                firststate = FALSE;
-            } else {
-                /* reset SP from curcop, not blk.oldsp */
-                OpTYPE_set(o, OP_KEEPSTATE);
-            }
-        }
-        if (OP_IS_LOGOP(o->op_type))
-            seen_logop = TRUE;
-#if 0
-        /* XXX move to the end of the tree traversal.
-           i.e. firstop
-         */
-        if (OP_TYPE_IS(o->op_next, OP_LEAVESUB)) {
-            if (with_enter_leave) {
-                OP *kid;
-                o = o->op_next;
-                OpTYPE_set(o, OP_LEAVE);
-                /* keep the LEAVESUB context op_flags: OPf_SPECIAL|OPf_WANT */
-                o->op_private &= ~OPpARG1_MASK; /* keep OPpREFCOUNTED */
-                o->op_private |= OPpLEAVE_SP;  /* keep SP */
-                /* TODO: set OpLAST */
-                for (kid = OpFIRST(o); kid; kid = OpSIBLING(kid)) {
-                    if (!OpHAS_SIBLING(kid)) {
-                        OpLAST(o) = kid;
-                        kid->op_sibparent = o;
-                        break;
-                    }
-                }
-            } else {
-                OpFIRST(o) = NULL;
-                o->op_next->op_flags &= ~OPf_KIDS; /* keep em */
-                op_free(o->op_next);
-            }
-            o->op_next = cvop->op_next;
-            break;
-        }
-#endif
 
-        /* TODO: Maybe cache this processed inlined variant in CvINLINE_CACHE(cv),
-         * because such a cv is most likely inlined in multiple places.
-         * But then we also need to store the following array of arg fixups.
-         * And this is dependent of the number of caller args.
-         */
+    /* entersub(ex-list(pushmark args... ex-rv2cv(gv))) */
+    cvop = OpFIRST(o);
+    if (!OpHAS_SIBLING(cvop))
+        cvop = OpFIRST(cvop);
+    while (OpHAS_SIBLING(cvop))
+        cvop = OpSIBLING(cvop);
+    if (!IS_NULL_OP(cvop) || cvop->op_targ != OP_RV2CV
+        || !(gvop = OpFIRST(cvop)) || gvop != oldop || ISNT_TYPE(gvop, GV))
+        return NULL;
+    sv = (SV*)cGVOPx_gv(gvop);
+    if (isGV_with_GP(sv))
+        cv = GvCVu((GV*)sv);
+    else if (SvROK(sv) && SvTYPE(SvRV(sv)) == SVt_PVCV)
+        cv = (CV*)SvRV(sv);
+    else
+        cv = NULL;
+    if (!cv || !CvINLINABLE(cv) || CvISXSUB(cv) || !CvROOT(cv)
+        || cv == PL_compcv)
+        return NULL;
 
-        /* Try to splice in the args directly */
-        if (OpHAS_SIBLING(o) && args > 0 && args <= 6) {
-            const OPCODE type = OpTYPE(OpSIBLING(o));
-            prev = o;
-            o = OpSIBLING(o);
+    /* the hints of the statement: no inline */
+    for (kid = o; !cop && (parent = op_parent(kid)); kid = parent) {
+        for (prev = OpFIRST(parent); prev && prev != kid;
+             prev = OpSIBLING(prev))
+            if (IS_TYPE(prev, NEXTSTATE) || IS_TYPE(prev, DBSTATE))
+                cop = prev;
+    }
+    if (!cop || cop_hints_fetch_pvs((const COP*)cop, "inline",
+                                    REFCOUNTED_HE_EXISTS)) {
+        DEBUG_k(Perl_deb(aTHX_ "rpeep: skip inline sub %" SVf "\n",
+                         SVfARG(cv_name(cv, NULL, CV_NAME_NOMAIN))));
+        return NULL;
+    }
 
-            if (!optim_args) {
-                DEBUG_kv(Perl_deb(aTHX_ "inline: skip optim_args\n"));
-            }
-            else if (type == OP_GV && strEQ(GvNAME(cGVOPo_gv), "_")) {
-                /* see PERL_FAKE_SIGNATURE assign */
-                /* my () = @_ */
-                optim_args = FALSE;
-                DEBUG_kv(Perl_deb(aTHX_ "inline: TODO copy @_\n"));
-            }
-            else if (OpSPECIAL(o) && type == OP_SHIFT) {
-                if (seen_logop || j >= args) {
-                    optim_args = FALSE;
-                    o = prev;
-                    DEBUG_k(Perl_deb(aTHX_ "inline: skip optim_args, logop seen before %d of %d arg\n",
-                                j, args));
-                    continue;
-                }
-                DEBUG_k(Perl_deb(aTHX_ "inline: optimize shift => %d arg by %s\n", j,
-                            (o->op_flags & OPf_MOD && ISNT_TYPE(o, CONST))
-                             ? "ref":"value"));
-                /* do not copy a literal (const) arg */
-                o = (o->op_flags & OPf_MOD && ISNT_TYPE(o, CONST))
-                    ? op_clone_sv(inargs[j++]) : inargs[j++];
-                o->op_next = prev->op_next->op_next;
-                prev->op_next = o;
-            }
-            else if (OpSPECIAL(o) && type == OP_POP) {
-                int ix = args - j;
-                if (seen_logop || j >= args) {
-                    optim_args = FALSE;
-                    o = prev;
-                    DEBUG_k(Perl_deb(aTHX_
-                        "inline: skip optim_args, logop seen before %d of %d arg\n",
-                                ix, args));
-                    continue;
-                }
-                DEBUG_k(Perl_deb(aTHX_
-                    "inline: optimize pop => %d arg by %s\n",
-                     ix, (o->op_flags & OPf_MOD && o->op_type != OP_CONST)
-                                 ? "ref":"value"));
-                o = (o->op_flags & OPf_MOD && ISNT_TYPE(o, CONST))
-                    ? op_clone_sv(inargs[ix]) : inargs[ix];
-                o->op_next = prev->op_next->op_next;
-                prev->op_next = o;
-                args--;
-            }
-            else if (type == OP_AELEMFAST && strEQ(GvNAME(cGVOPo_gv), "_")) {
-                int ix = (U8)o->op_private;
-                if (ix < 0 || ix >= args) {
-                    optim_args = FALSE;
-                    o = prev;
-                    DEBUG_k(Perl_deb(aTHX_
-                        "inline: skip optim_args, invalid %d of %d arg\n", ix, args));
-                    continue;
-                }
-                assert(ix >= 0 && ix < args);
-                DEBUG_k(Perl_deb(aTHX_ "inline: optimize $_[%d] arg by ref\n", ix));
-                o = inargs[ix];
-                o->op_next = prev->op_next->op_next;
-                prev->op_next = o;
-            }
-            else if (type == OP_MULTIDEREF) {
-                UNOP_AUX_item *items = cUNOP_AUXo->op_aux;
-                UV actions = items->uv;
-                items++;
-                if ((actions & MDEREF_ACTION_MASK) == MDEREF_AV_gvav_aelem) {
-                    GV *gv = (GV*)UNOP_AUX_item_sv(items);
-                    if (GvNAMELEN(gv) == 1 && *GvNAME(gv) == '_') {
-                        /* oops, which index? */
-                        int ix = 0;
-                        optim_args = FALSE;
-                        assert(ix >= 0 && ix < args);
-                        DEBUG_kv(Perl_deb(aTHX_ "rpeep: *_[??] arg by ref\n"));
-                        if (0) {
-                            o = inargs[ix];
-                            o->op_next = prev->op_next->op_next;
-                            prev->op_next = o;
-                        }
-                    }
-                }
-                else if ((actions & MDEREF_ACTION_MASK) == MDEREF_AV_padav_aelem) {
-                    PADOFFSET off = items->pad_offset;
-                    PADLIST * const padlist = CvPADLIST(cv);
-                    PADNAME * pad = padnamelist_fetch(PadlistNAMES(padlist), off);
-                    if (PadnameLEN(pad) == 1 && *PadnamePV(pad) == '_') {
-                        /* oops, which index? */
-                        int ix = 0;
-                        optim_args = FALSE;
-                        assert(ix >= 0 && ix < args);
-                        DEBUG_kv(Perl_deb(aTHX_ "inline: $_[??] arg by ref\n"));
-                        if (0) {
-                            o = inargs[ix];
-                            o->op_next = prev->op_next->op_next;
-                            prev->op_next = o;
-                        }
-                    }
-                }
-            }
-            o = prev;
-        } else {
-            optim_args = FALSE;
+    /* the params, see cv_check_inline */
+    data   = cUNOP_AUXx(CvSTART(cv))->op_aux[2].uv;
+    pad_ix = data >> OPpPADRANGE_COUNTSHIFT;
+    nargs  = (U8)(data & OPpPADRANGE_COUNTMASK);
+    body   = OpLAST(OpFIRST(CvROOT(cv)));
+    if (IS_TYPE(body, RETURN))
+        body = OpSIBLING(OpFIRST(body));
+
+    /* new named pad temps for the params, and one for the saved cop */
+    names = PadlistNAMESARRAY(CvPADLIST(cv));
+    for (i = 0; i <= nargs; i++) {
+        const PADOFFSET ix = pad_alloc(OP_ENTERINLINE, SVs_PADMY);
+        if (!i)
+            base = ix;
+        assert(ix == base + i);
+        if (i < nargs) {
+            const PADNAME * const pn = names[pad_ix + i];
+            PADNAME * const name = newPADNAMEpvn_flags(PadnamePV(pn),
+                PadnameLEN(pn), PadnameUTF8(pn) ? SVf_UTF8 : 0);
+            padnamelist_store(PL_comppad_name, ix, name);
+            PadnamelistMAXNAMED(PL_comppad_name) = ix;
         }
+        else
+            SvPADTMP_on(PAD_SVl(ix));
     }
 
-    /*CvSTART(cv) = LINKLIST(firstop);
-      CvROOT(cv) = firstop;*/
-    if (!o)
-        return firstop;
-    if (!o->op_next || !with_enter_leave ) { /* LEAVESUB without ENTER */
-        o->op_next = cvop->op_next;     /* skip and free entersub */
-        cvop->op_flags &= ~OPf_KIDS;    /* keep em */
-        op_null(cvop);
-        if (optim_args) { /* omit the push list */
-            /* leak the list. we would need to free the push and pushmark,
-               and all copied sv's */
-            firstop = CvSTART(cv);
-        } else if (!list) {
-            assert(!args);
-            firstop->op_next = CvSTART(cv);
-        } else {
-            assert(args);
-            list->op_next = CvSTART(cv);
-        }
-    } else if (with_enter_leave) {
-        OP *o = cvop;     /* convert the entersub to enter */
-        if (optim_args) { /* omit the push list */
-            firstop = o;
-        } else if (list) {
-            assert(args);
-            list->op_next = o;
-        } else {
-            assert(!args);
-            firstop->op_next = o;
-        }
-        OpTYPE_set(o, OP_ENTER);
-        OpFIRST(o) = NULL;
-        o->op_flags = o->op_private = 0;
-        o->op_next = CvSTART(cv);
-        OpMORESIB_set(o, o->op_next);
-    } else { /* no leavesub or cvop->op_next == NULL */
-        assert(0 && !"no leavesub or cvop->op_next == NULL");
-    }
-    DEBUG_kv(Perl_deb(aTHX_ "done inline %s %" SVf
-                      ". args: %d, body: %d, with enter/leave: %d\n",
-                      is_method ? "method" : "sub",
-                      SVfARG(cv_name(cv,NULL,CV_NAME_NOMAIN)),
-                      args, i, with_enter_leave));
-    return firstop;
+    NewOp(1101, logop, 1, LOGOP);
+    enter = (OP*)logop;
+    OpTYPE_set(enter, OP_ENTERINLINE);
+    enter->op_flags   = OPf_KIDS | (o->op_flags & OPf_WANT);
+    enter->op_private = nargs;
+    enter->op_targ    = base;
+    NewOp(1101, leave, 1, OP);
+    OpTYPE_set(leave, OP_LEAVEINLINE);
+    leave->op_flags   = o->op_flags & OPf_WANT;
+    leave->op_private = nargs
+        | (o->op_private & OPpENTERSUB_INARGS ? OPpINLINE_INARGS : 0);
+    leave->op_targ    = base;
+    idop = newSVOP(OP_CONST, 0, newSVuv(CvPADLIST(cv)->xpadl_id));
+    idop->op_next = NULL;
+    idop->op_opt  = 1;
+
+    nextp = &enter->op_next;
+    body  = inline_clone(body, cv, pad_ix, nargs, base, &nextp);
+    *nextp = leave;
+    leave->op_next = o->op_next;
+    cLOGOPx(enter)->op_other = o;
+    gvop->op_next = enter;
+
+    /* replace the entersub by enterinline(entersub const body leave) */
+    parent = op_parent(o);
+    for (prev = NULL, kid = OpFIRST(parent); kid != o; kid = OpSIBLING(kid))
+        prev = kid;
+    op_sibling_splice(parent, prev, 1, enter);
+    cLOGOPx(enter)->op_first = o;
+    OpMORESIB_set(o, idop);
+    OpMORESIB_set(idop, body);
+    OpMORESIB_set(body, leave);
+    OpLASTSIB_set(leave, enter);
+
+    DEBUG_kv(Perl_deb(aTHX_ "rpeep: inline sub %" SVf ", %d args\n",
+                      SVfARG(cv_name(cv, NULL, CV_NAME_NOMAIN)), (int)nargs));
+    return enter;
 }
 
 #endif
@@ -18402,9 +18395,6 @@ OP *
 Perl_ck_subr(pTHX_ OP *o)
 {
     OP *aop, *cvop;
-#ifdef PERL_INLINE_SUBS
-    OP *pushm;
-#endif
     CV *cv;
     GV *namegv;
     SV **const_class = NULL;
@@ -18414,9 +18404,6 @@ Perl_ck_subr(pTHX_ OP *o)
     aop = OpFIRST(o);
     if (!OpHAS_SIBLING(aop))
 	aop = OpFIRST(aop);
-#ifdef PERL_INLINE_SUBS
-    pushm = aop;
-#endif
     aop = OpSIBLING(aop);
     for (cvop = aop; OpHAS_SIBLING(cvop); cvop = OpSIBLING(cvop)) {
         if (UNLIKELY(IS_TYPE(cvop, HSLICE) || IS_TYPE(cvop, KVHSLICE))) {
@@ -18579,18 +18566,6 @@ Perl_ck_subr(pTHX_ OP *o)
         else if (!CvROOT(cv))
 	    S_entersub_alloc_targ(aTHX_ o);
 
-#ifdef PERL_INLINE_SUBS
-        if (CvINLINABLE(cv) && IS_TYPE(pushm, PUSHMARK)) {
-            if (cop_hints_fetch_pvs(PL_curcop, "inline",
-                                    REFCOUNTED_HE_EXISTS)) {
-                DEBUG_k(Perl_deb(aTHX_
-                    "ck_subr: skip inline sub %" SVf ", no inline\n",
-                    SVfARG(cv_name(cv,NULL,CV_NAME_NOMAIN))));
-            } else {
-                cv_do_inline(NULL, o, cvop, cv);
-            }
-        }
-#endif
 
 	if (!namegv) {
 	    /* The original call checker API guarantees that a GV will be
@@ -22244,6 +22219,25 @@ Perl_rpeep(pTHX_ OP *o)
                 o->op_private &=
                         ~(OPpASSIGN_COMMON_SCALAR|OPpASSIGN_COMMON_RC1);
 
+            /* @lex = unpack(...) in void context. Let unpack store the
+               values into the array directly and skip the rest, when it
+               can. See S_unpack_assign in pp_pack.c */
+            if (OpWANT_VOID(o) && !OpSPECIAL(o)
+                && OpKIDS(OpFIRST(o)) && OpKIDS(OpLAST(o))) {
+                OP * const unpack = OpSIBLING(OpFIRST(OpFIRST(o)));
+                OP * const lpush = OpFIRST(OpLAST(o));
+                OP * const padav = OpSIBLING(lpush);
+                if (unpack && IS_TYPE(unpack, UNPACK)
+                    && IS_TYPE(lpush, PUSHMARK)
+                    && !OpHAS_SIBLING(unpack)
+                    && padav && IS_TYPE(padav, PADAV)
+                    && !OpHAS_SIBLING(padav)
+                    && OpNEXT(unpack) == lpush && OpNEXT(lpush) == padav
+                    && OpNEXT(padav) == o
+                    && !(padav->op_private & OPpPAD_STATE))
+                    unpack->op_private |= OPpUNPACK_ASSIGN;
+            }
+
             if (OpWANT_SCALAR(o))
                 S_check_for_bool_cxt(o, 1, OPpASSIGN_TRUEBOOL, 0);
 	    break;
@@ -22286,6 +22280,20 @@ Perl_rpeep(pTHX_ OP *o)
                 S_check_for_bool_cxt(o, 1, OPpTRUEBOOL, 0);
             break;
 
+#ifdef PERL_INLINE_SUBS
+        case OP_ENTERSUB:
+            /* gv -> enterinline -> inlined body -> leaveinline,
+               with the entersub as fallback. Continue with the body. */
+            if (oldop) {
+                OP * const enter = cv_do_inline(o, oldop);
+                if (enter) {
+                    o = enter;
+                    goto redo;
+                }
+            }
+            break;
+#endif
+
 	case OP_CUSTOM: {
 	    Perl_cpeep_t cpeep = 
 		XopENTRYCUSTOM(o, xop_peep);
@@ -23719,6 +23727,7 @@ Perl_class_role_finalize(pTHX_ OP* o)
     fields = HvFIELDS_get(stash);
     if (!fields) {
         SvREADONLY_on(stash);
+        hv_study(stash);
         PL_parser->in_class = FALSE;
         return;
     }
@@ -23818,6 +23827,7 @@ Perl_class_role_finalize(pTHX_ OP* o)
     }
     DEBUG_Xv(pnl_dump(PL_comppad_name));
     SvREADONLY_on(stash);
+    hv_study(stash); /* closed: add the perfect hash index */
     PL_parser->in_class = FALSE;
 }
 
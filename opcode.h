@@ -368,8 +368,8 @@ EXTCONST char* const PL_op_name[] = {
 	"reset",	/* 212: symbol reset */
 	"lineseq",	/* 213: line sequence */
 	"nextstate",	/* 214: next statement */
-	"setstate",	/* 215: first inlined statement */
-	"keepstate",	/* 216: inlined statement */
+	"enterinline",	/* 215: inlined subroutine entry */
+	"leaveinline",	/* 216: inlined subroutine exit */
 	"dbstate",	/* 217: debug next statement */
 	"unstack",	/* 218: iteration finalizer */
 	"enter",	/* 219: block entry */
@@ -791,8 +791,8 @@ EXTCONST char* const PL_op_desc[] = {
 	"symbol reset",	/* 212: reset */
 	"line sequence",	/* 213: lineseq */
 	"next statement",	/* 214: nextstate */
-	"first inlined statement",	/* 215: setstate */
-	"inlined statement",	/* 216: keepstate */
+	"inlined subroutine entry",	/* 215: enterinline */
+	"inlined subroutine exit",	/* 216: leaveinline */
 	"debug next statement",	/* 217: dbstate */
 	"iteration finalizer",	/* 218: unstack */
 	"block entry",	/* 219: enter */
@@ -1213,8 +1213,8 @@ PL_op_type_str[] = {
 	"",	/* 212: reset */
 	"():Void",	/* 213: lineseq */
 	"():Void",	/* 214: nextstate */
-	"():Void",	/* 215: setstate */
-	"():Void",	/* 216: keepstate */
+	"",	/* 215: enterinline */
+	"",	/* 216: leaveinline */
 	"():Void",	/* 217: dbstate */
 	"():Void",	/* 218: unstack */
 	"",	/* 219: enter */
@@ -1642,8 +1642,8 @@ EXTCONST U32 PL_op_type[] = {
 	0xffffff00,	/* 212: reset "" */
 	0xffffffff,	/* 213: lineseq "():Void" */
 	0xffffffff,	/* 214: nextstate "():Void" */
-	0xffffffff,	/* 215: setstate "():Void" */
-	0xffffffff,	/* 216: keepstate "():Void" */
+	0xffffff00,	/* 215: enterinline "" */
+	0xffffff00,	/* 216: leaveinline "" */
 	0xffffffff,	/* 217: dbstate "():Void" */
 	0xffffffff,	/* 218: unstack "():Void" */
 	0xffffff00,	/* 219: enter "" */
@@ -2072,8 +2072,8 @@ EXTCONST signed char PL_op_type_variants[][8] = {
 	/* 212 reset            */ {0},	/*  */
 	/* 213 lineseq          */ {0},	/*  */
 	/* 214 nextstate        */ {0},	/*  */
-	/* 215 setstate         */ {0},	/*  */
-	/* 216 keepstate        */ {0},	/*  */
+	/* 215 enterinline      */ {0},	/*  */
+	/* 216 leaveinline      */ {0},	/*  */
 	/* 217 dbstate          */ {0},	/*  */
 	/* 218 unstack          */ {0},	/*  */
 	/* 219 enter            */ {0},	/*  */
@@ -2529,8 +2529,8 @@ EXT Perl_ppaddr_t PL_ppaddr[] /* or perlvars.h */
 	Perl_pp_reset,
 	Perl_pp_lineseq,	/* implemented by Perl_pp_null */
 	Perl_pp_nextstate,
-	Perl_pp_setstate,
-	Perl_pp_keepstate,
+	Perl_pp_enterinline,
+	Perl_pp_leaveinline,
 	Perl_pp_dbstate,
 	Perl_pp_unstack,
 	Perl_pp_enter,
@@ -2960,8 +2960,8 @@ EXT Perl_check_t PL_check[] /* or perlvars.h */
 	Perl_ck_fun,		/* reset */
 	Perl_ck_null,		/* lineseq */
 	Perl_ck_null,		/* nextstate */
-	Perl_ck_null,		/* setstate */
-	Perl_ck_null,		/* keepstate */
+	Perl_ck_null,		/* enterinline */
+	Perl_ck_null,		/* leaveinline */
 	Perl_ck_null,		/* dbstate */
 	Perl_ck_null,		/* unstack */
 	Perl_ck_null,		/* enter */
@@ -3387,8 +3387,8 @@ EXTCONST U32 PL_opargs[] = {
 	0x00026804,	/* reset */
 	0x00001100,	/* lineseq */
 	0x00002404,	/* nextstate */
-	0x00002404,	/* setstate */
-	0x00002404,	/* keepstate */
+	0x00000c40,	/* enterinline */
+	0x00000000,	/* leaveinline */
 	0x00002404,	/* dbstate */
 	0x00000004,	/* unstack */
 	0x00000000,	/* enter */
@@ -3658,6 +3658,7 @@ END_EXTERN_C
 #define OPpSTACKCOPY            0x10
 #define OPpSUBSTR_REPL_FIRST    0x10
 #define OPpTARGET_MY            0x10
+#define OPpUNPACK_ASSIGN        0x10
 #define OPpASSIGN_COMMON_RC1    0x20
 #define OPpASSIGN_CONSTINIT     0x20
 #define OPpDEREF_HV             0x20
@@ -3701,10 +3702,12 @@ END_EXTERN_C
 #define OPpSLICE                0x40
 #define OPpSORT_STABLE          0x40
 #define OPpTRANS_GROWS          0x40
+#define OPpINLINE_ARGSMASK      0x7f
 #define OPpPADRANGE_COUNTMASK   0x7f
 #define OPpASSIGN_CV_TO_GV      0x80
 #define OPpCOREARGS_PUSHMARK    0x80
 #define OPpENTERSUB_NOPAREN     0x80
+#define OPpINLINE_INARGS        0x80
 #define OPpLVALUE               0x80
 #define OPpLVAL_INTRO           0x80
 #define OPpOFFBYONE             0x80
@@ -3838,6 +3841,7 @@ EXTCONST char PL_op_private_labels[] = {
     'U','N','S','T','A','B','L','E','\0',
     'U','T','F','\0',
     'W','A','S','M','E','T','H','O','D','\0',
+    'a','r','g','s','\0',
     'k','e','y','\0',
     'o','f','f','s','e','t','\0',
     'r','a','n','g','e','\0',
@@ -3859,11 +3863,12 @@ EXTCONST char PL_op_private_labels[] = {
 EXTCONST I16 PL_op_private_bitfields[] = {
     0, 8, -1,
     0, 8, -1,
-    0, 646, -1,
+    0, 651, -1,
     0, 8, -1,
     0, 8, -1,
-    0, 653, -1,
     0, 642, -1,
+    0, 658, -1,
+    0, 647, -1,
     4, -1, 1, 186, 2, 193, 3, 200, -1,
     4, -1, 0, 600, 1, 40, 2, 328, 3, 132, -1,
 
@@ -4042,11 +4047,11 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
      150, /* hslice */
      154, /* kvhslice */
      156, /* multideref */
-      89, /* unpack */
+     163, /* unpack */
       89, /* pack */
-     163, /* split */
+     165, /* split */
       89, /* join */
-     168, /* list */
+     170, /* list */
       13, /* lslice */
       89, /* anonlist */
       89, /* anonhash */
@@ -4055,59 +4060,59 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* pop */
        0, /* shift */
       62, /* unshift */
-     170, /* sort */
-     178, /* reverse */
-     180, /* grepstart */
-     182, /* grepwhile */
-     180, /* mapstart */
-     185, /* mapwhile */
+     172, /* sort */
+     180, /* reverse */
+     182, /* grepstart */
+     184, /* grepwhile */
+     182, /* mapstart */
+     187, /* mapwhile */
        0, /* range */
-     189, /* flip */
-     189, /* flop */
+     191, /* flip */
+     191, /* flop */
        0, /* and */
        0, /* or */
       13, /* xor */
        0, /* dor */
-     191, /* cond_expr */
+     193, /* cond_expr */
        0, /* andassign */
        0, /* orassign */
        0, /* dorassign */
-     193, /* entersub */
-     193, /* enterxssub */
-     193, /* enterffi */
+     195, /* entersub */
+     195, /* enterxssub */
+     195, /* enterffi */
        0, /* method */
        0, /* method_named */
        0, /* method_super */
        0, /* method_redir */
        0, /* method_redir_super */
-     200, /* leavesub */
-     200, /* leavesublv */
-     202, /* signature */
-     204, /* caller */
+     202, /* leavesub */
+     202, /* leavesublv */
+     204, /* signature */
+     206, /* caller */
       89, /* warn */
       89, /* die */
       89, /* reset */
       -1, /* lineseq */
-     206, /* nextstate */
-     206, /* setstate */
-     206, /* keepstate */
-     206, /* dbstate */
+     208, /* nextstate */
+     209, /* enterinline */
+     210, /* leaveinline */
+     208, /* dbstate */
       -1, /* unstack */
       -1, /* enter */
-     207, /* leave */
+     212, /* leave */
       -1, /* scope */
-     210, /* enteriter */
-     214, /* iter */
+     215, /* enteriter */
+     219, /* iter */
        0, /* iter_ary */
        0, /* iter_lazyiv */
       -1, /* enterloop */
-     216, /* leaveloop */
+     221, /* leaveloop */
       -1, /* return */
-     218, /* last */
-     218, /* next */
-     218, /* redo */
-     218, /* dump */
-     218, /* goto */
+     223, /* last */
+     223, /* next */
+     223, /* redo */
+     223, /* dump */
+     223, /* goto */
       89, /* exit */
        0, /* entergiven */
        0, /* leavegiven */
@@ -4115,7 +4120,7 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* leavewhen */
       -1, /* break */
       -1, /* continue */
-     220, /* open */
+     225, /* open */
       89, /* close */
       89, /* pipe_op */
       89, /* fileno */
@@ -4131,7 +4136,7 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
       89, /* getc */
       89, /* read */
       89, /* enterwrite */
-     200, /* leavewrite */
+     202, /* leavewrite */
       -1, /* prtf */
       -1, /* print */
       -1, /* say */
@@ -4161,33 +4166,33 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* getpeername */
        0, /* lstat */
        0, /* stat */
-     225, /* ftrread */
-     225, /* ftrwrite */
-     225, /* ftrexec */
-     225, /* fteread */
-     225, /* ftewrite */
-     225, /* fteexec */
-     230, /* ftis */
-     230, /* ftsize */
-     230, /* ftmtime */
-     230, /* ftatime */
-     230, /* ftctime */
-     230, /* ftrowned */
-     230, /* fteowned */
-     230, /* ftzero */
-     230, /* ftsock */
-     230, /* ftchr */
-     230, /* ftblk */
-     230, /* ftfile */
-     230, /* ftdir */
-     230, /* ftpipe */
-     230, /* ftsuid */
-     230, /* ftsgid */
-     230, /* ftsvtx */
-     230, /* ftlink */
-     230, /* fttty */
-     230, /* fttext */
-     230, /* ftbinary */
+     230, /* ftrread */
+     230, /* ftrwrite */
+     230, /* ftrexec */
+     230, /* fteread */
+     230, /* ftewrite */
+     230, /* fteexec */
+     235, /* ftis */
+     235, /* ftsize */
+     235, /* ftmtime */
+     235, /* ftatime */
+     235, /* ftctime */
+     235, /* ftrowned */
+     235, /* fteowned */
+     235, /* ftzero */
+     235, /* ftsock */
+     235, /* ftchr */
+     235, /* ftblk */
+     235, /* ftfile */
+     235, /* ftdir */
+     235, /* ftpipe */
+     235, /* ftsuid */
+     235, /* ftsgid */
+     235, /* ftsvtx */
+     235, /* ftlink */
+     235, /* fttty */
+     235, /* fttext */
+     235, /* ftbinary */
       62, /* chdir */
       62, /* chown */
       44, /* chroot */
@@ -4237,8 +4242,8 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* require */
        0, /* dofile */
       -1, /* hintseval */
-     234, /* entereval */
-     200, /* leaveeval */
+     239, /* entereval */
+     202, /* leaveeval */
        0, /* entertry */
       -1, /* leavetry */
        0, /* ghbyname */
@@ -4276,18 +4281,18 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* lock */
        0, /* once */
       -1, /* custom */
-     240, /* coreargs */
-     244, /* avhvswitch */
+     245, /* coreargs */
+     249, /* avhvswitch */
        3, /* runcv */
        0, /* fc */
       -1, /* padcv */
       -1, /* introcv */
       -1, /* clonecv */
-     246, /* padrange */
-     248, /* refassign */
-     254, /* lvref */
-     260, /* lvrefslice */
-     261, /* lvavref */
+     251, /* padrange */
+     253, /* refassign */
+     259, /* lvref */
+     265, /* lvrefslice */
+     266, /* lvavref */
        0, /* anonconst */
 
 };
@@ -4314,13 +4319,13 @@ EXTCONST U16  PL_op_private_bitdefs[] = {
     0x33fc, 0x3b39, /* gvsv */
     0x4f18, 0x19f5, /* gv */
     0x0067, /* gelem, lt, i_lt, gt, i_gt, le, i_le, ge, i_ge, eq, i_eq, ne, i_ne, cmp, i_cmp, s_lt, s_gt, s_le, s_ge, s_eq, s_ne, s_cmp, bit_and, bit_xor, bit_or, s_bit_and, s_bit_xor, s_bit_or, smartmatch, i_aelem, n_aelem, s_aelem, i_aelem_u, n_aelem_u, s_aelem_u, lslice, xor */
-    0x33fc, 0x47b8, 0x02b7, /* padsv */
+    0x33fc, 0x47b8, 0x0317, /* padsv */
     0x33fc, 0x47b8, 0x06f4, 0x2650, 0x34ec, 0x4449, /* padav */
     0x33fc, 0x47b8, 0x06f4, 0x0790, 0x34ec, 0x4448, 0x2f61, /* padhv */
     0x10fc, 0x0618, 0x0df4, 0x0067, /* sassign */
     0x0bd8, 0x0ad4, 0x09d0, 0x34ec, 0x06e8, 0x0067, /* aassign */
     0x33fc, 0x34ec, 0x0067, /* oelem */
-    0x025f, /* oelemfast, aelemfast, aelemfast_lex, aelemfast_lex_u */
+    0x02bf, /* oelemfast, aelemfast, aelemfast_lex, aelemfast_lex_u */
     0x4c10, 0x0003, /* chomp, schomp, i_complement, s_complement, sin, cos, exp, log, sqrt, int, hex, oct, abs, ord, chr, chroot, rmdir */
     0x06f4, 0x34ec, 0x0003, /* pos */
     0x4c10, 0x0067, /* multiply, i_multiply, u_multiply, divide, i_divide, modulo, i_modulo, add, i_add, u_add, subtract, i_subtract, u_subtract, pow, i_pow, left_shift, right_shift, i_bit_and, i_bit_xor, i_bit_or */
@@ -4328,12 +4333,12 @@ EXTCONST U16  PL_op_private_bitdefs[] = {
     0x3798, 0x4c10, 0x0067, /* concat */
     0x33fc, 0x0358, 0x1d74, 0x4c10, 0x494c, 0x0003, /* multiconcat */
     0x4c10, 0x018f, /* stringify, atan2, rand, srand, crypt, push, unshift, flock, chdir, chown, unlink, chmod, utime, rename, link, symlink, mkdir, waitpid, system, exec, kill, getpgrp, setpgrp, getpriority, setpriority, sleep */
-    0x33fc, 0x1d78, 0x02b6, 0x34ec, 0x3908, 0x4864, 0x0003, /* rv2gv */
-    0x33fc, 0x3b38, 0x02b6, 0x3648, 0x4864, 0x0003, /* rv2sv */
+    0x33fc, 0x1d78, 0x0316, 0x34ec, 0x3908, 0x4864, 0x0003, /* rv2gv */
+    0x33fc, 0x3b38, 0x0316, 0x3648, 0x4864, 0x0003, /* rv2sv */
     0x34ec, 0x0003, /* av2arylen, akeys, values, keys */
     0x387c, 0x11b8, 0x0d34, 0x028c, 0x4b68, 0x4864, 0x0003, /* rv2cv */
     0x06f4, 0x0790, 0x0003, /* ref */
-    0x018f, /* bless, glob, sprintf, formline, unpack, pack, join, anonlist, anonhash, splice, warn, die, reset, exit, close, pipe_op, fileno, umask, binmode, tie, dbmopen, sselect, select, getc, read, enterwrite, sysopen, sysseek, sysread, syswrite, eof, tell, seek, truncate, fcntl, ioctl, send, recv, socket, sockpair, bind, connect, listen, accept, shutdown, gsockopt, ssockopt, open_dir, seekdir, gmtime, shmget, shmctl, shmread, shmwrite, msgget, msgctl, msgsnd, msgrcv, semop, semget, semctl, ghbyaddr, gnbyaddr, gpbynumber, gsbyname, gsbyport, syscall */
+    0x018f, /* bless, glob, sprintf, formline, pack, join, anonlist, anonhash, splice, warn, die, reset, exit, close, pipe_op, fileno, umask, binmode, tie, dbmopen, sselect, select, getc, read, enterwrite, sysopen, sysseek, sysread, syswrite, eof, tell, seek, truncate, fcntl, ioctl, send, recv, socket, sockpair, bind, connect, listen, accept, shutdown, gsockopt, ssockopt, open_dir, seekdir, gmtime, shmget, shmctl, shmread, shmwrite, msgget, msgctl, msgsnd, msgrcv, semop, semget, semctl, ghbyaddr, gnbyaddr, gpbynumber, gsbyname, gsbyport, syscall */
     0x3d1c, 0x3c38, 0x2cb4, 0x2bf0, 0x0003, /* backtick */
     0x4c11, /* match, qr, wait, getppid, time */
     0x06f4, 0x4c11, /* subst */
@@ -4343,7 +4348,7 @@ EXTCONST U16  PL_op_private_bitdefs[] = {
     0x34ec, 0x0067, /* vec, aelem_u */
     0x3718, 0x06f4, 0x4c10, 0x018f, /* index, rindex */
     0x33fc, 0x3b38, 0x06f4, 0x2650, 0x34ec, 0x4448, 0x4864, 0x0003, /* rv2av */
-    0x33fc, 0x32f8, 0x02b6, 0x34ec, 0x0067, /* aelem, helem */
+    0x33fc, 0x32f8, 0x0316, 0x34ec, 0x0067, /* aelem, helem */
     0x33fc, 0x34ec, 0x4449, /* aslice */
     0x34ed, /* kvaslice */
     0x33fc, 0x4398, 0x3014, 0x0003, /* delete */
@@ -4352,6 +4357,7 @@ EXTCONST U16  PL_op_private_bitdefs[] = {
     0x33fc, 0x0ff0, 0x34ec, 0x4449, /* hslice */
     0x0ff0, 0x34ed, /* kvhslice */
     0x33fc, 0x32f8, 0x1334, 0x1c90, 0x34ec, 0x4864, 0x0003, /* multideref */
+    0x0430, 0x018f, /* unpack */
     0x33fc, 0x3b38, 0x0430, 0x310c, 0x2a29, /* split */
     0x33fc, 0x24b9, /* list */
     0x4d7c, 0x46d8, 0x3dd4, 0x15d0, 0x2d4c, 0x4128, 0x2e44, 0x3aa1, /* sort */
@@ -4361,11 +4367,13 @@ EXTCONST U16  PL_op_private_bitdefs[] = {
     0x2650, 0x25a8, 0x22e4, 0x0003, /* mapwhile */
     0x3198, 0x0003, /* flip, flop */
     0x33fc, 0x0003, /* cond_expr */
-    0x33fc, 0x11b8, 0x02b6, 0x028c, 0x4b68, 0x4864, 0x2b01, /* entersub, enterxssub, enterffi */
+    0x33fc, 0x11b8, 0x0316, 0x028c, 0x4b68, 0x4864, 0x2b01, /* entersub, enterxssub, enterffi */
     0x3e98, 0x0003, /* leavesub, leavesublv, leavewrite, leaveeval */
     0x1d64, 0x0003, /* signature */
     0x00bc, 0x018f, /* caller */
-    0x2875, /* nextstate, setstate, keepstate, dbstate */
+    0x2875, /* nextstate, dbstate */
+    0x01fb, /* enterinline */
+    0x2b1c, 0x01fb, /* leaveinline */
     0x329c, 0x3e98, 0x4595, /* leave */
     0x33fc, 0x3b38, 0x122c, 0x41a5, /* enteriter */
     0x41a4, 0x0003, /* iter */
@@ -4377,9 +4385,9 @@ EXTCONST U16  PL_op_private_bitdefs[] = {
     0x3f34, 0x0f30, 0x084c, 0x4ce8, 0x2784, 0x0003, /* entereval */
     0x35bc, 0x0018, 0x14e4, 0x1401, /* coreargs */
     0x34ec, 0x00c7, /* avhvswitch */
-    0x33fc, 0x01fb, /* padrange */
-    0x33fc, 0x47b8, 0x03d6, 0x2ecc, 0x1ae8, 0x0067, /* refassign */
-    0x33fc, 0x47b8, 0x03d6, 0x2ecc, 0x1ae8, 0x0003, /* lvref */
+    0x33fc, 0x025b, /* padrange */
+    0x33fc, 0x47b8, 0x0436, 0x2ecc, 0x1ae8, 0x0067, /* refassign */
+    0x33fc, 0x47b8, 0x0436, 0x2ecc, 0x1ae8, 0x0003, /* lvref */
     0x33fd, /* lvrefslice */
     0x33fc, 0x47b8, 0x0003, /* lvavref */
 
@@ -4558,7 +4566,7 @@ EXTCONST U8 PL_op_private_valid[] = {
     /* HSLICE     */ (OPpSLICEWARNING|OPpMAYBE_LVSUB|OPpSTACKCOPY|OPpLVAL_INTRO),
     /* KVHSLICE   */ (OPpMAYBE_LVSUB|OPpSTACKCOPY),
     /* MULTIDEREF */ (OPpARG1_MASK|OPpHINT_STRICT_REFS|OPpMAYBE_LVSUB|OPpMULTIDEREF_EXISTS|OPpMULTIDEREF_DELETE|OPpLVAL_DEFER|OPpLVAL_INTRO),
-    /* UNPACK     */ (OPpARG4_MASK),
+    /* UNPACK     */ (OPpARG4_MASK|OPpUNPACK_ASSIGN),
     /* PACK       */ (OPpARG4_MASK),
     /* SPLIT      */ (OPpSPLIT_IMPLIM|OPpSPLIT_LEX|OPpSPLIT_ASSIGN|OPpOUR_INTRO|OPpLVAL_INTRO),
     /* JOIN       */ (OPpARG4_MASK),
@@ -4605,8 +4613,8 @@ EXTCONST U8 PL_op_private_valid[] = {
     /* RESET      */ (OPpARG4_MASK),
     /* LINESEQ    */ (0),
     /* NEXTSTATE  */ (OPpHUSH_VMSISH),
-    /* SETSTATE   */ (OPpHUSH_VMSISH),
-    /* KEEPSTATE  */ (OPpHUSH_VMSISH),
+    /* ENTERINLINE */ (OPpINLINE_ARGSMASK),
+    /* LEAVEINLINE */ (OPpINLINE_ARGSMASK|OPpINLINE_INARGS),
     /* DBSTATE    */ (OPpHUSH_VMSISH),
     /* UNSTACK    */ (0),
     /* ENTER      */ (0),
@@ -0,0 +1 @@
+op.c
\ No newline at end of file
@@ -229,8 +229,8 @@ typedef enum opcode {
 	OP_RESET	 = 212,
 	OP_LINESEQ	 = 213,
 	OP_NEXTSTATE	 = 214,
-	OP_SETSTATE	 = 215,
-	OP_KEEPSTATE	 = 216,
+	OP_ENTERINLINE	 = 215,
+	OP_LEAVEINLINE	 = 216,
 	OP_DBSTATE	 = 217,
 	OP_UNSTACK	 = 218,
 	OP_ENTER	 = 219,
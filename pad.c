@@ -2744,6 +2744,9 @@ Perl_padlist_dup(pTHX_ PADLIST *srcpad, CLONE_PARAMS *param)
     Newx(dstpad, 1, PADLIST);
     ptr_table_store(PL_ptr_table, srcpad, dstpad);
     PadlistMAX(dstpad) = max;
+    /* the ids are checked by find_runcv and inlined calls */
+    dstpad->xpadl_id    = srcpad->xpadl_id;
+    dstpad->xpadl_outid = srcpad->xpadl_outid;
     Newx(PadlistARRAY(dstpad), max + 1, PAD *);
 
     PadlistARRAY(dstpad)[0] = (PAD *)
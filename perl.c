@@ -98,6 +98,7 @@ S_init_tls_and_interp(PerlInterpreter *my_perl)
 	OP_CHECK_MUTEX_INIT;
 	KEYWORD_PLUGIN_MUTEX_INIT;
 	HINTS_REFCNT_INIT;
+	STRTAB_INIT;
         LOCALE_INIT;
         USER_PROP_MUTEX_INIT;
 	MUTEX_INIT(&PL_dollarzero_mutex);
@@ -365,6 +366,14 @@ perl_construct(pTHXx)
          * a suitable seed yourself and define PERL_HASH_SEED to a well chosen
          * string. See hv_func.h for details.
          */
+#ifdef PERL_HASH_FUNC_SELECT
+        /* and the hash function, see hash_func_select */
+# ifndef NO_PERL_HASH_ENV
+        hash_func_select(PerlEnv_getenv("PERL_HASH_FUNC"));
+# else
+        hash_func_select(NULL);
+# endif
+#endif
 #if defined(USE_HASH_SEED)
         /* get the hash seed from the environment or from an RNG */
         Perl_get_hash_seed(aTHX_ PL_hash_seed);
@@ -389,10 +398,13 @@ perl_construct(pTHXx)
         /* SHAREKEYS tells us that the hash has its keys shared with PL_strtab,
          * which is not the case with PL_strtab itself */
         HvSHAREKEYS_off(PL_strtab);			/* mandatory */
+#ifndef PERL_GLOBAL_STRTAB
         hv_ksplit(PL_strtab, 1 << 11);                  /* 2048 - half a page */
+#endif
     }
 
     Zero(PL_sv_consts, SV_CONSTS_COUNT, SV*);
+    Zero(PL_hv_icache, PERL_HV_ICACHE_SIZE, struct hv_icache);
 
 #ifndef PERL_MICRO
 #   ifdef  USE_ENVIRON_ARRAY
@@ -1292,6 +1304,10 @@ perl_destruct(pTHXx)
     while (sv_clean_all() > 2)
 	;
 
+#ifdef PERL_JIT
+    jit_free(NULL);		/* the code of loops in leaked subs */
+#endif
+
 #ifdef USE_ITHREADS
     Safefree(PL_stashpad); /* must come after sv_clean_all */
 #endif
@@ -1310,8 +1326,10 @@ perl_destruct(pTHXx)
         PL_sv_consts[i] = NULL;
     }
 
-    /* Destruct the global string table. */
-    {
+    /* Destruct the global string table. With PERL_GLOBAL_STRTAB the
+       keys are in the process-global table, and a cloned PL_strtab may
+       have no buckets. */
+    if (HvARRAY(PL_strtab)) {
 	/* Yell and reset the HeVAL() slots that are still holding refcounts,
 	 * so that sv_free() won't fail on them.
 	 * Now that the global string table is using a single hunk of memory
@@ -1342,6 +1360,7 @@ perl_destruct(pTHXx)
 	Safefree(array);
 	HvARRAY(PL_strtab) = 0;
 	HvTOTALKEYS(PL_strtab) = 0;
+	SvFLAGS(PL_strtab) &= ~SVf_OOK; /* the aux struct of the incremental split */
     }
     SvREFCNT_dec(PL_strtab);
 
@@ -1965,6 +1984,9 @@ S_Internals_V(pTHX_ CV *cv)
 #  ifdef PERL_HASH_FUNC_ONE_AT_A_TIME_OLD
 			     " PERL_HASH_FUNC_ONE_AT_A_TIME_OLD"
 #  endif
+#  ifdef PERL_HASH_FUNC_SELECT
+			     " PERL_HASH_FUNC_SELECT"
+#  endif
 #  ifdef PERL_HASH_FUNC_SDBM
 			     " PERL_HASH_FUNC_SDBM"
 #  endif
@@ -2016,6 +2038,9 @@ S_Internals_V(pTHX_ CV *cv)
 #  ifdef PERL_RELOCATABLE_INCPUSH
 			     " PERL_RELOCATABLE_INCPUSH"
 #  endif
+#  ifdef PERL_RUNOPS_CGOTO
+			     " PERL_RUNOPS_CGOTO"
+#  endif
 #  ifdef PERL_USE_DEVEL
 			     " PERL_USE_DEVEL"
 #  endif
@@ -2476,12 +2501,12 @@ S_parse_body(pTHX_ char **env, XSINIT_t xsinit)
 # ifdef DEBUGGING
             const unsigned char *seed     = PERL_HASH_SEED;
             const unsigned char *seed_end = PERL_HASH_SEED + PERL_HASH_SEED_BYTES;
-            PerlIO_printf(Perl_debug_log, "HASH_FUNCTION = %s HASH_SEED = " "0x", PERL_HASH_FUNC);
+            PerlIO_printf(Perl_debug_log, "HASH_FUNCTION = %s HASH_SEED = " "0x", PERL_HASH_FUNC_NAME);
             while (seed < seed_end) {
                 PerlIO_printf(Perl_debug_log, "%02x", *seed++);
             }
 # else
-            PerlIO_printf(Perl_debug_log, "HASH_FUNCTION = %s HASH_SEED = ", PERL_HASH_FUNC);
+            PerlIO_printf(Perl_debug_log, "HASH_FUNCTION = %s HASH_SEED = ", PERL_HASH_FUNC_NAME);
             PerlIO_printf(Perl_debug_log, "<hidden>");
 # endif
             PerlIO_printf(Perl_debug_log, " PERTURB_KEYS = %d (%s)",
@@ -122,8 +122,10 @@
 
 /* <--- here ends the logic shared by perl.h and makedef.pl */
 
-/* enable the experimental cperl inliner */
-/* #define PERL_INLINE_SUBS / * */
+/* enable the cperl inliner, disable with -Accflags=-DPERL_NO_INLINE_SUBS */
+#if !defined(PERL_INLINE_SUBS) && !defined(PERL_NO_INLINE_SUBS)
+#  define PERL_INLINE_SUBS
+#endif
 
 /* Microsoft Visual C++ 6.0 needs special treatment in numerous places */
 #if defined(WIN32) && defined(_MSC_VER) && _MSC_VER >= 1200 && _MSC_VER < 1300
@@ -594,6 +596,26 @@
 #  endif
 #endif
 
+/* Labels as values, a gcc extension also supported by clang and icc.
+ * Used by the computed goto runloop runops_cgoto in run.c, which is the
+ * default with -Accflags=-DPERL_RUNOPS_CGOTO */
+#if defined(__GNUC__) && !defined(__cplusplus)
+#  define PERL_HAS_COMPUTED_GOTO
+#endif
+
+/* The baseline JIT for hot loops, jit_loop in run.c. It emits x86-64
+ * code with the addresses of the interpreter variables, and skips the
+ * runloop's -D and dtrace hooks. */
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)      \
+ && !defined(MULTIPLICITY) && !defined(DEBUGGING) && !defined(USE_DTRACE) \
+ && !defined(PERL_TRACE_OPS) && !defined(PERL_NO_JIT)
+#  define PERL_JIT
+#  ifndef PERL_JIT_THRESHOLD
+#    define PERL_JIT_THRESHOLD 1000
+#  endif
+struct jit_code;
+#endif
+
 /*
  * STMT_START { statements; } STMT_END;
  * can be used as a single statement, as in
@@ -4616,6 +4638,8 @@ typedef Sighandler_t Sigsave_t;
 #  define register
 # endif
 # define RUNOPS_DEFAULT Perl_runops_debug
+#elif defined(PERL_RUNOPS_CGOTO) && defined(PERL_HAS_COMPUTED_GOTO)
+# define RUNOPS_DEFAULT Perl_runops_cgoto
 #else
 # define RUNOPS_DEFAULT Perl_runops_standard
 #endif
@@ -5237,12 +5261,18 @@ EXTCONST char PL_bincompat_options[] =
 #  ifdef PERLIO_LAYERS
 			     " PERLIO_LAYERS"
 #  endif
+#  ifdef PERL_COW_REFCNT_WIDE
+			     " PERL_COW_REFCNT_WIDE"
+#  endif
 #  ifdef PERL_DEBUG_READONLY_COW
 			     " PERL_DEBUG_READONLY_COW"
 #  endif
 #  ifdef PERL_DEBUG_READONLY_OPS
 			     " PERL_DEBUG_READONLY_OPS"
 #  endif
+#  ifdef PERL_GLOBAL_STRTAB
+			     " PERL_GLOBAL_STRTAB"
+#  endif
 #  ifdef PERL_GLOBAL_STRUCT
 			     " PERL_GLOBAL_STRUCT"
 #  endif
@@ -5639,6 +5669,8 @@ struct perl_vars *PL_VarsPtr;
 #endif /* MULTIPLICITY */
 
 struct tempsym; /* defined in pp_pack.c */
+struct pack_insn; /* defined in pp_pack.c */
+struct pack_prog; /* defined in pp_pack.c */
 
 #include "thread.h"
 #include "pp.h"
@@ -5737,13 +5769,15 @@ struct PerlHandShakeInterpreter {
 
 START_EXTERN_C
 
-/* dummy variables that hold pointers to both runops functions, thus forcing
- * them *both* to get linked in (useful for Peek.xs, debugging etc) */
+/* dummy variables that hold pointers to all runops functions, thus forcing
+ * them *all* to get linked in (useful for Peek.xs, debugging etc) */
 
 EXTCONST runops_proc_t PL_runops_std
   INIT(Perl_runops_standard);
 EXTCONST runops_proc_t PL_runops_dbg
   INIT(Perl_runops_debug);
+EXTCONST runops_proc_t PL_runops_cgo
+  INIT(Perl_runops_cgoto);
 
 #define EXT_MGVTBL EXT MGVTBL
 
@@ -7216,6 +7250,20 @@ extern void moncontrol(int);
 #endif
 
 #define PERL_MAGIC_UTF8_CACHESIZE	2
+/* The mg_ptr of PERL_MAGIC_utf8 holds PERL_MAGIC_UTF8_CACHESIZE pairs of
+   character and byte offsets, then the number of index samples and the
+   bytes walked by lookups so far. Strings of PERL_UTF8_INDEX_MIN bytes or
+   more get the index once the lookups walked as much as the whole string,
+   the byte offset of every PERL_UTF8_INDEX_STEP'th character following. */
+#define PERL_MAGIC_UTF8_SAMPLES		(PERL_MAGIC_UTF8_CACHESIZE * 2)
+#define PERL_MAGIC_UTF8_WALKED		(PERL_MAGIC_UTF8_CACHESIZE * 2 + 1)
+#define PERL_MAGIC_UTF8_INDEX		(PERL_MAGIC_UTF8_CACHESIZE * 2 + 2)
+#ifndef PERL_UTF8_INDEX_MIN
+#  define PERL_UTF8_INDEX_MIN		65536	/* 0 disables the index */
+#endif
+#ifndef PERL_UTF8_INDEX_STEP
+#  define PERL_UTF8_INDEX_STEP		4096
+#endif
 
 #define PERL_UNICODE_STDIN_FLAG			0x0001
 #define PERL_UNICODE_STDOUT_FLAG		0x0002
@@ -7358,6 +7406,17 @@ extern void moncontrol(int);
 #  define DOUBLE_MIX_ENDIAN
 #endif
 
+/* Exact NV <=> decimal conversion with 128-bit integer arithmetic,
+ * used by sv_2pv_flags(), sv_vcatpvfn_flags() and my_atof3() before
+ * falling back to the libc routines.  Needs a plain IEEE 754 double NV
+ * whose bits can be read through a U64. */
+#if NVSIZE == 8 && defined(__SIZEOF_INT128__) && !defined(USE_QUADMATH) \
+ && (DOUBLEKIND == DOUBLE_IS_IEEE_754_64_BIT_LITTLE_ENDIAN ||           \
+     DOUBLEKIND == DOUBLE_IS_IEEE_754_64_BIT_BIG_ENDIAN)                \
+ && !defined(NO_FAST_NUMCONV)
+#  define PERL_FAST_NUMCONV
+#endif
+
 /* The VAX fp formats are neither consistently little-endian nor
  * big-endian, and neither are they really IEEE-mixed endian like
  * the mixed-endian ARM IEEE formats (with swapped bytes).
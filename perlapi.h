@@ -151,6 +151,10 @@ END_EXTERN_C
 #define PL_dollarzero_mutex	(*Perl_Gdollarzero_mutex_ptr(NULL))
 #undef  PL_fold_locale
 #define PL_fold_locale		(*Perl_Gfold_locale_ptr(NULL))
+#undef  PL_hash_func
+#define PL_hash_func		(*Perl_Ghash_func_ptr(NULL))
+#undef  PL_hash_func_name
+#define PL_hash_func_name	(*Perl_Ghash_func_name_ptr(NULL))
 #undef  PL_hash_seed
 #define PL_hash_seed		(*Perl_Ghash_seed_ptr(NULL))
 #undef  PL_hash_seed_set
@@ -227,6 +231,8 @@ END_EXTERN_C
 #define PL_strategy_socket	(*Perl_Gstrategy_socket_ptr(NULL))
 #undef  PL_strategy_socketpair
 #define PL_strategy_socketpair	(*Perl_Gstrategy_socketpair_ptr(NULL))
+#undef  PL_strtab_stripes
+#define PL_strtab_stripes	(*Perl_Gstrtab_stripes_ptr(NULL))
 #undef  PL_sv_placeholder
 #define PL_sv_placeholder	(*Perl_Gsv_placeholder_ptr(NULL))
 #undef  PL_thr_key
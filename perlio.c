@@ -53,6 +53,10 @@
 #include <rms.h>
 #endif
 
+#if defined(HAS_WRITEV) && defined(I_SYSUIO)
+#include <sys/uio.h>
+#endif
+
 #define PerlIO_lockcnt(f) (((PerlIOl*)(f))->head->flags)
 
 /* Call the callback or PerlIOBase, and return failure. */
@@ -4303,6 +4307,67 @@ PerlIOBuf_unread(pTHX_ PerlIO *f, const void *vbuf, Size_t count)
     return unread;
 }
 
+/* Write a big chunk to the layer below, after what is pending in our
+   buffer. With :unix below both go out with one writev(). */
+static SSize_t
+S_perlio_buf_write_through(pTHX_ PerlIO *f, const STDCHAR *buf, Size_t count)
+{
+    PerlIOBuf * const b = PerlIOSelf(f, PerlIOBuf);
+    PerlIO * const n = PerlIONext(f);
+    Size_t written = 0;
+#if defined(HAS_WRITEV) && defined(I_SYSUIO) && !defined(PERLIO_STD_SPECIAL)
+    if (b->ptr > b->buf && PerlIOValid(n)
+        && PerlIOBase(n)->tab == &PerlIO_unix && !PerlIO_lockcnt(n)) {
+	const Size_t pending = b->ptr - b->buf;
+	struct iovec iov[2];
+	SSize_t len;
+	iov[0].iov_base = (char *)b->buf;
+	iov[0].iov_len  = pending;
+	iov[1].iov_base = (char *)buf;
+	iov[1].iov_len  = count;
+	while ((len = writev(PerlIOSelf(n, PerlIOUnix)->fd, iov, 2)) < 0
+               && errno == EINTR) {
+	    if (PL_sig_pending && S_perlio_async_run(aTHX_ n))
+		return -1;
+	}
+	/* on errors the flush below sets the error flags */
+	if (len >= 0) {
+	    if ((Size_t)len < pending) {
+		Move(b->buf + len, b->buf, pending - len, STDCHAR);
+		b->ptr -= len;
+		b->posn += len;
+	    }
+	    else {
+		b->ptr = b->buf;
+		b->posn += pending;
+		PerlIOBase(f)->flags &= ~PERLIO_F_WRBUF;
+		written = len - pending;
+		b->posn += written;
+	    }
+	}
+    }
+#endif
+    if (b->ptr > b->buf && PerlIO_flush(f) != 0)
+	return -1;
+    while (written < count) {
+	const SSize_t len = PerlIO_write(n, buf + written, count - written);
+	if (len > 0) {
+	    written += len;
+	    b->posn += len;
+	}
+	else {
+	    if (len < 0 || PerlIO_error(n)) {
+		PerlIOBase(f)->flags |= PERLIO_F_ERROR;
+		PerlIO_save_errno(f);
+		if (!written)
+		    return -1;
+	    }
+	    break;
+	}
+    }
+    return written;
+}
+
 SSize_t
 PerlIOBuf_write(pTHX_ PerlIO *f, const void *vbuf, Size_t count)
 {
@@ -4319,6 +4384,14 @@ PerlIOBuf_write(pTHX_ PerlIO *f, const void *vbuf, Size_t count)
 	    return 0;
 	}
     }	
+    /* Whole buffers are not copied through ours, but written straight
+       through. Layers derived from :perlio which convert the buffer in
+       their flush, like :encoding, keep the copy. */
+    if (count >= (Size_t)b->bufsiz
+        && !(PerlIOBase(f)->flags & PERLIO_F_LINEBUF)
+        && (PerlIOBase(f)->tab == &PerlIO_perlio
+            || PerlIOBase(f)->tab == &PerlIO_crlf))
+	return S_perlio_buf_write_through(aTHX_ f, buf, count);
     if (PerlIOBase(f)->flags & PERLIO_F_LINEBUF) {
 	flushptr = buf + count;
 	while (flushptr > buf && *(flushptr - 1) != '\n')
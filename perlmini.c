@@ -0,0 +1 @@
+perl.c
\ No newline at end of file
@@ -99,6 +99,10 @@ PERLVARI(G, mmap_page_size, IV, 0)
 
 #if defined(USE_ITHREADS)
 PERLVAR(G, hints_mutex, perl_mutex)    /* Mutex for refcounted he refcounting */
+#  ifdef PERL_GLOBAL_STRTAB
+/* the process-global shared string table, see hv.h */
+PERLVARA(G, strtab_stripes, PERL_STRTAB_STRIPES, struct strtab_stripe)
+#  endif
 #  if ! defined(USE_THREAD_SAFE_LOCALE) || defined(TS_W32_BROKEN_LOCALECONV)
 PERLVAR(G, locale_mutex, perl_mutex)   /* Mutex for setlocale() changing */
 #  endif
@@ -256,6 +260,10 @@ PERLVAR(G, malloc_mutex, perl_mutex)	/* Mutex for malloc */
 
 PERLVARI(G, hash_seed_set, bool, FALSE)	/* perl.c */
 PERLVARA(G, hash_seed, PERL_HASH_SEED_BYTES, unsigned char) /* perl.c and hv.h */
+#ifdef PERL_HASH_FUNC_SELECT
+PERLVARI(G, hash_func, perl_hash_func_t, NULL)	/* hv.c hash_func_select */
+PERLVARI(G, hash_func_name, const char *, NULL)
+#endif
 
 /* The path separator can vary depending on whether we're running under DCL or
  * a Unix shell.
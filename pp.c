@@ -6142,6 +6142,22 @@ PP(pp_anonhash)
     SV* const retval = sv_2mortal( OpSPECIAL(PL_op)
                                     ? newRV_noinc(MUTABLE_SV(hv))
                                     : MUTABLE_SV(hv) );
+    SV **svp;
+
+    /* Without magic and with pairs, copy the values in place and store
+       them all at once */
+    for (svp = MARK + 1; svp <= SP; svp++)
+        if (SvGMAGICAL(*svp))
+            break;
+    if (svp > SP && !((SP - MARK) & 1)) {
+        for (svp = MARK + 2; svp <= SP; svp += 2) {
+            SV * const val = newSV(0);
+            sv_setsv_nomg(val, *svp);
+            *svp = val;
+        }
+        hv_store_list(hv, MARK + 1, (U32)((SP - MARK) >> 1));
+        MARK = SP;
+    }
 
     while (MARK < SP) {
 	SV * const key =
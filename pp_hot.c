@@ -53,22 +53,85 @@ PPt(pp_nextstate, "():Void")
     PERL_ASYNC_CHECK();
     return NORMAL;
 }
-PP(pp_setstate)
+
+/* The guard of a sub call inlined by the peephole optimizer, see
+   cv_do_inline() in op.c. On the stack are the mark, the args and
+   the gv or cv ref of the called sub. If it is still the inlined sub,
+   copy the args to the pad temps at op_targ, and run the inlined body
+   in the cop of the sub. Else call the sub via the original entersub.
+   Tied or overloaded args and warn or die hooks also use the call,
+   as they may run perl code which could see the missing frame. */
+
+PP(pp_enterinline)
 {
-    PL_curcop = (COP*)PL_op;
-    TAINT_NOT;
-    PL_curcop->cop_seq = PL_stack_sp - PL_stack_base; /* save SP */
-    FREETMPS;
-    PERL_ASYNC_CHECK();
+    dSP;
+    SV * const sv = TOPs;
+    SV ** const mark = PL_stack_base + TOPMARK;
+    const U8 nargs = PL_op->op_private & OPpINLINE_ARGSMASK;
+    const PADOFFSET base = PL_op->op_targ;
+    const CV *cv = NULL;
+    SV **svp;
+    U8 i;
+
+    if (SvTYPE(sv) == SVt_PVGV) {
+        if (isGV_with_GP(sv))
+            cv = GvCVu((const GV *)sv);
+    }
+    else if (SvROK(sv) && SvTYPE(SvRV(sv)) == SVt_PVCV)
+        cv = (const CV *)SvRV(sv);
+    if (UNLIKELY(!cv || CvISXSUB(cv) || !CvPADLIST(cv)
+        || CvPADLIST(cv)->xpadl_id
+           != (U32)SvUVX(cSVOPx_sv(OpSIBLING(cLOGOP->op_first)))
+        || SP - mark != nargs + 1
+        || PL_warnhook || PL_diehook || TAINTING_get))
+        return cLOGOP->op_other;
+    for (svp = mark + 1; svp < SP; svp++) {
+        if (UNLIKELY(SvGMAGICAL(*svp)
+            || (SvROK(*svp) && (SvAMAGIC(*svp) || SvRMAGICAL(SvRV(*svp))))))
+            return cLOGOP->op_other;
+    }
+
+    for (i = 0, svp = mark + 1; i < nargs; i++, svp++)
+        sv_setsv_nomg(PAD_SVl(base + i), *svp);
+    {
+        SV * const save = PAD_SVl(base + nargs);
+        SvUPGRADE(save, SVt_IV);
+        SvIV_set(save, PTR2IV(PL_curcop));
+    }
+    POPMARK;
+    PL_stack_sp = mark;
+    PL_curcop = (COP*)CvSTART(cv)->op_next;
     return NORMAL;
 }
-PP(pp_keepstate)
+
+/* Leave an inlined sub body: restore the cop of the caller, copy the
+   result as leavesub would, and clear the args. */
+
+PP(pp_leaveinline)
 {
-    TAINT_NOT;
-    PL_stack_sp = PL_stack_base + PL_curcop->cop_seq; /* reset SP */
-    PL_curcop = (COP*)PL_op;
-    FREETMPS;
-    PERL_ASYNC_CHECK();
+    dSP;
+    const U8 nargs = PL_op->op_private & OPpINLINE_ARGSMASK;
+    const PADOFFSET base = PL_op->op_targ;
+    U8 i;
+
+    PL_curcop = INT2PTR(COP*, SvIVX(PAD_SVl(base + nargs)));
+    if (GIMME_V == G_VOID)
+        SP--;
+    else {
+        SV * const sv = TOPs;
+        if (!((SvFLAGS(sv) & (SVs_TEMP|SVs_GMG|SVs_SMG|SVs_RMG)) == SVs_TEMP
+              && SvREFCNT(sv) == 1)
+            && !SvPADTMP(sv)
+            && !(SvIMMORTAL(sv) && !(PL_op->op_private & OPpINLINE_INARGS)))
+            SETs(sv_mortalcopy(sv));
+    }
+    PUTBACK;
+    for (i = 0; i < nargs; i++) {
+        SV * const arg = PAD_SVl(base + i);
+        if (SvTHINKFIRST(arg))
+            sv_force_normal_flags(arg, SV_IMMEDIATE_UNREF|SV_COW_DROP_PV);
+        SvOK_off(arg);
+    }
     return NORMAL;
 }
 
@@ -298,6 +361,11 @@ PPt(pp_unstack, "():Void")
         assert(CxTYPE(cx) == CXt_BLOCK || CxTYPE_is_LOOP(cx));
 	CX_LEAVE_SCOPE(cx);
     }
+#ifdef PERL_JIT
+    /* the loop is hot, the op_targ of unstack is unused */
+    if (UNLIKELY(++PL_op->op_targ == PERL_JIT_THRESHOLD))
+        jit_loop(PL_op);
+#endif
     return NORMAL;
 }
 
@@ -981,13 +1049,19 @@ PPt(pp_multiconcat, "(:List(:Str)):Str")
                 const char *p = svpv_p->pv;
                 len = -len;
                 if (UNLIKELY(p)) {
-                    /* copy plain-but-variant pv to a utf8 targ */
+                    /* copy plain-but-variant pv to a utf8 targ. Only the
+                     * length of the output is known, but half of what is
+                     * left of it is input that surely fits */
                     char * end_pv = targ_pv + len;
                     assert(dst_utf8);
-                    while (targ_pv < end_pv) {
-                        U8 c = (U8) *p++;
-                        append_utf8_from_native_byte(c, (U8**)&targ_pv);
+                    while (end_pv - targ_pv > 1) {
+                        const char *pe = p + (end_pv - targ_pv) / 2;
+                        targ_pv = (char *) _utf8_from_bytes((const U8 *) p,
+                                                (const U8 *) pe, (U8 *) targ_pv);
+                        p = pe;
                     }
+                    if (targ_pv < end_pv)
+                        *targ_pv++ = *p;
                 }
                 else
                     /* arg is already-copied targ */
@@ -2686,6 +2760,7 @@ PP(pp_aassign)
 
             SV **svp;
             bool dirty_tmps;
+            bool bulk;
             SSize_t i;
             SSize_t tmps_base;
             SSize_t nelems = lastrelem - relem + 1;
@@ -2799,14 +2874,22 @@ PP(pp_aassign)
 
             if (SvRMAGICAL(hash) || HvUSEDKEYS(hash))
                 hv_clear(hash);
-            hv_ksplit(hash, (lastrelem - relem)>>1); /* rough number,
-                                                        incl. duplicates */
+            bulk = gimme != G_ARRAY && !SvMAGICAL(hash) && !SvREADONLY(hash);
+            if (!bulk)
+                hv_ksplit(hash, (lastrelem - relem)>>1); /* rough number,
+                                                            incl. duplicates */
 
             /* now assign the keys and values to the hash */
 
             dirty_tmps = FALSE;
 
-            if (UNLIKELY(gimme == G_ARRAY)) {
+            if (LIKELY(bulk)) {
+                /* sized once, without the per-key magic checks */
+                hv_store_list(hash, relem, (U32)nelems);
+                for (svp = relem + 1; svp <= lastrelem; svp += 2)
+                    SvSETMAGIC(*svp);
+            }
+            else if (UNLIKELY(gimme == G_ARRAY)) {
                 /* @a = (%h = (...)) etc */
                 SV **svp;
                 SV **topelem = relem;
@@ -3541,10 +3624,97 @@ Perl_do_readline(pTHX)
     }
 }
 
+/*
+=for apidoc hv_fetch_icache
+
+Fetches the value slot of the hash element C<keysv> like
+C<hv_fetch_ent>, via the monomorphic inline cache of the op C<site>,
+for the hash element ops C<helem> and C<multideref>.
+
+With a shared key (the usual constant key) the cache remembers the
+last HE found and its bucket, or for a shaped hash the shape and the
+value index. On the next execution the HE is searched by pointer in
+its bucket chain only, and a shaped hash with the same shape, typically
+the next object of the same class, needs no search at all.
+
+The cache is never invalidated. An hsplit, delete, clear or unshape
+moves or removes the HE from the cached bucket, and a freed and reused
+HE or shape is caught by comparing its HEK with the key.
+
+=cut
+*/
+PERL_STATIC_INLINE SV **
+S_hv_fetch_icache(pTHX_ HV *hv, SV *keysv, const void *site, const U32 lval)
+{
+    struct hv_icache *ic;
+    const HEK *hek;
+    SV **svp;
+
+    PERL_ARGS_ASSERT_HV_FETCH_ICACHE;
+    if (UNLIKELY(SvMAGICAL(hv) || SvREADONLY(hv) || !HvSHAREKEYS(hv)
+                 || !SvPOK_nog(keysv) || !SvIsCOW_shared_hash(keysv)))
+        goto nocache;
+
+    ic = &PL_hv_icache[ HvICACHE_SLOT(site) ];
+    hek = SvSHARED_HEK_FROM_PV(SvPVX_const(keysv));
+    if (ic->hic_site == site) {
+        if (HvSHAPED(hv)) {
+            const struct hv_shape * const shape = HvSHAPE(hv);
+            if (shape == ic->hic_ptr
+                && ic->hic_index < shape->hs_keys
+                && shape->hs_heks[ic->hic_index] == hek) {
+                DEBUG_H(PerlIO_printf(Perl_debug_log,
+                    "HASH icache shaped [%u]\t{%.*s}\n", (unsigned)ic->hic_index,
+                    (int)HEK_LEN(hek), HEK_KEY(hek)));
+                return &HvSHAPED_VALS(hv)[ic->hic_index];
+            }
+        }
+        else if (HvARRAY(hv) && ic->hic_index <= HvMAX(hv)) {
+            const HE *he = HvARRAY(hv)[ic->hic_index];
+            for (; he; he = HeNEXT(he)) {
+                if (he == ic->hic_ptr) {
+                    if (HeKEY_hek(he) != hek || HeVAL(he) == PLACEHOLDER)
+                        break;
+                    DEBUG_H(PerlIO_printf(Perl_debug_log,
+                        "HASH icache [%u]\t{%.*s}\n", (unsigned)ic->hic_index,
+                        (int)HEK_LEN(hek), HEK_KEY(hek)));
+                    return &HeVAL((HE*)he);
+                }
+            }
+        }
+    }
+
+    if (HvSHAPED(hv)) {
+        svp = hv_fetch_ent_svp(hv, keysv, lval);
+        if (svp && HvSHAPED(hv)) {
+            ic->hic_site  = site;
+            ic->hic_ptr   = HvSHAPE(hv);
+            ic->hic_index = (U32)(svp - HvSHAPED_VALS(hv));
+        }
+    }
+    else {
+        HE * const he = hv_fetch_ent(hv, keysv, lval, 0);
+        if (!he)
+            return NULL;
+        svp = &HeVAL(he);
+        ic->hic_site  = site;
+        ic->hic_ptr   = he;
+        ic->hic_index = (U32)HvBUCKET_INDEX(hv, HeHASH(he));
+    }
+    return svp;
+
+  nocache:
+    if (UNLIKELY(HvSHAPED(hv)))
+        return hv_fetch_ent_svp(hv, keysv, lval);
+    else {
+        HE * const he = hv_fetch_ent(hv, keysv, lval, 0);
+        return he ? &HeVAL(he) : NULL;
+    }
+}
+
 PP(pp_helem)
 {
     dSP;
-    HE* he;
     SV **svp;
     SV * const keysv = POPs;
     HV * const hv = MUTABLE_HV(POPs);
@@ -3570,8 +3740,7 @@ PP(pp_helem)
 	    preeminent = hv_exists_ent(hv, keysv, 0);
     }
 
-    he = hv_fetch_ent(hv, keysv, lval && !defer, 0);
-    svp = he ? &HeVAL(he) : NULL;
+    svp = hv_fetch_icache(hv, keysv, PL_op, lval && !defer);
     if (lval) {
 	if (!svp || !*svp || *svp == UNDEF) {
 	    SV* lv;
@@ -3978,8 +4147,8 @@ PP(pp_multideref)
                 /* this is basically a copy of pp_helem with OPpDEREF skipped */
 
                 if (!(actions & MDEREF_FLAG_last)) {
-                    HE *he = hv_fetch_ent((HV*)sv, keysv, 1, 0);
-                    if (!he || !(sv=HeVAL(he)) || sv == UNDEF)
+                    SV ** const svp = hv_fetch_icache((HV*)sv, keysv, items, 1);
+                    if (!svp || !(sv = *svp) || sv == UNDEF)
                         DIE(aTHX_ PL_no_helem_sv, SVfARG(keysv));
                     break;
                 }
@@ -4007,7 +4176,6 @@ PP(pp_multideref)
                     bool preeminent = TRUE;
                     SV **svp;
                     HV * const hv = (HV*)sv;
-                    HE* he;
 
                     if (UNLIKELY(localizing)) {
                         MAGIC *mg;
@@ -4022,8 +4190,7 @@ PP(pp_multideref)
                             preeminent = hv_exists_ent(hv, keysv, 0);
                     }
 
-                    he = hv_fetch_ent(hv, keysv, lval && !defer, 0);
-                    svp = he ? &HeVAL(he) : NULL;
+                    svp = hv_fetch_icache(hv, keysv, items, lval && !defer);
 
 
                     if (lval) {
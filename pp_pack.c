@@ -52,8 +52,54 @@ typedef struct tempsym {
   int      level;    /* () nesting level      */
   STRLEN   strbeg;   /* offset of group start */
   struct tempsym *previous; /* previous group */
+  const struct pack_insn *insn;       /* next compiled symbol  */
+  const struct pack_insn *insnend;    /* one after last symbol */
+  const struct pack_insn *grpinsn;    /* 1st symbol of ()-group */
+  const struct pack_insn *grpinsnend; /* end of ()-group       */
 } tempsym_t;
 
+/* A constant template is parsed only once: S_template_prog() compiles it
+   into an array of the symbols next_symbol() would return, and caches it
+   as ext magic on the template SV.  next_symbol() then replays the array
+   instead of re-scanning the text on every call.  A ()-group is followed
+   by the grpsize symbols of its body. */
+typedef struct pack_insn {
+  I32      code;     /* template code (!<>)   */
+  howlen_t howlen;   /* how length is given   */
+  SSize_t  length;   /* length/repeat count   */
+  U32      grpsize;  /* symbols in ()-group   */
+  U8       slash;    /* followed by /         */
+  U8       fixed;    /* PACK_FIXED_* kind     */
+  U8       size;     /* bytes per item        */
+  U8       swap;     /* reverse item bytes    */
+} pack_insn_t;
+
+/* The kinds of symbol S_unpack_fixed() decodes */
+#define PACK_FIXED_NONE   0
+#define PACK_FIXED_SKIP   1	/* x */
+#define PACK_FIXED_STRING 2	/* a A Z */
+#define PACK_FIXED_INT    3
+#define PACK_FIXED_UINT   4
+#define PACK_FIXED_FLOAT  5
+#define PACK_FIXED_DOUBLE 6
+
+typedef struct pack_prog {
+  U32      flags;       /* PACK_PROG_* */
+  U32      ninsns;
+  STRLEN   patlen;      /* the template text follows the symbols */
+  SSize_t  fixed_size;  /* bytes read by S_unpack_fixed() */
+  SSize_t  fixed_items; /* values pushed by it */
+  pack_insn_t insns[1];
+} pack_prog_t;
+
+#define PACK_PROG_OK        0x01	/* template could be compiled */
+#define PACK_PROG_NEED_UTF8 0x02	/* need_utf8() */
+#define PACK_PROG_FIRST_U   0x04	/* first_symbol() == 'U' */
+#define PACK_PROG_FIXED     0x08	/* only fixed-size symbols */
+#define PACK_PROG_FIXED_STAR 0x10	/* and the last one has count * */
+
+#define PACK_PROG_TEXT(prog) ((const char *)((prog)->insns + (prog)->ninsns))
+
 #define TEMPSYM_INIT(symptr, p, e, f) \
     STMT_START {	\
 	(symptr)->patptr   = (p);	\
@@ -68,6 +114,10 @@ typedef struct tempsym {
 	(symptr)->flags    = (f);	\
 	(symptr)->strbeg   = 0;		\
 	(symptr)->previous = NULL;	\
+	(symptr)->insn     = NULL;	\
+	(symptr)->insnend  = NULL;	\
+	(symptr)->grpinsn  = NULL;	\
+	(symptr)->grpinsnend = NULL;	\
    } STMT_END
 
 typedef union {
@@ -532,6 +582,33 @@ S_measure_struct(pTHX_ tempsym_t* symptr)
 }
 
 
+/* as group_end, but returns NULL instead of croaking */
+STATIC const char *
+S_find_group_end(const char *patptr, const char *patend, char ender)
+{
+    PERL_ARGS_ASSERT_FIND_GROUP_END;
+
+    while (patptr < patend) {
+	const char c = *patptr++;
+
+	if (isSPACE(c))
+	    continue;
+	else if (c == ender)
+	    return patptr-1;
+	else if (c == '#') {
+	    while (patptr < patend && *patptr != '\n')
+		patptr++;
+	    continue;
+	} else if (c == '(' || c == '[') {
+	    patptr = find_group_end(patptr, patend, c == '(' ? ')' : ']');
+	    if (!patptr)
+		return NULL;
+	    patptr++;
+	}
+    }
+    return NULL;
+}
+
 /* locate matching closing parenthesis or bracket
  * returns char pointer to char after match, or NULL
  */
@@ -596,6 +673,25 @@ S_next_symbol(pTHX_ tempsym_t* symptr )
 
   symptr->flags &= ~FLAG_SLASH;
 
+  if (symptr->insn) {
+    /* replay a compiled template */
+    const pack_insn_t * const insn = symptr->insn;
+    if (insn >= symptr->insnend)
+      return FALSE;
+    symptr->code = insn->code;
+    symptr->howlen = insn->howlen;
+    if (insn->howlen != e_star)
+      symptr->length = insn->length;
+    if (insn->slash)
+      symptr->flags |= FLAG_SLASH;
+    symptr->insn = insn + 1;
+    if (TYPE_NO_MODIFIERS(insn->code) == '(') {
+      symptr->grpinsn = insn + 1;
+      symptr->insn = symptr->grpinsnend = insn + 1 + insn->grpsize;
+    }
+    return TRUE;
+  }
+
   while (patptr < patend) {
     if (isSPACE(*patptr))
       patptr++;
@@ -758,6 +854,173 @@ S_next_symbol(pTHX_ tempsym_t* symptr )
   return FALSE;
 }
 
+/* as get_num, but returns NULL on overflow */
+STATIC const char *
+S_compile_num(const char *patptr, SSize_t *lenptr)
+{
+  SSize_t len = *patptr++ - '0';
+
+  PERL_ARGS_ASSERT_COMPILE_NUM;
+
+  while (isDIGIT(*patptr)) {
+    SSize_t nlen = (len * 10) + (*patptr++ - '0');
+    if (nlen < 0 || nlen/10 != len)
+      return NULL;
+    len = nlen;
+  }
+  *lenptr = len;
+  return patptr;
+}
+
+/* Compile the template patptr..patend into the symbols next_symbol()
+ * would return for it, stored at insn.  Mirrors next_symbol(), but gives
+ * up by returning -1 wherever that would croak or warn, so that such
+ * templates keep being diagnosed on every call.  Also gives up on []
+ * counts that need measure_struct().  Returns the number of symbols.
+ */
+STATIC SSize_t
+S_compile_template(const char *patptr, const char *patend,
+                   pack_insn_t *insn, U32 group_flags, int level)
+{
+  pack_insn_t * const start = insn;
+
+  PERL_ARGS_ASSERT_COMPILE_TEMPLATE;
+
+  while (patptr < patend) {
+    if (isSPACE(*patptr))
+      patptr++;
+    else if (*patptr == '#') {
+      patptr++;
+      while (patptr < patend && *patptr != '\n')
+	patptr++;
+      if (patptr < patend)
+	patptr++;
+    } else {
+      I32 code = *patptr++ & 0xFF;
+      U32 inherited_modifiers = 0;
+      const char *grpbeg = NULL;
+      const char *grpend = NULL;
+
+      if (code == ',')
+        return -1;
+
+      if (code == '(') {
+        if (patptr < patend
+            && (isDIGIT(*patptr) || *patptr == '*' || *patptr == '['))
+          return -1;
+        grpbeg = patptr;
+        grpend = find_group_end(patptr, patend, ')');
+        if (!grpend || level >= MAX_SUB_TEMPLATE_LEVEL)
+          return -1;
+        patptr = grpend + 1;
+      }
+
+      if (TYPE_ENDIANNESS(group_flags)) {
+        if (strchr(ENDIANNESS_ALLOWED_TYPES, TYPE_NO_MODIFIERS(code)))
+          inherited_modifiers |= TYPE_ENDIANNESS(group_flags);
+      }
+
+      while (patptr < patend) {
+        const char *allowed;
+        I32 modifier;
+        switch (*patptr) {
+          case '!':
+            modifier = TYPE_IS_SHRIEKING;
+            allowed = "sSiIlLxXnNvV@.";
+            break;
+          case '>':
+            modifier = TYPE_IS_BIG_ENDIAN;
+            allowed = ENDIANNESS_ALLOWED_TYPES;
+            break;
+          case '<':
+            modifier = TYPE_IS_LITTLE_ENDIAN;
+            allowed = ENDIANNESS_ALLOWED_TYPES;
+            break;
+          default:
+            allowed = "";
+            modifier = 0;
+            break;
+        }
+
+        if (modifier == 0)
+          break;
+        if (!strchr(allowed, TYPE_NO_MODIFIERS(code))
+            || TYPE_ENDIANNESS(code | modifier | inherited_modifiers)
+               == TYPE_ENDIANNESS_MASK
+            || (code & modifier))
+          return -1;
+        code |= modifier;
+        patptr++;
+      }
+
+      code |= inherited_modifiers;
+
+      insn->code = code;
+      insn->howlen = e_no_len;
+      insn->length = 1;
+      insn->grpsize = 0;
+      insn->slash = 0;
+      insn->fixed = PACK_FIXED_NONE;
+      insn->size = 0;
+      insn->swap = 0;
+
+      if (patptr < patend) {
+        if (isDIGIT(*patptr)) {
+          patptr = compile_num(patptr, &insn->length);
+          if (!patptr)
+            return -1;
+          insn->howlen = e_number;
+        } else if (*patptr == '*') {
+          patptr++;
+          insn->howlen = e_star;
+        } else if (*patptr == '[') {
+          const char *lenptr = ++patptr;
+          patptr = find_group_end(patptr, patend, ']');
+          if (!patptr || !isDIGIT(*lenptr))
+            return -1;
+          patptr++;
+          lenptr = compile_num(lenptr, &insn->length);
+          if (!lenptr || *lenptr != ']')
+            return -1;
+          insn->howlen = e_number;
+        }
+
+        while (patptr < patend) {
+          if (isSPACE(*patptr))
+            patptr++;
+          else if (*patptr == '#') {
+            patptr++;
+            while (patptr < patend && *patptr != '\n')
+	      patptr++;
+            if (patptr < patend)
+	      patptr++;
+          } else {
+            if (*patptr == '/') {
+              insn->slash = 1;
+              patptr++;
+              if (patptr < patend &&
+                  (isDIGIT(*patptr) || *patptr == '*' || *patptr == '['))
+                return -1;
+            }
+            break;
+	  }
+	}
+      }
+
+      insn++;
+      if (grpbeg) {
+        const SSize_t n = compile_template(grpbeg, grpend, insn,
+                                           TYPE_ENDIANNESS(code), level + 1);
+        if (n < 0)
+          return -1;
+        insn[-1].grpsize = (U32)n;
+        insn += n;
+      }
+    }
+  }
+  return insn - start;
+}
+
 /*
    There is no way to cleanly handle the case where we should process the
    string per byte in its upgraded form while it's really in downgraded form
@@ -801,6 +1064,334 @@ first_symbol(const char *pat, const char *patend) {
     return 0;
 }
 
+/* Decide whether S_unpack_fixed() can decode every symbol of prog, and
+   how.  It handles templates made only of fixed-size numbers, a A Z and
+   x with explicit or implied counts, where the last number may also
+   have a * count. */
+STATIC void
+S_classify_fixed(pack_prog_t *prog)
+{
+    pack_insn_t *insn = prog->insns;
+    pack_insn_t * const insnend = insn + prog->ninsns;
+    SSize_t total = 0;
+    SSize_t items = 0;
+
+    PERL_ARGS_ASSERT_CLASSIFY_FIXED;
+
+    if (prog->flags & PACK_PROG_NEED_UTF8)
+        return;
+    for (; insn < insnend; insn++) {
+        const I32 code = insn->code;
+        const packprops_t props = packprops[TYPE_NO_ENDIANNESS(code)];
+        SSize_t size = props & PACK_SIZE_MASK;
+        U8 kind;
+
+        if (insn->slash)
+            return;
+        switch (TYPE_NO_ENDIANNESS(code)) {
+        case 'x':
+            kind = PACK_FIXED_SKIP;
+            size = 1;
+            break;
+        case 'a': case 'A': case 'Z':
+            kind = PACK_FIXED_STRING;
+            size = 1;
+            break;
+        case 'C':
+            if (insn->length == 0)	/* switches to character mode */
+                return;
+            /* FALLTHROUGH */
+        case 'S': case 'S' | TYPE_IS_SHRIEKING:
+        case 'I': case 'I' | TYPE_IS_SHRIEKING:
+        case 'L': case 'L' | TYPE_IS_SHRIEKING:
+        case 'J': case 'n': case 'N': case 'v': case 'V':
+#if IVSIZE >= 8
+        case 'Q':
+#endif
+            kind = PACK_FIXED_UINT;
+            break;
+        case 'c':
+        case 's': case 's' | TYPE_IS_SHRIEKING:
+        case 'i': case 'i' | TYPE_IS_SHRIEKING:
+        case 'l': case 'l' | TYPE_IS_SHRIEKING:
+        case 'j':
+        case 'n' | TYPE_IS_SHRIEKING: case 'N' | TYPE_IS_SHRIEKING:
+        case 'v' | TYPE_IS_SHRIEKING: case 'V' | TYPE_IS_SHRIEKING:
+#if IVSIZE >= 8
+        case 'q':
+#endif
+            kind = PACK_FIXED_INT;
+            break;
+        case 'f':
+            kind = PACK_FIXED_FLOAT;
+            break;
+        case 'd':
+            kind = PACK_FIXED_DOUBLE;
+            break;
+        default:
+            return;
+        }
+        if (kind == PACK_FIXED_INT || kind == PACK_FIXED_UINT) {
+            if (!(size == 1 || (size == 2 && U16SIZE == 2)
+                  || (size == 4 && U32SIZE == 4) || (size == 8 && UVSIZE == 8)))
+                return;
+        }
+        switch (TYPE_NO_MODIFIERS(code)) {
+        case 'n': case 'N':
+#if BYTEORDER == 0x1234 || BYTEORDER == 0x12345678
+            insn->swap = 1;
+#endif
+            break;
+        case 'v': case 'V':
+#if BYTEORDER == 0x4321 || BYTEORDER == 0x87654321
+            insn->swap = 1;
+#endif
+            break;
+        default:
+            insn->swap = NEEDS_SWAP(code);
+            break;
+        }
+        if (!size)
+            return;
+        insn->fixed = kind;
+        insn->size = (U8)size;
+        if (insn->howlen == e_star) {
+            if (insn + 1 < insnend || kind == PACK_FIXED_SKIP
+                || kind == PACK_FIXED_STRING)
+                return;
+            prog->flags |= PACK_PROG_FIXED_STAR;
+            break;
+        }
+        if (insn->length > (SSize_t_MAX - total) / size)
+            return;
+        total += insn->length * size;
+        items += kind == PACK_FIXED_STRING ? 1
+               : kind == PACK_FIXED_SKIP   ? 0 : insn->length;
+    }
+    prog->fixed_size = total;
+    prog->fixed_items = items;
+    prog->flags |= PACK_PROG_FIXED;
+}
+
+static const MGVTBL vtbl_pack_prog = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+/* Returns the compiled form of a constant template, compiling it on first
+   use, or NULL if the template is not constant or cannot be compiled.
+   The result is kept as PERL_MAGIC_ext on the template SV, so it lives
+   and is cloned along with the op's constant. */
+STATIC const pack_prog_t *
+S_template_prog(pTHX_ SV *pat_sv)
+{
+    const char *pat;
+    STRLEN patlen;
+    const pack_prog_t *prog;
+    pack_prog_t *newprog;
+    SV *progsv;
+    SSize_t n;
+
+    PERL_ARGS_ASSERT_TEMPLATE_PROG;
+
+    if (!SvREADONLY(pat_sv) || !SvPOK(pat_sv) || SvGMAGICAL(pat_sv)
+        || SvIMMORTAL(pat_sv))
+        return NULL;
+    pat = SvPVX_const(pat_sv);
+    patlen = SvCUR(pat_sv);
+    if (SvRMAGICAL(pat_sv)) {
+        const MAGIC * const mg =
+            mg_findext(pat_sv, PERL_MAGIC_ext, &vtbl_pack_prog);
+        if (mg) {
+            prog = (const pack_prog_t *)SvPVX_const(mg->mg_obj);
+            /* The text is checked in case the SV was made writable and
+               changed in between */
+            if ((prog->flags & PACK_PROG_OK) && prog->patlen == patlen
+                && memEQ(PACK_PROG_TEXT(prog), pat, patlen))
+                return prog;
+            return NULL;
+        }
+    }
+
+    /* every symbol takes at least one byte of the text */
+    progsv = newSV(sizeof(pack_prog_t) + patlen * sizeof(pack_insn_t) + patlen);
+    SvPOK_on(progsv);
+    newprog = (pack_prog_t *)SvPVX(progsv);
+    Zero(newprog, 1, pack_prog_t);
+    n = compile_template(pat, pat + patlen, newprog->insns, 0, 0);
+    if (n >= 0) {
+        newprog->flags = PACK_PROG_OK;
+        newprog->ninsns = (U32)n;
+        if (need_utf8(pat, pat + patlen))
+            newprog->flags |= PACK_PROG_NEED_UTF8;
+        if (first_symbol(pat, pat + patlen) == 'U')
+            newprog->flags |= PACK_PROG_FIRST_U;
+        classify_fixed(newprog);
+    }
+    newprog->patlen = patlen;
+    Copy(pat, (char *)PACK_PROG_TEXT(newprog), patlen, char);
+    SvCUR_set(progsv, PACK_PROG_TEXT(newprog) + patlen - (char *)newprog);
+    SvPV_shrink_to_cur(progsv);
+    newprog = (pack_prog_t *)SvPVX(progsv);
+    sv_magicext(pat_sv, progsv, PERL_MAGIC_ext, &vtbl_pack_prog, NULL, 0);
+    SvREFCNT_dec_NN(progsv);
+    return newprog->flags & PACK_PROG_OK ? newprog : NULL;
+}
+
+/* Straight-line unpack of a template classify_fixed() accepted, from
+   bytes that are known to hold all of fixed_size.  Behaves like
+   unpack_rec() on such templates, without its bounds and checksum
+   tests.  With an av the values are stored into it instead of being
+   pushed as mortals, see S_unpack_assign(). */
+STATIC SSize_t
+S_unpack_fixed(pTHX_ const pack_prog_t *prog, const char *s, const char *strend, U32 flags, AV *av)
+{
+    dSP;
+    const pack_insn_t *insn = prog->insns;
+    const pack_insn_t * const insnend = insn + prog->ninsns;
+    const bool unpack_only_one = (flags & FLAG_UNPACK_ONLY_ONE) != 0;
+    SSize_t items = prog->fixed_items;
+    SV **base;
+    SV **dst;
+
+    PERL_ARGS_ASSERT_UNPACK_FIXED;
+
+    if (prog->flags & PACK_PROG_FIXED_STAR)
+        items += (strend - s - prog->fixed_size) / insnend[-1].size;
+    if (unpack_only_one && items)
+        items = 1;
+    if (av) {
+        if (items)
+            av_extend(av, items - 1);
+        base = dst = AvARRAY(av);
+    }
+    else {
+        EXTEND(SP, items);
+        EXTEND_MORTAL(items);
+        base = dst = SP + 1;
+    }
+
+/* The new SV is owned by the array or the tmps stack as soon as it is
+   stored */
+#define FIXED_STORE(nsv) STMT_START {                   \
+        SV * const _nsv = (nsv);                        \
+        if (av)                                         \
+            AvFILLp(av)++;                              \
+        else {                                          \
+            PL_tmps_stack[++PL_tmps_ix] = _nsv;         \
+            SvTEMP_on(_nsv);                            \
+        }                                               \
+        *dst++ = _nsv;                                  \
+    } STMT_END
+
+    for (; insn < insnend; insn++) {
+        SSize_t len = insn->length;
+        const STRLEN size = insn->size;
+        const I32 datumtype = insn->code;
+
+        if (unpack_only_one && dst > base)
+            break;
+        switch (insn->fixed) {
+        case PACK_FIXED_SKIP:
+            s += len;
+            break;
+        case PACK_FIXED_STRING: {
+            const char *ptr;
+            if (datumtype == 'Z') {
+                const char * const end = s + len;
+                for (ptr = s; ptr < end; ptr++) if (*ptr == 0) break;
+            } else if (datumtype == 'A') {
+                for (ptr = s+len-1; ptr >= s; ptr--)
+                    if (*ptr != 0 && !isSPACE(*ptr)) break;
+                ptr++;
+            } else
+                ptr = s + len;
+            FIXED_STORE(newSVpvn(s, ptr-s));
+            s += len;
+            break;
+        }
+        default:
+            if (insn->howlen == e_star)
+                len = (strend - s) / size;
+            if (len && unpack_only_one) len = 1;
+            while (len-- > 0) {
+                union {
+                    U8 bytes[8];
+                    U8 u8;
+                    U16 u16;
+                    U32 u32;
+                    UV uv;
+                    float f;
+                    double d;
+                } v;
+                SV *nsv;
+                if (UNLIKELY(insn->swap))
+                    S_reverse_copy(s, (char *)v.bytes, size);
+                else
+                    Copy(s, v.bytes, size, char);
+                s += size;
+                switch (insn->fixed) {
+                case PACK_FIXED_FLOAT:
+                    nsv = newSVnv(v.f);
+                    break;
+                case PACK_FIXED_DOUBLE:
+                    nsv = newSVnv(v.d);
+                    break;
+                case PACK_FIXED_INT:
+                    nsv = newSViv(size == 1 ? (IV)(I8)v.u8
+                                : size == 2 ? (IV)(I16)v.u16
+                                : size == 4 ? (IV)(I32)v.u32
+                                : (IV)v.uv);
+                    break;
+                default:
+                    nsv = newSVuv(size == 1 ? (UV)v.u8
+                                : size == 2 ? (UV)v.u16
+                                : size == 4 ? (UV)v.u32
+                                : v.uv);
+                    break;
+                }
+                FIXED_STORE(nsv);
+            }
+            break;
+        }
+    }
+#undef FIXED_STORE
+    if (!av)
+        PL_stack_sp = dst - 1;
+    return dst - base;
+}
+
+/* @lex = unpack(...) flagged OPpUNPACK_ASSIGN by rpeep(): replaces the
+   array's contents with the unpacked values, without putting them on
+   the stack or copying them, and returns the op after the aassign.
+   Returns NULL if the template or the array does not allow this; the
+   caller then unpacks as usual and the pushmark, padav and aassign ops
+   following it do the assignment. */
+STATIC OP *
+S_unpack_assign(pTHX_ const pack_prog_t *prog, SV *left, SV *right, const char *s, const char *strend)
+{
+    const OP * const padav = PL_op->op_next->op_next;
+    AV *av;
+
+    PERL_ARGS_ASSERT_UNPACK_ASSIGN;
+
+    if (!prog || !(prog->flags & PACK_PROG_FIXED) || DO_UTF8(right)
+        || strend - s < prog->fixed_size || TAINTING_get)
+        return NULL;
+    av = MUTABLE_AV(PAD_SVl(padav->op_targ));
+    if (SvMAGICAL(av) || SvREADONLY(av) || !AvREAL(av) || AvSHAPED(av))
+        return NULL;
+
+    if (padav->op_private & OPpLVAL_INTRO)
+        SAVECLEARSV(PAD_SVl(padav->op_targ));
+    if (AvFILLp(av) >= 0) {
+        /* the template or string may be elements of the array */
+        sv_2mortal(SvREFCNT_inc_simple_NN(left));
+        sv_2mortal(SvREFCNT_inc_simple_NN(right));
+        av_clear(av);
+    }
+    PL_stack_sp = PL_stack_base + POPMARK;
+    (void)unpack_fixed(prog, s, strend, 0, av);
+    return padav->op_next->op_next;
+}
+
 /*
 
 =head1 Pack and Unpack
@@ -827,13 +1418,27 @@ example).
 
 SSize_t
 Perl_unpackstring(pTHX_ const char *pat, const char *patend, const char *s, const char *strend, U32 flags)
+{
+    PERL_ARGS_ASSERT_UNPACKSTRING;
+
+    return unpackstring_prog(NULL, pat, patend, s, strend, flags);
+}
+
+/* unpackstring(), replaying prog if the template has been compiled */
+STATIC SSize_t
+S_unpackstring_prog(pTHX_ const pack_prog_t *prog, const char *pat, const char *patend, const char *s, const char *strend, U32 flags)
 {
     tempsym_t sym;
 
-    PERL_ARGS_ASSERT_UNPACKSTRING;
+    PERL_ARGS_ASSERT_UNPACKSTRING_PROG;
+
+    if (prog && (prog->flags & PACK_PROG_FIXED) && !(flags & FLAG_DO_UTF8)
+        && strend - s >= prog->fixed_size)
+        return unpack_fixed(prog, s, strend, flags, NULL);
 
     if (flags & FLAG_DO_UTF8) flags |= FLAG_WAS_UTF8;
-    else if (need_utf8(pat, patend)) {
+    else if (prog ? (prog->flags & PACK_PROG_NEED_UTF8)
+                  : need_utf8(pat, patend)) {
 	/* We probably should try to avoid this in case a scalar context call
 	   wouldn't get to the "U0" */
 	STRLEN len = strend - s;
@@ -843,10 +1448,16 @@ Perl_unpackstring(pTHX_ const char *pat, const char *patend, const char *s, cons
 	flags |= FLAG_DO_UTF8;
     }
 
-    if (first_symbol(pat, patend) != 'U' && (flags & FLAG_DO_UTF8))
+    if ((flags & FLAG_DO_UTF8)
+        && !(prog ? (prog->flags & PACK_PROG_FIRST_U)
+                  : first_symbol(pat, patend) == 'U'))
 	flags |= FLAG_PARSE_UTF8;
 
     TEMPSYM_INIT(&sym, pat, patend, flags);
+    if (prog) {
+        sym.insn = prog->insns;
+        sym.insnend = prog->insns + prog->ninsns;
+    }
 
     return unpack_rec(&sym, s, s, strend, NULL );
 }
@@ -933,12 +1544,14 @@ S_unpack_rec(pTHX_ tempsym_t* symptr, const char *s, const char *strbeg, const c
             const U32 group_modifiers = TYPE_MODIFIERS(datumtype & ~symptr->flags);
 	    symptr->flags |= group_modifiers;
             symptr->patend = savsym.grpend;
+            symptr->insnend = savsym.grpinsnend;
 	    symptr->previous = &savsym;
             symptr->level++;
 	    PUTBACK;
 	    if (len && unpack_only_one) len = 1;
 	    while (len--) {
   	        symptr->patptr = savsym.grpbeg;
+	        symptr->insn = savsym.grpinsn;
 		if (utf8) symptr->flags |=  FLAG_PARSE_UTF8;
 		else      symptr->flags &= ~FLAG_PARSE_UTF8;
  	        unpack_rec(symptr, s, strbeg, strend, &s);
@@ -1857,10 +2470,16 @@ PP(pp_unpack)
     const char *s   = SvPV_const(right, rlen);
     const char *strend = s + rlen;
     const char *patend = pat + llen;
+    const pack_prog_t * const prog = template_prog(left);
     SSize_t cnt;
 
     PUTBACK;
-    cnt = unpackstring(pat, patend, s, strend,
+    if (UNLIKELY(PL_op->op_private & OPpUNPACK_ASSIGN)) {
+        OP * const next = unpack_assign(prog, left, right, s, strend);
+        if (next)
+            return next;
+    }
+    cnt = unpackstring_prog(prog, pat, patend, s, strend,
 		     ((gimme == G_SCALAR) ? FLAG_UNPACK_ONLY_ONE : 0)
 		     | (DO_UTF8(right) ? FLAG_DO_UTF8 : 0));
 
@@ -1979,12 +2598,25 @@ The engine implementing C<pack()> Perl function.
 
 void
 Perl_packlist(pTHX_ SV *cat, const char *pat, const char *patend, SV **beglist, SV **endlist )
+{
+    PERL_ARGS_ASSERT_PACKLIST;
+
+    packlist_prog(cat, NULL, pat, patend, beglist, endlist);
+}
+
+/* packlist(), replaying prog if the template has been compiled */
+STATIC void
+S_packlist_prog(pTHX_ SV *cat, const pack_prog_t *prog, const char *pat, const char *patend, SV **beglist, SV **endlist )
 {
     tempsym_t sym;
 
-    PERL_ARGS_ASSERT_PACKLIST;
+    PERL_ARGS_ASSERT_PACKLIST_PROG;
 
     TEMPSYM_INIT(&sym, pat, patend, FLAG_PACK);
+    if (prog) {
+        sym.insn = prog->insns;
+        sym.insnend = prog->insns + prog->ninsns;
+    }
 
     /* We're going to do changes through SvPVX(cat). Make sure it's valid.
        Also make sure any UTF8 flag is loaded */
@@ -2245,6 +2877,7 @@ S_pack_rec(pTHX_ SV *cat, tempsym_t* symptr, SV **beglist, SV **endlist )
 	    U32 group_modifiers = TYPE_MODIFIERS(datumtype & ~symptr->flags);
 	    symptr->flags |= group_modifiers;
             symptr->patend = savsym.grpend;
+            symptr->insnend = savsym.grpinsnend;
             symptr->level++;
 	    symptr->previous = &lookahead;
 	    while (len--) {
@@ -2253,6 +2886,7 @@ S_pack_rec(pTHX_ SV *cat, tempsym_t* symptr, SV **beglist, SV **endlist )
 		else      symptr->flags &= ~FLAG_PARSE_UTF8;
 		was_utf8 = SvUTF8(cat);
   	        symptr->patptr = savsym.grpbeg;
+	        symptr->insn = savsym.grpinsn;
 		beglist = pack_rec(cat, symptr, beglist, endlist);
 		if (SvUTF8(cat) != was_utf8)
 		    /* This had better be an upgrade while in utf8==0 mode */
@@ -3151,7 +3785,7 @@ PP(pp_pack)
     SvPVCLEAR(cat);
     SvUTF8_off(cat);
 
-    packlist(cat, pat, patend, MARK, SP + 1);
+    packlist_prog(cat, template_prog(pat_sv), pat, patend, MARK, SP + 1);
 
     if (SvUTF8(cat)) {
         STRLEN result_len;
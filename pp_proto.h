@@ -61,6 +61,7 @@ PERL_CALLCONV OP *Perl_pp_enter(pTHX);
 PERL_CALLCONV OP *Perl_pp_entereval(pTHX);
 PERL_CALLCONV OP *Perl_pp_enterffi(pTHX);
 PERL_CALLCONV OP *Perl_pp_entergiven(pTHX);
+PERL_CALLCONV OP *Perl_pp_enterinline(pTHX);
 PERL_CALLCONV OP *Perl_pp_enteriter(pTHX);
 PERL_CALLCONV OP *Perl_pp_enterloop(pTHX);
 PERL_CALLCONV OP *Perl_pp_entersub(pTHX);
@@ -137,7 +138,6 @@ PERL_CALLCONV OP *Perl_pp_iter(pTHX);
 PERL_CALLCONV OP *Perl_pp_iter_ary(pTHX);
 PERL_CALLCONV OP *Perl_pp_iter_lazyiv(pTHX);
 PERL_CALLCONV OP *Perl_pp_join(pTHX);
-PERL_CALLCONV OP *Perl_pp_keepstate(pTHX);
 PERL_CALLCONV OP *Perl_pp_kvaslice(pTHX);
 PERL_CALLCONV OP *Perl_pp_kvhslice(pTHX);
 PERL_CALLCONV OP *Perl_pp_last(pTHX);
@@ -146,6 +146,7 @@ PERL_CALLCONV OP *Perl_pp_le(pTHX);
 PERL_CALLCONV OP *Perl_pp_leave(pTHX);
 PERL_CALLCONV OP *Perl_pp_leaveeval(pTHX);
 PERL_CALLCONV OP *Perl_pp_leavegiven(pTHX);
+PERL_CALLCONV OP *Perl_pp_leaveinline(pTHX);
 PERL_CALLCONV OP *Perl_pp_leaveloop(pTHX);
 PERL_CALLCONV OP *Perl_pp_leavesub(pTHX);
 PERL_CALLCONV OP *Perl_pp_leavesublv(pTHX);
@@ -250,7 +251,6 @@ PERL_CALLCONV OP *Perl_pp_semctl(pTHX);
 PERL_CALLCONV OP *Perl_pp_semget(pTHX);
 PERL_CALLCONV OP *Perl_pp_setpgrp(pTHX);
 PERL_CALLCONV OP *Perl_pp_setpriority(pTHX);
-PERL_CALLCONV OP *Perl_pp_setstate(pTHX);
 PERL_CALLCONV OP *Perl_pp_shift(pTHX);
 PERL_CALLCONV OP *Perl_pp_shmwrite(pTHX);
 PERL_CALLCONV OP *Perl_pp_shostent(pTHX);
@@ -0,0 +1 @@
+pp.c
\ No newline at end of file
@@ -224,6 +224,41 @@ PERL_CALLCONV UV	Perl__to_utf8_upper_flags(pTHX_ const U8 *p, const U8 *e, U8* u
 #define PERL_ARGS_ASSERT__TO_UTF8_UPPER_FLAGS	\
 	assert(p); assert(ustrp); assert(file)
 
+PERL_CALLCONV U8 *	Perl__utf8_from_bytes(const U8 *s, const U8 *const e, U8 *d)
+			__attribute__global__
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(1)
+			__attribute__nonnull__(2)
+			__attribute__nonnull__(3);
+#define PERL_ARGS_ASSERT__UTF8_FROM_BYTES	\
+	assert(s); assert(e); assert(d)
+
+PERL_CALLCONV const U8 *	Perl__utf8_from_bytes_back(const U8 *const s, const U8 *e, U8 **dendp)
+			__attribute__global__
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(1)
+			__attribute__nonnull__(2)
+			__attribute__nonnull__(3);
+#define PERL_ARGS_ASSERT__UTF8_FROM_BYTES_BACK	\
+	assert(s); assert(e); assert(dendp)
+
+PERL_CALLCONV const U8 *	Perl__utf8_to_bytes_prefix(const U8 *s, const U8 *const e, U8 **dp)
+			__attribute__global__
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(1)
+			__attribute__nonnull__(2);
+#define PERL_ARGS_ASSERT__UTF8_TO_BYTES_PREFIX	\
+	assert(s); assert(e)
+
+PERL_CALLCONV const U8 *	Perl__utf8_valid_prefix(const U8 *s, const U8 *e, STRLEN *count, const U32 flags)
+			__attribute__global__
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(1)
+			__attribute__nonnull__(2)
+			__attribute__nonnull__(3);
+#define PERL_ARGS_ASSERT__UTF8_VALID_PREFIX	\
+	assert(s); assert(e); assert(count)
+
 PERL_CALLCONV UV	Perl__utf8n_to_uvchr_msgs_helper(const U8 *s, STRLEN curlen, STRLEN *retlen, const U32 flags, U32 * errors, AV ** msgs)
 			__attribute__global__
 			__attribute__nonnull__(1);
@@ -4819,6 +4854,9 @@ PERL_CALLCONV int	Perl_rsignal_save(pTHX_ int i, Sighandler_t t1, Sigsave_t* sav
 PERL_CALLCONV Sighandler_t	Perl_rsignal_state(pTHX_ int i)
 			__attribute__global__;
 
+PERL_CALLCONV int	Perl_runops_cgoto(pTHX)
+			__attribute__global__;
+
 PERL_CALLCONV int	Perl_runops_debug(pTHX)
 			__attribute__global__;
 
@@ -5418,6 +5456,12 @@ PERL_CALLCONV UV	Perl_sv_2uv_flags(pTHX_ SV *const sv, const I32 flags)
 #define PERL_ARGS_ASSERT_SV_2UV_FLAGS	\
 	assert(sv)
 
+PERL_CALLCONV void	Perl_sv_arena_stats(pTHX_ struct sv_arena_stats *st)
+			__attribute__global__
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_SV_ARENA_STATS	\
+	assert(st)
+
 PERL_CALLCONV void	Perl_sv_backoff(SV *const sv)
 			__attribute__global__
 			__attribute__nonnull__(1);
@@ -6136,6 +6180,13 @@ PERL_CALLCONV void	Perl_sv_setuv_mg(pTHX_ SV *const sv, const UV u)
 #define PERL_ARGS_ASSERT_SV_SETUV_MG	\
 	assert(sv)
 
+PERL_CALLCONV bool	Perl_sv_sprintf_const(pTHX_ SV *const sv, SV *const pat_sv, SV **const svargs, const SSize_t sv_count)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2)
+			__attribute__nonnull__(pTHX_3);
+#define PERL_ARGS_ASSERT_SV_SPRINTF_CONST	\
+	assert(sv); assert(pat_sv); assert(svargs)
+
 PERL_CALLCONV SV*	Perl_sv_string_from_errnum(pTHX_ int errnum, SV* tgtsv)
 			__attribute__global__;
 
@@ -6154,6 +6205,9 @@ PERL_CALLCONV bool	Perl_sv_tainted(pTHX_ SV *const sv)
 #define PERL_ARGS_ASSERT_SV_TAINTED	\
 	assert(sv)
 
+PERL_CALLCONV Size_t	Perl_sv_trim_arenas(pTHX)
+			__attribute__global__;
+
 PERL_CALLCONV I32	Perl_sv_true(pTHX_ SV *const sv)
 			__attribute__global__;
 
@@ -7878,6 +7932,22 @@ STATIC void	S_maybe_op_signature(pTHX_ CV *cv, OP *o)
 	assert(cv); assert(o)
 
 #    endif
+#  endif
+#endif
+#if defined(PERL_GLOBAL_STRTAB)
+#  if defined(USE_ITHREADS)
+PERL_CALLCONV HEK*	Perl_strtab_hek_inc(const HEK *hek)
+			__attribute__global__
+			__attribute__nonnull__(1);
+#define PERL_ARGS_ASSERT_STRTAB_HEK_INC	\
+	assert(hek)
+
+PERL_CALLCONV void	Perl_strtab_init(void)
+			__attribute__global__;
+
+PERL_CALLCONV void	Perl_strtab_term(void)
+			__attribute__global__;
+
 #  endif
 #endif
 #if defined(PERL_GLOBAL_STRUCT)
@@ -7909,6 +7979,11 @@ PERL_CALLCONV void*	Perl_my_cxt_init(pTHX_ const char *my_cxt_key, size_t size)
 	assert(my_cxt_key)
 
 #  endif
+#endif
+#if defined(PERL_HASH_FUNC_SELECT)
+PERL_CALLCONV void	Perl_hash_func_select(pTHX_ const char *name)
+			__attribute__global__;
+
 #endif
 #if defined(PERL_HASH_RANDOMIZE_KEYS)
 #  if defined(PERL_IN_HV_C)
@@ -8070,17 +8145,31 @@ STATIC bool	S_cv_check_inline(pTHX_ const OP *o, CV *compcv)
 #define PERL_ARGS_ASSERT_CV_CHECK_INLINE	\
 	assert(o); assert(compcv)
 
-STATIC OP*	S_cv_do_inline(pTHX_ OP *parent, OP *o, OP *cvop, CV *cv)
-			__attribute__nonnull__(pTHX_2)
-			__attribute__nonnull__(pTHX_3)
-			__attribute__nonnull__(pTHX_4);
+STATIC OP*	S_cv_do_inline(pTHX_ OP *o, OP *oldop)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2);
 #define PERL_ARGS_ASSERT_CV_DO_INLINE	\
-	assert(o); assert(cvop); assert(cv)
+	assert(o); assert(oldop)
 
-STATIC OP*	S_op_clone_sv(pTHX_ OP* o)
-			__attribute__nonnull__(pTHX_1);
-#define PERL_ARGS_ASSERT_OP_CLONE_SV	\
-	assert(o)
+STATIC bool	S_inline_check_body(pTHX_ const OP *o, CV *cv, PADOFFSET pad_ix, U8 nargs, bool root, int *count)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2)
+			__attribute__nonnull__(pTHX_6);
+#define PERL_ARGS_ASSERT_INLINE_CHECK_BODY	\
+	assert(o); assert(cv); assert(count)
+
+STATIC OP*	S_inline_clone(pTHX_ const OP *o, CV *cv, PADOFFSET pad_ix, U8 nargs, PADOFFSET base, OP ***nextp)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2)
+			__attribute__nonnull__(pTHX_6);
+#define PERL_ARGS_ASSERT_INLINE_CLONE	\
+	assert(o); assert(cv); assert(nextp)
+
+STATIC bool	S_inline_mderef(pTHX_ UNOP_AUX_item *items, CV *cv, PADOFFSET pad_ix, U8 nargs, PADOFFSET base)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2);
+#define PERL_ARGS_ASSERT_INLINE_MDEREF	\
+	assert(items); assert(cv)
 
 #    endif
 #  endif
@@ -8280,6 +8369,12 @@ PERL_CALLCONV void	Perl_sv_add_backref(pTHX_ SV *const tsv, SV *const sv)
 
 #endif
 #if defined(PERL_IN_HV_C)
+STATIC void	S_bucket_chain_stats(pTHX_ HE *const *ents, U32 max, struct hv_stats *st)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_3);
+#define PERL_ARGS_ASSERT_BUCKET_CHAIN_STATS	\
+	assert(ents); assert(st)
+
 STATIC void	S_clear_placeholders(pTHX_ HV *hv, U32 items)
 			__attribute__nonnull__(pTHX_1);
 #define PERL_ARGS_ASSERT_CLEAR_PLACEHOLDERS	\
@@ -8347,11 +8442,21 @@ STATIC void	S_hsplit(pTHX_ HV *hv, U32 const oldsize, U32 newsize)
 #define PERL_ARGS_ASSERT_HSPLIT	\
 	assert(hv)
 
+STATIC void	S_hsplit_bucket(pTHX_ HE **aep, U32 i, U32 newmax)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_HSPLIT_BUCKET	\
+	assert(aep)
+
 STATIC void	S_hsplit_move_aux(pTHX_ HV *hv, U32 const oldsize, U32 newsize)
 			__attribute__nonnull__(pTHX_1);
 #define PERL_ARGS_ASSERT_HSPLIT_MOVE_AUX	\
 	assert(hv)
 
+STATIC void	S_hsplit_step(pTHX_ HV *hv, U32 n)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_HSPLIT_STEP	\
+	assert(hv)
+
 STATIC void *	S_hv_common_magical(pTHX_ HV *hv, SV **keyp, const char* key, const I32 klen, int flags, const int action, SV *val, const U32 hash, int *return_action)
 			__attribute__warn_unused_result__
 			__attribute__nonnull__(pTHX_1)
@@ -8360,12 +8465,91 @@ STATIC void *	S_hv_common_magical(pTHX_ HV *hv, SV **keyp, const char* key, cons
 	assert(hv); assert(return_action)
 
 STATIC SV*	S_hv_delete_common(pTHX_ HV *hv, SV *keysv, const char *key, I32 klen, int k_flags, I32 d_flags, U32 hash);
+STATIC void	S_hv_oindex_build(pTHX_ HV *hv, U32 keys)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_HV_OINDEX_BUILD	\
+	assert(hv)
+
+STATIC void	S_hv_oindex_delete(struct xpvhv_oindex *ox, HE *entry)
+			__attribute__nonnull__(1)
+			__attribute__nonnull__(2);
+#define PERL_ARGS_ASSERT_HV_OINDEX_DELETE	\
+	assert(ox); assert(entry)
+
+STATIC HE*	S_hv_oindex_find(const struct xpvhv_oindex *ox, U32 hash, const char *key, I32 klen, int flags, const HEK *keysv_hek)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(1)
+			__attribute__nonnull__(3);
+#define PERL_ARGS_ASSERT_HV_OINDEX_FIND	\
+	assert(ox); assert(key)
+
+STATIC void	S_hv_oindex_free(pTHX_ HV *hv)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_HV_OINDEX_FREE	\
+	assert(hv)
+
+STATIC void	S_hv_oindex_insert(pTHX_ HV *hv, HE *entry)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2);
+#define PERL_ARGS_ASSERT_HV_OINDEX_INSERT	\
+	assert(hv); assert(entry)
+
+#ifndef PERL_NO_INLINE_FUNCTIONS
+PERL_STATIC_INLINE U32	S_hv_oindex_prefix(const char *key, I32 klen)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(1);
+#define PERL_ARGS_ASSERT_HV_OINDEX_PREFIX	\
+	assert(key)
+#endif
+
+STATIC struct xpvhv_perfect*	S_hv_perfect_build(pTHX_ HV *hv)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_HV_PERFECT_BUILD	\
+	assert(hv)
+
+STATIC void	S_hv_perfect_free(pTHX_ HV *hv)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_HV_PERFECT_FREE	\
+	assert(hv)
+
+STATIC void	S_hv_shape_dec(pTHX_ struct hv_shape *shape)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_HV_SHAPE_DEC	\
+	assert(shape)
+
+STATIC void	S_hv_shape_free(pTHX_ HV *hv)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_HV_SHAPE_FREE	\
+	assert(hv)
+
+STATIC I32	S_hv_shape_index(const struct hv_shape *shape, U32 hash, const char *key, I32 klen, int flags, const HEK *keysv_hek)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(1)
+			__attribute__nonnull__(3);
+#define PERL_ARGS_ASSERT_HV_SHAPE_INDEX	\
+	assert(shape); assert(key)
+
 STATIC HEK*	S_share_hek_flags(pTHX_ const char *str, I32 len, U32 hash, int flags)
 			__attribute__warn_unused_result__
 			__attribute__nonnull__(pTHX_1);
 #define PERL_ARGS_ASSERT_SHARE_HEK_FLAGS	\
 	assert(str)
 
+#  endif
+#  if defined(USE_ITHREADS) && defined(PERL_GLOBAL_STRTAB)
+STATIC HEK*	S_share_hek_global(pTHX_ const char *str, I32 len, U32 hash, int flags)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_SHARE_HEK_GLOBAL	\
+	assert(str)
+
+STATIC void	S_strtab_stripe_split(struct strtab_stripe *ss)
+			__attribute__nonnull__(1);
+#define PERL_ARGS_ASSERT_STRTAB_STRIPE_SPLIT	\
+	assert(ss)
+
+STATIC bool	S_unshare_hek_global(pTHX_ const HE *he_he, const char *str, I32 len, U32 hash, int k_flags);
 #  endif
 #endif
 #if defined(PERL_IN_HV_C) && defined(DEBUGGING)
@@ -9238,6 +9422,15 @@ STATIC void	S_do_oddball(pTHX_ SV **oddkey, SV **firstkey)
 #define PERL_ARGS_ASSERT_DO_ODDBALL	\
 	assert(oddkey); assert(firstkey)
 
+#ifndef PERL_NO_INLINE_FUNCTIONS
+PERL_STATIC_INLINE SV**	S_hv_fetch_icache(pTHX_ HV *hv, SV *keysv, const void *site, const U32 lval)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2)
+			__attribute__nonnull__(pTHX_3);
+#define PERL_ARGS_ASSERT_HV_FETCH_ICACHE	\
+	assert(hv); assert(keysv); assert(site)
+#endif
+
 #ifndef PERL_NO_INLINE_FUNCTIONS
 PERL_STATIC_INLINE HV*	S_opmethod_stash(pTHX_ SV* meth)
 			__attribute__nonnull__(pTHX_1);
@@ -9247,12 +9440,39 @@ PERL_STATIC_INLINE HV*	S_opmethod_stash(pTHX_ SV* meth)
 
 #endif
 #if defined(PERL_IN_PP_PACK_C)
+STATIC void	S_classify_fixed(struct pack_prog *prog)
+			__attribute__nonnull__(1);
+#define PERL_ARGS_ASSERT_CLASSIFY_FIXED	\
+	assert(prog)
+
+STATIC const char *	S_compile_num(const char *patptr, SSize_t *lenptr)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(1)
+			__attribute__nonnull__(2);
+#define PERL_ARGS_ASSERT_COMPILE_NUM	\
+	assert(patptr); assert(lenptr)
+
+STATIC SSize_t	S_compile_template(const char *patptr, const char *patend, struct pack_insn *insn, U32 group_flags, int level)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(1)
+			__attribute__nonnull__(2)
+			__attribute__nonnull__(3);
+#define PERL_ARGS_ASSERT_COMPILE_TEMPLATE	\
+	assert(patptr); assert(patend); assert(insn)
+
 STATIC int	S_div128(pTHX_ SV *pnum, bool *done)
 			__attribute__nonnull__(pTHX_1)
 			__attribute__nonnull__(pTHX_2);
 #define PERL_ARGS_ASSERT_DIV128	\
 	assert(pnum); assert(done)
 
+STATIC const char *	S_find_group_end(const char *patptr, const char *patend, char ender)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(1)
+			__attribute__nonnull__(2);
+#define PERL_ARGS_ASSERT_FIND_GROUP_END	\
+	assert(patptr); assert(patend)
+
 STATIC char	S_first_symbol(const char *pat, const char *patend)
 			__attribute__nonnull__(1)
 			__attribute__nonnull__(2);
@@ -9314,12 +9534,41 @@ STATIC SV **	S_pack_rec(pTHX_ SV *cat, struct tempsym* symptr, SV **beglist, SV
 #define PERL_ARGS_ASSERT_PACK_REC	\
 	assert(cat); assert(symptr); assert(beglist); assert(endlist)
 
+STATIC void	S_packlist_prog(pTHX_ SV *cat, const struct pack_prog *prog, const char *pat, const char *patend, SV **beglist, SV **endlist)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_3)
+			__attribute__nonnull__(pTHX_4)
+			__attribute__nonnull__(pTHX_5)
+			__attribute__nonnull__(pTHX_6);
+#define PERL_ARGS_ASSERT_PACKLIST_PROG	\
+	assert(cat); assert(pat); assert(patend); assert(beglist); assert(endlist)
+
 STATIC char *	S_sv_exp_grow(pTHX_ SV *sv, STRLEN needed)
 			__attribute__warn_unused_result__
 			__attribute__nonnull__(pTHX_1);
 #define PERL_ARGS_ASSERT_SV_EXP_GROW	\
 	assert(sv)
 
+STATIC const struct pack_prog *	S_template_prog(pTHX_ SV *pat_sv)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_TEMPLATE_PROG	\
+	assert(pat_sv)
+
+STATIC OP *	S_unpack_assign(pTHX_ const struct pack_prog *prog, SV *left, SV *right, const char *s, const char *strend)
+			__attribute__nonnull__(pTHX_2)
+			__attribute__nonnull__(pTHX_3)
+			__attribute__nonnull__(pTHX_4)
+			__attribute__nonnull__(pTHX_5);
+#define PERL_ARGS_ASSERT_UNPACK_ASSIGN	\
+	assert(left); assert(right); assert(s); assert(strend)
+
+STATIC SSize_t	S_unpack_fixed(pTHX_ const struct pack_prog *prog, const char *s, const char *strend, U32 flags, AV *av)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2)
+			__attribute__nonnull__(pTHX_3);
+#define PERL_ARGS_ASSERT_UNPACK_FIXED	\
+	assert(prog); assert(s); assert(strend)
+
 STATIC SSize_t	S_unpack_rec(pTHX_ struct tempsym* symptr, const char *s, const char *strbeg, const char *strend, const char **new_s)
 			__attribute__nonnull__(pTHX_1)
 			__attribute__nonnull__(pTHX_2)
@@ -9328,6 +9577,14 @@ STATIC SSize_t	S_unpack_rec(pTHX_ struct tempsym* symptr, const char *s, const c
 #define PERL_ARGS_ASSERT_UNPACK_REC	\
 	assert(symptr); assert(s); assert(strbeg); assert(strend)
 
+STATIC SSize_t	S_unpackstring_prog(pTHX_ const struct pack_prog *prog, const char *pat, const char *patend, const char *s, const char *strend, U32 flags)
+			__attribute__nonnull__(pTHX_2)
+			__attribute__nonnull__(pTHX_3)
+			__attribute__nonnull__(pTHX_4)
+			__attribute__nonnull__(pTHX_5);
+#define PERL_ARGS_ASSERT_UNPACKSTRING_PROG	\
+	assert(pat); assert(patend); assert(s); assert(strend)
+
 #endif
 #if defined(PERL_IN_PP_SORT_C)
 STATIC I32	S_amagic_cmp(pTHX_ SV *const str1, SV *const str2)
@@ -10416,6 +10673,7 @@ STATIC void	S_not_incrementable(pTHX_ SV *const sv)
 #define PERL_ARGS_ASSERT_NOT_INCREMENTABLE	\
 	assert(sv)
 
+STATIC void	S_pack_arena_sets(pTHX);
 STATIC PTR_TBL_ENT_t *	S_ptr_table_find(PTR_TBL_t *const tbl, const void *const sv)
 			__attribute__warn_unused_result__
 			__attribute__nonnull__(1);
@@ -10474,6 +10732,8 @@ PERL_STATIC_INLINE void	S_sv_unglob(pTHX_ SV *const sv, U32 flags)
 	assert(sv)
 #endif
 
+STATIC Size_t	S_trim_body_arenas(pTHX_ const svtype sv_type);
+STATIC Size_t	S_trim_sv_arenas(pTHX);
 #ifndef PERL_NO_INLINE_FUNCTIONS
 PERL_STATIC_INLINE char *	S_uiv_2buf(char *const buf, const IV iv, UV uv, const int is_uv, char **const peob)
 			__attribute__warn_unused_result__
@@ -10483,6 +10743,12 @@ PERL_STATIC_INLINE char *	S_uiv_2buf(char *const buf, const IV iv, UV uv, const
 	assert(buf); assert(peob)
 #endif
 
+STATIC void	S_utf8_mg_index_build(pTHX_ MAGIC *const mg, const U8 *const start, const STRLEN blen)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2);
+#define PERL_ARGS_ASSERT_UTF8_MG_INDEX_BUILD	\
+	assert(mg); assert(start)
+
 STATIC void	S_utf8_mg_len_cache_update(pTHX_ SV *const sv, MAGIC **const mgp, const STRLEN ulen)
 			__attribute__nonnull__(pTHX_1)
 			__attribute__nonnull__(pTHX_2);
@@ -10927,6 +11193,14 @@ STATIC void	S_prep_cif(pTHX_ CV* cv, const char *nativeconv, const char *encoded
 #define PERL_ARGS_ASSERT_PREP_CIF	\
 	assert(cv); assert(encoded)
 
+#endif
+#if defined(PERL_JIT)
+PERL_CALLCONV void	Perl_jit_free(pTHX_ OP *o);
+PERL_CALLCONV void	Perl_jit_loop(pTHX_ OP *o)
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_JIT_LOOP	\
+	assert(o)
+
 #endif
 #if defined(PERL_MEM_LOG)
 PERL_CALLCONV Malloc_t	Perl_mem_log_alloc(const UV nconst, UV typesize, const char *type_name, Malloc_t newalloc, const char *filename, const int linenumber, const char *funcname)
@@ -11187,6 +11461,13 @@ PERL_CALLCONV OP*	Perl_hasterm(pTHX_ OP *o)
 #define PERL_ARGS_ASSERT_HASTERM	\
 	assert(o)
 
+PERL_CALLCONV void	Perl_hv_bucket_stats(pTHX_ HV *const hv, struct hv_stats *st)
+			__attribute__global__
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2);
+#define PERL_ARGS_ASSERT_HV_BUCKET_STATS	\
+	assert(hv); assert(st)
+
 PERL_CALLCONV void*	Perl_hv_common(pTHX_ HV *hv, SV *keysv, const char* key, I32 klen, int flags, int action, SV *val, U32 hash)
 			__attribute__global__;
 
@@ -11208,6 +11489,12 @@ PERL_CALLCONV void	Perl_hv_ksplit(pTHX_ HV *hv, U32 newmax)
 #define PERL_ARGS_ASSERT_HV_KSPLIT	\
 	assert(hv)
 
+PERL_CALLCONV bool	Perl_hv_open_addressing(pTHX_ HV *hv, bool on)
+			__attribute__global__
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_HV_OPEN_ADDRESSING	\
+	assert(hv)
+
 PERL_CALLCONV void	Perl_hv_placeholders_set(pTHX_ HV *hv, U32 ph)
 			__attribute__global__
 			__attribute__nonnull__(pTHX_1);
@@ -11220,6 +11507,19 @@ PERL_CALLCONV void	Perl_hv_riter_set(pTHX_ HV *hv, U32 riter)
 #define PERL_ARGS_ASSERT_HV_RITER_SET	\
 	assert(hv)
 
+PERL_CALLCONV bool	Perl_hv_shape(pTHX_ HV *hv)
+			__attribute__global__
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_HV_SHAPE	\
+	assert(hv)
+
+PERL_CALLCONV void	Perl_hv_store_list(pTHX_ HV *hv, SV **kv, U32 npairs)
+			__attribute__global__
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2);
+#define PERL_ARGS_ASSERT_HV_STORE_LIST	\
+	assert(hv); assert(kv)
+
 PERL_CALLCONV void	Perl_hv_study(pTHX_ HV *hv)
 			__attribute__global__
 			__attribute__nonnull__(pTHX_1);
@@ -11229,6 +11529,12 @@ PERL_CALLCONV void	Perl_hv_study(pTHX_ HV *hv)
 PERL_CALLCONV void	Perl_hv_undef_flags(pTHX_ HV *hv, U32 flags)
 			__attribute__global__;
 
+PERL_CALLCONV void	Perl_hv_unshape(pTHX_ HV *hv)
+			__attribute__global__
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_HV_UNSHAPE	\
+	assert(hv)
+
 PERL_CALLCONV SV*	Perl_magic_scalarpack(pTHX_ HV *hv, MAGIC *mg)
 			__attribute__global__
 			__attribute__nonnull__(pTHX_1)
@@ -46,6 +46,598 @@ Perl_runops_standard(pTHX)
     return 0;
 }
 
+/*
+=for apidoc runops_cgoto
+
+A variant of L</runops_standard>, which dispatches via computed gotos
+(labels as values) on the op type, with a copy of the dispatch jump
+per op.  The simplest ops, C<nextstate>, C<unstack>, C<pushmark>,
+C<const> and a plain C<padsv>, are done in the loop itself, and the
+other hot ops call their C<pp> function directly.
+
+Ops with a replaced C<op_ppaddr>, e.g. by XS modules or profilers,
+and all other ops are called via C<op_ppaddr> as before.  Modules
+replacing C<PL_runops> are not affected.
+
+This is the default runloop with C<-Accflags=-DPERL_RUNOPS_CGOTO>,
+XS code may also select it at run-time by setting C<PL_runops>.
+Without compiler support for labels as values it is the same as
+L</runops_standard>.
+
+=cut
+*/
+
+#ifdef PERL_HAS_COMPUTED_GOTO
+
+/* the hot ops in t/perf/benchmarks with a direct call */
+#define RUNOPS_HOT_OPS(X)                                               \
+    X(PADAV,padav)    X(PADHV,padhv)    X(PADRANGE,padrange)            \
+    X(GVSV,gvsv)      X(GV,gv)          X(RV2AV,rv2av)  X(RV2SV,rv2sv)  \
+    X(SASSIGN,sassign)  X(AASSIGN,aassign)                              \
+    X(AELEMFAST,aelemfast)  X(AELEMFAST_LEX,aelemfast_lex)              \
+    X(AELEM,aelem)    X(HELEM,helem)    X(MULTIDEREF,multideref)        \
+    X(ADD,add)        X(SUBTRACT,subtract)  X(MULTIPLY,multiply)        \
+    X(I_ADD,i_add)    X(I_SUBTRACT,i_subtract)                          \
+    X(CONCAT,concat)  X(MULTICONCAT,multiconcat)                        \
+    X(LT,lt)          X(GT,gt)          X(LE,le)        X(GE,ge)        \
+    X(EQ,eq)          X(NE,ne)          X(I_LT,i_lt)    X(S_EQ,s_eq)    \
+    X(PREINC,preinc)  X(POSTINC,postinc)  X(NOT,not)                    \
+    X(AND,and)        X(OR,or)          X(COND_EXPR,cond_expr)          \
+    X(ENTERLOOP,enterloop)  X(LEAVELOOP,leaveloop)                      \
+    X(ENTERITER,enteriter)  X(ITER,iter)  X(ITER_ARY,iter_ary)          \
+    X(ITER_LAZYIV,iter_lazyiv)                                          \
+    X(ENTERSUB,entersub)  X(LEAVESUB,leavesub)  X(SIGNATURE,signature)  \
+    X(RETURN,return)  X(METHOD_NAMED,method_named)                      \
+    X(ENTERINLINE,enterinline)  X(LEAVEINLINE,leaveinline)
+
+/* check for the end, and jump to the label of the next op */
+#define RUNOPS_NEXT                                     \
+    STMT_START {                                        \
+        if (UNLIKELY(!PL_op))                           \
+            goto done;                                  \
+        PERL_DTRACE_PROBE_OP(PL_op);                    \
+        goto *dispatch[PL_op->op_type];                 \
+    } STMT_END
+
+#define RUNOPS_HOT_ENTRY(type, name) [OP_##type] = &&L_##name,
+#define RUNOPS_HOT_CASE(type, name)                             \
+  L_##name:                                                     \
+    PL_op = LIKELY(PL_op->op_ppaddr == Perl_pp_##name)          \
+        ? Perl_pp_##name(aTHX)                                  \
+        : PL_op->op_ppaddr(aTHX);                               \
+    RUNOPS_NEXT;
+
+#endif
+
+int
+Perl_runops_cgoto(pTHX)
+{
+#ifdef PERL_HAS_COMPUTED_GOTO
+    GCC_DIAG_IGNORE_STMT(-Woverride-init);
+    CLANG_DIAG_IGNORE_STMT(-Winitializer-overrides);
+    static const void * const dispatch[OP_max+1] = {
+        [0 ... OP_max] = &&L_generic,
+        RUNOPS_HOT_OPS(RUNOPS_HOT_ENTRY)
+        [OP_NEXTSTATE] = &&L_nextstate,
+        [OP_UNSTACK]   = &&L_unstack,
+        [OP_PUSHMARK]  = &&L_pushmark,
+        [OP_CONST]     = &&L_const,
+        [OP_PADSV]     = &&L_padsv
+    };
+    GCC_DIAG_RESTORE_STMT;
+    CLANG_DIAG_RESTORE_STMT;
+
+    RUNOPS_NEXT;
+
+  L_generic:
+    PL_op = PL_op->op_ppaddr(aTHX);
+    RUNOPS_NEXT;
+
+    RUNOPS_HOT_OPS(RUNOPS_HOT_CASE)
+
+    /* the simplest ops are done here, as in pp_hot.c */
+  L_nextstate:
+    if (UNLIKELY(PL_op->op_ppaddr != Perl_pp_nextstate))
+        goto L_generic;
+    PL_curcop = (COP*)PL_op;
+    TAINT_NOT;
+    PL_stack_sp = PL_stack_base + CX_CUR()->blk_oldsp;
+    FREETMPS;
+    PERL_ASYNC_CHECK();
+    PL_op = PL_op->op_next;
+    RUNOPS_NEXT;
+
+  L_unstack:
+    if (UNLIKELY(PL_op->op_ppaddr != Perl_pp_unstack))
+        goto L_generic;
+    {
+        PERL_CONTEXT *cx;
+        PERL_ASYNC_CHECK();
+        TAINT_NOT;
+        cx = CX_CUR();
+        PL_stack_sp = PL_stack_base + cx->blk_oldsp;
+        FREETMPS;
+        if (!(PL_op->op_flags & OPf_SPECIAL))
+            CX_LEAVE_SCOPE(cx);
+#ifdef PERL_JIT
+        if (UNLIKELY(++PL_op->op_targ == PERL_JIT_THRESHOLD))
+            jit_loop(PL_op);
+#endif
+    }
+    PL_op = PL_op->op_next;
+    RUNOPS_NEXT;
+
+  L_pushmark:
+    if (UNLIKELY(PL_op->op_ppaddr != Perl_pp_pushmark))
+        goto L_generic;
+    PUSHMARK(PL_stack_sp);
+    PL_op = PL_op->op_next;
+    RUNOPS_NEXT;
+
+  L_const:
+    if (UNLIKELY(PL_op->op_ppaddr != Perl_pp_const))
+        goto L_generic;
+    {
+        dSP;
+        XPUSHs(cSVOP_sv);
+        PUTBACK;
+    }
+    PL_op = PL_op->op_next;
+    RUNOPS_NEXT;
+
+  L_padsv:
+    /* lvalue padsv's may need to be saved or vivified */
+    if (UNLIKELY(PL_op->op_ppaddr != Perl_pp_padsv
+                 || (PL_op->op_flags & OPf_MOD)))
+        goto L_generic;
+    {
+        dSP;
+        XPUSHs(PAD_SVl(PL_op->op_targ));
+        PUTBACK;
+    }
+    PL_op = PL_op->op_next;
+    RUNOPS_NEXT;
+
+  done:
+    PERL_ASYNC_CHECK();
+    TAINT_NOT;
+    return 0;
+#else
+    return runops_standard();
+#endif
+}
+
+/*
+=for apidoc jit_loop
+
+The baseline JIT for hot loops.  Called by C<pp_unstack> when a loop
+has gone round C<PERL_JIT_THRESHOLD> times, it compiles the ops
+reachable from the C<unstack> op via C<op_next> and C<op_other> into
+x86-64 machine code, and installs it as the C<op_ppaddr> of the
+C<unstack> op.
+
+The code stores C<PL_op> and calls each C<op_ppaddr> in turn, and
+jumps directly to the code of the next op when the call returns its
+C<op_next> or C<op_other>, so there's no dispatch through the runloop.
+C<pushmark>, C<const> and a plain C<padsv> are done inline.  Any other
+returned op, e.g. from C<entersub>, C<last> or C<die>, or an op outside
+the compiled region, returns to the runloop, which goes on with it as
+usual.  Nested loops call C<pp_unstack> directly, so compiled code
+never calls compiled code.
+
+Loops are not compiled, and compiled code falls back to
+C<pp_unstack>, when C<PL_runops> is not the default runloop, e.g.
+with profilers or tracers.
+
+Only with non-threaded, non-debugging builds on x86-64 Linux, unless
+disabled with C<-Accflags=-DPERL_NO_JIT>.
+
+=for apidoc jit_free
+
+Frees the compiled code of the C<unstack> op C<o>, or of all loops
+with C<NULL>.
+
+=cut
+*/
+
+#ifdef PERL_JIT
+
+#include <sys/mman.h>
+
+/* a compiled loop, in the list PL_jit_code */
+struct jit_code {
+    struct jit_code *next;
+    OP *op;                     /* the unstack op calling the code */
+    U8 *start;                  /* the mapping with the code */
+    size_t size;
+};
+
+#define JIT_MAX_OPS     200
+/* max. bytes of code per op, incl. the out of line stub for the
+   inlined ops, and for the prologue and epilogue */
+#define JIT_OP_SIZE     320
+#define JIT_EXTRA_SIZE  128
+
+/* labels: ops 0 .. n-1, their stubs n .. 2n-1, then these */
+#define JIT_L_STUB(j,i) ((j)->n + (i))
+#define JIT_L_EXIT(j)   (2 * (j)->n)
+#define JIT_L_FALLBACK(j) (2 * (j)->n + 1)
+#define JIT_L_NONE      U32_MAX
+
+typedef struct {
+    OP *ops[JIT_MAX_OPS];
+    U32 n;
+    U8 *start;
+    U8 *pc;
+    U32 label[2 * JIT_MAX_OPS + 2];
+    struct { U32 pos; U32 label; } fixup[8 * JIT_MAX_OPS + 8];
+    U32 nfixup;
+} jit_state;
+
+#define JIT_EMIT(j, s)  S_jit_bytes(j, STR_WITH_LEN(s))
+
+STATIC void
+S_jit_bytes(jit_state *j, const char *s, STRLEN len)
+{
+    Copy(s, j->pc, len, char);
+    j->pc += len;
+}
+
+/* movabs reg, imm64 */
+STATIC void
+S_jit_movabs(jit_state *j, U8 reg, const void *imm)
+{
+    const UV v = PTR2UV(imm);
+    *j->pc++ = 0x48;
+    *j->pc++ = 0xB8 + reg;
+    Copy(&v, j->pc, 8, U8);
+    j->pc += 8;
+}
+
+STATIC void
+S_jit_imm32(jit_state *j, U32 imm)
+{
+    Copy(&imm, j->pc, 4, U8);
+    j->pc += 4;
+}
+
+/* a jump or jcc with rel32 to a label, patched at the end */
+STATIC void
+S_jit_jump(jit_state *j, const char *opc, STRLEN len, U32 label)
+{
+    S_jit_bytes(j, opc, len);
+    j->fixup[j->nfixup].pos   = j->pc - j->start;
+    j->fixup[j->nfixup].label = label;
+    j->nfixup++;
+    Zero(j->pc, 4, U8);
+    j->pc += 4;
+}
+
+/* the region index of o, or n */
+STATIC U32
+S_jit_index(const jit_state *j, const OP *o)
+{
+    U32 i;
+    for (i = 0; i < j->n; i++)
+        if (j->ops[i] == o)
+            break;
+    return i;
+}
+
+/* add op t to the region. Ops which may free the optree of the
+   running code, e.g. of an eval or a redefined sub, are left to the
+   runloop, so compiled code is never freed while it runs. */
+STATIC void
+S_jit_add(jit_state *j, OP *t)
+{
+    if (!t || j->n == JIT_MAX_OPS || S_jit_index(j, t) < j->n)
+        return;
+    switch (t->op_type) {
+    case OP_LEAVESUB:
+    case OP_LEAVESUBLV:
+    case OP_RETURN:
+    case OP_LEAVEEVAL:
+    case OP_LEAVEWRITE:
+    case OP_GOTO:
+        return;
+    }
+    j->ops[j->n++] = t;
+}
+
+#define JIT_RAX 0
+#define JIT_RCX 1
+#define JIT_RDX 2
+#define JIT_RBX 3
+#define JIT_RSI 6
+
+/* go on with op t after an inlined op, with label next following */
+STATIC void
+S_jit_goto(jit_state *j, const OP *t, U32 next)
+{
+    const U32 i = S_jit_index(j, t);
+    if (i < j->n) {
+        if (i != next)
+            S_jit_jump(j, STR_WITH_LEN("\xE9"), i);
+    }
+    else {
+        S_jit_movabs(j, JIT_RAX, t);
+        S_jit_jump(j, STR_WITH_LEN("\xE9"), JIT_L_EXIT(j));
+    }
+}
+
+/* call op i, and jump to the label of the returned op, if it's its
+   op_next or op_other in the region, or else return it */
+STATIC void
+S_jit_call(jit_state *j, U32 i, U32 next)
+{
+    OP * const o = j->ops[i];
+    U32 target[2];
+    int k, nt = 0;
+
+    S_jit_movabs(j, JIT_RAX, o);
+    JIT_EMIT(j, "\x48\x89\x03");                /* mov [rbx], rax */
+    if (o->op_type == OP_UNSTACK) {
+        /* not via op_ppaddr, which may be compiled code */
+        S_jit_movabs(j, JIT_RAX, FPTR2DPTR(void *, Perl_pp_unstack));
+        JIT_EMIT(j, "\xFF\xD0");                /* call rax */
+    }
+    else {
+        STATIC_ASSERT_STMT(STRUCT_OFFSET(OP, op_ppaddr) < 128);
+        JIT_EMIT(j, "\xFF\x50");                /* call [rax+disp8] */
+        *j->pc++ = (U8)STRUCT_OFFSET(OP, op_ppaddr);
+    }
+
+    if (o->op_next && S_jit_index(j, o->op_next) < j->n)
+        target[nt++] = S_jit_index(j, o->op_next);
+    if (o->op_type != OP_CUSTOM
+        && (PL_opargs[o->op_type] & OA_CLASS_MASK) == OA_LOGOP
+        && cLOGOPo->op_other != o->op_next
+        && S_jit_index(j, cLOGOPo->op_other) < j->n)
+        target[nt++] = S_jit_index(j, cLOGOPo->op_other);
+    /* check the fall through target last */
+    if (nt == 2 && target[0] == next) {
+        target[0] = target[1];
+        target[1] = next;
+    }
+    for (k = 0; k < nt; k++) {
+        S_jit_movabs(j, JIT_RCX, j->ops[target[k]]);
+        JIT_EMIT(j, "\x48\x39\xC8");            /* cmp rax, rcx */
+        if (k == nt - 1 && target[k] == next) {
+            S_jit_jump(j, STR_WITH_LEN("\x0F\x85"), JIT_L_EXIT(j)); /* jne */
+            return;
+        }
+        S_jit_jump(j, STR_WITH_LEN("\x0F\x84"), target[k]);         /* je */
+    }
+    S_jit_jump(j, STR_WITH_LEN("\xE9"), JIT_L_EXIT(j));
+}
+
+/* push the SV in rax with EXTEND, or else call the op in its stub */
+STATIC void
+S_jit_push_check(jit_state *j, U32 i)
+{
+    S_jit_movabs(j, JIT_RCX, &PL_stack_sp);
+    JIT_EMIT(j, "\x48\x8B\x11");                /* mov rdx, [rcx] */
+    S_jit_movabs(j, JIT_RSI, &PL_stack_max);
+    JIT_EMIT(j, "\x48\x3B\x16");                /* cmp rdx, [rsi] */
+    S_jit_jump(j, STR_WITH_LEN("\x0F\x83"), JIT_L_STUB(j, i)); /* jae */
+}
+
+STATIC void
+S_jit_push_rax(jit_state *j)
+{
+    JIT_EMIT(j, "\x48\x83\xC2\x08");            /* add rdx, 8 */
+    JIT_EMIT(j, "\x48\x89\x02");                /* mov [rdx], rax */
+    JIT_EMIT(j, "\x48\x89\x11");                /* mov [rcx], rdx */
+}
+
+/* emit op i inline, as in pp_hot.c, or return false */
+STATIC bool
+S_jit_inline(jit_state *j, U32 i, U32 next)
+{
+    OP * const o = j->ops[i];
+
+    if (o->op_ppaddr != PL_ppaddr[o->op_type])
+        return FALSE;
+    switch (o->op_type) {
+    case OP_PUSHMARK:
+        S_jit_movabs(j, JIT_RCX, &PL_markstack_ptr);
+        JIT_EMIT(j, "\x48\x8B\x01");            /* mov rax, [rcx] */
+        JIT_EMIT(j, "\x48\x83\xC0\x04");        /* add rax, 4 */
+        S_jit_movabs(j, JIT_RDX, &PL_markstack_max);
+        JIT_EMIT(j, "\x48\x3B\x02");            /* cmp rax, [rdx] */
+        S_jit_jump(j, STR_WITH_LEN("\x0F\x84"), JIT_L_STUB(j, i)); /* je */
+        JIT_EMIT(j, "\x48\x89\x01");            /* mov [rcx], rax */
+        S_jit_movabs(j, JIT_RDX, &PL_stack_sp);
+        JIT_EMIT(j, "\x48\x8B\x12");            /* mov rdx, [rdx] */
+        S_jit_movabs(j, JIT_RSI, &PL_stack_base);
+        JIT_EMIT(j, "\x48\x2B\x16");            /* sub rdx, [rsi] */
+        JIT_EMIT(j, "\x48\xC1\xFA\x03");        /* sar rdx, 3 */
+        JIT_EMIT(j, "\x89\x10");                /* mov [rax], edx */
+        break;
+    case OP_NEXTSTATE:
+        S_jit_movabs(j, JIT_RAX, o);
+        S_jit_movabs(j, JIT_RCX, &PL_curcop);
+        JIT_EMIT(j, "\x48\x89\x01");            /* mov [rcx], rax */
+#ifndef NO_TAINT_SUPPORT
+        STATIC_ASSERT_STMT(sizeof(PL_tainted) == 1);
+        S_jit_movabs(j, JIT_RCX, &PL_tainted);
+        JIT_EMIT(j, "\xC6\x01\x00");            /* mov byte [rcx], 0 */
+#endif
+        /* PL_stack_sp = PL_stack_base + CX_CUR()->blk_oldsp */
+        STATIC_ASSERT_STMT(sizeof(cxstack_ix) == 4);
+        STATIC_ASSERT_STMT(sizeof(cxstack[0].blk_oldsp) == 4);
+        S_jit_movabs(j, JIT_RCX, &PL_curstackinfo);
+        JIT_EMIT(j, "\x48\x8B\x09");            /* mov rcx, [rcx] */
+        JIT_EMIT(j, "\x48\x63\x91");            /* movsxd rdx, [rcx+disp32] */
+        S_jit_imm32(j, STRUCT_OFFSET(PERL_SI, si_cxix));
+        JIT_EMIT(j, "\x48\x69\xD2");            /* imul rdx, rdx, imm32 */
+        S_jit_imm32(j, sizeof(PERL_CONTEXT));
+        JIT_EMIT(j, "\x48\x03\x91");            /* add rdx, [rcx+disp32] */
+        S_jit_imm32(j, STRUCT_OFFSET(PERL_SI, si_cxstack));
+        JIT_EMIT(j, "\x48\x63\x92");            /* movsxd rdx, [rdx+disp32] */
+        S_jit_imm32(j, STRUCT_OFFSET(PERL_CONTEXT, blk_oldsp));
+        S_jit_movabs(j, JIT_RSI, &PL_stack_base);
+        JIT_EMIT(j, "\x48\x8B\x36");            /* mov rsi, [rsi] */
+        JIT_EMIT(j, "\x48\x8D\x34\xD6");        /* lea rsi, [rsi+rdx*8] */
+        S_jit_movabs(j, JIT_RCX, &PL_stack_sp);
+        JIT_EMIT(j, "\x48\x89\x31");            /* mov [rcx], rsi */
+        /* FREETMPS */
+        S_jit_movabs(j, JIT_RCX, &PL_tmps_ix);
+        JIT_EMIT(j, "\x48\x8B\x01");            /* mov rax, [rcx] */
+        S_jit_movabs(j, JIT_RDX, &PL_tmps_floor);
+        JIT_EMIT(j, "\x48\x3B\x02");            /* cmp rax, [rdx] */
+        JIT_EMIT(j, "\x7E\x0C");                /* jle over the call */
+        S_jit_movabs(j, JIT_RAX, FPTR2DPTR(void *, Perl_free_tmps));
+        JIT_EMIT(j, "\xFF\xD0");                /* call rax */
+        /* PERL_ASYNC_CHECK() */
+        S_jit_movabs(j, JIT_RCX, &PL_sig_pending);
+        JIT_EMIT(j, "\x83\x39\x00");            /* cmp dword [rcx], 0 */
+        JIT_EMIT(j, "\x74\x0C");                /* je over the call */
+        S_jit_movabs(j, JIT_RAX, &PL_signalhook);
+        JIT_EMIT(j, "\xFF\x10");                /* call [rax] */
+        break;
+    case OP_CONST:
+        S_jit_push_check(j, i);
+        S_jit_movabs(j, JIT_RAX, cSVOPo_sv);
+        S_jit_push_rax(j);
+        break;
+    case OP_PADSV:
+        /* lvalue padsv's may need to be saved or vivified */
+        if ((o->op_flags & OPf_MOD)
+            && (o->op_private & (OPpLVAL_INTRO|OPpDEREF)))
+            return FALSE;
+        if (o->op_targ > I32_MAX / sizeof(SV *))
+            return FALSE;
+        S_jit_push_check(j, i);
+        S_jit_movabs(j, JIT_RAX, &PL_curpad);
+        JIT_EMIT(j, "\x48\x8B\x00");            /* mov rax, [rax] */
+        JIT_EMIT(j, "\x48\x8B\x80");            /* mov rax, [rax+disp32] */
+        S_jit_imm32(j, (U32)(o->op_targ * sizeof(SV *)));
+        S_jit_push_rax(j);
+        break;
+    default:
+        return FALSE;
+    }
+    S_jit_goto(j, o->op_next, next);
+    return TRUE;
+}
+
+void
+Perl_jit_loop(pTHX_ OP *o)
+{
+    jit_state *j;
+    struct jit_code *code;
+    U8 *start;
+    size_t size;
+    U32 i;
+    U8 *inlined;
+
+    PERL_ARGS_ASSERT_JIT_LOOP;
+
+    if (getenv("XNOJIT")) return; if (getenv("XJITDBG")) PerlIO_printf(PerlIO_stderr(),"jit %p %s:%d\n",o,CopFILE(PL_curcop),(int)CopLINE(PL_curcop));
+    if (o->op_ppaddr != Perl_pp_unstack
+        || (PL_runops != Perl_runops_standard
+            && PL_runops != Perl_runops_cgoto))
+        return;
+
+    Newxz(j, 1, jit_state);
+    /* the region: ops reachable from the unstack op */
+    j->ops[j->n++] = o;
+    for (i = 0; i < j->n; i++) {
+        OP * const k = j->ops[i];
+        S_jit_add(j, k->op_next);
+        if (k->op_type != OP_CUSTOM
+            && (PL_opargs[k->op_type] & OA_CLASS_MASK) == OA_LOGOP)
+            S_jit_add(j, cLOGOPx(k)->op_other);
+    }
+
+    size = JIT_EXTRA_SIZE + j->n * JIT_OP_SIZE;
+    start = (U8 *)mmap(NULL, size, PROT_READ|PROT_WRITE,
+                       MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (start == (U8 *)MAP_FAILED) {
+        Safefree(j);
+        return;
+    }
+    j->start = j->pc = start;
+    for (i = 0; i < C_ARRAY_LENGTH(j->label); i++)
+        j->label[i] = JIT_L_NONE;
+    Newxz(inlined, j->n, U8);
+
+    /* the entry with the same signature as a pp function. rbx holds
+       &PL_op, and the push aligns the stack for the calls. */
+    JIT_EMIT(j, "\x53");                        /* push rbx */
+    S_jit_movabs(j, JIT_RAX, &PL_runops);
+    JIT_EMIT(j, "\x48\x8B\x00");                /* mov rax, [rax] */
+    S_jit_movabs(j, JIT_RCX, FPTR2DPTR(void *, PL_runops));
+    JIT_EMIT(j, "\x48\x39\xC8");                /* cmp rax, rcx */
+    S_jit_jump(j, STR_WITH_LEN("\x0F\x85"), JIT_L_FALLBACK(j)); /* jne */
+    S_jit_movabs(j, JIT_RBX, &PL_op);
+
+    for (i = 0; i < j->n; i++) {
+        j->label[i] = j->pc - j->start;
+        if (S_jit_inline(j, i, i + 1))
+            inlined[i] = 1;
+        else
+            S_jit_call(j, i, i + 1);
+    }
+    for (i = 0; i < j->n; i++)
+        if (inlined[i]) {
+            j->label[JIT_L_STUB(j, i)] = j->pc - j->start;
+            S_jit_call(j, i, JIT_L_NONE);
+        }
+    j->label[JIT_L_EXIT(j)] = j->pc - j->start;
+    JIT_EMIT(j, "\x5B\xC3");                    /* pop rbx; ret */
+    j->label[JIT_L_FALLBACK(j)] = j->pc - j->start;
+    S_jit_movabs(j, JIT_RAX, FPTR2DPTR(void *, Perl_pp_unstack));
+    JIT_EMIT(j, "\xFF\xD0\x5B\xC3");            /* call rax; pop rbx; ret */
+    assert((size_t)(j->pc - start) <= size);
+
+    for (i = 0; i < j->nfixup; i++) {
+        const U32 pos = j->fixup[i].pos;
+        const I32 rel = (I32)j->label[j->fixup[i].label] - (I32)(pos + 4);
+        assert(j->label[j->fixup[i].label] != JIT_L_NONE);
+        Copy(&rel, j->start + pos, 4, U8);
+    }
+    if (getenv("XJITDBG")) { PerlIO *f = PerlIO_open("/tmp/jit.bin","w"); PerlIO_write(f, start, j->pc - start); PerlIO_close(f); }
+    Safefree(inlined);
+    Safefree(j);
+
+    if (mprotect(start, size, PROT_READ|PROT_EXEC)) {
+        munmap(start, size);
+        return;
+    }
+    Newx(code, 1, struct jit_code);
+    code->op    = o;
+    code->start = start;
+    code->size  = size;
+    code->next  = PL_jit_code;
+    PL_jit_code = code;
+    o->op_ppaddr = DPTR2FPTR(Perl_ppaddr_t, start);
+}
+
+void
+Perl_jit_free(pTHX_ OP *o)
+{
+    struct jit_code **p = &PL_jit_code;
+
+    while (*p) {
+        struct jit_code * const code = *p;
+        if (!o || code->op == o) {
+            *p = code->next;
+            if (o)
+                o->op_ppaddr = Perl_pp_unstack;
+            munmap(code->start, code->size);
+            Safefree(code);
+            if (o)
+                return;
+        }
+        else
+            p = &code->next;
+    }
+}
+
+#endif /* PERL_JIT */
+
 /*
  * ex: set ts=8 sts=4 sw=4 et:
  */
@@ -1233,6 +1233,365 @@ S_new_body(pTHX_ const svtype sv_type)
 
 #endif
 
+/* The HEs of hv.c use the arena root of SVt_NULL */
+#define ARENA_BODY_SIZE(type)					\
+    ((type) == SVt_NULL ? sizeof(HE) : (size_t)bodies_by_type[type].body_size)
+
+/* glibc also returns the free pages in the middle of the heap to the OS,
+   with madvise() */
+#if defined(__GLIBC__) && !defined(MYMALLOC)
+#  include <malloc.h>
+#  define ARENA_MALLOC_TRIM()	(void)malloc_trim(0)
+#else
+#  define ARENA_MALLOC_TRIM()	NOOP
+#endif
+
+/*
+=for apidoc sv_arena_stats
+
+Fills C<st> with the number of live and free SV heads per C<svtype>, and
+per body type the live and free bodies, the number of arenas and their
+size in bytes. The bodies of C<SVt_NULL> are the C<HE>s of all hashes.
+Bodies which are not allocated from an arena, like those of
+C<SVt_PVFM>, are not counted.
+
+It walks all arenas and the free lists of the bodies, so it is meant
+for an occasional report, to size the workers of a server or to find
+leaks.
+
+=cut
+*/
+void
+Perl_sv_arena_stats(pTHX_ struct sv_arena_stats *st)
+{
+    const SV *sva;
+    const struct arena_set *aroot;
+    unsigned int type;
+
+    PERL_ARGS_ASSERT_SV_ARENA_STATS;
+
+    Zero(st, 1, struct sv_arena_stats);
+    for (sva = PL_sv_arenaroot; sva; sva = (const SV *)SvANY(sva)) {
+	const SV * const svend = &sva[SvREFCNT(sva)];
+	const SV *sv;
+	st->sas_head_arenas++;
+	st->sas_head_bytes += SvREFCNT(sva) * sizeof(SV);
+	for (sv = sva + 1; sv < svend; ++sv) {
+	    if (SvTYPE(sv) == (svtype)SVTYPEMASK)
+		st->sas_heads_free++;
+	    else
+		st->sas_heads[SvTYPE(sv)]++;
+	}
+    }
+
+    for (aroot = (const struct arena_set *)PL_body_arenas; aroot;
+	 aroot = aroot->next) {
+	unsigned int i;
+	for (i = 0; i < aroot->curr; i++) {
+	    const struct arena_desc * const adesc = &aroot->set[i];
+	    st->sas_body_arenas[adesc->utype]++;
+	    st->sas_body_bytes[adesc->utype] += adesc->size;
+	    st->sas_bodies[adesc->utype] +=
+		adesc->size / ARENA_BODY_SIZE(adesc->utype);
+	}
+    }
+    for (type = 0; type < SVt_LAST; type++) {
+	const void *body;
+	for (body = PL_body_roots[type]; body; body = *(void * const *)body)
+	    st->sas_bodies_free[type]++;
+	st->sas_bodies[type] = st->sas_bodies[type] > st->sas_bodies_free[type]
+	    ? st->sas_bodies[type] - st->sas_bodies_free[type] : 0;
+    }
+}
+
+/* an arena of sv_trim_arenas() */
+struct arena_trim {
+    char	*start;
+    char	*end;
+    struct arena_desc *adesc;	/* NULL for SV heads */
+    void	*head;		/* the free bodies of this arena */
+    void	*tail;
+    U32		nbodies;
+    U32		nfree;
+};
+
+static int
+S_arena_trim_addr_cmp(const void *a, const void *b)
+{
+    const UV pa = PTR2UV(((const struct arena_trim *)a)->start);
+    const UV pb = PTR2UV(((const struct arena_trim *)b)->start);
+    return (pa > pb) - (pa < pb);
+}
+
+/* the fullest arena first */
+static int
+S_arena_trim_free_cmp(const void *a, const void *b)
+{
+    const U32 fa = ((const struct arena_trim *)a)->nfree;
+    const U32 fb = ((const struct arena_trim *)b)->nfree;
+    return (fa > fb) - (fa < fb);
+}
+
+/* the arena of a body, by bisection of the arenas sorted by address */
+static struct arena_trim *
+S_arena_trim_find(struct arena_trim *at, Size_t n, const char *body)
+{
+    Size_t lo = 0;
+    Size_t hi = n;
+    while (lo < hi) {
+	const Size_t mid = (lo + hi) / 2;
+	if (PTR2UV(body) < PTR2UV(at[mid].start))
+	    hi = mid;
+	else if (PTR2UV(body) >= PTR2UV(at[mid].end))
+	    lo = mid + 1;
+	else
+	    return &at[mid];
+    }
+    return NULL;
+}
+
+/* Frees the SV arenas without live heads, and threads the free heads of
+   the others into a new free list, in address order and the fullest
+   arena first. So new SVs fill the fullest arenas, and the sparse ones
+   can run empty until the next trim. */
+STATIC Size_t
+S_trim_sv_arenas(pTHX)
+{
+    struct arena_trim *at;
+    SV *sva;
+    SV *prev = NULL;
+    SV *last = NULL;
+    Size_t n = 0;
+    Size_t i;
+    Size_t freed = 0;
+
+    for (sva = PL_sv_arenaroot; sva; sva = MUTABLE_SV(SvANY(sva)))
+	n++;
+    if (!n)
+	return 0;
+    Newx(at, n, struct arena_trim);
+    n = 0;
+    for (sva = PL_sv_arenaroot; sva; ) {
+	SV * const svanext = MUTABLE_SV(SvANY(sva));
+	const SV * const svend = &sva[SvREFCNT(sva)];
+	const SV *sv;
+	U32 nfree = 0;
+
+	for (sv = sva + 1; sv < svend; ++sv)
+	    if (SvTYPE(sv) == (svtype)SVTYPEMASK)
+		nfree++;
+	/* fake arenas are part of the real one before them */
+	if (nfree == SvREFCNT(sva) - 1 && !SvFAKE(sva)
+	    && !(svanext && SvFAKE(svanext))) {
+	    if (prev)
+		SvANY(prev) = (void *)svanext;
+	    else
+		PL_sv_arenaroot = svanext;
+	    freed += SvREFCNT(sva) * sizeof(SV);
+	    DEBUG_m(PerlIO_printf(Perl_debug_log, "sv arena 0x%p freed\n",
+				  (void*)sva));
+	    Safefree(sva);
+	}
+	else {
+	    at[n].start = (char *)sva;
+	    at[n].nfree = nfree;
+	    n++;
+	    prev = sva;
+	}
+	sva = svanext;
+    }
+
+    qsort(at, n, sizeof(struct arena_trim), S_arena_trim_free_cmp);
+    PL_sv_root = NULL;
+    for (i = 0; i < n; i++) {
+	SV * const arena = (SV *)at[i].start;
+	const SV * const svend = &arena[SvREFCNT(arena)];
+	SV *sv;
+
+	if (!at[i].nfree)
+	    continue;
+	for (sv = arena + 1; sv < svend; ++sv) {
+	    if (SvTYPE(sv) == (svtype)SVTYPEMASK) {
+		if (last)
+		    SvARENA_CHAIN_SET(last, sv);
+		else
+		    PL_sv_root = sv;
+		last = sv;
+	    }
+	}
+    }
+    if (last)
+	SvARENA_CHAIN_SET(last, NULL);
+    Safefree(at);
+    return freed;
+}
+
+/* Frees the body arenas of a type without live bodies, and threads the
+   free bodies of the others into a new free list, the fullest arena
+   first. The freed arenas are left in the arena sets with a NULL arena,
+   for pack_arena_sets(). */
+STATIC Size_t
+S_trim_body_arenas(pTHX_ const svtype sv_type)
+{
+    const size_t body_size = ARENA_BODY_SIZE(sv_type);
+    struct arena_set *aroot;
+    struct arena_trim *at;
+    struct arena_trim *found = NULL;
+    void *body;
+    void *foreign = NULL;
+    void **tail;
+    Size_t n = 0;
+    Size_t i;
+    Size_t freed = 0;
+
+    for (aroot = (struct arena_set *)PL_body_arenas; aroot;
+	 aroot = aroot->next)
+	for (i = 0; i < aroot->curr; i++)
+	    if (aroot->set[i].utype == sv_type)
+		n++;
+    if (!n)
+	return 0;
+    Newx(at, n, struct arena_trim);
+    n = 0;
+    for (aroot = (struct arena_set *)PL_body_arenas; aroot;
+	 aroot = aroot->next) {
+	for (i = 0; i < aroot->curr; i++) {
+	    struct arena_desc * const adesc = &aroot->set[i];
+	    if (adesc->utype == sv_type) {
+		at[n].adesc = adesc;
+		at[n].start = adesc->arena;
+		at[n].nbodies = adesc->size / body_size;
+		at[n].end = adesc->arena + at[n].nbodies * body_size;
+		at[n].head = at[n].tail = NULL;
+		at[n].nfree = 0;
+		n++;
+	    }
+	}
+    }
+    qsort(at, n, sizeof(struct arena_trim), S_arena_trim_addr_cmp);
+
+    /* move the free bodies to the list of their arena. Bodies are mostly
+       freed in runs from the same arena, so check the last one first */
+    for (body = PL_body_roots[sv_type]; body; ) {
+	void * const next = *(void **)body;
+	if (!found || (char *)body < found->start
+	    || (char *)body >= found->end)
+	    found = S_arena_trim_find(at, n, (char *)body);
+	if (found) {
+	    *(void **)body = found->head;
+	    if (!found->head)
+		found->tail = body;
+	    found->head = body;
+	    found->nfree++;
+	}
+	else {			/* not from an arena, keep it */
+	    *(void **)body = foreign;
+	    foreign = body;
+	}
+	body = next;
+    }
+
+    for (i = 0; i < n; i++) {
+	if (at[i].nfree == at[i].nbodies) {
+	    freed += at[i].adesc->size;
+	    DEBUG_m(PerlIO_printf(Perl_debug_log,
+				  "arena 0x%p type %d freed\n",
+				  (void*)at[i].start, (int)sv_type));
+	    Safefree(at[i].adesc->arena);
+	    at[i].adesc->arena = NULL;
+	    at[i].head = NULL;
+	    at[i].nfree = 0;
+	}
+    }
+
+    qsort(at, n, sizeof(struct arena_trim), S_arena_trim_free_cmp);
+    tail = &PL_body_roots[sv_type];
+    for (i = 0; i < n; i++) {
+	if (at[i].head) {
+	    *tail = at[i].head;
+	    tail = (void **)at[i].tail;
+	}
+    }
+    *tail = foreign;
+    Safefree(at);
+    return freed;
+}
+
+/* removes the arenas freed by trim_body_arenas() from the arena sets,
+   and frees the sets which became empty */
+STATIC void
+S_pack_arena_sets(pTHX)
+{
+    struct arena_set * const aroot = (struct arena_set *)PL_body_arenas;
+    struct arena_set *w = aroot;
+    struct arena_set *r;
+    unsigned int wi = 0;
+
+    if (!aroot)
+	return;
+    /* the writer never overtakes the reader */
+    for (r = aroot; r; r = r->next) {
+	unsigned int i;
+	for (i = 0; i < r->curr; i++) {
+	    if (r->set[i].arena) {
+		if (wi == w->set_size) {
+		    w->curr = wi;
+		    w = w->next;
+		    wi = 0;
+		}
+		w->set[wi++] = r->set[i];
+	    }
+	}
+    }
+    w->curr = wi;
+    Zero(&w->set[wi], w->set_size - wi, struct arena_desc);
+    r = w->next;
+    w->next = NULL;
+    while (r) {
+	struct arena_set * const next = r->next;
+	Safefree(r);
+	r = next;
+    }
+}
+
+/*
+=for apidoc sv_trim_arenas
+
+Frees the SV head and body arenas without any live SV, body or C<HE>,
+and returns the number of freed bytes. Otherwise the arenas are only
+freed with the interpreter, so a process which once built a big data
+structure would keep its memory until it exits.
+
+The free lists are rebuilt to hand out the SVs and bodies of the fullest
+arenas first, so the sparse arenas may run empty for the next call.
+With glibc the freed pages are also returned to the OS, with
+C<malloc_trim()>.
+
+It walks all arenas and free lists, so call it rarely, e.g. after a
+request which freed a lot of data.
+
+=cut
+*/
+Size_t
+Perl_sv_trim_arenas(pTHX)
+{
+    Size_t freed = 0;
+    unsigned int type;
+
+    /* the heads of sv_clean_all() with SVf_BREAK are still referenced */
+    if (PL_in_clean_all)
+	return 0;
+    for (type = 0; type < SVt_LAST; type++)
+	if (PL_body_roots[type])
+	    freed += trim_body_arenas((svtype)type);
+    if (freed)
+	pack_arena_sets();
+    freed += trim_sv_arenas();
+    if (freed)
+	ARENA_MALLOC_TRIM();
+    return freed;
+}
+
 static const struct body_details fake_rv =
     { 0, 0, 0, SVt_IV, FALSE, NONV, NOARENA, 0 };
 
@@ -1612,15 +1971,16 @@ Perl_sv_grow(pTHX_ SV *const sv, STRLEN newlen)
 
 #ifdef PERL_COPY_ON_WRITE
     /* the new COW scheme uses SvPVX(sv)[SvLEN(sv)-1] (if spare)
-     * to store the COW count. So in general, allocate one more byte than
-     * asked for, to make it likely this byte is always spare: and thus
-     * make more strings COW-able.
+     * to store the COW count, or the last aligned U32 with
+     * PERL_COW_REFCNT_WIDE. So in general, allocate the bytes for it
+     * more than asked for, to make it likely they are always spare: and
+     * thus make more strings COW-able.
      *
-     * Only increment if the allocation isn't MEM_SIZE_MAX,
+     * Only increment if the allocation isn't near MEM_SIZE_MAX,
      * otherwise it will wrap to 0.
      */
-    if ( newlen != MEM_SIZE_MAX )
-        newlen++;
+    if ( newlen < MEM_SIZE_MAX - 2 * sizeof(U32) )
+        newlen = SV_COW_GROW(newlen);
 #endif
 
 #if defined(PERL_USE_MALLOC_SIZE) && defined(Perl_safesysmalloc_size)
@@ -3017,6 +3377,219 @@ S_infnan_2pv(NV nv, char* buffer, size_t maxlen, char plus) {
     return s - buffer;
 }
 
+#ifdef PERL_FAST_NUMCONV
+
+/* 5**k for 0 <= k <= 27, the largest power of five fitting a U64.
+ * 10**k is pow5_u64[k] << k. */
+static const U64 pow5_u64[28] = {
+    UINT64_C(1), UINT64_C(5), UINT64_C(25), UINT64_C(125), UINT64_C(625),
+    UINT64_C(3125), UINT64_C(15625), UINT64_C(78125), UINT64_C(390625),
+    UINT64_C(1953125), UINT64_C(9765625), UINT64_C(48828125),
+    UINT64_C(244140625), UINT64_C(1220703125), UINT64_C(6103515625),
+    UINT64_C(30517578125), UINT64_C(152587890625), UINT64_C(762939453125),
+    UINT64_C(3814697265625), UINT64_C(19073486328125),
+    UINT64_C(95367431640625), UINT64_C(476837158203125),
+    UINT64_C(2384185791015625), UINT64_C(11920928955078125),
+    UINT64_C(59604644775390625), UINT64_C(298023223876953125),
+    UINT64_C(1490116119384765625), UINT64_C(7450580596923828125)
+};
+
+/* Helper for sv_2pv_flags and sv_vcatpvfn_flags.  Formats a finite,
+ * non-zero, normal NV exactly like C<"%.*g"> with C<digits> significant
+ * digits, writing it with a zero byte to the buffer, which needs room for
+ * C<digits + 8> bytes.
+ *
+ * The value is scaled by an exact power of ten in 128-bit integer
+ * arithmetic and rounded half-to-even, which is the correctly rounded
+ * result a conforming printf() produces.  Returns the written length,
+ * or zero if the value or its decimal exponent is outside the range
+ * handled here, in which case the caller uses snprintf() instead. */
+STATIC STRLEN
+S_nv_2pv_g(NV nv, char *const buffer, const int digits)
+{
+    union { NV nv; U64 u; } bits;
+    unsigned __int128 q = 0;
+    U64 mant, d;
+    I64 l2;
+    int bexp, dexp, k, shift, ndig, i;
+    char *s = buffer;
+    char tmp[17];
+
+    bits.nv = nv;
+    bexp = (int)((bits.u >> 52) & 0x7ff) - 1075;
+    /* |nv| == mant * 2**bexp; this also rejects zero, subnormals, inf and
+     * nan, and keeps every shift below inside 128 bits */
+    if (bexp < -150 || bexp > 100 || digits < 1 || digits > 17)
+        return 0;
+    mant = (bits.u & ((UINT64_C(1) << 52) - 1)) | (UINT64_C(1) << 52);
+
+    /* Estimate floor(log10(|nv|)) from log2(|nv|) in 20-bit fixed point,
+     * taking the mantissa bits as a linear approximation of the fraction.
+     * It can be one off either way near a power of ten, which the loop
+     * below corrects. */
+    l2 = ((I64)(bexp + 52) << 20) + (I64)((mant >> 32) & 0xfffff);
+    dexp = (int)((l2 * 1292913986 + ((I64)64 << 52)) >> 52) - 64;
+
+    for (i = 0; ; i++) {
+        k = digits - 1 - dexp;
+        shift = bexp + k;
+        if (k > 27 || k < -27 || i > 3)
+            return 0;
+        if (k >= 0) {
+            /* |nv| * 10**k == mant * 5**k * 2**shift */
+            q = (unsigned __int128)mant * pow5_u64[k];
+            if (shift >= 0) {
+                if (shift > 11)
+                    return 0;
+                q <<= shift;
+            }
+            else {
+                const unsigned __int128 half
+                    = (unsigned __int128)1 << (-shift - 1);
+                const unsigned __int128 rem = q & ((half << 1) - 1);
+                q >>= -shift;
+                if (rem > half || (rem == half && (q & 1)))
+                    q++;
+            }
+        }
+        else {
+            /* |nv| * 10**k == mant * 2**shift / 5**-k */
+            unsigned __int128 num = mant, den = pow5_u64[-k], rem;
+            if (shift >= 0)
+                num <<= shift;
+            else
+                den <<= -shift;
+            q = num / den;
+            rem = num - q * den;
+            if (rem > den - rem || (rem == den - rem && (q & 1)))
+                q++;
+        }
+        /* rounding may have carried into one more digit */
+        if (q >= (unsigned __int128)(pow5_u64[digits] << digits))
+            dexp++;
+        else if (q < (unsigned __int128)(pow5_u64[digits - 1] << (digits - 1)))
+            dexp--;
+        else
+            break;
+    }
+
+    d = (U64)q;
+    for (i = digits; i-- > 0; ) {
+        tmp[i] = (char)('0' + d % 10);
+        d /= 10;
+    }
+    /* %g drops trailing zeros, and the radix point if nothing is left */
+    ndig = digits;
+    while (ndig > 1 && tmp[ndig - 1] == '0')
+        ndig--;
+
+    if (bits.u >> 63)
+        *s++ = '-';
+    if (dexp < -4 || dexp >= digits) {
+        *s++ = tmp[0];
+        if (ndig > 1) {
+            *s++ = '.';
+            Copy(tmp + 1, s, ndig - 1, char);
+            s += ndig - 1;
+        }
+        *s++ = 'e';
+        if (dexp < 0) {
+            *s++ = '-';
+            dexp = -dexp;
+        }
+        else
+            *s++ = '+';
+        assert(dexp < 100);
+        *s++ = (char)('0' + dexp / 10);
+        *s++ = (char)('0' + dexp % 10);
+    }
+    else if (dexp >= 0) {
+        Copy(tmp, s, dexp + 1, char);
+        s += dexp + 1;
+        if (ndig > dexp + 1) {
+            *s++ = '.';
+            Copy(tmp + dexp + 1, s, ndig - dexp - 1, char);
+            s += ndig - dexp - 1;
+        }
+    }
+    else {
+        *s++ = '0';
+        *s++ = '.';
+        for (i = -1; i > dexp; i--)
+            *s++ = '0';
+        Copy(tmp, s, ndig, char);
+        s += ndig;
+    }
+    *s = '\0';
+    return s - buffer;
+}
+
+/* Helper for sv_sprintf_const.  Formats a finite NV exactly like
+ * C<"%.*f"> with C<precis> digits after the point, back filling the
+ * buffer before endbuf like F0convert.  Returns the start of the string
+ * and sets *len, or returns NULL if the value scaled by 10**precis does
+ * not fit a U64. */
+STATIC char *
+S_nv_2pv_f(NV nv, char *const endbuf, const int precis, STRLEN *const len)
+{
+    union { NV nv; U64 u; } bits;
+    unsigned __int128 q;
+    U64 mant, d;
+    int bexp, shift, i;
+    char *p = endbuf;
+
+    bits.nv = nv;
+    bexp = (int)((bits.u >> 52) & 0x7ff);
+    mant = bits.u & ((UINT64_C(1) << 52) - 1);
+    if (bexp == 0x7ff || precis < 0 || precis > 27)
+        return NULL;
+    if (bexp) {
+        mant |= UINT64_C(1) << 52;
+        bexp -= 1075;
+    }
+    else
+        bexp = -1074;
+
+    /* |nv| * 10**precis == mant * 5**precis * 2**shift */
+    q = (unsigned __int128)mant * pow5_u64[precis];
+    shift = bexp + precis;
+    if (shift >= 0) {
+        if (shift > 11)
+            return NULL;
+        q <<= shift;
+    }
+    else if (shift <= -128)
+        q = 0;      /* below 2**-12, since q < 2**116 */
+    else {
+        const unsigned __int128 half = (unsigned __int128)1 << (-shift - 1);
+        const unsigned __int128 rem = q & ((half << 1) - 1);
+        q >>= -shift;
+        if (rem > half || (rem == half && (q & 1)))
+            q++;
+    }
+    if (q >> 64)
+        return NULL;
+
+    d = (U64)q;
+    for (i = 0; i < precis; i++) {
+        *--p = (char)('0' + d % 10);
+        d /= 10;
+    }
+    if (precis)
+        *--p = '.';
+    do {
+        *--p = (char)('0' + d % 10);
+        d /= 10;
+    } while (d);
+    /* like printf, a negative value that rounds to zero keeps its sign */
+    if (bits.u >> 63)
+        *--p = '-';
+    *len = endbuf - p;
+    return p;
+}
+
+#endif /* PERL_FAST_NUMCONV */
+
 /*
 =for apidoc sv_2pv_flags
 
@@ -3234,7 +3807,10 @@ Perl_sv_2pv_flags(pTHX_ SV *const sv, STRLEN *const lp, const I32 flags)
 
                 s = SvGROW_mutable(sv, size);
 #ifndef USE_LOCALE_NUMERIC
-                SNPRINTF_G(SvNVX(sv), s, SvLEN(sv), NV_DIG);
+#  ifdef PERL_FAST_NUMCONV
+                if (!S_nv_2pv_g(SvNVX(sv), s, NV_DIG))
+#  endif
+                    SNPRINTF_G(SvNVX(sv), s, SvLEN(sv), NV_DIG);
 
                 SvPOK_on(sv);
 #else
@@ -3249,7 +3825,10 @@ Perl_sv_2pv_flags(pTHX_ SV *const sv, STRLEN *const lp, const I32 flags)
                         s = SvGROW_mutable(sv, size);
                     }
 
-                    SNPRINTF_G(SvNVX(sv), s, SvLEN(sv), NV_DIG);
+#  ifdef PERL_FAST_NUMCONV
+                    if (local_radix || !S_nv_2pv_g(SvNVX(sv), s, NV_DIG))
+#  endif
+                        SNPRINTF_G(SvNVX(sv), s, SvLEN(sv), NV_DIG);
 
                     /* If the radix character is UTF-8, and actually is in the
                      * output, turn on the UTF-8 flag for the scalar */
@@ -3649,22 +4228,24 @@ Perl_sv_utf8_upgrade_flags_grow(pTHX_ SV *const sv, const I32 flags, STRLEN extr
 
             /* Set the NUL at the end */
             d = (U8 *) SvEND(sv);
-            *d-- = '\0';
+            *d = '\0';
 
-            /* Having decremented d, it points to the position to put the
-             * very last byte of the expanded string.  Go backwards through
-             * the string, copying and expanding as we go, stopping when we
-             * get to the part that is invariant the rest of the way down */
+            /* d is the end of the expanded string.  Go backwards through
+             * the string, copying and expanding as we go, a block at a time
+             * where possible, stopping when we get to the part that is
+             * invariant the rest of the way down */
 
-            e--;
-            while (e >= t) {
+            while (e > t) {
+                e = (U8 *) _utf8_from_bytes_back(t, e, &d);
+                if (e <= t)
+                    break;
+                e--;
                 if (NATIVE_BYTE_IS_INVARIANT(*e)) {
-                    *d-- = *e;
+                    *--d = *e;
                 } else {
-                    *d-- = UTF8_EIGHT_BIT_LO(*e);
-                    *d-- = UTF8_EIGHT_BIT_HI(*e);
+                    *--d = UTF8_EIGHT_BIT_LO(*e);
+                    *--d = UTF8_EIGHT_BIT_HI(*e);
                 }
-                e--;
             }
 
 	    if (SvTYPE(sv) >= SVt_PVMG && SvMAGIC(sv)) {
@@ -4680,7 +5261,7 @@ Perl_sv_setsv_flags(pTHX_ SV *dstr, SV* sstr, const I32 flags)
 		       && CowREFCNT(sstr) != SV_COW_REFCNT_MAX  ))
 		   : (  (sflags & CAN_COW_MASK) == CAN_COW_FLAGS
 		     && !(SvFLAGS(dstr) & SVf_BREAK)
-                        && CHECK_COW_THRESHOLD(cur,len) && cur+1 < len /* <= for new cow */
+                        && CHECK_COW_THRESHOLD(cur,len) && SvCOW_ROOM(sstr)
                      && (CHECK_COWBUF_THRESHOLD(cur,len) || SvLEN(dstr) < cur+1)
 		    ))
 #else
@@ -4741,6 +5322,11 @@ Perl_sv_setsv_flags(pTHX_ SV *dstr, SV* sstr, const I32 flags)
 	} else {
 	    /* Failed the swipe test, and we cannot do copy-on-write either.
 	       Have to copy the string.  */
+#ifdef PERL_COPY_ON_WRITE
+	    if (UNLIKELY(sflags & SVf_IsCOW && len
+			 && CowREFCNT(sstr) == SV_COW_REFCNT_MAX))
+		PL_cowrefcnt_capped++;
+#endif
 	    SvGROW(dstr, cur + 1);	/* inlined from sv_setpvn */
 	    Move(SvPVX_const(sstr),SvPVX(dstr),cur,char);
 	    SvCUR_set(dstr, cur);
@@ -4914,7 +5500,7 @@ Perl_sv_setsv_cow(pTHX_ SV *dstr, SV *sstr)
                 HEK_TAINTED_on(hek);
 	    goto common_exit;
 	}
-	assert(SvCUR(sstr)+1 < SvLEN(sstr));
+	assert(SvCOW_ROOM(sstr));
 	assert(CowREFCNT(sstr) < SV_COW_REFCNT_MAX);
     } else {
 	assert ((SvFLAGS(sstr) & CAN_COW_MASK) == CAN_COW_FLAGS);
@@ -5566,10 +6152,7 @@ Perl_sv_catpvn_flags(pTHX_ SV *const dsv, const char *sstr, const STRLEN slen, c
 	SvGROW(dsv, dlen + slen * 2);
 	d = (U8 *)SvPVX(dsv) + dlen;
 
-	while (sstr < send) {
-            append_utf8_from_native_byte(*sstr, &d);
-	    sstr++;
-	}
+	d = _utf8_from_bytes((const U8 *)sstr, (const U8 *)send, d);
 	SvCUR_set(dsv, d-(const U8 *)SvPVX(dsv));
     }
     *SvEND(dsv) = '\0';
@@ -7438,7 +8021,31 @@ S_sv_pos_u2b_cached(pTHX_ SV *const sv, MAGIC **const mgp, const U8 *const start
 		return cache[3];
 	    }
 
-	    if (cache[0] < uoffset) {
+	    if (cache[PERL_MAGIC_UTF8_SAMPLES]) {
+		/* The index knows a position less than PERL_UTF8_INDEX_STEP
+		   characters before, unless a cached pair is closer.  */
+		STRLEN k = uoffset / PERL_UTF8_INDEX_STEP;
+		if (k > cache[PERL_MAGIC_UTF8_SAMPLES])
+		    k = cache[PERL_MAGIC_UTF8_SAMPLES];
+		if (k && k * PERL_UTF8_INDEX_STEP > uoffset0) {
+		    uoffset0 = k * PERL_UTF8_INDEX_STEP;
+		    boffset0 = cache[PERL_MAGIC_UTF8_INDEX + k - 1];
+		}
+		if (cache[0] < uoffset && cache[0] > uoffset0) {
+		    uoffset0 = cache[0];
+		    boffset0 = cache[1];
+		}
+		else if (cache[2] < uoffset && cache[2] > uoffset0) {
+		    uoffset0 = cache[2];
+		    boffset0 = cache[3];
+		}
+		uoffset -= uoffset0;
+		boffset = boffset0
+		    + sv_pos_u2b_forwards(start + boffset0,
+					  send, &uoffset, &at_end);
+		uoffset += uoffset0;
+	    }
+	    else if (cache[0] < uoffset) {
 		/* The cache already knows part of the way.   */
 		if (cache[0] > uoffset0) {
 		    /* The cache knows more than the passed in pair  */
@@ -7673,11 +8280,30 @@ S_utf8_mg_pos_cache_update(pTHX_ SV *const sv, MAGIC **const mgp, const STRLEN b
     assert(*mgp);
 
     if (!(cache = (STRLEN *)(*mgp)->mg_ptr)) {
-	Newxz(cache, PERL_MAGIC_UTF8_CACHESIZE * 2, STRLEN);
+	Newxz(cache, PERL_MAGIC_UTF8_INDEX, STRLEN);
 	(*mgp)->mg_ptr = (char *) cache;
     }
     assert(cache);
 
+    if (PERL_UTF8_INDEX_MIN && blen >= PERL_UTF8_INDEX_MIN
+        && !cache[PERL_MAGIC_UTF8_SAMPLES] && SvPOKp(sv)) {
+	/* Roughly the bytes walked for this lookup, from the closest
+	   known position. Once that adds up to the whole string, build
+	   the index, which costs about one walk.  */
+	STRLEN walked = byte;
+	if (cache[1] && (cache[1] > byte ? cache[1] - byte : byte - cache[1]) < walked)
+	    walked = cache[1] > byte ? cache[1] - byte : byte - cache[1];
+	if (cache[3] && (cache[3] > byte ? cache[3] - byte : byte - cache[3]) < walked)
+	    walked = cache[3] > byte ? cache[3] - byte : byte - cache[3];
+	if ((*mgp)->mg_len != -1 && blen - byte < walked)
+	    walked = blen - byte;
+	cache[PERL_MAGIC_UTF8_WALKED] += walked;
+	if (cache[PERL_MAGIC_UTF8_WALKED] >= blen) {
+	    utf8_mg_index_build(*mgp, (const U8 *)SvPVX_const(sv), blen);
+	    cache = (STRLEN *)(*mgp)->mg_ptr;
+	}
+    }
+
     if (PL_utf8cache < 0 && SvPOKp(sv)) {
 	/* SvPOKp() because, if sv is a reference, then SvPVX() is actually
 	   a pointer.  Note that we no longer cache utf8 offsets on refer-
@@ -7770,6 +8396,48 @@ S_utf8_mg_pos_cache_update(pTHX_ SV *const sv, MAGIC **const mgp, const STRLEN b
     ASSERT_UTF8_CACHE(cache);
 }
 
+/* Add the sampled index to the pos cache of a long UTF-8 string: the byte
+   offset of every PERL_UTF8_INDEX_STEP'th character. It is freed with the
+   cache by magic_setutf8() when the string is modified. */
+static void
+S_utf8_mg_index_build(pTHX_ MAGIC *const mg, const U8 *const start,
+                      const STRLEN blen)
+{
+    const U8 * const send = start + blen;
+    const U8 *s = start;
+    const STRLEN max = blen / PERL_UTF8_INDEX_STEP;
+    STRLEN *cache = (STRLEN *) mg->mg_ptr;
+    STRLEN chars = 0, n = 0;
+
+    PERL_ARGS_ASSERT_UTF8_MG_INDEX_BUILD;
+
+    Renew(cache, PERL_MAGIC_UTF8_INDEX + max, STRLEN);
+    while (n < max) {
+	const STRLEN target = (n + 1) * PERL_UTF8_INDEX_STEP;
+	while (chars < target && s < send) {
+	    const STRLEN need = target - chars;
+	    const U8 *p = s;
+	    if (need >= 16)
+		p = _utf8_valid_prefix(s, need < (STRLEN)(send - s)
+					  ? s + need : send, &chars, 0);
+	    if (p > s)
+		s = p;
+	    else {
+		s += UTF8SKIP(s);
+		chars++;
+	    }
+	}
+	if (s >= send)
+	    break;
+	cache[PERL_MAGIC_UTF8_INDEX + n++] = s - start;
+    }
+    if (n < max)
+	Renew(cache, PERL_MAGIC_UTF8_INDEX + n, STRLEN);
+    cache[PERL_MAGIC_UTF8_SAMPLES] = n;
+    cache[PERL_MAGIC_UTF8_WALKED] = 0;
+    mg->mg_ptr = (char *) cache;
+}
+
 /* We already know all of the way, now we may be able to walk back.  The same
    assumption is made as in S_sv_pos_u2b_midway(), namely that walking
    backward is half the speed of walking forward. */
@@ -7849,7 +8517,34 @@ Perl_sv_pos_b2u_flags(pTHX_ SV *const sv, STRLEN const offset, U32 flags)
 		return cache[2];
 	    }
 
-	    if (cache[1] < offset) {
+	    if (cache[PERL_MAGIC_UTF8_SAMPLES]) {
+		/* Search the index for the last sample before offset, and
+		   count on from it, or from a closer cached pair.  */
+		const STRLEN * const samples = cache + PERL_MAGIC_UTF8_INDEX;
+		STRLEN lo = 0, hi = cache[PERL_MAGIC_UTF8_SAMPLES];
+		STRLEN u = 0, b = 0;
+		while (lo < hi) {
+		    const STRLEN mid = (lo + hi) / 2;
+		    if (samples[mid] <= offset)
+			lo = mid + 1;
+		    else
+			hi = mid;
+		}
+		if (lo) {
+		    u = lo * PERL_UTF8_INDEX_STEP;
+		    b = samples[lo - 1];
+		}
+		if (cache[1] < offset && cache[1] > b) {
+		    u = cache[0];
+		    b = cache[1];
+		}
+		else if (cache[3] < offset && cache[3] > b) {
+		    u = cache[2];
+		    b = cache[3];
+		}
+		len = u + utf8_length(s + b, send);
+	    }
+	    else if (cache[1] < offset) {
 		/* We already know part of the way. */
 		if (mg->mg_len != -1) {
 		    /* Actually, we know the end too.  */
@@ -10687,6 +11382,10 @@ Perl_sv_bless(pTHX_ SV *const sv, HV *const stash)
     if (SvSMAGICAL(tmpRef))
         if (mg_find(tmpRef, PERL_MAGIC_ext) || mg_find(tmpRef, PERL_MAGIC_uvar))
             mg_set(tmpRef);
+#ifdef PERL_HV_SHAPES
+    if (SvTYPE(tmpRef) == SVt_PVHV && !oldstash)
+        (void)hv_shape(MUTABLE_HV(tmpRef));
+#endif
 
     return sv;
 }
@@ -11301,8 +12000,339 @@ S_F0convert(NV nv, char *const endbuf, STRLEN *const len)
     return NULL;
 }
 
+/* A constant sprintf format compiled into a list of directives.  Each
+ * directive is the literal text before it followed by one conversion
+ * consuming one argument.  The last one has no conversion if there is
+ * text after the last conversion.  Only the subset handled by
+ * sv_sprintf_const() is compiled: %s, %d, %i and %f with the "-" and
+ * "0" flags and an explicit width, a precision for %f only, and %%.
+ * Anything else leaves the format to sv_vcatpvfn_flags(). */
+typedef struct {
+    STRLEN lit;         /* offset of the literal text in SPRINTF_PROG_LIT */
+    STRLEN litlen;
+    U16    width;
+    U8     precis;      /* digits after the point for 'f' */
+    char   conv;        /* 's', 'd' or 'f'; 0 for trailing text */
+    bool   left;        /* "%-..." */
+    bool   fill;        /* "%0..." */
+} sprintf_insn_t;
+
+typedef struct {
+    U32    flags;       /* SPRINTF_PROG_* */
+    U32    ninsns;
+    U32    nargs;
+    STRLEN patlen;
+    sprintf_insn_t insns[1];
+} sprintf_prog_t;
+
+#define SPRINTF_PROG_OK     0x01    /* the format could be compiled */
+#define SPRINTF_PROG_NV     0x02    /* has a %f */
+
+/* the format is stored after the directives, followed by the literal
+ * text with any %% reduced to % */
+#define SPRINTF_PROG_TEXT(prog) \
+    ((const char *)((prog)->insns + (prog)->ninsns))
+#define SPRINTF_PROG_LIT(prog) (SPRINTF_PROG_TEXT(prog) + (prog)->patlen)
+
+/* Compiles pat into prog->insns and the literal text into lit.  Returns
+ * FALSE if pat uses anything beyond the subset described above. */
+STATIC bool
+S_sprintf_compile(const char *pat, const char *const patend,
+                  sprintf_prog_t *const prog, char *const lit)
+{
+    sprintf_insn_t *insn = prog->insns;
+    char *l = lit;
+
+    insn->lit = 0;
+    while (pat < patend) {
+        int width = 0, precis = 6;
+        bool left = FALSE, fill = FALSE;
+        char c;
+
+        if (*pat != '%') {
+            *l++ = *pat++;
+            continue;
+        }
+        if (++pat < patend && *pat == '%') {
+            *l++ = *pat++;
+            continue;
+        }
+        for (; pat < patend; pat++) {
+            if (*pat == '-')
+                left = TRUE;
+            else if (*pat == '0')
+                fill = TRUE;
+            else
+                break;
+        }
+        while (pat < patend && isDIGIT(*pat)) {
+            width = width * 10 + (*pat++ - '0');
+            if (width > 9999)
+                return FALSE;
+        }
+        c = pat < patend ? *pat++ : '\0';
+        if (c == '.') {
+            /* "%.f" is "%.0f", and leading zeros are skipped */
+            precis = 0;
+            while (pat < patend && isDIGIT(*pat)) {
+                precis = precis * 10 + (*pat++ - '0');
+                if (precis > 27)
+                    return FALSE;
+            }
+            c = pat < patend ? *pat++ : '\0';
+            if (c != 'f')
+                return FALSE;
+        }
+        if (c == 'i')
+            c = 'd';
+        if (c != 's' && c != 'd' && c != 'f')
+            return FALSE;
+        if (c == 'f')
+            prog->flags |= SPRINTF_PROG_NV;
+        insn->litlen = l - lit - insn->lit;
+        insn->width = (U16)width;
+        insn->precis = (U8)precis;
+        insn->conv = c;
+        insn->left = left;
+        insn->fill = fill;
+        insn++;
+        insn->lit = l - lit;
+        prog->nargs++;
+    }
+    insn->litlen = l - lit - insn->lit;
+    if (insn->litlen) {
+        insn->conv = '\0';
+        insn++;
+    }
+    prog->ninsns = insn - prog->insns;
+    return TRUE;
+}
 
-/* XXX maybe_tainted is never assigned to, so the doc above is lying. */
+static const MGVTBL vtbl_sprintf_prog = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+/* Returns the compiled form of a constant format, compiling it on first
+ * use, or NULL if the format is not constant or uses more than
+ * S_sprintf_compile() handles.  Kept as PERL_MAGIC_ext on the format SV
+ * like the compiled pack templates in pp_pack.c. */
+STATIC const sprintf_prog_t *
+S_sprintf_prog(pTHX_ SV *const pat_sv)
+{
+    const char *pat;
+    STRLEN patlen;
+    const sprintf_prog_t *prog;
+    sprintf_prog_t *newprog;
+    SV *progsv;
+
+    if (!SvREADONLY(pat_sv) || !SvPOK(pat_sv) || SvUTF8(pat_sv)
+        || SvGMAGICAL(pat_sv) || SvIMMORTAL(pat_sv))
+        return NULL;
+    pat = SvPVX_const(pat_sv);
+    patlen = SvCUR(pat_sv);
+    if (SvRMAGICAL(pat_sv)) {
+        const MAGIC * const mg =
+            mg_findext(pat_sv, PERL_MAGIC_ext, &vtbl_sprintf_prog);
+        if (mg) {
+            prog = (const sprintf_prog_t *)SvPVX_const(mg->mg_obj);
+            /* The text is checked in case the SV was made writable and
+               changed in between */
+            if ((prog->flags & SPRINTF_PROG_OK) && prog->patlen == patlen
+                && memEQ(SPRINTF_PROG_TEXT(prog), pat, patlen))
+                return prog;
+            return NULL;
+        }
+    }
+
+    /* every conversion takes at least two bytes of the format */
+    progsv = newSV(sizeof(sprintf_prog_t)
+                   + (patlen / 2 + 1) * sizeof(sprintf_insn_t) + 2 * patlen);
+    SvPOK_on(progsv);
+    newprog = (sprintf_prog_t *)SvPVX(progsv);
+    Zero(newprog, 1, sprintf_prog_t);
+    newprog->patlen = patlen;
+    /* compile into a scratch buffer first, since the literal text goes
+     * after the directives */
+    {
+        char *lit;
+        STRLEN litlen = 0;
+        Newx(lit, patlen + 1, char);
+        if (S_sprintf_compile(pat, pat + patlen, newprog, lit)) {
+            const sprintf_insn_t *last = newprog->insns + newprog->ninsns;
+            newprog->flags |= SPRINTF_PROG_OK;
+            if (newprog->ninsns)
+                litlen = last[-1].lit + last[-1].litlen;
+        }
+        else
+            newprog->ninsns = 0;
+        Copy(pat, (char *)SPRINTF_PROG_TEXT(newprog), patlen, char);
+        Copy(lit, (char *)SPRINTF_PROG_LIT(newprog), litlen, char);
+        Safefree(lit);
+        SvCUR_set(progsv, SPRINTF_PROG_LIT(newprog) + litlen
+                          - (char *)newprog);
+    }
+    SvPV_shrink_to_cur(progsv);
+    newprog = (sprintf_prog_t *)SvPVX(progsv);
+    sv_magicext(pat_sv, progsv, PERL_MAGIC_ext, &vtbl_sprintf_prog, NULL, 0);
+    SvREFCNT_dec_NN(progsv);
+    return newprog->flags & SPRINTF_PROG_OK ? newprog : NULL;
+}
+
+/*
+=for apidoc sv_sprintf_const
+
+Helper for C<do_sprintf>: sets C<sv> to the result of formatting the
+C<sv_count> arguments in C<svargs> with the constant format C<pat_sv>,
+using a compiled form of the format cached on it.  Returns false,
+leaving the work to C<sv_vsetpvfn>, if the format is not constant, uses
+more than C<%s>, C<%d>, C<%i>, C<%f> with the C<-> and C<0> flags and a
+width, or C<%%>, or if any argument needs more than plain conversion:
+magic, references, undef, UTF-8, non-numeric strings for numeric
+formats, infinities and NaNs, a wrong argument count or a numeric
+locale.
+
+=cut
+*/
+
+bool
+Perl_sv_sprintf_const(pTHX_ SV *const sv, SV *const pat_sv,
+                      SV **const svargs, const SSize_t sv_count)
+{
+    const sprintf_prog_t * const prog = S_sprintf_prog(aTHX_ pat_sv);
+    const sprintf_insn_t *insn, *insnend;
+    const char *lit;
+    SV **argp = svargs;
+    SSize_t i;
+
+    PERL_ARGS_ASSERT_SV_SPRINTF_CONST;
+
+    if (!prog || (SSize_t)prog->nargs != sv_count)
+        return FALSE;
+#ifdef PERL_FAST_NUMCONV
+#  ifdef USE_LOCALE_NUMERIC
+    if ((prog->flags & SPRINTF_PROG_NV) && IN_LC(LC_NUMERIC))
+        return FALSE;
+#  endif
+#else
+    if (prog->flags & SPRINTF_PROG_NV)
+        return FALSE;
+#endif
+    for (i = 0; i < sv_count; i++) {
+        SV * const arg = svargs[i];
+        if (arg == sv || SvGMAGICAL(arg) || SvROK(arg) || !SvOK(arg))
+            return FALSE;
+    }
+
+    SvPVCLEAR(sv);
+    lit = SPRINTF_PROG_LIT(prog);
+    insnend = prog->insns + prog->ninsns;
+    for (insn = prog->insns; insn < insnend; insn++) {
+        union {
+            char arr[TYPE_CHARS(UV) + 32];
+            U16 dummy;
+        } buf;
+        const char *eptr;
+        STRLEN elen;
+        char sign = '\0';
+        STRLEN need, gap;
+        char *s;
+
+        if (insn->litlen)
+            S_sv_catpvn_simple(aTHX_ sv, lit + insn->lit, insn->litlen);
+        if (!insn->conv)
+            break;
+
+        {
+            SV * const arg = *argp++;
+            if (insn->conv == 's') {
+                eptr = SvPV_nomg_const(arg, elen);
+                if (DO_UTF8(arg))
+                    goto fallback;
+            }
+            else {
+                /* the numeric conversions must not warn, so strings only
+                 * get here if they are plain numbers */
+                if (!SvIOK(arg) && !SvNOK(arg)) {
+                    UV uv;
+                    const int numtype =
+                        grok_number(SvPVX_const(arg), SvCUR(arg), &uv);
+                    if (insn->conv == 'd'
+                        ? ((numtype & ~IS_NUMBER_NEG) != IS_NUMBER_IN_UV
+                           || uv > (UV)IV_MAX)
+                        : (!numtype || (numtype & (IS_NUMBER_INFINITY
+                                                  |IS_NUMBER_NAN))))
+                        goto fallback;
+                }
+                if (insn->conv == 'd') {
+                    char *ebuf;
+                    IV iv;
+                    if (SvIOK(arg) && SvIsUV(arg))
+                        goto fallback;
+                    if (SvNOK(arg) && !SvIOK(arg)
+                        && Perl_isinfnan(SvNVX(arg)))
+                        goto fallback;
+                    iv = SvIV_nomg(arg);
+                    eptr = uiv_2buf(buf.arr, iv, 0, 0, &ebuf);
+                    elen = ebuf - eptr;
+                    if (iv < 0) {
+                        sign = '-';
+                        eptr++;
+                        elen--;
+                    }
+                }
+                else {
+#ifdef PERL_FAST_NUMCONV
+                    const NV nv = SvNV_nomg(arg);
+                    if (Perl_isinfnan(nv))
+                        goto fallback;
+                    eptr = S_nv_2pv_f(nv, buf.arr + sizeof(buf.arr),
+                                      insn->precis, &elen);
+                    if (!eptr)
+                        goto fallback;
+                    if (*eptr == '-') {
+                        sign = '-';
+                        eptr++;
+                        elen--;
+                    }
+#else
+                    NOT_REACHED; /* NOTREACHED */
+#endif
+                }
+            }
+        }
+
+        /* append the sign, padding and the element */
+        need = elen + (sign ? 1 : 0);
+        gap = insn->width > need ? insn->width - need : 0;
+        s = SvGROW(sv, SvCUR(sv) + need + gap + 1) + SvCUR(sv);
+        if (insn->left) {
+            if (sign)
+                *s++ = sign;
+            Copy(eptr, s, elen, char);
+            s += elen;
+            for (; gap; gap--)
+                *s++ = ' ';
+        }
+        else {
+            if (!insn->fill)
+                for (; gap; gap--)
+                    *s++ = ' ';
+            if (sign)
+                *s++ = sign;
+            for (; gap; gap--)
+                *s++ = '0';
+            Copy(eptr, s, elen, char);
+            s += elen;
+        }
+        *s = '\0';
+        SvCUR_set(sv, s - SvPVX_const(sv));
+    }
+    SvTAINT(sv);
+    return TRUE;
+
+  fallback:
+    SvCUR_set(sv, 0);
+    *SvPVX(sv) = '\0';
+    return FALSE;
+}
 
 void
 Perl_sv_vcatpvfn(pTHX_ SV *const sv, const char *const pat, const STRLEN patlen,
@@ -13228,8 +14258,19 @@ Perl_sv_vcatpvfn_flags(pTHX_ SV *const sv, const char *const pat, const STRLEN p
                 && !fill
                 && intsize != 'q'
             ) {
-                SNPRINTF_G(fv, ebuf, sizeof(ebuf), precis);
-                elen = strlen(ebuf);
+#ifdef PERL_FAST_NUMCONV
+                /* after STORE_LC_NUMERIC_SET_TO_NEEDED() above, the radix
+                 * is a '.' unless we are in a non-standard locale */
+                if (
+#  ifdef USE_LOCALE_NUMERIC
+                    _NOT_IN_NUMERIC_STANDARD ||
+#  endif
+                    !(elen = S_nv_2pv_g(nv, ebuf, precis)))
+#endif
+                {
+                    SNPRINTF_G(fv, ebuf, sizeof(ebuf), precis);
+                    elen = strlen(ebuf);
+                }
                 eptr = ebuf;
                 goto float_concat;
 	    }
@@ -13948,7 +14989,11 @@ Perl_mg_dup(pTHX_ MAGIC *mg, CLONE_PARAMS *const param)
                                   ? nmg->mg_obj
                                   : sv_dup(nmg->mg_obj, param);
 
-	if (nmg->mg_ptr && nmg->mg_type != PERL_MAGIC_regex_global) {
+	if (nmg->mg_type == PERL_MAGIC_utf8)
+	    /* mg_len is the character length, not the size of the pos
+	       cache, which is rebuilt on demand */
+	    nmg->mg_ptr = NULL;
+	else if (nmg->mg_ptr && nmg->mg_type != PERL_MAGIC_regex_global) {
 	    if (nmg->mg_len > 0) {
 		nmg->mg_ptr	= SAVEPVN(nmg->mg_ptr, nmg->mg_len);
 		if (nmg->mg_type == PERL_MAGIC_overload_table &&
@@ -14507,7 +15552,35 @@ S_sv_dup_common(pTHX_ const SV *const sstr, CLONE_PARAMS *const param)
 		}
 		break;
 	    case SVt_PVHV:
-		if (HvARRAY((const HV *)sstr)) {
+		if (HvSHAPED(sstr)) {
+		    /* the objects of one class keep sharing their shapes */
+		    const struct hv_shape * const sshape = HvSHAPE(sstr);
+		    SV * const * const svals = HvSHAPED_VALS(sstr);
+		    struct hv_shape *dshape = (struct hv_shape *)
+			ptr_table_fetch(PL_ptr_table, sshape);
+		    struct xpvhv_shaped *dbody;
+		    U32 i;
+		    if (!dshape) {
+			Newxc(dshape, STRUCT_OFFSET(struct hv_shape, hs_heks)
+			      + sshape->hs_keys * sizeof(HEK*),
+			      char, struct hv_shape);
+			dshape->hs_refcnt = 0;
+			dshape->hs_keys = sshape->hs_keys;
+			dshape->hs_next = NULL;
+			for (i = 0; i < sshape->hs_keys; i++)
+			    dshape->hs_heks[i] = hek_dup(sshape->hs_heks[i], param);
+			ptr_table_store(PL_ptr_table, sshape, dshape);
+		    }
+		    dshape->hs_refcnt++;
+		    Newxc(dbody, STRUCT_OFFSET(struct xpvhv_shaped, xhvs_vals)
+			  + sshape->hs_keys * sizeof(SV*),
+			  char, struct xpvhv_shaped);
+		    dbody->xhvs_shape = dshape;
+		    for (i = 0; i < sshape->hs_keys; i++)
+			dbody->xhvs_vals[i] = sv_dup_inc(svals[i], param);
+		    HvARRAY(dstr) = (HE**)dbody;
+		}
+		else if (HvARRAY((const HV *)sstr)) {
 		    U32 i = 0;
 		    const bool sharekeys = !!HvSHAREKEYS(sstr);
 		    XPVHV * const dxhv = (XPVHV*)SvANY(dstr);
@@ -14552,6 +15625,7 @@ S_sv_dup_common(pTHX_ const SV *const sstr, CLONE_PARAMS *const param)
 			daux->xhv_name_count = saux->xhv_name_count;
 
 			daux->xhv_aux_flags = saux->xhv_aux_flags;
+			daux->xhv_split_todo = saux->xhv_split_todo;
 #ifdef PERL_HASH_RANDOMIZE_KEYS
 			daux->xhv_rand = saux->xhv_rand;
 			daux->xhv_last_rand = saux->xhv_last_rand;
@@ -14583,6 +15657,10 @@ S_sv_dup_common(pTHX_ const SV *const sstr, CLONE_PARAMS *const param)
                         daux->xhv_mro_meta = saux->xhv_mro_meta
                             ? mro_meta_dup(saux->xhv_mro_meta, param)
                             : 0;
+                        /* the perfect index points to the old HEs */
+                        daux->xhv_perfect = NULL;
+                        daux->xhv_oindex = NULL;
+                        daux->xhv_shapes = NULL;
 
 			/* Record stashes for possible cloning in Perl_clone(). */
 			if (HvNAME(sstr))
@@ -15537,7 +16615,6 @@ perl_clone_using(PerlInterpreter *proto_perl, UV flags,
 
 #ifdef DEBUGGING
     PL_max_refcnt	= 0;
-    PL_max_cowrefcnt	= 0;
     PL_max_refcnt_sv	= NULL;
     PL_count_null_ops	= 0;
     PL_sv_count		= 0;
@@ -15633,6 +16710,9 @@ perl_clone_using(PerlInterpreter *proto_perl, UV flags,
     ptr_table_store(PL_ptr_table, proto_perl->Istrtab, PL_strtab);
 
     Zero(PL_sv_consts, SV_CONSTS_COUNT, SV*);
+    Zero(PL_hv_icache, PERL_HV_ICACHE_SIZE, struct hv_icache);
+    PL_hv_splits = PL_hv_split_entries = 0;
+    PL_max_cowrefcnt = PL_cowrefcnt_capped = 0;
 
     /* This PV will be free'd special way so must set it same way op.c does */
     PL_compiling.cop_file    = savesharedpv(PL_compiling.cop_file);
@@ -16318,6 +17398,13 @@ S_find_hash_subscript(pTHX_ const HV *const hv, const SV *const val)
 			(HvTOTALKEYS(hv) > FUV_MAX_SEARCH_SIZE))
 	return NULL;
 
+    if (HvSHAPED(hv)) {
+	const struct hv_shape * const shape = HvSHAPE(hv);
+	for (i = 0; i < (I32)shape->hs_keys; i++)
+	    if (HvSHAPED_VALS(hv)[i] == val && val != UNDEF)
+		return sv_2mortal(newSVhek(shape->hs_heks[i]));
+	return NULL;
+    }
     array = HvARRAY(hv);
 
     for (i=HvMAX(hv); i>=0; i--) {
@@ -17041,6 +18128,7 @@ S_find_uninit_var(pTHX_ const OP *const obase, const SV *const uninit_sv,
 
     case OP_ENTERSUB:
     case OP_ENTERXSSUB:
+    case OP_ENTERINLINE:
     case OP_GOTO:
 	/* XXX tmp hack: these two may call an XS sub, and currently
 	  XS subs don't have a SUB entry on the context stack, so CV and
@@ -193,6 +193,19 @@ typedef enum {
 
 #define PERL_ARENA_ROOTS_SIZE	(SVt_LAST)
 
+/* filled by sv_arena_stats(), indexed by svtype. The bodies of SVt_NULL
+   are the HEs of the hashes. */
+struct sv_arena_stats {
+    UV		sas_heads[SVt_LAST];	/* live SV heads */
+    UV		sas_heads_free;
+    UV		sas_head_arenas;
+    UV		sas_head_bytes;
+    UV		sas_bodies[SVt_LAST];	/* live bodies */
+    UV		sas_bodies_free[SVt_LAST];
+    UV		sas_body_arenas[SVt_LAST];
+    UV		sas_body_bytes[SVt_LAST];
+};
+
 /* typedefs to eliminate some typing */
 typedef struct he HE;
 typedef struct hek HEK;
@@ -509,6 +522,7 @@ perform the upgrade if necessary.  See C<L</svtype>>.
 
 #define SVf_NATIVE	0x00010000  /* for lexicals in curpad[], the PV slot
                                        holds the value. */
+#define SVphv_SHAPED	SVf_NATIVE  /* PVHV values in a xpvhv_shaped vector */
 #ifdef USE_CPERL
 /* see above */
 #undef SVf_PROTECT
@@ -2040,21 +2054,38 @@ Like C<sv_catsv> but doesn't process magic.
 	(SvIsCOW(sv)					     \
 	 ? SvLEN(sv) ? CowREFCNT(sv) != SV_COW_REFCNT_MAX : 1 \
 	 : (SvFLAGS(sv) & CAN_COW_MASK) == CAN_COW_FLAGS       \
-			    && SvCUR(sv)+1 < SvLEN(sv))
+			    && SvCOW_ROOM(sv))
    /* Note: To allow 256 COW "copies", a refcnt of 0 means 1. */
-#   define CowREFCNT(sv)	(*(U8 *)(SvPVX(sv)+SvLEN(sv)-1))
+# ifdef PERL_COW_REFCNT_WIDE
+   /* The refcnt is the last aligned U32 of the buffer, so a string can
+      be shared 4G times instead of 256 before sv_setsv copies it. */
+#   define CowREFCNTp(sv)						\
+	((U32 *)INT2PTR(char *, (PTR2nat(SvPVX(sv) + SvLEN(sv))	\
+				  & ~(PTRV)(sizeof(U32) - 1)) - sizeof(U32)))
+#   define SV_COW_REFCNT_MAX	U32_MAX
+   /* the spare bytes sv_grow adds to a buffer of len bytes */
+#   define SV_COW_GROW(len)						\
+	((((len) + sizeof(U32) - 1) & ~(STRLEN)(sizeof(U32) - 1)) + sizeof(U32))
+# else
+#   define CowREFCNTp(sv)	((U8 *)(SvPVX(sv)+SvLEN(sv)-1))
 #   define SV_COW_REFCNT_MAX	((1 << sizeof(U8)*8) - 1)
+#   define SV_COW_GROW(len)	((len) + 1)
+# endif
+#   define CowREFCNT(sv)	(*CowREFCNTp(sv))
+   /* room for the trailing NUL and the refcnt */
+#   define SvCOW_ROOM(sv)	\
+	(SvPVX_const(sv) + SvCUR(sv) < (const char *)CowREFCNTp(sv))
 #   define CAN_COW_MASK	(SVf_POK|SVf_ROK|SVp_POK|SVf_FAKE| \
 			 SVf_OOK|SVf_BREAK|SVf_READONLY|SVf_PROTECT)
-# ifdef DEBUGGING
 #   define CowREFCNT_dec(sv)	CowREFCNT(sv)--
+# ifdef DEBUGGING
 #   define CowREFCNT_inc(sv) \
 			assert(CowREFCNT(sv) < SV_COW_REFCNT_MAX);       \
 			CowREFCNT(sv)++;                                 \
 			if (CowREFCNT(sv) > PL_max_cowrefcnt) PL_max_cowrefcnt++
 # else
-#   define CowREFCNT_dec(sv)	CowREFCNT(sv)--
-#   define CowREFCNT_inc(sv)	CowREFCNT(sv)++
+#   define CowREFCNT_inc(sv) \
+			if (++CowREFCNT(sv) > PL_max_cowrefcnt) PL_max_cowrefcnt++
 # endif
 #endif
 
@@ -6,7 +6,7 @@ BEGIN {
 	skip_all_without_perlio();
 }
 
-plan tests => 48;
+plan tests => 52;
 
 use_ok('PerlIO');
 
@@ -250,6 +250,26 @@ EOP
     ok !$main::PerlIO_code_injection, "Can't inject code via PerlIO->import";
 }
 
+{
+    # writes of a whole buffer or more go through to :unix, together
+    # with what is still buffered
+    my $big = join "", map { sprintf "%07d\n", $_ } 1 .. 20000;
+    ok(open(my $fh, ">:raw", $bin), "open for big writes");
+    print $fh "head\n";
+    print $fh $big, "mid\n", $big;
+    is(tell($fh), 9 + 2 * length($big), "tell after big writes");
+    $fh->autoflush(1);
+    print $fh "tail\n", $big;
+    close $fh;
+    is(-s $bin, 14 + 3 * length($big), "size after big writes");
+    open $fh, "<:raw", $bin or die "$bin: $!";
+    local $/;
+    my $got = <$fh>;
+    close $fh;
+    ok($got eq "head\n$big" . "mid\n$big" . "tail\n$big",
+       "content after big writes");
+}
+
 END {
     unlink_all $txt;
     unlink_all $bin;
@@ -260,4 +260,160 @@ package Magic {
     or diag join(" ",keys %a),"\n",join(" ",keys %b),"\n";
 }
 
+# study: perfect hash on readonly hashes
+{
+  my %h = map { ("k$_" => $_) } 1..1000;
+  Internals::SvREADONLY(%h, 1);
+  study %h;
+  my $ok = 1;
+  for (1..1000) { $ok = 0 unless $h{"k$_"} == $_ }
+  ok($ok, "perfect hash: all keys found");
+  ok(exists $h{k500}, "perfect hash: exists");
+  ok(!exists $h{k1001}, "perfect hash: not exists");
+  $h{k1} = 'x';
+  is($h{k1}, 'x', "perfect hash: store into existing key");
+  eval { my $x = $h{nokey} };
+  like($@, qr/^Attempt to access disallowed key 'nokey' in a restricted hash/,
+       "perfect hash: disallowed key");
+  delete $h{k2};
+  ok(!exists $h{k2}, "perfect hash: deleted key is a placeholder");
+  $h{k2} = 2;
+  is($h{k2}, 2, "perfect hash: store into placeholder");
+  Internals::SvREADONLY(%h, 0);
+  $h{new} = 1;
+  delete $h{k3};
+  Internals::SvREADONLY(%h, 1);
+  is($h{new}, 1, "perfect hash dropped on insert");
+  ok(!exists $h{k3}, "perfect hash dropped on delete");
+  is(scalar keys %h, 1000, "perfect hash: keys");
+  my %u = ("\x{100}" => 1, "\xe9" => 2, a => 3);
+  Internals::SvREADONLY(%u, 1);
+  study %u;
+  is($u{"\x{100}"}, 1, "perfect hash: utf8 key");
+  my $e = "\xe9"; utf8::upgrade($e);
+  is($u{$e}, 2, "perfect hash: upgraded key");
+}
+
+# open addressing index
+SKIP: {
+  skip_if_miniperl("No Hash::Util under miniperl", 9);
+  require Hash::Util;
+  sub Hash::Util::open_addressing (\%;$);
+  my %h = map { ("k$_" => $_) } 1..100;
+  Hash::Util::open_addressing(%h, 1);
+  my $ok = 1;
+  for (1..100) { $ok = 0 unless $h{"k$_"} == $_ }
+  ok($ok, "open addressing: all keys found");
+  ok(!exists $h{k101}, "open addressing: not exists");
+  # grow the index and the buckets, leave deleted slots behind
+  for my $round (1..5) {
+    $h{"n$_"} = $_ for 1..2000;
+    delete $h{"n$_"} for 1..2000;
+  }
+  is(scalar keys %h, 100, "open addressing: insert and delete churn");
+  $ok = 1;
+  for (1..100) { $ok = 0 unless $h{"k$_"} == $_ }
+  ok($ok, "open addressing: all keys found after churn");
+  my %seen;
+  while (my ($k) = each %h) { $seen{$k}++ }
+  is(scalar keys %seen, 100, "open addressing: each");
+  delete $h{$_} for grep /0$/, keys %seen;
+  ok(!exists $h{k10} && exists $h{k11}, "open addressing: delete");
+  Internals::SvREADONLY(%h, 1);
+  delete $h{k11};
+  ok(!exists $h{k11}, "open addressing: placeholder");
+  Internals::SvREADONLY(%h, 0);
+  Internals::hv_clear_placeholders(%h);
+  $h{k11} = 11;
+  is($h{k11}, 11, "open addressing: store after clear_placeholders");
+  my $e = "\xe9"; utf8::upgrade($e);
+  $h{"\xe9"} = 1;
+  is($h{$e}, 1, "open addressing: upgraded key");
+}
+
+# incremental split of big hashes, see PERL_HV_INCR_SPLIT_MIN
+{
+  my %h;
+  my $n = 70000; # grows to 2**17 buckets
+  $h{"k$_"} = $_ for 1..$n;
+  my $ok = 1;
+  for (1..$n) { $ok = 0 unless $h{"k$_"} == $_ }
+  ok($ok, "incremental split: all keys found");
+  # iterate while the split is pending, with lookups inside
+  my ($cnt, $bad) = (0, 0);
+  while (my ($k, $v) = each %h) { $cnt++; $bad++ unless $h{$k} == $v }
+  is("$cnt $bad", "$n 0", "incremental split: each sees every key once");
+  my %copy = %h;
+  is(scalar keys %copy, $n, "incremental split: copy");
+  delete $h{"k$_"} for 1..$n/2;
+  is(scalar(grep { exists $h{"k$_"} } 1..$n), $n/2, "incremental split: delete");
+  %h = ();
+  $h{"x$_"} = $_ for 1..1000;
+  is(scalar(grep { $h{"x$_"} == $_ } 1..1000), 1000,
+     "incremental split: store after clear");
+}
+
+# shared-key storage of objects, see hv_shape
+SKIP: {
+  skip_if_miniperl("No Hash::Util under miniperl", 12);
+  require Hash::Util;
+  sub Hash::Util::hash_shaped (\%;$);
+  package Shape::Pt { sub DESTROY { $main::destroyed++ } }
+  my @o = map { bless { x => $_, y => -$_, "\x{100}" => "u$_" }, "Shape::Pt" } 1..3;
+  ok(Hash::Util::hash_shaped(%{$o[$_]}, 1), "shaped: object $_") for 0..2;
+  my $ok = 1;
+  for (0..2) {
+    my $i = $_ + 1;
+    $ok = 0 unless $o[$_]{x} == $i && $o[$_]->{y} == -$i && $o[$_]{"\x{100}"} eq "u$i";
+  }
+  ok($ok, "shaped: fetch");
+  $o[0]{x} = 10; $o[0]{y}++;
+  ok(Hash::Util::hash_shaped(%{$o[0]}) && exists $o[0]{x} && !exists $o[0]{z}
+     && !defined $o[0]{z}, "shaped: store, exists and miss stay shaped");
+  {
+    local $o[0]{"\x{100}"} = "local";
+    is("$o[0]{x} $o[0]{y} $o[0]{qq{\x{100}}}", "10 0 local", "shaped: store and local");
+  }
+  is(join(",", sort keys %{$o[1]}), "x,y,\x{100}", "shaped: keys");
+  is(join(",", sort { $a <=> $b } grep /^-?\d/, values %{$o[1]}), "-2,2", "shaped: values");
+  $o[1]{z} = 1;
+  ok(!Hash::Util::hash_shaped(%{$o[1]}) && $o[1]{x} == 2 && $o[1]{z} == 1,
+     "shaped: new key unshapes");
+  delete $o[2]{x};
+  ok(!Hash::Util::hash_shaped(%{$o[2]}) && !exists $o[2]{x} && $o[2]{y} == -3,
+     "shaped: delete unshapes");
+  my %copy = %{$o[0]};
+  is(join(",", map "$_=$copy{$_}", sort keys %copy), "x=10,y=0,\x{100}=u1",
+     "shaped: copy");
+  $main::destroyed = 0;
+  @o = ();
+  is($main::destroyed, 3, "shaped: destroy");
+}
+
+# the inline cache of the constant key element ops, see hv_fetch_icache
+{
+  my %h = map { ("k$_" => $_) } 1..20;
+  my $get = sub { join ",", map { $_[0]{k5} // "u" } 1..2 };
+  is($get->(\%h), "5,5", "icache: fetch");
+  delete $h{k5};
+  is($get->(\%h), "u,u", "icache: delete");
+  $h{k5} = 55;
+  is($get->(\%h), "55,55", "icache: store after delete");
+  $h{"n$_"} = $_ for 1..2000;
+  is($get->(\%h), "55,55", "icache: hsplit");
+  my %other = (k5 => "other");
+  is($get->(\%other).$get->(\%h), "other,other55,55", "icache: other hash");
+  %h = ();
+  is($get->(\%h), "u,u", "icache: clear");
+  %h = (k5 => 6);
+  $h{k5}++ for 1..3;
+  is($h{k5}, 9, "icache: lvalue");
+  package Shape::IC { }
+  my @o = (bless({ k5 => 1, a => 2 }, "Shape::IC"),
+           bless({ b => 3, k5 => 4, c => 5 }, "Shape::IC"),
+           bless({ k5 => 6, a => 7 }, "Shape::IC"));
+  is(join(",", map $get->($_), @o, @o), "1,1,4,4,6,6,1,1,4,4,6,6",
+     "icache: objects of different shapes");
+}
+
 done_testing();
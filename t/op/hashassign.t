@@ -8,7 +8,7 @@ BEGIN {
 
 use strict;
 
-plan tests => 311;
+plan tests => 328;
 
 my @comma = ("key", "value");
 
@@ -542,3 +542,52 @@ SKIP: {
   %h = map{$_ => 1} (0..1);
   ok(%h);
 }
+
+{
+    # the list is stored at once by hv_store_list
+    my %h = (a => 1, b => 2, a => 3);
+    is(join(",", map "$_=$h{$_}", sort keys %h), "a=3,b=2",
+       "bulk: a later duplicate wins");
+    %h = map { $_ => $_ * 2 } 1..1000;
+    is(scalar(keys %h), 1000, "bulk: numeric keys");
+    is(scalar(grep { $h{$_} == $_ * 2 } 1..1000), 1000, "bulk: numeric values");
+    my $u = "\xe9";
+    utf8::upgrade($u);
+    %h = ("\x{100}" => 1, a => 2, "\xe9" => 3, $u => 4, b => 5);
+    is(scalar(keys %h), 4, "bulk: utf8 and downgradable keys");
+    is($h{"\xe9"}, 4, "bulk: an upgraded key replaces its downgraded one");
+    is($h{"\x{100}"}, 1, "bulk: utf8 key");
+    my %copy = %h;
+    is(join(",", map "$_=$copy{$_}", sort keys %copy),
+       join(",", map "$_=$h{$_}", sort keys %h), "bulk: shared keys");
+    {
+        package Bulk::Str;
+        use overload '""' => sub { $_[0]{s} };
+    }
+    my $o = bless { s => "obj" }, 'Bulk::Str';
+    %h = ((map { ("k$_" => $_) } 1..40), $o => "o", (map { ("j$_" => $_) } 1..40));
+    is(scalar(keys %h), 81, "bulk: an overloaded key in the list");
+    is($h{obj}, "o", "bulk: the overloaded key");
+    is($h{j40} + $h{k1}, 41, "bulk: keys around the overloaded key");
+    %h = map { ($_ => 1) } 1..100_000;
+    is(scalar(keys %h), 100_000, "bulk: a big list");
+    {
+        my @w;
+        local $SIG{__WARN__} = sub { push @w, @_ };
+        use warnings;
+        %h = (undef, 1, a => 2);
+        ok(exists $h{""}, "bulk: undef key");
+        like("@w", qr/uninitialized/, "bulk: undef key warns");
+    }
+
+    my $r = { a => 1, b => 2, a => 3 };
+    is(join(",", map "$_=$r->{$_}", sort keys %$r), "a=3,b=2",
+       "anonhash: a later duplicate wins");
+    $r = { map { $_ => [$_] } 1..500 };
+    is(scalar(keys %$r), 500, "anonhash: big");
+    is($r->{250}[0], 250, "anonhash: values are copied");
+    my $v = 1;
+    $r = { v => $v };
+    $v = 2;
+    is($r->{v}, 1, "anonhash: values are not aliased");
+}
@@ -16,6 +16,11 @@ unless ($hash_func) {
     $hash_func = $1;
   }
 }
+if ($hash_func eq 'SELECT') { # the one selected by $ENV{PERL_HASH_FUNC}
+  require Hash::Util;
+  $hash_func = Hash::Util::hash_function();
+  $hash_func =~ s/^SIPHASH_2_4$/SIPHASH/;
+}
 $hash_func =~ s/ONE_AT_A_TIME/OAAT/;
 my $fn = "op/seed-".lc($hash_func)."-8-0.dat";
 # The 3 Murmur variants are yet missing
@@ -49,6 +54,11 @@ unless ($hash_func) {
     $hash_func = $1;
   }
 }
+if ($hash_func eq 'SELECT') { # the one selected by $ENV{PERL_HASH_FUNC}
+  require Hash::Util;
+  $hash_func = Hash::Util::hash_function();
+  $hash_func =~ s/^SIPHASH_2_4$/SIPHASH/;
+}
 $hash_func =~ s/ONE_AT_A_TIME/OAAT/;
 my $fn = "op/seed-".lc($hash_func)."-8-0.dat";
 open my $fh, "<", $fn or die "$fn $!";
@@ -14,7 +14,7 @@ my $no_endianness = $] > 5.009 ? '' :
 my $no_signedness = $] > 5.009 ? '' :
   "Signed/unsigned pack modifiers not available on this perl";
 
-plan tests => 14718;
+plan tests => 14737;
 
 use strict;
 use warnings qw(FATAL all);
@@ -2098,3 +2098,57 @@ SKIP:
     fresh_perl_is('0.0 + unpack("u", "ab")', "", { stderr => 1 },
                   "ensure unpack u of invalid data nul terminates result");
 }
+
+{
+    # constant templates are compiled once and replayed on later calls
+    my $data = pack "N n C a4 (v)2 Z*", 0xdeadbeef, 513, 255, "ab c", 1, 2, "xyz";
+    for my $pass (1, 2) {
+        is(join(",", unpack "N n C a4 (v)2 Z*", $data),
+           "3735928559,513,255,ab c,1,2,xyz", "constant template, pass $pass");
+        is(scalar unpack("n C a4", substr $data, 4), 513,
+           "constant template in scalar context, pass $pass");
+        is(join(",", unpack "N n C A4", substr $data, 0, 7), "3735928559,513,255,",
+           "constant template on short data, pass $pass");
+        is(join(",", unpack "c n! # comment\n s> x2 Z3", "\x80\x80\x00\x01\xff..a\0b"),
+           "-128,-32768,511,a", "modifiers and comments, pass $pass");
+        is(unpack("H*", pack "n/a* (n N)2", "xy", 1, 2, 3, 4),
+           "00027879000100000002000300000004", "constant pack template, pass $pass");
+    }
+    my @warnings;
+    local $SIG{__WARN__} = sub { push @warnings, $_[0] };
+    no warnings 'FATAL';
+    use warnings 'unpack';
+    for (1, 2) {
+        my @x = unpack "C,C", "\1\2";
+    }
+    is(scalar @warnings, 2, "uncompilable templates still warn on every call");
+}
+
+{
+    # @lex = unpack stores into the array directly
+    my $data = pack "N*", 1..5;
+    my @a = (7, 8);
+    @a = unpack "N*", $data;
+    is("@a", "1 2 3 4 5", '@lex = unpack "N*"');
+    @a = unpack "n N2 d*", pack "n N2 d*", 7, 8, 9, 1.5, -2.5;
+    is("@a", "7 8 9 1.5 -2.5", '@lex = unpack "n N2 d*"');
+    @a = (pack "N2", 3, 4);
+    @a = unpack "N*", $a[0];
+    is("@a", "3 4", "unpack from an element of the array assigned to");
+    my @refs;
+    for (1, 2) {
+        my @b = unpack "n*", pack "n*", $_, 9;
+        push @refs, \@b;
+    }
+    is(join(",", map { "@$_" } @refs), "1 9,2 9", "my \@lex = unpack is fresh each time");
+    @a = unpack "N*", "\0\0\0\1\0\0";
+    is("@a", "1", "trailing bytes are ignored");
+    @a = unpack "N2", "\0\0\0\1";
+    is("@a", "1", "short string falls back");
+    require Tie::Array;
+    tie my @t, "Tie::StdArray";
+    @t = unpack "v*", "\1\0\2\0";
+    is("@t", "1 2", "tied array falls back");
+    my @u = unpack "C*", "\x{100}\x{41}";
+    is("@u", "256 65", "utf8 string falls back");
+}
@@ -1160,4 +1160,97 @@ foreach(
     is sprintf("%.0f", $_), sprintf("%-.0f", $_), "special-case %.0f on $_";
 }
 
+# "$nv" and the special-cased "%.<number>g" format the digits themselves
+# where they can, and parsing a decimal number does too.  Check both
+# against the C library: "%G" still goes to snprintf(), and
+# POSIX::strtod() is the libc strtod().
+SKIP: {
+    skip "nvsize is $Config{nvsize}, not 8", 3 unless $Config{nvsize} == 8;
+    skip "no POSIX", 3 unless eval { require POSIX; 1 };
+    my @nv = (
+        1234567890123455, 1234567890123445, 999999999999999.5,
+        99999999999999.95, 9.999999999999995e14, 123456789012345,
+        1e14, 1e15, 1e16, 1e21, 1e22, 1e23, 1e40, 1e44,
+        0.1, 0.3, 1/3, 2/3, 0.5, 0.000123456789012345, 1e-4, 1e-5,
+        1e-13, 1e-14, 2**-60, 2**60, 2**70, 5e-324,
+        2.2250738585072014e-308, 1.7976931348623157e308,
+    );
+    srand(20181017);
+    for (1..2000) {
+        push @nv, unpack "d", pack "NN", int(rand(2**32)), int(rand(2**32));
+        push @nv, (rand() - 0.5) * 10 ** (int(rand(80)) - 40);
+        push @nv, int(rand(1e6)) / 10 ** int(rand(8));
+    }
+    @nv = grep { $_ == $_ && $_ - $_ == 0 } map { $_, -$_ } @nv;
+
+    my (@str, @fmt, @parse);
+    for my $nv (@nv) {
+        my $v = unpack "d", pack "d", $nv;    # a plain NV
+        my $want = lc sprintf "%.15G", $v;
+        push @str, "$v: '$v' ne '$want'" if "$v" ne $want;
+        for my $p (1, 6, 10, 15, 17) {
+            my ($got, $want) = (sprintf("%.${p}g", $v), lc sprintf("%.${p}G", $v));
+            push @fmt, "$v %.${p}g: '$got' ne '$want'" if $got ne $want;
+        }
+        for my $s (sprintf("%.17g", $v), sprintf("%.12e", $v), "$v") {
+            my $want = POSIX::strtod($s);
+            push @parse, "'$s' ne $want"
+                if pack("d", 0 + $s) ne pack("d", $want);
+        }
+    }
+    for my $s (qw(9007199254740993 9007199254740995 9007199254740993e5
+                  18446744073709551615 18446744073709551616
+                  9999999999999999999e-27 1e-27 1e27 1e-28 1e28 .5 5. 1.e5
+                  123456789012345678e9 7.450580596923828125e-9 2.5e-27
+                  0.0000000000000000000000000001234 3.14159265358979323))
+    {
+        my $want = POSIX::strtod($s);
+        push @parse, "'$s' ne $want" if pack("d", 0 + $s) ne pack("d", $want);
+    }
+    is @str,   0, "stringified NVs match %.15G" or diag "@str[0..4]";
+    is @fmt,   0, "%.<number>g matches %.<number>G" or diag "@fmt[0..4]";
+    is @parse, 0, "numified strings match POSIX::strtod" or diag "@parse[0..4]";
+}
+
+# Constant formats made only of %s, %d, %i and %f are compiled once and
+# formatted directly; they must agree with the general path, which is
+# what a format held in a variable goes through.
+{
+    my @subs = (
+        [ '%s=%d',         sub { sprintf '%s=%d', @_ } ],
+        [ '%5d|%-5d|%05d', sub { sprintf '%5d|%-5d|%05d', @_ } ],
+        [ '%i%%%-8s.',     sub { sprintf '%i%%%-8s.', @_ } ],
+        [ '%.2f %08.3f',   sub { sprintf '%.2f %08.3f', @_ } ],
+        [ '%f|%.0f|%-9.1f',sub { sprintf '%f|%.0f|%-9.1f', @_ } ],
+        [ 'x%.17fy',       sub { sprintf 'x%.17fy', @_ } ],
+    );
+    my @vals = (0, 1, -1, 42, -0.0, 0.5, 2.5, -2.675, 1.005, 99.995,
+                1e15, 1e19, 1e25, 1e-300, 9**9**9, -9**9**9, ~0, -(~0 >> 1) - 1,
+                "", "abc", "12abc", " 17 ", "-9", "1e3", "0 but true",
+                "\x{263a}", "caf\xe9", undef, [], 1/3);
+    my @bad;
+    for my $s (@subs) {
+        my ($fmt, $code) = @$s;
+        for my $i (0 .. $#vals) {
+            my @args = map $vals[($i + $_ * 7) % @vals], 0 .. 3;
+            my (@got_w, @want_w);
+            my @w1 = map { my $v = $_ } @args;
+            my @w2 = map { my $v = $_ } @args;
+            my $got = do {
+                local $SIG{__WARN__} = sub { push @got_w, $_[0] };
+                $code->(@w1)
+            };
+            my $want = do {
+                local $SIG{__WARN__} = sub { push @want_w, $_[0] };
+                sprintf $fmt, @w2
+            };
+            s/ at .*//s, s/\$(?:_|w2)\[/\$x[/ for @got_w, @want_w;
+            push @bad, "'$fmt': '$got' ne '$want'" if $got ne $want;
+            push @bad, "'$fmt': warnings '@got_w' ne '@want_w'" if "@got_w" ne "@want_w";
+        }
+    }
+    is @bad, 0, "constant formats match the general sprintf path"
+        or diag join "\n", @bad[0 .. ($#bad < 4 ? $#bad : 4)];
+}
+
 done_testing();
@@ -10,7 +10,7 @@ BEGIN {
      skip_all_if_miniperl("no dynamic loading on miniperl, no threads");
      #skip_all('cygwin') if $^O eq 'cygwin';
 
-     plan(30);
+     plan(31);
 }
 
 use strict;
@@ -427,4 +427,25 @@ threads->create(sub{});
 print "ok\n";
 CODE
 
+# the hash keys are shared by all threads with -DPERL_GLOBAL_STRTAB
+fresh_perl_is(<<'CODE', 'ok', {}, 'shared hash keys created and freed by threads');
+use threads;
+my @t = map {
+    my $n = $_;
+    threads->create(sub {
+        my $sum = 0;
+        for my $i (1 .. 50) {
+            my %h = map { ("key$_" => $_) } 1 .. 200;
+            my %g = map { ("t$n.$i.$_" => 1) } 1 .. 20;
+            $sum += $h{key200} + keys %g;
+        }
+        $sum;
+    });
+} 1 .. 4;
+my %h = map { ("key$_" => 1) } 1 .. 200;
+my $ok = 1;
+for (@t) { $ok = 0 if $_->join != 50 * 220 }
+print $ok && keys %h == 200 ? "ok" : "not ok";
+CODE
+
 # EOF
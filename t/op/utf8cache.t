@@ -11,7 +11,7 @@ BEGIN {
 use strict;
 use Config ();
 
-plan(tests => 16);
+plan(tests => 19);
 
 SKIP: {
 skip_without_dynamic_extension("Devel::Peek", 2);
@@ -164,3 +164,29 @@ $ref = bless [], "αabcd_";
 () = length $ref;
 bless $ref, "α";
 is length $ref, length "$ref", 'no utf8 length cache on references';
+
+# Long strings get a sampled offset index. With ${^UTF8CACHE} -1 every
+# cached answer is checked against a full walk, and panics if wrong.
+{
+    no utf8;
+    local ${^UTF8CACHE} = -1;
+    my $str = join "", map { ("a", "\x{e9}", "\x{20ac}", "\x{1f600}")[$_ % 4]
+                                 x (1 + $_ % 7) } 1 .. 40000;
+    my $len = length $str;
+    my ($ok, $pos) = (1, 1);
+    for my $i (1 .. 300) {
+        my $o = ($i * 7919) % ($len - 2);
+        my $c = substr($str, $o, 1);
+        $ok = 0 unless length($c) == 1
+            && $c eq ("a", "\x{e9}", "\x{20ac}", "\x{1f600}")[ord($c) == 0x61 ? 0
+                   : ord($c) == 0xe9 ? 1 : ord($c) == 0x20ac ? 2 : 3];
+        pos($str) = $o;
+        $str =~ /\G./g;
+        $pos = 0 unless pos($str) == $o + 1;
+    }
+    ok($ok, 'substr on a long UTF-8 string with the offset index');
+    ok($pos, 'pos on a long UTF-8 string with the offset index');
+    substr($str, 10, 1) = "\x{100}";
+    is(ord substr($str, $len - 1, 1), ord substr("$str", $len - 1, 1),
+       'the offset index is dropped when the string changes');
+}
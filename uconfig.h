@@ -5446,6 +5446,8 @@
 /* PERL_HASH_FUNC_*:
  *	This symbol defines the used perl hash function variant.
  *      It is set in Configure or via -Dhash_func=, but can be left blank.
+ *      With -Dhash_func=SELECT all functions are compiled in, and one is
+ *      selected at startup by $ENV{PERL_HASH_FUNC}.
  */
 #ifndef	PERL_HASH_FUNC_FNV1A
 #define	PERL_HASH_FUNC_FNV1A	/**/
@@ -5483,6 +5485,6 @@
 #endif
 
 /* Generated from:
- * d295cb5b21070ab7c5076d71ceaa6fe08b12b02a619a95aba11c443ef7f8600a config_h.SH
+ * aaf2a71e4c076faecf21ff34f26d901de350aba70ae68f99aa34eeab96993f70 config_h.SH
  * 1ad21ed3ecb2fac07b7c4aabef76b2fc7354cc6dee0b561e852a1651f8dd6025 uconfig.sh
  * ex: set ro: */
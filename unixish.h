@@ -140,6 +140,7 @@ int afstat(int fd, struct stat *statb);
 	MALLOC_CHECK_TAINT2(*c,*v) PERL_FPU_INIT; PERLIO_INIT; MALLOC_INIT; amigaos4_init_fork_array(); amigaos4_init_environ_sema();
 #  define PERL_SYS_TERM_BODY()                         \
     HINTS_REFCNT_TERM; KEYWORD_PLUGIN_MUTEX_TERM;      \
+    STRTAB_TERM;                                       \
     OP_CHECK_MUTEX_TERM; OP_REFCNT_TERM; PERLIO_TERM;  \
     MALLOC_TERM; LOCALE_TERM; USER_PROP_MUTEX_TERM;    \
     amigaos4_dispose_fork_array();
@@ -153,6 +154,7 @@ int afstat(int fd, struct stat *statb);
 #ifndef PERL_SYS_TERM_BODY
 #  define PERL_SYS_TERM_BODY()                         \
     HINTS_REFCNT_TERM; KEYWORD_PLUGIN_MUTEX_TERM;      \
+    STRTAB_TERM;                                       \
     OP_CHECK_MUTEX_TERM; OP_REFCNT_TERM; PERLIO_TERM;  \
     MALLOC_TERM; LOCALE_TERM; USER_PROP_MUTEX_TERM;
 
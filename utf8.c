@@ -2310,6 +2310,593 @@ Perl_utf8_to_uvuni_buf(pTHX_ const U8 *s, const U8 *send, STRLEN *retlen)
     return NATIVE_TO_UNI(utf8_to_uvchr_buf(s, send, retlen));
 }
 
+/* Certify a prefix of well-formed UTF-8 a block at a time.
+
+   The SIMD kernels use the lookup algorithm of Keiser and Lemire,
+   "Validating UTF-8 In Less Than One Instruction Per Byte" (2021): the
+   high and low nibble of each byte and the high nibble of the byte
+   before it are looked up in 3 tables, whose AND flags every short,
+   long, overlong, surrogate and above-Unicode sequence, and the bytes
+   2 and 3 back tell where continuations must be.  This is stricter
+   than Perl's extended UTF-8, so a block flagged by it is left to the
+   caller's per-character check, which may still accept it. */
+
+#if !defined(EBCDIC) && !defined(PERL_NO_SIMD_UTF8)			\
+    && (defined(__x86_64__) || defined(__i386__))			\
+    && (defined(__clang__)						\
+        || (defined(__GNUC__)						\
+            && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#  define UTF8_SIMD_X86
+#  include <immintrin.h>
+#endif
+
+#ifdef UTF8_SIMD_X86
+
+#  define U8V_TOO_SHORT		(1<<0)	/* 11______ 0_______, 11______ 11______ */
+#  define U8V_TOO_LONG		(1<<1)	/* 0_______ 10______ */
+#  define U8V_OVERLONG_3	(1<<2)	/* 11100000 100_____ */
+#  define U8V_TOO_LARGE		(1<<3)	/* 11110100 1001____ and above */
+#  define U8V_SURROGATE		(1<<4)	/* 11101101 101_____ */
+#  define U8V_OVERLONG_2	(1<<5)	/* 1100000_ 10______ */
+#  define U8V_TOO_LARGE_1000	(1<<6)	/* 11110101 1000____ and above */
+#  define U8V_OVERLONG_4	(1<<6)	/* 11110000 1000____ */
+#  define U8V_TWO_CONTS		(1<<7)	/* 10______ 10______ */
+#  define U8V_CARRY		(U8V_TOO_SHORT|U8V_TOO_LONG|U8V_TWO_CONTS)
+
+/* indexed by the high nibble of the previous byte */
+#  define U8V_BYTE_1_HIGH						\
+    U8V_TOO_LONG, U8V_TOO_LONG, U8V_TOO_LONG, U8V_TOO_LONG,		\
+    U8V_TOO_LONG, U8V_TOO_LONG, U8V_TOO_LONG, U8V_TOO_LONG,		\
+    U8V_TWO_CONTS, U8V_TWO_CONTS, U8V_TWO_CONTS, U8V_TWO_CONTS,	\
+    U8V_TOO_SHORT|U8V_OVERLONG_2,					\
+    U8V_TOO_SHORT,							\
+    U8V_TOO_SHORT|U8V_OVERLONG_3|U8V_SURROGATE,				\
+    U8V_TOO_SHORT|U8V_TOO_LARGE|U8V_TOO_LARGE_1000|U8V_OVERLONG_4
+/* indexed by the low nibble of the previous byte */
+#  define U8V_BYTE_1_LOW							\
+    U8V_CARRY|U8V_OVERLONG_3|U8V_OVERLONG_2|U8V_OVERLONG_4,		\
+    U8V_CARRY|U8V_OVERLONG_2,						\
+    U8V_CARRY,								\
+    U8V_CARRY,								\
+    U8V_CARRY|U8V_TOO_LARGE,						\
+    U8V_CARRY|U8V_TOO_LARGE|U8V_TOO_LARGE_1000,				\
+    U8V_CARRY|U8V_TOO_LARGE|U8V_TOO_LARGE_1000,				\
+    U8V_CARRY|U8V_TOO_LARGE|U8V_TOO_LARGE_1000,				\
+    U8V_CARRY|U8V_TOO_LARGE|U8V_TOO_LARGE_1000,				\
+    U8V_CARRY|U8V_TOO_LARGE|U8V_TOO_LARGE_1000,				\
+    U8V_CARRY|U8V_TOO_LARGE|U8V_TOO_LARGE_1000,				\
+    U8V_CARRY|U8V_TOO_LARGE|U8V_TOO_LARGE_1000,				\
+    U8V_CARRY|U8V_TOO_LARGE|U8V_TOO_LARGE_1000,				\
+    U8V_CARRY|U8V_TOO_LARGE|U8V_TOO_LARGE_1000|U8V_SURROGATE,		\
+    U8V_CARRY|U8V_TOO_LARGE|U8V_TOO_LARGE_1000,				\
+    U8V_CARRY|U8V_TOO_LARGE|U8V_TOO_LARGE_1000
+/* indexed by the high nibble of the byte itself */
+#  define U8V_BYTE_2_HIGH						\
+    U8V_TOO_SHORT, U8V_TOO_SHORT, U8V_TOO_SHORT, U8V_TOO_SHORT,	\
+    U8V_TOO_SHORT, U8V_TOO_SHORT, U8V_TOO_SHORT, U8V_TOO_SHORT,	\
+    U8V_TOO_LONG|U8V_OVERLONG_2|U8V_TWO_CONTS|U8V_OVERLONG_3		\
+        |U8V_TOO_LARGE_1000|U8V_OVERLONG_4,				\
+    U8V_TOO_LONG|U8V_OVERLONG_2|U8V_TWO_CONTS|U8V_OVERLONG_3		\
+        |U8V_TOO_LARGE,							\
+    U8V_TOO_LONG|U8V_OVERLONG_2|U8V_TWO_CONTS|U8V_SURROGATE		\
+        |U8V_TOO_LARGE,							\
+    U8V_TOO_LONG|U8V_OVERLONG_2|U8V_TWO_CONTS|U8V_SURROGATE		\
+        |U8V_TOO_LARGE,							\
+    U8V_TOO_SHORT, U8V_TOO_SHORT, U8V_TOO_SHORT, U8V_TOO_SHORT
+
+/* 16 bytes with SSSE3 */
+__attribute__((target("ssse3")))
+static const U8 *
+S_utf8_valid_prefix_ssse3(const U8 *s, const U8 *e, STRLEN *count,
+                          const bool nonchar)
+{
+    const __m128i byte_1_high = _mm_setr_epi8(U8V_BYTE_1_HIGH);
+    const __m128i byte_1_low  = _mm_setr_epi8(U8V_BYTE_1_LOW);
+    const __m128i byte_2_high = _mm_setr_epi8(U8V_BYTE_2_HIGH);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    /* a lead byte in the last 3 bytes of a block needs the next block */
+    const __m128i incomplete = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                         -1, -1, -1, -1, -1, (char)0xEF, (char)0xDF, (char)0xBF);
+    __m128i prev = _mm_setzero_si128();
+    const U8 *x = s;
+    STRLEN n = 0;
+
+    while (e - x >= 16) {
+        const __m128i in = _mm_loadu_si128((const __m128i *)x);
+        __m128i prev1, error;
+        if (!_mm_movemask_epi8(in)) {
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_subs_epu8(prev, incomplete), _mm_setzero_si128()))
+                != 0xFFFF)
+                break;
+            n += 16;
+        }
+        else {
+            prev1 = _mm_alignr_epi8(in, prev, 15);
+            error = _mm_and_si128(_mm_and_si128(
+                _mm_shuffle_epi8(byte_1_high,
+                    _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+                _mm_shuffle_epi8(byte_1_low, _mm_and_si128(prev1, nibble))),
+                _mm_shuffle_epi8(byte_2_high,
+                    _mm_and_si128(_mm_srli_epi16(in, 4), nibble)));
+            error = _mm_xor_si128(error, _mm_and_si128(_mm_or_si128(
+                _mm_subs_epu8(_mm_alignr_epi8(in, prev, 14),
+                              _mm_set1_epi8(0xE0 - 0x80)),
+                _mm_subs_epu8(_mm_alignr_epi8(in, prev, 13),
+                              _mm_set1_epi8(0xF0 - 0x80))),
+                _mm_set1_epi8((char)0x80)));
+            if (nonchar) /* EF B7 for U+FDD0.., BF BE/BF ends U+xFFFE/F */
+                error = _mm_or_si128(error, _mm_or_si128(
+                    _mm_and_si128(_mm_cmpeq_epi8(prev1, _mm_set1_epi8((char)0xEF)),
+                                  _mm_cmpeq_epi8(in, _mm_set1_epi8((char)0xB7))),
+                    _mm_and_si128(_mm_cmpeq_epi8(prev1, _mm_set1_epi8((char)0xBF)),
+                                  _mm_cmpeq_epi8(_mm_or_si128(in, _mm_set1_epi8(1)),
+                                                 _mm_set1_epi8((char)0xBF)))));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128()))
+                != 0xFFFF)
+                break;
+            /* count all but the continuation bytes 0x80..0xBF */
+            n += 16 - __builtin_popcount(_mm_movemask_epi8(
+                _mm_cmpgt_epi8(_mm_set1_epi8(-64), in)));
+        }
+        prev = in;
+        x += 16;
+    }
+    *count += n;
+    return x;
+}
+
+/* 32 bytes with AVX2 */
+__attribute__((target("avx2")))
+static const U8 *
+S_utf8_valid_prefix_avx2(const U8 *s, const U8 *e, STRLEN *count,
+                         const bool nonchar)
+{
+    const __m256i byte_1_high = _mm256_setr_epi8(U8V_BYTE_1_HIGH, U8V_BYTE_1_HIGH);
+    const __m256i byte_1_low  = _mm256_setr_epi8(U8V_BYTE_1_LOW, U8V_BYTE_1_LOW);
+    const __m256i byte_2_high = _mm256_setr_epi8(U8V_BYTE_2_HIGH, U8V_BYTE_2_HIGH);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i incomplete = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, (char)0xEF, (char)0xDF, (char)0xBF);
+    __m256i prev = _mm256_setzero_si256();
+    const U8 *x = s;
+    STRLEN n = 0;
+
+    while (e - x >= 32) {
+        const __m256i in = _mm256_loadu_si256((const __m256i *)x);
+        /* the high lane of prev and the low lane of in, to shift across */
+        const __m256i carry = _mm256_permute2x128_si256(prev, in, 0x21);
+        __m256i prev1, error;
+        if (!_mm256_movemask_epi8(in)) {
+            if (!_mm256_testz_si256(_mm256_subs_epu8(prev, incomplete),
+                                    _mm256_subs_epu8(prev, incomplete)))
+                break;
+            n += 32;
+        }
+        else {
+            prev1 = _mm256_alignr_epi8(in, carry, 15);
+            error = _mm256_and_si256(_mm256_and_si256(
+                _mm256_shuffle_epi8(byte_1_high,
+                    _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                _mm256_shuffle_epi8(byte_1_low, _mm256_and_si256(prev1, nibble))),
+                _mm256_shuffle_epi8(byte_2_high,
+                    _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble)));
+            error = _mm256_xor_si256(error, _mm256_and_si256(_mm256_or_si256(
+                _mm256_subs_epu8(_mm256_alignr_epi8(in, carry, 14),
+                                 _mm256_set1_epi8(0xE0 - 0x80)),
+                _mm256_subs_epu8(_mm256_alignr_epi8(in, carry, 13),
+                                 _mm256_set1_epi8(0xF0 - 0x80))),
+                _mm256_set1_epi8((char)0x80)));
+            if (nonchar)
+                error = _mm256_or_si256(error, _mm256_or_si256(
+                    _mm256_and_si256(
+                        _mm256_cmpeq_epi8(prev1, _mm256_set1_epi8((char)0xEF)),
+                        _mm256_cmpeq_epi8(in, _mm256_set1_epi8((char)0xB7))),
+                    _mm256_and_si256(
+                        _mm256_cmpeq_epi8(prev1, _mm256_set1_epi8((char)0xBF)),
+                        _mm256_cmpeq_epi8(_mm256_or_si256(in, _mm256_set1_epi8(1)),
+                                          _mm256_set1_epi8((char)0xBF)))));
+            if (!_mm256_testz_si256(error, error))
+                break;
+            n += 32 - __builtin_popcount((U32)_mm256_movemask_epi8(
+                _mm256_cmpgt_epi8(_mm256_set1_epi8(-64), in)));
+        }
+        prev = in;
+        x += 32;
+    }
+    *count += n;
+    return x;
+}
+
+#endif /* UTF8_SIMD_X86 */
+
+/* Returns the end of a prefix of s .. e which is verified to be
+   well-formed UTF-8 a block at a time, and adds the number of characters
+   in it to *count. s must be at the start of a character. The prefix
+   ends at a character boundary, where the caller continues with its own
+   check, and may be empty. It is strict Unicode, without surrogates and
+   code points above 0x10FFFF, and without non-characters when flags
+   include UTF8_DISALLOW_NONCHAR. With AVX2 or SSSE3, chosen at run time,
+   every block is checked, else only runs of ASCII words are taken. */
+
+const U8 *
+Perl__utf8_valid_prefix(const U8 *s, const U8 *e, STRLEN *count, const U32 flags)
+{
+    const U8 *x = s;
+    STRLEN n = 0;
+
+    PERL_ARGS_ASSERT__UTF8_VALID_PREFIX;
+
+#ifdef UTF8_SIMD_X86
+    if (e - s >= 16) {
+        const bool nonchar = cBOOL(flags & UTF8_DISALLOW_NONCHAR);
+        if (e - s >= 32 && __builtin_cpu_supports("avx2"))
+            x = S_utf8_valid_prefix_avx2(s, e, &n, nonchar);
+        else if (__builtin_cpu_supports("ssse3"))
+            x = S_utf8_valid_prefix_ssse3(s, e, &n, nonchar);
+    }
+    if (x > s) {
+        /* back off from a character cut by the end of the last block */
+        const U8 *l = x - 1;
+        while (l > s && UTF8_IS_CONTINUATION(*l))
+            l--;
+        if (l + UTF8SKIP(l) != x) {
+            x = l;
+            n--;
+        }
+        *count += n;
+        return x;
+    }
+#else
+    PERL_UNUSED_ARG(flags);
+#endif
+#ifndef EBCDIC
+    while (e - x >= (SSize_t)sizeof(PERL_UINTMAX_T)) {
+        PERL_UINTMAX_T word;
+        Copy(x, &word, 1, PERL_UINTMAX_T);
+        if (word & (~(PERL_UINTMAX_T)0 / 0xFF * 0x80))
+            break;
+        x += sizeof(PERL_UINTMAX_T);
+    }
+    n = x - s;
+#endif
+    *count += n;
+    return x;
+}
+
+/* Transcoding between Latin-1 and UTF-8 a block at a time.  ASCII
+   blocks are copied whole.  Other blocks are split into the lead and
+   continuation byte each byte would have, interleaved, and 4 bytes at a
+   time are compacted by a shuffle picked by their high bits, or the
+   other way around to downgrade.  Every group of 4 stores 8 (or 4) bytes,
+   so a few bytes after its output may be overwritten, later to be
+   overwritten again by the correct output of the next group. */
+
+#ifdef UTF8_SIMD_X86
+
+#  define U8V_Z 0x80	/* a shuffle index giving a 0 byte */
+
+/* upgrade 4 bytes, indexed by their high bits: the positions of their
+   lead and continuation bytes, interleaved */
+static const U8 utf8_from_bytes_fwd[16][8] = {
+    { 0, 2, 4, 6, U8V_Z, U8V_Z, U8V_Z, U8V_Z },
+    { 0, 1, 2, 4, 6, U8V_Z, U8V_Z, U8V_Z },
+    { 0, 2, 3, 4, 6, U8V_Z, U8V_Z, U8V_Z },
+    { 0, 1, 2, 3, 4, 6, U8V_Z, U8V_Z },
+    { 0, 2, 4, 5, 6, U8V_Z, U8V_Z, U8V_Z },
+    { 0, 1, 2, 4, 5, 6, U8V_Z, U8V_Z },
+    { 0, 2, 3, 4, 5, 6, U8V_Z, U8V_Z },
+    { 0, 1, 2, 3, 4, 5, 6, U8V_Z },
+    { 0, 2, 4, 6, 7, U8V_Z, U8V_Z, U8V_Z },
+    { 0, 1, 2, 4, 6, 7, U8V_Z, U8V_Z },
+    { 0, 2, 3, 4, 6, 7, U8V_Z, U8V_Z },
+    { 0, 1, 2, 3, 4, 6, 7, U8V_Z },
+    { 0, 2, 4, 5, 6, 7, U8V_Z, U8V_Z },
+    { 0, 1, 2, 4, 5, 6, 7, U8V_Z },
+    { 0, 2, 3, 4, 5, 6, 7, U8V_Z },
+    { 0, 1, 2, 3, 4, 5, 6, 7 }
+};
+
+/* the same aligned to the end, for upgrading backwards in place */
+static const U8 utf8_from_bytes_back[16][8] = {
+    { U8V_Z, U8V_Z, U8V_Z, U8V_Z, 0, 2, 4, 6 },
+    { U8V_Z, U8V_Z, U8V_Z, 0, 1, 2, 4, 6 },
+    { U8V_Z, U8V_Z, U8V_Z, 0, 2, 3, 4, 6 },
+    { U8V_Z, U8V_Z, 0, 1, 2, 3, 4, 6 },
+    { U8V_Z, U8V_Z, U8V_Z, 0, 2, 4, 5, 6 },
+    { U8V_Z, U8V_Z, 0, 1, 2, 4, 5, 6 },
+    { U8V_Z, U8V_Z, 0, 2, 3, 4, 5, 6 },
+    { U8V_Z, 0, 1, 2, 3, 4, 5, 6 },
+    { U8V_Z, U8V_Z, U8V_Z, 0, 2, 4, 6, 7 },
+    { U8V_Z, U8V_Z, 0, 1, 2, 4, 6, 7 },
+    { U8V_Z, U8V_Z, 0, 2, 3, 4, 6, 7 },
+    { U8V_Z, 0, 1, 2, 3, 4, 6, 7 },
+    { U8V_Z, U8V_Z, 0, 2, 4, 5, 6, 7 },
+    { U8V_Z, 0, 1, 2, 4, 5, 6, 7 },
+    { U8V_Z, 0, 2, 3, 4, 5, 6, 7 },
+    { 0, 1, 2, 3, 4, 5, 6, 7 }
+};
+
+/* the number of bits set in a nibble, without needing popcnt */
+static const U8 utf8_nibble_bits[16] = {
+    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+};
+
+/* downgrade 4 bytes, indexed by which are lead bytes to drop */
+static const U8 utf8_to_bytes_keep[16][4] = {
+    { 0, 1, 2, 3 },         { 1, 2, 3, U8V_Z },
+    { 0, 2, 3, U8V_Z },     { 2, 3, U8V_Z, U8V_Z },
+    { 0, 1, 3, U8V_Z },     { 1, 3, U8V_Z, U8V_Z },
+    { 0, 3, U8V_Z, U8V_Z }, { 3, U8V_Z, U8V_Z, U8V_Z },
+    { 0, 1, 2, U8V_Z },     { 1, 2, U8V_Z, U8V_Z },
+    { 0, 2, U8V_Z, U8V_Z }, { 2, U8V_Z, U8V_Z, U8V_Z },
+    { 0, 1, U8V_Z, U8V_Z }, { 1, U8V_Z, U8V_Z, U8V_Z },
+    { 0, U8V_Z, U8V_Z, U8V_Z }, { U8V_Z, U8V_Z, U8V_Z, U8V_Z }
+};
+
+/* The lead and continuation bytes of the 16 bytes in, interleaved, for
+   bytes 0..7 in *lo and 8..15 in *hi.  An ASCII byte is its own lead. */
+__attribute__((target("ssse3")))
+PERL_STATIC_INLINE void
+S_utf8_from_bytes_split(const __m128i in, __m128i *lo, __m128i *hi)
+{
+    const __m128i high = _mm_cmplt_epi8(in, _mm_setzero_si128());
+    const __m128i lead = _mm_or_si128(_mm_andnot_si128(high, in),
+        _mm_and_si128(high, _mm_or_si128(_mm_set1_epi8((char)0xC0),
+            _mm_and_si128(_mm_srli_epi16(in, 6), _mm_set1_epi8(0x03)))));
+    const __m128i cont = _mm_and_si128(in, _mm_set1_epi8((char)0xBF));
+    *lo = _mm_unpacklo_epi8(lead, cont);
+    *hi = _mm_unpackhi_epi8(lead, cont);
+}
+
+__attribute__((target("ssse3")))
+static const U8 *
+S_utf8_from_bytes_ssse3(const U8 *s, const U8 *const e, U8 **dp)
+{
+    U8 *d = *dp;
+
+    while (e - s >= 16) {
+        const __m128i in = _mm_loadu_si128((const __m128i *)s);
+        const unsigned high = (unsigned)_mm_movemask_epi8(in);
+        if (!high)
+            _mm_storeu_si128((__m128i *)d, in);
+        else {
+            __m128i half[2];
+            unsigned g;
+            /* the stores of the last group need 4 bytes of more output */
+            if (e - s < 20)
+                break;
+            S_utf8_from_bytes_split(in, &half[0], &half[1]);
+            for (g = 0; g < 4; g++) {
+                const unsigned m = (high >> (4 * g)) & 0xF;
+                const __m128i idx = _mm_add_epi8(
+                    _mm_loadl_epi64((const __m128i *)utf8_from_bytes_fwd[m]),
+                    _mm_set1_epi8((char)(8 * (g & 1))));
+                _mm_storel_epi64((__m128i *)d,
+                                 _mm_shuffle_epi8(half[g >> 1], idx));
+                d += 4 + utf8_nibble_bits[m];
+            }
+            s += 16;
+            continue;
+        }
+        s += 16;
+        d += 16;
+    }
+    *dp = d;
+    return s;
+}
+
+__attribute__((target("ssse3")))
+static const U8 *
+S_utf8_from_bytes_back_ssse3(const U8 *const s, const U8 *e, U8 **dendp)
+{
+    U8 *dend = *dendp;
+
+    while (e - s >= 16) {
+        const __m128i in = _mm_loadu_si128((const __m128i *)(e - 16));
+        const unsigned high = (unsigned)_mm_movemask_epi8(in);
+        if (!high)
+            _mm_storeu_si128((__m128i *)(dend - 16), in);
+        else {
+            __m128i half[2];
+            int g;
+            /* The stores of the first group may reach 4 bytes below its
+               output, which must not be input still to be read */
+            if (dend - e - utf8_nibble_bits[high & 0xF]
+                - utf8_nibble_bits[(high >> 4) & 0xF]
+                - utf8_nibble_bits[(high >> 8) & 0xF]
+                - utf8_nibble_bits[high >> 12] < 4)
+                break;
+            S_utf8_from_bytes_split(in, &half[0], &half[1]);
+            for (g = 3; g >= 0; g--) {
+                const unsigned m = (high >> (4 * g)) & 0xF;
+                const __m128i idx = _mm_add_epi8(
+                    _mm_loadl_epi64((const __m128i *)utf8_from_bytes_back[m]),
+                    _mm_set1_epi8((char)(8 * (g & 1))));
+                _mm_storel_epi64((__m128i *)(dend - 8),
+                                 _mm_shuffle_epi8(half[g >> 1], idx));
+                dend -= 4 + utf8_nibble_bits[m];
+            }
+            e -= 16;
+            continue;
+        }
+        e -= 16;
+        dend -= 16;
+    }
+    *dendp = dend;
+    return e;
+}
+
+__attribute__((target("ssse3")))
+static const U8 *
+S_utf8_to_bytes_ssse3(const U8 *s, const U8 *const e, U8 **dp)
+{
+    U8 *d = dp ? *dp : NULL;
+
+    while (e - s >= 16) {
+        const __m128i in = _mm_loadu_si128((const __m128i *)s);
+        const unsigned high = (unsigned)_mm_movemask_epi8(in);
+        unsigned lead, cont;
+        if (!high) {
+            if (d) {
+                _mm_storeu_si128((__m128i *)d, in);
+                d += 16;
+            }
+            s += 16;
+            continue;
+        }
+        /* only C2 or C3 each followed by a continuation */
+        lead = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_and_si128(in, _mm_set1_epi8((char)0xFE)),
+            _mm_set1_epi8((char)0xC2)));
+        cont = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_and_si128(in, _mm_set1_epi8((char)0xC0)),
+            _mm_set1_epi8((char)0x80)));
+        if ((lead | cont) != high || cont != ((lead << 1) & 0xFFFF))
+            break;
+        if (d) {
+            /* the low 2 bits of the lead into a continuation */
+            const __m128i is_cont = _mm_cmpeq_epi8(
+                _mm_and_si128(in, _mm_set1_epi8((char)0xC0)),
+                _mm_set1_epi8((char)0x80));
+            const __m128i byte = _mm_or_si128(_mm_andnot_si128(is_cont, in),
+                _mm_and_si128(is_cont, _mm_or_si128(
+                    _mm_and_si128(in, _mm_set1_epi8(0x3F)),
+                    _mm_and_si128(_mm_slli_epi16(_mm_slli_si128(in, 1), 6),
+                                  _mm_set1_epi8((char)0xC0)))));
+            unsigned g;
+            for (g = 0; g < 4; g++) {
+                const unsigned m = (lead >> (4 * g)) & 0xF;
+                int keep, out;
+                Copy(utf8_to_bytes_keep[m], &keep, 4, U8);
+                out = _mm_cvtsi128_si32(_mm_shuffle_epi8(byte, _mm_add_epi8(
+                    _mm_cvtsi32_si128(keep), _mm_set1_epi8((char)(4 * g)))));
+                if (g == 3 && (lead & 0x8000))
+                    /* in place the last byte is still to be read */
+                    Copy(&out, d, 3 - utf8_nibble_bits[m & 7], U8);
+                else
+                    Copy(&out, d, 4, U8);
+                d += 4 - utf8_nibble_bits[m];
+            }
+        }
+        /* a lead in the last byte is left for the next block */
+        s += (lead & 0x8000) ? 15 : 16;
+    }
+    if (dp)
+        *dp = d;
+    return s;
+}
+
+#endif /* UTF8_SIMD_X86 */
+
+/* Upgrades the Latin-1 bytes s .. e to UTF-8 at d, which must have room
+   for e - s plus the number of variants, and does not overlap with them.
+   Returns the end of the output, without adding a NUL. */
+
+U8 *
+Perl__utf8_from_bytes(const U8 *s, const U8 *const e, U8 *d)
+{
+    PERL_ARGS_ASSERT__UTF8_FROM_BYTES;
+
+#ifdef UTF8_SIMD_X86
+    if (e - s >= 16 && __builtin_cpu_supports("ssse3"))
+        s = S_utf8_from_bytes_ssse3(s, e, &d);
+#endif
+    while (s < e) {
+#ifndef EBCDIC
+        if (e - s >= (SSize_t)sizeof(PERL_UINTMAX_T)) {
+            const U8 *const w = s + sizeof(PERL_UINTMAX_T);
+            PERL_UINTMAX_T word;
+            Copy(s, &word, 1, PERL_UINTMAX_T);
+            if (!(word & (~(PERL_UINTMAX_T)0 / 0xFF * 0x80))) {
+                Copy(&word, d, 1, PERL_UINTMAX_T);
+                s = w;
+                d += sizeof(PERL_UINTMAX_T);
+            }
+            else
+                for (; s < w; s++)
+                    append_utf8_from_native_byte(*s, &d);
+            continue;
+        }
+#endif
+        append_utf8_from_native_byte(*s, &d);
+        s++;
+    }
+    return d;
+}
+
+/* Upgrades a suffix of the Latin-1 bytes s .. e in place, to UTF-8
+   ending at *dendp, and moves *dendp back to its start.  *dendp must be
+   as far behind e as there are variants in s .. e.  Returns the end of
+   the bytes left to upgrade, which may be all of them. */
+
+const U8 *
+Perl__utf8_from_bytes_back(const U8 *const s, const U8 *e, U8 **dendp)
+{
+    PERL_ARGS_ASSERT__UTF8_FROM_BYTES_BACK;
+
+#ifdef UTF8_SIMD_X86
+    if (e - s >= 16 && __builtin_cpu_supports("ssse3"))
+        return S_utf8_from_bytes_back_ssse3(s, e, dendp);
+#endif
+#ifndef EBCDIC
+    {
+        U8 *dend = *dendp;
+        while (e - s >= (SSize_t)sizeof(PERL_UINTMAX_T)) {
+            PERL_UINTMAX_T word;
+            Copy(e - sizeof(PERL_UINTMAX_T), &word, 1, PERL_UINTMAX_T);
+            if (word & (~(PERL_UINTMAX_T)0 / 0xFF * 0x80))
+                break;
+            e -= sizeof(PERL_UINTMAX_T);
+            dend -= sizeof(PERL_UINTMAX_T);
+            Copy(&word, dend, 1, PERL_UINTMAX_T);
+        }
+        *dendp = dend;
+    }
+#endif
+    return e;
+}
+
+/* Downgrades a prefix of the UTF-8 s .. e to Latin-1 bytes at *dp,
+   advancing *dp, or only checks it can be downgraded if dp is NULL.  *dp
+   may be s itself, to downgrade in place.  Returns the end of the prefix, which is at a character
+   boundary and may be s; the caller handles what follows. */
+
+const U8 *
+Perl__utf8_to_bytes_prefix(const U8 *s, const U8 *const e, U8 **dp)
+{
+    PERL_ARGS_ASSERT__UTF8_TO_BYTES_PREFIX;
+
+#ifdef UTF8_SIMD_X86
+    if (e - s >= 16 && __builtin_cpu_supports("ssse3"))
+        return S_utf8_to_bytes_ssse3(s, e, dp);
+#endif
+#ifndef EBCDIC
+    {
+        U8 *d = dp ? *dp : NULL;
+        while (e - s >= (SSize_t)sizeof(PERL_UINTMAX_T)) {
+            PERL_UINTMAX_T word;
+            Copy(s, &word, 1, PERL_UINTMAX_T);
+            if (word & (~(PERL_UINTMAX_T)0 / 0xFF * 0x80))
+                break;
+            if (d) {
+                Copy(&word, d, 1, PERL_UINTMAX_T);
+                d += sizeof(PERL_UINTMAX_T);
+            }
+            s += sizeof(PERL_UINTMAX_T);
+        }
+        if (dp)
+            *dp = d;
+    }
+#else
+    PERL_UNUSED_ARG(e);
+    PERL_UNUSED_ARG(dp);
+#endif
+    return s;
+}
+
 /*
 =for apidoc utf8_length
 
@@ -2337,6 +2924,9 @@ Perl_utf8_length(pTHX_ const U8 *s, const U8 *e)
     if (UNLIKELY(e < s))
 	goto warn_and_return;
     while (s < e) {
+        s = _utf8_valid_prefix(s, e, &len, 0);
+        if (s >= e)
+            break;
         s += UTF8SKIP(s);
 	len++;
     }
@@ -2459,6 +3049,9 @@ Perl_utf8_to_bytes(pTHX_ U8 *s, STRLEN *lenp)
          * work there */
         s = first_variant;
         while (s < send) {
+            s = (U8 *) _utf8_to_bytes_prefix(s, send, NULL);
+            if (s >= send)
+                break;
             if (! UTF8_IS_INVARIANT(*s)) {
                 if (! UTF8_IS_NEXT_CHAR_DOWNGRADEABLE(s, send)) {
                     *lenp = ((STRLEN) -1);
@@ -2472,7 +3065,11 @@ Perl_utf8_to_bytes(pTHX_ U8 *s, STRLEN *lenp)
         /* Is downgradable, so do it */
         d = s = first_variant;
         while (s < send) {
-            U8 c = *s++;
+            U8 c;
+            s = (U8 *) _utf8_to_bytes_prefix(s, send, &d);
+            if (s >= send)
+                break;
+            c = *s++;
             if (! UVCHR_IS_INVARIANT(c)) {
                 /* Then it is two-byte encoded */
                 c = EIGHT_BIT_UTF8_TO_NATIVE(c, *s);
@@ -2589,7 +3186,11 @@ Perl_bytes_from_utf8_loc(const U8 *s, STRLEN *lenp, bool *is_utf8p, const U8** f
 
     converted_start = d;
     while (s < send) {
-        U8 c = *s++;
+        U8 c;
+        s = _utf8_to_bytes_prefix(s, send, &d);
+        if (s >= send)
+            break;
+        c = *s++;
         if (! UTF8_IS_INVARIANT(c)) {
 
             /* Then it is multi-byte encoded.  If the code point is above 0xFF,
@@ -2663,10 +3264,7 @@ Perl_bytes_to_utf8(pTHX_ const U8 *s, STRLEN *lenp)
     Newx(d, (*lenp) + variant_under_utf8_count(s, send) + 1, U8);
     dst = d;
 
-    while (s < send) {
-        append_utf8_from_native_byte(*s, &d);
-        s++;
-    }
+    d = _utf8_from_bytes(s, send, d);
 
     *d = '\0';
     *lenp = d-dst;
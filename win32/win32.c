@@ -4539,6 +4539,7 @@ void
 Perl_win32_term(void)
 {
     HINTS_REFCNT_TERM;
+    STRTAB_TERM;
     OP_REFCNT_TERM;
     PERLIO_TERM;
     MALLOC_TERM;
@@ -0,0 +1 @@
+xsutils.c
\ No newline at end of file